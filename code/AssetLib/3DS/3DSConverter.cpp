@@ -380,7 +380,7 @@ void Discreet3DSImporter::ConvertMeshes(aiScene *pcOut) {
                 unsigned int index = aiSplit[p][q];
                 aiFace &face = meshOut->mFaces[q];
 
-                face.mIndices = new unsigned int[3];
+                face.mIndices = AllocateSceneArray<unsigned int>(3);
                 face.mNumIndices = 3;
 
                 for (unsigned int a = 0; a < 3; ++a, ++base) {
@@ -399,7 +399,7 @@ void Discreet3DSImporter::ConvertMeshes(aiScene *pcOut) {
 
     // Copy them to the output array
     pcOut->mNumMeshes = (unsigned int)avOutMeshes.size();
-    pcOut->mMeshes = new aiMesh *[pcOut->mNumMeshes]();
+    pcOut->mMeshes = AllocateSceneArray<aiMesh *>(pcOut->mNumMeshes, nullptr);
     for (unsigned int a = 0; a < pcOut->mNumMeshes; ++a) {
         pcOut->mMeshes[a] = avOutMeshes[a];
     }
@@ -440,7 +440,7 @@ void Discreet3DSImporter::AddNodeToGraph(aiScene *pcSOut, aiNode *pcOut,
         aiVector3D pivot = pcIn->vPivot;
 
         pcOut->mNumMeshes = (unsigned int)iArray.size();
-        pcOut->mMeshes = new unsigned int[iArray.size()];
+        pcOut->mMeshes = AllocateSceneArray<unsigned int>(iArray.size());
         for (unsigned int i = 0; i < iArray.size(); ++i) {
             const unsigned int iIndex = iArray[i];
             aiMesh *const mesh = pcSOut->mMeshes[iIndex];
@@ -648,7 +648,7 @@ void Discreet3DSImporter::AddNodeToGraph(aiScene *pcSOut, aiNode *pcOut,
 
     // Allocate storage for children
     pcOut->mNumChildren = (unsigned int)pcIn->mChildren.size();
-    pcOut->mChildren = new aiNode *[pcIn->mChildren.size()];
+    pcOut->mChildren = AllocateSceneArray<aiNode *>(pcIn->mChildren.size());
 
     // Recursively process all children
     const unsigned int size = static_cast<unsigned int>(pcIn->mChildren.size());
@@ -700,7 +700,7 @@ void Discreet3DSImporter::GenerateNodeGraph(aiScene *pcOut) {
         pcOut->mRootNode->mNumChildren = pcOut->mNumMeshes +
                                          static_cast<unsigned int>(mScene->mCameras.size() + mScene->mLights.size());
 
-        pcOut->mRootNode->mChildren = new aiNode *[pcOut->mRootNode->mNumChildren];
+        pcOut->mRootNode->mChildren = AllocateSceneArray<aiNode *>(pcOut->mRootNode->mNumChildren);
         pcOut->mRootNode->mName.Set("<3DSDummyRoot>");
 
         // Build dummy nodes for all meshes
@@ -708,7 +708,7 @@ void Discreet3DSImporter::GenerateNodeGraph(aiScene *pcOut) {
         for (unsigned int i = 0; i < pcOut->mNumMeshes; ++i, ++a) {
             aiNode *pcNode = pcOut->mRootNode->mChildren[a] = new aiNode();
             pcNode->mParent = pcOut->mRootNode;
-            pcNode->mMeshes = new unsigned int[1];
+            pcNode->mMeshes = AllocateSceneArray<unsigned int>(1);
             pcNode->mMeshes[0] = i;
             pcNode->mNumMeshes = 1;
 
@@ -742,7 +742,7 @@ void Discreet3DSImporter::GenerateNodeGraph(aiScene *pcOut) {
         if (numChannel) {
             // Allocate a primary animation channel
             pcOut->mNumAnimations = 1;
-            pcOut->mAnimations = new aiAnimation *[1];
+            pcOut->mAnimations = AllocateSceneArray<aiAnimation *>(1);
             aiAnimation *anim = pcOut->mAnimations[0] = new aiAnimation();
 
             anim->mName.Set("3DSMasterAnim");
@@ -750,7 +750,7 @@ void Discreet3DSImporter::GenerateNodeGraph(aiScene *pcOut) {
             // Allocate enough storage for all node animation channels,
             // but don't set the mNumChannels member - we'll use it to
             // index into the array
-            anim->mChannels = new aiNodeAnim *[numChannel];
+            anim->mChannels = AllocateSceneArray<aiNodeAnim *>(numChannel);
         }
 
         aiMatrix4x4 m;
@@ -782,7 +782,7 @@ void Discreet3DSImporter::GenerateNodeGraph(aiScene *pcOut) {
 void Discreet3DSImporter::ConvertScene(aiScene *pcOut) {
     // Allocate enough storage for all output materials
     pcOut->mNumMaterials = (unsigned int)mScene->mMaterials.size();
-    pcOut->mMaterials = new aiMaterial *[pcOut->mNumMaterials];
+    pcOut->mMaterials = AllocateSceneArray<aiMaterial *>(pcOut->mNumMaterials);
 
     //  ... and convert the 3DS materials to aiMaterial's
     for (unsigned int i = 0; i < pcOut->mNumMaterials; ++i) {
@@ -797,14 +797,14 @@ void Discreet3DSImporter::ConvertScene(aiScene *pcOut) {
     // Now copy all light sources to the output scene
     pcOut->mNumLights = (unsigned int)mScene->mLights.size();
     if (pcOut->mNumLights) {
-        pcOut->mLights = new aiLight *[pcOut->mNumLights];
+        pcOut->mLights = AllocateSceneArray<aiLight *>(pcOut->mNumLights);
         ::memcpy(pcOut->mLights, &mScene->mLights[0], sizeof(void *) * pcOut->mNumLights);
     }
 
     // Now copy all cameras to the output scene
     pcOut->mNumCameras = (unsigned int)mScene->mCameras.size();
     if (pcOut->mNumCameras) {
-        pcOut->mCameras = new aiCamera *[pcOut->mNumCameras];
+        pcOut->mCameras = AllocateSceneArray<aiCamera *>(pcOut->mNumCameras);
         ::memcpy(pcOut->mCameras, &mScene->mCameras[0], sizeof(void *) * pcOut->mNumCameras);
     }
 }
@@ -208,7 +208,7 @@ public:
         // import the meshes
         scene->mNumMeshes = static_cast<unsigned int>(mMeshCount);
         if (scene->mNumMeshes != 0) {
-            scene->mMeshes = new aiMesh *[scene->mNumMeshes]();
+            scene->mMeshes = AllocateSceneArray<aiMesh *>(scene->mNumMeshes, nullptr);
             for (auto it = mResourcesDictionnary.begin(); it != mResourcesDictionnary.end(); ++it) {
                 if (it->second->getType() == ResourceType::RT_Object) {
                     Object *obj = static_cast<Object *>(it->second);
@@ -223,7 +223,7 @@ public:
         // import the materials
         scene->mNumMaterials = mMaterialCount;
         if (scene->mNumMaterials != 0) {
-            scene->mMaterials = new aiMaterial *[scene->mNumMaterials];
+            scene->mMaterials = AllocateSceneArray<aiMaterial *>(scene->mNumMaterials);
             for (auto it = mResourcesDictionnary.begin(); it != mResourcesDictionnary.end(); ++it) {
                 if (it->second->getType() == ResourceType::RT_BaseMaterials) {
                     BaseMaterials *baseMaterials = static_cast<BaseMaterials *>(it->second);
@@ -241,7 +241,7 @@ private:
 
         aiNode *sceneNode = new aiNode(obj->mName);
         sceneNode->mNumMeshes = static_cast<unsigned int>(obj->mMeshes.size());
-        sceneNode->mMeshes = new unsigned int[sceneNode->mNumMeshes];
+        sceneNode->mMeshes = AllocateSceneArray<unsigned int>(sceneNode->mNumMeshes);
         std::copy(obj->mMeshIndex.begin(), obj->mMeshIndex.end(), sceneNode->mMeshes);
 
         sceneNode->mTransformation = nodeTransform;
@@ -462,7 +462,7 @@ private:
         aiFace face;
 
         face.mNumIndices = 3;
-        face.mIndices = new unsigned int[face.mNumIndices];
+        face.mIndices = AllocateSceneArray<unsigned int>(face.mNumIndices);
         face.mIndices[0] = static_cast<unsigned int>(std::atoi(node.attribute(XmlTag::v1).as_string()));
         face.mIndices[1] = static_cast<unsigned int>(std::atoi(node.attribute(XmlTag::v2).as_string()));
         face.mIndices[2] = static_cast<unsigned int>(std::atoi(node.attribute(XmlTag::v3).as_string()));
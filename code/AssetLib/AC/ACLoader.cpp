@@ -427,7 +427,7 @@ aiNode *AC3DImporter::ConvertObjectSection(Object &object,
             for (unsigned int i = 0; i < mesh->mNumVertices; ++i, ++faces, ++verts) {
                 *verts = object.vertices[i];
                 faces->mNumIndices = 1;
-                faces->mIndices = new unsigned int[1];
+                faces->mIndices = AllocateSceneArray<unsigned int>(1);
                 faces->mIndices[0] = i;
             }
 
@@ -504,7 +504,7 @@ aiNode *AC3DImporter::ConvertObjectSection(Object &object,
                     needMat[idx].second += (unsigned int)(*it).entries.size();
                 };
             }
-            unsigned int *pip = node->mMeshes = new unsigned int[node->mNumMeshes];
+            unsigned int *pip = node->mMeshes = AllocateSceneArray<unsigned int>(node->mNumMeshes);
             unsigned int mat = 0;
             const size_t oldm = meshes.size();
             for (MatTable::const_iterator cit = needMat.begin(), cend = needMat.end();
@@ -558,7 +558,7 @@ aiNode *AC3DImporter::ConvertObjectSection(Object &object,
                             aiFace &face = *faces++;
                             face.mNumIndices = (unsigned int)src.entries.size();
                             if (0 != face.mNumIndices) {
-                                face.mIndices = new unsigned int[face.mNumIndices];
+                                face.mIndices = AllocateSceneArray<unsigned int>(face.mNumIndices);
                                 for (unsigned int i = 0; i < face.mNumIndices; ++i, ++vertices) {
                                     const Surface::SurfaceEntry &entry = src.entries[i];
                                     face.mIndices[i] = cur++;
@@ -594,7 +594,7 @@ aiNode *AC3DImporter::ConvertObjectSection(Object &object,
 
                                 aiFace &face = *faces++;
                                 face.mNumIndices = 3;
-                                face.mIndices = new unsigned int[face.mNumIndices];
+                                face.mIndices = AllocateSceneArray<unsigned int>(face.mNumIndices);
                                 face.mIndices[0] = cur++;
                                 face.mIndices[1] = cur++;
                                 face.mIndices[2] = cur++;
@@ -646,7 +646,7 @@ aiNode *AC3DImporter::ConvertObjectSection(Object &object,
                                 aiFace &face = *faces++;
 
                                 face.mNumIndices = 2;
-                                face.mIndices = new unsigned int[2];
+                                face.mIndices = AllocateSceneArray<unsigned int>(2);
                                 face.mIndices[0] = cur++;
                                 face.mIndices[1] = cur++;
 
@@ -739,7 +739,7 @@ aiNode *AC3DImporter::ConvertObjectSection(Object &object,
     // add children to the object
     if (object.children.size()) {
         node->mNumChildren = (unsigned int)object.children.size();
-        node->mChildren = new aiNode *[node->mNumChildren];
+        node->mChildren = AllocateSceneArray<aiNode *>(node->mNumChildren);
         for (unsigned int i = 0; i < node->mNumChildren; ++i) {
             node->mChildren[i] = ConvertObjectSection(object.children[i], meshes, outMaterials, materials, node);
         }
@@ -855,18 +855,18 @@ void AC3DImporter::InternReadFile(const std::string &pFile,
         throw DeadlyImportError("An unknown error occurred during converting");
     }
     pScene->mNumMeshes = (unsigned int)meshes.size();
-    pScene->mMeshes = new aiMesh *[pScene->mNumMeshes];
+    pScene->mMeshes = AllocateSceneArray<aiMesh *>(pScene->mNumMeshes);
     ::memcpy(pScene->mMeshes, &meshes[0], pScene->mNumMeshes * sizeof(void *));
 
     // copy materials
     pScene->mNumMaterials = (unsigned int)omaterials.size();
-    pScene->mMaterials = new aiMaterial *[pScene->mNumMaterials];
+    pScene->mMaterials = AllocateSceneArray<aiMaterial *>(pScene->mNumMaterials);
     ::memcpy(pScene->mMaterials, &omaterials[0], pScene->mNumMaterials * sizeof(void *));
 
     // copy lights
     pScene->mNumLights = (unsigned int)lights.size();
     if (lights.size()) {
-        pScene->mLights = new aiLight *[lights.size()];
+        pScene->mLights = AllocateSceneArray<aiLight *>(lights.size());
         ::memcpy(pScene->mLights, &lights[0], lights.size() * sizeof(void *));
     }
 }
@@ -255,7 +255,7 @@ size_t AMFImporter::PostprocessHelper_GetTextureID_Or_Create(const std::string &
     }
 
     // Create target array.
-    converted_texture.Data = new uint8_t[tex_size];
+    converted_texture.Data = AllocateSceneArray<uint8_t>(tex_size);
     // And copy data
     auto CopyTextureData = [&](const std::string &pID, const size_t pOffset, const size_t pStep, const uint8_t pSrcTexNum) -> void {
         if (!pID.empty()) {
@@ -410,7 +410,7 @@ void AMFImporter::Postprocess_BuildMeshSet(const AMFMesh &pNodeElement, const st
 
                     // create new face and store it.
                     complex_face.Face.mNumIndices = 3;
-                    complex_face.Face.mIndices = new unsigned int[3];
+                    complex_face.Face.mIndices = AllocateSceneArray<unsigned int>(3);
                     complex_face.Face.mIndices[0] = static_cast<unsigned int>(tri_al.V[0]);
                     complex_face.Face.mIndices[1] = static_cast<unsigned int>(tri_al.V[1]);
                     complex_face.Face.mIndices[2] = static_cast<unsigned int>(tri_al.V[2]);
@@ -648,7 +648,7 @@ void AMFImporter::Postprocess_BuildMeshSet(const AMFMesh &pNodeElement, const st
         std::list<unsigned int>::const_iterator mit = mesh_idx.begin();
 
         pSceneNode.mNumMeshes = static_cast<unsigned int>(mesh_idx.size());
-        pSceneNode.mMeshes = new unsigned int[pSceneNode.mNumMeshes];
+        pSceneNode.mMeshes = AllocateSceneArray<unsigned int>(pSceneNode.mNumMeshes);
         for (size_t i = 0; i < pSceneNode.mNumMeshes; i++)
             pSceneNode.mMeshes[i] = *mit++;
     } // if(mesh_idx.size() > 0)
@@ -705,7 +705,7 @@ void AMFImporter::Postprocess_BuildConstellation(AMFConstellation &pConstellatio
         aiMatrix4x4::RotationZ(als.Rotation.z, tmat), t_node->mTransformation *= tmat;
         // create array for one child node
         t_node->mNumChildren = 1;
-        t_node->mChildren = new aiNode *[t_node->mNumChildren];
+        t_node->mChildren = AllocateSceneArray<aiNode *>(t_node->mNumChildren);
         SceneCombiner::Copy(&t_node->mChildren[0], found_node);
         t_node->mChildren[0]->mParent = t_node;
         ch_node.push_back(t_node);
@@ -717,7 +717,7 @@ void AMFImporter::Postprocess_BuildConstellation(AMFConstellation &pConstellatio
     size_t ch_idx = 0;
 
     con_node->mNumChildren = static_cast<unsigned int>(ch_node.size());
-    con_node->mChildren = new aiNode *[con_node->mNumChildren];
+    con_node->mChildren = AllocateSceneArray<aiNode *>(con_node->mNumChildren);
     for (aiNode *node : ch_node)
         con_node->mChildren[ch_idx++] = node;
 
@@ -832,7 +832,7 @@ nl_clean_loop:
         NodeArray::const_iterator nl_it = nodeArray.begin();
 
         pScene->mRootNode->mNumChildren = static_cast<unsigned int>(nodeArray.size());
-        pScene->mRootNode->mChildren = new aiNode *[pScene->mRootNode->mNumChildren];
+        pScene->mRootNode->mChildren = AllocateSceneArray<aiNode *>(pScene->mRootNode->mNumChildren);
         for (size_t i = 0; i < pScene->mRootNode->mNumChildren; i++) {
             // Objects and constellation that must be showed placed at top of hierarchy in <amf> node. So all aiNode's in node_list must have
             // mRootNode only as parent.
@@ -847,7 +847,7 @@ nl_clean_loop:
         MeshArray::const_iterator ml_it = mesh_list.begin();
 
         pScene->mNumMeshes = static_cast<unsigned int>(mesh_list.size());
-        pScene->mMeshes = new aiMesh *[pScene->mNumMeshes];
+        pScene->mMeshes = AllocateSceneArray<aiMesh *>(pScene->mNumMeshes);
         for (size_t i = 0; i < pScene->mNumMeshes; i++)
             pScene->mMeshes[i] = *ml_it++;
     } // if(mesh_list.size() > 0)
@@ -859,7 +859,7 @@ nl_clean_loop:
         size_t idx;
 
         idx = 0;
-        pScene->mTextures = new aiTexture *[pScene->mNumTextures];
+        pScene->mTextures = AllocateSceneArray<aiTexture *>(pScene->mNumTextures);
         for (const SPP_Texture &tex_convd : mTexture_Converted) {
             pScene->mTextures[idx] = new aiTexture;
             pScene->mTextures[idx]->mWidth = static_cast<unsigned int>(tex_convd.Width);
@@ -873,7 +873,7 @@ nl_clean_loop:
         // Create materials for embedded textures.
         idx = 0;
         pScene->mNumMaterials = static_cast<unsigned int>(mTexture_Converted.size());
-        pScene->mMaterials = new aiMaterial *[pScene->mNumMaterials];
+        pScene->mMaterials = AllocateSceneArray<aiMaterial *>(pScene->mNumMaterials);
         for (const SPP_Texture &tex_convd : mTexture_Converted) {
             const aiString texture_id(AI_EMBEDDED_TEXNAME_PREFIX + ai_to_string(idx));
             const int mode = aiTextureOp_Multiply;
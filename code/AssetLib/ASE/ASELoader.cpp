@@ -205,7 +205,7 @@ void ASEImporter::InternReadFile(const std::string &pFile,
 
         // Now build the output mesh list. Remove dummies
         pScene->mNumMeshes = (unsigned int)avOutMeshes.size();
-        aiMesh **pp = pScene->mMeshes = new aiMesh *[pScene->mNumMeshes];
+        aiMesh **pp = pScene->mMeshes = AllocateSceneArray<aiMesh *>(pScene->mNumMeshes);
         for (std::vector<aiMesh *>::const_iterator i = avOutMeshes.begin(); i != avOutMeshes.end(); ++i) {
             if (!(*i)->mNumFaces) {
                 continue;
@@ -321,10 +321,10 @@ void ASEImporter::BuildAnimations(const std::vector<BaseNode *> &nodes) {
     if (iNum) {
         // Generate a new animation channel and setup everything for it
         pcScene->mNumAnimations = 1;
-        pcScene->mAnimations = new aiAnimation *[1];
+        pcScene->mAnimations = AllocateSceneArray<aiAnimation *>(1);
         aiAnimation *pcAnim = pcScene->mAnimations[0] = new aiAnimation();
         pcAnim->mNumChannels = iNum;
-        pcAnim->mChannels = new aiNodeAnim *[iNum];
+        pcAnim->mChannels = AllocateSceneArray<aiNodeAnim *>(iNum);
         pcAnim->mTicksPerSecond = mParser->iFrameSpeed * mParser->iTicksPerFrame;
 
         iNum = 0;
@@ -425,7 +425,7 @@ void ASEImporter::BuildAnimations(const std::vector<BaseNode *> &nodes) {
 void ASEImporter::BuildCameras() {
     if (!mParser->m_vCameras.empty()) {
         pcScene->mNumCameras = (unsigned int)mParser->m_vCameras.size();
-        pcScene->mCameras = new aiCamera *[pcScene->mNumCameras];
+        pcScene->mCameras = AllocateSceneArray<aiCamera *>(pcScene->mNumCameras);
 
         for (unsigned int i = 0; i < pcScene->mNumCameras; ++i) {
             aiCamera *out = pcScene->mCameras[i] = new aiCamera();
@@ -446,7 +446,7 @@ void ASEImporter::BuildCameras() {
 void ASEImporter::BuildLights() {
     if (!mParser->m_vLights.empty()) {
         pcScene->mNumLights = (unsigned int)mParser->m_vLights.size();
-        pcScene->mLights = new aiLight *[pcScene->mNumLights];
+        pcScene->mLights = AllocateSceneArray<aiLight *>(pcScene->mNumLights);
 
         for (unsigned int i = 0; i < pcScene->mNumLights; ++i) {
             aiLight *out = pcScene->mLights[i] = new aiLight();
@@ -500,7 +500,7 @@ void ASEImporter::AddMeshes(const ASE::BaseNode *snode, aiNode *node) {
     }
 
     if (node->mNumMeshes) {
-        node->mMeshes = new unsigned int[node->mNumMeshes];
+        node->mMeshes = AllocateSceneArray<unsigned int>(node->mNumMeshes);
         for (unsigned int i = 0, p = 0; i < pcScene->mNumMeshes; ++i) {
 
             const aiMesh *pcMesh = pcScene->mMeshes[i];
@@ -593,7 +593,7 @@ void ASEImporter::AddNodes(const std::vector<BaseNode *> &nodes,
             // node's animation track but the exact target position
             // would be lost otherwise)
             if (!node->mNumChildren) {
-                node->mChildren = new aiNode *[1];
+                node->mChildren = AllocateSceneArray<aiNode *>(1);
             }
 
             aiNode *nd = new aiNode();
@@ -622,7 +622,7 @@ void ASEImporter::AddNodes(const std::vector<BaseNode *> &nodes,
     // We allocate one slot more  in case this is a target camera/light
     pcParent->mNumChildren = (unsigned int)apcNodes.size();
     if (pcParent->mNumChildren) {
-        pcParent->mChildren = new aiNode *[apcNodes.size() + 1 /* PLUS ONE !!! */];
+        pcParent->mChildren = AllocateSceneArray<aiNode *>(apcNodes.size() + 1 /* PLUS ONE !!! */);
 
         // now build all nodes for our nice new children
         for (unsigned int p = 0; p < apcNodes.size(); ++p)
@@ -642,7 +642,7 @@ void ASEImporter::BuildNodes(std::vector<BaseNode *> &nodes) {
 
     // Setup the coordinate system transformation
     pcScene->mRootNode->mNumChildren = 1;
-    pcScene->mRootNode->mChildren = new aiNode *[1];
+    pcScene->mRootNode->mChildren = AllocateSceneArray<aiNode *>(1);
     aiNode *ch = pcScene->mRootNode->mChildren[0] = new aiNode();
     ch->mParent = root;
 
@@ -691,7 +691,7 @@ void ASEImporter::BuildNodes(std::vector<BaseNode *> &nodes) {
         for (unsigned int i = 0; i < pcScene->mRootNode->mNumChildren; ++i)
             apcNodes.push_back(pcScene->mRootNode->mChildren[i]);
 
-        delete[] pcScene->mRootNode->mChildren;
+        FreeSceneArray(pcScene->mRootNode->mChildren);
         for (std::vector<const BaseNode *>::/*const_*/ iterator i = aiList.begin(); i != aiList.end(); ++i) {
             const ASE::BaseNode *src = *i;
 
@@ -706,7 +706,7 @@ void ASEImporter::BuildNodes(std::vector<BaseNode *> &nodes) {
         }
 
         // Regenerate our output array
-        pcScene->mRootNode->mChildren = new aiNode *[apcNodes.size()];
+        pcScene->mRootNode->mChildren = AllocateSceneArray<aiNode *>(apcNodes.size());
         for (unsigned int i = 0; i < apcNodes.size(); ++i)
             pcScene->mRootNode->mChildren[i] = apcNodes[i];
 
@@ -996,7 +996,7 @@ void ASEImporter::ConvertMeshes(ASE::Mesh &mesh, std::vector<aiMesh *> &avOutMes
 
                         iIndex = aiSplit[p][q];
 
-                        p_pcOut->mFaces[q].mIndices = new unsigned int[3];
+                        p_pcOut->mFaces[q].mIndices = AllocateSceneArray<unsigned int>(3);
                         p_pcOut->mFaces[q].mNumIndices = 3;
 
                         for (unsigned int t = 0; t < 3; ++t, ++iBase) {
@@ -1058,7 +1058,7 @@ void ASEImporter::ConvertMeshes(ASE::Mesh &mesh, std::vector<aiMesh *> &avOutMes
                     for (unsigned int mrspock = 0; mrspock < mesh.mBones.size(); ++mrspock)
                         if (!avOutputBones[mrspock].empty()) p_pcOut->mNumBones++;
 
-                    p_pcOut->mBones = new aiBone *[p_pcOut->mNumBones];
+                    p_pcOut->mBones = AllocateSceneArray<aiBone *>(p_pcOut->mNumBones);
                     aiBone **pcBone = p_pcOut->mBones;
                     for (unsigned int mrspock = 0; mrspock < mesh.mBones.size(); ++mrspock) {
                         if (!avOutputBones[mrspock].empty()) {
@@ -1151,7 +1151,7 @@ void ASEImporter::ConvertMeshes(ASE::Mesh &mesh, std::vector<aiMesh *> &avOutMes
         // copy faces
         for (unsigned int iFace = 0; iFace < p_pcOut->mNumFaces; ++iFace) {
             p_pcOut->mFaces[iFace].mNumIndices = 3;
-            p_pcOut->mFaces[iFace].mIndices = new unsigned int[3];
+            p_pcOut->mFaces[iFace].mIndices = AllocateSceneArray<unsigned int>(3);
 
             // copy indices
             p_pcOut->mFaces[iFace].mIndices[0] = mesh.mFaces[iFace].mIndices[0];
@@ -1183,7 +1183,7 @@ void ASEImporter::ConvertMeshes(ASE::Mesh &mesh, std::vector<aiMesh *> &avOutMes
             for (unsigned int jfkennedy = 0; jfkennedy < mesh.mBones.size(); ++jfkennedy)
                 if (!avBonesOut[jfkennedy].empty()) p_pcOut->mNumBones++;
 
-            p_pcOut->mBones = new aiBone *[p_pcOut->mNumBones];
+            p_pcOut->mBones = AllocateSceneArray<aiBone *>(p_pcOut->mNumBones);
             aiBone **pcBone = p_pcOut->mBones;
             for (unsigned int jfkennedy = 0; jfkennedy < mesh.mBones.size(); ++jfkennedy) {
                 if (!avBonesOut[jfkennedy].empty()) {
@@ -1224,7 +1224,7 @@ void ASEImporter::BuildMaterialIndices() {
     }
 
     // allocate the output material array
-    pcScene->mMaterials = new aiMaterial *[pcScene->mNumMaterials];
+    pcScene->mMaterials = AllocateSceneArray<aiMaterial *>(pcScene->mNumMaterials);
     D3DS::Material **pcIntMaterials = new D3DS::Material *[pcScene->mNumMaterials];
 
     unsigned int iNum = 0;
@@ -47,11 +47,15 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "Common/assbin_chunks.h"
 #include "PostProcessing/ProcessHelper.h"
 
+#include <assimp/DefaultLogger.hpp>
 #include <assimp/Exceptional.h>
 #include <assimp/version.h>
 #include <assimp/Exporter.hpp>
 #include <assimp/IOStream.hpp>
 
+#include <array>
+#include <vector>
+
 #ifdef ASSIMP_BUILD_NO_OWN_ZLIB
 #include <zlib.h>
 #else
@@ -330,6 +334,7 @@ class AssbinFileWriter {
 private:
     bool shortened;
     bool compressed;
+    bool aligned;
 
 protected:
     // -----------------------------------------------------------------------------------
@@ -461,6 +466,20 @@ protected:
         }
         Write<unsigned int>(&chunk, c);
 
+        if (aligned) {
+            // the arrays go to the streams behind the scene chunk
+            for (unsigned int n = 0; n < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++n) {
+                if (!mesh->mTextureCoords[n]) {
+                    break;
+                }
+                Write<unsigned int>(&chunk, mesh->mNumUVComponents[n]);
+            }
+            for (unsigned int a = 0; a < mesh->mNumBones; ++a) {
+                WriteBinaryBone(&chunk, mesh->mBones[a]);
+            }
+            return;
+        }
+
         aiVector3D minVec, maxVec;
         if (mesh->mVertices) {
             if (shortened) {
@@ -724,9 +743,127 @@ protected:
         }
     }
 
+    // -----------------------------------------------------------------------------------
+    // Layout of the streams of a mesh in the aligned format
+    struct MeshStreams {
+        uint32_t numFaceIndices = 0;
+        uint32_t faceSize = 0;
+        std::array<const void *, ASSBIN_STREAM_COUNT> data {};
+        std::array<uint64_t, ASSBIN_STREAM_COUNT> size {};
+        std::array<uint64_t, ASSBIN_STREAM_COUNT> offset {};
+        std::vector<uint32_t> faceSizes;
+        std::vector<uint32_t> faceIndices;
+    };
+
+    // -----------------------------------------------------------------------------------
+    static void SetupMeshStreams(const aiMesh *mesh, MeshStreams &streams) {
+        const uint64_t numVertices = mesh->mNumVertices;
+        auto set = [&streams](unsigned int stream, const void *data, uint64_t size) {
+            streams.data[stream] = data;
+            streams.size[stream] = data ? size : 0;
+        };
+
+        set(ASSBIN_STREAM_POSITIONS, mesh->mVertices, numVertices * sizeof(aiVector3D));
+        set(ASSBIN_STREAM_NORMALS, mesh->mNormals, numVertices * sizeof(aiVector3D));
+        if (mesh->mTangents && mesh->mBitangents) {
+            set(ASSBIN_STREAM_TANGENTS, mesh->mTangents, numVertices * sizeof(aiVector3D));
+            set(ASSBIN_STREAM_BITANGENTS, mesh->mBitangents, numVertices * sizeof(aiVector3D));
+        }
+        for (unsigned int n = 0; n < AI_MAX_NUMBER_OF_COLOR_SETS && n < ASSBIN_STREAM_MAX_COLOR_SETS && mesh->mColors[n]; ++n) {
+            set(ASSBIN_STREAM_COLOR(n), mesh->mColors[n], numVertices * sizeof(aiColor4D));
+        }
+        for (unsigned int n = 0; n < AI_MAX_NUMBER_OF_TEXTURECOORDS && n < ASSBIN_STREAM_MAX_TEXCOORDS && mesh->mTextureCoords[n]; ++n) {
+            set(ASSBIN_STREAM_TEXCOORD(n), mesh->mTextureCoords[n], numVertices * sizeof(aiVector3D));
+        }
+
+        // the faces are flattened to an index stream, face sizes are only
+        // stored if they differ
+        uint64_t numFaceIndices = 0;
+        for (unsigned int i = 0; i < mesh->mNumFaces; ++i) {
+            numFaceIndices += mesh->mFaces[i].mNumIndices;
+        }
+        if (numFaceIndices > 0xffffffff) {
+            throw DeadlyExportError("Too many face indices for the aligned Assbin layout");
+        }
+        streams.numFaceIndices = static_cast<uint32_t>(numFaceIndices);
+        streams.faceSize = mesh->mNumFaces ? mesh->mFaces[0].mNumIndices : 0;
+
+        streams.faceIndices.reserve(streams.numFaceIndices);
+        for (unsigned int i = 0; i < mesh->mNumFaces; ++i) {
+            const aiFace &f = mesh->mFaces[i];
+            if (f.mNumIndices != streams.faceSize) {
+                streams.faceSize = 0;
+            }
+            streams.faceIndices.insert(streams.faceIndices.end(), f.mIndices, f.mIndices + f.mNumIndices);
+        }
+        if (mesh->mNumFaces && !streams.faceSize) {
+            streams.faceSizes.resize(mesh->mNumFaces);
+            for (unsigned int i = 0; i < mesh->mNumFaces; ++i) {
+                streams.faceSizes[i] = mesh->mFaces[i].mNumIndices;
+            }
+            set(ASSBIN_STREAM_FACE_SIZES, streams.faceSizes.data(), streams.faceSizes.size() * sizeof(uint32_t));
+        }
+        if (!streams.faceIndices.empty()) {
+            set(ASSBIN_STREAM_FACE_INDICES, streams.faceIndices.data(), streams.faceIndices.size() * sizeof(uint32_t));
+        }
+    }
+
+    // -----------------------------------------------------------------------------------
+    // Write the table of contents, the scene chunk and the streams of the aligned layout
+    void WriteAlignedBody(IOStream *out, const aiScene *pScene) {
+        // the scene chunk goes first, its size determines where the streams start
+        AssbinChunkWriter sceneStream(nullptr, 0);
+        WriteBinaryScene(&sceneStream, pScene);
+
+        const uint64_t tocSize = 16 + static_cast<uint64_t>(pScene->mNumMeshes) * (16 + 8 * ASSBIN_STREAM_COUNT);
+        const uint64_t sceneOffset = ASSBIN_HEADER_LENGTH + tocSize;
+        uint64_t cursor = sceneOffset + sceneStream.Tell();
+
+        std::vector<MeshStreams> meshStreams(pScene->mNumMeshes);
+        for (unsigned int i = 0; i < pScene->mNumMeshes; ++i) {
+            MeshStreams &streams = meshStreams[i];
+            SetupMeshStreams(pScene->mMeshes[i], streams);
+            for (unsigned int s = 0; s < ASSBIN_STREAM_COUNT; ++s) {
+                if (streams.size[s]) {
+                    cursor = (cursor + ASSBIN_STREAM_ALIGNMENT - 1) & ~static_cast<uint64_t>(ASSBIN_STREAM_ALIGNMENT - 1);
+                    streams.offset[s] = cursor;
+                    cursor += streams.size[s];
+                }
+            }
+        }
+
+        Write<unsigned int>(out, ASSBIN_CHUNK_AITOC);
+        Write<unsigned int>(out, pScene->mNumMeshes);
+        Write<uint64_t>(out, sceneOffset);
+        for (unsigned int i = 0; i < pScene->mNumMeshes; ++i) {
+            const MeshStreams &streams = meshStreams[i];
+            Write<unsigned int>(out, pScene->mMeshes[i]->mNumVertices);
+            Write<unsigned int>(out, pScene->mMeshes[i]->mNumFaces);
+            Write<unsigned int>(out, streams.numFaceIndices);
+            Write<unsigned int>(out, streams.faceSize);
+            out->Write(streams.offset.data(), sizeof(uint64_t), ASSBIN_STREAM_COUNT);
+        }
+
+        out->Write(sceneStream.GetBufferPointer(), 1, sceneStream.Tell());
+
+        static const char padding[ASSBIN_STREAM_ALIGNMENT] = {};
+        uint64_t written = sceneOffset + sceneStream.Tell();
+        for (const MeshStreams &streams : meshStreams) {
+            for (unsigned int s = 0; s < ASSBIN_STREAM_COUNT; ++s) {
+                if (!streams.size[s]) {
+                    continue;
+                }
+                ai_assert(streams.offset[s] >= written && streams.offset[s] - written < ASSBIN_STREAM_ALIGNMENT);
+                out->Write(padding, 1, static_cast<size_t>(streams.offset[s] - written));
+                out->Write(streams.data[s], 1, static_cast<size_t>(streams.size[s]));
+                written = streams.offset[s] + streams.size[s];
+            }
+        }
+    }
+
 public:
-    AssbinFileWriter(bool shortened, bool compressed) :
-            shortened(shortened), compressed(compressed) {
+    AssbinFileWriter(bool shortened, bool compressed, bool aligned = false) :
+            shortened(shortened), compressed(compressed), aligned(aligned) {
     }
 
     // -----------------------------------------------------------------------------------
@@ -763,7 +900,7 @@ public:
             out->Write(s, 44, 1);
             // == 44 bytes
 
-            Write<unsigned int>(out, ASSBIN_VERSION_MAJOR);
+            Write<unsigned int>(out, aligned ? ASSBIN_VERSION_MAJOR_ALIGNED : ASSBIN_VERSION_MAJOR);
             Write<unsigned int>(out, ASSBIN_VERSION_MINOR);
             Write<unsigned int>(out, aiGetVersionRevision());
             Write<unsigned int>(out, aiGetCompileFlags());
@@ -789,7 +926,9 @@ public:
 
             // Up to here the data is uncompressed. For compressed files, the rest
             // is compressed using standard DEFLATE from zlib.
-            if (compressed) {
+            if (aligned) {
+                WriteAlignedBody(out, pScene);
+            } else if (compressed) {
                 AssbinChunkWriter uncompressedStream(nullptr, 0);
                 WriteBinaryScene(&uncompressedStream, pScene);
 
@@ -821,8 +960,14 @@ public:
 
 void DumpSceneToAssbin(
         const char *pFile, const char *cmd, IOSystem *pIOSystem,
-        const aiScene *pScene, bool shortened, bool compressed) {
-    AssbinFileWriter fileWriter(shortened, compressed);
+        const aiScene *pScene, bool shortened, bool compressed, unsigned int version) {
+    bool aligned = ASSBIN_VERSION_MAJOR_ALIGNED == version;
+    if (aligned && (shortened || compressed || sizeof(ai_real) != sizeof(float))) {
+        ASSIMP_LOG_WARN("Assbin: shortened, compressed and double precision dumps use the version 1 layout");
+        aligned = false;
+    }
+
+    AssbinFileWriter fileWriter(shortened, compressed, aligned);
     fileWriter.WriteBinaryDump(pFile, cmd, pIOSystem, pScene);
 }
 #if _MSC_VER
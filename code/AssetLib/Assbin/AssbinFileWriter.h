@@ -52,13 +52,18 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 namespace Assimp {
 
+/** Write a scene to an Assbin file.
+ *  @param version 1 for the chunk stream layout, 2 for the aligned layout
+ *    with a table of contents. Shortened and compressed dumps always use
+ *    version 1. */
 void ASSIMP_API DumpSceneToAssbin(
         const char *pFile,
         const char *cmd,
         IOSystem *pIOSystem,
         const aiScene *pScene,
         bool shortened,
-        bool compressed);
+        bool compressed,
+        unsigned int version = 1);
 
 }
 
@@ -55,7 +55,10 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/importerdesc.h>
 #include <assimp/mesh.h>
 #include <assimp/scene.h>
+#include <limits>
 #include <memory>
+#include <type_traits>
+#include <vector>
 
 #ifdef ASSIMP_BUILD_NO_OWN_ZLIB
 #include <zlib.h>
@@ -65,6 +68,21 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 using namespace Assimp;
 
+// -----------------------------------------------------------------------------------
+// Size of a stream of the aligned layout as given by the counts of its mesh
+static uint64_t GetStreamSize(uint32_t numVertices, uint32_t numFaces, uint32_t numFaceIndices, unsigned int stream) {
+    if (stream >= ASSBIN_STREAM_COLOR_BASE && stream < ASSBIN_STREAM_TEXCOORD_BASE) {
+        return static_cast<uint64_t>(numVertices) * sizeof(aiColor4D);
+    }
+    if (ASSBIN_STREAM_FACE_SIZES == stream) {
+        return static_cast<uint64_t>(numFaces) * sizeof(uint32_t);
+    }
+    if (ASSBIN_STREAM_FACE_INDICES == stream) {
+        return static_cast<uint64_t>(numFaceIndices) * sizeof(uint32_t);
+    }
+    return static_cast<uint64_t>(numVertices) * sizeof(aiVector3D);
+}
+
 static const aiImporterDesc desc = {
     "Assimp Binary Importer",
     "Gargaj / Conspiracy",
@@ -78,6 +96,17 @@ static const aiImporterDesc desc = {
     "assbin"
 };
 
+// -----------------------------------------------------------------------------------
+AssbinImporter::AssbinImporter() :
+        shortened(false),
+        compressed(false),
+        aligned(false),
+        mDeferredMeshOffsets(),
+        mMeshStreams(),
+        mDataStream(nullptr) {
+    // empty
+}
+
 // -----------------------------------------------------------------------------------
 const aiImporterDesc *AssbinImporter::GetInfo() const {
     return &desc;
@@ -194,16 +223,51 @@ aiQuatKey Read<aiQuatKey>(IOStream *stream) {
 }
 
 // -----------------------------------------------------------------------------------
+// Types which are stored exactly as they are laid out in memory. Arrays of them are
+// read with a single call instead of one call per component.
 template <typename T>
-void ReadArray(IOStream *stream, T *out, unsigned int size) {
-    ai_assert(nullptr != stream);
-    ai_assert(nullptr != out);
+struct IsPacked : std::false_type {};
+
+template <>
+struct IsPacked<unsigned int> : std::integral_constant<bool, sizeof(unsigned int) == 4> {};
+
+template <>
+struct IsPacked<aiVector3D> : std::integral_constant<bool, sizeof(ai_real) == 4 && sizeof(aiVector3D) == 12> {};
+
+template <>
+struct IsPacked<aiColor4D> : std::integral_constant<bool, sizeof(ai_real) == 4 && sizeof(aiColor4D) == 16> {};
+
+template <>
+struct IsPacked<aiVertexWeight> : std::integral_constant<bool, sizeof(ai_real) == 4 && sizeof(unsigned int) == 4 && sizeof(aiVertexWeight) == 8> {};
+
+template <>
+struct IsPacked<aiQuatKey> : std::integral_constant<bool, sizeof(ai_real) == 4 && sizeof(aiQuatKey) == 24> {};
 
+// -----------------------------------------------------------------------------------
+template <typename T>
+void ReadArray(IOStream *stream, T *out, unsigned int size, std::true_type /*packed*/) {
+    if (size && stream->Read(out, sizeof(T), size) != size) {
+        throw DeadlyImportError("Unexpected EOF");
+    }
+}
+
+// -----------------------------------------------------------------------------------
+template <typename T>
+void ReadArray(IOStream *stream, T *out, unsigned int size, std::false_type /*packed*/) {
     for (unsigned int i = 0; i < size; i++) {
         out[i] = Read<T>(stream);
     }
 }
 
+// -----------------------------------------------------------------------------------
+template <typename T>
+void ReadArray(IOStream *stream, T *out, unsigned int size) {
+    ai_assert(nullptr != stream);
+    ai_assert(nullptr != out);
+
+    ReadArray(stream, out, size, IsPacked<T>());
+}
+
 // -----------------------------------------------------------------------------------
 template <typename T>
 void ReadBounds(IOStream *stream, T * /*p*/, unsigned int n) {
@@ -230,15 +294,13 @@ void AssbinImporter::ReadBinaryNode(IOStream *stream, aiNode **onode, aiNode *pa
     }
 
     if (numMeshes) {
-        node->mMeshes = new unsigned int[numMeshes];
-        for (unsigned int i = 0; i < numMeshes; ++i) {
-            node->mMeshes[i] = Read<unsigned int>(stream);
-            node->mNumMeshes++;
-        }
+        node->mMeshes = AllocateSceneArray<unsigned int>(numMeshes);
+        ReadArray<unsigned int>(stream, node->mMeshes, numMeshes);
+        node->mNumMeshes = numMeshes;
     }
 
     if (numChildren) {
-        node->mChildren = new aiNode *[numChildren];
+        node->mChildren = AllocateSceneArray<aiNode *>(numChildren);
         for (unsigned int i = 0; i < numChildren; ++i) {
             ReadBinaryNode(stream, &node->mChildren[i], node.get());
             node->mNumChildren++;
@@ -254,25 +316,25 @@ void AssbinImporter::ReadBinaryNode(IOStream *stream, aiNode **onode, aiNode *pa
 
             switch (node->mMetaData->mValues[i].mType) {
             case AI_BOOL:
-                data = new bool(Read<bool>(stream));
+                data = AllocateSceneObject<bool>(Read<bool>(stream));
                 break;
             case AI_INT32:
-                data = new int32_t(Read<int32_t>(stream));
+                data = AllocateSceneObject<int32_t>(Read<int32_t>(stream));
                 break;
             case AI_UINT64:
-                data = new uint64_t(Read<uint64_t>(stream));
+                data = AllocateSceneObject<uint64_t>(Read<uint64_t>(stream));
                 break;
             case AI_FLOAT:
-                data = new ai_real(Read<ai_real>(stream));
+                data = AllocateSceneObject<ai_real>(Read<ai_real>(stream));
                 break;
             case AI_DOUBLE:
-                data = new double(Read<double>(stream));
+                data = AllocateSceneObject<double>(Read<double>(stream));
                 break;
             case AI_AISTRING:
-                data = new aiString(Read<aiString>(stream));
+                data = AllocateSceneObject<aiString>(Read<aiString>(stream));
                 break;
             case AI_AIVECTOR3D:
-                data = new aiVector3D(Read<aiVector3D>(stream));
+                data = AllocateSceneObject<aiVector3D>(Read<aiVector3D>(stream));
                 break;
 #ifndef SWIG
             case FORCE_32BIT:
@@ -314,10 +376,12 @@ static bool fitsIntoUI16(unsigned int mNumVertices) {
 }
 
 // -----------------------------------------------------------------------------------
-void AssbinImporter::ReadBinaryMesh(IOStream *stream, aiMesh *mesh) {
+void AssbinImporter::ReadBinaryMesh(IOStream *stream, aiMesh *mesh, unsigned int index) {
+    const size_t offset = stream->Tell();
     if (Read<uint32_t>(stream) != ASSBIN_CHUNK_AIMESH)
         throw DeadlyImportError("Magic chunk identifiers are wrong!");
-    /*uint32_t size =*/Read<uint32_t>(stream);
+    uint32_t size = Read<uint32_t>(stream);
+    const size_t end = stream->Tell() + size;
 
     mesh->mPrimitiveTypes = Read<unsigned int>(stream);
     mesh->mNumVertices = Read<unsigned int>(stream);
@@ -325,9 +389,38 @@ void AssbinImporter::ReadBinaryMesh(IOStream *stream, aiMesh *mesh) {
     mesh->mNumBones = Read<unsigned int>(stream);
     mesh->mMaterialIndex = Read<unsigned int>(stream);
 
+    if (m_deferMeshData && !compressed) {
+        // keep the header only, the chunk is read again by InternReadMeshData()
+        mesh->mNumBones = 0;
+        mDeferredMeshOffsets.push_back(offset);
+        stream->Seek(end, aiOrigin_SET);
+        return;
+    }
+
     // first of all, write bits for all existent vertex components
     unsigned int c = Read<unsigned int>(stream);
 
+    if (aligned) {
+        for (unsigned int n = 0; n < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++n) {
+            if (!(c & ASSBIN_MESH_HAS_TEXCOORD(n))) {
+                break;
+            }
+            mesh->mNumUVComponents[n] = Read<unsigned int>(stream);
+        }
+
+        // vertices and faces come from the streams behind the scene chunk
+        ReadMeshStreams(mesh, c, index);
+
+        if (mesh->mNumBones) {
+            mesh->mBones = AllocateSceneArray<aiBone *>(mesh->mNumBones);
+            for (unsigned int a = 0; a < mesh->mNumBones; ++a) {
+                mesh->mBones[a] = new aiBone();
+                ReadBinaryBone(stream, mesh->mBones[a]);
+            }
+        }
+        return;
+    }
+
     if (c & ASSBIN_MESH_HAS_POSITIONS) {
         if (shortened) {
             ReadBounds(stream, mesh->mVertices, mesh->mNumVertices);
@@ -395,30 +488,12 @@ void AssbinImporter::ReadBinaryMesh(IOStream *stream, aiMesh *mesh) {
     if (shortened) {
         Read<unsigned int>(stream);
     } else {
-        // else write as usual
-        // if there are less than 2^16 vertices, we can simply use 16 bit integers ...
-        mesh->mFaces = new aiFace[mesh->mNumFaces];
-        for (unsigned int i = 0; i < mesh->mNumFaces; ++i) {
-            aiFace &f = mesh->mFaces[i];
-
-            static_assert(AI_MAX_FACE_INDICES <= 0xffff, "AI_MAX_FACE_INDICES <= 0xffff");
-            f.mNumIndices = Read<uint16_t>(stream);
-            f.mIndices = new unsigned int[f.mNumIndices];
-
-            for (unsigned int a = 0; a < f.mNumIndices; ++a) {
-                // Check if unsigned  short ( 16 bit  ) are big enought for the indices
-                if (fitsIntoUI16(mesh->mNumVertices)) {
-                    f.mIndices[a] = Read<uint16_t>(stream);
-                } else {
-                    f.mIndices[a] = Read<unsigned int>(stream);
-                }
-            }
-        }
+        ReadBinaryFaces(stream, mesh, end);
     }
 
     // write bones
     if (mesh->mNumBones) {
-        mesh->mBones = new C_STRUCT aiBone *[mesh->mNumBones];
+        mesh->mBones = AllocateSceneArray<aiBone *>(mesh->mNumBones);
         for (unsigned int a = 0; a < mesh->mNumBones; ++a) {
             mesh->mBones[a] = new aiBone();
             ReadBinaryBone(stream, mesh->mBones[a]);
@@ -426,6 +501,247 @@ void AssbinImporter::ReadBinaryMesh(IOStream *stream, aiMesh *mesh) {
     }
 }
 
+// -----------------------------------------------------------------------------------
+void AssbinImporter::ReadTableOfContents(IOStream *stream) {
+    if (Read<uint32_t>(stream) != ASSBIN_CHUNK_AITOC)
+        throw DeadlyImportError("Magic chunk identifiers are wrong!");
+
+    const uint32_t numMeshes = Read<uint32_t>(stream);
+    const uint64_t sceneOffset = Read<uint64_t>(stream);
+    if (static_cast<uint64_t>(numMeshes) * sizeof(MeshStreams) > stream->FileSize()) {
+        throw DeadlyImportError("Unexpected EOF");
+    }
+
+    mMeshStreams.resize(numMeshes);
+    for (MeshStreams &streams : mMeshStreams) {
+        streams.mNumVertices = Read<uint32_t>(stream);
+        streams.mNumFaces = Read<uint32_t>(stream);
+        streams.mNumFaceIndices = Read<uint32_t>(stream);
+        streams.mFaceSize = Read<uint32_t>(stream);
+        if (stream->Read(streams.mOffsets, sizeof(uint64_t), ASSBIN_STREAM_COUNT) != ASSBIN_STREAM_COUNT) {
+            throw DeadlyImportError("Unexpected EOF");
+        }
+
+        // the streams are checked against the file before any array is allocated for them
+        for (unsigned int s = 0; s < ASSBIN_STREAM_COUNT; ++s) {
+            const uint64_t offset = streams.mOffsets[s];
+            const uint64_t size = GetStreamSize(streams.mNumVertices, streams.mNumFaces, streams.mNumFaceIndices, s);
+            if (0 != offset && (offset > stream->FileSize() || size > stream->FileSize() - offset)) {
+                throw DeadlyImportError("Invalid offset of a mesh stream");
+            }
+        }
+    }
+
+    if (sceneOffset >= stream->FileSize() || stream->Seek(static_cast<size_t>(sceneOffset), aiOrigin_SET) != aiReturn_SUCCESS) {
+        throw DeadlyImportError("Invalid offset of the scene chunk");
+    }
+}
+
+// -----------------------------------------------------------------------------------
+// Copies a stream of the aligned layout with a single read, or straight from the
+// view of the file if there is one.
+void AssbinImporter::ReadStream(uint64_t offset, void *data, uint64_t size) {
+    ai_assert(nullptr != mDataStream);
+    const uint64_t fileSize = mDataStream->FileSize();
+    if (0 == offset || offset > fileSize || size > fileSize - offset) {
+        throw DeadlyImportError("Invalid offset of a mesh stream");
+    }
+
+    const uint8_t *view = mDataStream->GetContiguousView();
+    if (nullptr != view) {
+        memcpy(data, view + offset, static_cast<size_t>(size));
+        return;
+    }
+
+    const size_t pos = mDataStream->Tell();
+    if (mDataStream->Seek(static_cast<size_t>(offset), aiOrigin_SET) != aiReturn_SUCCESS ||
+            mDataStream->Read(data, 1, static_cast<size_t>(size)) != size) {
+        throw DeadlyImportError("Unexpected EOF");
+    }
+    mDataStream->Seek(pos, aiOrigin_SET);
+}
+
+// -----------------------------------------------------------------------------------
+void AssbinImporter::ReadMeshStreams(aiMesh *mesh, unsigned int c, unsigned int index) {
+    if (index >= mMeshStreams.size()) {
+        throw DeadlyImportError("Mesh ", index, " is missing in the table of contents");
+    }
+    const MeshStreams &streams = mMeshStreams[index];
+    if (streams.mNumVertices != mesh->mNumVertices || streams.mNumFaces != mesh->mNumFaces) {
+        throw DeadlyImportError("Table of contents doesn't match mesh ", index);
+    }
+
+    // the table of contents has checked the streams which are present, all streams
+    // of the mesh must be there before its arrays are allocated
+    std::vector<unsigned int> required;
+    if (c & ASSBIN_MESH_HAS_POSITIONS) {
+        required.push_back(ASSBIN_STREAM_POSITIONS);
+    }
+    if (c & ASSBIN_MESH_HAS_NORMALS) {
+        required.push_back(ASSBIN_STREAM_NORMALS);
+    }
+    if (c & ASSBIN_MESH_HAS_TANGENTS_AND_BITANGENTS) {
+        required.push_back(ASSBIN_STREAM_TANGENTS);
+        required.push_back(ASSBIN_STREAM_BITANGENTS);
+    }
+    for (unsigned int n = 0; n < AI_MAX_NUMBER_OF_COLOR_SETS && n < ASSBIN_STREAM_MAX_COLOR_SETS && (c & ASSBIN_MESH_HAS_COLOR(n)); ++n) {
+        required.push_back(ASSBIN_STREAM_COLOR(n));
+    }
+    for (unsigned int n = 0; n < AI_MAX_NUMBER_OF_TEXTURECOORDS && n < ASSBIN_STREAM_MAX_TEXCOORDS && (c & ASSBIN_MESH_HAS_TEXCOORD(n)); ++n) {
+        required.push_back(ASSBIN_STREAM_TEXCOORD(n));
+    }
+    if (streams.mFaceSize && static_cast<uint64_t>(streams.mFaceSize) * mesh->mNumFaces != streams.mNumFaceIndices) {
+        throw DeadlyImportError("Invalid number of face indices in mesh ", index);
+    }
+    if (mesh->mNumFaces && !streams.mFaceSize) {
+        required.push_back(ASSBIN_STREAM_FACE_SIZES);
+    }
+    if (mesh->mNumFaces && streams.mNumFaceIndices) {
+        required.push_back(ASSBIN_STREAM_FACE_INDICES);
+    }
+    for (unsigned int s : required) {
+        if (0 == streams.mOffsets[s]) {
+            throw DeadlyImportError("Stream ", s, " of mesh ", index, " is missing");
+        }
+    }
+
+    const uint64_t vectorSize = static_cast<uint64_t>(mesh->mNumVertices) * sizeof(aiVector3D);
+    if (c & ASSBIN_MESH_HAS_POSITIONS) {
+        mesh->mVertices = new aiVector3D[mesh->mNumVertices];
+        ReadStream(streams.mOffsets[ASSBIN_STREAM_POSITIONS], mesh->mVertices, vectorSize);
+    }
+    if (c & ASSBIN_MESH_HAS_NORMALS) {
+        mesh->mNormals = new aiVector3D[mesh->mNumVertices];
+        ReadStream(streams.mOffsets[ASSBIN_STREAM_NORMALS], mesh->mNormals, vectorSize);
+    }
+    if (c & ASSBIN_MESH_HAS_TANGENTS_AND_BITANGENTS) {
+        mesh->mTangents = new aiVector3D[mesh->mNumVertices];
+        ReadStream(streams.mOffsets[ASSBIN_STREAM_TANGENTS], mesh->mTangents, vectorSize);
+        mesh->mBitangents = new aiVector3D[mesh->mNumVertices];
+        ReadStream(streams.mOffsets[ASSBIN_STREAM_BITANGENTS], mesh->mBitangents, vectorSize);
+    }
+    for (unsigned int n = 0; n < AI_MAX_NUMBER_OF_COLOR_SETS && n < ASSBIN_STREAM_MAX_COLOR_SETS; ++n) {
+        if (!(c & ASSBIN_MESH_HAS_COLOR(n))) {
+            break;
+        }
+        mesh->mColors[n] = new aiColor4D[mesh->mNumVertices];
+        ReadStream(streams.mOffsets[ASSBIN_STREAM_COLOR(n)], mesh->mColors[n],
+                static_cast<uint64_t>(mesh->mNumVertices) * sizeof(aiColor4D));
+    }
+    for (unsigned int n = 0; n < AI_MAX_NUMBER_OF_TEXTURECOORDS && n < ASSBIN_STREAM_MAX_TEXCOORDS; ++n) {
+        if (!(c & ASSBIN_MESH_HAS_TEXCOORD(n))) {
+            break;
+        }
+        mesh->mTextureCoords[n] = new aiVector3D[mesh->mNumVertices];
+        ReadStream(streams.mOffsets[ASSBIN_STREAM_TEXCOORD(n)], mesh->mTextureCoords[n], vectorSize);
+    }
+
+    if (0 == mesh->mNumFaces) {
+        return;
+    }
+
+    if (streams.mFaceSize) {
+        unsigned int *indices = mesh->AllocateUniformFaces(mesh->mNumFaces, streams.mFaceSize);
+        ReadStream(streams.mOffsets[ASSBIN_STREAM_FACE_INDICES], indices,
+                static_cast<uint64_t>(streams.mNumFaceIndices) * sizeof(uint32_t));
+        return;
+    }
+
+    std::vector<uint32_t> sizes(mesh->mNumFaces);
+    ReadStream(streams.mOffsets[ASSBIN_STREAM_FACE_SIZES], sizes.data(), sizes.size() * sizeof(uint32_t));
+    uint64_t numIndices = 0;
+    for (uint32_t size : sizes) {
+        numIndices += size;
+    }
+    if (numIndices != streams.mNumFaceIndices) {
+        throw DeadlyImportError("Invalid number of face indices in mesh ", index);
+    }
+
+    unsigned int *indices = mesh->AllocateFaces(mesh->mNumFaces, streams.mNumFaceIndices);
+    if (streams.mNumFaceIndices) {
+        ReadStream(streams.mOffsets[ASSBIN_STREAM_FACE_INDICES], indices,
+                static_cast<uint64_t>(streams.mNumFaceIndices) * sizeof(uint32_t));
+    }
+    for (unsigned int i = 0; i < mesh->mNumFaces; ++i) {
+        mesh->mFaces[i].mNumIndices = sizes[i];
+        mesh->mFaces[i].mIndices = indices;
+        indices += sizes[i];
+    }
+}
+
+// -----------------------------------------------------------------------------------
+// The faces are parsed from memory: from the view of the stream if it has one, from a
+// single read of the rest of the mesh chunk otherwise. All indices go to one block.
+void AssbinImporter::ReadBinaryFaces(IOStream *stream, aiMesh *mesh, size_t end) {
+    const size_t start = stream->Tell();
+    if (end < start) {
+        throw DeadlyImportError("Unexpected EOF");
+    }
+    const size_t available = end - start;
+
+    const uint8_t *data = stream->GetContiguousView();
+    std::vector<uint8_t> buffer;
+    if (nullptr != data && end <= stream->FileSize()) {
+        data += start;
+    } else {
+        buffer.resize(available);
+        if (available && stream->Read(&buffer[0], 1, available) != available) {
+            throw DeadlyImportError("Unexpected EOF");
+        }
+        data = buffer.data();
+    }
+
+    // if there are less than 2^16 vertices, the indices are stored as 16 bit integers
+    static_assert(AI_MAX_FACE_INDICES <= 0xffff, "AI_MAX_FACE_INDICES <= 0xffff");
+    const size_t indexSize = fitsIntoUI16(mesh->mNumVertices) ? sizeof(uint16_t) : sizeof(uint32_t);
+
+    // first pass, validate the sizes and count the indices
+    size_t pos = 0;
+    uint64_t numIndices = 0;
+    for (unsigned int i = 0; i < mesh->mNumFaces; ++i) {
+        uint16_t n;
+        if (available - pos < sizeof(n)) {
+            throw DeadlyImportError("Unexpected EOF");
+        }
+        ::memcpy(&n, data + pos, sizeof(n));
+        pos += sizeof(n);
+        if ((available - pos) / indexSize < n) {
+            throw DeadlyImportError("Unexpected EOF");
+        }
+        pos += n * indexSize;
+        numIndices += n;
+    }
+    if (numIndices > std::numeric_limits<unsigned int>::max()) {
+        throw DeadlyImportError("Too many face indices");
+    }
+
+    // second pass, copy the indices
+    unsigned int *indices = mesh->AllocateFaces(mesh->mNumFaces, static_cast<unsigned int>(numIndices));
+    pos = 0;
+    for (unsigned int i = 0; i < mesh->mNumFaces; ++i) {
+        uint16_t n;
+        ::memcpy(&n, data + pos, sizeof(n));
+        pos += sizeof(n);
+
+        aiFace &f = mesh->mFaces[i];
+        f.mNumIndices = n;
+        f.mIndices = n ? indices : nullptr;
+        if (sizeof(uint16_t) == indexSize) {
+            for (unsigned int a = 0; a < n; ++a) {
+                uint16_t index;
+                ::memcpy(&index, data + pos + a * sizeof(index), sizeof(index));
+                indices[a] = index;
+            }
+        } else {
+            ::memcpy(indices, data + pos, n * sizeof(uint32_t));
+        }
+        indices += n;
+        pos += n * indexSize;
+    }
+
+    stream->Seek(start + pos, aiOrigin_SET);
+}
+
 // -----------------------------------------------------------------------------------
 void AssbinImporter::ReadBinaryMaterialProperty(IOStream *stream, aiMaterialProperty *prop) {
     if (Read<uint32_t>(stream) != ASSBIN_CHUNK_AIMATERIALPROPERTY)
@@ -438,7 +754,7 @@ void AssbinImporter::ReadBinaryMaterialProperty(IOStream *stream, aiMaterialProp
 
     prop->mDataLength = Read<unsigned int>(stream);
     prop->mType = (aiPropertyTypeInfo)Read<unsigned int>(stream);
-    prop->mData = new char[prop->mDataLength];
+    prop->mData = AllocateSceneArray<char>(prop->mDataLength);
     stream->Read(prop->mData, 1, prop->mDataLength);
 }
 
@@ -451,9 +767,9 @@ void AssbinImporter::ReadBinaryMaterial(IOStream *stream, aiMaterial *mat) {
     mat->mNumAllocated = mat->mNumProperties = Read<unsigned int>(stream);
     if (mat->mNumProperties) {
         if (mat->mProperties) {
-            delete[] mat->mProperties;
+            FreeSceneArray(mat->mProperties);
         }
-        mat->mProperties = new aiMaterialProperty *[mat->mNumProperties];
+        mat->mProperties = AllocateSceneArray<aiMaterialProperty *>(mat->mNumProperties);
         for (unsigned int i = 0; i < mat->mNumProperties; ++i) {
             mat->mProperties[i] = new aiMaterialProperty();
             ReadBinaryMaterialProperty(stream, mat->mProperties[i]);
@@ -518,7 +834,7 @@ void AssbinImporter::ReadBinaryAnim(IOStream *stream, aiAnimation *anim) {
     anim->mNumChannels = Read<unsigned int>(stream);
 
     if (anim->mNumChannels) {
-        anim->mChannels = new aiNodeAnim *[anim->mNumChannels];
+        anim->mChannels = AllocateSceneArray<aiNodeAnim *>(anim->mNumChannels);
         for (unsigned int a = 0; a < anim->mNumChannels; ++a) {
             anim->mChannels[a] = new aiNodeAnim();
             ReadBinaryNodeAnim(stream, anim->mChannels[a]);
@@ -538,10 +854,10 @@ void AssbinImporter::ReadBinaryTexture(IOStream *stream, aiTexture *tex) {
 
     if (!shortened) {
         if (!tex->mHeight) {
-            tex->pcData = new aiTexel[tex->mWidth];
+            tex->pcData = AllocateSceneArray<aiTexel>(tex->mWidth);
             stream->Read(tex->pcData, 1, tex->mWidth);
         } else {
-            tex->pcData = new aiTexel[tex->mWidth * tex->mHeight];
+            tex->pcData = AllocateSceneArray<aiTexel>(tex->mWidth * tex->mHeight);
             stream->Read(tex->pcData, 1, tex->mWidth * tex->mHeight * 4);
         }
     }
@@ -608,17 +924,17 @@ void AssbinImporter::ReadBinaryScene(IOStream *stream, aiScene *scene) {
 
     // Read all meshes
     if (scene->mNumMeshes) {
-        scene->mMeshes = new aiMesh *[scene->mNumMeshes];
+        scene->mMeshes = AllocateSceneArray<aiMesh *>(scene->mNumMeshes);
         memset(scene->mMeshes, 0, scene->mNumMeshes * sizeof(aiMesh *));
         for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
             scene->mMeshes[i] = new aiMesh();
-            ReadBinaryMesh(stream, scene->mMeshes[i]);
+            ReadBinaryMesh(stream, scene->mMeshes[i], i);
         }
     }
 
     // Read materials
     if (scene->mNumMaterials) {
-        scene->mMaterials = new aiMaterial *[scene->mNumMaterials];
+        scene->mMaterials = AllocateSceneArray<aiMaterial *>(scene->mNumMaterials);
         memset(scene->mMaterials, 0, scene->mNumMaterials * sizeof(aiMaterial *));
         for (unsigned int i = 0; i < scene->mNumMaterials; ++i) {
             scene->mMaterials[i] = new aiMaterial();
@@ -628,7 +944,7 @@ void AssbinImporter::ReadBinaryScene(IOStream *stream, aiScene *scene) {
 
     // Read all animations
     if (scene->mNumAnimations) {
-        scene->mAnimations = new aiAnimation *[scene->mNumAnimations];
+        scene->mAnimations = AllocateSceneArray<aiAnimation *>(scene->mNumAnimations);
         memset(scene->mAnimations, 0, scene->mNumAnimations * sizeof(aiAnimation *));
         for (unsigned int i = 0; i < scene->mNumAnimations; ++i) {
             scene->mAnimations[i] = new aiAnimation();
@@ -638,7 +954,7 @@ void AssbinImporter::ReadBinaryScene(IOStream *stream, aiScene *scene) {
 
     // Read all textures
     if (scene->mNumTextures) {
-        scene->mTextures = new aiTexture *[scene->mNumTextures];
+        scene->mTextures = AllocateSceneArray<aiTexture *>(scene->mNumTextures);
         memset(scene->mTextures, 0, scene->mNumTextures * sizeof(aiTexture *));
         for (unsigned int i = 0; i < scene->mNumTextures; ++i) {
             scene->mTextures[i] = new aiTexture();
@@ -648,7 +964,7 @@ void AssbinImporter::ReadBinaryScene(IOStream *stream, aiScene *scene) {
 
     // Read lights
     if (scene->mNumLights) {
-        scene->mLights = new aiLight *[scene->mNumLights];
+        scene->mLights = AllocateSceneArray<aiLight *>(scene->mNumLights);
         memset(scene->mLights, 0, scene->mNumLights * sizeof(aiLight *));
         for (unsigned int i = 0; i < scene->mNumLights; ++i) {
             scene->mLights[i] = new aiLight();
@@ -658,7 +974,7 @@ void AssbinImporter::ReadBinaryScene(IOStream *stream, aiScene *scene) {
 
     // Read cameras
     if (scene->mNumCameras) {
-        scene->mCameras = new aiCamera *[scene->mNumCameras];
+        scene->mCameras = AllocateSceneArray<aiCamera *>(scene->mNumCameras);
         memset(scene->mCameras, 0, scene->mNumCameras * sizeof(aiCamera *));
         for (unsigned int i = 0; i < scene->mNumCameras; ++i) {
             scene->mCameras[i] = new aiCamera();
@@ -679,7 +995,8 @@ void AssbinImporter::InternReadFile(const std::string &pFile, aiScene *pScene, I
 
     unsigned int versionMajor = Read<unsigned int>(stream);
     unsigned int versionMinor = Read<unsigned int>(stream);
-    if (versionMinor != ASSBIN_VERSION_MINOR || versionMajor != ASSBIN_VERSION_MAJOR) {
+    if (versionMinor != ASSBIN_VERSION_MINOR ||
+            (versionMajor != ASSBIN_VERSION_MAJOR && versionMajor != ASSBIN_VERSION_MAJOR_ALIGNED)) {
         throw DeadlyImportError("Invalid version, data format not compatible!");
     }
 
@@ -688,43 +1005,132 @@ void AssbinImporter::InternReadFile(const std::string &pFile, aiScene *pScene, I
 
     shortened = Read<uint16_t>(stream) > 0;
     compressed = Read<uint16_t>(stream) > 0;
+    aligned = ASSBIN_VERSION_MAJOR_ALIGNED == versionMajor;
+    mDeferredMeshOffsets.clear();
+    mMeshStreams.clear();
 
     if (shortened)
         throw DeadlyImportError("Shortened binaries are not supported!");
+    if (aligned && compressed)
+        throw DeadlyImportError("Aligned binaries can't be compressed!");
+    if (aligned && sizeof(ai_real) != sizeof(float))
+        throw DeadlyImportError("Aligned binaries require single precision!");
 
     stream->Seek(256, aiOrigin_CUR); // original filename
     stream->Seek(128, aiOrigin_CUR); // options
     stream->Seek(64, aiOrigin_CUR); // padding
 
-    if (compressed) {
-        uLongf uncompressedSize = Read<uint32_t>(stream);
-        uLongf compressedSize = static_cast<uLongf>(stream->FileSize() - stream->Tell());
+    if (aligned) {
+        ReadTableOfContents(stream);
+        mDataStream = stream;
+        try {
+            if (m_deferMeshData || nullptr != stream->GetContiguousView()) {
+                ReadBinaryScene(stream, pScene);
+            } else {
+                // read the scene chunk at once, the streams go straight to the mesh arrays
+                const uint32_t magic = Read<uint32_t>(stream);
+                const uint32_t size = Read<uint32_t>(stream);
+                if (size > stream->FileSize() - stream->Tell()) {
+                    throw DeadlyImportError("Unexpected EOF");
+                }
+                std::unique_ptr<uint8_t[]> chunk(new uint8_t[size + 8]);
+                memcpy(chunk.get(), &magic, 4);
+                memcpy(chunk.get() + 4, &size, 4);
+                if (size && stream->Read(chunk.get() + 8, 1, size) != size) {
+                    throw DeadlyImportError("Unexpected EOF");
+                }
 
-        unsigned char *compressedData = new unsigned char[compressedSize];
-        size_t len = stream->Read(compressedData, 1, compressedSize);
-        ai_assert(len == compressedSize);
+                MemoryIOStream io(chunk.get(), size + 8);
 
-        unsigned char *uncompressedData = new unsigned char[uncompressedSize];
+                ReadBinaryScene(&io, pScene);
+            }
+        } catch (...) {
+            mDataStream = nullptr;
+            pIOHandler->Close(stream);
+            throw;
+        }
+        mDataStream = nullptr;
+    } else if (compressed) {
+        uLongf uncompressedSize = Read<uint32_t>(stream);
+        const size_t start = stream->Tell();
+        uLongf compressedSize = static_cast<uLongf>(stream->FileSize() - start);
+
+        // inflate straight from the view of the stream if there is one
+        std::vector<unsigned char> compressedBuffer;
+        const unsigned char *compressedData = stream->GetContiguousView();
+        if (nullptr != compressedData) {
+            compressedData += start;
+        } else {
+            compressedBuffer.resize(compressedSize);
+            size_t len = compressedSize ? stream->Read(&compressedBuffer[0], 1, compressedSize) : 0;
+            ai_assert(len == compressedSize);
+            compressedSize = static_cast<uLongf>(len);
+            compressedData = compressedBuffer.data();
+        }
 
-        int res = uncompress(uncompressedData, &uncompressedSize, compressedData, (uLong)len);
+        std::unique_ptr<unsigned char[]> uncompressedData(new unsigned char[uncompressedSize]);
+
+        int res = uncompress(uncompressedData.get(), &uncompressedSize, compressedData, (uLong)compressedSize);
         if (res != Z_OK) {
-            delete[] uncompressedData;
-            delete[] compressedData;
             pIOHandler->Close(stream);
             throw DeadlyImportError("Zlib decompression failed.");
         }
 
-        MemoryIOStream io(uncompressedData, uncompressedSize);
+        MemoryIOStream io(uncompressedData.get(), uncompressedSize);
 
         ReadBinaryScene(&io, pScene);
-
-        delete[] uncompressedData;
-        delete[] compressedData;
-    } else {
+    } else if (m_deferMeshData || nullptr != stream->GetContiguousView()) {
+        // deferred meshes are read again from their offsets in the file later on
         ReadBinaryScene(stream, pScene);
+    } else {
+        // read the body at once and parse it from memory
+        const size_t start = stream->Tell();
+        const size_t size = stream->FileSize() > start ? stream->FileSize() - start : 0;
+        std::unique_ptr<uint8_t[]> body(new uint8_t[size]);
+        if (0 == size || stream->Read(body.get(), 1, size) != size) {
+            pIOHandler->Close(stream);
+            throw DeadlyImportError("Unexpected EOF");
+        }
+
+        MemoryIOStream io(body.get(), size);
+
+        ReadBinaryScene(&io, pScene);
     }
 
     pIOHandler->Close(stream);
+
+    if (!mDeferredMeshOffsets.empty()) {
+        pScene->mFlags |= AI_SCENE_FLAGS_DEFERRED_MESH_DATA;
+    }
+}
+
+// -----------------------------------------------------------------------------------
+void AssbinImporter::InternReadMeshData(const std::string &pFile, aiScene *pScene, unsigned int pMeshIndex, IOSystem *pIOHandler) {
+    if (pMeshIndex >= mDeferredMeshOffsets.size()) {
+        throw DeadlyImportError("ASSBIN: deferred mesh ", pMeshIndex, " does not exist in ", pFile);
+    }
+
+    std::unique_ptr<IOStream> stream(pIOHandler->Open(pFile, "rb"));
+    if (nullptr == stream) {
+        throw DeadlyImportError("ASSBIN: Could not open ", pFile);
+    }
+    stream->Seek(mDeferredMeshOffsets[pMeshIndex], aiOrigin_SET);
+
+    std::unique_ptr<aiMesh> mesh(new aiMesh());
+    const bool defer = m_deferMeshData;
+    m_deferMeshData = false;
+    mDataStream = stream.get();
+    try {
+        ReadBinaryMesh(stream.get(), mesh.get(), pMeshIndex);
+    } catch (...) {
+        m_deferMeshData = defer;
+        mDataStream = nullptr;
+        throw;
+    }
+    m_deferMeshData = defer;
+    mDataStream = nullptr;
+
+    MoveMeshData(pScene->mMeshes[pMeshIndex], mesh.get());
 }
 
 #endif // !! ASSIMP_BUILD_NO_ASSBIN_IMPORTER
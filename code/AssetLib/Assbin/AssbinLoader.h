@@ -48,6 +48,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define AI_ASSBINIMPORTER_H_INC
 
 #include <assimp/BaseImporter.h>
+#include "Common/assbin_chunks.h"
+
+#include <vector>
 
 struct aiMesh;
 struct aiNode;
@@ -72,8 +75,27 @@ class AssbinImporter : public BaseImporter
 private:
     bool shortened;
     bool compressed;
+    bool aligned;
+
+    // file offsets of the mesh chunks, if their contents are deferred
+    std::vector<size_t> mDeferredMeshOffsets;
+
+    // table of contents entry of a mesh in the aligned layout
+    struct MeshStreams {
+        uint32_t mNumVertices;
+        uint32_t mNumFaces;
+        uint32_t mNumFaceIndices;
+        uint32_t mFaceSize;
+        uint64_t mOffsets[ASSBIN_STREAM_COUNT];
+    };
+    std::vector<MeshStreams> mMeshStreams;
+
+    // the file the streams of the aligned layout are read from
+    IOStream *mDataStream;
 
 public:
+    AssbinImporter();
+
     virtual bool CanRead(
         const std::string& pFile,
         IOSystem* pIOHandler,
@@ -88,7 +110,11 @@ public:
     void ReadHeader();
     void ReadBinaryScene( IOStream * stream, aiScene* pScene );
     void ReadBinaryNode( IOStream * stream, aiNode** mRootNode, aiNode* parent );
-    void ReadBinaryMesh( IOStream * stream, aiMesh* mesh );
+    void ReadBinaryMesh( IOStream * stream, aiMesh* mesh, unsigned int index );
+    void ReadBinaryFaces( IOStream * stream, aiMesh* mesh, size_t end );
+    void ReadTableOfContents( IOStream * stream );
+    void ReadMeshStreams( aiMesh* mesh, unsigned int c, unsigned int index );
+    void ReadStream( uint64_t offset, void* data, uint64_t size );
     void ReadBinaryBone( IOStream * stream, aiBone* bone );
     void ReadBinaryMaterial(IOStream * stream, aiMaterial* mat);
     void ReadBinaryMaterialProperty(IOStream * stream, aiMaterialProperty* prop);
@@ -97,6 +123,14 @@ public:
     void ReadBinaryTexture(IOStream * stream, aiTexture* tex);
     void ReadBinaryLight( IOStream * stream, aiLight* l );
     void ReadBinaryCamera( IOStream * stream, aiCamera* cam );
+
+protected:
+    virtual void InternReadMeshData(
+        const std::string& pFile,
+        aiScene* pScene,
+        unsigned int pMeshIndex,
+        IOSystem* pIOHandler
+    );
 };
 
 } // end of namespace Assimp
@@ -27,9 +27,9 @@ void MeshSplitter::Execute( aiScene* pScene) {
 	const unsigned int size = static_cast<unsigned int>(source_mesh_map.size());
 	if (size != pScene->mNumMeshes) {
 		// it seems something has been split. rebuild the mesh list
-		delete[] pScene->mMeshes;
+		Assimp::FreeSceneArray(pScene->mMeshes);
 		pScene->mNumMeshes = size;
-		pScene->mMeshes = new aiMesh*[size]();
+		pScene->mMeshes = Assimp::AllocateSceneArray<aiMesh *>(size, nullptr);
 
 		for (unsigned int i = 0; i < size;++i) {
 			pScene->mMeshes[i] = source_mesh_map[i].first;
@@ -59,7 +59,7 @@ void MeshSplitter::UpdateNode(aiNode* pcNode, const std::vector<std::pair<aiMesh
 	// now build the new list
 	delete pcNode->mMeshes;
 	pcNode->mNumMeshes = static_cast<unsigned int>(aiEntries.size());
-	pcNode->mMeshes = new unsigned int[pcNode->mNumMeshes];
+	pcNode->mMeshes = Assimp::AllocateSceneArray<unsigned int>(pcNode->mNumMeshes);
 
 	for (unsigned int b = 0; b < pcNode->mNumMeshes;++b) {
 		pcNode->mMeshes[b] = aiEntries[b];
@@ -134,7 +134,7 @@ void MeshSplitter :: SplitMesh(unsigned int a, aiMesh* in_mesh, std::vector<std:
 
 		typedef std::vector<aiVertexWeight> BoneWeightList;
 		if (in_mesh->HasBones())	{
-			out_mesh->mBones = new aiBone*[in_mesh->mNumBones]();
+			out_mesh->mBones = Assimp::AllocateSceneArray<aiBone *>(in_mesh->mNumBones, nullptr);
 		}
 
 		// clear the temporary helper array
@@ -192,7 +192,7 @@ void MeshSplitter :: SplitMesh(unsigned int a, aiMesh* in_mesh, std::vector<std:
 
 			// setup face type and number of indices
 			rFace.mNumIndices = iNumIndices;
-			rFace.mIndices = new unsigned int[iNumIndices];
+			rFace.mIndices = Assimp::AllocateSceneArray<unsigned int>(iNumIndices);
 
 			// need to update the output primitive types
 			switch (rFace.mNumIndices)
@@ -235,7 +235,7 @@ aiNode *BVHLoader::ReadNode() {
     // add the child nodes if there are any
     if (childNodes.size() > 0) {
         node->mNumChildren = static_cast<unsigned int>(childNodes.size());
-        node->mChildren = new aiNode *[node->mNumChildren];
+        node->mChildren = AllocateSceneArray<aiNode *>(node->mNumChildren);
         std::copy(childNodes.begin(), childNodes.end(), node->mChildren);
     }
 
@@ -410,7 +410,7 @@ float BVHLoader::GetNextTokenAsFloat() {
 void BVHLoader::CreateAnimation(aiScene *pScene) {
     // create the animation
     pScene->mNumAnimations = 1;
-    pScene->mAnimations = new aiAnimation *[1];
+    pScene->mAnimations = AllocateSceneArray<aiAnimation *>(1);
     aiAnimation *anim = new aiAnimation;
     pScene->mAnimations[0] = anim;
 
@@ -421,7 +421,7 @@ void BVHLoader::CreateAnimation(aiScene *pScene) {
 
     // now generate the tracks for all nodes
     anim->mNumChannels = static_cast<unsigned int>(mNodes.size());
-    anim->mChannels = new aiNodeAnim *[anim->mNumChannels];
+    anim->mChannels = AllocateSceneArray<aiNodeAnim *>(anim->mNumChannels);
 
     // FIX: set the array elements to nullptr to ensure proper deletion if an exception is thrown
     for (unsigned int i = 0; i < anim->mNumChannels; ++i)
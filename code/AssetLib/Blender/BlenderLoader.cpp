@@ -350,7 +350,7 @@ void BlenderImporter::ConvertBlendFile(aiScene *out, const Scene &in, const File
     aiNode *root = out->mRootNode = new aiNode("<BlenderRoot>");
 
     root->mNumChildren = static_cast<unsigned int>(no_parents.size());
-    root->mChildren = new aiNode *[root->mNumChildren]();
+    root->mChildren = AllocateSceneArray<aiNode *>(root->mNumChildren, nullptr);
     for (unsigned int i = 0; i < root->mNumChildren; ++i) {
         root->mChildren[i] = ConvertNode(in, no_parents[i], conv, aiMatrix4x4());
         root->mChildren[i]->mParent = root;
@@ -359,31 +359,31 @@ void BlenderImporter::ConvertBlendFile(aiScene *out, const Scene &in, const File
     BuildMaterials(conv);
 
     if (conv.meshes->size()) {
-        out->mMeshes = new aiMesh *[out->mNumMeshes = static_cast<unsigned int>(conv.meshes->size())];
+        out->mMeshes = AllocateSceneArray<aiMesh *>(out->mNumMeshes = static_cast<unsigned int>(conv.meshes->size()));
         std::copy(conv.meshes->begin(), conv.meshes->end(), out->mMeshes);
         conv.meshes.dismiss();
     }
 
     if (conv.lights->size()) {
-        out->mLights = new aiLight *[out->mNumLights = static_cast<unsigned int>(conv.lights->size())];
+        out->mLights = AllocateSceneArray<aiLight *>(out->mNumLights = static_cast<unsigned int>(conv.lights->size()));
         std::copy(conv.lights->begin(), conv.lights->end(), out->mLights);
         conv.lights.dismiss();
     }
 
     if (conv.cameras->size()) {
-        out->mCameras = new aiCamera *[out->mNumCameras = static_cast<unsigned int>(conv.cameras->size())];
+        out->mCameras = AllocateSceneArray<aiCamera *>(out->mNumCameras = static_cast<unsigned int>(conv.cameras->size()));
         std::copy(conv.cameras->begin(), conv.cameras->end(), out->mCameras);
         conv.cameras.dismiss();
     }
 
     if (conv.materials->size()) {
-        out->mMaterials = new aiMaterial *[out->mNumMaterials = static_cast<unsigned int>(conv.materials->size())];
+        out->mMaterials = AllocateSceneArray<aiMaterial *>(out->mNumMaterials = static_cast<unsigned int>(conv.materials->size()));
         std::copy(conv.materials->begin(), conv.materials->end(), out->mMaterials);
         conv.materials.dismiss();
     }
 
     if (conv.textures->size()) {
-        out->mTextures = new aiTexture *[out->mNumTextures = static_cast<unsigned int>(conv.textures->size())];
+        out->mTextures = AllocateSceneArray<aiTexture *>(out->mNumTextures = static_cast<unsigned int>(conv.textures->size()));
         std::copy(conv.textures->begin(), conv.textures->end(), out->mTextures);
         conv.textures.dismiss();
     }
@@ -427,7 +427,7 @@ void BlenderImporter::ResolveImage(aiMaterial *out, const Material *mat, const M
 
         // tex->mHeight = 0;
         curTex->mWidth = img->packedfile->size;
-        uint8_t *ch = new uint8_t[curTex->mWidth];
+        uint8_t *ch = AllocateSceneArray<uint8_t>(curTex->mWidth);
 
         conv_data.db.reader->SetCurrentPos(static_cast<size_t>(img->packedfile->data->val));
         conv_data.db.reader->CopyAndAdvance(ch, curTex->mWidth);
@@ -855,7 +855,7 @@ void BlenderImporter::ConvertMesh(const Scene & /*in*/, const Object * /*obj*/,
         aiMesh *const out = temp[mat_num_to_mesh_idx[mf.mat_nr]];
         aiFace &f = out->mFaces[out->mNumFaces++];
 
-        f.mIndices = new unsigned int[f.mNumIndices = mf.v4 ? 4 : 3];
+        f.mIndices = AllocateSceneArray<unsigned int>(f.mNumIndices = mf.v4 ? 4 : 3);
         aiVector3D *vo = out->mVertices + out->mNumVertices;
         aiVector3D *vn = out->mNormals + out->mNumVertices;
 
@@ -941,7 +941,7 @@ void BlenderImporter::ConvertMesh(const Scene & /*in*/, const Object * /*obj*/,
         aiMesh *const out = temp[mat_num_to_mesh_idx[mf.mat_nr]];
         aiFace &f = out->mFaces[out->mNumFaces++];
 
-        f.mIndices = new unsigned int[f.mNumIndices = mf.totloop];
+        f.mIndices = AllocateSceneArray<unsigned int>(f.mNumIndices = mf.totloop);
         aiVector3D *vo = out->mVertices + out->mNumVertices;
         aiVector3D *vn = out->mNormals + out->mNumVertices;
 
@@ -1261,7 +1261,7 @@ aiNode *BlenderImporter::ConvertNode(const Scene &in, const Object *obj, Convers
             ConvertMesh(in, obj, static_cast<const Mesh *>(obj->data.get()), conv_data, conv_data.meshes);
 
             if (conv_data.meshes->size() > old) {
-                node->mMeshes = new unsigned int[node->mNumMeshes = static_cast<unsigned int>(conv_data.meshes->size() - old)];
+                node->mMeshes = AllocateSceneArray<unsigned int>(node->mNumMeshes = static_cast<unsigned int>(conv_data.meshes->size() - old));
                 for (unsigned int i = 0; i < node->mNumMeshes; ++i) {
                     node->mMeshes[i] = static_cast<unsigned int>(i + old);
                 }
@@ -1323,7 +1323,7 @@ aiNode *BlenderImporter::ConvertNode(const Scene &in, const Object *obj, Convers
 
     if (children.size()) {
         node->mNumChildren = static_cast<unsigned int>(children.size());
-        aiNode **nd = node->mChildren = new aiNode *[node->mNumChildren]();
+        aiNode **nd = node->mChildren = AllocateSceneArray<aiNode *>(node->mNumChildren, nullptr);
         for (const Object *nobj : children) {
             *nd = ConvertNode(in, nobj, conv_data, node->mTransformation * parentTransform);
             (*nd++)->mParent = node.get();
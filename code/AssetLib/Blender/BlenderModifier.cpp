@@ -238,13 +238,13 @@ void BlenderModifier_Mirror ::DoIt(aiNode &out, ConversionData &conv_data, const
 
         conv_data.meshes->push_back(mesh);
     }
-    unsigned int *nind = new unsigned int[out.mNumMeshes * 2];
+    unsigned int *nind = AllocateSceneArray<unsigned int>(out.mNumMeshes * 2);
 
     std::copy(out.mMeshes, out.mMeshes + out.mNumMeshes, nind);
     std::transform(out.mMeshes, out.mMeshes + out.mNumMeshes, nind + out.mNumMeshes,
             [&out](unsigned int n) { return out.mNumMeshes + n; });
 
-    delete[] out.mMeshes;
+    FreeSceneArray(out.mMeshes);
     out.mMeshes = nind;
     out.mNumMeshes *= 2;
 
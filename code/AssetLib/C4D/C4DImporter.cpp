@@ -171,7 +171,7 @@ void C4DImporter::InternReadFile( const std::string& pFile, aiScene* pScene, IOS
 
     // copy meshes over
     pScene->mNumMeshes = static_cast<unsigned int>(meshes.size());
-    pScene->mMeshes = new aiMesh*[pScene->mNumMeshes]();
+    pScene->mMeshes = AllocateSceneArray<aiMesh *>(pScene->mNumMeshes, nullptr);
     std::copy(meshes.begin(), meshes.end(), pScene->mMeshes);
 
     // copy materials over, adding a default material if necessary
@@ -191,7 +191,7 @@ void C4DImporter::InternReadFile( const std::string& pFile, aiScene* pScene, IOS
     }
 
     pScene->mNumMaterials = static_cast<unsigned int>(materials.size());
-    pScene->mMaterials = new aiMaterial*[pScene->mNumMaterials]();
+    pScene->mMaterials = AllocateSceneArray<aiMaterial *>(pScene->mNumMaterials, nullptr);
     std::copy(materials.begin(), materials.end(), pScene->mMaterials);
 }
 
@@ -336,7 +336,7 @@ void C4DImporter::RecurseHierarchy(BaseObject* object, aiNode* parent) {
             aiMesh* const mesh = ReadMesh(object);
             if(mesh != nullptr) {
                 nd->mNumMeshes = 1;
-                nd->mMeshes = new unsigned int[1];
+                nd->mMeshes = AllocateSceneArray<unsigned int>(1);
                 nd->mMeshes[0] = static_cast<unsigned int>(meshes.size());
                 meshes.push_back(mesh);
             }
@@ -350,7 +350,7 @@ void C4DImporter::RecurseHierarchy(BaseObject* object, aiNode* parent) {
 
     // copy nodes over to parent
     parent->mNumChildren = static_cast<unsigned int>(nodes.size());
-    parent->mChildren = new aiNode*[parent->mNumChildren]();
+    parent->mChildren = AllocateSceneArray<aiNode *>(parent->mNumChildren, nullptr);
     std::copy(nodes.begin(), nodes.end(), parent->mChildren);
 }
 
@@ -465,7 +465,7 @@ aiMesh* C4DImporter::ReadMesh(BaseObject* object) {
         } else {
             face->mNumIndices = 3;
         }
-        face->mIndices = new unsigned int[face->mNumIndices];
+        face->mIndices = AllocateSceneArray<unsigned int>(face->mNumIndices);
         for(unsigned int j = 0; j < face->mNumIndices; ++j) {
             face->mIndices[j] = n++;
         }
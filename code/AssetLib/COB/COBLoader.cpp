@@ -186,8 +186,8 @@ void COBImporter::InternReadFile(const std::string &pFile, aiScene *pScene, IOSy
             }
         }
     }
-    pScene->mMeshes = new aiMesh *[pScene->mNumMeshes]();
-    pScene->mMaterials = new aiMaterial *[pScene->mNumMeshes]();
+    pScene->mMeshes = AllocateSceneArray<aiMesh *>(pScene->mNumMeshes, nullptr);
+    pScene->mMaterials = AllocateSceneArray<aiMaterial *>(pScene->mNumMeshes, nullptr);
     pScene->mNumMeshes = 0;
 
     // count lights and cameras
@@ -200,10 +200,10 @@ void COBImporter::InternReadFile(const std::string &pFile, aiScene *pScene, IOSy
     }
 
     if (pScene->mNumLights) {
-        pScene->mLights = new aiLight *[pScene->mNumLights]();
+        pScene->mLights = AllocateSceneArray<aiLight *>(pScene->mNumLights, nullptr);
     }
     if (pScene->mNumCameras) {
-        pScene->mCameras = new aiCamera *[pScene->mNumCameras]();
+        pScene->mCameras = AllocateSceneArray<aiCamera *>(pScene->mNumCameras, nullptr);
     }
     pScene->mNumLights = pScene->mNumCameras = 0;
 
@@ -271,7 +271,7 @@ aiNode *COBImporter::BuildNodes(const Node &root, const Scene &scin, aiScene *fi
                         }
 
                         aiFace &fout = outmesh->mFaces[outmesh->mNumFaces++];
-                        fout.mIndices = new unsigned int[f->indices.size()];
+                        fout.mIndices = AllocateSceneArray<unsigned int>(f->indices.size());
 
                         for (VertexIndex &v : f->indices) {
                             if (v.pos_idx >= ndmesh.vertex_positions.size()) {
@@ -385,14 +385,14 @@ aiNode *COBImporter::BuildNodes(const Node &root, const Scene &scin, aiScene *fi
 
     // add meshes
     if (nd->mNumMeshes) { // mMeshes must be nullptr if count is 0
-        nd->mMeshes = new unsigned int[nd->mNumMeshes];
+        nd->mMeshes = AllocateSceneArray<unsigned int>(nd->mNumMeshes);
         for (unsigned int i = 0; i < nd->mNumMeshes; ++i) {
             nd->mMeshes[i] = fill->mNumMeshes - i - 1;
         }
     }
 
     // add children recursively
-    nd->mChildren = new aiNode *[root.temp_children.size()]();
+    nd->mChildren = AllocateSceneArray<aiNode *>(root.temp_children.size(), nullptr);
     for (const Node *n : root.temp_children) {
         (nd->mChildren[nd->mNumChildren++] = BuildNodes(*n, scin, fill))->mParent = nd;
     }
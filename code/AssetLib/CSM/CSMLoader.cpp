@@ -186,7 +186,7 @@ void CSMImporter::InternReadFile( const std::string& pFile,
                     throw DeadlyImportError("CSM: Empty $order section");
 
                 // copy over to the output animation
-                anim->mChannels = new aiNodeAnim*[anim->mNumChannels];
+                anim->mChannels = AllocateSceneArray<aiNodeAnim *>(anim->mNumChannels);
                 ::memcpy(anim->mChannels,&anims_temp[0],sizeof(aiNodeAnim*)*anim->mNumChannels);
             }
             else if (TokenMatchI(buffer,"points",6))    {
@@ -280,7 +280,7 @@ void CSMImporter::InternReadFile( const std::string& pFile,
     pScene->mRootNode->mName.Set("$CSM_DummyRoot");
 
     pScene->mRootNode->mNumChildren = anim->mNumChannels;
-    pScene->mRootNode->mChildren = new aiNode* [anim->mNumChannels];
+    pScene->mRootNode->mChildren = AllocateSceneArray<aiNode *>(anim->mNumChannels);
 
     for (unsigned int i = 0; i < anim->mNumChannels;++i)    {
         aiNodeAnim* na = anim->mChannels[i];
@@ -293,7 +293,7 @@ void CSMImporter::InternReadFile( const std::string& pFile,
     }
 
     // Store the one and only animation in the scene
-    pScene->mAnimations    = new aiAnimation*[pScene->mNumAnimations=1];
+    pScene->mAnimations    = AllocateSceneArray<aiAnimation *>(pScene->mNumAnimations=1);
     anim->mName.Set("$CSM_MasterAnim");
     pScene->mAnimations[0] = anim.release();
 
@@ -277,7 +277,7 @@ aiNode *ColladaLoader::BuildHierarchy(const ColladaParser &pParser, const Collad
 
     // add children. first the *real* ones
     node->mNumChildren = static_cast<unsigned int>(pNode->mChildren.size() + instances.size());
-    node->mChildren = new aiNode *[node->mNumChildren];
+    node->mChildren = AllocateSceneArray<aiNode *>(node->mNumChildren);
 
     for (size_t a = 0; a < pNode->mChildren.size(); ++a) {
         node->mChildren[a] = BuildHierarchy(pParser, pNode->mChildren[a]);
@@ -580,7 +580,7 @@ void ColladaLoader::BuildMeshesForNode(const ColladaParser &pParser, const Node
             }
         };
 
-        pTarget->mMeshes = new unsigned int[pTarget->mNumMeshes];
+        pTarget->mMeshes = AllocateSceneArray<unsigned int>(pTarget->mNumMeshes);
         std::transform(newMeshRefs.begin(), newMeshRefs.end(), pTarget->mMeshes, UIntTypeConverter());
     }
 }
@@ -683,7 +683,7 @@ aiMesh *ColladaLoader::CreateMesh(const ColladaParser &pParser, const Mesh *pSrc
         size_t s = pSrcMesh->mFaceSize[pStartFace + a];
         aiFace &face = dstMesh->mFaces[a];
         face.mNumIndices = static_cast<unsigned int>(s);
-        face.mIndices = new unsigned int[s];
+        face.mIndices = AllocateSceneArray<unsigned int>(s);
         for (size_t b = 0; b < s; ++b) {
             face.mIndices[b] = static_cast<unsigned int>(vertex++);
         }
@@ -744,7 +744,7 @@ aiMesh *ColladaLoader::CreateMesh(const ColladaParser &pParser, const Mesh *pSrc
             animMeshes.push_back(animMesh);
         }
         dstMesh->mMethod = (method == Relative) ? aiMorphingMethod_MORPH_RELATIVE : aiMorphingMethod_MORPH_NORMALIZED;
-        dstMesh->mAnimMeshes = new aiAnimMesh *[animMeshes.size()];
+        dstMesh->mAnimMeshes = AllocateSceneArray<aiAnimMesh *>(animMeshes.size());
         dstMesh->mNumAnimMeshes = static_cast<unsigned int>(animMeshes.size());
         for (unsigned int i = 0; i < animMeshes.size(); ++i) {
             dstMesh->mAnimMeshes[i] = animMeshes.at(i);
@@ -827,7 +827,7 @@ aiMesh *ColladaLoader::CreateMesh(const ColladaParser &pParser, const Mesh *pSrc
 
         // create bone array and copy bone weights one by one
         dstMesh->mNumBones = static_cast<unsigned int>(numRemainingBones);
-        dstMesh->mBones = new aiBone *[numRemainingBones];
+        dstMesh->mBones = AllocateSceneArray<aiBone *>(numRemainingBones);
         size_t boneCount = 0;
         for (size_t a = 0; a < numBones; ++a) {
             // omit bones without weights
@@ -905,7 +905,7 @@ void ColladaLoader::StoreSceneMeshes(aiScene *pScene) {
     if (mMeshes.empty()) {
         return;
     }
-    pScene->mMeshes = new aiMesh *[mMeshes.size()];
+    pScene->mMeshes = AllocateSceneArray<aiMesh *>(mMeshes.size());
     std::copy(mMeshes.begin(), mMeshes.end(), pScene->mMeshes);
     mMeshes.clear();
 }
@@ -917,7 +917,7 @@ void ColladaLoader::StoreSceneCameras(aiScene *pScene) {
     if (mCameras.empty()) {
         return;
     }
-    pScene->mCameras = new aiCamera *[mCameras.size()];
+    pScene->mCameras = AllocateSceneArray<aiCamera *>(mCameras.size());
     std::copy(mCameras.begin(), mCameras.end(), pScene->mCameras);
     mCameras.clear();
 }
@@ -929,7 +929,7 @@ void ColladaLoader::StoreSceneLights(aiScene *pScene) {
     if (mLights.empty()) {
         return;
     }
-    pScene->mLights = new aiLight *[mLights.size()];
+    pScene->mLights = AllocateSceneArray<aiLight *>(mLights.size());
     std::copy(mLights.begin(), mLights.end(), pScene->mLights);
     mLights.clear();
 }
@@ -941,7 +941,7 @@ void ColladaLoader::StoreSceneTextures(aiScene *pScene) {
     if (mTextures.empty()) {
         return;
     }
-    pScene->mTextures = new aiTexture *[mTextures.size()];
+    pScene->mTextures = AllocateSceneArray<aiTexture *>(mTextures.size());
     std::copy(mTextures.begin(), mTextures.end(), pScene->mTextures);
     mTextures.clear();
 }
@@ -953,7 +953,7 @@ void ColladaLoader::StoreSceneMaterials(aiScene *pScene) {
     if (newMats.empty()) {
         return;
     }
-    pScene->mMaterials = new aiMaterial *[newMats.size()];
+    pScene->mMaterials = AllocateSceneArray<aiMaterial *>(newMats.size());
     for (unsigned int i = 0; i < newMats.size(); ++i) {
         pScene->mMaterials[i] = newMats[i].second;
     }
@@ -1007,7 +1007,7 @@ void ColladaLoader::StoreAnimations(aiScene *pScene, const ColladaParser &pParse
                 combinedAnim->mDuration = templateAnim->mDuration;
                 combinedAnim->mTicksPerSecond = templateAnim->mTicksPerSecond;
                 combinedAnim->mNumChannels = static_cast<unsigned int>(collectedAnimIndices.size() + 1);
-                combinedAnim->mChannels = new aiNodeAnim *[combinedAnim->mNumChannels];
+                combinedAnim->mChannels = AllocateSceneArray<aiNodeAnim *>(combinedAnim->mNumChannels);
                 // add the template anim as first channel by moving its aiNodeAnim to the combined animation
                 combinedAnim->mChannels[0] = templateAnim->mChannels[0];
                 templateAnim->mChannels[0] = nullptr;
@@ -1036,7 +1036,7 @@ void ColladaLoader::StoreAnimations(aiScene *pScene, const ColladaParser &pParse
     // now store all anims in the scene
     if (!mAnims.empty()) {
         pScene->mNumAnimations = static_cast<unsigned int>(mAnims.size());
-        pScene->mAnimations = new aiAnimation *[mAnims.size()];
+        pScene->mAnimations = AllocateSceneArray<aiAnimation *>(mAnims.size());
         std::copy(mAnims.begin(), mAnims.end(), pScene->mAnimations);
     }
 
@@ -1446,8 +1446,8 @@ void ColladaLoader::CreateAnimation(aiScene *pScene, const ColladaParser &pParse
                 morphAnim->mKeys = new aiMeshMorphKey[morphAnim->mNumKeys];
                 for (unsigned int key = 0; key < morphAnim->mNumKeys; key++) {
                     morphAnim->mKeys[key].mNumValuesAndWeights = static_cast<unsigned int>(morphChannels.size());
-                    morphAnim->mKeys[key].mValues = new unsigned int[morphChannels.size()];
-                    morphAnim->mKeys[key].mWeights = new double[morphChannels.size()];
+                    morphAnim->mKeys[key].mValues = AllocateSceneArray<unsigned int>(morphChannels.size());
+                    morphAnim->mKeys[key].mWeights = AllocateSceneArray<double>(morphChannels.size());
 
                     morphAnim->mKeys[key].mTime = morphTimeValues[key].mTime * kMillisecondsFromSeconds;
                     for (unsigned int valueIndex = 0; valueIndex < morphChannels.size(); ++valueIndex) {
@@ -1466,12 +1466,12 @@ void ColladaLoader::CreateAnimation(aiScene *pScene, const ColladaParser &pParse
         anim->mName.Set(pName);
         anim->mNumChannels = static_cast<unsigned int>(anims.size());
         if (anim->mNumChannels > 0) {
-            anim->mChannels = new aiNodeAnim *[anims.size()];
+            anim->mChannels = AllocateSceneArray<aiNodeAnim *>(anims.size());
             std::copy(anims.begin(), anims.end(), anim->mChannels);
         }
         anim->mNumMorphMeshChannels = static_cast<unsigned int>(morphAnims.size());
         if (anim->mNumMorphMeshChannels > 0) {
-            anim->mMorphMeshChannels = new aiMeshMorphAnim *[anim->mNumMorphMeshChannels];
+            anim->mMorphMeshChannels = AllocateSceneArray<aiMeshMorphAnim *>(anim->mNumMorphMeshChannels);
             std::copy(morphAnims.begin(), morphAnims.end(), anim->mMorphMeshChannels);
         }
         anim->mDuration = 0.0f;
@@ -1740,7 +1740,7 @@ aiString ColladaLoader::FindFilenameForEffectTexture(const ColladaParser &pParse
         // and copy texture data
         tex->mHeight = 0;
         tex->mWidth = static_cast<unsigned int>(imIt->second.mImageData.size());
-        tex->pcData = (aiTexel *)new char[tex->mWidth];
+        tex->pcData = reinterpret_cast<aiTexel *>(AllocateSceneArray<char>(tex->mWidth));
         memcpy(tex->pcData, &imIt->second.mImageData[0], tex->mWidth);
 
         // and add this texture to the list
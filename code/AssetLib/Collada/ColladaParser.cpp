@@ -54,6 +54,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/light.h>
 #include <assimp/DefaultLogger.hpp>
 #include <assimp/IOSystem.hpp>
+#include <algorithm>
 #include <memory>
 
 using namespace Assimp;
@@ -1430,19 +1431,15 @@ void ColladaParser::ReadDataArray(XmlNode &node) {
                 SkipSpacesAndLineEnd(&content);
             }
         } else {
-            data.mValues.reserve(count);
+            data.mValues.resize(count);
 
-            for (unsigned int a = 0; a < count; a++) {
+            const size_t numValues = fast_atoreal_array<ai_real>(content, v.c_str() + v.size(), data.mValues.data(), count);
+            if (numValues < count) {
+                SkipSpacesAndLineEnd(&content);
                 if (*content == 0) {
                     throw DeadlyImportError("Expected more values while reading float_array contents.");
                 }
-
-                // read a number
-                ai_real value;
-                content = fast_atoreal_move<ai_real>(content, value);
-                data.mValues.push_back(value);
-                // skip whitespace after it
-                SkipSpacesAndLineEnd(&content);
+                throw DeadlyImportError("Cannot parse string \"", ai_str_toprintable(content, static_cast<int>(std::min<size_t>(30, v.c_str() + v.size() - content))), "\" as a real number in float_array contents.");
             }
         }
     }
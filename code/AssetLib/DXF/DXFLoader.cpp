@@ -295,7 +295,7 @@ void DXFImporter::ConvertMeshes(aiScene* pScene, DXF::FileData& output) {
         throw DeadlyImportError("DXF: this file contains no 3d data");
     }
 
-    pScene->mMeshes = new aiMesh*[ pScene->mNumMeshes ] ();
+    pScene->mMeshes = AllocateSceneArray<aiMesh *>(pScene->mNumMeshes, nullptr);
 
     for(const LayerMap::value_type& elem : layers){
         aiMesh* const mesh =  pScene->mMeshes[elem.second] = new aiMesh();
@@ -322,7 +322,7 @@ void DXFImporter::ConvertMeshes(aiScene* pScene, DXF::FileData& output) {
             std::vector<unsigned int>::const_iterator it = pl->indices.begin();
             for(unsigned int facenumv : pl->counts) {
                 aiFace& face = *faces++;
-                face.mIndices = new unsigned int[face.mNumIndices = facenumv];
+                face.mIndices = AllocateSceneArray<unsigned int>(face.mNumIndices = facenumv);
 
                 for (unsigned int i = 0; i < facenumv; ++i) {
                     face.mIndices[i] = overall_indices++;
@@ -424,7 +424,7 @@ void DXFImporter::GenerateMaterials(aiScene* pScene, DXF::FileData& /*output*/)
     pcMat->AddProperty(&clrDiffuse,1,AI_MATKEY_COLOR_AMBIENT);
 
     pScene->mNumMaterials = 1;
-    pScene->mMaterials = new aiMaterial*[1];
+    pScene->mMaterials = AllocateSceneArray<aiMaterial *>(1);
     pScene->mMaterials[0] = pcMat;
 }
 
@@ -435,15 +435,15 @@ void DXFImporter::GenerateHierarchy(aiScene* pScene, DXF::FileData& /*output*/)
     pScene->mRootNode->mName.Set("<DXF_ROOT>");
 
     if (1 == pScene->mNumMeshes)    {
-        pScene->mRootNode->mMeshes = new unsigned int[ pScene->mRootNode->mNumMeshes = 1 ];
+        pScene->mRootNode->mMeshes = AllocateSceneArray<unsigned int>(pScene->mRootNode->mNumMeshes = 1);
         pScene->mRootNode->mMeshes[0] = 0;
     } else {
-        pScene->mRootNode->mChildren = new aiNode*[ pScene->mRootNode->mNumChildren = pScene->mNumMeshes ];
+        pScene->mRootNode->mChildren = AllocateSceneArray<aiNode *>(pScene->mRootNode->mNumChildren = pScene->mNumMeshes);
         for (unsigned int m = 0; m < pScene->mRootNode->mNumChildren;++m)   {
             aiNode* p = pScene->mRootNode->mChildren[m] = new aiNode();
             p->mName = pScene->mMeshes[m]->mName;
 
-            p->mMeshes = new unsigned int[p->mNumMeshes = 1];
+            p->mMeshes = AllocateSceneArray<unsigned int>(p->mNumMeshes = 1);
             p->mMeshes[0] = m;
             p->mParent = pScene->mRootNode;
         }
@@ -64,8 +64,8 @@ AnimationCurve::AnimationCurve(uint64_t id, const Element &element, const std::s
     const Element &KeyTime = GetRequiredElement(sc, "KeyTime");
     const Element &KeyValueFloat = GetRequiredElement(sc, "KeyValueFloat");
 
-    ParseVectorDataArray(keys, KeyTime);
-    ParseVectorDataArray(values, KeyValueFloat);
+    ParseVectorDataArray(keys, KeyTime, reserved);
+    ParseVectorDataArray(values, KeyValueFloat, reserved);
 
     if (keys.size() != values.size()) {
         DOMError("the number of key times does not match the number of keyframe values", &KeyTime);
@@ -78,12 +78,12 @@ AnimationCurve::AnimationCurve(uint64_t id, const Element &element, const std::s
 
     const Element *KeyAttrDataFloat = sc["KeyAttrDataFloat"];
     if (KeyAttrDataFloat) {
-        ParseVectorDataArray(attributes, *KeyAttrDataFloat);
+        ParseVectorDataArray(attributes, *KeyAttrDataFloat, reserved);
     }
 
     const Element *KeyAttrFlags = sc["KeyAttrFlags"];
     if (KeyAttrFlags) {
-        ParseVectorDataArray(flags, *KeyAttrFlags);
+        ParseVectorDataArray(flags, *KeyAttrFlags, reserved);
     }
 }
 
@@ -68,6 +68,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <iostream>
 #include <iterator>
 #include <memory>
+#include <numeric>
 #include <sstream>
 #include <tuple>
 #include <vector>
@@ -81,7 +82,8 @@ using namespace Util;
 
 #define CONVERT_FBX_TIME(time) (static_cast<double>(time) * 1000.0 / 46186158000LL)
 
-FBXConverter::FBXConverter(aiScene *out, const Document &doc, bool removeEmptyBones) :
+FBXConverter::FBXConverter(aiScene *out, const Document &doc, bool removeEmptyBones,
+        std::vector<DeferredMesh> *deferredMeshes) :
         defaultMaterialIndex(),
         mMeshes(),
         lights(),
@@ -95,7 +97,8 @@ FBXConverter::FBXConverter(aiScene *out, const Document &doc, bool removeEmptyBo
         anim_fps(),
         mSceneOut(out),
         doc(doc),
-        mRemoveEmptyBones(removeEmptyBones) {
+        mRemoveEmptyBones(removeEmptyBones),
+        mDeferredMeshes(deferredMeshes) {
     // animations need to be converted first since this will
     // populate the node_anim_chain_bits map, which is needed
     // to determine which nodes need to be generated.
@@ -260,7 +263,7 @@ void FBXConverter::ConvertNodes(uint64_t id, aiNode *parent, aiNode *root_node)
 
                 if (last_parent != parent) {
                     last_parent->mNumChildren = 1;
-                    last_parent->mChildren = new aiNode *[1];
+                    last_parent->mChildren = AllocateSceneArray<aiNode *>(1);
                     last_parent->mChildren[0] = child.mOwnership.release();
                 }
 
@@ -284,7 +287,7 @@ void FBXConverter::ConvertNodes(uint64_t id, aiNode *parent, aiNode *root_node)
 
                     if (last_parent != parent) {
                         last_parent->mNumChildren = 1;
-                        last_parent->mChildren = new aiNode *[1];
+                        last_parent->mChildren = AllocateSceneArray<aiNode *>(1);
                         last_parent->mChildren[0] = postnode.mOwnership.release();
                     }
 
@@ -315,7 +318,7 @@ void FBXConverter::ConvertNodes(uint64_t id, aiNode *parent, aiNode *root_node)
     }
 
     if (nodes.size()) {
-        parent->mChildren = new aiNode *[nodes.size()]();
+        parent->mChildren = AllocateSceneArray<aiNode *>(nodes.size(), nullptr);
         parent->mNumChildren = static_cast<unsigned int>(nodes.size());
 
         for (unsigned int i = 0; i < nodes.size(); ++i)
@@ -923,13 +926,188 @@ void FBXConverter::ConvertModel(const Model &model, aiNode *parent, aiNode *root
     }
 
     if (meshes.size()) {
-        parent->mMeshes = new unsigned int[meshes.size()]();
+        parent->mMeshes = AllocateSceneArray<unsigned int>(meshes.size(), 0);
         parent->mNumMeshes = static_cast<unsigned int>(meshes.size());
 
         std::swap_ranges(meshes.begin(), meshes.end(), parent->mMeshes);
     }
 }
 
+// ------------------------------------------------------------------------------------------------
+static unsigned int PrimitiveTypeForFace(unsigned int pcount) {
+    switch (pcount) {
+        case 1:
+            return aiPrimitiveType_POINT;
+        case 2:
+            return aiPrimitiveType_LINE;
+        case 3:
+            return aiPrimitiveType_TRIANGLE;
+        default:
+            return aiPrimitiveType_POLYGON;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+// whether a face belongs to the output mesh, which holds all faces unless the materials are separated
+static bool IsFaceInMesh(const MatIndexArray &mindices, size_t face, bool separate, MatIndexArray::value_type index) {
+    return !separate || (face < mindices.size() && mindices[face] == index);
+}
+
+// ------------------------------------------------------------------------------------------------
+static void CountMeshData(const MeshGeometry &mesh, bool separate, MatIndexArray::value_type index,
+        unsigned int &count_faces, unsigned int &count_vertices, unsigned int &primitive_types) {
+    const MatIndexArray &mindices = mesh.GetMaterialIndices();
+    const std::vector<unsigned int> &faces = mesh.GetFaceIndexCounts();
+
+    count_faces = count_vertices = primitive_types = 0;
+    for (size_t i = 0; i < faces.size(); ++i) {
+        if (!IsFaceInMesh(mindices, i, separate, index)) {
+            continue;
+        }
+        ++count_faces;
+        count_vertices += faces[i];
+        primitive_types |= PrimitiveTypeForFace(faces[i]);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+// allocate and fill the vertex and face data of a mesh, all of the geometry's faces or
+// only those using one material if separate is set
+static void FillMeshData(aiMesh *out_mesh, const MeshGeometry &mesh, bool separate,
+        MatIndexArray::value_type index, std::vector<unsigned int> *reverseMapping,
+        std::map<unsigned int, unsigned int> *translateIndexMap) {
+    const MatIndexArray &mindices = mesh.GetMaterialIndices();
+    const std::vector<aiVector3D> &vertices = mesh.GetVertices();
+    const std::vector<unsigned int> &faces = mesh.GetFaceIndexCounts();
+
+    unsigned int count_faces = 0, count_vertices = 0, primitive_types = 0;
+    CountMeshData(mesh, separate, index, count_faces, count_vertices, primitive_types);
+
+    ai_assert(count_faces);
+    ai_assert(count_vertices);
+
+    if (reverseMapping) {
+        reverseMapping->resize(count_vertices);
+    }
+
+    // allocate output data arrays, but don't fill them yet
+    out_mesh->mNumVertices = count_vertices;
+    out_mesh->mVertices = new aiVector3D[count_vertices];
+    out_mesh->mPrimitiveTypes |= primitive_types;
+
+    unsigned int *faceIndices = out_mesh->AllocateFaces(count_faces, count_vertices);
+    aiFace *fac = out_mesh->mFaces;
+
+    // allocate normals
+    const std::vector<aiVector3D> &normals = mesh.GetNormals();
+    if (normals.size()) {
+        ai_assert(normals.size() == vertices.size());
+        out_mesh->mNormals = new aiVector3D[count_vertices];
+    }
+
+    // allocate tangents, binormals. assimp requires both tangents and bitangents
+    // (binormals) to be present, or neither of them. Compute binormals from normals
+    // and tangents if needed.
+    const std::vector<aiVector3D> &tangents = mesh.GetTangents();
+    const std::vector<aiVector3D> *binormals = &mesh.GetBinormals();
+    std::vector<aiVector3D> tempBinormals;
+
+    if (tangents.size()) {
+        if (!binormals->size()) {
+            if (normals.size()) {
+                // XXX this computes the binormals for the entire mesh, not only
+                // the part for which we need them.
+                tempBinormals.resize(normals.size());
+                for (unsigned int i = 0; i < tangents.size(); ++i) {
+                    tempBinormals[i] = normals[i] ^ tangents[i];
+                }
+
+                binormals = &tempBinormals;
+            } else {
+                binormals = nullptr;
+            }
+        }
+
+        if (binormals) {
+            ai_assert(tangents.size() == vertices.size());
+            ai_assert(binormals->size() == vertices.size());
+
+            out_mesh->mTangents = new aiVector3D[count_vertices];
+            out_mesh->mBitangents = new aiVector3D[count_vertices];
+        }
+    }
+
+    // allocate texture coords
+    unsigned int num_uvs = 0;
+    for (unsigned int i = 0; i < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++i, ++num_uvs) {
+        const std::vector<aiVector2D> &uvs = mesh.GetTextureCoords(i);
+        if (uvs.empty()) {
+            break;
+        }
+
+        out_mesh->mTextureCoords[i] = new aiVector3D[count_vertices];
+        out_mesh->mTextureCoordsNames[i] = mesh.GetTextureCoordChannelName(i);
+        out_mesh->mNumUVComponents[i] = 2;
+    }
+
+    // allocate vertex colors
+    unsigned int num_vcs = 0;
+    for (unsigned int i = 0; i < AI_MAX_NUMBER_OF_COLOR_SETS; ++i, ++num_vcs) {
+        const std::vector<aiColor4D> &colors = mesh.GetVertexColors(i);
+        if (colors.empty()) {
+            break;
+        }
+
+        out_mesh->mColors[i] = new aiColor4D[count_vertices];
+    }
+
+    unsigned int cursor = 0, in_cursor = 0;
+    for (size_t face = 0; face < faces.size(); ++face) {
+        const unsigned int pcount = faces[face];
+        if (!IsFaceInMesh(mindices, face, separate, index)) {
+            in_cursor += pcount;
+            continue;
+        }
+
+        aiFace &f = *fac++;
+
+        f.mNumIndices = pcount;
+        f.mIndices = faceIndices;
+        faceIndices += pcount;
+        for (unsigned int i = 0; i < pcount; ++i, ++cursor, ++in_cursor) {
+            f.mIndices[i] = cursor;
+
+            if (reverseMapping) {
+                (*reverseMapping)[cursor] = in_cursor;
+            }
+            if (translateIndexMap) {
+                (*translateIndexMap)[in_cursor] = cursor;
+            }
+
+            out_mesh->mVertices[cursor] = vertices[in_cursor];
+
+            if (out_mesh->mNormals) {
+                out_mesh->mNormals[cursor] = normals[in_cursor];
+            }
+
+            if (out_mesh->mTangents) {
+                out_mesh->mTangents[cursor] = tangents[in_cursor];
+                out_mesh->mBitangents[cursor] = (*binormals)[in_cursor];
+            }
+
+            for (unsigned int j = 0; j < num_uvs; ++j) {
+                const std::vector<aiVector2D> &uvs = mesh.GetTextureCoords(j);
+                out_mesh->mTextureCoords[j][cursor] = aiVector3D(uvs[in_cursor].x, uvs[in_cursor].y, 0.0f);
+            }
+
+            for (unsigned int j = 0; j < num_vcs; ++j) {
+                const std::vector<aiColor4D> &cols = mesh.GetVertexColors(j);
+                out_mesh->mColors[j][cursor] = cols[in_cursor];
+            }
+        }
+    }
+}
+
 std::vector<unsigned int>
 FBXConverter::ConvertMesh(const MeshGeometry &mesh, const Model &model, aiNode *parent, aiNode *root_node,
         const aiMatrix4x4 &absolute_transform) {
@@ -943,28 +1121,93 @@ FBXConverter::ConvertMesh(const MeshGeometry &mesh, const Model &model, aiNode *
 
     const std::vector<aiVector3D> &vertices = mesh.GetVertices();
     const std::vector<unsigned int> &faces = mesh.GetFaceIndexCounts();
-    if (vertices.empty() || faces.empty()) {
+    if ((vertices.empty() && !mesh.IsHeaderOnly()) || faces.empty()) {
         FBXImporter::LogWarn("ignoring empty geometry: ", mesh.Name());
         return temp;
     }
 
     // one material per mesh maps easily to aiMesh. Multiple material
     // meshes need to be split.
+    bool separate = false;
     const MatIndexArray &mindices = mesh.GetMaterialIndices();
     if (doc.Settings().readMaterials && !mindices.empty()) {
         const MatIndexArray::value_type base = mindices[0];
         for (MatIndexArray::value_type index : mindices) {
             if (index != base) {
-                return ConvertMeshMultiMaterial(mesh, model, parent, root_node, absolute_transform);
+                separate = true;
+                break;
             }
         }
     }
 
+    if (mesh.IsHeaderOnly()) {
+        return ConvertMeshHeaders(mesh, model, parent, separate);
+    }
+
+    if (separate) {
+        return ConvertMeshMultiMaterial(mesh, model, parent, root_node, absolute_transform);
+    }
+
     // faster code-path, just copy the data
     temp.push_back(ConvertMeshSingleMaterial(mesh, model, absolute_transform, parent, root_node));
     return temp;
 }
 
+std::vector<unsigned int> FBXConverter::ConvertMeshHeaders(const MeshGeometry &mesh, const Model &model,
+        aiNode *parent, bool separate) {
+    ai_assert(nullptr != mDeferredMeshes);
+
+    const MatIndexArray &mindices = mesh.GetMaterialIndices();
+    std::vector<MatIndexArray::value_type> parts;
+    if (separate) {
+        std::set<MatIndexArray::value_type> had;
+        for (MatIndexArray::value_type index : mindices) {
+            if (had.insert(index).second) {
+                parts.push_back(index);
+            }
+        }
+    } else {
+        parts.push_back(mindices.empty() ? 0 : mindices[0]);
+    }
+
+    std::vector<unsigned int> indices;
+    for (MatIndexArray::value_type index : parts) {
+        aiMesh *const out_mesh = SetupEmptyMesh(mesh, parent);
+        CountMeshData(mesh, separate, index, out_mesh->mNumFaces, out_mesh->mNumVertices, out_mesh->mPrimitiveTypes);
+
+        for (unsigned int i = 0; i < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++i) {
+            if (!mesh.HasTextureCoords(i)) {
+                break;
+            }
+            out_mesh->mTextureCoordsNames[i] = mesh.GetTextureCoordChannelName(i);
+        }
+
+        if (separate) {
+            ConvertMaterialForMesh(out_mesh, model, mesh, index);
+        } else if (!doc.Settings().readMaterials || mindices.empty()) {
+            FBXImporter::LogError("no material assigned to mesh, setting default material");
+            out_mesh->mMaterialIndex = GetDefaultMaterial();
+        } else {
+            ConvertMaterialForMesh(out_mesh, model, mesh, index);
+        }
+
+        // the data is filled by ConvertDeferredMesh() once it is requested
+        const unsigned int meshIndex = static_cast<unsigned int>(mMeshes.size() - 1);
+        if (mDeferredMeshes->size() <= meshIndex) {
+            mDeferredMeshes->resize(meshIndex + 1);
+        }
+        DeferredMesh &deferred = (*mDeferredMeshes)[meshIndex];
+        deferred.geometry = &mesh;
+        deferred.separateMaterials = separate;
+        deferred.materialIndex = index;
+
+        indices.push_back(meshIndex);
+    }
+
+    mSceneOut->mFlags |= AI_SCENE_FLAGS_DEFERRED_MESH_DATA;
+    return indices;
+}
+
 std::vector<unsigned int> FBXConverter::ConvertLine(const LineGeometry &line, aiNode *root_node) {
     std::vector<unsigned int> temp;
 
@@ -993,14 +1236,13 @@ std::vector<unsigned int> FBXConverter::ConvertLine(const LineGeometry &line, ai
         }
     }
     unsigned int pcount = static_cast<unsigned int>(indices.size());
-    unsigned int scount = out_mesh->mNumFaces = pcount - epcount;
+    unsigned int scount = pcount - epcount;
 
-    aiFace *fac = out_mesh->mFaces = new aiFace[scount]();
+    out_mesh->AllocateUniformFaces(scount, 2); //2 == aiPrimitiveType_LINE
+    aiFace *fac = out_mesh->mFaces;
     for (unsigned int i = 0; i < pcount; ++i) {
         if (indices[i] < 0) continue;
         aiFace &f = *fac++;
-        f.mNumIndices = 2; //2 == aiPrimitiveType_LINE
-        f.mIndices = new unsigned int[2];
         f.mIndices[0] = indices[i];
         int segid = indices[(i + 1 == pcount ? 0 : i + 1)]; //If we have reached he last point, wrap around
         f.mIndices[1] = (segid < 0 ? (segid + 1) * -1 : segid); //Convert EndPoint Index to normal Index
@@ -1035,112 +1277,8 @@ unsigned int FBXConverter::ConvertMeshSingleMaterial(const MeshGeometry &mesh, c
     const MatIndexArray &mindices = mesh.GetMaterialIndices();
     aiMesh *const out_mesh = SetupEmptyMesh(mesh, parent);
 
-    const std::vector<aiVector3D> &vertices = mesh.GetVertices();
-    const std::vector<unsigned int> &faces = mesh.GetFaceIndexCounts();
-
-    // copy vertices
-    out_mesh->mNumVertices = static_cast<unsigned int>(vertices.size());
-    out_mesh->mVertices = new aiVector3D[vertices.size()];
-
-    std::copy(vertices.begin(), vertices.end(), out_mesh->mVertices);
-
-    // generate dummy faces
-    out_mesh->mNumFaces = static_cast<unsigned int>(faces.size());
-    aiFace *fac = out_mesh->mFaces = new aiFace[faces.size()]();
-
-    unsigned int cursor = 0;
-    for (unsigned int pcount : faces) {
-        aiFace &f = *fac++;
-        f.mNumIndices = pcount;
-        f.mIndices = new unsigned int[pcount];
-        switch (pcount) {
-            case 1:
-                out_mesh->mPrimitiveTypes |= aiPrimitiveType_POINT;
-                break;
-            case 2:
-                out_mesh->mPrimitiveTypes |= aiPrimitiveType_LINE;
-                break;
-            case 3:
-                out_mesh->mPrimitiveTypes |= aiPrimitiveType_TRIANGLE;
-                break;
-            default:
-                out_mesh->mPrimitiveTypes |= aiPrimitiveType_POLYGON;
-                break;
-        }
-        for (unsigned int i = 0; i < pcount; ++i) {
-            f.mIndices[i] = cursor++;
-        }
-    }
-
-    // copy normals
-    const std::vector<aiVector3D> &normals = mesh.GetNormals();
-    if (normals.size()) {
-        ai_assert(normals.size() == vertices.size());
-
-        out_mesh->mNormals = new aiVector3D[vertices.size()];
-        std::copy(normals.begin(), normals.end(), out_mesh->mNormals);
-    }
-
-    // copy tangents - assimp requires both tangents and bitangents (binormals)
-    // to be present, or neither of them. Compute binormals from normals
-    // and tangents if needed.
-    const std::vector<aiVector3D> &tangents = mesh.GetTangents();
-    const std::vector<aiVector3D> *binormals = &mesh.GetBinormals();
-
-    if (tangents.size()) {
-        std::vector<aiVector3D> tempBinormals;
-        if (!binormals->size()) {
-            if (normals.size()) {
-                tempBinormals.resize(normals.size());
-                for (unsigned int i = 0; i < tangents.size(); ++i) {
-                    tempBinormals[i] = normals[i] ^ tangents[i];
-                }
-
-                binormals = &tempBinormals;
-            } else {
-                binormals = nullptr;
-            }
-        }
-
-        if (binormals) {
-            ai_assert(tangents.size() == vertices.size());
-            ai_assert(binormals->size() == vertices.size());
-
-            out_mesh->mTangents = new aiVector3D[vertices.size()];
-            std::copy(tangents.begin(), tangents.end(), out_mesh->mTangents);
-
-            out_mesh->mBitangents = new aiVector3D[vertices.size()];
-            std::copy(binormals->begin(), binormals->end(), out_mesh->mBitangents);
-        }
-    }
-
-    // copy texture coords
-    for (unsigned int i = 0; i < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++i) {
-        const std::vector<aiVector2D> &uvs = mesh.GetTextureCoords(i);
-        if (uvs.empty()) {
-            break;
-        }
-
-        aiVector3D *out_uv = out_mesh->mTextureCoords[i] = new aiVector3D[vertices.size()];
-        for (const aiVector2D &v : uvs) {
-            *out_uv++ = aiVector3D(v.x, v.y, 0.0f);
-        }
-
-        out_mesh->mTextureCoordsNames[i] = mesh.GetTextureCoordChannelName(i);
-
-        out_mesh->mNumUVComponents[i] = 2;
-    }
-
-    // copy vertex colors
-    for (unsigned int i = 0; i < AI_MAX_NUMBER_OF_COLOR_SETS; ++i) {
-        const std::vector<aiColor4D> &colors = mesh.GetVertexColors(i);
-        if (colors.empty()) {
-            break;
-        }
-
-        out_mesh->mColors[i] = new aiColor4D[vertices.size()];
-        std::copy(colors.begin(), colors.end(), out_mesh->mColors[i]);
-    }
+    // copy the data of all faces, the vertices are already in output order
+    FillMeshData(out_mesh, mesh, false, 0, nullptr, nullptr);
 
     if (!doc.Settings().readMaterials || mindices.empty()) {
         FBXImporter::LogError("no material assigned to mesh, setting default material");
@@ -1188,7 +1326,7 @@ unsigned int FBXConverter::ConvertMeshSingleMaterial(const MeshGeometry &mesh, c
     const size_t numAnimMeshes = animMeshes.size();
     if (numAnimMeshes > 0) {
         out_mesh->mNumAnimMeshes = static_cast<unsigned int>(numAnimMeshes);
-        out_mesh->mAnimMeshes = new aiAnimMesh *[numAnimMeshes];
+        out_mesh->mAnimMeshes = AllocateSceneArray<aiAnimMesh *>(numAnimMeshes);
         for (size_t i = 0; i < numAnimMeshes; i++) {
             out_mesh->mAnimMeshes[i] = animMeshes.at(i);
         }
@@ -1223,161 +1361,15 @@ unsigned int FBXConverter::ConvertMeshMultiMaterial(const MeshGeometry &mesh, co
         const aiMatrix4x4 &absolute_transform) {
     aiMesh *const out_mesh = SetupEmptyMesh(mesh, parent);
 
-    const MatIndexArray &mindices = mesh.GetMaterialIndices();
-    const std::vector<aiVector3D> &vertices = mesh.GetVertices();
-    const std::vector<unsigned int> &faces = mesh.GetFaceIndexCounts();
-
     const bool process_weights = doc.Settings().readWeights && mesh.DeformerSkin() != nullptr;
 
-    unsigned int count_faces = 0;
-    unsigned int count_vertices = 0;
-
-    // count faces
-    std::vector<unsigned int>::const_iterator itf = faces.begin();
-    for (MatIndexArray::const_iterator it = mindices.begin(),
-                                       end = mindices.end();
-            it != end; ++it, ++itf) {
-        if ((*it) != index) {
-            continue;
-        }
-        ++count_faces;
-        count_vertices += *itf;
-    }
-
-    ai_assert(count_faces);
-    ai_assert(count_vertices);
-
     // mapping from output indices to DOM indexing, needed to resolve weights or blendshapes
     std::vector<unsigned int> reverseMapping;
     std::map<unsigned int, unsigned int> translateIndexMap;
     if (process_weights || mesh.GetBlendShapes().size() > 0) {
-        reverseMapping.resize(count_vertices);
-    }
-
-    // allocate output data arrays, but don't fill them yet
-    out_mesh->mNumVertices = count_vertices;
-    out_mesh->mVertices = new aiVector3D[count_vertices];
-
-    out_mesh->mNumFaces = count_faces;
-    aiFace *fac = out_mesh->mFaces = new aiFace[count_faces]();
-
-    // allocate normals
-    const std::vector<aiVector3D> &normals = mesh.GetNormals();
-    if (normals.size()) {
-        ai_assert(normals.size() == vertices.size());
-        out_mesh->mNormals = new aiVector3D[vertices.size()];
-    }
-
-    // allocate tangents, binormals.
-    const std::vector<aiVector3D> &tangents = mesh.GetTangents();
-    const std::vector<aiVector3D> *binormals = &mesh.GetBinormals();
-    std::vector<aiVector3D> tempBinormals;
-
-    if (tangents.size()) {
-        if (!binormals->size()) {
-            if (normals.size()) {
-                // XXX this computes the binormals for the entire mesh, not only
-                // the part for which we need them.
-                tempBinormals.resize(normals.size());
-                for (unsigned int i = 0; i < tangents.size(); ++i) {
-                    tempBinormals[i] = normals[i] ^ tangents[i];
-                }
-
-                binormals = &tempBinormals;
-            } else {
-                binormals = nullptr;
-            }
-        }
-
-        if (binormals) {
-            ai_assert(tangents.size() == vertices.size());
-            ai_assert(binormals->size() == vertices.size());
-
-            out_mesh->mTangents = new aiVector3D[vertices.size()];
-            out_mesh->mBitangents = new aiVector3D[vertices.size()];
-        }
-    }
-
-    // allocate texture coords
-    unsigned int num_uvs = 0;
-    for (unsigned int i = 0; i < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++i, ++num_uvs) {
-        const std::vector<aiVector2D> &uvs = mesh.GetTextureCoords(i);
-        if (uvs.empty()) {
-            break;
-        }
-
-        out_mesh->mTextureCoords[i] = new aiVector3D[vertices.size()];
-        out_mesh->mNumUVComponents[i] = 2;
-    }
-
-    // allocate vertex colors
-    unsigned int num_vcs = 0;
-    for (unsigned int i = 0; i < AI_MAX_NUMBER_OF_COLOR_SETS; ++i, ++num_vcs) {
-        const std::vector<aiColor4D> &colors = mesh.GetVertexColors(i);
-        if (colors.empty()) {
-            break;
-        }
-
-        out_mesh->mColors[i] = new aiColor4D[vertices.size()];
-    }
-
-    unsigned int cursor = 0, in_cursor = 0;
-
-    itf = faces.begin();
-    for (MatIndexArray::const_iterator it = mindices.begin(), end = mindices.end(); it != end; ++it, ++itf) {
-        const unsigned int pcount = *itf;
-        if ((*it) != index) {
-            in_cursor += pcount;
-            continue;
-        }
-
-        aiFace &f = *fac++;
-
-        f.mNumIndices = pcount;
-        f.mIndices = new unsigned int[pcount];
-        switch (pcount) {
-            case 1:
-                out_mesh->mPrimitiveTypes |= aiPrimitiveType_POINT;
-                break;
-            case 2:
-                out_mesh->mPrimitiveTypes |= aiPrimitiveType_LINE;
-                break;
-            case 3:
-                out_mesh->mPrimitiveTypes |= aiPrimitiveType_TRIANGLE;
-                break;
-            default:
-                out_mesh->mPrimitiveTypes |= aiPrimitiveType_POLYGON;
-                break;
-        }
-        for (unsigned int i = 0; i < pcount; ++i, ++cursor, ++in_cursor) {
-            f.mIndices[i] = cursor;
-
-            if (reverseMapping.size()) {
-                reverseMapping[cursor] = in_cursor;
-                translateIndexMap[in_cursor] = cursor;
-            }
-
-            out_mesh->mVertices[cursor] = vertices[in_cursor];
-
-            if (out_mesh->mNormals) {
-                out_mesh->mNormals[cursor] = normals[in_cursor];
-            }
-
-            if (out_mesh->mTangents) {
-                out_mesh->mTangents[cursor] = tangents[in_cursor];
-                out_mesh->mBitangents[cursor] = (*binormals)[in_cursor];
-            }
-
-            for (unsigned int j = 0; j < num_uvs; ++j) {
-                const std::vector<aiVector2D> &uvs = mesh.GetTextureCoords(j);
-                out_mesh->mTextureCoords[j][cursor] = aiVector3D(uvs[in_cursor].x, uvs[in_cursor].y, 0.0f);
-            }
-
-            for (unsigned int j = 0; j < num_vcs; ++j) {
-                const std::vector<aiColor4D> &cols = mesh.GetVertexColors(j);
-                out_mesh->mColors[j][cursor] = cols[in_cursor];
-            }
-        }
+        FillMeshData(out_mesh, mesh, true, index, &reverseMapping, &translateIndexMap);
+    } else {
+        FillMeshData(out_mesh, mesh, true, index, nullptr, nullptr);
     }
 
     ConvertMaterialForMesh(out_mesh, model, mesh, index);
@@ -1424,7 +1416,7 @@ unsigned int FBXConverter::ConvertMeshMultiMaterial(const MeshGeometry &mesh, co
     const size_t numAnimMeshes = animMeshes.size();
     if (numAnimMeshes > 0) {
         out_mesh->mNumAnimMeshes = static_cast<unsigned int>(numAnimMeshes);
-        out_mesh->mAnimMeshes = new aiAnimMesh *[numAnimMeshes];
+        out_mesh->mAnimMeshes = AllocateSceneArray<aiAnimMesh *>(numAnimMeshes);
         for (size_t i = 0; i < numAnimMeshes; i++) {
             out_mesh->mAnimMeshes[i] = animMeshes.at(i);
         }
@@ -1520,7 +1512,7 @@ void FBXConverter::ConvertWeights(aiMesh *out, const MeshGeometry &geo,
         out->mNumBones = 0;
         return;
     } else {
-        out->mBones = new aiBone *[bones.size()]();
+        out->mBones = AllocateSceneArray<aiBone *>(bones.size(), nullptr);
         out->mNumBones = static_cast<unsigned int>(bones.size());
 
         std::swap_ranges(bones.begin(), bones.end(), out->mBones);
@@ -1692,7 +1684,8 @@ unsigned int FBXConverter::ConvertVideo(const Video &video) {
     out_tex->mHeight = 0; // fixed to 0
 
     // steal the data from the Video to avoid an additional copy
-    out_tex->pcData = reinterpret_cast<aiTexel *>(const_cast<Video &>(video).RelinquishContent());
+    out_tex->pcData = reinterpret_cast<aiTexel *>(AdoptSceneArray(const_cast<Video &>(video).RelinquishContent(),
+            static_cast<size_t>(video.ContentLength())));
 
     // try to extract a hint from the file extension
     const std::string &filename = video.RelativeFilename().empty() ? video.FileName() : video.RelativeFilename();
@@ -1808,7 +1801,7 @@ void FBXConverter::TrySetTextureProperties(aiMaterial *out_mat, const TextureMap
 
                         int index = -1;
                         for (unsigned int i = 0; i < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++i) {
-                            if (meshGeom->GetTextureCoords(i).empty()) {
+                            if (!meshGeom->HasTextureCoords(i)) {
                                 break;
                             }
                             const std::string &name = meshGeom->GetTextureCoordChannelName(i);
@@ -1832,7 +1825,7 @@ void FBXConverter::TrySetTextureProperties(aiMaterial *out_mat, const TextureMap
                 } else {
                     int index = -1;
                     for (unsigned int i = 0; i < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++i) {
-                        if (mesh->GetTextureCoords(i).empty()) {
+                        if (!mesh->HasTextureCoords(i)) {
                             break;
                         }
                         const std::string &name = mesh->GetTextureCoordChannelName(i);
@@ -1928,7 +1921,7 @@ void FBXConverter::TrySetTextureProperties(aiMaterial *out_mat, const LayeredTex
 
                         int index = -1;
                         for (unsigned int i = 0; i < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++i) {
-                            if (meshGeom->GetTextureCoords(i).empty()) {
+                            if (!meshGeom->HasTextureCoords(i)) {
                                 break;
                             }
                             const std::string &name = meshGeom->GetTextureCoordChannelName(i);
@@ -1952,7 +1945,7 @@ void FBXConverter::TrySetTextureProperties(aiMaterial *out_mat, const LayeredTex
                 } else {
                     int index = -1;
                     for (unsigned int i = 0; i < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++i) {
-                        if (mesh->GetTextureCoords(i).empty()) {
+                        if (!mesh->HasTextureCoords(i)) {
                             break;
                         }
                         const std::string &name = mesh->GetTextureCoordChannelName(i);
@@ -2365,7 +2358,7 @@ void FBXConverter::SetShadingPropertiesRaw(aiMaterial *out_mat, const PropertyTa
 
                             int index = -1;
                             for (unsigned int i = 0; i < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++i) {
-                                if (meshGeom->GetTextureCoords(i).empty()) {
+                                if (!meshGeom->HasTextureCoords(i)) {
                                     break;
                                 }
                                 const std::string &curName = meshGeom->GetTextureCoordChannelName(i);
@@ -2388,7 +2381,7 @@ void FBXConverter::SetShadingPropertiesRaw(aiMaterial *out_mat, const PropertyTa
                     } else {
                         int index = -1;
                         for (unsigned int i = 0; i < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++i) {
-                            if (mesh->GetTextureCoords(i).empty()) {
+                            if (!mesh->HasTextureCoords(i)) {
                                 break;
                             }
                             const std::string &curName = mesh->GetTextureCoordChannelName(i);
@@ -2593,13 +2586,13 @@ void FBXConverter::ConvertAnimationStack(const AnimationStack &st) {
 
     if (node_anims.size() || morphAnimDatas.size()) {
         if (node_anims.size()) {
-            anim->mChannels = new aiNodeAnim *[node_anims.size()]();
+            anim->mChannels = AllocateSceneArray<aiNodeAnim *>(node_anims.size(), nullptr);
             anim->mNumChannels = static_cast<unsigned int>(node_anims.size());
             std::swap_ranges(node_anims.begin(), node_anims.end(), anim->mChannels);
         }
         if (morphAnimDatas.size()) {
             unsigned int numMorphMeshChannels = static_cast<unsigned int>(morphAnimDatas.size());
-            anim->mMorphMeshChannels = new aiMeshMorphAnim *[numMorphMeshChannels];
+            anim->mMorphMeshChannels = AllocateSceneArray<aiMeshMorphAnim *>(numMorphMeshChannels);
             anim->mNumMorphMeshChannels = numMorphMeshChannels;
             unsigned int i = 0;
             for (const auto &morphAnimIt : morphAnimDatas) {
@@ -2614,8 +2607,8 @@ void FBXConverter::ConvertAnimationStack(const AnimationStack &st) {
                     morphKeyData *keyData = animIt.second;
                     unsigned int numValuesAndWeights = static_cast<unsigned int>(keyData->values.size());
                     meshMorphAnim->mKeys[j].mNumValuesAndWeights = numValuesAndWeights;
-                    meshMorphAnim->mKeys[j].mValues = new unsigned int[numValuesAndWeights];
-                    meshMorphAnim->mKeys[j].mWeights = new double[numValuesAndWeights];
+                    meshMorphAnim->mKeys[j].mValues = AllocateSceneArray<unsigned int>(numValuesAndWeights);
+                    meshMorphAnim->mKeys[j].mWeights = AllocateSceneArray<double>(numValuesAndWeights);
                     meshMorphAnim->mKeys[j].mTime = CONVERT_FBX_TIME(animIt.first);
                     for (unsigned int k = 0; k < numValuesAndWeights; k++) {
                         meshMorphAnim->mKeys[j].mValues[k] = keyData->values.at(k);
@@ -3511,42 +3504,42 @@ void FBXConverter::TransferDataToScene() {
     // confusion why this code works.
 
     if (!mMeshes.empty()) {
-        mSceneOut->mMeshes = new aiMesh *[mMeshes.size()]();
+        mSceneOut->mMeshes = AllocateSceneArray<aiMesh *>(mMeshes.size(), nullptr);
         mSceneOut->mNumMeshes = static_cast<unsigned int>(mMeshes.size());
 
         std::swap_ranges(mMeshes.begin(), mMeshes.end(), mSceneOut->mMeshes);
     }
 
     if (!materials.empty()) {
-        mSceneOut->mMaterials = new aiMaterial *[materials.size()]();
+        mSceneOut->mMaterials = AllocateSceneArray<aiMaterial *>(materials.size(), nullptr);
         mSceneOut->mNumMaterials = static_cast<unsigned int>(materials.size());
 
         std::swap_ranges(materials.begin(), materials.end(), mSceneOut->mMaterials);
     }
 
     if (!animations.empty()) {
-        mSceneOut->mAnimations = new aiAnimation *[animations.size()]();
+        mSceneOut->mAnimations = AllocateSceneArray<aiAnimation *>(animations.size(), nullptr);
         mSceneOut->mNumAnimations = static_cast<unsigned int>(animations.size());
 
         std::swap_ranges(animations.begin(), animations.end(), mSceneOut->mAnimations);
     }
 
     if (!lights.empty()) {
-        mSceneOut->mLights = new aiLight *[lights.size()]();
+        mSceneOut->mLights = AllocateSceneArray<aiLight *>(lights.size(), nullptr);
         mSceneOut->mNumLights = static_cast<unsigned int>(lights.size());
 
         std::swap_ranges(lights.begin(), lights.end(), mSceneOut->mLights);
     }
 
     if (!cameras.empty()) {
-        mSceneOut->mCameras = new aiCamera *[cameras.size()]();
+        mSceneOut->mCameras = AllocateSceneArray<aiCamera *>(cameras.size(), nullptr);
         mSceneOut->mNumCameras = static_cast<unsigned int>(cameras.size());
 
         std::swap_ranges(cameras.begin(), cameras.end(), mSceneOut->mCameras);
     }
 
     if (!textures.empty()) {
-        mSceneOut->mTextures = new aiTexture *[textures.size()]();
+        mSceneOut->mTextures = AllocateSceneArray<aiTexture *>(textures.size(), nullptr);
         mSceneOut->mNumTextures = static_cast<unsigned int>(textures.size());
 
         std::swap_ranges(textures.begin(), textures.end(), mSceneOut->mTextures);
@@ -3587,8 +3580,26 @@ void FBXConverter::ConvertOrphanedEmbeddedTextures() {
 }
 
 // ------------------------------------------------------------------------------------------------
-void ConvertToAssimpScene(aiScene *out, const Document &doc, bool removeEmptyBones) {
-    FBXConverter converter(out, doc, removeEmptyBones);
+void ConvertToAssimpScene(aiScene *out, const Document &doc, bool removeEmptyBones,
+        std::vector<DeferredMesh> *deferredMeshes) {
+    FBXConverter converter(out, doc, removeEmptyBones, deferredMeshes);
+}
+
+// ------------------------------------------------------------------------------------------------
+void ConvertDeferredMesh(aiMesh *out, const Document &doc, const DeferredMesh &mesh) {
+    ai_assert(nullptr != mesh.geometry);
+
+    // read the geometry again, this time with all of its vertex data
+    const MeshGeometry geometry(mesh.geometry->ID(), mesh.geometry->SourceElement(),
+            mesh.geometry->Name(), doc);
+
+    unsigned int count_faces = 0, count_vertices = 0, primitive_types = 0;
+    CountMeshData(geometry, mesh.separateMaterials, mesh.materialIndex, count_faces, count_vertices, primitive_types);
+    if (0 == count_faces || geometry.GetVertices().empty()) {
+        FBXImporter::ThrowException("geometry ", geometry.Name(), " has changed since it was imported");
+    }
+
+    FillMeshData(out, geometry, mesh.separateMaterials, mesh.materialIndex, nullptr, nullptr);
 }
 
 } // namespace FBX
@@ -76,13 +76,31 @@ namespace Assimp {
 namespace FBX {
 
 class Document;
+
+/** Record of a mesh converted from geometry which was read without its vertex
+ *  data (see ImportSettings::deferMeshData), geometry is nullptr for meshes
+ *  which were converted completely */
+struct DeferredMesh {
+    const MeshGeometry *geometry;
+    bool separateMaterials;
+    MatIndexArray::value_type materialIndex;
+};
 /** 
  *  Convert a FBX #Document to #aiScene
  *  @param out Empty scene to be populated
  *  @param doc Parsed FBX document
  *  @param removeEmptyBones Will remove bones, which do not have any references to vertices.
  */
-void ConvertToAssimpScene(aiScene* out, const Document& doc, bool removeEmptyBones);
+void ConvertToAssimpScene(aiScene* out, const Document& doc, bool removeEmptyBones,
+        std::vector<DeferredMesh> *deferredMeshes = nullptr);
+
+/**
+ *  Fill a mesh which was converted without its data, see #DeferredMesh
+ *  @param out Mesh without vertex and face data
+ *  @param doc The FBX document the mesh was converted from
+ *  @param mesh The record the conversion left for the mesh
+ */
+void ConvertDeferredMesh(aiMesh* out, const Document& doc, const DeferredMesh& mesh);
 
 /** Dummy class to encapsulate the conversion process */
 class FBXConverter {
@@ -113,7 +131,8 @@ public:
     };
 
 public:
-    FBXConverter(aiScene* out, const Document& doc, bool removeEmptyBones);
+    FBXConverter(aiScene* out, const Document& doc, bool removeEmptyBones,
+            std::vector<DeferredMesh> *deferredMeshes = nullptr);
     ~FBXConverter();
 
 private:
@@ -189,6 +208,11 @@ private:
     ConvertMesh(const MeshGeometry &mesh, const Model &model, aiNode *parent, aiNode *root_node,
                 const aiMatrix4x4 &absolute_transform);
 
+    // ------------------------------------------------------------------------------------------------
+    // Header-only MeshGeometry -> aiMesh without data, one per material if separate is set
+    std::vector<unsigned int> ConvertMeshHeaders(const MeshGeometry &mesh, const Model &model, aiNode *parent,
+                                                 bool separate);
+
     // ------------------------------------------------------------------------------------------------
     std::vector<unsigned int> ConvertLine(const LineGeometry& line, aiNode *root_node);
 
@@ -452,6 +476,7 @@ private:
     aiScene* const mSceneOut;
     const FBX::Document& doc;
     bool mRemoveEmptyBones;
+    std::vector<DeferredMesh> *mDeferredMeshes;
     static void BuildBoneList(aiNode *current_node, const aiNode *root_node, const aiScene *scene,
                              std::vector<aiBone*>& bones);
 
@@ -97,8 +97,8 @@ Cluster::Cluster(uint64_t id, const Element& element, const Document& doc, const
     }
 
     if(Indexes) {
-        ParseVectorDataArray(indices,*Indexes);
-        ParseVectorDataArray(weights,*Weights);
+        ParseVectorDataArray(indices,*Indexes,reserved);
+        ParseVectorDataArray(weights,*Weights,reserved);
     }
 
     if(indices.size() != weights.size()) {
@@ -189,7 +189,7 @@ BlendShapeChannel::BlendShapeChannel(uint64_t id, const Element& element, const
     }
     const Element* const FullWeights = sc["FullWeights"];
     if (FullWeights) {
-        ParseVectorDataArray(fullWeights, *FullWeights);
+        ParseVectorDataArray(fullWeights, *FullWeights, reserved);
     }
     const std::vector<const Connection*>& conns = doc.GetConnectionsByDestinationSequenced(ID(), "Geometry");
     shapeGeometries.reserve(conns.size());
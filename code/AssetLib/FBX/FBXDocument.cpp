@@ -138,7 +138,7 @@ const Object* LazyObject::Get(bool dieOnError)
 
         if (!strncmp(obtype,"Geometry",length)) {
             if (!strcmp(classtag.c_str(),"Mesh")) {
-                object.reset(new MeshGeometry(id,element,name,doc));
+                object.reset(new MeshGeometry(id,element,name,doc,doc.Settings().deferMeshData));
             }
             if (!strcmp(classtag.c_str(), "Shape")) {
                 object.reset(new ShapeGeometry(id, element, name, doc));
@@ -724,6 +724,9 @@ private:
     KeyValueList values;
     std::vector<float> attributes;
     std::vector<unsigned int> flags;
+
+    // charge of the arrays to the memory budget of the import
+    ImportLimits::Reservation reserved;
 };
 
 // property-name -> animation curve
@@ -870,6 +873,7 @@ private:
     float percent;
     WeightArray fullWeights;
     std::vector<const ShapeGeometry*> shapeGeometries;
+    ImportLimits::Reservation reserved;
 };
 
 /** DOM class for BlendShape deformers */
@@ -924,6 +928,7 @@ public:
 private:
     WeightArray weights;
     WeightIndexArray indices;
+    ImportLimits::Reservation reserved;
 
     aiMatrix4x4 transform;
     aiMatrix4x4 transformLink;
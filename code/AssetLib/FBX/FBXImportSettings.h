@@ -64,7 +64,8 @@ struct ImportSettings {
             optimizeEmptyAnimationCurves(true),
             useLegacyEmbeddedTextureNaming(false),
             removeEmptyBones(true),
-            convertToMeters(false) {
+            convertToMeters(false),
+            deferMeshData(false) {
         // empty
     }
 
@@ -150,6 +151,12 @@ struct ImportSettings {
     /** Set to true to perform a conversion from cm to meter after the import
     */
     bool convertToMeters;
+
+    /** Read only the face layout and the material assignments of mesh
+     *  geometry, the converter then produces meshes without payload.
+     *  See #AI_CONFIG_IMPORT_DEFER_MESH_DATA.
+     */
+    bool deferMeshData;
 };
 
 } // namespace FBX
@@ -54,8 +54,10 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "FBXUtil.h"
 
 #include <assimp/MemoryIOWrapper.h>
+#include <assimp/Profiler.h>
 #include <assimp/StreamReader.h>
 #include <assimp/importerdesc.h>
+#include <assimp/scene.h>
 #include <assimp/Importer.hpp>
 
 namespace Assimp {
@@ -88,6 +90,25 @@ static const aiImporterDesc desc = {
 };
 }
 
+// ------------------------------------------------------------------------------------------------
+// Everything the tokens, the parse-tree and the DOM of a file refer to
+struct FBXImporter::DeferredDocument {
+	std::vector<char> contents;
+	TokenList tokens;
+	ImportLimits::Reservation reservedContents;
+	ImportLimits::Reservation reservedTokens;
+	std::unique_ptr<Parser> parser;
+	std::unique_ptr<Document> doc;
+	std::vector<DeferredMesh> meshes;
+
+	~DeferredDocument() {
+		// the DOM refers to the parse-tree, which refers to the tokens
+		doc.reset();
+		parser.reset();
+		std::for_each(tokens.begin(), tokens.end(), Util::delete_fun<Token>());
+	}
+};
+
 // ------------------------------------------------------------------------------------------------
 // Constructor to be privately used by #Importer
 FBXImporter::FBXImporter() {
@@ -98,6 +119,18 @@ FBXImporter::FBXImporter() {
 FBXImporter::~FBXImporter() {
 }
 
+// ------------------------------------------------------------------------------------------------
+// Whether skins or blend shapes deform any geometry of the file. The converter needs
+// the vertex data of such geometry, so the meshes of these files are never deferred.
+static bool HasDeformers(const Parser &parser) {
+	const Element *objects = parser.GetRootScope()["Objects"];
+	if (nullptr == objects || nullptr == objects->Compound()) {
+		return false;
+	}
+	const ElementCollection deformers = objects->Compound()->GetCollection("Deformer");
+	return deformers.first != deformers.second;
+}
+
 // ------------------------------------------------------------------------------------------------
 // Returns whether the class can handle the format of the given file.
 bool FBXImporter::CanRead(const std::string &pFile, IOSystem *pIOHandler, bool checkSig) const {
@@ -157,52 +190,83 @@ void FBXImporter::InternReadFile(const std::string &pFile, aiScene *pScene, IOSy
 	// then becomes very large, too. Assimp doesn't support
 	// streaming for its output data structures so the net win with
 	// streaming input data would be very low.
-	std::vector<char> contents;
-	contents.resize(stream->FileSize() + 1);
-	stream->Read(&*contents.begin(), 1, contents.size() - 1);
-	contents[contents.size() - 1] = 0;
-	const char *const begin = &*contents.begin();
+	// Binary files are tokenized in-place if the stream offers a view of the
+	// whole file, the tokens then point directly into the stream's memory.
+	// The tokens of a deferred scene outlive the stream, so its view is not used then.
+	std::unique_ptr<DeferredDocument> state(new DeferredDocument);
+	std::vector<char> &contents = state->contents;
+	const char *begin = reinterpret_cast<const char *>(stream->GetContiguousView());
+	size_t length = stream->FileSize();
+	if (nullptr == begin || m_deferMeshData || length < 18 || strncmp(begin, "Kaydara FBX Binary", 18)) {
+		state->reservedContents.Add(length + 1, 1);
+		contents.resize(length + 1);
+		stream->Read(&*contents.begin(), 1, contents.size() - 1);
+		contents[contents.size() - 1] = 0;
+		begin = &*contents.begin();
+		length = contents.size();
+	}
 
 	// broadphase tokenizing pass in which we identify the core
 	// syntax elements of FBX (brackets, commas, key:value mappings)
-	TokenList tokens;
-	try {
-
-		bool is_binary = false;
-		if (!strncmp(begin, "Kaydara FBX Binary", 18)) {
-			is_binary = true;
-			TokenizeBinary(tokens, begin, contents.size());
-		} else {
-			Tokenize(tokens, begin);
-		}
-
-		// use this information to construct a very rudimentary
-		// parse-tree representing the FBX scope structure
-		Parser parser(tokens, is_binary);
-
-		// take the raw parse-tree and convert it to a FBX DOM
-		Document doc(parser, settings);
-
-		// convert the FBX DOM to aiScene
-		ConvertToAssimpScene(pScene, doc, settings.removeEmptyBones);
-
-		// size relative to cm
-		float size_relative_to_cm = doc.GlobalSettings().UnitScaleFactor();
-        if (size_relative_to_cm == 0.0)
-        {
-			// BaseImporter later asserts that fileScale is non-zero.
-			ThrowException("The UnitScaleFactor must be non-zero");
-        }
-
-		// Set FBX file scale is relative to CM must be converted to M for
-		// assimp universal format (M)
-		SetFileScale(size_relative_to_cm * 0.01f);
+	TokenList &tokens = state->tokens;
+	Profiling::ScopedRegion phase(m_profiler, "tokenize");
+
+	bool is_binary = false;
+	if (!strncmp(begin, "Kaydara FBX Binary", 18)) {
+		is_binary = true;
+		TokenizeBinary(tokens, begin, length, state->reservedTokens);
+	} else {
+		Tokenize(tokens, begin, state->reservedTokens);
+	}
 
-		std::for_each(tokens.begin(), tokens.end(), Util::delete_fun<Token>());
-	} catch (std::exception &) {
-		std::for_each(tokens.begin(), tokens.end(), Util::delete_fun<Token>());
-		throw;
+	// use this information to construct a very rudimentary
+	// parse-tree representing the FBX scope structure
+	phase.Next("parse");
+	state->parser.reset(new Parser(tokens, is_binary));
+	settings.deferMeshData = m_deferMeshData && !HasDeformers(*state->parser);
+
+	// take the raw parse-tree and convert it to a FBX DOM
+	state->doc.reset(new Document(*state->parser, settings));
+	const Document &doc = *state->doc;
+
+	// convert the FBX DOM to aiScene
+	phase.Next("convert");
+	ConvertToAssimpScene(pScene, doc, settings.removeEmptyBones, &state->meshes);
+
+	// size relative to cm
+	float size_relative_to_cm = doc.GlobalSettings().UnitScaleFactor();
+	if (size_relative_to_cm == 0.0)
+	{
+		// BaseImporter later asserts that fileScale is non-zero.
+		ThrowException("The UnitScaleFactor must be non-zero");
+	}
+
+	// Set FBX file scale is relative to CM must be converted to M for
+	// assimp universal format (M)
+	SetFileScale(size_relative_to_cm * 0.01f);
+
+	// the geometry of deferred meshes is read again from the kept DOM
+	if (pScene->mFlags & AI_SCENE_FLAGS_DEFERRED_MESH_DATA) {
+		mDeferred = std::move(state);
+	}
+}
+
+// ------------------------------------------------------------------------------------------------
+// Converts one deferred mesh from the DOM kept by InternReadFile()
+void FBXImporter::InternReadMeshData(const std::string &, aiScene *pScene, unsigned int pMeshIndex, IOSystem *) {
+	if (!mDeferred || pMeshIndex >= pScene->mNumMeshes || pMeshIndex >= mDeferred->meshes.size() ||
+			nullptr == mDeferred->meshes[pMeshIndex].geometry) {
+		ThrowException("deferred mesh ", pMeshIndex, " does not exist");
 	}
+
+	aiMesh loaded;
+	ConvertDeferredMesh(&loaded, *mDeferred->doc, mDeferred->meshes[pMeshIndex]);
+	MoveMeshData(pScene->mMeshes[pMeshIndex], &loaded);
+}
+
+// ------------------------------------------------------------------------------------------------
+void FBXImporter::ReleaseDeferredData() {
+	mDeferred.reset();
 }
 
 #endif // !ASSIMP_BUILD_NO_FBX_IMPORTER
@@ -50,6 +50,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "FBXImportSettings.h"
 
+#include <memory>
+
 namespace Assimp {
 
 // TinyFormatter.h
@@ -77,6 +79,9 @@ public:
             IOSystem *pIOHandler,
             bool checkSig) const;
 
+    // --------------------
+    void ReleaseDeferredData();
+
 protected:
     // --------------------
     const aiImporterDesc *GetInfo() const;
@@ -89,8 +94,19 @@ protected:
             aiScene *pScene,
             IOSystem *pIOHandler);
 
+    // --------------------
+    void InternReadMeshData(const std::string &pFile,
+            aiScene *pScene,
+            unsigned int pMeshIndex,
+            IOSystem *pIOHandler);
+
 private:
     FBX::ImportSettings settings;
+
+    /** The file contents and the parsed document of a scene whose meshes
+     *  were converted without data, kept until ReleaseDeferredData() */
+    struct DeferredDocument;
+    std::unique_ptr<DeferredDocument> mDeferred;
 }; // !class FBXImporter
 
 } // end of namespace Assimp
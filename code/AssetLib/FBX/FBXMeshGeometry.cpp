@@ -95,9 +95,13 @@ const Skin* Geometry::DeformerSkin() const {
 }
 
 // ------------------------------------------------------------------------------------------------
-MeshGeometry::MeshGeometry(uint64_t id, const Element& element, const std::string& name, const Document& doc)
+MeshGeometry::MeshGeometry(uint64_t id, const Element& element, const std::string& name, const Document& doc,
+        bool headerOnly)
 : Geometry(id, element,name, doc)
+, m_headerOnly(headerOnly)
 {
+    std::fill(m_hasUVs, m_hasUVs + AI_MAX_NUMBER_OF_TEXTURECOORDS, false);
+
     const Scope* sc = element.Compound();
     if (!sc) {
         DOMError("failed to read Geometry object (class: Mesh), no data scope found");
@@ -110,20 +114,39 @@ MeshGeometry::MeshGeometry(uint64_t id, const Element& element, const std::strin
     // optional Mesh elements:
     const ElementCollection& Layer = sc->GetCollection("Layer");
 
-    std::vector<aiVector3D> tempVerts;
-    ParseVectorDataArray(tempVerts,Vertices);
-
-    if(tempVerts.empty()) {
-        FBXImporter::LogWarn("encountered mesh with no vertices");
-    }
-
+    ImportLimits::Reservation reserved_temp;
     std::vector<int> tempFaces;
-    ParseVectorDataArray(tempFaces,PolygonVertexIndex);
+    ParseVectorDataArray(tempFaces,PolygonVertexIndex,reserved_temp);
 
     if(tempFaces.empty()) {
         FBXImporter::LogWarn("encountered mesh with no faces");
     }
 
+    if (headerOnly) {
+        // the face sizes are all the converter needs besides the layers
+        m_reserved.Add(tempFaces.size() / 3, sizeof(unsigned int));
+        unsigned int count = 0;
+        for(int index : tempFaces) {
+            ++count;
+            if (index < 0) {
+                m_faces.push_back(count);
+                count = 0;
+            }
+        }
+        ReadLayers(Layer, doc);
+        return;
+    }
+
+    std::vector<aiVector3D> tempVerts;
+    ParseVectorDataArray(tempVerts,Vertices,reserved_temp);
+
+    if(tempVerts.empty()) {
+        FBXImporter::LogWarn("encountered mesh with no vertices");
+    }
+
+    m_reserved.Add(tempFaces.size(), sizeof(aiVector3D) + sizeof(unsigned int));
+    m_reserved.Add(tempFaces.size() / 3, sizeof(unsigned int));
+    m_reserved.Add(tempVerts.size(), 2 * sizeof(unsigned int));
     m_vertices.reserve(tempFaces.size());
     m_faces.reserve(tempFaces.size() / 3);
 
@@ -167,6 +190,12 @@ MeshGeometry::MeshGeometry(uint64_t id, const Element& element, const std::strin
         m_mappings[m_mapping_offsets[absi] + m_mapping_counts[absi]++] = cursor++;
     }
 
+    ReadLayers(Layer, doc);
+}
+
+// ------------------------------------------------------------------------------------------------
+void MeshGeometry::ReadLayers(const ElementCollection& Layer, const Document& doc)
+{
     // if settings.readAllLayers is true:
     //  * read all layers, try to load as many vertex channels as possible
     // if settings.readAllLayers is false:
@@ -230,6 +259,14 @@ std::string MeshGeometry::GetTextureCoordChannelName( unsigned int index ) const
     return index >= AI_MAX_NUMBER_OF_TEXTURECOORDS ? "" : m_uvNames[ index ];
 }
 
+bool MeshGeometry::HasTextureCoords( unsigned int index ) const {
+    return index < AI_MAX_NUMBER_OF_TEXTURECOORDS && (m_hasUVs[ index ] || !m_uvs[ index ].empty());
+}
+
+bool MeshGeometry::IsHeaderOnly() const {
+    return m_headerOnly;
+}
+
 const std::vector<aiColor4D>& MeshGeometry::GetVertexColors( unsigned int index ) const {
     static const std::vector<aiColor4D> empty;
     return index >= AI_MAX_NUMBER_OF_COLOR_SETS ? empty : m_colors[ index ];
@@ -335,6 +372,11 @@ void MeshGeometry::ReadVertexData(const std::string& type, int index, const Scop
             m_uvNames[index] = ParseTokenAsString(GetRequiredToken(*Name,0));
         }
 
+        if (m_headerOnly) {
+            m_hasUVs[index] = HasElement(source, "UV");
+            return;
+        }
+
         ReadVertexDataUV(m_uvs[index],source,
             MappingInformationType,
             ReferenceInformationType
@@ -367,6 +409,10 @@ void MeshGeometry::ReadVertexData(const std::string& type, int index, const Scop
 
         std::swap(temp_materials, m_materials);
     }
+    else if (m_headerOnly) {
+        // the vertex data is read once the mesh is needed
+        return;
+    }
     else if (type == "LayerElementNormal") {
         if (m_normals.size() > 0) {
             FBXImporter::LogError("ignoring additional normal layer");
@@ -427,7 +473,8 @@ void ResolveVertexDataArray(std::vector<T>& data_out, const Scope& source,
     size_t vertex_count,
     const std::vector<unsigned int>& mapping_counts,
     const std::vector<unsigned int>& mapping_offsets,
-    const std::vector<unsigned int>& mappings)
+    const std::vector<unsigned int>& mappings,
+    ImportLimits::Reservation& reserved)
 {
     bool isDirect = ReferenceInformationType == "Direct";
     bool isIndexToDirect = ReferenceInformationType == "IndexToDirect";
@@ -445,8 +492,9 @@ void ResolveVertexDataArray(std::vector<T>& data_out, const Scope& source,
         if (!HasElement(source, dataElementName)) {
             return;
         }
+        ImportLimits::Reservation reserved_temp;
         std::vector<T> tempData;
-        ParseVectorDataArray(tempData, GetRequiredElement(source, dataElementName));
+        ParseVectorDataArray(tempData, GetRequiredElement(source, dataElementName), reserved_temp);
 
         if (tempData.size() != mapping_offsets.size()) {
             FBXImporter::LogError("length of input data unexpected for ByVertice mapping: ",
@@ -454,6 +502,7 @@ void ResolveVertexDataArray(std::vector<T>& data_out, const Scope& source,
             return;
         }
 
+        reserved.Add(vertex_count, sizeof(T));
         data_out.resize(vertex_count);
         for (size_t i = 0, e = tempData.size(); i < e; ++i) {
             const unsigned int istart = mapping_offsets[i], iend = istart + mapping_counts[i];
@@ -463,11 +512,12 @@ void ResolveVertexDataArray(std::vector<T>& data_out, const Scope& source,
         }
     }
     else if (MappingInformationType == "ByVertice" && isIndexToDirect) {
+        ImportLimits::Reservation reserved_temp;
 		std::vector<T> tempData;
-		ParseVectorDataArray(tempData, GetRequiredElement(source, dataElementName));
+		ParseVectorDataArray(tempData, GetRequiredElement(source, dataElementName), reserved_temp);
 
         std::vector<int> uvIndices;
-        ParseVectorDataArray(uvIndices,GetRequiredElement(source,indexDataElementName));
+        ParseVectorDataArray(uvIndices,GetRequiredElement(source,indexDataElementName),reserved_temp);
 
         if (uvIndices.size() != vertex_count) {
             FBXImporter::LogError("length of input data unexpected for ByVertice mapping: ",
@@ -475,6 +525,7 @@ void ResolveVertexDataArray(std::vector<T>& data_out, const Scope& source,
             return;
         }
 
+        reserved.Add(vertex_count, sizeof(T));
         data_out.resize(vertex_count);
 
         for (size_t i = 0, e = uvIndices.size(); i < e; ++i) {
@@ -489,8 +540,9 @@ void ResolveVertexDataArray(std::vector<T>& data_out, const Scope& source,
         }
     }
     else if (MappingInformationType == "ByPolygonVertex" && isDirect) {
+        ImportLimits::Reservation reserved_temp;
 		std::vector<T> tempData;
-		ParseVectorDataArray(tempData, GetRequiredElement(source, dataElementName));
+		ParseVectorDataArray(tempData, GetRequiredElement(source, dataElementName), reserved_temp);
 
 		if (tempData.size() != vertex_count) {
             FBXImporter::LogError("length of input data unexpected for ByPolygon mapping: ",
@@ -499,14 +551,16 @@ void ResolveVertexDataArray(std::vector<T>& data_out, const Scope& source,
             return;
         }
 
+		reserved.Add(tempData.size(), sizeof(T));
 		data_out.swap(tempData);
     }
     else if (MappingInformationType == "ByPolygonVertex" && isIndexToDirect) {
+        ImportLimits::Reservation reserved_temp;
 		std::vector<T> tempData;
-		ParseVectorDataArray(tempData, GetRequiredElement(source, dataElementName));
+		ParseVectorDataArray(tempData, GetRequiredElement(source, dataElementName), reserved_temp);
 
         std::vector<int> uvIndices;
-        ParseVectorDataArray(uvIndices,GetRequiredElement(source,indexDataElementName));
+        ParseVectorDataArray(uvIndices,GetRequiredElement(source,indexDataElementName),reserved_temp);
 
         if (uvIndices.size() > vertex_count) {
             FBXImporter::LogWarn("trimming length of input array for ByPolygonVertex mapping: ",
@@ -520,6 +574,7 @@ void ResolveVertexDataArray(std::vector<T>& data_out, const Scope& source,
             return;
         }
 
+        reserved.Add(vertex_count, sizeof(T));
         data_out.resize(vertex_count);
 
         const T empty;
@@ -553,7 +608,8 @@ void MeshGeometry::ReadVertexDataNormals(std::vector<aiVector3D>& normals_out, c
         m_vertices.size(),
         m_mapping_counts,
         m_mapping_offsets,
-        m_mappings);
+        m_mappings,
+        m_reserved);
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -567,7 +623,8 @@ void MeshGeometry::ReadVertexDataUV(std::vector<aiVector2D>& uv_out, const Scope
         m_vertices.size(),
         m_mapping_counts,
         m_mapping_offsets,
-        m_mappings);
+        m_mappings,
+        m_reserved);
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -581,7 +638,8 @@ void MeshGeometry::ReadVertexDataColors(std::vector<aiColor4D>& colors_out, cons
         m_vertices.size(),
         m_mapping_counts,
         m_mapping_offsets,
-        m_mappings);
+        m_mappings,
+        m_reserved);
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -600,7 +658,8 @@ void MeshGeometry::ReadVertexDataTangents(std::vector<aiVector3D>& tangents_out,
         m_vertices.size(),
         m_mapping_counts,
         m_mapping_offsets,
-        m_mappings);
+        m_mappings,
+        m_reserved);
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -619,7 +678,8 @@ void MeshGeometry::ReadVertexDataBinormals(std::vector<aiVector3D>& binormals_ou
         m_vertices.size(),
         m_mapping_counts,
         m_mapping_offsets,
-        m_mappings);
+        m_mappings,
+        m_reserved);
 }
 
 
@@ -637,7 +697,7 @@ void MeshGeometry::ReadVertexDataMaterials(std::vector<int>& materials_out, cons
     // materials are handled separately. First of all, they are assigned per-face
     // and not per polyvert. Secondly, ReferenceInformationType=IndexToDirect
     // has a slightly different meaning for materials.
-    ParseVectorDataArray(materials_out,GetRequiredElement(source,"Materials"));
+    ParseVectorDataArray(materials_out,GetRequiredElement(source,"Materials"),m_reserved);
 
     if (MappingInformationType == "AllSame") {
         // easy - same material for all faces
@@ -649,7 +709,8 @@ void MeshGeometry::ReadVertexDataMaterials(std::vector<int>& materials_out, cons
             materials_out.clear();
         }
 
-        materials_out.resize(m_vertices.size());
+        m_reserved.Add(face_count, sizeof(int));
+        materials_out.resize(face_count);
         std::fill(materials_out.begin(), materials_out.end(), materials_out.at(0));
     } else if (MappingInformationType == "ByPolygon" && ReferenceInformationType == "IndexToDirect") {
         materials_out.resize(face_count);
@@ -675,9 +736,9 @@ ShapeGeometry::ShapeGeometry(uint64_t id, const Element& element, const std::str
     const Element& Indexes = GetRequiredElement(*sc, "Indexes", &element);
     const Element& Normals = GetRequiredElement(*sc, "Normals", &element);
     const Element& Vertices = GetRequiredElement(*sc, "Vertices", &element);
-    ParseVectorDataArray(m_indices, Indexes);
-    ParseVectorDataArray(m_vertices, Vertices);
-    ParseVectorDataArray(m_normals, Normals);
+    ParseVectorDataArray(m_indices, Indexes, m_reserved);
+    ParseVectorDataArray(m_vertices, Vertices, m_reserved);
+    ParseVectorDataArray(m_normals, Normals, m_reserved);
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -706,8 +767,8 @@ LineGeometry::LineGeometry(uint64_t id, const Element& element, const std::strin
     }
     const Element& Points = GetRequiredElement(*sc, "Points", &element);
     const Element& PointsIndex = GetRequiredElement(*sc, "PointsIndex", &element);
-    ParseVectorDataArray(m_vertices, Points);
-    ParseVectorDataArray(m_indices, PointsIndex);
+    ParseVectorDataArray(m_vertices, Points, m_reserved);
+    ParseVectorDataArray(m_indices, PointsIndex, m_reserved);
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -82,8 +82,10 @@ typedef std::vector<int> MatIndexArray;
 class MeshGeometry : public Geometry
 {
 public:
-    /** The class constructor */
-    MeshGeometry( uint64_t id, const Element& element, const std::string& name, const Document& doc );
+    /** The class constructor, reads only the faces, the material
+     *  assignments and the names of the UV channels if headerOnly is set */
+    MeshGeometry( uint64_t id, const Element& element, const std::string& name, const Document& doc,
+        bool headerOnly = false );
     
     /** The class destructor */
     virtual ~MeshGeometry();
@@ -116,6 +118,13 @@ public:
     *  the requested slot does not exist. */
     std::string GetTextureCoordChannelName( unsigned int index ) const;
 
+    /** Check whether a UV coordinate slot exists, also for geometry
+    *  which was read without its vertex data. */
+    bool HasTextureCoords( unsigned int index ) const;
+
+    /** Check whether only the faces and material assignments were read */
+    bool IsHeaderOnly() const;
+
     /** Get a vertex color coordinate slot, returns an empty array if
     *  the requested slot does not exist. */
     const std::vector<aiColor4D>& GetVertexColors( unsigned int index ) const;
@@ -131,6 +140,7 @@ public:
     *  This mapping is always unique. */
     unsigned int FaceForVertexIndex( unsigned int in_index ) const;
 private:
+    void ReadLayers( const ElementCollection& Layer, const Document& doc );
     void ReadLayer( const Scope& layer );
     void ReadLayerElement( const Scope& layerElement );
     void ReadVertexData( const std::string& type, int index, const Scope& source );
@@ -176,6 +186,12 @@ private:
     std::vector<unsigned int> m_mapping_counts;
     std::vector<unsigned int> m_mapping_offsets;
     std::vector<unsigned int> m_mappings;
+
+    // charge of the cached data arrays to the memory budget of the import
+    ImportLimits::Reservation m_reserved;
+
+    bool m_headerOnly;
+    bool m_hasUVs[ AI_MAX_NUMBER_OF_TEXTURECOORDS ];
 };
 
 /**
@@ -204,6 +220,7 @@ private:
     std::vector<aiVector3D> m_vertices;
     std::vector<aiVector3D> m_normals;
     std::vector<unsigned int> m_indices;
+    ImportLimits::Reservation m_reserved;
 };
 /**
 *  DOM class for FBX geometry of type "Line"
@@ -226,6 +243,7 @@ public:
 private:
     std::vector<aiVector3D> m_vertices;
     std::vector<int> m_indices;
+    ImportLimits::Reservation m_reserved;
 };
 
 }
@@ -59,6 +59,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/ParsingUtils.h>
 #include <assimp/fast_atof.h>
 #include <assimp/ByteSwapper.h>
+#include <assimp/ImportLimits.h>
 #include <assimp/DefaultLogger.hpp>
 
 #include <iostream>
@@ -523,7 +524,7 @@ void ReadBinaryDataArrayHead(const char*& data, const char* end, char& type, uin
 // ------------------------------------------------------------------------------------------------
 // read binary data array, assume cursor points to the 'compression mode' field (i.e. behind the header)
 void ReadBinaryDataArray(char type, uint32_t count, const char*& data, const char* end,
-    std::vector<char>& buff,
+    std::vector<char>& buff, ImportLimits::Reservation& reserved_buff,
     const Element& /*el*/)
 {
     BE_NCONST uint32_t encmode = SafeParse<uint32_t>(data, end);
@@ -555,6 +556,7 @@ void ReadBinaryDataArray(char type, uint32_t count, const char*& data, const cha
             ai_assert(false);
     };
 
+    reserved_buff.Add(count, stride);
     const uint32_t full_length = stride * count;
     buff.resize(full_length);
 
@@ -609,7 +611,7 @@ void ReadBinaryDataArray(char type, uint32_t count, const char*& data, const cha
 
 // ------------------------------------------------------------------------------------------------
 // read an array of float3 tuples
-void ParseVectorDataArray(std::vector<aiVector3D>& out, const Element& el)
+void ParseVectorDataArray(std::vector<aiVector3D>& out, const Element& el, ImportLimits::Reservation& reserved)
 {
     out.resize( 0 );
 
@@ -638,7 +640,8 @@ void ParseVectorDataArray(std::vector<aiVector3D>& out, const Element& el)
         }
 
         std::vector<char> buff;
-        ReadBinaryDataArray(type, count, data, end, buff, el);
+        ImportLimits::Reservation reserved_buff;
+        ReadBinaryDataArray(type, count, data, end, buff, reserved_buff, el);
 
         ai_assert(data == end);
         uint64_t dataToRead = static_cast<uint64_t>(count) * (type == 'd' ? 8 : 4);
@@ -648,6 +651,7 @@ void ParseVectorDataArray(std::vector<aiVector3D>& out, const Element& el)
         }
 
         const uint32_t count3 = count / 3;
+        reserved.Add(count3, sizeof(out[0]));
         out.reserve(count3);
 
         if (type == 'd') {
@@ -680,6 +684,7 @@ void ParseVectorDataArray(std::vector<aiVector3D>& out, const Element& el)
     // may throw bad_alloc if the input is rubbish, but this need
     // not to be prevented - importing would fail but we wouldn't
     // crash since assimp handles this case properly.
+    reserved.Add(dim, sizeof(out[0]));
     out.reserve(dim);
 
     const Scope& scope = GetRequiredScope(el);
@@ -701,7 +706,7 @@ void ParseVectorDataArray(std::vector<aiVector3D>& out, const Element& el)
 
 // ------------------------------------------------------------------------------------------------
 // read an array of color4 tuples
-void ParseVectorDataArray(std::vector<aiColor4D>& out, const Element& el)
+void ParseVectorDataArray(std::vector<aiColor4D>& out, const Element& el, ImportLimits::Reservation& reserved)
 {
     out.resize( 0 );
     const TokenList& tok = el.Tokens();
@@ -729,7 +734,8 @@ void ParseVectorDataArray(std::vector<aiColor4D>& out, const Element& el)
         }
 
         std::vector<char> buff;
-        ReadBinaryDataArray(type, count, data, end, buff, el);
+        ImportLimits::Reservation reserved_buff;
+        ReadBinaryDataArray(type, count, data, end, buff, reserved_buff, el);
 
         ai_assert(data == end);
         uint64_t dataToRead = static_cast<uint64_t>(count) * (type == 'd' ? 8 : 4);
@@ -739,6 +745,7 @@ void ParseVectorDataArray(std::vector<aiColor4D>& out, const Element& el)
         }
 
         const uint32_t count4 = count / 4;
+        reserved.Add(count4, sizeof(out[0]));
         out.reserve(count4);
 
         if (type == 'd') {
@@ -762,6 +769,7 @@ void ParseVectorDataArray(std::vector<aiColor4D>& out, const Element& el)
     const size_t dim = ParseTokenAsDim(*tok[0]);
 
     //  see notes in ParseVectorDataArray() above
+    reserved.Add(dim, sizeof(out[0]));
     out.reserve(dim);
 
     const Scope& scope = GetRequiredScope(el);
@@ -784,7 +792,7 @@ void ParseVectorDataArray(std::vector<aiColor4D>& out, const Element& el)
 
 // ------------------------------------------------------------------------------------------------
 // read an array of float2 tuples
-void ParseVectorDataArray(std::vector<aiVector2D>& out, const Element& el)
+void ParseVectorDataArray(std::vector<aiVector2D>& out, const Element& el, ImportLimits::Reservation& reserved)
 {
     out.resize( 0 );
     const TokenList& tok = el.Tokens();
@@ -812,7 +820,8 @@ void ParseVectorDataArray(std::vector<aiVector2D>& out, const Element& el)
         }
 
         std::vector<char> buff;
-        ReadBinaryDataArray(type, count, data, end, buff, el);
+        ImportLimits::Reservation reserved_buff;
+        ReadBinaryDataArray(type, count, data, end, buff, reserved_buff, el);
 
         ai_assert(data == end);
         uint64_t dataToRead = static_cast<uint64_t>(count) * (type == 'd' ? 8 : 4);
@@ -822,6 +831,7 @@ void ParseVectorDataArray(std::vector<aiVector2D>& out, const Element& el)
         }
 
         const uint32_t count2 = count / 2;
+        reserved.Add(count2, sizeof(out[0]));
         out.reserve(count2);
 
         if (type == 'd') {
@@ -844,6 +854,7 @@ void ParseVectorDataArray(std::vector<aiVector2D>& out, const Element& el)
     const size_t dim = ParseTokenAsDim(*tok[0]);
 
     // see notes in ParseVectorDataArray() above
+    reserved.Add(dim, sizeof(out[0]));
     out.reserve(dim);
 
     const Scope& scope = GetRequiredScope(el);
@@ -864,7 +875,7 @@ void ParseVectorDataArray(std::vector<aiVector2D>& out, const Element& el)
 
 // ------------------------------------------------------------------------------------------------
 // read an array of ints
-void ParseVectorDataArray(std::vector<int>& out, const Element& el)
+void ParseVectorDataArray(std::vector<int>& out, const Element& el, ImportLimits::Reservation& reserved)
 {
     out.resize( 0 );
     const TokenList& tok = el.Tokens();
@@ -888,7 +899,8 @@ void ParseVectorDataArray(std::vector<int>& out, const Element& el)
         }
 
         std::vector<char> buff;
-        ReadBinaryDataArray(type, count, data, end, buff, el);
+        ImportLimits::Reservation reserved_buff;
+        ReadBinaryDataArray(type, count, data, end, buff, reserved_buff, el);
 
         ai_assert(data == end);
         uint64_t dataToRead = static_cast<uint64_t>(count) * 4;
@@ -897,6 +909,8 @@ void ParseVectorDataArray(std::vector<int>& out, const Element& el)
             ParseError("Invalid read size (binary)",&el);
         }
 
+        reserved.Add(count, sizeof(out[0]));
+
         out.reserve(count);
 
         const int32_t* ip = reinterpret_cast<const int32_t*>(&buff[0]);
@@ -912,6 +926,7 @@ void ParseVectorDataArray(std::vector<int>& out, const Element& el)
     const size_t dim = ParseTokenAsDim(*tok[0]);
 
     // see notes in ParseVectorDataArray()
+    reserved.Add(dim, sizeof(out[0]));
     out.reserve(dim);
 
     const Scope& scope = GetRequiredScope(el);
@@ -926,7 +941,7 @@ void ParseVectorDataArray(std::vector<int>& out, const Element& el)
 
 // ------------------------------------------------------------------------------------------------
 // read an array of floats
-void ParseVectorDataArray(std::vector<float>& out, const Element& el)
+void ParseVectorDataArray(std::vector<float>& out, const Element& el, ImportLimits::Reservation& reserved)
 {
     out.resize( 0 );
     const TokenList& tok = el.Tokens();
@@ -950,7 +965,8 @@ void ParseVectorDataArray(std::vector<float>& out, const Element& el)
         }
 
         std::vector<char> buff;
-        ReadBinaryDataArray(type, count, data, end, buff, el);
+        ImportLimits::Reservation reserved_buff;
+        ReadBinaryDataArray(type, count, data, end, buff, reserved_buff, el);
 
         ai_assert(data == end);
         uint64_t dataToRead = static_cast<uint64_t>(count) * (type == 'd' ? 8 : 4);
@@ -959,6 +975,9 @@ void ParseVectorDataArray(std::vector<float>& out, const Element& el)
             ParseError("Invalid read size (binary)",&el);
         }
 
+        reserved.Add(count, sizeof(out[0]));
+        out.reserve(count);
+
         if (type == 'd') {
             const double* d = reinterpret_cast<const double*>(&buff[0]);
             for (unsigned int i = 0; i < count; ++i, ++d) {
@@ -978,6 +997,7 @@ void ParseVectorDataArray(std::vector<float>& out, const Element& el)
     const size_t dim = ParseTokenAsDim(*tok[0]);
 
     // see notes in ParseVectorDataArray()
+    reserved.Add(dim, sizeof(out[0]));
     out.reserve(dim);
 
     const Scope& scope = GetRequiredScope(el);
@@ -991,7 +1011,7 @@ void ParseVectorDataArray(std::vector<float>& out, const Element& el)
 
 // ------------------------------------------------------------------------------------------------
 // read an array of uints
-void ParseVectorDataArray(std::vector<unsigned int>& out, const Element& el)
+void ParseVectorDataArray(std::vector<unsigned int>& out, const Element& el, ImportLimits::Reservation& reserved)
 {
     out.resize( 0 );
     const TokenList& tok = el.Tokens();
@@ -1015,7 +1035,8 @@ void ParseVectorDataArray(std::vector<unsigned int>& out, const Element& el)
         }
 
         std::vector<char> buff;
-        ReadBinaryDataArray(type, count, data, end, buff, el);
+        ImportLimits::Reservation reserved_buff;
+        ReadBinaryDataArray(type, count, data, end, buff, reserved_buff, el);
 
         ai_assert(data == end);
         uint64_t dataToRead = static_cast<uint64_t>(count) * 4;
@@ -1024,6 +1045,8 @@ void ParseVectorDataArray(std::vector<unsigned int>& out, const Element& el)
             ParseError("Invalid read size (binary)",&el);
         }
 
+        reserved.Add(count, sizeof(out[0]));
+
         out.reserve(count);
 
         const int32_t* ip = reinterpret_cast<const int32_t*>(&buff[0]);
@@ -1043,6 +1066,7 @@ void ParseVectorDataArray(std::vector<unsigned int>& out, const Element& el)
     const size_t dim = ParseTokenAsDim(*tok[0]);
 
     // see notes in ParseVectorDataArray()
+    reserved.Add(dim, sizeof(out[0]));
     out.reserve(dim);
 
     const Scope& scope = GetRequiredScope(el);
@@ -1060,7 +1084,7 @@ void ParseVectorDataArray(std::vector<unsigned int>& out, const Element& el)
 
 // ------------------------------------------------------------------------------------------------
 // read an array of uint64_ts
-void ParseVectorDataArray(std::vector<uint64_t>& out, const Element& el)
+void ParseVectorDataArray(std::vector<uint64_t>& out, const Element& el, ImportLimits::Reservation& reserved)
 {
     out.resize( 0 );
     const TokenList& tok = el.Tokens();
@@ -1084,7 +1108,8 @@ void ParseVectorDataArray(std::vector<uint64_t>& out, const Element& el)
         }
 
         std::vector<char> buff;
-        ReadBinaryDataArray(type, count, data, end, buff, el);
+        ImportLimits::Reservation reserved_buff;
+        ReadBinaryDataArray(type, count, data, end, buff, reserved_buff, el);
 
         ai_assert(data == end);
         uint64_t dataToRead = static_cast<uint64_t>(count) * 8;
@@ -1093,6 +1118,8 @@ void ParseVectorDataArray(std::vector<uint64_t>& out, const Element& el)
             ParseError("Invalid read size (binary)",&el);
         }
 
+        reserved.Add(count, sizeof(out[0]));
+
         out.reserve(count);
 
         const uint64_t* ip = reinterpret_cast<const uint64_t*>(&buff[0]);
@@ -1108,6 +1135,7 @@ void ParseVectorDataArray(std::vector<uint64_t>& out, const Element& el)
     const size_t dim = ParseTokenAsDim(*tok[0]);
 
     // see notes in ParseVectorDataArray()
+    reserved.Add(dim, sizeof(out[0]));
     out.reserve(dim);
 
     const Scope& scope = GetRequiredScope(el);
@@ -1122,7 +1150,7 @@ void ParseVectorDataArray(std::vector<uint64_t>& out, const Element& el)
 
 // ------------------------------------------------------------------------------------------------
 // read an array of int64_ts
-void ParseVectorDataArray(std::vector<int64_t>& out, const Element& el)
+void ParseVectorDataArray(std::vector<int64_t>& out, const Element& el, ImportLimits::Reservation& reserved)
 {
     out.resize( 0 );
     const TokenList& tok = el.Tokens();
@@ -1146,7 +1174,8 @@ void ParseVectorDataArray(std::vector<int64_t>& out, const Element& el)
         }
 
         std::vector<char> buff;
-        ReadBinaryDataArray(type, count, data, end, buff, el);
+        ImportLimits::Reservation reserved_buff;
+        ReadBinaryDataArray(type, count, data, end, buff, reserved_buff, el);
 
         ai_assert(data == end);
         uint64_t dataToRead = static_cast<uint64_t>(count) * 8;
@@ -1155,6 +1184,8 @@ void ParseVectorDataArray(std::vector<int64_t>& out, const Element& el)
             ParseError("Invalid read size (binary)",&el);
         }
 
+        reserved.Add(count, sizeof(out[0]));
+
         out.reserve(count);
 
         const int64_t* ip = reinterpret_cast<const int64_t*>(&buff[0]);
@@ -1170,6 +1201,7 @@ void ParseVectorDataArray(std::vector<int64_t>& out, const Element& el)
     const size_t dim = ParseTokenAsDim(*tok[0]);
 
     // see notes in ParseVectorDataArray()
+    reserved.Add(dim, sizeof(out[0]));
     out.reserve(dim);
 
     const Scope& scope = GetRequiredScope(el);
@@ -1185,8 +1217,9 @@ void ParseVectorDataArray(std::vector<int64_t>& out, const Element& el)
 // ------------------------------------------------------------------------------------------------
 aiMatrix4x4 ReadMatrix(const Element& element)
 {
+    ImportLimits::Reservation reserved;
     std::vector<float> values;
-    ParseVectorDataArray(values,element);
+    ParseVectorDataArray(values,element,reserved);
 
     if(values.size() != 16) {
         ParseError("expected 16 matrix elements");
@@ -49,6 +49,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <map>
 #include <memory>
 #include <vector>
+#include <assimp/ImportLimits.h>
 #include <assimp/LogAux.h>
 #include <assimp/fast_atof.h>
 
@@ -206,15 +207,15 @@ int ParseTokenAsInt(const Token& t);
 int64_t ParseTokenAsInt64(const Token& t);
 std::string ParseTokenAsString(const Token& t);
 
-/* read data arrays */
-void ParseVectorDataArray(std::vector<aiVector3D>& out, const Element& el);
-void ParseVectorDataArray(std::vector<aiColor4D>& out, const Element& el);
-void ParseVectorDataArray(std::vector<aiVector2D>& out, const Element& el);
-void ParseVectorDataArray(std::vector<int>& out, const Element& el);
-void ParseVectorDataArray(std::vector<float>& out, const Element& el);
-void ParseVectorDataArray(std::vector<unsigned int>& out, const Element& el);
-void ParseVectorDataArray(std::vector<uint64_t>& out, const Element& e);
-void ParseVectorDataArray(std::vector<int64_t>& out, const Element& el);
+/* read data arrays, the storage of out is charged to reserved */
+void ParseVectorDataArray(std::vector<aiVector3D>& out, const Element& el, ImportLimits::Reservation& reserved);
+void ParseVectorDataArray(std::vector<aiColor4D>& out, const Element& el, ImportLimits::Reservation& reserved);
+void ParseVectorDataArray(std::vector<aiVector2D>& out, const Element& el, ImportLimits::Reservation& reserved);
+void ParseVectorDataArray(std::vector<int>& out, const Element& el, ImportLimits::Reservation& reserved);
+void ParseVectorDataArray(std::vector<float>& out, const Element& el, ImportLimits::Reservation& reserved);
+void ParseVectorDataArray(std::vector<unsigned int>& out, const Element& el, ImportLimits::Reservation& reserved);
+void ParseVectorDataArray(std::vector<uint64_t>& out, const Element& e, ImportLimits::Reservation& reserved);
+void ParseVectorDataArray(std::vector<int64_t>& out, const Element& el, ImportLimits::Reservation& reserved);
 
 bool HasElement( const Scope& sc, const std::string& index );
 
@@ -54,6 +54,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "FBXTokenizer.h"
 #include "FBXUtil.h"
 #include <assimp/Exceptional.h>
+#include <assimp/ImportLimits.h>
 #include <assimp/DefaultLogger.hpp>
 
 namespace Assimp {
@@ -133,7 +134,7 @@ void ProcessDataToken( TokenList& output_tokens, const char*& start, const char*
 }
 
 // ------------------------------------------------------------------------------------------------
-void Tokenize(TokenList& output_tokens, const char* input)
+void Tokenize(TokenList& output_tokens, const char* input, ImportLimits::Reservation& reserved)
 {
 	ai_assert(input);
 	ASSIMP_LOG_DEBUG("Tokenizing ASCII FBX file");
@@ -155,6 +156,8 @@ void Tokenize(TokenList& output_tokens, const char* input)
 
             column = 0;
             ++line;
+            ImportLimits::Poll();
+            ReserveTokens(reserved, output_tokens);
         }
 
         if(comment) {
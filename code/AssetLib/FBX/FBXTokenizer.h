@@ -48,6 +48,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "FBXCompileConfig.h"
 #include <assimp/ai_assert.h>
+#include <assimp/ImportLimits.h>
 #include <assimp/defs.h>
 #include <vector>
 #include <string>
@@ -160,6 +161,11 @@ typedef std::vector< TokenPtr > TokenList;
 
 #define new_Token new Token
 
+/** Charges the memory of a token list and its tokens to the budget of the import */
+inline void ReserveTokens(ImportLimits::Reservation& reserved, const TokenList& tokens) {
+    reserved.Resize(tokens.capacity() * sizeof(TokenPtr) + tokens.size() * sizeof(Token));
+}
+
 
 /** Main FBX tokenizer function. Transform input buffer into a list of preprocessed tokens.
  *
@@ -167,8 +173,9 @@ typedef std::vector< TokenPtr > TokenList;
  *
  * @param output_tokens Receives a list of all tokens in the input data.
  * @param input_buffer Textual input buffer to be processed, 0-terminated.
+ * @param reserved Charged for the memory of the tokens while they are created.
  * @throw DeadlyImportError if something goes wrong */
-void Tokenize(TokenList& output_tokens, const char* input);
+void Tokenize(TokenList& output_tokens, const char* input, ImportLimits::Reservation& reserved);
 
 
 /** Tokenizer function for binary FBX files.
@@ -178,8 +185,9 @@ void Tokenize(TokenList& output_tokens, const char* input);
  * @param output_tokens Receives a list of all tokens in the input data.
  * @param input_buffer Binary input buffer to be processed.
  * @param length Length of input buffer, in bytes. There is no 0-terminal.
+ * @param reserved Charged for the memory of the tokens while they are created.
  * @throw DeadlyImportError if something goes wrong */
-void TokenizeBinary(TokenList& output_tokens, const char* input, size_t length);
+void TokenizeBinary(TokenList& output_tokens, const char* input, size_t length, ImportLimits::Reservation& reserved);
 
 
 } // ! FBX
@@ -202,7 +202,7 @@ void HMPImporter::InternReadFile_HMP5() {
 
     // generate an output mesh
     pScene->mNumMeshes = 1;
-    pScene->mMeshes = new aiMesh *[1];
+    pScene->mMeshes = AllocateSceneArray<aiMesh *>(1);
     aiMesh *pcMesh = pScene->mMeshes[0] = new aiMesh();
 
     pcMesh->mMaterialIndex = 0;
@@ -248,7 +248,7 @@ void HMPImporter::InternReadFile_HMP5() {
     pScene->mRootNode = new aiNode();
     pScene->mRootNode->mName.Set("terrain_root");
     pScene->mRootNode->mNumMeshes = 1;
-    pScene->mRootNode->mMeshes = new unsigned int[1];
+    pScene->mRootNode->mMeshes = AllocateSceneArray<unsigned int>(1);
     pScene->mRootNode->mMeshes[0] = 0;
 }
 
@@ -261,7 +261,7 @@ void HMPImporter::InternReadFile_HMP7() {
 
     // generate an output mesh
     pScene->mNumMeshes = 1;
-    pScene->mMeshes = new aiMesh *[1];
+    pScene->mMeshes = AllocateSceneArray<aiMesh *>(1);
     aiMesh *pcMesh = pScene->mMeshes[0] = new aiMesh();
 
     pcMesh->mMaterialIndex = 0;
@@ -316,7 +316,7 @@ void HMPImporter::InternReadFile_HMP7() {
     pScene->mRootNode = new aiNode();
     pScene->mRootNode->mName.Set("terrain_root");
     pScene->mRootNode->mNumMeshes = 1;
-    pScene->mRootNode->mMeshes = new unsigned int[1];
+    pScene->mRootNode->mMeshes = AllocateSceneArray<unsigned int>(1);
     pScene->mRootNode->mMeshes[0] = 0;
 }
 
@@ -354,7 +354,7 @@ void HMPImporter::CreateMaterial(const unsigned char *szCurrent,
 
         // add the material to the scene
         pScene->mNumMaterials = 1;
-        pScene->mMaterials = new aiMaterial *[1];
+        pScene->mMaterials = AllocateSceneArray<aiMaterial *>(1);
         pScene->mMaterials[0] = pcHelper;
     }
     *szCurrentOut = szCurrent;
@@ -384,7 +384,7 @@ void HMPImporter::CreateOutputFaceList(unsigned int width, unsigned int height)
     for (unsigned int y = 0; y < height - 1; ++y) {
         for (unsigned int x = 0; x < width - 1; ++x, ++pcFaceOut) {
             pcFaceOut->mNumIndices = 4;
-            pcFaceOut->mIndices = new unsigned int[4];
+            pcFaceOut->mIndices = AllocateSceneArray<unsigned int>(4);
 
             *pcVertOut++ = pcMesh->mVertices[y * width + x];
             *pcVertOut++ = pcMesh->mVertices[(y + 1) * width + x];
@@ -464,7 +464,7 @@ void HMPImporter::ReadFirstSkin(unsigned int iNumSkins, const unsigned char *szC
 
     // setup the material ...
     pScene->mNumMaterials = 1;
-    pScene->mMaterials = new aiMaterial *[1];
+    pScene->mMaterials = AllocateSceneArray<aiMaterial *>(1);
     pScene->mMaterials[0] = pcMat;
 
     *szCursorOut = szCursor;
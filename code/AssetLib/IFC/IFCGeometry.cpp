@@ -833,7 +833,7 @@ void AssignAddedMeshes(std::set<unsigned int>& mesh_indices,aiNode* nd,
 
         nd->mNumMeshes = static_cast<unsigned int>(mesh_indices.size());
 
-        nd->mMeshes = new unsigned int[nd->mNumMeshes];
+        nd->mMeshes = AllocateSceneArray<unsigned int>(nd->mNumMeshes);
         for(unsigned int i = 0; it != end && i < nd->mNumMeshes; ++i, ++it) {
             nd->mMeshes[i] = *it;
         }
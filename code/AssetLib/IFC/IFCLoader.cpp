@@ -290,7 +290,7 @@ void IFCImporter::InternReadFile(const std::string &pFile, aiScene *pScene, IOSy
     // do final data copying
     if (conv.meshes.size()) {
         pScene->mNumMeshes = static_cast<unsigned int>(conv.meshes.size());
-        pScene->mMeshes = new aiMesh *[pScene->mNumMeshes]();
+        pScene->mMeshes = AllocateSceneArray<aiMesh *>(pScene->mNumMeshes, nullptr);
         std::copy(conv.meshes.begin(), conv.meshes.end(), pScene->mMeshes);
 
         // needed to keep the d'tor from burning us
@@ -299,7 +299,7 @@ void IFCImporter::InternReadFile(const std::string &pFile, aiScene *pScene, IOSy
 
     if (conv.materials.size()) {
         pScene->mNumMaterials = static_cast<unsigned int>(conv.materials.size());
-        pScene->mMaterials = new aiMaterial *[pScene->mNumMaterials]();
+        pScene->mMaterials = AllocateSceneArray<aiMaterial *>(pScene->mNumMaterials, nullptr);
         std::copy(conv.materials.begin(), conv.materials.end(), pScene->mMaterials);
 
         // needed to keep the d'tor from burning us
@@ -747,7 +747,7 @@ aiNode *ProcessSpatialStructure(aiNode *parent, const Schema_2x3::IfcProduct &el
                     if (ndnew) {
 
                         nd_aggr->mNumChildren = 1;
-                        nd_aggr->mChildren = new aiNode *[1]();
+                        nd_aggr->mChildren = AllocateSceneArray<aiNode *>(1, nullptr);
 
                         nd_aggr->mChildren[0] = ndnew;
 
@@ -786,7 +786,7 @@ aiNode *ProcessSpatialStructure(aiNode *parent, const Schema_2x3::IfcProduct &el
 
                 nd_aggr->mTransformation = nd->mTransformation;
 
-                nd_aggr->mChildren = new aiNode *[aggr->RelatedObjects.size()]();
+                nd_aggr->mChildren = AllocateSceneArray<aiNode *>(aggr->RelatedObjects.size(), nullptr);
                 for (const Schema_2x3::IfcObjectDefinition &def : aggr->RelatedObjects) {
                     if (const Schema_2x3::IfcProduct *const prod = def.ToPtr<Schema_2x3::IfcProduct>()) {
 
@@ -812,7 +812,7 @@ aiNode *ProcessSpatialStructure(aiNode *parent, const Schema_2x3::IfcProduct &el
         }
 
         if (subnodes.size()) {
-            nd->mChildren = new aiNode *[subnodes.size()]();
+            nd->mChildren = AllocateSceneArray<aiNode *>(subnodes.size(), nullptr);
             for (aiNode *nd2 : subnodes) {
                 nd->mChildren[nd->mNumChildren++] = nd2;
                 nd2->mParent = nd;
@@ -899,7 +899,7 @@ void ProcessSpatialStructures(ConversionData &conv) {
         conv.out->mRootNode = new aiNode("Root");
         conv.out->mRootNode->mParent = nullptr;
         conv.out->mRootNode->mNumChildren = static_cast<unsigned int>(nb_nodes);
-        conv.out->mRootNode->mChildren = new aiNode *[conv.out->mRootNode->mNumChildren];
+        conv.out->mRootNode->mChildren = AllocateSceneArray<aiNode *>(conv.out->mRootNode->mNumChildren);
 
         for (size_t i = 0; i < nb_nodes; ++i) {
             aiNode *node = nodes[i];
@@ -93,7 +93,7 @@ aiMesh* TempMesh::ToMesh()
         }
 
         f.mNumIndices = mVertcnt[n];
-        f.mIndices = new unsigned int[f.mNumIndices];
+        f.mIndices = AllocateSceneArray<unsigned int>(f.mNumIndices);
         for(unsigned int a = 0; a < f.mNumIndices; ++a) {
             f.mIndices[a] = acc++;
         }
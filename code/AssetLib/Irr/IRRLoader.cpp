@@ -148,7 +148,7 @@ aiMesh *IRRImporter::BuildSingleQuadMesh(const SkyboxVertex &v1,
 	aiFace &face = out->mFaces[0];
 
 	face.mNumIndices = 4;
-	face.mIndices = new unsigned int[4];
+	face.mIndices = AllocateSceneArray<unsigned int>(4);
 	for (unsigned int i = 0; i < 4; ++i)
 		face.mIndices[i] = i;
 
@@ -347,7 +347,7 @@ void IRRImporter::ComputeAnimations(Node *root, aiNode *real, std::vector<aiNode
 			dummy->mName = anim->mNodeName;
 
 			dummy->mNumChildren = 1;
-			dummy->mChildren = new aiNode *[dummy->mNumChildren];
+			dummy->mChildren = AllocateSceneArray<aiNode *>(dummy->mNumChildren);
 			dummy->mChildren[0] = real;
 
 			// the transformation matrix of the dummy node is the identity
@@ -578,7 +578,7 @@ void SetupMapping(aiMaterial *mat, aiTextureMapping mode, const aiVector3D &axis
 			m->mType = aiPTI_Integer;
 
 			m->mDataLength = 4;
-			m->mData = new char[4];
+			m->mData = AllocateSceneArray<char>(4);
 			*((int *)m->mData) = mode;
 
 			p.push_back(prop);
@@ -593,7 +593,7 @@ void SetupMapping(aiMaterial *mat, aiTextureMapping mode, const aiVector3D &axis
 				m->mType = aiPTI_Float;
 
 				m->mDataLength = 12;
-				m->mData = new char[12];
+				m->mData = AllocateSceneArray<char>(12);
 				*((aiVector3D *)m->mData) = axis;
 				p.push_back(m);
 			}
@@ -607,8 +607,8 @@ void SetupMapping(aiMaterial *mat, aiTextureMapping mode, const aiVector3D &axis
 
 	// rebuild the output array
 	if (p.size() > mat->mNumAllocated) {
-		delete[] mat->mProperties;
-		mat->mProperties = new aiMaterialProperty *[p.size() * 2];
+		FreeSceneArray(mat->mProperties);
+		mat->mProperties = AllocateSceneArray<aiMaterialProperty *>(p.size() * 2);
 
 		mat->mNumAllocated = static_cast<unsigned int>(p.size() * 2);
 	}
@@ -800,7 +800,7 @@ void IRRImporter::GenerateGraph(Node *root, aiNode *rootOut, aiScene *scene,
 	if (oldMeshSize != (unsigned int)meshes.size()) {
 
 		rootOut->mNumMeshes = (unsigned int)meshes.size() - oldMeshSize;
-		rootOut->mMeshes = new unsigned int[rootOut->mNumMeshes];
+		rootOut->mMeshes = AllocateSceneArray<unsigned int>(rootOut->mNumMeshes);
 
 		for (unsigned int a = 0; a < rootOut->mNumMeshes; ++a) {
 			rootOut->mMeshes[a] = oldMeshSize + a;
@@ -841,7 +841,7 @@ void IRRImporter::GenerateGraph(Node *root, aiNode *rootOut, aiScene *scene,
 	rootOut->mNumChildren = (unsigned int)root->children.size();
 	if (rootOut->mNumChildren) {
 
-		rootOut->mChildren = new aiNode *[rootOut->mNumChildren];
+		rootOut->mChildren = AllocateSceneArray<aiNode *>(rootOut->mNumChildren);
 		for (unsigned int i = 0; i < rootOut->mNumChildren; ++i) {
 
 			aiNode *node = rootOut->mChildren[i] = new aiNode();
@@ -887,7 +887,7 @@ void IRRImporter::InternReadFile(const std::string &pFile, aiScene *pScene, IOSy
 	std::vector<aiLight *> lights;
 
 	// Batch loader used to load external models
-	BatchLoader batch(pIOHandler);
+	BatchLoader batch(pIOHandler, false, m_numThreads);
 	//  batch.SetBasePath(pFile);
 
 	cameras.reserve(5);
@@ -1289,14 +1289,14 @@ void IRRImporter::InternReadFile(const std::string &pFile, aiScene *pScene, IOSy
 	// Copy the cameras to the output array
 	if (!cameras.empty()) {
 		tempScene->mNumCameras = (unsigned int)cameras.size();
-		tempScene->mCameras = new aiCamera *[tempScene->mNumCameras];
+		tempScene->mCameras = AllocateSceneArray<aiCamera *>(tempScene->mNumCameras);
 		::memcpy(tempScene->mCameras, &cameras[0], sizeof(void *) * tempScene->mNumCameras);
 	}
 
 	// Copy the light sources to the output array
 	if (!lights.empty()) {
 		tempScene->mNumLights = (unsigned int)lights.size();
-		tempScene->mLights = new aiLight *[tempScene->mNumLights];
+		tempScene->mLights = AllocateSceneArray<aiLight *>(tempScene->mNumLights);
 		::memcpy(tempScene->mLights, &lights[0], sizeof(void *) * tempScene->mNumLights);
 	}
 
@@ -1319,7 +1319,7 @@ void IRRImporter::InternReadFile(const std::string &pFile, aiScene *pScene, IOSy
 
 	if (!anims.empty()) {
 		tempScene->mNumAnimations = 1;
-		tempScene->mAnimations = new aiAnimation *[tempScene->mNumAnimations];
+		tempScene->mAnimations = AllocateSceneArray<aiAnimation *>(tempScene->mNumAnimations);
 		aiAnimation *an = tempScene->mAnimations[0] = new aiAnimation();
 
 		// ***********************************************************
@@ -1333,20 +1333,20 @@ void IRRImporter::InternReadFile(const std::string &pFile, aiScene *pScene, IOSy
 
 		// copy all node animation channels to the global channel
 		an->mNumChannels = (unsigned int)anims.size();
-		an->mChannels = new aiNodeAnim *[an->mNumChannels];
+		an->mChannels = AllocateSceneArray<aiNodeAnim *>(an->mNumChannels);
 		::memcpy(an->mChannels, &anims[0], sizeof(void *) * an->mNumChannels);
 	}
 	if (!meshes.empty()) {
 		// copy all meshes to the temporary scene
 		tempScene->mNumMeshes = (unsigned int)meshes.size();
-		tempScene->mMeshes = new aiMesh *[tempScene->mNumMeshes];
+		tempScene->mMeshes = AllocateSceneArray<aiMesh *>(tempScene->mNumMeshes);
 		::memcpy(tempScene->mMeshes, &meshes[0], tempScene->mNumMeshes * sizeof(void *));
 	}
 
 	// Copy all materials to the output array
 	if (!materials.empty()) {
 		tempScene->mNumMaterials = (unsigned int)materials.size();
-		tempScene->mMaterials = new aiMaterial *[tempScene->mNumMaterials];
+		tempScene->mMaterials = AllocateSceneArray<aiMaterial *>(tempScene->mNumMaterials);
 		::memcpy(tempScene->mMaterials, &materials[0], sizeof(void *) * tempScene->mNumMaterials);
 	}
 
@@ -434,7 +434,7 @@ void IRRMeshImporter::InternReadFile(const std::string &pFile,
 					}
 					if (!curIdx) {
 						curFace->mNumIndices = 3;
-						curFace->mIndices = new unsigned int[3];
+						curFace->mIndices = AllocateSceneArray<unsigned int>(3);
 					}
 
 					unsigned int idx = strtoul10(sz, &sz);
@@ -491,7 +491,7 @@ void IRRMeshImporter::InternReadFile(const std::string &pFile,
 
 	// now generate the output scene
 	pScene->mNumMeshes = (unsigned int)meshes.size();
-	pScene->mMeshes = new aiMesh *[pScene->mNumMeshes];
+	pScene->mMeshes = AllocateSceneArray<aiMesh *>(pScene->mNumMeshes);
 	for (unsigned int i = 0; i < pScene->mNumMeshes; ++i) {
 		pScene->mMeshes[i] = meshes[i];
 
@@ -500,13 +500,13 @@ void IRRMeshImporter::InternReadFile(const std::string &pFile,
 	}
 
 	pScene->mNumMaterials = (unsigned int)materials.size();
-	pScene->mMaterials = new aiMaterial *[pScene->mNumMaterials];
+	pScene->mMaterials = AllocateSceneArray<aiMaterial *>(pScene->mNumMaterials);
 	::memcpy(pScene->mMaterials, &materials[0], sizeof(void *) * pScene->mNumMaterials);
 
 	pScene->mRootNode = new aiNode();
 	pScene->mRootNode->mName.Set("<IRRMesh>");
 	pScene->mRootNode->mNumMeshes = pScene->mNumMeshes;
-	pScene->mRootNode->mMeshes = new unsigned int[pScene->mNumMeshes];
+	pScene->mRootNode->mMeshes = AllocateSceneArray<unsigned int>(pScene->mNumMeshes);
 
 	for (unsigned int i = 0; i < pScene->mNumMeshes; ++i) {
 		pScene->mRootNode->mMeshes[i] = i;
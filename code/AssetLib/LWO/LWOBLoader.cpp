@@ -182,7 +182,7 @@ void LWOImporter::CopyFaceIndicesLWOB(FaceList::iterator& it,
             {
                 break;
             }
-            face.mIndices = new unsigned int[face.mNumIndices];
+            face.mIndices = AllocateSceneArray<unsigned int>(face.mNumIndices);
             for (unsigned int i = 0; i < face.mNumIndices;++i) {
                 unsigned int & mi = face.mIndices[i];
                 uint16_t index;
@@ -446,7 +446,7 @@ void LWOImporter::InternReadFile(const std::string &pFile,
             pcNode->mNumMeshes = num;
 
             if (pcNode->mNumMeshes) {
-                pcNode->mMeshes = new unsigned int[pcNode->mNumMeshes];
+                pcNode->mMeshes = AllocateSceneArray<unsigned int>(pcNode->mNumMeshes);
                 for (unsigned int p = 0; p < pcNode->mNumMeshes; ++p)
                     pcNode->mMeshes[p] = p + meshStart;
             }
@@ -458,7 +458,7 @@ void LWOImporter::InternReadFile(const std::string &pFile,
         throw DeadlyImportError("LWO: No meshes loaded");
 
     // The RemoveRedundantMaterials step will clean this up later
-    pScene->mMaterials = new aiMaterial *[pScene->mNumMaterials = (unsigned int)mSurfaces->size()];
+    pScene->mMaterials = AllocateSceneArray<aiMaterial *>(pScene->mNumMaterials = (unsigned int)mSurfaces->size());
 
     for (unsigned int mat = 0; mat < pScene->mNumMaterials; ++mat) {
         aiMaterial *pcMat = new aiMaterial();
@@ -467,7 +467,7 @@ void LWOImporter::InternReadFile(const std::string &pFile,
     }
 
     // copy the meshes to the output structure
-    pScene->mMeshes = new aiMesh *[pScene->mNumMeshes = (unsigned int)apcMeshes.size()];
+    pScene->mMeshes = AllocateSceneArray<aiMesh *>(pScene->mNumMeshes = (unsigned int)apcMeshes.size());
     ::memcpy(pScene->mMeshes, &apcMeshes[0], pScene->mNumMeshes * sizeof(void *));
 
     // generate the final node graph
@@ -628,7 +628,7 @@ void LWOImporter::GenerateNodeGraph(std::map<uint16_t, aiNode *> &apcNodes) {
             }
         }
         if (itMapParentNodes->second->mNumChildren) {
-            itMapParentNodes->second->mChildren = new aiNode *[itMapParentNodes->second->mNumChildren];
+            itMapParentNodes->second->mChildren = AllocateSceneArray<aiNode *>(itMapParentNodes->second->mNumChildren);
             uint16_t p = 0;
             for (auto itMapChildNodes = apcNodes.begin(); itMapChildNodes != apcNodes.end(); ++itMapChildNodes) {
                 if ((itMapParentNodes->first != itMapChildNodes->first) && (itMapParentNodes->second == itMapChildNodes->second->mParent)) {
@@ -842,7 +842,7 @@ void LWOImporter::CopyFaceIndicesLWO2(FaceList::iterator &it,
 
         if (face.mNumIndices) /* byte swapping has already been done */
         {
-            face.mIndices = new unsigned int[face.mNumIndices];
+            face.mIndices = AllocateSceneArray<unsigned int>(face.mNumIndices);
             for (unsigned int i = 0; i < face.mNumIndices; i++) {
                 face.mIndices[i] = ReadVSizedIntLWO2((uint8_t *&)cursor) + mCurLayer->mPointIDXOfs;
                 if (face.mIndices[i] > mCurLayer->mTempPoints.size()) {
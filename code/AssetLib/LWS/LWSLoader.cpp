@@ -376,7 +376,7 @@ void LWSImporter::BuildGraph(aiNode *nd, LWS::NodeDesc &src, std::vector<Attachm
 
         //Add the attachment node to it
         nd->mNumChildren = 1;
-        nd->mChildren = new aiNode *[1];
+        nd->mChildren = AllocateSceneArray<aiNode *>(1);
         nd->mChildren[0] = new aiNode();
         nd->mChildren[0]->mParent = nd;
         nd->mChildren[0]->mTransformation.a4 = -src.pivotPos.x;
@@ -449,7 +449,7 @@ void LWSImporter::BuildGraph(aiNode *nd, LWS::NodeDesc &src, std::vector<Attachm
 
     // Add children
     if (!src.children.empty()) {
-        nd->mChildren = new aiNode *[src.children.size()];
+        nd->mChildren = AllocateSceneArray<aiNode *>(src.children.size());
         for (std::list<LWS::NodeDesc *>::iterator it = src.children.begin(); it != src.children.end(); ++it) {
             aiNode *ndd = nd->mChildren[nd->mNumChildren++] = new aiNode();
             ndd->mParent = nd;
@@ -515,7 +515,7 @@ void LWSImporter::InternReadFile(const std::string &pFile, aiScene *pScene, IOSy
     root.Parse(dummy);
 
     // Construct a Batch-importer to read more files recursively
-    BatchLoader batch(pIOHandler);
+    BatchLoader batch(pIOHandler, false, m_numThreads);
 
     // Construct an array to receive the flat output graph
     std::list<LWS::NodeDesc> nodes;
@@ -866,11 +866,11 @@ void LWSImporter::InternReadFile(const std::string &pFile, aiScene *pScene, IOSy
 
     // allocate storage for cameras&lights
     if (num_camera) {
-        master->mCameras = new aiCamera *[master->mNumCameras = num_camera];
+        master->mCameras = AllocateSceneArray<aiCamera *>(master->mNumCameras = num_camera);
     }
     aiCamera **cams = master->mCameras;
     if (num_light) {
-        master->mLights = new aiLight *[master->mNumLights = num_light];
+        master->mLights = AllocateSceneArray<aiLight *>(master->mNumLights = num_light);
     }
     aiLight **lights = master->mLights;
 
@@ -878,7 +878,7 @@ void LWSImporter::InternReadFile(const std::string &pFile, aiScene *pScene, IOSy
     std::vector<aiNodeAnim *> anims;
 
     nd->mName.Set("<LWSRoot>");
-    nd->mChildren = new aiNode *[no_parent];
+    nd->mChildren = AllocateSceneArray<aiNode *>(no_parent);
     for (std::list<LWS::NodeDesc>::iterator ndIt = nodes.begin(); ndIt != nodes.end(); ++ndIt) {
         if (!ndIt->parent_resolved) {
             aiNode *ro = nd->mChildren[nd->mNumChildren++] = new aiNode();
@@ -892,7 +892,7 @@ void LWSImporter::InternReadFile(const std::string &pFile, aiScene *pScene, IOSy
 
     // create a master animation channel for us
     if (anims.size()) {
-        master->mAnimations = new aiAnimation *[master->mNumAnimations = 1];
+        master->mAnimations = AllocateSceneArray<aiAnimation *>(master->mNumAnimations = 1);
         aiAnimation *anim = master->mAnimations[0] = new aiAnimation();
         anim->mName.Set("LWSMasterAnim");
 
@@ -900,7 +900,7 @@ void LWSImporter::InternReadFile(const std::string &pFile, aiScene *pScene, IOSy
         anim->mTicksPerSecond = fps;
         anim->mDuration = last - (first - 1); /* fixme ... zero or one-based?*/
 
-        anim->mChannels = new aiNodeAnim *[anim->mNumChannels = static_cast<unsigned int>(anims.size())];
+        anim->mChannels = AllocateSceneArray<aiNodeAnim *>(anim->mNumChannels = static_cast<unsigned int>(anims.size()));
         std::copy(anims.begin(), anims.end(), anim->mChannels);
     }
 
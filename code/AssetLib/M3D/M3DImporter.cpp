@@ -228,7 +228,7 @@ void M3DImporter::importMaterials(const M3DWrapper &m3d) {
     ai_assert(m3d);
 
     mScene->mNumMaterials = m3d->nummaterial + 1;
-    mScene->mMaterials = new aiMaterial *[mScene->mNumMaterials];
+    mScene->mMaterials = AllocateSceneArray<aiMaterial *>(mScene->mNumMaterials);
 
     ASSIMP_LOG_DEBUG("M3D: importMaterials ", mScene->mNumMaterials);
 
@@ -331,7 +331,7 @@ void M3DImporter::importTextures(const M3DWrapper &m3d) {
         return;
     }
 
-    mScene->mTextures = new aiTexture *[m3d->numtexture];
+    mScene->mTextures = AllocateSceneArray<aiTexture *>(m3d->numtexture);
     for (i = 0; i < m3d->numtexture; i++) {
         unsigned int j, k;
         t = &m3d->texture[i];
@@ -348,7 +348,7 @@ void M3DImporter::importTextures(const M3DWrapper &m3d) {
             tx->mWidth = t->w;
             tx->mHeight = t->h;
             strcpy(tx->achFormatHint, formatHint[t->f - 1]);
-            tx->pcData = new aiTexel[tx->mWidth * tx->mHeight];
+            tx->pcData = AllocateSceneArray<aiTexel>(tx->mWidth * tx->mHeight);
             for (j = k = 0; j < tx->mWidth * tx->mHeight; j++) {
                 switch (t->f) {
                     case 1: tx->pcData[j].g = t->d[k++]; break;
@@ -427,7 +427,7 @@ void M3DImporter::importMeshes(const M3DWrapper &m3d) {
         // add a face to temporary vector
         aiFace *pFace = new aiFace;
         pFace->mNumIndices = numpoly;
-        pFace->mIndices = new unsigned int[numpoly];
+        pFace->mIndices = AllocateSceneArray<unsigned int>(numpoly);
         for (j = 0; j < numpoly; j++) {
             aiVector3D pos, uv, norm;
             k = static_cast<unsigned int>(vertices->size());
@@ -471,12 +471,12 @@ void M3DImporter::importMeshes(const M3DWrapper &m3d) {
 
     // create global mesh list in scene
     mScene->mNumMeshes = static_cast<unsigned int>(meshes->size());
-    mScene->mMeshes = new aiMesh *[mScene->mNumMeshes];
+    mScene->mMeshes = AllocateSceneArray<aiMesh *>(mScene->mNumMeshes);
     std::copy(meshes->begin(), meshes->end(), mScene->mMeshes);
 
     // create mesh indeces in root node
     mScene->mRootNode->mNumMeshes = static_cast<unsigned int>(meshes->size());
-    mScene->mRootNode->mMeshes = new unsigned int[meshes->size()];
+    mScene->mRootNode->mMeshes = AllocateSceneArray<unsigned int>(meshes->size());
     for (i = 0; i < meshes->size(); i++) {
         mScene->mRootNode->mMeshes[i] = i;
     }
@@ -510,7 +510,7 @@ void M3DImporter::importBones(const M3DWrapper &m3d, unsigned int parentid, aiNo
             n++;
         }
     }
-    pParent->mChildren = new aiNode *[n];
+    pParent->mChildren = AllocateSceneArray<aiNode *>(n);
 
     for (i = parentid + 1; i < m3d->numbone; i++) {
         if (m3d->bone[i].parent == parentid) {
@@ -546,7 +546,7 @@ void M3DImporter::importAnimations(const M3DWrapper &m3d) {
         return;
     }
 
-    mScene->mAnimations = new aiAnimation *[m3d->numaction];
+    mScene->mAnimations = AllocateSceneArray<aiAnimation *>(m3d->numaction);
     for (i = 0; i < m3d->numaction; i++) {
         a = &m3d->action[i];
         aiAnimation *pAnim = new aiAnimation;
@@ -555,7 +555,7 @@ void M3DImporter::importAnimations(const M3DWrapper &m3d) {
         pAnim->mTicksPerSecond = 100;
         // now we know how many bones are referenced in this animation
         pAnim->mNumChannels = m3d->numbone;
-        pAnim->mChannels = new aiNodeAnim *[pAnim->mNumChannels];
+        pAnim->mChannels = AllocateSceneArray<aiNodeAnim *>(pAnim->mNumChannels);
         for (l = 0; l < m3d->numbone; l++) {
             unsigned int n;
             pAnim->mChannels[l] = new aiNodeAnim;
@@ -731,7 +731,7 @@ void M3DImporter::populateMesh(const M3DWrapper &m3d, aiMesh *pMesh, std::vector
         pMesh->mNumBones = m3d->numbone;
         // we need aiBone with mOffsetMatrix for bones without weights as well
         if (pMesh->mNumBones && m3d->numbone && m3d->bone) {
-            pMesh->mBones = new aiBone *[pMesh->mNumBones];
+            pMesh->mBones = AllocateSceneArray<aiBone *>(pMesh->mNumBones);
             for (unsigned int i = 0; i < m3d->numbone; i++) {
                 aiNode *pNode;
                 pMesh->mBones[i] = new aiBone;
@@ -260,12 +260,12 @@ void MD2Importer::InternReadFile( const std::string& pFile,
     pScene->mNumMaterials = 1;
     pScene->mRootNode = new aiNode();
     pScene->mRootNode->mNumMeshes = 1;
-    pScene->mRootNode->mMeshes = new unsigned int[1];
+    pScene->mRootNode->mMeshes = AllocateSceneArray<unsigned int>(1);
     pScene->mRootNode->mMeshes[0] = 0;
-    pScene->mMaterials = new aiMaterial*[1];
+    pScene->mMaterials = AllocateSceneArray<aiMaterial *>(1);
     pScene->mMaterials[0] = new aiMaterial();
     pScene->mNumMeshes = 1;
-    pScene->mMeshes = new aiMesh*[1];
+    pScene->mMeshes = AllocateSceneArray<aiMesh *>(1);
 
     aiMesh* pcMesh = pScene->mMeshes[0] = new aiMesh();
     pcMesh->mPrimitiveTypes = aiPrimitiveType_TRIANGLE;
@@ -396,7 +396,7 @@ void MD2Importer::InternReadFile( const std::string& pFile,
 
     for (unsigned int i = 0; i < (unsigned int)m_pcHeader->numTriangles;++i)    {
         // Allocate the face
-        pScene->mMeshes[0]->mFaces[i].mIndices = new unsigned int[3];
+        pScene->mMeshes[0]->mFaces[i].mIndices = AllocateSceneArray<unsigned int>(3);
         pScene->mMeshes[0]->mFaces[i].mNumIndices = 3;
 
         // copy texture coordinates
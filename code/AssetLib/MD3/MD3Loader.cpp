@@ -556,7 +556,7 @@ bool MD3Importer::ReadMultipartFile() {
         SetGenericProperty(props.ints, AI_CONFIG_IMPORT_MD3_HANDLE_MULTIPART, 0);
 
         // now read these three files
-        BatchLoader batch(mIOHandler);
+        BatchLoader batch(mIOHandler, false, m_numThreads);
         const unsigned int _lower = batch.AddLoadRequest(lower, 0, &props);
         const unsigned int _upper = batch.AddLoadRequest(upper, 0, &props);
         const unsigned int _head = batch.AddLoadRequest(head, 0, &props);
@@ -769,10 +769,10 @@ void MD3Importer::InternReadFile(const std::string &pFile, aiScene *pScene, IOSy
         // since those pointers will eventually have to point to real objects
         throw DeadlyImportError("MD3: Too many surfaces, would run out of memory");
     }
-    pScene->mMeshes = new aiMesh *[pScene->mNumMeshes];
+    pScene->mMeshes = AllocateSceneArray<aiMesh *>(pScene->mNumMeshes);
 
     pScene->mNumMaterials = pcHeader->NUM_SURFACES;
-    pScene->mMaterials = new aiMaterial *[pScene->mNumMeshes];
+    pScene->mMaterials = AllocateSceneArray<aiMaterial *>(pScene->mNumMeshes);
 
     // Set arrays to zero to ensue proper destruction if an exception is raised
     ::memset(pScene->mMeshes, 0, pScene->mNumMeshes * sizeof(aiMesh *));
@@ -971,7 +971,7 @@ void MD3Importer::InternReadFile(const std::string &pFile, aiScene *pScene, IOSy
         // Fill in all triangles
         unsigned int iCurrent = 0;
         for (unsigned int i = 0; i < (unsigned int)pcSurfaces->NUM_TRIANGLES; ++i) {
-            pcMesh->mFaces[i].mIndices = new unsigned int[3];
+            pcMesh->mFaces[i].mIndices = AllocateSceneArray<unsigned int>(3);
             pcMesh->mFaces[i].mNumIndices = 3;
 
             //unsigned int iTemp = iCurrent;
@@ -1024,12 +1024,12 @@ void MD3Importer::InternReadFile(const std::string &pFile, aiScene *pScene, IOSy
     // Now we need to generate an empty node graph
     pScene->mRootNode = new aiNode("<MD3Root>");
     pScene->mRootNode->mNumMeshes = pScene->mNumMeshes;
-    pScene->mRootNode->mMeshes = new unsigned int[pScene->mNumMeshes];
+    pScene->mRootNode->mMeshes = AllocateSceneArray<unsigned int>(pScene->mNumMeshes);
 
     // Attach tiny children for all tags
     if (pcHeader->NUM_TAGS) {
         pScene->mRootNode->mNumChildren = pcHeader->NUM_TAGS;
-        pScene->mRootNode->mChildren = new aiNode *[pcHeader->NUM_TAGS];
+        pScene->mRootNode->mChildren = AllocateSceneArray<aiNode *>(pcHeader->NUM_TAGS);
 
         for (unsigned int i = 0; i < pcHeader->NUM_TAGS; ++i, ++pcTags) {
             aiNode *nd = pScene->mRootNode->mChildren[i] = new aiNode();
@@ -259,7 +259,7 @@ void MD5Importer::AttachChilds_Mesh(int iParentID, aiNode *piParent, BoneList &b
         }
     }
     if (piParent->mNumChildren) {
-        piParent->mChildren = new aiNode *[piParent->mNumChildren];
+        piParent->mChildren = AllocateSceneArray<aiNode *>(piParent->mNumChildren);
         for (int i = 0; i < (int)bones.size(); ++i) {
             // (avoid infinite recursion)
             if (iParentID != i && bones[i].mParentIndex == iParentID) {
@@ -310,7 +310,7 @@ void MD5Importer::AttachChilds_Anim(int iParentID, aiNode *piParent, AnimBoneLis
         }
     }
     if (piParent->mNumChildren) {
-        piParent->mChildren = new aiNode *[piParent->mNumChildren];
+        piParent->mChildren = AllocateSceneArray<aiNode *>(piParent->mNumChildren);
         for (int i = 0; i < (int)bones.size(); ++i) {
             // (avoid infinite recursion)
             if (iParentID != i && bones[i].mParentIndex == iParentID) {
@@ -360,7 +360,7 @@ void MD5Importer::LoadMD5MeshFile() {
     // create the bone hierarchy - first the root node and dummy nodes for all meshes
     mScene->mRootNode = new aiNode("<MD5_Root>");
     mScene->mRootNode->mNumChildren = 2;
-    mScene->mRootNode->mChildren = new aiNode *[2];
+    mScene->mRootNode->mChildren = AllocateSceneArray<aiNode *>(2);
 
     // build the hierarchy from the MD5MESH file
     aiNode *pcNode = mScene->mRootNode->mChildren[1] = new aiNode();
@@ -386,12 +386,12 @@ void MD5Importer::LoadMD5MeshFile() {
 
     // generate all meshes
     mScene->mNumMeshes = mScene->mNumMaterials;
-    mScene->mMeshes = new aiMesh *[mScene->mNumMeshes];
-    mScene->mMaterials = new aiMaterial *[mScene->mNumMeshes];
+    mScene->mMeshes = AllocateSceneArray<aiMesh *>(mScene->mNumMeshes);
+    mScene->mMaterials = AllocateSceneArray<aiMaterial *>(mScene->mNumMeshes);
 
     //  storage for node mesh indices
     pcNode->mNumMeshes = mScene->mNumMeshes;
-    pcNode->mMeshes = new unsigned int[pcNode->mNumMeshes];
+    pcNode->mMeshes = AllocateSceneArray<unsigned int>(pcNode->mNumMeshes);
     for (unsigned int m = 0; m < pcNode->mNumMeshes; ++m) {
         pcNode->mMeshes[m] = m;
     }
@@ -446,7 +446,7 @@ void MD5Importer::LoadMD5MeshFile() {
 
         // just for safety
         if (mesh->mNumBones) {
-            mesh->mBones = new aiBone *[mesh->mNumBones];
+            mesh->mBones = AllocateSceneArray<aiBone *>(mesh->mNumBones);
             for (unsigned int q = 0, h = 0; q < meshParser.mJoints.size(); ++q) {
                 if (!piCount[q]) continue;
                 aiBone *p = mesh->mBones[h] = new aiBone();
@@ -586,10 +586,10 @@ void MD5Importer::LoadMD5AnimFile() {
     } else {
         mHadMD5Anim = true;
 
-        mScene->mAnimations = new aiAnimation *[mScene->mNumAnimations = 1];
+        mScene->mAnimations = AllocateSceneArray<aiAnimation *>(mScene->mNumAnimations = 1);
         aiAnimation *anim = mScene->mAnimations[0] = new aiAnimation();
         anim->mNumChannels = (unsigned int)animParser.mAnimatedBones.size();
-        anim->mChannels = new aiNodeAnim *[anim->mNumChannels];
+        anim->mChannels = AllocateSceneArray<aiNodeAnim *>(anim->mNumChannels);
         for (unsigned int i = 0; i < anim->mNumChannels; ++i) {
             aiNodeAnim *node = anim->mChannels[i] = new aiNodeAnim();
             node->mNodeName = aiString(animParser.mAnimatedBones[i].mName);
@@ -696,12 +696,12 @@ void MD5Importer::LoadMD5CameraFile() {
     // Construct output graph - a simple root with a dummy child.
     // The root node performs the coordinate system conversion
     aiNode *root = mScene->mRootNode = new aiNode("<MD5CameraRoot>");
-    root->mChildren = new aiNode *[root->mNumChildren = 1];
+    root->mChildren = AllocateSceneArray<aiNode *>(root->mNumChildren = 1);
     root->mChildren[0] = new aiNode("<MD5Camera>");
     root->mChildren[0]->mParent = root;
 
     // ... but with one camera assigned to it
-    mScene->mCameras = new aiCamera *[mScene->mNumCameras = 1];
+    mScene->mCameras = AllocateSceneArray<aiCamera *>(mScene->mNumCameras = 1);
     aiCamera *cam = mScene->mCameras[0] = new aiCamera();
     cam->mName = "<MD5Camera>";
 
@@ -720,14 +720,14 @@ void MD5Importer::LoadMD5CameraFile() {
     }
 
     mScene->mNumAnimations = static_cast<unsigned int>(cuts.size() - 1);
-    aiAnimation **tmp = mScene->mAnimations = new aiAnimation *[mScene->mNumAnimations];
+    aiAnimation **tmp = mScene->mAnimations = AllocateSceneArray<aiAnimation *>(mScene->mNumAnimations);
     for (std::vector<unsigned int>::const_iterator it = cuts.begin(); it != cuts.end() - 1; ++it) {
 
         aiAnimation *anim = *tmp++ = new aiAnimation();
         anim->mName.length = ::ai_snprintf(anim->mName.data, MAXLEN, "anim%u_from_%u_to_%u", (unsigned int)(it - cuts.begin()), (*it), *(it + 1));
 
         anim->mTicksPerSecond = cameraParser.fFrameRate;
-        anim->mChannels = new aiNodeAnim *[anim->mNumChannels = 1];
+        anim->mChannels = AllocateSceneArray<aiNodeAnim *>(anim->mNumChannels = 1);
         aiNodeAnim *nd = anim->mChannels[0] = new aiNodeAnim();
         nd->mNodeName.Set("<MD5Camera>");
 
@@ -256,7 +256,7 @@ void MDCImporter::InternReadFile(
         pcSurface2 = reinterpret_cast<BE_NCONST MDC::Surface *>((BE_NCONST int8_t *)pcSurface2 + pcSurface2->ulOffsetEnd);
     }
     aszShaders.reserve(iNumShaders);
-    pScene->mMeshes = new aiMesh *[pScene->mNumMeshes];
+    pScene->mMeshes = AllocateSceneArray<aiMesh *>(pScene->mNumMeshes);
 
     // necessary that we don't crash if an exception occurs
     for (unsigned int i = 0; i < pScene->mNumMeshes; ++i) {
@@ -360,7 +360,7 @@ void MDCImporter::InternReadFile(
                           ++pcTriangle, ++pcFaceCur) {
             const unsigned int iOutIndex = iFace * 3;
             pcFaceCur->mNumIndices = 3;
-            pcFaceCur->mIndices = new unsigned int[3];
+            pcFaceCur->mIndices = AllocateSceneArray<unsigned int>(3);
 
             for (unsigned int iIndex = 0; iIndex < 3; ++iIndex,
                               ++pcVertCur, ++pcUVCur, ++pcNorCur) {
@@ -409,27 +409,27 @@ void MDCImporter::InternReadFile(
         if (nullptr != pScene->mMeshes[0]) {
             pScene->mRootNode->mName = pScene->mMeshes[0]->mName;
             pScene->mRootNode->mNumMeshes = 1;
-            pScene->mRootNode->mMeshes = new unsigned int[1];
+            pScene->mRootNode->mMeshes = AllocateSceneArray<unsigned int>(1);
             pScene->mRootNode->mMeshes[0] = 0;
         }
     } else {
         pScene->mRootNode = new aiNode();
         pScene->mRootNode->mNumChildren = pScene->mNumMeshes;
-        pScene->mRootNode->mChildren = new aiNode *[pScene->mNumMeshes];
+        pScene->mRootNode->mChildren = AllocateSceneArray<aiNode *>(pScene->mNumMeshes);
         pScene->mRootNode->mName.Set("<root>");
         for (unsigned int i = 0; i < pScene->mNumMeshes; ++i) {
             aiNode *pcNode = pScene->mRootNode->mChildren[i] = new aiNode();
             pcNode->mParent = pScene->mRootNode;
             pcNode->mName = pScene->mMeshes[i]->mName;
             pcNode->mNumMeshes = 1;
-            pcNode->mMeshes = new unsigned int[1];
+            pcNode->mMeshes = AllocateSceneArray<unsigned int>(1);
             pcNode->mMeshes[0] = i;
         }
     }
 
     // create materials
     pScene->mNumMaterials = (unsigned int)aszShaders.size();
-    pScene->mMaterials = new aiMaterial *[pScene->mNumMaterials];
+    pScene->mMaterials = AllocateSceneArray<aiMaterial *>(pScene->mNumMaterials);
     for (unsigned int i = 0; i < pScene->mNumMaterials; ++i) {
         aiMaterial *pcMat = new aiMaterial();
         pScene->mMaterials[i] = pcMat;
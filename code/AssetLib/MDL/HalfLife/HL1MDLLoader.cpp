@@ -363,7 +363,7 @@ void HL1MDLLoader::read_texture(const Texture_HL1 *ptexture,
     pResult->achFormatHint[8] = '\0';
 
     const size_t num_pixels = pResult->mWidth * pResult->mHeight;
-    aiTexel *out = pResult->pcData = new aiTexel[num_pixels];
+    aiTexel *out = pResult->pcData = AllocateSceneArray<aiTexel>(num_pixels);
 
     // Convert indexed 8 bit to 32 bit RGBA.
     for (size_t i = 0; i < num_pixels; ++i, ++out) {
@@ -385,8 +385,8 @@ void HL1MDLLoader::read_textures() {
     unsigned char *pin = texture_buffer_;
 
     scene_->mNumTextures = scene_->mNumMaterials = texture_header_->numtextures;
-    scene_->mTextures = new aiTexture *[scene_->mNumTextures];
-    scene_->mMaterials = new aiMaterial *[scene_->mNumMaterials];
+    scene_->mTextures = AllocateSceneArray<aiTexture *>(scene_->mNumTextures);
+    scene_->mMaterials = AllocateSceneArray<aiMaterial *>(scene_->mNumMaterials);
 
     for (int i = 0; i < texture_header_->numtextures; ++i) {
         scene_->mTextures[i] = new aiTexture();
@@ -473,7 +473,7 @@ void HL1MDLLoader::read_bones() {
     aiNode *bones_node = new aiNode(AI_MDL_HL1_NODE_BONES);
     rootnode_children_.push_back(bones_node);
     bones_node->mNumChildren = static_cast<unsigned int>(header_->numbones);
-    bones_node->mChildren = new aiNode *[bones_node->mNumChildren];
+    bones_node->mChildren = AllocateSceneArray<aiNode *>(bones_node->mNumChildren);
 
     // Create bone matrices in local space.
     for (int i = 0; i < header_->numbones; ++i) {
@@ -618,7 +618,7 @@ void HL1MDLLoader::read_meshes() {
 
     unsigned int mesh_index = 0;
 
-    scene_->mMeshes = new aiMesh *[scene_->mNumMeshes];
+    scene_->mMeshes = AllocateSceneArray<aiMesh *>(scene_->mNumMeshes);
 
     pbodypart = (const Bodypart_HL1 *)((uint8_t *)header_ + header_->bodypartindex);
 
@@ -639,7 +639,7 @@ void HL1MDLLoader::read_meshes() {
     aiNode *bodyparts_node = new aiNode(AI_MDL_HL1_NODE_BODYPARTS);
     rootnode_children_.push_back(bodyparts_node);
     bodyparts_node->mNumChildren = static_cast<unsigned int>(header_->numbodyparts);
-    bodyparts_node->mChildren = new aiNode *[bodyparts_node->mNumChildren];
+    bodyparts_node->mChildren = AllocateSceneArray<aiNode *>(bodyparts_node->mNumChildren);
     aiNode **bodyparts_node_ptr = bodyparts_node->mChildren;
 
     // The following variables are defined here so they don't have
@@ -713,7 +713,7 @@ void HL1MDLLoader::read_meshes() {
         bodypart_node->mMetaData->Set(0, "Base", pbodypart->base);
 
         bodypart_node->mNumChildren = static_cast<unsigned int>(pbodypart->nummodels);
-        bodypart_node->mChildren = new aiNode *[bodypart_node->mNumChildren];
+        bodypart_node->mChildren = AllocateSceneArray<aiNode *>(bodypart_node->mNumChildren);
         aiNode **bodypart_models_ptr = bodypart_node->mChildren;
 
         for (int j = 0; j < pbodypart->nummodels;
@@ -746,7 +746,7 @@ void HL1MDLLoader::read_meshes() {
             aiNode *model_node = (*bodypart_models_ptr) = new aiNode(unique_models_names[model_index]);
             model_node->mParent = bodypart_node;
             model_node->mNumMeshes = static_cast<unsigned int>(pmodel->nummesh);
-            model_node->mMeshes = new unsigned int[model_node->mNumMeshes];
+            model_node->mMeshes = AllocateSceneArray<unsigned int>(model_node->mNumMeshes);
             unsigned int *model_meshes_ptr = model_node->mMeshes;
 
             for (int k = 0; k < pmodel->nummesh; ++k, ++pmesh, ++mesh_index, ++model_meshes_ptr) {
@@ -879,7 +879,7 @@ void HL1MDLLoader::read_meshes() {
                     for (unsigned int f = 0; f < scene_mesh->mNumFaces; ++f) {
                         aiFace *face = &scene_mesh->mFaces[f];
                         face->mNumIndices = 3;
-                        face->mIndices = new unsigned int[3];
+                        face->mIndices = AllocateSceneArray<unsigned int>(3);
                         face->mIndices[0] = mesh_faces[f].v2;
                         face->mIndices[1] = mesh_faces[f].v1;
                         face->mIndices[2] = mesh_faces[f].v0;
@@ -887,7 +887,7 @@ void HL1MDLLoader::read_meshes() {
 
                     // Add mesh bones.
                     scene_mesh->mNumBones = static_cast<unsigned int>(bone_triverts.size());
-                    scene_mesh->mBones = new aiBone *[scene_mesh->mNumBones];
+                    scene_mesh->mBones = AllocateSceneArray<aiBone *>(scene_mesh->mNumBones);
 
                     aiBone **scene_bone_ptr = scene_mesh->mBones;
 
@@ -958,7 +958,7 @@ void HL1MDLLoader::read_animations() {
 
     pseqdesc = (const SequenceDesc_HL1 *)((uint8_t *)header_ + header_->seqindex);
 
-    aiAnimation **scene_animations_ptr = scene_->mAnimations = new aiAnimation *[scene_->mNumAnimations];
+    aiAnimation **scene_animations_ptr = scene_->mAnimations = AllocateSceneArray<aiAnimation *>(scene_->mNumAnimations);
 
     for (int sequence = 0; sequence < header_->numseq; ++sequence, ++pseqdesc) {
         pseqgroup = (const SequenceGroup_HL1 *)((uint8_t *)header_ + header_->seqgroupindex) + pseqdesc->seqgroup;
@@ -979,7 +979,7 @@ void HL1MDLLoader::read_animations() {
             scene_animation->mTicksPerSecond = pseqdesc->fps;
             scene_animation->mDuration = static_cast<double>(pseqdesc->fps) * pseqdesc->numframes;
             scene_animation->mNumChannels = static_cast<unsigned int>(header_->numbones);
-            scene_animation->mChannels = new aiNodeAnim *[scene_animation->mNumChannels];
+            scene_animation->mChannels = AllocateSceneArray<aiNodeAnim *>(scene_animation->mNumChannels);
 
             for (int bone = 0; bone < header_->numbones; bone++, ++pbone, ++panim) {
                 aiNodeAnim *node_anim = scene_animation->mChannels[bone] = new aiNodeAnim();
@@ -1038,7 +1038,7 @@ void HL1MDLLoader::read_sequence_groups_info() {
     rootnode_children_.push_back(sequence_groups_node);
 
     sequence_groups_node->mNumChildren = static_cast<unsigned int>(header_->numseqgroups);
-    sequence_groups_node->mChildren = new aiNode *[sequence_groups_node->mNumChildren];
+    sequence_groups_node->mChildren = AllocateSceneArray<aiNode *>(sequence_groups_node->mNumChildren);
 
     const SequenceGroup_HL1 *pseqgroup = (const SequenceGroup_HL1 *)((uint8_t *)header_ + header_->seqgroupindex);
 
@@ -1078,7 +1078,7 @@ void HL1MDLLoader::read_sequence_infos() {
     rootnode_children_.push_back(sequence_infos_node);
 
     sequence_infos_node->mNumChildren = static_cast<unsigned int>(header_->numseq);
-    sequence_infos_node->mChildren = new aiNode *[sequence_infos_node->mNumChildren];
+    sequence_infos_node->mChildren = AllocateSceneArray<aiNode *>(sequence_infos_node->mNumChildren);
 
     std::vector<aiNode *> sequence_info_node_children;
 
@@ -1121,7 +1121,7 @@ void HL1MDLLoader::read_sequence_infos() {
                 sequence_info_node_children.push_back(blend_controllers_node);
                 blend_controllers_node->mParent = sequence_info_node;
                 blend_controllers_node->mNumChildren = static_cast<unsigned int>(num_blend_controllers);
-                blend_controllers_node->mChildren = new aiNode *[blend_controllers_node->mNumChildren];
+                blend_controllers_node->mChildren = AllocateSceneArray<aiNode *>(blend_controllers_node->mNumChildren);
 
                 for (unsigned int j = 0; j < blend_controllers_node->mNumChildren; ++j) {
                     aiNode *blend_controller_node = blend_controllers_node->mChildren[j] = new aiNode();
@@ -1150,7 +1150,7 @@ void HL1MDLLoader::read_sequence_infos() {
             sequence_info_node_children.push_back(pEventsNode);
             pEventsNode->mParent = sequence_info_node;
             pEventsNode->mNumChildren = static_cast<unsigned int>(pseqdesc->numevents);
-            pEventsNode->mChildren = new aiNode *[pEventsNode->mNumChildren];
+            pEventsNode->mChildren = AllocateSceneArray<aiNode *>(pEventsNode->mNumChildren);
 
             for (unsigned int j = 0; j < pEventsNode->mNumChildren; ++j, ++pevent) {
                 aiNode *pEvent = pEventsNode->mChildren[j] = new aiNode();
@@ -1197,7 +1197,7 @@ void HL1MDLLoader::read_attachments() {
     aiNode *attachments_node = new aiNode(AI_MDL_HL1_NODE_ATTACHMENTS);
     rootnode_children_.push_back(attachments_node);
     attachments_node->mNumChildren = static_cast<unsigned int>(header_->numattachments);
-    attachments_node->mChildren = new aiNode *[attachments_node->mNumChildren];
+    attachments_node->mChildren = AllocateSceneArray<aiNode *>(attachments_node->mNumChildren);
 
     for (int i = 0; i < header_->numattachments; ++i, ++pattach) {
         aiNode *attachment_node = attachments_node->mChildren[i] = new aiNode();
@@ -1221,7 +1221,7 @@ void HL1MDLLoader::read_hitboxes() {
     aiNode *hitboxes_node = new aiNode(AI_MDL_HL1_NODE_HITBOXES);
     rootnode_children_.push_back(hitboxes_node);
     hitboxes_node->mNumChildren = static_cast<unsigned int>(header_->numhitboxes);
-    hitboxes_node->mChildren = new aiNode *[hitboxes_node->mNumChildren];
+    hitboxes_node->mChildren = AllocateSceneArray<aiNode *>(hitboxes_node->mNumChildren);
 
     for (int i = 0; i < header_->numhitboxes; ++i, ++phitbox) {
         aiNode *hitbox_node = hitboxes_node->mChildren[i] = new aiNode();
@@ -1248,7 +1248,7 @@ void HL1MDLLoader::read_bone_controllers() {
     aiNode *bones_controller_node = new aiNode(AI_MDL_HL1_NODE_BONE_CONTROLLERS);
     rootnode_children_.push_back(bones_controller_node);
     bones_controller_node->mNumChildren = static_cast<unsigned int>(header_->numbonecontrollers);
-    bones_controller_node->mChildren = new aiNode *[bones_controller_node->mNumChildren];
+    bones_controller_node->mChildren = AllocateSceneArray<aiNode *>(bones_controller_node->mNumChildren);
 
     for (int i = 0; i < header_->numbonecontrollers; ++i, ++pbonecontroller) {
         aiNode *bone_controller_node = bones_controller_node->mChildren[i] = new aiNode();
@@ -478,16 +478,16 @@ void MDLImporter::InternReadFile_Quake1() {
     // there won't be more than one mesh inside the file
     pScene->mRootNode = new aiNode();
     pScene->mRootNode->mNumMeshes = 1;
-    pScene->mRootNode->mMeshes = new unsigned int[1];
+    pScene->mRootNode->mMeshes = AllocateSceneArray<unsigned int>(1);
     pScene->mRootNode->mMeshes[0] = 0;
     pScene->mNumMeshes = 1;
-    pScene->mMeshes = new aiMesh *[1];
+    pScene->mMeshes = AllocateSceneArray<aiMesh *>(1);
     pScene->mMeshes[0] = pcMesh;
 
     // now iterate through all triangles
     unsigned int iCurrent = 0;
     for (unsigned int i = 0; i < (unsigned int)pcHeader->num_tris; ++i) {
-        pcMesh->mFaces[i].mIndices = new unsigned int[3];
+        pcMesh->mFaces[i].mIndices = AllocateSceneArray<unsigned int>(3);
         pcMesh->mFaces[i].mNumIndices = 3;
 
         unsigned int iTemp = iCurrent;
@@ -543,7 +543,7 @@ void MDLImporter::SetupMaterialProperties_3DGS_MDL5_Quake1() {
     const MDL::Header *const pcHeader = (const MDL::Header *)this->mBuffer;
 
     // allocate ONE material
-    pScene->mMaterials = new aiMaterial *[1];
+    pScene->mMaterials = AllocateSceneArray<aiMaterial *>(1);
     pScene->mMaterials[0] = new aiMaterial();
     pScene->mNumMaterials = 1;
 
@@ -558,7 +558,7 @@ void MDLImporter::SetupMaterialProperties_3DGS_MDL5_Quake1() {
         clr = this->ReplaceTextureWithColor(pScene->mTextures[0]);
         if (is_not_qnan(clr.r)) {
             delete pScene->mTextures[0];
-            delete[] pScene->mTextures;
+            FreeSceneArray(pScene->mTextures);
 
             pScene->mTextures = nullptr;
             pScene->mNumTextures = 0;
@@ -662,10 +662,10 @@ void MDLImporter::InternReadFile_3DGS_MDL345() {
     // there won't be more than one mesh inside the file
     pScene->mRootNode = new aiNode();
     pScene->mRootNode->mNumMeshes = 1;
-    pScene->mRootNode->mMeshes = new unsigned int[1];
+    pScene->mRootNode->mMeshes = AllocateSceneArray<unsigned int>(1);
     pScene->mRootNode->mMeshes[0] = 0;
     pScene->mNumMeshes = 1;
-    pScene->mMeshes = new aiMesh *[1];
+    pScene->mMeshes = AllocateSceneArray<aiMesh *>(1);
     pScene->mMeshes[0] = pcMesh;
 
     // allocate output storage
@@ -695,7 +695,7 @@ void MDLImporter::InternReadFile_3DGS_MDL345() {
         // now iterate through all triangles
         unsigned int iCurrent = 0;
         for (unsigned int i = 0; i < (unsigned int)pcHeader->num_tris; ++i) {
-            pcMesh->mFaces[i].mIndices = new unsigned int[3];
+            pcMesh->mFaces[i].mIndices = AllocateSceneArray<unsigned int>(3);
             pcMesh->mFaces[i].mNumIndices = 3;
 
             unsigned int iTemp = iCurrent;
@@ -750,7 +750,7 @@ void MDLImporter::InternReadFile_3DGS_MDL345() {
         // now iterate through all triangles
         unsigned int iCurrent = 0;
         for (unsigned int i = 0; i < (unsigned int)pcHeader->num_tris; ++i) {
-            pcMesh->mFaces[i].mIndices = new unsigned int[3];
+            pcMesh->mFaces[i].mIndices = AllocateSceneArray<unsigned int>(3);
             pcMesh->mFaces[i].mNumIndices = 3;
 
             unsigned int iTemp = iCurrent;
@@ -1529,7 +1529,7 @@ void MDLImporter::InternReadFile_3DGS_MDL7() {
     for (uint32_t i = 0; i < pcHeader->groups_num; ++i)
         pScene->mNumMeshes += (unsigned int)avOutList[i].size();
 
-    pScene->mMeshes = new aiMesh *[pScene->mNumMeshes];
+    pScene->mMeshes = AllocateSceneArray<aiMesh *>(pScene->mNumMeshes);
     {
         unsigned int p = 0, q = 0;
         for (uint32_t i = 0; i < pcHeader->groups_num; ++i) {
@@ -1540,14 +1540,14 @@ void MDLImporter::InternReadFile_3DGS_MDL7() {
         }
         // we will later need an extra node to serve as parent for all bones
         if (sharedData.apcOutBones) ++pScene->mRootNode->mNumChildren;
-        this->pScene->mRootNode->mChildren = new aiNode *[pScene->mRootNode->mNumChildren];
+        this->pScene->mRootNode->mChildren = AllocateSceneArray<aiNode *>(pScene->mRootNode->mNumChildren);
         p = 0;
         for (uint32_t i = 0; i < pcHeader->groups_num; ++i) {
             if (avOutList[i].empty()) continue;
 
             aiNode *const pcNode = pScene->mRootNode->mChildren[p] = new aiNode();
             pcNode->mNumMeshes = (unsigned int)avOutList[i].size();
-            pcNode->mMeshes = new unsigned int[pcNode->mNumMeshes];
+            pcNode->mMeshes = AllocateSceneArray<unsigned int>(pcNode->mNumMeshes);
             pcNode->mParent = this->pScene->mRootNode;
             for (unsigned int a = 0; a < pcNode->mNumMeshes; ++a)
                 pcNode->mMeshes[a] = q + a;
@@ -1608,7 +1608,7 @@ void MDLImporter::InternReadFile_3DGS_MDL7() {
 // Copy materials
 void MDLImporter::CopyMaterials_3DGS_MDL7(MDL::IntSharedData_MDL7 &shared) {
     pScene->mNumMaterials = (unsigned int)shared.pcMats.size();
-    pScene->mMaterials = new aiMaterial *[pScene->mNumMaterials];
+    pScene->mMaterials = AllocateSceneArray<aiMaterial *>(pScene->mNumMaterials);
     for (unsigned int i = 0; i < pScene->mNumMaterials; ++i)
         pScene->mMaterials[i] = shared.pcMats[i];
 }
@@ -1691,7 +1691,7 @@ void MDLImporter::AddBonesToNodeGraph_3DGS_MDL7(const MDL::IntBone_MDL7 **apcBon
             ++pcParent->mNumChildren;
         }
     }
-    pcParent->mChildren = new aiNode *[pcParent->mNumChildren];
+    pcParent->mChildren = AllocateSceneArray<aiNode *>(pcParent->mNumChildren);
     unsigned int qq = 0;
     for (uint32_t i = 0; i < pcHeader->bones_num; ++i) {
 
@@ -1728,7 +1728,7 @@ void MDLImporter::BuildOutputAnims_3DGS_MDL7(
         }
     }
     if (pcAnim->mDuration) {
-        pcAnim->mChannels = new aiNodeAnim *[pcAnim->mNumChannels];
+        pcAnim->mChannels = AllocateSceneArray<aiNodeAnim *>(pcAnim->mNumChannels);
 
         unsigned int iCnt = 0;
         for (uint32_t i = 0; i < pcHeader->bones_num; ++i) {
@@ -1758,7 +1758,7 @@ void MDLImporter::BuildOutputAnims_3DGS_MDL7(
 
         // store the output animation
         pScene->mNumAnimations = 1;
-        pScene->mAnimations = new aiAnimation *[1];
+        pScene->mAnimations = AllocateSceneArray<aiAnimation *>(1);
         pScene->mAnimations[0] = pcAnim;
     } else
         delete pcAnim;
@@ -1847,7 +1847,7 @@ void MDLImporter::GenerateOutputMeshes_3DGS_MDL7(
             unsigned int iCurrent = 0;
             for (unsigned int iFace = 0; iFace < pcMesh->mNumFaces; ++iFace) {
                 pcMesh->mFaces[iFace].mNumIndices = 3;
-                pcMesh->mFaces[iFace].mIndices = new unsigned int[3];
+                pcMesh->mFaces[iFace].mIndices = AllocateSceneArray<unsigned int>(3);
 
                 unsigned int iSrcFace = splitGroupData.aiSplit[i]->operator[](iFace);
                 const MDL::IntFace_MDL7 &oldFace = groupData.pcFaces[iSrcFace];
@@ -1900,7 +1900,7 @@ void MDLImporter::GenerateOutputMeshes_3DGS_MDL7(
                         ++pcMesh->mNumBones;
                     }
                 }
-                pcMesh->mBones = new aiBone *[pcMesh->mNumBones];
+                pcMesh->mBones = AllocateSceneArray<aiBone *>(pcMesh->mNumBones);
                 iCurrent = 0;
                 for (std::vector<std::vector<unsigned int>>::const_iterator k = aaiVWeightList.begin(); k != aaiVWeightList.end(); ++k, ++iCurrent) {
                     if ((*k).empty())
@@ -133,7 +133,7 @@ void MDLImporter::CreateTextureARGB8_3DGS_MDL3(const unsigned char *szData) {
     pcNew->mWidth = pcHeader->skinwidth;
     pcNew->mHeight = pcHeader->skinheight;
 
-    pcNew->pcData = new aiTexel[pcNew->mWidth * pcNew->mHeight];
+    pcNew->pcData = AllocateSceneArray<aiTexel>(pcNew->mWidth * pcNew->mHeight);
 
     const unsigned char *szColorMap;
     this->SearchPalette(&szColorMap);
@@ -153,13 +153,13 @@ void MDLImporter::CreateTextureARGB8_3DGS_MDL3(const unsigned char *szData) {
 
     // store the texture
     aiTexture **pc = this->pScene->mTextures;
-    this->pScene->mTextures = new aiTexture *[pScene->mNumTextures + 1];
+    this->pScene->mTextures = AllocateSceneArray<aiTexture *>(pScene->mNumTextures + 1);
     for (unsigned int i = 0; i < pScene->mNumTextures; ++i)
         pScene->mTextures[i] = pc[i];
 
     pScene->mTextures[this->pScene->mNumTextures] = pcNew;
     pScene->mNumTextures++;
-    delete[] pc;
+    FreeSceneArray(pc);
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -190,16 +190,16 @@ void MDLImporter::CreateTexture_3DGS_MDL4(const unsigned char *szData,
     if (!bNoRead) {
         if (!this->pScene->mNumTextures) {
             pScene->mNumTextures = 1;
-            pScene->mTextures = new aiTexture *[1];
+            pScene->mTextures = AllocateSceneArray<aiTexture *>(1);
             pScene->mTextures[0] = pcNew;
         } else {
             aiTexture **pc = pScene->mTextures;
-            pScene->mTextures = new aiTexture *[pScene->mNumTextures + 1];
+            pScene->mTextures = AllocateSceneArray<aiTexture *>(pScene->mNumTextures + 1);
             for (unsigned int i = 0; i < this->pScene->mNumTextures; ++i)
                 pScene->mTextures[i] = pc[i];
             pScene->mTextures[pScene->mNumTextures] = pcNew;
             pScene->mNumTextures++;
-            delete[] pc;
+            FreeSceneArray(pc);
         }
     } else {
         pcNew->pcData = nullptr;
@@ -218,7 +218,7 @@ void MDLImporter::ParseTextureColorData(const unsigned char *szData,
 
     // allocate storage for the texture image
     if (do_read) {
-        pcNew->pcData = new aiTexel[pcNew->mWidth * pcNew->mHeight];
+        pcNew->pcData = AllocateSceneArray<aiTexel>(pcNew->mWidth * pcNew->mHeight);
     }
 
     // R5G6B5 format (with or without MIPs)
@@ -402,7 +402,7 @@ void MDLImporter::CreateTexture_3DGS_MDL5(const unsigned char *szData,
             pcNew->achFormatHint[2] = 's';
             pcNew->achFormatHint[3] = '\0';
 
-            pcNew->pcData = (aiTexel *)new unsigned char[pcNew->mWidth];
+            pcNew->pcData = reinterpret_cast<aiTexel *>(AllocateSceneArray<unsigned char>(pcNew->mWidth));
             ::memcpy(pcNew->pcData, szData, pcNew->mWidth);
         }
     } else {
@@ -415,17 +415,17 @@ void MDLImporter::CreateTexture_3DGS_MDL5(const unsigned char *szData,
         // store the texture
         if (!this->pScene->mNumTextures) {
             pScene->mNumTextures = 1;
-            pScene->mTextures = new aiTexture *[1];
+            pScene->mTextures = AllocateSceneArray<aiTexture *>(1);
             pScene->mTextures[0] = pcNew;
         } else {
             aiTexture **pc = pScene->mTextures;
-            pScene->mTextures = new aiTexture *[pScene->mNumTextures + 1];
+            pScene->mTextures = AllocateSceneArray<aiTexture *>(pScene->mNumTextures + 1);
             for (unsigned int i = 0; i < pScene->mNumTextures; ++i)
                 this->pScene->mTextures[i] = pc[i];
 
             pScene->mTextures[pScene->mNumTextures] = pcNew;
             pScene->mNumTextures++;
-            delete[] pc;
+            FreeSceneArray(pc);
         }
     } else {
         pcNew->pcData = nullptr;
@@ -469,7 +469,7 @@ void MDLImporter::ParseSkinLump_3DGS_MDL7(
         pcNew->achFormatHint[2] = 's';
         pcNew->achFormatHint[3] = '\0';
 
-        pcNew->pcData = (aiTexel *)new unsigned char[pcNew->mWidth];
+        pcNew->pcData = reinterpret_cast<aiTexel *>(AllocateSceneArray<unsigned char>(pcNew->mWidth));
         memcpy(pcNew->pcData, szCurrent, pcNew->mWidth);
         szCurrent += iWidth;
     } else if (0x7 == iMasked) {
@@ -498,7 +498,7 @@ void MDLImporter::ParseSkinLump_3DGS_MDL7(
 
             // generate an empty chess pattern
             pcNew->mWidth = pcNew->mHeight = 8;
-            pcNew->pcData = new aiTexel[64];
+            pcNew->pcData = AllocateSceneArray<aiTexel>(64);
             for (unsigned int x = 0; x < 8; ++x) {
                 for (unsigned int y = 0; y < 8; ++y) {
                     const bool bSet = ((0 == x % 2 && 0 != y % 2) ||
@@ -646,18 +646,18 @@ void MDLImporter::ParseSkinLump_3DGS_MDL7(
         // store the texture
         if (!pScene->mNumTextures) {
             pScene->mNumTextures = 1;
-            pScene->mTextures = new aiTexture *[1];
+            pScene->mTextures = AllocateSceneArray<aiTexture *>(1);
             pScene->mTextures[0] = pcNew.release();
         } else {
             aiTexture **pc = pScene->mTextures;
-            pScene->mTextures = new aiTexture *[pScene->mNumTextures + 1];
+            pScene->mTextures = AllocateSceneArray<aiTexture *>(pScene->mNumTextures + 1);
             for (unsigned int i = 0; i < pScene->mNumTextures; ++i) {
                 pScene->mTextures[i] = pc[i];
             }
 
             pScene->mTextures[pScene->mNumTextures] = pcNew.release();
             pScene->mNumTextures++;
-            delete[] pc;
+            FreeSceneArray(pc);
         }
     }
     VALIDATE_FILE_SIZE(szCurrent);
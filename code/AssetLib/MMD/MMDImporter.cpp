@@ -151,13 +151,13 @@ void MMDImporter::CreateDataFromImport(const pmx::PmxModel *pModel,
 
     // split mesh by materials
     pNode->mNumMeshes = pModel->material_count;
-    pNode->mMeshes = new unsigned int[pNode->mNumMeshes];
+    pNode->mMeshes = AllocateSceneArray<unsigned int>(pNode->mNumMeshes);
     for (unsigned int index = 0; index < pNode->mNumMeshes; index++) {
         pNode->mMeshes[index] = index;
     }
 
     pScene->mNumMeshes = pModel->material_count;
-    pScene->mMeshes = new aiMesh *[pScene->mNumMeshes];
+    pScene->mMeshes = AllocateSceneArray<aiMesh *>(pScene->mNumMeshes);
     for (unsigned int i = 0, indexStart = 0; i < pScene->mNumMeshes; i++) {
         const int indexCount = pModel->materials[i].index_count;
 
@@ -168,7 +168,7 @@ void MMDImporter::CreateDataFromImport(const pmx::PmxModel *pModel,
     }
 
     // create node hierarchy for bone position
-    std::unique_ptr<aiNode *[]> ppNode(new aiNode *[pModel->bone_count]);
+    std::unique_ptr<aiNode *[]> ppNode(AllocateSceneArray<aiNode *>(pModel->bone_count));
     for (auto i = 0; i < pModel->bone_count; i++) {
         ppNode[i] = new aiNode(pModel->bones[i].bone_name);
     }
@@ -191,7 +191,7 @@ void MMDImporter::CreateDataFromImport(const pmx::PmxModel *pModel,
 
     // create materials
     pScene->mNumMaterials = pModel->material_count;
-    pScene->mMaterials = new aiMaterial *[pScene->mNumMaterials];
+    pScene->mMaterials = AllocateSceneArray<aiMaterial *>(pScene->mNumMaterials);
     for (unsigned int i = 0; i < pScene->mNumMaterials; i++) {
         pScene->mMaterials[i] = CreateMaterial(&pModel->materials[i], pModel);
     }
@@ -220,7 +220,7 @@ aiMesh *MMDImporter::CreateMesh(const pmx::PmxModel *pModel,
     const int numIndices = 3; // triangular face
     for (unsigned int index = 0; index < pMesh->mNumFaces; index++) {
         pMesh->mFaces[index].mNumIndices = numIndices;
-        unsigned int *indices = new unsigned int[numIndices];
+        unsigned int *indices = AllocateSceneArray<unsigned int>(numIndices);
         indices[0] = numIndices * index;
         indices[1] = numIndices * index + 1;
         indices[2] = numIndices * index + 2;
@@ -312,7 +312,7 @@ aiMesh *MMDImporter::CreateMesh(const pmx::PmxModel *pModel,
 
     // make all bones for each mesh
     // assign bone weights to skinned bones (otherwise just initialize)
-    auto bone_ptr_ptr = new aiBone *[pModel->bone_count];
+    auto bone_ptr_ptr = AllocateSceneArray<aiBone *>(pModel->bone_count);
     pMesh->mNumBones = pModel->bone_count;
     pMesh->mBones = bone_ptr_ptr;
     for (auto ii = 0; ii < pModel->bone_count; ++ii) {
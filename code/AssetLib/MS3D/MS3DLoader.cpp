@@ -173,7 +173,7 @@ void MS3DImporter :: CollectChildJoints(const std::vector<TempJoint>& joints,
         }
     }
 
-    nd->mChildren = new aiNode*[nd->mNumChildren = cnt];
+    nd->mChildren = AllocateSceneArray<aiNode *>(nd->mNumChildren = cnt);
     cnt = 0;
     for(size_t i = 0; i < joints.size(); ++i) {
         if (!hadit[i] && !strcmp(joints[i].parentName,nd->mName.data)) {
@@ -434,7 +434,7 @@ void MS3DImporter::InternReadFile( const std::string& pFile,
 
     // convert materials to our generic key-value dict-alike
     if (materials.size()) {
-        pScene->mMaterials = new aiMaterial*[materials.size()];
+        pScene->mMaterials = AllocateSceneArray<aiMaterial *>(materials.size());
         for (size_t i = 0; i < materials.size(); ++i) {
 
             aiMaterial* mo = new aiMaterial();
@@ -474,7 +474,7 @@ void MS3DImporter::InternReadFile( const std::string& pFile,
         throw DeadlyImportError("MS3D: Didn't get any group records, file is malformed");
     }
 
-    pScene->mMeshes = new aiMesh*[pScene->mNumMeshes=static_cast<unsigned int>(groups.size())]();
+    pScene->mMeshes = AllocateSceneArray<aiMesh *>(pScene->mNumMeshes=static_cast<unsigned int>(groups.size()), nullptr);
     for (unsigned int i = 0; i < pScene->mNumMeshes; ++i) {
 
         aiMesh* m = pScene->mMeshes[i] = new aiMesh();
@@ -506,7 +506,7 @@ void MS3DImporter::InternReadFile( const std::string& pFile,
             }
 
             TempTriangle& t = triangles[g.triangles[j]];
-            f.mIndices = new unsigned int[f.mNumIndices=3];
+            f.mIndices = AllocateSceneArray<unsigned int>(f.mNumIndices=3);
 
             for (unsigned int k = 0; k < 3; ++k,++n) {
                 if (t.indices[k]>vertices.size()) {
@@ -538,7 +538,7 @@ void MS3DImporter::InternReadFile( const std::string& pFile,
         // allocate storage for bones
         if(!mybones.empty()) {
             std::vector<unsigned int> bmap(joints.size());
-            m->mBones = new aiBone*[mybones.size()]();
+            m->mBones = AllocateSceneArray<aiBone *>(mybones.size(), nullptr);
             for(BoneSet::const_iterator it = mybones.begin(); it != mybones.end(); ++it) {
                 aiBone* const bn = m->mBones[m->mNumBones] = new aiBone();
                 const TempJoint& jnt = joints[(*it).first];
@@ -577,7 +577,7 @@ void MS3DImporter::InternReadFile( const std::string& pFile,
     aiNode* rt = pScene->mRootNode = new aiNode("<MS3DRoot>");
 
 #ifdef ASSIMP_BUILD_MS3D_ONE_NODE_PER_MESH
-    rt->mChildren = new aiNode*[rt->mNumChildren=pScene->mNumMeshes+(joints.size()?1:0)]();
+    rt->mChildren = AllocateSceneArray<aiNode *>(rt->mNumChildren=pScene->mNumMeshes+(joints.size()?1:0), nullptr);
 
     for (unsigned int i = 0; i < pScene->mNumMeshes; ++i) {
         aiNode* nd = rt->mChildren[i] = new aiNode();
@@ -591,11 +591,11 @@ void MS3DImporter::InternReadFile( const std::string& pFile,
         nd->mName.Append(g.name);
         nd->mParent = rt;
 
-        nd->mMeshes = new unsigned int[nd->mNumMeshes = 1];
+        nd->mMeshes = AllocateSceneArray<unsigned int>(nd->mNumMeshes = 1);
         nd->mMeshes[0] = i;
     }
 #else
-    rt->mMeshes = new unsigned int[pScene->mNumMeshes];
+    rt->mMeshes = AllocateSceneArray<unsigned int>(pScene->mNumMeshes);
     for (unsigned int i = 0; i < pScene->mNumMeshes; ++i) {
         rt->mMeshes[rt->mNumMeshes++] = i;
     }
@@ -604,7 +604,7 @@ void MS3DImporter::InternReadFile( const std::string& pFile,
     // convert animations as well
     if(joints.size()) {
 #ifndef ASSIMP_BUILD_MS3D_ONE_NODE_PER_MESH
-        rt->mChildren = new aiNode*[1]();
+        rt->mChildren = AllocateSceneArray<aiNode *>(1, nullptr);
         rt->mNumChildren = 1;
 
         aiNode* jt = rt->mChildren[0] = new aiNode();
@@ -615,7 +615,7 @@ void MS3DImporter::InternReadFile( const std::string& pFile,
         CollectChildJoints(joints,jt);
         jt->mName.Set("<MS3DJointRoot>");
 
-        pScene->mAnimations = new aiAnimation*[ pScene->mNumAnimations = 1 ];
+        pScene->mAnimations = AllocateSceneArray<aiAnimation *>(pScene->mNumAnimations = 1);
         aiAnimation* const anim = pScene->mAnimations[0] = new aiAnimation();
 
         anim->mName.Set("<MS3DMasterAnim>");
@@ -628,7 +628,7 @@ void MS3DImporter::InternReadFile( const std::string& pFile,
         // to pass the validation)
         // anim->mDuration = totalframes/animfps;
 
-        anim->mChannels = new aiNodeAnim*[joints.size()]();
+        anim->mChannels = AllocateSceneArray<aiNodeAnim *>(joints.size(), nullptr);
         for(std::vector<TempJoint>::const_iterator it = joints.begin(); it != joints.end(); ++it) {
             if ((*it).rotFrames.empty() && (*it).posFrames.empty()) {
                 continue;
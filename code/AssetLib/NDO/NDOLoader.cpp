@@ -243,8 +243,8 @@ void NDOImporter::InternReadFile( const std::string& pFile,
 
     // construct a dummy node graph and add all named objects as child nodes
     aiNode* root = pScene->mRootNode = new aiNode("$NDODummyRoot");
-    aiNode** cc = root->mChildren = new aiNode* [ root->mNumChildren = static_cast<unsigned int>( objects.size()) ] ();
-    pScene->mMeshes = new aiMesh* [ root->mNumChildren] ();
+    aiNode** cc = root->mChildren = AllocateSceneArray<aiNode *>(root->mNumChildren = static_cast<unsigned int>( objects.size()), nullptr);
+    pScene->mMeshes = AllocateSceneArray<aiMesh *>(root->mNumChildren, nullptr);
 
     std::vector<aiVector3D> vertices;
     std::vector<unsigned int> indices;
@@ -298,7 +298,7 @@ void NDOImporter::InternReadFile( const std::string& pFile,
                 }
             }
 
-            f.mIndices = new unsigned int[f.mNumIndices = static_cast<unsigned int>(indices.size())];
+            f.mIndices = AllocateSceneArray<unsigned int>(f.mNumIndices = static_cast<unsigned int>(indices.size()));
             std::copy(indices.begin(),indices.end(),f.mIndices);
         }
 
@@ -308,7 +308,7 @@ void NDOImporter::InternReadFile( const std::string& pFile,
         if (mesh->mNumVertices) {
             pScene->mMeshes[pScene->mNumMeshes] = mesh;
 
-            (nd->mMeshes = new unsigned int[nd->mNumMeshes=1])[0]=pScene->mNumMeshes++;
+            (nd->mMeshes = AllocateSceneArray<unsigned int>(nd->mNumMeshes=1))[0]=pScene->mNumMeshes++;
         }else
             delete mesh;
     }
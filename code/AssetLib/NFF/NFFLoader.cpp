@@ -972,9 +972,9 @@ void NFFImporter::InternReadFile(const std::string &pFile,
     aiNode **ppcChildren = nullptr;
     unsigned int *pMeshes = nullptr;
     if (root->mNumMeshes)
-        pMeshes = root->mMeshes = new unsigned int[root->mNumMeshes];
+        pMeshes = root->mMeshes = AllocateSceneArray<unsigned int>(root->mNumMeshes);
     if (root->mNumChildren)
-        ppcChildren = root->mChildren = new aiNode *[root->mNumChildren];
+        ppcChildren = root->mChildren = AllocateSceneArray<aiNode *>(root->mNumChildren);
 
     // generate the camera
     if (hasCam) {
@@ -986,7 +986,7 @@ void NFFImporter::InternReadFile(const std::string &pFile,
 
         // allocate the camera in the scene
         pScene->mNumCameras = 1;
-        pScene->mCameras = new aiCamera *[1];
+        pScene->mCameras = AllocateSceneArray<aiCamera *>(1);
         aiCamera *c = pScene->mCameras[0] = new aiCamera;
 
         c->mName = nd->mName; // make sure the names are identical
@@ -1005,7 +1005,7 @@ void NFFImporter::InternReadFile(const std::string &pFile,
     if (!lights.empty()) {
         ai_assert(ppcChildren);
         pScene->mNumLights = (unsigned int)lights.size();
-        pScene->mLights = new aiLight *[pScene->mNumLights];
+        pScene->mLights = AllocateSceneArray<aiLight *>(pScene->mNumLights);
         for (unsigned int i = 0; i < pScene->mNumLights; ++i, ++ppcChildren) {
             const Light &l = lights[i];
 
@@ -1025,8 +1025,8 @@ void NFFImporter::InternReadFile(const std::string &pFile,
     }
 
     if (!pScene->mNumMeshes) throw DeadlyImportError("NFF: No meshes loaded");
-    pScene->mMeshes = new aiMesh *[pScene->mNumMeshes];
-    pScene->mMaterials = new aiMaterial *[pScene->mNumMaterials = pScene->mNumMeshes];
+    pScene->mMeshes = AllocateSceneArray<aiMesh *>(pScene->mNumMeshes);
+    pScene->mMaterials = AllocateSceneArray<aiMaterial *>(pScene->mNumMaterials = pScene->mNumMeshes);
     unsigned int m = 0;
     for (it = meshes.begin(); it != end; ++it) {
         if ((*it).faces.empty()) continue;
@@ -1041,7 +1041,7 @@ void NFFImporter::InternReadFile(const std::string &pFile,
             aiNode *const node = *ppcChildren = new aiNode();
             node->mParent = root;
             node->mNumMeshes = 1;
-            node->mMeshes = new unsigned int[1];
+            node->mMeshes = AllocateSceneArray<unsigned int>(1);
             node->mMeshes[0] = m;
             node->mName.Set(src.name);
 
@@ -1107,7 +1107,7 @@ void NFFImporter::InternReadFile(const std::string &pFile,
         for (std::vector<unsigned int>::const_iterator it2 = src.faces.begin(),
                                                        end2 = src.faces.end();
                 it2 != end2; ++it2, ++pFace) {
-            pFace->mIndices = new unsigned int[pFace->mNumIndices = *it2];
+            pFace->mIndices = AllocateSceneArray<unsigned int>(pFace->mNumIndices = *it2);
             for (unsigned int o = 0; o < pFace->mNumIndices; ++o)
                 pFace->mIndices[o] = p++;
         }
@@ -195,7 +195,7 @@ void OFFImporter::InternReadFile( const std::string& pFile, aiScene* pScene, IOS
     }
 
     pScene->mNumMeshes = 1;
-    pScene->mMeshes = new aiMesh*[ pScene->mNumMeshes ];
+    pScene->mMeshes = AllocateSceneArray<aiMesh *>(pScene->mNumMeshes);
 
     aiMesh* mesh = new aiMesh();
     pScene->mMeshes[0] = mesh;
@@ -308,7 +308,7 @@ void OFFImporter::InternReadFile( const std::string& pFile, aiScene* pScene, IOS
             continue;
 	}
 	faces->mNumIndices = idx;
-        faces->mIndices = new unsigned int[faces->mNumIndices];
+        faces->mIndices = AllocateSceneArray<unsigned int>(faces->mNumIndices);
         for (unsigned int m = 0; m < faces->mNumIndices;++m) {
             SkipSpaces(&sz);
             idx = strtoul10(sz,&sz);
@@ -326,12 +326,12 @@ void OFFImporter::InternReadFile( const std::string& pFile, aiScene* pScene, IOS
     pScene->mRootNode = new aiNode();
     pScene->mRootNode->mName.Set("<OFFRoot>");
     pScene->mRootNode->mNumMeshes = 1;
-    pScene->mRootNode->mMeshes = new unsigned int [pScene->mRootNode->mNumMeshes];
+    pScene->mRootNode->mMeshes = AllocateSceneArray<unsigned int>(pScene->mRootNode->mNumMeshes);
     pScene->mRootNode->mMeshes[0] = 0;
 
     // generate a default material
     pScene->mNumMaterials = 1;
-    pScene->mMaterials = new aiMaterial*[pScene->mNumMaterials];
+    pScene->mMaterials = AllocateSceneArray<aiMaterial *>(pScene->mNumMaterials);
     aiMaterial* pcMat = new aiMaterial();
 
     aiColor4D clr( ai_real( 0.6 ), ai_real( 0.6 ), ai_real( 0.6 ), ai_real( 1.0 ) );
@@ -43,6 +43,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef OBJ_FILEDATA_H_INC
 #define OBJ_FILEDATA_H_INC
 
+#include <assimp/ImportLimits.h>
 #include <assimp/mesh.h>
 #include <assimp/types.h>
 #include <map>
@@ -52,39 +53,8 @@ namespace Assimp {
 namespace ObjFile {
 
 struct Object;
-struct Face;
 struct Material;
 
-// ------------------------------------------------------------------------------------------------
-//! \struct Face
-//! \brief  Data structure for a simple obj-face, describes discredit,l.ation and materials
-// ------------------------------------------------------------------------------------------------
-struct Face {
-    typedef std::vector<unsigned int> IndexArray;
-
-    //! Primitive type
-    aiPrimitiveType m_PrimitiveType;
-    //! Vertex indices
-    IndexArray m_vertices;
-    //! Normal indices
-    IndexArray m_normals;
-    //! Texture coordinates indices
-    IndexArray m_texturCoords;
-    //! Pointer to assigned material
-    Material *m_pMaterial;
-
-    //! \brief  Default constructor
-    Face(aiPrimitiveType pt = aiPrimitiveType_POLYGON) :
-            m_PrimitiveType(pt), m_vertices(), m_normals(), m_texturCoords(), m_pMaterial(0L) {
-        // empty
-    }
-
-    //! \brief  Destructor
-    ~Face() {
-        // empty
-    }
-};
-
 // ------------------------------------------------------------------------------------------------
 //! \struct Object
 //! \brief  Stores all objects of an obj-file object definition
@@ -196,10 +166,20 @@ struct Material {
 // ------------------------------------------------------------------------------------------------
 struct Mesh {
     static const unsigned int NoMaterial = ~0u;
+    /// Marks a missing normal or texture coordinate index
+    static const unsigned int NoIndex = ~0u;
     /// The name for the mesh
     std::string m_name;
-    /// Array with pointer to all stored faces
-    std::vector<Face *> m_Faces;
+    /// Primitive type of every face
+    std::vector<unsigned char> m_FaceTypes;
+    /// Number of vertex indices of every face
+    std::vector<unsigned int> m_FaceSizes;
+    /// Vertex indices of all faces
+    std::vector<unsigned int> m_VertexIndices;
+    /// Normal indices of all faces, one per vertex index, empty if no face has normals
+    std::vector<unsigned int> m_NormalIndices;
+    /// Texture coordinate indices of all faces, one per vertex index, empty if no face has some
+    std::vector<unsigned int> m_TexCoordIndices;
     /// Assigned material
     Material *m_pMaterial;
     /// Number of stored indices.
@@ -212,6 +192,8 @@ struct Mesh {
     bool m_hasNormals;
     /// True, if vertex colors are stored.
     bool m_hasVertexColors;
+    /// Charge of the face arrays to the memory budget of the import
+    ImportLimits::Reservation m_Reserved;
 
     /// Constructor
     explicit Mesh(const std::string &name) :
@@ -225,10 +207,13 @@ struct Mesh {
 
     /// Destructor
     ~Mesh() {
-        for (std::vector<Face *>::iterator it = m_Faces.begin();
-                it != m_Faces.end(); ++it) {
-            delete *it;
-        }
+        // empty
+    }
+
+    /// Charges the current storage of the face arrays to the memory budget of the import
+    void reserveStorage() {
+        m_Reserved.Resize(m_FaceTypes.capacity() +
+                          (m_FaceSizes.capacity() + m_VertexIndices.capacity() + m_NormalIndices.capacity() + m_TexCoordIndices.capacity()) * sizeof(unsigned int));
     }
 };
 
@@ -275,6 +260,8 @@ struct Model {
     std::vector<Mesh *> m_Meshes;
     //! Material map
     std::map<std::string, Material *> m_MaterialMap;
+    //! Charge of the vertex data to the memory budget of the import
+    ImportLimits::Reservation m_Reserved;
 
     //! \brief  The default class constructor
     Model() :
@@ -314,6 +301,11 @@ struct Model {
             delete it->second;
         }
     }
+
+    //! \brief  Charges the current storage of the vertex data to the memory budget of the import
+    void reserveStorage() {
+        m_Reserved.Resize((m_Vertices.capacity() + m_Normals.capacity() + m_VertexColors.capacity() + m_TextureCoord.capacity()) * sizeof(aiVector3D));
+    }
 };
 
 // ------------------------------------------------------------------------------------------------
@@ -44,13 +44,16 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "ObjFileImporter.h"
 #include "ObjFileData.h"
 #include "ObjFileParser.h"
+#include "Common/Importer.h"
 #include <assimp/DefaultIOSystem.h>
 #include <assimp/IOStreamBuffer.h>
+#include <assimp/Profiler.h>
 #include <assimp/ai_assert.h>
 #include <assimp/importerdesc.h>
 #include <assimp/scene.h>
 #include <assimp/DefaultLogger.hpp>
 #include <assimp/Importer.hpp>
+#include <algorithm>
 #include <memory>
 
 static const aiImporterDesc desc = {
@@ -77,7 +80,11 @@ using namespace std;
 ObjFileImporter::ObjFileImporter() :
         m_Buffer(),
         m_pRootObject(nullptr),
-        m_strAbsPath(std::string(1, DefaultIOSystem().getOsSeparator())) {}
+        m_strAbsPath(std::string(1, DefaultIOSystem().getOsSeparator())),
+        m_readBlockSize(0),
+        m_readAheadDepth(0),
+        m_scheduler(nullptr),
+        m_parallelChunkSize(0) {}
 
 // ------------------------------------------------------------------------------------------------
 //  Destructor.
@@ -99,6 +106,14 @@ bool ObjFileImporter::CanRead(const std::string &pFile, IOSystem *pIOHandler, bo
     }
 }
 
+// ------------------------------------------------------------------------------------------------
+void ObjFileImporter::SetupProperties(const Importer *pImp) {
+    m_readBlockSize = static_cast<size_t>(std::max(0, pImp->GetPropertyInteger(AI_CONFIG_IMPORT_READ_BLOCK_SIZE, 0)));
+    m_readAheadDepth = static_cast<size_t>(std::max(0, pImp->GetPropertyInteger(AI_CONFIG_IMPORT_READ_AHEAD_DEPTH, 0)));
+    m_parallelChunkSize = static_cast<size_t>(std::max(0, pImp->GetPropertyInteger(AI_CONFIG_IMPORT_OBJ_PARALLEL_CHUNK_SIZE, AI_OBJ_PARALLEL_DEFAULT_CHUNK_SIZE)));
+    m_scheduler = pImp->Pimpl()->mTaskScheduler;
+}
+
 // ------------------------------------------------------------------------------------------------
 const aiImporterDesc *ObjFileImporter::GetInfo() const {
     return &desc;
@@ -123,7 +138,8 @@ void ObjFileImporter::InternReadFile(const std::string &file, aiScene *pScene, I
         throw DeadlyImportError("OBJ-file is too small.");
     }
 
-    IOStreamBuffer<char> streamedBuffer;
+    IOStreamBuffer<char> streamedBuffer(0 != m_readBlockSize ? m_readBlockSize : 4096 * 4096);
+    streamedBuffer.setReadAhead(m_readAheadDepth);
     streamedBuffer.open(fileStream.get());
 
     // Allocate buffer and read file into it
@@ -143,9 +159,11 @@ void ObjFileImporter::InternReadFile(const std::string &file, aiScene *pScene, I
     }
 
     // parse the file into a temporary representation
-    ObjFileParser parser(streamedBuffer, modelName, pIOHandler, m_progress, file);
+    Profiling::ScopedRegion phase(m_profiler, "parse");
+    ObjFileParser parser(streamedBuffer, modelName, pIOHandler, m_progress, file, m_scheduler, m_parallelChunkSize);
 
     // And create the proper return structures out of it
+    phase.Next("convert");
     CreateDataFromImport(parser.GetModel(), pScene);
 
     streamedBuffer.close();
@@ -189,7 +207,7 @@ void ObjFileImporter::CreateDataFromImport(const ObjFile::Model *pModel, aiScene
         }
 
         // Allocate space for the child nodes on the root node
-        pScene->mRootNode->mChildren = new aiNode *[childCount];
+        pScene->mRootNode->mChildren = AllocateSceneArray<aiNode *>(childCount);
 
         // Create nodes for the whole scene
         std::vector<aiMesh *> MeshArray;
@@ -202,7 +220,7 @@ void ObjFileImporter::CreateDataFromImport(const ObjFile::Model *pModel, aiScene
 
         // Create mesh pointer buffer for this scene
         if (pScene->mNumMeshes > 0) {
-            pScene->mMeshes = new aiMesh *[MeshArray.size()];
+            pScene->mMeshes = AllocateSceneArray<aiMesh *>(MeshArray.size());
             for (size_t index = 0; index < MeshArray.size(); ++index) {
                 pScene->mMeshes[index] = MeshArray[index];
             }
@@ -215,43 +233,51 @@ void ObjFileImporter::CreateDataFromImport(const ObjFile::Model *pModel, aiScene
             return;
         }
 
-        std::unique_ptr<aiMesh> mesh(new aiMesh);
-        mesh->mPrimitiveTypes = aiPrimitiveType_POINT;
-        unsigned int n = (unsigned int)pModel->m_Vertices.size();
-        mesh->mNumVertices = n;
-
-        mesh->mVertices = new aiVector3D[n];
-        memcpy(mesh->mVertices, pModel->m_Vertices.data(), n * sizeof(aiVector3D));
-
-        if (!pModel->m_Normals.empty()) {
-            mesh->mNormals = new aiVector3D[n];
-            if (pModel->m_Normals.size() < n) {
-                throw DeadlyImportError("OBJ: vertex normal index out of range");
-            }
-            memcpy(mesh->mNormals, pModel->m_Normals.data(), n * sizeof(aiVector3D));
+        const unsigned int numVertices = (unsigned int)pModel->m_Vertices.size();
+        if (!pModel->m_Normals.empty() && pModel->m_Normals.size() < numVertices) {
+            throw DeadlyImportError("OBJ: vertex normal index out of range");
         }
-
-        if (!pModel->m_VertexColors.empty()) {
-            mesh->mColors[0] = new aiColor4D[mesh->mNumVertices];
-            for (unsigned int i = 0; i < n; ++i) {
-                if (i < pModel->m_VertexColors.size()) {
-                    const aiVector3D &color = pModel->m_VertexColors[i];
-                    mesh->mColors[0][i] = aiColor4D(color.x, color.y, color.z, 1.0);
-                } else {
-                    throw DeadlyImportError("OBJ: vertex color index out of range");
-                }
-            }
+        if (!pModel->m_VertexColors.empty() && pModel->m_VertexColors.size() < numVertices) {
+            throw DeadlyImportError("OBJ: vertex color index out of range");
         }
 
+        std::unique_ptr<aiMesh> mesh = createPointCloud(pModel);
+
         pScene->mRootNode->mNumMeshes = 1;
-        pScene->mRootNode->mMeshes = new unsigned int[1];
+        pScene->mRootNode->mMeshes = AllocateSceneArray<unsigned int>(1);
         pScene->mRootNode->mMeshes[0] = 0;
-        pScene->mMeshes = new aiMesh *[1];
+        pScene->mMeshes = AllocateSceneArray<aiMesh *>(1);
         pScene->mNumMeshes = 1;
         pScene->mMeshes[0] = mesh.release();
     }
 }
 
+// ------------------------------------------------------------------------------------------------
+//  Creates a point mesh from the vertices of a model without faces
+std::unique_ptr<aiMesh> ObjFileImporter::createPointCloud(const ObjFile::Model *pModel) {
+    const unsigned int n = (unsigned int)pModel->m_Vertices.size();
+    std::unique_ptr<aiMesh> mesh(new aiMesh);
+    mesh->mPrimitiveTypes = aiPrimitiveType_POINT;
+    mesh->mNumVertices = n;
+
+    mesh->mVertices = new aiVector3D[n];
+    memcpy(mesh->mVertices, pModel->m_Vertices.data(), n * sizeof(aiVector3D));
+
+    if (!pModel->m_Normals.empty()) {
+        mesh->mNormals = new aiVector3D[n];
+        memcpy(mesh->mNormals, pModel->m_Normals.data(), n * sizeof(aiVector3D));
+    }
+
+    if (!pModel->m_VertexColors.empty()) {
+        mesh->mColors[0] = new aiColor4D[n];
+        for (unsigned int i = 0; i < n; ++i) {
+            const aiVector3D &color = pModel->m_VertexColors[i];
+            mesh->mColors[0][i] = aiColor4D(color.x, color.y, color.z, 1.0);
+        }
+    }
+    return mesh;
+}
+
 // ------------------------------------------------------------------------------------------------
 //  Creates all nodes of the model
 aiNode *ObjFileImporter::createNodes(const ObjFile::Model *pModel, const ObjFile::Object *pObject,
@@ -276,10 +302,10 @@ aiNode *ObjFileImporter::createNodes(const ObjFile::Model *pModel, const ObjFile
         unsigned int meshId = pObject->m_Meshes[i];
         aiMesh *pMesh = createTopology(pModel, pObject, meshId);
         if (pMesh) {
-            if (pMesh->mNumFaces > 0) {
-                MeshArray.push_back(pMesh);
-            } else {
+            if (pMesh->mNumFaces == 0) {
                 delete pMesh;
+            } else {
+                MeshArray.push_back(pMesh);
             }
         }
     }
@@ -288,15 +314,15 @@ aiNode *ObjFileImporter::createNodes(const ObjFile::Model *pModel, const ObjFile
     if (!pObject->m_SubObjects.empty()) {
         size_t numChilds = pObject->m_SubObjects.size();
         pNode->mNumChildren = static_cast<unsigned int>(numChilds);
-        pNode->mChildren = new aiNode *[numChilds];
+        pNode->mChildren = AllocateSceneArray<aiNode *>(numChilds);
         pNode->mNumMeshes = 1;
-        pNode->mMeshes = new unsigned int[1];
+        pNode->mMeshes = AllocateSceneArray<unsigned int>(1);
     }
 
     // Set mesh instances into scene- and node-instances
     const size_t meshSizeDiff = MeshArray.size() - oldMeshSize;
     if (meshSizeDiff > 0) {
-        pNode->mMeshes = new unsigned int[meshSizeDiff];
+        pNode->mMeshes = AllocateSceneArray<unsigned int>(meshSizeDiff);
         pNode->mNumMeshes = static_cast<unsigned int>(meshSizeDiff);
         size_t index = 0;
         for (size_t i = oldMeshSize; i < MeshArray.size(); ++i) {
@@ -325,7 +351,7 @@ aiMesh *ObjFileImporter::createTopology(const ObjFile::Model *pModel, const ObjF
         return nullptr;
     }
 
-    if (pObjMesh->m_Faces.empty()) {
+    if (pObjMesh->m_FaceSizes.empty()) {
         return nullptr;
     }
 
@@ -334,19 +360,25 @@ aiMesh *ObjFileImporter::createTopology(const ObjFile::Model *pModel, const ObjF
         pMesh->mName.Set(pObjMesh->m_name);
     }
 
-    for (size_t index = 0; index < pObjMesh->m_Faces.size(); index++) {
-        ObjFile::Face *const inp = pObjMesh->m_Faces[index];
-        ai_assert(nullptr != inp);
+    // count the output faces and indices, only the face sizes are visited
+    const size_t numSourceFaces = pObjMesh->m_FaceSizes.size();
+    unsigned int uiIdxCount(0u);
+    for (size_t index = 0; index < numSourceFaces; index++) {
+        const unsigned char type = pObjMesh->m_FaceTypes[index];
+        const unsigned int size = pObjMesh->m_FaceSizes[index];
 
-        if (inp->m_PrimitiveType == aiPrimitiveType_LINE) {
-            pMesh->mNumFaces += static_cast<unsigned int>(inp->m_vertices.size() - 1);
+        if (type == aiPrimitiveType_LINE) {
+            pMesh->mNumFaces += size - 1;
+            uiIdxCount += (size - 1) * 2;
             pMesh->mPrimitiveTypes |= aiPrimitiveType_LINE;
-        } else if (inp->m_PrimitiveType == aiPrimitiveType_POINT) {
-            pMesh->mNumFaces += static_cast<unsigned int>(inp->m_vertices.size());
+        } else if (type == aiPrimitiveType_POINT) {
+            pMesh->mNumFaces += size;
+            uiIdxCount += size;
             pMesh->mPrimitiveTypes |= aiPrimitiveType_POINT;
         } else {
             ++pMesh->mNumFaces;
-            if (inp->m_vertices.size() > 3) {
+            uiIdxCount += size;
+            if (size > 3) {
                 pMesh->mPrimitiveTypes |= aiPrimitiveType_POLYGON;
             } else {
                 pMesh->mPrimitiveTypes |= aiPrimitiveType_TRIANGLE;
@@ -354,9 +386,9 @@ aiMesh *ObjFileImporter::createTopology(const ObjFile::Model *pModel, const ObjF
         }
     }
 
-    unsigned int uiIdxCount(0u);
     if (pMesh->mNumFaces > 0) {
-        pMesh->mFaces = new aiFace[pMesh->mNumFaces];
+        // all faces point into one index block
+        unsigned int *pIndices = pMesh->AllocateFaces(pMesh->mNumFaces, uiIdxCount);
         if (pObjMesh->m_uiMaterialIndex != ObjFile::Mesh::NoMaterial) {
             pMesh->mMaterialIndex = pObjMesh->m_uiMaterialIndex;
         }
@@ -364,29 +396,31 @@ aiMesh *ObjFileImporter::createTopology(const ObjFile::Model *pModel, const ObjF
         unsigned int outIndex(0);
 
         // Copy all data from all stored meshes
-        for (auto &face : pObjMesh->m_Faces) {
-            ObjFile::Face *const inp = face;
-            if (inp->m_PrimitiveType == aiPrimitiveType_LINE) {
-                for (size_t i = 0; i < inp->m_vertices.size() - 1; ++i) {
+        for (size_t index = 0; index < numSourceFaces; index++) {
+            const unsigned char type = pObjMesh->m_FaceTypes[index];
+            const unsigned int uiNumIndices = pObjMesh->m_FaceSizes[index];
+            if (type == aiPrimitiveType_LINE) {
+                for (size_t i = 0; i < uiNumIndices - 1; ++i) {
                     aiFace &f = pMesh->mFaces[outIndex++];
-                    uiIdxCount += f.mNumIndices = 2;
-                    f.mIndices = new unsigned int[2];
+                    f.mNumIndices = 2;
+                    f.mIndices = pIndices;
+                    pIndices += 2;
                 }
                 continue;
-            } else if (inp->m_PrimitiveType == aiPrimitiveType_POINT) {
-                for (size_t i = 0; i < inp->m_vertices.size(); ++i) {
+            } else if (type == aiPrimitiveType_POINT) {
+                for (size_t i = 0; i < uiNumIndices; ++i) {
                     aiFace &f = pMesh->mFaces[outIndex++];
-                    uiIdxCount += f.mNumIndices = 1;
-                    f.mIndices = new unsigned int[1];
+                    f.mNumIndices = 1;
+                    f.mIndices = pIndices++;
                 }
                 continue;
             }
 
             aiFace *pFace = &pMesh->mFaces[outIndex++];
-            const unsigned int uiNumIndices = (unsigned int)face->m_vertices.size();
-            uiIdxCount += pFace->mNumIndices = (unsigned int)uiNumIndices;
+            pFace->mNumIndices = uiNumIndices;
             if (pFace->mNumIndices > 0) {
-                pFace->mIndices = new unsigned int[uiNumIndices];
+                pFace->mIndices = pIndices;
+                pIndices += uiNumIndices;
             }
         }
     }
@@ -440,13 +474,22 @@ void ObjFileImporter::createVertexArray(const ObjFile::Model *pModel,
         pMesh->mTextureCoords[0] = new aiVector3D[pMesh->mNumVertices];
     }
 
-    // Copy vertices, normals and textures into aiMesh instance
+    // Copy vertices, normals and textures into aiMesh instance, the normal and texture
+    // coordinate streams are either empty or run parallel to the vertex indices
+    const unsigned int *vertexIndices = pObjMesh->m_VertexIndices.data();
+    const unsigned int *normalIndices = pObjMesh->m_NormalIndices.empty() ? nullptr : pObjMesh->m_NormalIndices.data();
+    const unsigned int *texCoordIndices = pObjMesh->m_TexCoordIndices.empty() ? nullptr : pObjMesh->m_TexCoordIndices.data();
     bool normalsok = true, uvok = true;
     unsigned int newIndex = 0, outIndex = 0;
-    for (auto sourceFace : pObjMesh->m_Faces) {
+    for (size_t faceIndex = 0; faceIndex < pObjMesh->m_FaceSizes.size(); faceIndex++) {
+        const unsigned char primitiveType = pObjMesh->m_FaceTypes[faceIndex];
+        const size_t faceSize = pObjMesh->m_FaceSizes[faceIndex];
+
         // Copy all index arrays
-        for (size_t vertexIndex = 0, outVertexIndex = 0; vertexIndex < sourceFace->m_vertices.size(); vertexIndex++) {
-            const unsigned int vertex = sourceFace->m_vertices.at(vertexIndex);
+        for (size_t vertexIndex = 0, outVertexIndex = 0; vertexIndex < faceSize; vertexIndex++) {
+            const unsigned int vertex = *vertexIndices++;
+            const unsigned int normal = nullptr != normalIndices ? *normalIndices++ : ObjFile::Mesh::NoIndex;
+            const unsigned int tex = nullptr != texCoordIndices ? *texCoordIndices++ : ObjFile::Mesh::NoIndex;
             if (vertex >= pModel->m_Vertices.size()) {
                 throw DeadlyImportError("OBJ: vertex index out of range");
             }
@@ -458,8 +501,7 @@ void ObjFileImporter::createVertexArray(const ObjFile::Model *pModel,
             pMesh->mVertices[newIndex] = pModel->m_Vertices[vertex];
 
             // Copy all normals
-            if (normalsok && !pModel->m_Normals.empty() && vertexIndex < sourceFace->m_normals.size()) {
-                const unsigned int normal = sourceFace->m_normals.at(vertexIndex);
+            if (normalsok && !pModel->m_Normals.empty() && normal != ObjFile::Mesh::NoIndex) {
                 if (normal >= pModel->m_Normals.size()) {
                     normalsok = false;
                 } else {
@@ -474,9 +516,7 @@ void ObjFileImporter::createVertexArray(const ObjFile::Model *pModel,
             }
 
             // Copy all texture coordinates
-            if (uvok && !pModel->m_TextureCoord.empty() && vertexIndex < sourceFace->m_texturCoords.size()) {
-                const unsigned int tex = sourceFace->m_texturCoords.at(vertexIndex);
-
+            if (uvok && !pModel->m_TextureCoord.empty() && tex != ObjFile::Mesh::NoIndex) {
                 if (tex >= pModel->m_TextureCoord.size()) {
                     uvok = false;
                 } else {
@@ -488,16 +528,16 @@ void ObjFileImporter::createVertexArray(const ObjFile::Model *pModel,
             // Get destination face
             aiFace *pDestFace = &pMesh->mFaces[outIndex];
 
-            const bool last = (vertexIndex == sourceFace->m_vertices.size() - 1);
-            if (sourceFace->m_PrimitiveType != aiPrimitiveType_LINE || !last) {
+            const bool last = (vertexIndex == faceSize - 1);
+            if (primitiveType != aiPrimitiveType_LINE || !last) {
                 pDestFace->mIndices[outVertexIndex] = newIndex;
                 outVertexIndex++;
             }
 
-            if (sourceFace->m_PrimitiveType == aiPrimitiveType_POINT) {
+            if (primitiveType == aiPrimitiveType_POINT) {
                 outIndex++;
                 outVertexIndex = 0;
-            } else if (sourceFace->m_PrimitiveType == aiPrimitiveType_LINE) {
+            } else if (primitiveType == aiPrimitiveType_LINE) {
                 outVertexIndex = 0;
 
                 if (!last)
@@ -506,7 +546,7 @@ void ObjFileImporter::createVertexArray(const ObjFile::Model *pModel,
                 if (vertexIndex) {
                     if (!last) {
                         pMesh->mVertices[newIndex + 1] = pMesh->mVertices[newIndex];
-                        if (!sourceFace->m_normals.empty() && !pModel->m_Normals.empty()) {
+                        if (nullptr != pMesh->mNormals) {
                             pMesh->mNormals[newIndex + 1] = pMesh->mNormals[newIndex];
                         }
                         if (!pModel->m_TextureCoord.empty()) {
@@ -577,7 +617,7 @@ void ObjFileImporter::createMaterials(const ObjFile::Model *pModel, aiScene *pSc
         return;
     }
 
-    pScene->mMaterials = new aiMaterial *[numMaterials];
+    pScene->mMaterials = AllocateSceneArray<aiMaterial *>(numMaterials);
     for (unsigned int matIndex = 0; matIndex < numMaterials; matIndex++) {
         // Store material name
         std::map<std::string, ObjFile::Material *>::const_iterator it;
@@ -43,6 +43,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <assimp/BaseImporter.h>
 #include <assimp/material.h>
+#include <memory>
 #include <vector>
 
 struct aiMesh;
@@ -50,6 +51,8 @@ struct aiNode;
 
 namespace Assimp {
 
+class TaskScheduler;
+
 namespace ObjFile {
 struct Object;
 struct Model;
@@ -72,6 +75,9 @@ public:
     /// \remark See BaseImporter::CanRead() for details.
     bool CanRead(const std::string &pFile, IOSystem *pIOHandler, bool checkSig) const;
 
+    //! \brief  Reads the stream buffer configuration.
+    void SetupProperties(const Importer *pImp);
+
 private:
     //! \brief  Appends the supported extension.
     const aiImporterDesc *GetInfo() const;
@@ -82,6 +88,9 @@ private:
     //! \brief  Create the data from imported content.
     void CreateDataFromImport(const ObjFile::Model *pModel, aiScene *pScene);
 
+    //! \brief  Creates a point mesh from the vertices of a model without faces.
+    std::unique_ptr<aiMesh> createPointCloud(const ObjFile::Model *pModel);
+
     //! \brief  Creates all nodes stored in imported content.
     aiNode *createNodes(const ObjFile::Model *pModel, const ObjFile::Object *pData,
             aiNode *pParent, aiScene *pScene, std::vector<aiMesh *> &MeshArray);
@@ -113,6 +122,14 @@ private:
     ObjFile::Object *m_pRootObject;
     //! Absolute pathname of model in file system
     std::string m_strAbsPath;
+    //! Size of the blocks the file is read in, 0 for the default
+    size_t m_readBlockSize;
+    //! Number of blocks read ahead in the background
+    size_t m_readAheadDepth;
+    //! Scheduler of the importer for the parallel parser, may be nullptr
+    TaskScheduler *m_scheduler;
+    //! Size of the chunks parsed in parallel, 0 for none
+    size_t m_parallelChunkSize;
 };
 
 // ------------------------------------------------------------------------------------------------
@@ -46,6 +46,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "ObjTools.h"
 #include <assimp/ParsingUtils.h>
 #include <assimp/fast_atof.h>
+#include <assimp/ImportLimits.h>
 #include <assimp/material.h>
 #include <stdlib.h>
 #include <assimp/DefaultLogger.hpp>
@@ -114,6 +115,7 @@ void ObjFileMtlImporter::load() {
         return;
 
     while (m_DataIt != m_DataItEnd) {
+        ImportLimits::Poll();
         switch (*m_DataIt) {
             case 'k':
             case 'K': {
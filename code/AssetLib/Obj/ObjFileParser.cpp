@@ -46,17 +46,23 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "ObjTools.h"
 #include <assimp/BaseImporter.h>
 #include <assimp/DefaultIOSystem.h>
+#include <assimp/ImportLimits.h>
 #include <assimp/ParsingUtils.h>
 #include <assimp/material.h>
 #include <assimp/DefaultLogger.hpp>
 #include <assimp/Importer.hpp>
+#include <assimp/MemoryIOWrapper.h>
+#include "Common/TaskScheduler.h"
+#include <algorithm>
 #include <cstdlib>
+#include <cstring>
 #include <memory>
 #include <utility>
 
 namespace Assimp {
 
 const std::string ObjFileParser::DEFAULT_MATERIAL = AI_DEFAULT_MATERIAL_NAME;
+const unsigned int ObjFile::Mesh::NoIndex;
 
 ObjFileParser::ObjFileParser() :
         m_DataIt(),
@@ -64,23 +70,33 @@ ObjFileParser::ObjFileParser() :
         m_pModel(nullptr),
         m_uiLine(0),
         m_buffer(),
+        m_faceVertices(),
+        m_faceNormals(),
+        m_faceTexCoords(),
         m_pIO(nullptr),
         m_progress(nullptr),
-        m_originalObjFileName() {
+        m_originalObjFileName(),
+        m_scheduler(nullptr),
+        m_parallelChunkSize(0) {
     std::fill_n(m_buffer, Buffersize, '\0');
 }
 
 ObjFileParser::ObjFileParser(IOStreamBuffer<char> &streamBuffer, const std::string &modelName,
         IOSystem *io, ProgressHandler *progress,
-        const std::string &originalObjFileName) :
+        const std::string &originalObjFileName, TaskScheduler *scheduler, size_t parallelChunkSize) :
         m_DataIt(),
         m_DataItEnd(),
         m_pModel(nullptr),
         m_uiLine(0),
         m_buffer(),
+        m_faceVertices(),
+        m_faceNormals(),
+        m_faceTexCoords(),
         m_pIO(io),
         m_progress(progress),
-        m_originalObjFileName(originalObjFileName) {
+        m_originalObjFileName(originalObjFileName),
+        m_scheduler(scheduler),
+        m_parallelChunkSize(parallelChunkSize) {
     std::fill_n(m_buffer, Buffersize, '\0');
 
     // Create the model instance to store all the data
@@ -101,8 +117,8 @@ ObjFileParser::~ObjFileParser() {
 }
 
 void ObjFileParser::setBuffer(std::vector<char> &buffer) {
-    m_DataIt = buffer.begin();
-    m_DataItEnd = buffer.end();
+    m_DataIt = buffer.data();
+    m_DataItEnd = buffer.data() + buffer.size();
 }
 
 ObjFile::Model *ObjFileParser::GetModel() const {
@@ -110,6 +126,12 @@ ObjFile::Model *ObjFileParser::GetModel() const {
 }
 
 void ObjFileParser::parseFile(IOStreamBuffer<char> &streamBuffer) {
+    if (nullptr != m_scheduler && m_scheduler->GetNumThreads() > 1 && 0 != m_parallelChunkSize &&
+            streamBuffer.size() / 2 >= m_parallelChunkSize) {
+        parseFileParallel(streamBuffer);
+        return;
+    }
+
     // only update every 100KB or it'll be too slow
     //const unsigned int updateProgressEveryBytes = 100 * 1024;
     unsigned int progressCounter = 0;
@@ -118,10 +140,13 @@ void ObjFileParser::parseFile(IOStreamBuffer<char> &streamBuffer) {
     unsigned int processed = 0;
     size_t lastFilePos(0);
 
-    std::vector<char> buffer;
-    while (streamBuffer.getNextDataLine(buffer, '\\')) {
-        m_DataIt = buffer.begin();
-        m_DataItEnd = buffer.end();
+    const char *line = nullptr;
+    size_t lineLength = 0;
+    while (streamBuffer.getNextDataLineView(line, lineLength, '\\')) {
+        ImportLimits::Poll();
+        m_pModel->reserveStorage();
+        m_DataIt = line;
+        m_DataItEnd = line + lineLength + 1;
 
         // Handle progress reporting
         const size_t filePos(streamBuffer.getFilePos());
@@ -132,100 +157,494 @@ void ObjFileParser::parseFile(IOStreamBuffer<char> &streamBuffer) {
             m_progress->UpdateFileRead(processed, progressTotal);
         }
 
-        // parse line
-        switch (*m_DataIt) {
-        case 'v': // Parse a vertex texture coordinate
-        {
+        parseLine();
+    }
+}
+
+void ObjFileParser::parseLine() {
+    switch (*m_DataIt) {
+    case 'v': // Parse a vertex texture coordinate
+    {
+        ++m_DataIt;
+        if (*m_DataIt == ' ' || *m_DataIt == '\t') {
+            size_t numComponents = getNumComponentsInDataDefinition();
+            if (numComponents == 3) {
+                // read in vertex definition
+                getVector3(m_pModel->m_Vertices);
+            } else if (numComponents == 4) {
+                // read in vertex definition (homogeneous coords)
+                getHomogeneousVector3(m_pModel->m_Vertices);
+            } else if (numComponents == 6) {
+                // read vertex and vertex-color
+                getTwoVectors3(m_pModel->m_Vertices, m_pModel->m_VertexColors);
+            }
+        } else if (*m_DataIt == 't') {
+            // read in texture coordinate ( 2D or 3D )
+            ++m_DataIt;
+            size_t dim = getTexCoordVector(m_pModel->m_TextureCoord);
+            m_pModel->m_TextureCoordDim = std::max(m_pModel->m_TextureCoordDim, (unsigned int)dim);
+        } else if (*m_DataIt == 'n') {
+            // Read in normal vector definition
             ++m_DataIt;
-            if (*m_DataIt == ' ' || *m_DataIt == '\t') {
-                size_t numComponents = getNumComponentsInDataDefinition();
-                if (numComponents == 3) {
-                    // read in vertex definition
-                    getVector3(m_pModel->m_Vertices);
-                } else if (numComponents == 4) {
-                    // read in vertex definition (homogeneous coords)
-                    getHomogeneousVector3(m_pModel->m_Vertices);
-                } else if (numComponents == 6) {
-                    // read vertex and vertex-color
-                    getTwoVectors3(m_pModel->m_Vertices, m_pModel->m_VertexColors);
+            getVector3(m_pModel->m_Normals);
+        }
+    } break;
+
+    case 'p': // Parse a face, line or point statement
+    case 'l':
+    case 'f': {
+        getFace(*m_DataIt == 'f' ? aiPrimitiveType_POLYGON : (*m_DataIt == 'l' ? aiPrimitiveType_LINE : aiPrimitiveType_POINT));
+    } break;
+
+    case '#': // Parse a comment
+    {
+        getComment();
+    } break;
+
+    case 'u': // Parse a material desc. setter
+    {
+        std::string name;
+
+        getNameNoSpace(m_DataIt, m_DataItEnd, name);
+
+        size_t nextSpace = name.find(' ');
+        if (nextSpace != std::string::npos)
+            name = name.substr(0, nextSpace);
+
+        if (name == "usemtl") {
+            getMaterialDesc();
+        }
+    } break;
+
+    case 'm': // Parse a material library or merging group ('mg')
+    {
+        std::string name;
+
+        getNameNoSpace(m_DataIt, m_DataItEnd, name);
+
+        size_t nextSpace = name.find(' ');
+        if (nextSpace != std::string::npos)
+            name = name.substr(0, nextSpace);
+
+        if (name == "mg")
+            getGroupNumberAndResolution();
+        else if (name == "mtllib")
+            getMaterialLib();
+        else
+            goto pf_skip_line;
+    } break;
+
+    case 'g': // Parse group name
+    {
+        getGroupName();
+    } break;
+
+    case 's': // Parse group number
+    {
+        getGroupNumber();
+    } break;
+
+    case 'o': // Parse object name
+    {
+        getObjectName();
+    } break;
+
+    default: {
+    pf_skip_line:
+        m_DataIt = skipLine<DataArrayIt>(m_DataIt, m_DataItEnd, m_uiLine);
+    } break;
+    }
+}
+
+// -------------------------------------------------------------------
+//  A chunk of the file, its vertex data and the faces and lines to merge in file order
+struct ObjFileParser::Chunk {
+    //! Part of an index stream
+    struct Range {
+        size_t mBegin;
+        size_t mCount;
+    };
+
+    //! A face parsed on the worker or a line parsed when the chunks are merged
+    struct Event {
+        //! The event is a face, its indices are stored in the chunk's index streams
+        bool mIsFace;
+        aiPrimitiveType mType;
+        Range mVertexRange;
+        Range mNormalRange;
+        Range mTexCoordRange;
+        //! The face comes with its line in case it needs to be remapped
+        bool mHasLine;
+        //! The indices are relative to the vertex data in front of the chunk
+        bool mRelative;
+        //! The texture coordinate indices refer to normals if there are no
+        //! texture coordinates in front of the chunk, see getFace()
+        bool mMayRemap;
+        //! The chunk has normals in front of the face
+        bool mNormalsSeen;
+        //! Position of the line in mLines
+        size_t mLineBegin;
+        size_t mLineLength;
+        //! Sizes of the chunk's vertex data in front of the line
+        size_t mNumVertices;
+        size_t mNumTextureCoords;
+        size_t mNumNormals;
+        size_t mNumVertexColors;
+    };
+
+    Chunk(const char *data, size_t length) :
+            mData(data),
+            mLength(length),
+            mModel(),
+            mEvents(),
+            mVertexIndices(),
+            mNormalIndices(),
+            mTexCoordIndices(),
+            mLines() {
+        // empty
+    }
+
+    //! Appends indices to one of the index streams
+    static Range appendIndices(std::vector<unsigned int> &stream, const std::vector<unsigned int> &indices) {
+        Range range = { stream.size(), indices.size() };
+        stream.insert(stream.end(), indices.begin(), indices.end());
+        return range;
+    }
+
+    //! Appends an event for the line
+    Event &addLine(const ObjFile::Model &model, const char *line, size_t length) {
+        mEvents.emplace_back();
+        Event &event = mEvents.back();
+        event.mHasLine = true;
+        event.mLineBegin = mLines.size();
+        event.mLineLength = length;
+        event.mNumVertices = model.m_Vertices.size();
+        event.mNumTextureCoords = model.m_TextureCoord.size();
+        event.mNumNormals = model.m_Normals.size();
+        event.mNumVertexColors = model.m_VertexColors.size();
+        mLines.append(line, length);
+        mLines += '\n';
+        mLines += '\0';
+        return event;
+    }
+
+    const char *mData;
+    size_t mLength;
+    std::unique_ptr<ObjFile::Model> mModel;
+    std::vector<Event> mEvents;
+    //! Indices of the faces
+    std::vector<unsigned int> mVertexIndices;
+    std::vector<unsigned int> mNormalIndices;
+    std::vector<unsigned int> mTexCoordIndices;
+    //! The lines to parse when merging, each followed by a line end and a terminator
+    std::string mLines;
+    //! Charge of the events, indices and lines to the memory budget of the import
+    ImportLimits::Reservation mReserved;
+
+    //! Charges the current storage of the chunk to the memory budget of the import
+    void reserveStorage() {
+        mReserved.Resize(mEvents.capacity() * sizeof(Event) + mLines.capacity() +
+                         (mVertexIndices.capacity() + mNormalIndices.capacity() + mTexCoordIndices.capacity()) * sizeof(unsigned int));
+    }
+};
+
+// Returns the position behind the first line end at or after from, lines continued with
+// a backslash are never split
+static size_t findChunkEnd(const char *data, size_t from, size_t length) {
+    while (from < length) {
+        const char *lineEnd = static_cast<const char *>(::memchr(data + from, '\n', length - from));
+        if (nullptr == lineEnd) {
+            break;
+        }
+        const size_t pos = lineEnd - data;
+        const bool continued = (pos >= 1 && data[pos - 1] == '\\') ||
+                               (pos >= 2 && data[pos - 1] == '\r' && data[pos - 2] == '\\');
+        if (!continued) {
+            return pos + 1;
+        }
+        from = pos + 1;
+    }
+    return length;
+}
+
+void ObjFileParser::parseFileParallel(IOStreamBuffer<char> &streamBuffer) {
+    const size_t numChunks = 2 * m_scheduler->GetNumThreads();
+    const size_t batchSize = numChunks * m_parallelChunkSize;
+    const unsigned int progressTotal = static_cast<unsigned int>(streamBuffer.size());
+    size_t processed = 0;
+
+    // files in memory are cut in place, others are read batch by batch
+    const char *data = nullptr;
+    size_t length = 0;
+    const bool inMemory = streamBuffer.getRemainingView(data, length);
+    bool atEnd = inMemory;
+    std::vector<char> pending;
+    size_t wanted = batchSize;
+
+    std::vector<std::unique_ptr<Chunk>> chunks;
+    for (;;) {
+        if (!inMemory) {
+            const char *block = nullptr;
+            size_t blockLength = 0;
+            while (!atEnd && pending.size() < wanted) {
+                if (streamBuffer.getNextBlockView(block, blockLength)) {
+                    pending.insert(pending.end(), block, block + blockLength);
+                } else {
+                    atEnd = true;
                 }
-            } else if (*m_DataIt == 't') {
-                // read in texture coordinate ( 2D or 3D )
-                ++m_DataIt;
-                size_t dim = getTexCoordVector(m_pModel->m_TextureCoord);
-                m_pModel->m_TextureCoordDim = std::max(m_pModel->m_TextureCoordDim, (unsigned int)dim);
-            } else if (*m_DataIt == 'n') {
-                // Read in normal vector definition
-                ++m_DataIt;
-                getVector3(m_pModel->m_Normals);
             }
-        } break;
+            data = pending.data();
+            length = pending.size();
+        }
+
+        // cut the batch behind line ends, an incomplete last line waits for the next batch
+        chunks.clear();
+        size_t begin = 0;
+        while (begin < length && chunks.size() < numChunks) {
+            const size_t end = findChunkEnd(data, begin + m_parallelChunkSize - 1, length);
+            if (end == length && !atEnd) {
+                break;
+            }
+            chunks.emplace_back(new Chunk(data + begin, end - begin));
+            begin = end;
+        }
+        if (chunks.empty()) {
+            if (atEnd) {
+                break;
+            }
+            // a single line longer than a batch
+            wanted = pending.size() + m_parallelChunkSize;
+            continue;
+        }
+
+        m_scheduler->ParallelFor(chunks.size(), [&chunks](size_t i) {
+            parseChunk(*chunks[i]);
+        });
+        for (std::unique_ptr<Chunk> &chunk : chunks) {
+            ImportLimits::Poll();
+            mergeChunk(*chunk);
+            m_pModel->reserveStorage();
+            chunk.reset();
+        }
+
+        processed += begin;
+        m_progress->UpdateFileRead(static_cast<unsigned int>(processed), progressTotal);
 
-        case 'p': // Parse a face, line or point statement
+        if (inMemory) {
+            data += begin;
+            length -= begin;
+        } else {
+            pending.erase(pending.begin(), pending.begin() + begin);
+            wanted = batchSize;
+        }
+    }
+}
+
+void ObjFileParser::parseChunk(Chunk &chunk) {
+    static const size_t ChunkBlockSize = 1024 * 1024;
+
+    ObjFileParser parser;
+    parser.m_pModel.reset(new ObjFile::Model());
+    const ObjFile::Model &model = *parser.m_pModel;
+
+    // read the lines exactly like the serial parser does
+    MemoryIOStream stream(reinterpret_cast<const uint8_t *>(chunk.mData), chunk.mLength);
+    IOStreamBuffer<char> streamBuffer(std::min(chunk.mLength, ChunkBlockSize));
+    streamBuffer.open(&stream);
+
+    const char *line = nullptr;
+    size_t lineLength = 0;
+    while (streamBuffer.getNextDataLineView(line, lineLength, '\\')) {
+        ImportLimits::Poll();
+        parser.m_pModel->reserveStorage();
+        chunk.reserveStorage();
+        parser.m_DataIt = line;
+        parser.m_DataItEnd = line + lineLength + 1;
+
+        switch (*line) {
+        case 'v':
+            parser.parseLine();
+            continue;
+
+        case 'p':
         case 'l':
-        case 'f': {
-            getFace(*m_DataIt == 'f' ? aiPrimitiveType_POLYGON : (*m_DataIt == 'l' ? aiPrimitiveType_LINE : aiPrimitiveType_POINT));
-        } break;
+        case 'f':
+            if (parser.getChunkFace(*line == 'f' ? aiPrimitiveType_POLYGON : (*line == 'l' ? aiPrimitiveType_LINE : aiPrimitiveType_POINT), chunk)) {
+                continue;
+            }
+            break;
+
+        case 'u':
+        case 'm':
+        case 'g':
+        case 'o':
+            // material and group changes depend on the preceding chunks
+            break;
 
-        case '#': // Parse a comment
-        {
-            getComment();
-        } break;
+        default:
+            continue;
+        }
+
+        chunk.addLine(model, line, lineLength);
+    }
+    streamBuffer.close();
+
+    chunk.mModel = std::move(parser.m_pModel);
+}
 
-        case 'u': // Parse a material desc. setter
-        {
-            std::string name;
+bool ObjFileParser::getChunkFace(aiPrimitiveType type, Chunk &chunk) {
+    // works like getFace() on the chunk's vertex data, anything which is not
+    // plain is left to getFace() when merging
+    const char *line = m_DataIt;
+    DataArrayIt it = getNextToken<DataArrayIt>(m_DataIt, m_DataItEnd);
+    if (it == m_DataItEnd || *it == '\0') {
+        return true;
+    }
 
-            getNameNoSpace(m_DataIt, m_DataItEnd, name);
+    m_faceVertices.clear();
+    m_faceNormals.clear();
+    m_faceTexCoords.clear();
+    bool hasAbsolute = false;
+    bool hasRelative = false;
+    bool mayRemap = false;
 
-            size_t nextSpace = name.find(' ');
-            if (nextSpace != std::string::npos)
-                name = name.substr(0, nextSpace);
+    const unsigned int vSize = static_cast<unsigned int>(m_pModel->m_Vertices.size());
+    const unsigned int vtSize = static_cast<unsigned int>(m_pModel->m_TextureCoord.size());
+    const unsigned int vnSize = static_cast<unsigned int>(m_pModel->m_Normals.size());
 
-            if (name == "usemtl") {
-                getMaterialDesc();
+    const bool vt = (!m_pModel->m_TextureCoord.empty());
+    const bool vn = (!m_pModel->m_Normals.empty());
+    int iPos = 0;
+    while (it != m_DataItEnd) {
+        int iStep = 1;
+
+        if (IsLineEnd(*it)) {
+            break;
+        }
+
+        if (*it == '/') {
+            if (type == aiPrimitiveType_POINT) {
+                return false;
+            }
+            iPos++;
+        } else if (IsSpaceOrNewLine(*it)) {
+            iPos = 0;
+        } else {
+            const int iVal(::atoi(it));
+
+            int tmp = iVal;
+            if (iVal < 0) {
+                ++iStep;
+            }
+            while ((tmp = tmp / 10) != 0) {
+                ++iStep;
+            }
+
+            if (iPos == 1 && !vt) {
+                mayRemap = true;
+            }
+            if (iPos > 2 || iVal == 0) {
+                return false;
+            }
+
+            // relative indices are completed with the preceding chunks' sizes when merging,
+            // the unsigned wrap-around gives the same result as in getFace()
+            unsigned int index = static_cast<unsigned int>(iVal - 1);
+            if (iVal > 0) {
+                hasAbsolute = true;
+            } else {
+                index = (0 == iPos ? vSize : (1 == iPos ? vtSize : vnSize)) + iVal;
+                hasRelative = true;
+            }
+
+            if (0 == iPos) {
+                m_faceVertices.push_back(index);
+            } else if (1 == iPos) {
+                m_faceTexCoords.push_back(index);
+            } else {
+                m_faceNormals.push_back(index);
             }
-        } break;
-
-        case 'm': // Parse a material library or merging group ('mg')
-        {
-            std::string name;
-
-            getNameNoSpace(m_DataIt, m_DataItEnd, name);
-
-            size_t nextSpace = name.find(' ');
-            if (nextSpace != std::string::npos)
-                name = name.substr(0, nextSpace);
-
-            if (name == "mg")
-                getGroupNumberAndResolution();
-            else if (name == "mtllib")
-                getMaterialLib();
-            else
-                goto pf_skip_line;
-        } break;
-
-        case 'g': // Parse group name
-        {
-            getGroupName();
-        } break;
-
-        case 's': // Parse group number
-        {
-            getGroupNumber();
-        } break;
-
-        case 'o': // Parse object name
-        {
-            getObjectName();
-        } break;
-
-        default: {
-        pf_skip_line:
-            m_DataIt = skipLine<DataArrayIt>(m_DataIt, m_DataItEnd, m_uiLine);
-        } break;
         }
+        it += iStep;
     }
+
+    if (m_faceVertices.empty() || (hasAbsolute && hasRelative)) {
+        return false;
+    }
+
+    // only the line can be remapped if the indices are relative or normals follow
+    Chunk::Event *pEvent = nullptr;
+    if (mayRemap && (hasRelative || !m_faceNormals.empty())) {
+        pEvent = &chunk.addLine(*m_pModel, line, m_DataItEnd - 1 - line);
+    } else {
+        chunk.mEvents.emplace_back();
+        pEvent = &chunk.mEvents.back();
+    }
+    Chunk::Event &event = *pEvent;
+    event.mIsFace = true;
+    event.mType = type;
+    event.mVertexRange = Chunk::appendIndices(chunk.mVertexIndices, m_faceVertices);
+    event.mNormalRange = Chunk::appendIndices(chunk.mNormalIndices, m_faceNormals);
+    event.mTexCoordRange = Chunk::appendIndices(chunk.mTexCoordIndices, m_faceTexCoords);
+    event.mRelative = hasRelative;
+    event.mMayRemap = mayRemap;
+    event.mNormalsSeen = vn;
+
+    return true;
+}
+
+// Copies the indices of a face parsed on a worker and adds the offset
+static void copyChunkIndices(std::vector<unsigned int> &target, const std::vector<unsigned int> &source, size_t begin, size_t count, unsigned int offset) {
+    target.assign(source.begin() + begin, source.begin() + begin + count);
+    for (unsigned int &index : target) {
+        index += offset;
+    }
+}
+
+// Appends the chunk's elements up to count
+static void appendChunkData(std::vector<aiVector3D> &target, const std::vector<aiVector3D> &source, size_t &appended, size_t count) {
+    if (appended < count) {
+        target.insert(target.end(), source.begin() + appended, source.begin() + count);
+        appended = count;
+    }
+}
+
+void ObjFileParser::mergeChunk(Chunk &chunk) {
+    const ObjFile::Model &source = *chunk.mModel;
+    const unsigned int vBase = static_cast<unsigned int>(m_pModel->m_Vertices.size());
+    const unsigned int vtBase = static_cast<unsigned int>(m_pModel->m_TextureCoord.size());
+    const unsigned int vnBase = static_cast<unsigned int>(m_pModel->m_Normals.size());
+    size_t numVertices = 0, numTextureCoords = 0, numNormals = 0, numVertexColors = 0;
+
+    for (Chunk::Event &event : chunk.mEvents) {
+        const bool remap = event.mMayRemap && 0 == vtBase && (0 != vnBase || event.mNormalsSeen);
+        if (event.mIsFace && !(remap && event.mHasLine)) {
+            copyChunkIndices(m_faceVertices, chunk.mVertexIndices, event.mVertexRange.mBegin, event.mVertexRange.mCount, event.mRelative ? vBase : 0);
+            copyChunkIndices(m_faceNormals, chunk.mNormalIndices, event.mNormalRange.mBegin, event.mNormalRange.mCount, event.mRelative ? vnBase : 0);
+            copyChunkIndices(m_faceTexCoords, chunk.mTexCoordIndices, event.mTexCoordRange.mBegin, event.mTexCoordRange.mCount, event.mRelative ? vtBase : 0);
+            if (remap) {
+                m_faceNormals.swap(m_faceTexCoords);
+            }
+            storeFace(event.mType);
+            continue;
+        }
+
+        // the line sees the vertex data in front of it
+        appendChunkData(m_pModel->m_Vertices, source.m_Vertices, numVertices, event.mNumVertices);
+        appendChunkData(m_pModel->m_TextureCoord, source.m_TextureCoord, numTextureCoords, event.mNumTextureCoords);
+        appendChunkData(m_pModel->m_Normals, source.m_Normals, numNormals, event.mNumNormals);
+        appendChunkData(m_pModel->m_VertexColors, source.m_VertexColors, numVertexColors, event.mNumVertexColors);
+
+        m_DataIt = &chunk.mLines[event.mLineBegin];
+        m_DataItEnd = m_DataIt + event.mLineLength + 1;
+        parseLine();
+    }
+
+    appendChunkData(m_pModel->m_Vertices, source.m_Vertices, numVertices, source.m_Vertices.size());
+    appendChunkData(m_pModel->m_TextureCoord, source.m_TextureCoord, numTextureCoords, source.m_TextureCoord.size());
+    appendChunkData(m_pModel->m_Normals, source.m_Normals, numNormals, source.m_Normals.size());
+    appendChunkData(m_pModel->m_VertexColors, source.m_VertexColors, numVertexColors, source.m_VertexColors.size());
+    m_pModel->m_TextureCoordDim = std::max(m_pModel->m_TextureCoordDim, source.m_TextureCoordDim);
 }
 
 void ObjFileParser::copyNextWord(char *pBuffer, size_t length) {
@@ -290,116 +709,77 @@ size_t ObjFileParser::getNumComponentsInDataDefinition() {
     return numComponents;
 }
 
-size_t ObjFileParser::getTexCoordVector(std::vector<aiVector3D> &point3d_array) {
-    size_t numComponents = getNumComponentsInDataDefinition();
-    ai_real x, y, z;
-    if (2 == numComponents) {
-        copyNextWord(m_buffer, Buffersize);
-        x = (ai_real)fast_atof(m_buffer);
-
-        copyNextWord(m_buffer, Buffersize);
-        y = (ai_real)fast_atof(m_buffer);
-        z = 0.0;
-    } else if (3 == numComponents) {
-        copyNextWord(m_buffer, Buffersize);
-        x = (ai_real)fast_atof(m_buffer);
+void ObjFileParser::getRealValues(ai_real *values, size_t count) {
+    size_t numParsed = 0;
+    if (m_DataIt != m_DataItEnd) {
+        const char *begin = &(*m_DataIt);
+        const char *cur = begin;
+        numParsed = fast_atoreal_array<ai_real>(cur, begin + (m_DataItEnd - m_DataIt), values, count, false);
+        m_DataIt += cur - begin;
+    }
 
+    // continued lines and unusual tokens take the word-wise path
+    for (size_t i = numParsed; i < count; ++i) {
         copyNextWord(m_buffer, Buffersize);
-        y = (ai_real)fast_atof(m_buffer);
+        values[i] = (ai_real)fast_atof(m_buffer);
+    }
+}
 
-        copyNextWord(m_buffer, Buffersize);
-        z = (ai_real)fast_atof(m_buffer);
+size_t ObjFileParser::getTexCoordVector(std::vector<aiVector3D> &point3d_array) {
+    size_t numComponents = getNumComponentsInDataDefinition();
+    ai_real values[3] = { 0, 0, 0 };
+    if (2 == numComponents || 3 == numComponents) {
+        getRealValues(values, numComponents);
     } else {
         throw DeadlyImportError("OBJ: Invalid number of components");
     }
 
     // Coerce nan and inf to 0 as is the OBJ default value
-    if (!std::isfinite(x))
-        x = 0;
-
-    if (!std::isfinite(y))
-        y = 0;
-
-    if (!std::isfinite(z))
-        z = 0;
+    for (ai_real &value : values) {
+        if (!std::isfinite(value))
+            value = 0;
+    }
 
-    point3d_array.emplace_back(x, y, z);
+    point3d_array.emplace_back(values[0], values[1], values[2]);
     m_DataIt = skipLine<DataArrayIt>(m_DataIt, m_DataItEnd, m_uiLine);
     return numComponents;
 }
 
 void ObjFileParser::getVector3(std::vector<aiVector3D> &point3d_array) {
-    ai_real x, y, z;
-    copyNextWord(m_buffer, Buffersize);
-    x = (ai_real)fast_atof(m_buffer);
+    ai_real values[3];
+    getRealValues(values, 3);
 
-    copyNextWord(m_buffer, Buffersize);
-    y = (ai_real)fast_atof(m_buffer);
-
-    copyNextWord(m_buffer, Buffersize);
-    z = (ai_real)fast_atof(m_buffer);
-
-    point3d_array.emplace_back(x, y, z);
+    point3d_array.emplace_back(values[0], values[1], values[2]);
     m_DataIt = skipLine<DataArrayIt>(m_DataIt, m_DataItEnd, m_uiLine);
 }
 
 void ObjFileParser::getHomogeneousVector3(std::vector<aiVector3D> &point3d_array) {
-    ai_real x, y, z, w;
-    copyNextWord(m_buffer, Buffersize);
-    x = (ai_real)fast_atof(m_buffer);
-
-    copyNextWord(m_buffer, Buffersize);
-    y = (ai_real)fast_atof(m_buffer);
-
-    copyNextWord(m_buffer, Buffersize);
-    z = (ai_real)fast_atof(m_buffer);
-
-    copyNextWord(m_buffer, Buffersize);
-    w = (ai_real)fast_atof(m_buffer);
+    ai_real values[4];
+    getRealValues(values, 4);
 
+    const ai_real w = values[3];
     if (w == 0)
         throw DeadlyImportError("OBJ: Invalid component in homogeneous vector (Division by zero)");
 
-    point3d_array.emplace_back(x / w, y / w, z / w);
+    point3d_array.emplace_back(values[0] / w, values[1] / w, values[2] / w);
     m_DataIt = skipLine<DataArrayIt>(m_DataIt, m_DataItEnd, m_uiLine);
 }
 
 void ObjFileParser::getTwoVectors3(std::vector<aiVector3D> &point3d_array_a, std::vector<aiVector3D> &point3d_array_b) {
-    ai_real x, y, z;
-    copyNextWord(m_buffer, Buffersize);
-    x = (ai_real)fast_atof(m_buffer);
-
-    copyNextWord(m_buffer, Buffersize);
-    y = (ai_real)fast_atof(m_buffer);
-
-    copyNextWord(m_buffer, Buffersize);
-    z = (ai_real)fast_atof(m_buffer);
-
-    point3d_array_a.emplace_back(x, y, z);
-
-    copyNextWord(m_buffer, Buffersize);
-    x = (ai_real)fast_atof(m_buffer);
+    ai_real values[6];
+    getRealValues(values, 6);
 
-    copyNextWord(m_buffer, Buffersize);
-    y = (ai_real)fast_atof(m_buffer);
-
-    copyNextWord(m_buffer, Buffersize);
-    z = (ai_real)fast_atof(m_buffer);
-
-    point3d_array_b.emplace_back(x, y, z);
+    point3d_array_a.emplace_back(values[0], values[1], values[2]);
+    point3d_array_b.emplace_back(values[3], values[4], values[5]);
 
     m_DataIt = skipLine<DataArrayIt>(m_DataIt, m_DataItEnd, m_uiLine);
 }
 
 void ObjFileParser::getVector2(std::vector<aiVector2D> &point2d_array) {
-    ai_real x, y;
-    copyNextWord(m_buffer, Buffersize);
-    x = (ai_real)fast_atof(m_buffer);
+    ai_real values[2];
+    getRealValues(values, 2);
 
-    copyNextWord(m_buffer, Buffersize);
-    y = (ai_real)fast_atof(m_buffer);
-
-    point2d_array.emplace_back(x, y);
+    point2d_array.emplace_back(values[0], values[1]);
 
     m_DataIt = skipLine<DataArrayIt>(m_DataIt, m_DataItEnd, m_uiLine);
 }
@@ -412,8 +792,9 @@ void ObjFileParser::getFace(aiPrimitiveType type) {
         return;
     }
 
-    ObjFile::Face *face = new ObjFile::Face(type);
-    bool hasNormal = false;
+    m_faceVertices.clear();
+    m_faceNormals.clear();
+    m_faceTexCoords.clear();
 
     const int vSize = static_cast<unsigned int>(m_pModel->m_Vertices.size());
     const int vtSize = static_cast<unsigned int>(m_pModel->m_TextureCoord.size());
@@ -455,51 +836,58 @@ void ObjFileParser::getFace(aiPrimitiveType type) {
             if (iVal > 0) {
                 // Store parsed index
                 if (0 == iPos) {
-                    face->m_vertices.push_back(iVal - 1);
+                    m_faceVertices.push_back(iVal - 1);
                 } else if (1 == iPos) {
-                    face->m_texturCoords.push_back(iVal - 1);
+                    m_faceTexCoords.push_back(iVal - 1);
                 } else if (2 == iPos) {
-                    face->m_normals.push_back(iVal - 1);
-                    hasNormal = true;
+                    m_faceNormals.push_back(iVal - 1);
                 } else {
                     reportErrorTokenInFace();
                 }
             } else if (iVal < 0) {
                 // Store relatively index
                 if (0 == iPos) {
-                    face->m_vertices.push_back(vSize + iVal);
+                    m_faceVertices.push_back(vSize + iVal);
                 } else if (1 == iPos) {
-                    face->m_texturCoords.push_back(vtSize + iVal);
+                    m_faceTexCoords.push_back(vtSize + iVal);
                 } else if (2 == iPos) {
-                    face->m_normals.push_back(vnSize + iVal);
-                    hasNormal = true;
+                    m_faceNormals.push_back(vnSize + iVal);
                 } else {
                     reportErrorTokenInFace();
                 }
             } else {
                 //On error, std::atoi will return 0 which is not a valid value
-                delete face;
                 throw DeadlyImportError("OBJ: Invalid face indice");
             }
         }
         m_DataIt += iStep;
     }
 
-    if (face->m_vertices.empty()) {
+    if (m_faceVertices.empty()) {
         ASSIMP_LOG_ERROR("Obj: Ignoring empty face");
-        // skip line and clean up
+        // skip line
         m_DataIt = skipLine<DataArrayIt>(m_DataIt, m_DataItEnd, m_uiLine);
-        delete face;
         return;
     }
 
-    // Set active material, if one set
-    if (nullptr != m_pModel->m_pCurrentMaterial) {
-        face->m_pMaterial = m_pModel->m_pCurrentMaterial;
-    } else {
-        face->m_pMaterial = m_pModel->m_pDefaultMaterial;
+    storeFace(type);
+
+    // Skip the rest of the line
+    m_DataIt = skipLine<DataArrayIt>(m_DataIt, m_DataItEnd, m_uiLine);
+}
+
+// Appends the normal or texture coordinate indices of a face, the stream runs parallel
+// to the vertex indices once a face comes with such indices
+static void appendFaceIndices(std::vector<unsigned int> &stream, const std::vector<unsigned int> &indices, size_t first, size_t count) {
+    if (indices.empty() && stream.empty()) {
+        return;
     }
+    stream.resize(first, ObjFile::Mesh::NoIndex);
+    stream.insert(stream.end(), indices.begin(), indices.begin() + std::min(indices.size(), count));
+    stream.resize(first + count, ObjFile::Mesh::NoIndex);
+}
 
+void ObjFileParser::storeFace(aiPrimitiveType type) {
     // Create a default object, if nothing is there
     if (nullptr == m_pModel->m_pCurrent) {
         createObject(DefaultObjName);
@@ -511,14 +899,21 @@ void ObjFileParser::getFace(aiPrimitiveType type) {
     }
 
     // Store the face
-    m_pModel->m_pCurrentMesh->m_Faces.push_back(face);
-    m_pModel->m_pCurrentMesh->m_uiNumIndices += (unsigned int)face->m_vertices.size();
-    m_pModel->m_pCurrentMesh->m_uiUVCoordinates[0] += (unsigned int)face->m_texturCoords.size();
-    if (!m_pModel->m_pCurrentMesh->m_hasNormals && hasNormal) {
-        m_pModel->m_pCurrentMesh->m_hasNormals = true;
+    ObjFile::Mesh &mesh = *m_pModel->m_pCurrentMesh;
+    const size_t first = mesh.m_VertexIndices.size();
+    const size_t count = m_faceVertices.size();
+    mesh.m_FaceTypes.push_back(static_cast<unsigned char>(type));
+    mesh.m_FaceSizes.push_back(static_cast<unsigned int>(count));
+    mesh.m_VertexIndices.insert(mesh.m_VertexIndices.end(), m_faceVertices.begin(), m_faceVertices.end());
+    appendFaceIndices(mesh.m_NormalIndices, m_faceNormals, first, count);
+    appendFaceIndices(mesh.m_TexCoordIndices, m_faceTexCoords, first, count);
+
+    mesh.m_uiNumIndices += (unsigned int)count;
+    mesh.m_uiUVCoordinates[0] += (unsigned int)m_faceTexCoords.size();
+    mesh.reserveStorage();
+    if (!mesh.m_hasNormals && !m_faceNormals.empty()) {
+        mesh.m_hasNormals = true;
     }
-    // Skip the rest of the line
-    m_DataIt = skipLine<DataArrayIt>(m_DataIt, m_DataItEnd, m_uiLine);
 }
 
 void ObjFileParser::getMaterialDesc() {
@@ -528,7 +923,7 @@ void ObjFileParser::getMaterialDesc() {
         return;
     }
 
-    char *pStart = &(*m_DataIt);
+    const char *pStart = &(*m_DataIt);
     while (m_DataIt != m_DataItEnd && !IsLineEnd(*m_DataIt)) {
         ++m_DataIt;
     }
@@ -592,7 +987,7 @@ void ObjFileParser::getMaterialLib() {
         return;
     }
 
-    char *pStart = &(*m_DataIt);
+    const char *pStart = &(*m_DataIt);
     while (m_DataIt != m_DataItEnd && !IsLineEnd(*m_DataIt)) {
         ++m_DataIt;
     }
@@ -652,7 +1047,7 @@ void ObjFileParser::getNewMaterial() {
         return;
     }
 
-    char *pStart = &(*m_DataIt);
+    const char *pStart = &(*m_DataIt);
     std::string strMat(pStart, *m_DataIt);
     while (m_DataIt != m_DataItEnd && IsSpaceOrNewLine(*m_DataIt)) {
         ++m_DataIt;
@@ -745,7 +1140,7 @@ void ObjFileParser::getObjectName() {
     if (m_DataIt == m_DataItEnd) {
         return;
     }
-    char *pStart = &(*m_DataIt);
+    const char *pStart = &(*m_DataIt);
     while (m_DataIt != m_DataItEnd && !IsSpaceOrNewLine(*m_DataIt)) {
         ++m_DataIt;
     }
@@ -817,7 +1212,7 @@ bool ObjFileParser::needsNewMesh(const std::string &materialName) {
     if (curMatIdx != int(ObjFile::Mesh::NoMaterial) && curMatIdx != matIdx
             // no need create a new mesh if no faces in current
             // lets say 'usemtl' goes straight after 'g'
-            && !m_pModel->m_pCurrentMesh->m_Faces.empty()) {
+            && !m_pModel->m_pCurrentMesh->m_FaceSizes.empty()) {
         // New material -> only one material per mesh, so we need to create a new
         // material
         newMat = true;
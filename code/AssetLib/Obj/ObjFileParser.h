@@ -63,6 +63,7 @@ struct Point2;
 class ObjFileImporter;
 class IOSystem;
 class ProgressHandler;
+class TaskScheduler;
 
 /// \class  ObjFileParser
 /// \brief  Parser for a obj waveform file
@@ -70,14 +71,16 @@ class ASSIMP_API ObjFileParser {
 public:
     static const size_t Buffersize = 4096;
     typedef std::vector<char> DataArray;
-    typedef std::vector<char>::iterator DataArrayIt;
+    typedef const char *DataArrayIt;
     typedef std::vector<char>::const_iterator ConstDataArrayIt;
 
 public:
     /// @brief  The default constructor.
     ObjFileParser();
-    /// @brief  Constructor with data array.
-    ObjFileParser(IOStreamBuffer<char> &streamBuffer, const std::string &modelName, IOSystem *io, ProgressHandler *progress, const std::string &originalObjFileName);
+    /// @brief  Constructor with data array. Files of at least two chunks are parsed in
+    ///         parallel on the scheduler, a chunk size of 0 disables that.
+    ObjFileParser(IOStreamBuffer<char> &streamBuffer, const std::string &modelName, IOSystem *io, ProgressHandler *progress, const std::string &originalObjFileName,
+            TaskScheduler *scheduler = nullptr, size_t parallelChunkSize = 0);
     /// @brief  Destructor
     ~ObjFileParser();
     /// @brief  If you want to load in-core data.
@@ -91,12 +94,16 @@ public:
 protected:
     /// Parse the loaded file
     void parseFile(IOStreamBuffer<char> &streamBuffer);
+    /// Parse the current line.
+    void parseLine();
     /// Method to copy the new delimited word in the current line.
     void copyNextWord(char *pBuffer, size_t length);
     /// Method to copy the new line.
     //    void copyNextLine(char *pBuffer, size_t length);
     /// Get the number of components in a line.
     size_t getNumComponentsInDataDefinition();
+    /// Reads the next real values of the current line.
+    void getRealValues(ai_real *values, size_t count);
     /// Stores the vector
     size_t getTexCoordVector(std::vector<aiVector3D> &point3d_array);
     /// Stores the following 3d vector.
@@ -109,6 +116,8 @@ protected:
     void getVector2(std::vector<aiVector2D> &point2d_array);
     /// Stores the following face.
     void getFace(aiPrimitiveType type);
+    /// Adds the parsed face indices to the current mesh.
+    void storeFace(aiPrimitiveType type);
     /// Reads the material description.
     void getMaterialDesc();
     /// Gets a comment.
@@ -140,11 +149,23 @@ private:
     // Copy and assignment constructor should be private
     // because the class contains pointer to allocated memory
 
+    /// Part of the file parsed on a worker thread.
+    struct Chunk;
+
+    /// Parse the file in chunks on the scheduler and merge them in file order.
+    void parseFileParallel(IOStreamBuffer<char> &streamBuffer);
+    /// Parse the vertex data and the faces of a chunk.
+    static void parseChunk(Chunk &chunk);
+    /// Stores the following face in the chunk, false if it needs the preceding chunks.
+    bool getChunkFace(aiPrimitiveType type, Chunk &chunk);
+    /// Merges a parsed chunk into the model.
+    void mergeChunk(Chunk &chunk);
+
     /// Default material name
     static const std::string DEFAULT_MATERIAL;
-    //! Iterator to current position in buffer
+    //! Iterator to current position in the current line
     DataArrayIt m_DataIt;
-    //! Iterator to end position of buffer
+    //! Iterator to end position of the current line, behind its line end
     DataArrayIt m_DataItEnd;
     //! Pointer to model instance
     std::unique_ptr<ObjFile::Model> m_pModel;
@@ -152,12 +173,20 @@ private:
     unsigned int m_uiLine;
     //! Helper buffer
     char m_buffer[Buffersize];
+    //! Indices of the current face, reused for all faces
+    std::vector<unsigned int> m_faceVertices;
+    std::vector<unsigned int> m_faceNormals;
+    std::vector<unsigned int> m_faceTexCoords;
     /// Pointer to IO system instance.
     IOSystem *m_pIO;
     //! Pointer to progress handler
     ProgressHandler *m_progress;
     /// Path to the current model, name of the obj file where the buffer comes from
     const std::string m_originalObjFileName;
+    /// Scheduler for the parallel parser, may be nullptr.
+    TaskScheduler *m_scheduler;
+    /// Size of the chunks parsed in parallel, 0 for none.
+    size_t m_parallelChunkSize;
 };
 
 } // Namespace Assimp
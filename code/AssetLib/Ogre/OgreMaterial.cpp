@@ -102,7 +102,7 @@ void OgreImporter::ReadMaterials(const std::string &pFile, Assimp::IOSystem *pIO
 void OgreImporter::AssignMaterials(aiScene *pScene, std::vector<aiMaterial *> &materials) {
     pScene->mNumMaterials = static_cast<unsigned int>(materials.size());
     if (pScene->mNumMaterials > 0) {
-        pScene->mMaterials = new aiMaterial *[pScene->mNumMaterials];
+        pScene->mMaterials = AllocateSceneArray<aiMaterial *>(pScene->mNumMaterials);
         for (size_t i = 0; i < pScene->mNumMaterials; ++i) {
             pScene->mMaterials[i] = materials[i];
         }
@@ -411,12 +411,12 @@ void Mesh::ConvertToAssimpScene(aiScene *dest) {
 
     // Setup
     dest->mNumMeshes = static_cast<unsigned int>(NumSubMeshes());
-    dest->mMeshes = new aiMesh *[dest->mNumMeshes];
+    dest->mMeshes = AllocateSceneArray<aiMesh *>(dest->mNumMeshes);
 
     // Create root node
     dest->mRootNode = new aiNode();
     dest->mRootNode->mNumMeshes = dest->mNumMeshes;
-    dest->mRootNode->mMeshes = new unsigned int[dest->mRootNode->mNumMeshes];
+    dest->mRootNode->mMeshes = AllocateSceneArray<unsigned int>(dest->mRootNode->mNumMeshes);
 
     // Export meshes
     for (size_t i = 0; i < dest->mNumMeshes; ++i) {
@@ -430,7 +430,7 @@ void Mesh::ConvertToAssimpScene(aiScene *dest) {
         if (!skeleton->bones.empty()) {
             BoneList rootBones = skeleton->RootBones();
             dest->mRootNode->mNumChildren = static_cast<unsigned int>(rootBones.size());
-            dest->mRootNode->mChildren = new aiNode *[dest->mRootNode->mNumChildren];
+            dest->mRootNode->mChildren = AllocateSceneArray<aiNode *>(dest->mRootNode->mNumChildren);
 
             for (size_t i = 0, len = rootBones.size(); i < len; ++i) {
                 dest->mRootNode->mChildren[i] = rootBones[i]->ConvertToAssimpNode(skeleton, dest->mRootNode);
@@ -440,7 +440,7 @@ void Mesh::ConvertToAssimpScene(aiScene *dest) {
         // Animations
         if (!skeleton->animations.empty()) {
             dest->mNumAnimations = static_cast<unsigned int>(skeleton->animations.size());
-            dest->mAnimations = new aiAnimation *[dest->mNumAnimations];
+            dest->mAnimations = AllocateSceneArray<aiAnimation *>(dest->mNumAnimations);
 
             for (size_t i = 0, len = skeleton->animations.size(); i < len; ++i) {
                 dest->mAnimations[i] = skeleton->animations[i]->ConvertToAssimpAnimation();
@@ -568,7 +568,7 @@ aiMesh *SubMesh::ConvertToAssimpMesh(Mesh *parent) {
         // Source Ogre face
         aiFace ogreFace;
         ogreFace.mNumIndices = 3;
-        ogreFace.mIndices = new unsigned int[3];
+        ogreFace.mIndices = AllocateSceneArray<unsigned int>(3);
 
         faces->Seek(fi * fsize, aiOrigin_SET);
         if (indexData->is32bit) {
@@ -584,7 +584,7 @@ aiMesh *SubMesh::ConvertToAssimpMesh(Mesh *parent) {
         // Destination Assimp face
         aiFace &face = dest->mFaces[fi];
         face.mNumIndices = 3;
-        face.mIndices = new unsigned int[3];
+        face.mIndices = AllocateSceneArray<unsigned int>(3);
 
         const size_t pos = fi * 3;
         for (size_t v = 0; v < 3; ++v) {
@@ -627,7 +627,7 @@ aiMesh *SubMesh::ConvertToAssimpMesh(Mesh *parent) {
         std::set<uint16_t> referencedBones = src->ReferencedBonesByWeights();
 
         dest->mNumBones = static_cast<unsigned int>(referencedBones.size());
-        dest->mBones = new aiBone *[dest->mNumBones];
+        dest->mBones = AllocateSceneArray<aiBone *>(dest->mNumBones);
 
         size_t assimpBoneIndex = 0;
         for (std::set<uint16_t>::const_iterator rbIter = referencedBones.begin(), rbEnd = referencedBones.end(); rbIter != rbEnd; ++rbIter, ++assimpBoneIndex) {
@@ -674,12 +674,12 @@ SubMeshXml *MeshXml::GetSubMesh(uint16_t index) const {
 void MeshXml::ConvertToAssimpScene(aiScene *dest) {
     // Setup
     dest->mNumMeshes = static_cast<unsigned int>(NumSubMeshes());
-    dest->mMeshes = new aiMesh *[dest->mNumMeshes];
+    dest->mMeshes = AllocateSceneArray<aiMesh *>(dest->mNumMeshes);
 
     // Create root node
     dest->mRootNode = new aiNode();
     dest->mRootNode->mNumMeshes = dest->mNumMeshes;
-    dest->mRootNode->mMeshes = new unsigned int[dest->mRootNode->mNumMeshes];
+    dest->mRootNode->mMeshes = AllocateSceneArray<unsigned int>(dest->mRootNode->mNumMeshes);
 
     // Export meshes
     for (size_t i = 0; i < dest->mNumMeshes; ++i) {
@@ -693,7 +693,7 @@ void MeshXml::ConvertToAssimpScene(aiScene *dest) {
         if (!skeleton->bones.empty()) {
             BoneList rootBones = skeleton->RootBones();
             dest->mRootNode->mNumChildren = static_cast<unsigned int>(rootBones.size());
-            dest->mRootNode->mChildren = new aiNode *[dest->mRootNode->mNumChildren];
+            dest->mRootNode->mChildren = AllocateSceneArray<aiNode *>(dest->mRootNode->mNumChildren);
 
             for (size_t i = 0, len = rootBones.size(); i < len; ++i) {
                 dest->mRootNode->mChildren[i] = rootBones[i]->ConvertToAssimpNode(skeleton, dest->mRootNode);
@@ -703,7 +703,7 @@ void MeshXml::ConvertToAssimpScene(aiScene *dest) {
         // Animations
         if (!skeleton->animations.empty()) {
             dest->mNumAnimations = static_cast<unsigned int>(skeleton->animations.size());
-            dest->mAnimations = new aiAnimation *[dest->mNumAnimations];
+            dest->mAnimations = AllocateSceneArray<aiAnimation *>(dest->mNumAnimations);
 
             for (size_t i = 0, len = skeleton->animations.size(); i < len; ++i) {
                 dest->mAnimations[i] = skeleton->animations[i]->ConvertToAssimpAnimation();
@@ -770,7 +770,7 @@ aiMesh *SubMeshXml::ConvertToAssimpMesh(MeshXml *parent) {
         // Destination Assimp face
         aiFace &face = dest->mFaces[fi];
         face.mNumIndices = 3;
-        face.mIndices = new unsigned int[3];
+        face.mIndices = AllocateSceneArray<unsigned int>(3);
 
         const size_t pos = fi * 3;
         for (size_t v = 0; v < 3; ++v) {
@@ -805,7 +805,7 @@ aiMesh *SubMeshXml::ConvertToAssimpMesh(MeshXml *parent) {
         std::set<uint16_t> referencedBones = src->ReferencedBonesByWeights();
 
         dest->mNumBones = static_cast<unsigned int>(referencedBones.size());
-        dest->mBones = new aiBone *[dest->mNumBones];
+        dest->mBones = AllocateSceneArray<aiBone *>(dest->mNumBones);
 
         size_t assimpBoneIndex = 0;
         for (std::set<uint16_t>::const_iterator rbIter = referencedBones.begin(), rbEnd = referencedBones.end(); rbIter != rbEnd; ++rbIter, ++assimpBoneIndex) {
@@ -857,7 +857,7 @@ aiAnimation *Animation::ConvertToAssimpAnimation() {
     // Tracks
     if (!tracks.empty()) {
         anim->mNumChannels = static_cast<unsigned int>(tracks.size());
-        anim->mChannels = new aiNodeAnim *[anim->mNumChannels];
+        anim->mChannels = AllocateSceneArray<aiNodeAnim *>(anim->mNumChannels);
 
         for (size_t i = 0, len = tracks.size(); i < len; ++i) {
             anim->mChannels[i] = tracks[i].ConvertToAssimpAnimationNode(parentSkeleton);
@@ -978,7 +978,7 @@ aiNode *Bone::ConvertToAssimpNode(Skeleton *skeleton, aiNode *parentNode) {
     // Children
     if (!children.empty()) {
         node->mNumChildren = static_cast<unsigned int>(children.size());
-        node->mChildren = new aiNode *[node->mNumChildren];
+        node->mChildren = AllocateSceneArray<aiNode *>(node->mNumChildren);
 
         for (size_t i = 0, len = children.size(); i < len; ++i) {
             Bone *child = skeleton->BoneById(children[i]);
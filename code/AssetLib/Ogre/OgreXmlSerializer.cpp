@@ -385,7 +385,7 @@ void OgreXmlSerializer::ReadSubMesh(XmlNode &node, MeshXml *mesh) {
                 if (currentChildName == nnFace) {
                     aiFace face;
                     face.mNumIndices = 3;
-                    face.mIndices = new unsigned int[3];
+                    face.mIndices = AllocateSceneArray<unsigned int>(3);
                     face.mIndices[0] = ReadAttribute<uint32_t>(currentChildNode, anV1);
                     face.mIndices[1] = ReadAttribute<uint32_t>(currentChildNode, anV2);
                     face.mIndices[2] = ReadAttribute<uint32_t>(currentChildNode, anV3);
@@ -537,7 +537,7 @@ void OpenGEXImporter::handleObjectRefNode(DDLNode *node, aiScene * /*pScene*/) {
     // when we are dealing with a geometry node prepare the mesh cache
     if (m_tokenType == Grammar::GeometryNodeToken) {
         m_currentNode->mNumMeshes = static_cast<unsigned int>(objRefNames.size());
-        m_currentNode->mMeshes = new unsigned int[objRefNames.size()];
+        m_currentNode->mMeshes = AllocateSceneArray<unsigned int>(objRefNames.size());
         if (!objRefNames.empty()) {
             m_unresolvedRefStack.push_back(std::unique_ptr<RefInfo>(new RefInfo(m_currentNode, RefInfo::MeshRef, objRefNames)));
         }
@@ -934,7 +934,7 @@ void OpenGEXImporter::handleIndexArrayNode(ODDLParser::DDLNode *node, aiScene *
     for (size_t i = 0; i < m_currentMesh->mNumFaces; i++) {
         aiFace &current(m_currentMesh->mFaces[i]);
         current.mNumIndices = 3;
-        current.mIndices = new unsigned int[current.mNumIndices];
+        current.mIndices = AllocateSceneArray<unsigned int>(current.mNumIndices);
         Value *next(vaList->m_dataList);
         for (size_t indices = 0; indices < current.mNumIndices; indices++) {
             const int idx(next->getUnsignedInt32());
@@ -1162,7 +1162,7 @@ void OpenGEXImporter::copyMeshes(aiScene *pScene) {
     }
 
     pScene->mNumMeshes = static_cast<unsigned int>(m_meshCache.size());
-    pScene->mMeshes = new aiMesh *[pScene->mNumMeshes];
+    pScene->mMeshes = AllocateSceneArray<aiMesh *>(pScene->mNumMeshes);
     for (unsigned int i = 0; i < pScene->mNumMeshes; i++) {
         pScene->mMeshes[i] = m_meshCache[i].release();
     }
@@ -1177,7 +1177,7 @@ void OpenGEXImporter::copyCameras(aiScene *pScene) {
     }
 
     pScene->mNumCameras = static_cast<unsigned int>(m_cameraCache.size());
-    pScene->mCameras = new aiCamera *[pScene->mNumCameras];
+    pScene->mCameras = AllocateSceneArray<aiCamera *>(pScene->mNumCameras);
     std::copy(m_cameraCache.begin(), m_cameraCache.end(), pScene->mCameras);
 }
 
@@ -1190,7 +1190,7 @@ void OpenGEXImporter::copyLights(aiScene *pScene) {
     }
 
     pScene->mNumLights = static_cast<unsigned int>(m_lightCache.size());
-    pScene->mLights = new aiLight *[pScene->mNumLights];
+    pScene->mLights = AllocateSceneArray<aiLight *>(pScene->mNumLights);
     std::copy(m_lightCache.begin(), m_lightCache.end(), pScene->mLights);
 }
 
@@ -1203,7 +1203,7 @@ void OpenGEXImporter::copyMaterials(aiScene *pScene) {
     }
 
     pScene->mNumMaterials = static_cast<unsigned int>(m_materialCache.size());
-    pScene->mMaterials = new aiMaterial *[pScene->mNumMaterials];
+    pScene->mMaterials = AllocateSceneArray<aiMaterial *>(pScene->mNumMaterials);
     std::copy(m_materialCache.begin(), m_materialCache.end(), pScene->mMaterials);
 }
 
@@ -1261,7 +1261,7 @@ void OpenGEXImporter::createNodeTree(aiScene *pScene) {
     }
 
     pScene->mRootNode->mNumChildren = static_cast<unsigned int>(m_root->m_children.size());
-    pScene->mRootNode->mChildren = new aiNode *[pScene->mRootNode->mNumChildren];
+    pScene->mRootNode->mChildren = AllocateSceneArray<aiNode *>(pScene->mRootNode->mNumChildren);
     std::copy(m_root->m_children.begin(), m_root->m_children.end(), pScene->mRootNode->mChildren);
 }
 
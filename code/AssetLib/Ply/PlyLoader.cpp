@@ -48,9 +48,13 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 // internal headers
 #include "PlyLoader.h"
 #include <assimp/IOStreamBuffer.h>
+#include <assimp/Profiler.h>
 #include <assimp/importerdesc.h>
 #include <assimp/scene.h>
 #include <assimp/IOSystem.hpp>
+#include <assimp/Importer.hpp>
+#include <algorithm>
+#include <limits>
 #include <memory>
 
 using namespace ::Assimp;
@@ -88,10 +92,21 @@ inline const T &GetProperty(const std::vector<T> &props, int idx) {
 PLYImporter::PLYImporter() :
         mBuffer(nullptr),
         pcDOM(nullptr),
-        mGeneratedMesh(nullptr) {
+        mGeneratedMesh(nullptr),
+        mStreamPoints(false),
+        mChunkStart(0),
+        mNumFaceIndices(0),
+        mReadBlockSize(0),
+        mReadAheadDepth(0) {
     // empty
 }
 
+// ------------------------------------------------------------------------------------------------
+void PLYImporter::SetupProperties(const Importer *pImp) {
+    mReadBlockSize = static_cast<size_t>(std::max(0, pImp->GetPropertyInteger(AI_CONFIG_IMPORT_READ_BLOCK_SIZE, 0)));
+    mReadAheadDepth = static_cast<size_t>(std::max(0, pImp->GetPropertyInteger(AI_CONFIG_IMPORT_READ_AHEAD_DEPTH, 0)));
+}
+
 // ------------------------------------------------------------------------------------------------
 // Destructor, private as well
 PLYImporter::~PLYImporter() {
@@ -160,7 +175,8 @@ void PLYImporter::InternReadFile(const std::string &pFile, aiScene *pScene, IOSy
         throw DeadlyImportError("File ", pFile, " is empty.");
     }
 
-    IOStreamBuffer<char> streamedBuffer(1024 * 1024);
+    IOStreamBuffer<char> streamedBuffer(0 != mReadBlockSize ? mReadBlockSize : 1024 * 1024);
+    streamedBuffer.setReadAhead(mReadAheadDepth);
     streamedBuffer.open(fileStream.get());
 
     // the beginning of the file must be PLY - magic, magic
@@ -175,6 +191,10 @@ void PLYImporter::InternReadFile(const std::string &pFile, aiScene *pScene, IOSy
         throw DeadlyImportError("Invalid .ply file: Incorrect magic number (expected 'ply' or 'PLY').");
     }
 
+    mNumFaceIndices = 0;
+    mStreamPoints = false;
+    mChunkStart = 0;
+
     std::vector<char> mBuffer2;
     streamedBuffer.getNextLine(mBuffer2);
     mBuffer = (unsigned char *)&mBuffer2[0];
@@ -183,6 +203,7 @@ void PLYImporter::InternReadFile(const std::string &pFile, aiScene *pScene, IOSy
     SkipSpacesAndLineEnd(szMe, (const char **)&szMe);
 
     // determine the format of the file data and construct the aiMesh
+    Profiling::ScopedRegion phase(m_profiler, "parse");
     PLY::DOM sPlyDom;
     this->pcDOM = &sPlyDom;
 
@@ -235,60 +256,80 @@ void PLYImporter::InternReadFile(const std::string &pFile, aiScene *pScene, IOSy
     //free the file buffer
     streamedBuffer.close();
 
-    if (mGeneratedMesh == nullptr) {
+    if (mGeneratedMesh == nullptr && !mStreamPoints) {
         throw DeadlyImportError("Invalid .ply file: Unable to extract mesh data ");
     }
 
+    // point the faces of the face list into the index block they were read into
+    if (mNumFaceIndices && mGeneratedMesh != nullptr && mGeneratedMesh->mFaces != nullptr) {
+        mGeneratedMesh->mNumFaceIndices = static_cast<unsigned int>(mNumFaceIndices);
+
+        unsigned int *indices = mGeneratedMesh->mFaceIndices;
+        for (unsigned int i = 0; i < mGeneratedMesh->mNumFaces; ++i) {
+            aiFace &face = mGeneratedMesh->mFaces[i];
+            if (nullptr == face.mIndices && face.mNumIndices) {
+                face.mIndices = indices;
+                indices += face.mNumIndices;
+            }
+        }
+        ai_assert(indices == mGeneratedMesh->mFaceIndices + mGeneratedMesh->mNumFaceIndices);
+    }
+    mNumFaceIndices = 0;
+
     // if no face list is existing we assume that the vertex
     // list is containing a list of points
-    bool pointsOnly = mGeneratedMesh->mFaces == nullptr ? true : false;
-    if (pointsOnly) {
+    bool pointsOnly = mGeneratedMesh == nullptr || mGeneratedMesh->mFaces == nullptr;
+    if (pointsOnly && mGeneratedMesh != nullptr) {
         mGeneratedMesh->mPrimitiveTypes = aiPrimitiveType::aiPrimitiveType_POINT;
     }
 
     // now load a list of all materials
+    phase.Next("convert");
     std::vector<aiMaterial *> avMaterials;
     std::string defaultTexture;
     LoadMaterial(&avMaterials, defaultTexture, pointsOnly);
 
     // now generate the output scene object. Fill the material list
     pScene->mNumMaterials = (unsigned int)avMaterials.size();
-    pScene->mMaterials = new aiMaterial *[pScene->mNumMaterials];
+    pScene->mMaterials = AllocateSceneArray<aiMaterial *>(pScene->mNumMaterials);
     for (unsigned int i = 0; i < pScene->mNumMaterials; ++i) {
         pScene->mMaterials[i] = avMaterials[i];
     }
 
-    // fill the mesh list
+    // generate a simple node structure
+    pScene->mRootNode = new aiNode();
+
+    // fill the mesh list, all chunks of a streamed point cloud are gone already
+    if (mGeneratedMesh == nullptr) {
+        return;
+    }
     pScene->mNumMeshes = 1;
-    pScene->mMeshes = new aiMesh *[pScene->mNumMeshes];
+    pScene->mMeshes = AllocateSceneArray<aiMesh *>(pScene->mNumMeshes);
     pScene->mMeshes[0] = mGeneratedMesh;
     mGeneratedMesh = nullptr;
 
-    // generate a simple node structure
-    pScene->mRootNode = new aiNode();
     pScene->mRootNode->mNumMeshes = pScene->mNumMeshes;
-    pScene->mRootNode->mMeshes = new unsigned int[pScene->mNumMeshes];
+    pScene->mRootNode->mMeshes = AllocateSceneArray<unsigned int>(pScene->mNumMeshes);
 
     for (unsigned int i = 0; i < pScene->mRootNode->mNumMeshes; ++i) {
         pScene->mRootNode->mMeshes[i] = i;
     }
 }
 
-void PLYImporter::LoadVertex(const PLY::Element *pcElement, const PLY::ElementInstance *instElement, unsigned int pos) {
+// ------------------------------------------------------------------------------------------------
+// Extract a run of vertices from the PLY DOM, column by column
+void PLYImporter::LoadVertices(const PLY::Element *pcElement, const PLY::ElementData *data, unsigned int pos) {
     ai_assert(nullptr != pcElement);
-    ai_assert(nullptr != instElement);
+    ai_assert(nullptr != data);
 
     ai_uint aiPositions[3] = { 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF };
-    PLY::EDataType aiTypes[3] = { EDT_Char, EDT_Char, EDT_Char };
 
     ai_uint aiNormal[3] = { 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF };
-    PLY::EDataType aiNormalTypes[3] = { EDT_Char, EDT_Char, EDT_Char };
 
     unsigned int aiColors[4] = { 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF };
     PLY::EDataType aiColorsTypes[4] = { EDT_Char, EDT_Char, EDT_Char, EDT_Char };
 
     unsigned int aiTexcoord[2] = { 0xFFFFFFFF, 0xFFFFFFFF };
-    PLY::EDataType aiTexcoordTypes[2] = { EDT_Char, EDT_Char };
 
     // now check whether which normal components are available
     unsigned int _a(0), cnt(0);
@@ -302,28 +343,22 @@ void PLYImporter::LoadVertex(const PLY::Element *pcElement, const PLY::ElementIn
         if (PLY::EST_XCoord == (*a).Semantic) {
             ++cnt;
             aiPositions[0] = _a;
-            aiTypes[0] = (*a).eType;
         } else if (PLY::EST_YCoord == (*a).Semantic) {
             ++cnt;
             aiPositions[1] = _a;
-            aiTypes[1] = (*a).eType;
         } else if (PLY::EST_ZCoord == (*a).Semantic) {
             ++cnt;
             aiPositions[2] = _a;
-            aiTypes[2] = (*a).eType;
         } else if (PLY::EST_XNormal == (*a).Semantic) {
             // Normals
             ++cnt;
             aiNormal[0] = _a;
-            aiNormalTypes[0] = (*a).eType;
         } else if (PLY::EST_YNormal == (*a).Semantic) {
             ++cnt;
             aiNormal[1] = _a;
-            aiNormalTypes[1] = (*a).eType;
         } else if (PLY::EST_ZNormal == (*a).Semantic) {
             ++cnt;
             aiNormal[2] = _a;
-            aiNormalTypes[2] = (*a).eType;
         } else if (PLY::EST_Red == (*a).Semantic) {
             // Colors
             ++cnt;
@@ -345,109 +380,35 @@ void PLYImporter::LoadVertex(const PLY::Element *pcElement, const PLY::ElementIn
             // Texture coordinates
             ++cnt;
             aiTexcoord[0] = _a;
-            aiTexcoordTypes[0] = (*a).eType;
         } else if (PLY::EST_VTextureCoord == (*a).Semantic) {
             ++cnt;
             aiTexcoord[1] = _a;
-            aiTexcoordTypes[1] = (*a).eType;
         }
     }
 
     // check whether we have a valid source for the vertex data
-    if (0 != cnt) {
-        // Position
-        aiVector3D vOut;
-        if (0xFFFFFFFF != aiPositions[0]) {
-            vOut.x = PLY::PropertyInstance::ConvertTo<ai_real>(
-                    GetProperty(instElement->alProperties, aiPositions[0]).avList.front(), aiTypes[0]);
-        }
-
-        if (0xFFFFFFFF != aiPositions[1]) {
-            vOut.y = PLY::PropertyInstance::ConvertTo<ai_real>(
-                    GetProperty(instElement->alProperties, aiPositions[1]).avList.front(), aiTypes[1]);
-        }
-
-        if (0xFFFFFFFF != aiPositions[2]) {
-            vOut.z = PLY::PropertyInstance::ConvertTo<ai_real>(
-                    GetProperty(instElement->alProperties, aiPositions[2]).avList.front(), aiTypes[2]);
-        }
-
-        // Normals
-        aiVector3D nOut;
-        bool haveNormal = false;
-        if (0xFFFFFFFF != aiNormal[0]) {
-            nOut.x = PLY::PropertyInstance::ConvertTo<ai_real>(
-                    GetProperty(instElement->alProperties, aiNormal[0]).avList.front(), aiNormalTypes[0]);
-            haveNormal = true;
-        }
-
-        if (0xFFFFFFFF != aiNormal[1]) {
-            nOut.y = PLY::PropertyInstance::ConvertTo<ai_real>(
-                    GetProperty(instElement->alProperties, aiNormal[1]).avList.front(), aiNormalTypes[1]);
-            haveNormal = true;
-        }
-
-        if (0xFFFFFFFF != aiNormal[2]) {
-            nOut.z = PLY::PropertyInstance::ConvertTo<ai_real>(
-                    GetProperty(instElement->alProperties, aiNormal[2]).avList.front(), aiNormalTypes[2]);
-            haveNormal = true;
-        }
-
-        //Colors
-        aiColor4D cOut;
-        bool haveColor = false;
-        if (0xFFFFFFFF != aiColors[0]) {
-            cOut.r = NormalizeColorValue(GetProperty(instElement->alProperties,
-                                                 aiColors[0])
-                                                 .avList.front(),
-                    aiColorsTypes[0]);
-            haveColor = true;
-        }
-
-        if (0xFFFFFFFF != aiColors[1]) {
-            cOut.g = NormalizeColorValue(GetProperty(instElement->alProperties,
-                                                 aiColors[1])
-                                                 .avList.front(),
-                    aiColorsTypes[1]);
-            haveColor = true;
-        }
-
-        if (0xFFFFFFFF != aiColors[2]) {
-            cOut.b = NormalizeColorValue(GetProperty(instElement->alProperties,
-                                                 aiColors[2])
-                                                 .avList.front(),
-                    aiColorsTypes[2]);
-            haveColor = true;
-        }
-
-        // assume 1.0 for the alpha channel if it is not set
-        if (0xFFFFFFFF == aiColors[3]) {
-            cOut.a = 1.0;
-        } else {
-            cOut.a = NormalizeColorValue(GetProperty(instElement->alProperties,
-                                                 aiColors[3])
-                                                 .avList.front(),
-                    aiColorsTypes[3]);
-
-            haveColor = true;
-        }
-
-        //Texture coordinates
-        aiVector3D tOut;
-        tOut.z = 0;
-        bool haveTextureCoords = false;
-        if (0xFFFFFFFF != aiTexcoord[0]) {
-            tOut.x = PLY::PropertyInstance::ConvertTo<ai_real>(
-                    GetProperty(instElement->alProperties, aiTexcoord[0]).avList.front(), aiTexcoordTypes[0]);
-            haveTextureCoords = true;
-        }
+    if (0 == cnt) {
+        return;
+    }
 
-        if (0xFFFFFFFF != aiTexcoord[1]) {
-            tOut.y = PLY::PropertyInstance::ConvertTo<ai_real>(
-                    GetProperty(instElement->alProperties, aiTexcoord[1]).avList.front(), aiTexcoordTypes[1]);
-            haveTextureCoords = true;
+    const bool haveNormal = 0xFFFFFFFF != aiNormal[0] || 0xFFFFFFFF != aiNormal[1] || 0xFFFFFFFF != aiNormal[2];
+    const bool haveColor = 0xFFFFFFFF != aiColors[0] || 0xFFFFFFFF != aiColors[1] || 0xFFFFFFFF != aiColors[2] || 0xFFFFFFFF != aiColors[3];
+    const bool haveTextureCoords = 0xFFFFFFFF != aiTexcoord[0] || 0xFFFFFFFF != aiTexcoord[1];
+
+    // point clouds can be streamed, the vertices of meshes are
+    // needed until the last face is read
+    if (0 == pos && nullptr != m_meshSink) {
+        mStreamPoints = true;
+        for (const PLY::Element &element : pcDOM->alElements) {
+            if (PLY::EEST_Face == element.eSemantic || PLY::EEST_TriStrip == element.eSemantic) {
+                mStreamPoints = false;
+            }
         }
+    }
 
+    // a run may end in the middle of a streamed chunk or span several of them
+    unsigned int first = 0;
+    while (first < data->NumInstances) {
         //create aiMesh if needed
         if (nullptr == mGeneratedMesh) {
             mGeneratedMesh = new aiMesh();
@@ -455,54 +416,97 @@ void PLYImporter::LoadVertex(const PLY::Element *pcElement, const PLY::ElementIn
         }
 
         if (nullptr == mGeneratedMesh->mVertices) {
-            mGeneratedMesh->mNumVertices = pcElement->NumOccur;
+            mChunkStart = mStreamPoints ? pos + first : 0;
+            mGeneratedMesh->mNumVertices = mStreamPoints ? std::min(m_meshSinkChunkSize, pcElement->NumOccur - (pos + first)) : pcElement->NumOccur;
             mGeneratedMesh->mVertices = new aiVector3D[mGeneratedMesh->mNumVertices];
         }
 
-        mGeneratedMesh->mVertices[pos] = vOut;
+        const unsigned int index = pos + first - mChunkStart;
+        const unsigned int count = std::min(data->NumInstances - first, mGeneratedMesh->mNumVertices - index);
+
+        // Position, missing components stay 0
+        for (unsigned int c = 0; c < 3; ++c) {
+            if (0xFFFFFFFF != aiPositions[c]) {
+                GetProperty(data->alColumns, aiPositions[c]).Get<ai_real>(first, count, &mGeneratedMesh->mVertices[index][c], 3);
+            }
+        }
 
+        // Normals
         if (haveNormal) {
             if (nullptr == mGeneratedMesh->mNormals)
                 mGeneratedMesh->mNormals = new aiVector3D[mGeneratedMesh->mNumVertices];
-            mGeneratedMesh->mNormals[pos] = nOut;
+            for (unsigned int c = 0; c < 3; ++c) {
+                if (0xFFFFFFFF != aiNormal[c]) {
+                    GetProperty(data->alColumns, aiNormal[c]).Get<ai_real>(first, count, &mGeneratedMesh->mNormals[index][c], 3);
+                }
+            }
         }
 
+        //Colors
         if (haveColor) {
             if (nullptr == mGeneratedMesh->mColors[0])
                 mGeneratedMesh->mColors[0] = new aiColor4D[mGeneratedMesh->mNumVertices];
-            mGeneratedMesh->mColors[0][pos] = cOut;
+            aiColor4D *colors = mGeneratedMesh->mColors[0] + index;
+            for (unsigned int c = 0; c < 4; ++c) {
+                ai_real *channel = &colors->r + c;
+                if (0xFFFFFFFF == aiColors[c]) {
+                    // assume 1.0 for the alpha channel if it is not set
+                    const ai_real value = 3 == c ? (ai_real)1.0 : (ai_real)0.0;
+                    for (unsigned int i = 0; i < count; ++i) {
+                        channel[i * 4] = value;
+                    }
+                    continue;
+                }
+                GetProperty(data->alColumns, aiColors[c]).Get<ai_real>(first, count, channel, 4);
+                for (unsigned int i = 0; i < count; ++i) {
+                    channel[i * 4] = NormalizeColorValue(channel[i * 4], aiColorsTypes[c]);
+                }
+            }
         }
 
+        //Texture coordinates
         if (haveTextureCoords) {
             if (nullptr == mGeneratedMesh->mTextureCoords[0]) {
                 mGeneratedMesh->mNumUVComponents[0] = 2;
                 mGeneratedMesh->mTextureCoords[0] = new aiVector3D[mGeneratedMesh->mNumVertices];
             }
-            mGeneratedMesh->mTextureCoords[0][pos] = tOut;
+            for (unsigned int c = 0; c < 2; ++c) {
+                if (0xFFFFFFFF != aiTexcoord[c]) {
+                    GetProperty(data->alColumns, aiTexcoord[c]).Get<ai_real>(first, count, &mGeneratedMesh->mTextureCoords[0][index][c], 3);
+                }
+            }
         }
+
+        // hand over the chunk once it is complete
+        if (mStreamPoints && index + count == mGeneratedMesh->mNumVertices) {
+            mGeneratedMesh->mPrimitiveTypes = aiPrimitiveType_POINT;
+            aiMesh *chunk = mGeneratedMesh;
+            mGeneratedMesh = nullptr;
+            SinkMesh(chunk, 0);
+        }
+        first += count;
     }
 }
 
 // ------------------------------------------------------------------------------------------------
 // Convert a color component to [0...1]
-ai_real PLYImporter::NormalizeColorValue(PLY::PropertyInstance::ValueUnion val, PLY::EDataType eType) {
+ai_real PLYImporter::NormalizeColorValue(ai_real val, PLY::EDataType eType) {
     switch (eType) {
     case EDT_Float:
-        return val.fFloat;
     case EDT_Double:
-        return (ai_real)val.fDouble;
+        return val;
     case EDT_UChar:
-        return (ai_real)val.iUInt / (ai_real)0xFF;
+        return val / (ai_real)0xFF;
     case EDT_Char:
-        return (ai_real)(val.iInt + (0xFF / 2)) / (ai_real)0xFF;
+        return (val + (ai_real)(0xFF / 2)) / (ai_real)0xFF;
     case EDT_UShort:
-        return (ai_real)val.iUInt / (ai_real)0xFFFF;
+        return val / (ai_real)0xFFFF;
     case EDT_Short:
-        return (ai_real)(val.iInt + (0xFFFF / 2)) / (ai_real)0xFFFF;
+        return (val + (ai_real)(0xFFFF / 2)) / (ai_real)0xFFFF;
     case EDT_UInt:
-        return (ai_real)val.iUInt / (ai_real)0xFFFF;
+        return val / (ai_real)0xFFFF;
     case EDT_Int:
-        return ((ai_real)val.iInt / (ai_real)0xFF) + 0.5f;
+        return (val / (ai_real)0xFF) + 0.5f;
     default:
         break;
     }
@@ -512,10 +516,10 @@ ai_real PLYImporter::NormalizeColorValue(PLY::PropertyInstance::ValueUnion val,
 
 // ------------------------------------------------------------------------------------------------
 // Try to extract proper faces from the PLY DOM
-void PLYImporter::LoadFace(const PLY::Element *pcElement, const PLY::ElementInstance *instElement,
+void PLYImporter::LoadFaces(const PLY::Element *pcElement, const PLY::ElementData *data,
         unsigned int pos) {
     ai_assert(nullptr != pcElement);
-    ai_assert(nullptr != instElement);
+    ai_assert(nullptr != data);
 
     if (mGeneratedMesh == nullptr) {
         throw DeadlyImportError("Invalid .ply file: Vertices should be declared before faces");
@@ -525,16 +529,13 @@ void PLYImporter::LoadFace(const PLY::Element *pcElement, const PLY::ElementInst
 
     // index of the vertex index list
     unsigned int iProperty = 0xFFFFFFFF;
-    PLY::EDataType eType = EDT_Char;
     bool bIsTriStrip = false;
 
     // index of the material index property
     //unsigned int iMaterialIndex = 0xFFFFFFFF;
-    //PLY::EDataType eType2 = EDT_Char;
 
     // texture coordinates
     unsigned int iTextureCoord = 0xFFFFFFFF;
-    PLY::EDataType eType3 = EDT_Char;
 
     // face = unique number of vertex indices
     if (PLY::EEST_Face == pcElement->eSemantic) {
@@ -549,7 +550,6 @@ void PLYImporter::LoadFace(const PLY::Element *pcElement, const PLY::ElementInst
 
                 iProperty = _a;
                 bOne = true;
-                eType = (*a).eType;
             } else if (PLY::EST_TextureCoordinates == (*a).Semantic) {
                 // must be a dynamic list!
                 if (!(*a).bIsList) {
@@ -557,7 +557,6 @@ void PLYImporter::LoadFace(const PLY::Element *pcElement, const PLY::ElementInst
                 }
                 iTextureCoord = _a;
                 bOne = true;
-                eType3 = (*a).eType;
             }
         }
     }
@@ -574,52 +573,55 @@ void PLYImporter::LoadFace(const PLY::Element *pcElement, const PLY::ElementInst
             iProperty = _a;
             bOne = true;
             bIsTriStrip = true;
-            eType = (*a).eType;
             break;
         }
     }
 
     // check whether we have at least one per-face information set
-    if (bOne) {
-        if (mGeneratedMesh->mFaces == nullptr) {
-            mGeneratedMesh->mNumFaces = pcElement->NumOccur;
-            mGeneratedMesh->mFaces = new aiFace[mGeneratedMesh->mNumFaces];
-        }
+    if (!bOne || 0 == data->NumInstances) {
+        return;
+    }
 
-        if (!bIsTriStrip) {
-            // parse the list of vertex indices
-            if (0xFFFFFFFF != iProperty) {
-                const unsigned int iNum = (unsigned int)GetProperty(instElement->alProperties, iProperty).avList.size();
-                mGeneratedMesh->mFaces[pos].mNumIndices = iNum;
-                mGeneratedMesh->mFaces[pos].mIndices = new unsigned int[iNum];
+    if (mGeneratedMesh->mFaces == nullptr) {
+        mGeneratedMesh->mNumFaces = pcElement->NumOccur;
+        mGeneratedMesh->mFaces = new aiFace[mGeneratedMesh->mNumFaces];
+    }
 
-                std::vector<PLY::PropertyInstance::ValueUnion>::const_iterator p =
-                        GetProperty(instElement->alProperties, iProperty).avList.begin();
+    if (!bIsTriStrip) {
+        const size_t runIndices = mNumFaceIndices;
 
-                for (unsigned int a = 0; a < iNum; ++a, ++p) {
-                    mGeneratedMesh->mFaces[pos].mIndices[a] = PLY::PropertyInstance::ConvertTo<unsigned int>(*p, eType);
-                }
+        // parse the lists of vertex indices, they are stored back to back
+        // in the index block of the mesh. The faces get their index arrays
+        // once all faces are read, the block may still move until then
+        if (0xFFFFFFFF != iProperty) {
+            const PLY::PropertyColumn &column = GetProperty(data->alColumns, iProperty);
+            for (unsigned int i = 0; i < data->NumInstances; ++i) {
+                mGeneratedMesh->mFaces[pos + i].mNumIndices = column.ListSize(i);
             }
+            ReserveFaceIndices(runIndices + column.NumValues(), mGeneratedMesh->mNumFaces);
+            column.Get<unsigned int>(0, column.NumValues(), mGeneratedMesh->mFaceIndices + runIndices);
+            mNumFaceIndices = runIndices + column.NumValues();
+        }
 
-            // parse the material index
-            // cannot be handled without processing the whole file first
-            /*if (0xFFFFFFFF != iMaterialIndex)
+        // parse the material index
+        // cannot be handled without processing the whole file first
+        /*if (0xFFFFFFFF != iMaterialIndex)
         {
-            mGeneratedMesh->mFaces[pos]. = PLY::PropertyInstance::ConvertTo<unsigned int>(
-            GetProperty(instElement->alProperties, iMaterialIndex).avList.front(), eType2);
+            mGeneratedMesh->mFaces[pos + i]. = GetProperty(data->alColumns, iMaterialIndex).Get<unsigned int>(i);
         }*/
 
-            if (0xFFFFFFFF != iTextureCoord) {
-                const unsigned int iNum = (unsigned int)GetProperty(instElement->alProperties, iTextureCoord).avList.size();
+        if (0xFFFFFFFF != iTextureCoord) {
+            const PLY::PropertyColumn &column = GetProperty(data->alColumns, iTextureCoord);
+            size_t faceIndices = runIndices;
+            for (unsigned int i = 0; i < data->NumInstances; ++i) {
+                const unsigned int iNum = column.ListSize(i);
+                const size_t p = column.ValueIndex(i);
 
                 //should be 6 coords
-                std::vector<PLY::PropertyInstance::ValueUnion>::const_iterator p =
-                        GetProperty(instElement->alProperties, iTextureCoord).avList.begin();
-
                 if ((iNum / 3) == 2) // X Y coord
                 {
-                    for (unsigned int a = 0; a < iNum; ++a, ++p) {
-                        unsigned int vindex = mGeneratedMesh->mFaces[pos].mIndices[a / 2];
+                    for (unsigned int a = 0; a < iNum && faceIndices + a / 2 < mNumFaceIndices; ++a) {
+                        unsigned int vindex = mGeneratedMesh->mFaceIndices[faceIndices + a / 2];
                         if (vindex < mGeneratedMesh->mNumVertices) {
                             if (mGeneratedMesh->mTextureCoords[0] == nullptr) {
                                 mGeneratedMesh->mNumUVComponents[0] = 2;
@@ -627,26 +629,33 @@ void PLYImporter::LoadFace(const PLY::Element *pcElement, const PLY::ElementInst
                             }
 
                             if (a % 2 == 0) {
-                                mGeneratedMesh->mTextureCoords[0][vindex].x = PLY::PropertyInstance::ConvertTo<ai_real>(*p, eType3);
+                                mGeneratedMesh->mTextureCoords[0][vindex].x = column.Get<ai_real>(p + a);
                             } else {
-                                mGeneratedMesh->mTextureCoords[0][vindex].y = PLY::PropertyInstance::ConvertTo<ai_real>(*p, eType3);
+                                mGeneratedMesh->mTextureCoords[0][vindex].y = column.Get<ai_real>(p + a);
                             }
 
                             mGeneratedMesh->mTextureCoords[0][vindex].z = 0;
                         }
                     }
                 }
+                if (0xFFFFFFFF != iProperty) {
+                    faceIndices += mGeneratedMesh->mFaces[pos + i].mNumIndices;
+                }
             }
-        } else { // triangle strips
+        }
+    } else { // triangle strips
+        const PLY::PropertyColumn &column = GetProperty(data->alColumns, iProperty);
+        for (unsigned int i = 0; i < data->NumInstances; ++i) {
+            aiFace &face = mGeneratedMesh->mFaces[pos + i];
+
             // normally we have only one triangle strip instance where
             // a value of -1 indicates a restart of the strip
             bool flip = false;
-            const std::vector<PLY::PropertyInstance::ValueUnion> &quak = GetProperty(instElement->alProperties, iProperty).avList;
-            //pvOut->reserve(pvOut->size() + quak.size() + (quak.size()>>2u)); //Limits memory consumption
+            const size_t end = column.ValueIndex(i) + column.ListSize(i);
 
             int aiTable[2] = { -1, -1 };
-            for (std::vector<PLY::PropertyInstance::ValueUnion>::const_iterator a = quak.begin(); a != quak.end(); ++a) {
-                const int p = PLY::PropertyInstance::ConvertTo<int>(*a, eType);
+            for (size_t a = column.ValueIndex(i); a < end; ++a) {
+                const int p = column.Get<int>(a);
 
                 if (-1 == p) {
                     // restart the strip ...
@@ -663,21 +672,16 @@ void PLYImporter::LoadFace(const PLY::Element *pcElement, const PLY::ElementInst
                     continue;
                 }
 
-                if (mGeneratedMesh->mFaces == nullptr) {
-                    mGeneratedMesh->mNumFaces = pcElement->NumOccur;
-                    mGeneratedMesh->mFaces = new aiFace[mGeneratedMesh->mNumFaces];
-                }
-
-                mGeneratedMesh->mFaces[pos].mNumIndices = 3;
-                mGeneratedMesh->mFaces[pos].mIndices = new unsigned int[3];
-                mGeneratedMesh->mFaces[pos].mIndices[0] = aiTable[0];
-                mGeneratedMesh->mFaces[pos].mIndices[1] = aiTable[1];
-                mGeneratedMesh->mFaces[pos].mIndices[2] = p;
+                face.mNumIndices = 3;
+                face.mIndices = AllocateSceneArray<unsigned int>(3);
+                face.mIndices[0] = aiTable[0];
+                face.mIndices[1] = aiTable[1];
+                face.mIndices[2] = p;
 
                 // every second pass swap the indices.
                 flip = !flip;
                 if (flip) {
-                    std::swap(mGeneratedMesh->mFaces[pos].mIndices[0], mGeneratedMesh->mFaces[pos].mIndices[1]);
+                    std::swap(face.mIndices[0], face.mIndices[1]);
                 }
 
                 aiTable[0] = aiTable[1];
@@ -687,9 +691,39 @@ void PLYImporter::LoadFace(const PLY::Element *pcElement, const PLY::ElementInst
     }
 }
 
+// ------------------------------------------------------------------------------------------------
+void PLYImporter::ReserveFaceIndices(size_t count, unsigned int numFaces) {
+    if (count <= mGeneratedMesh->mNumFaceIndices) {
+        return;
+    }
+
+    // start with three indices per face, most face lists hold triangles only,
+    // and grow by half each time a run exceeds the block
+    size_t capacity = static_cast<size_t>(numFaces) * 3;
+    if (mGeneratedMesh->mFaceIndices) {
+        capacity = std::max(capacity, static_cast<size_t>(mGeneratedMesh->mNumFaceIndices) * 3 / 2);
+    }
+    capacity = std::max(capacity, count);
+    if (capacity > std::numeric_limits<unsigned int>::max()) {
+        if (count > std::numeric_limits<unsigned int>::max()) {
+            throw DeadlyImportError("Invalid .ply file: Too many face indices");
+        }
+        capacity = std::numeric_limits<unsigned int>::max();
+    }
+
+    unsigned int *block = AllocateSceneArray<unsigned int>(capacity);
+    if (mNumFaceIndices) {
+        ::memcpy(block, mGeneratedMesh->mFaceIndices, mNumFaceIndices * sizeof(unsigned int));
+    }
+    FreeSceneArray(mGeneratedMesh->mFaceIndices);
+    mGeneratedMesh->mFaceIndices = block;
+    mGeneratedMesh->mNumFaceIndices = static_cast<unsigned int>(capacity);
+}
+
 // ------------------------------------------------------------------------------------------------
 // Get a RGBA color in [0...1] range
-void PLYImporter::GetMaterialColor(const std::vector<PLY::PropertyInstance> &avList,
+void PLYImporter::GetMaterialColor(const PLY::ElementData &data,
+        unsigned int instance,
         unsigned int aiPositions[4],
         PLY::EDataType aiTypes[4],
         aiColor4D *clrOut) {
@@ -698,27 +732,21 @@ void PLYImporter::GetMaterialColor(const std::vector<PLY::PropertyInstance> &avL
     if (0xFFFFFFFF == aiPositions[0])
         clrOut->r = 0.0f;
     else {
-        clrOut->r = NormalizeColorValue(GetProperty(avList,
-                                                aiPositions[0])
-                                                .avList.front(),
+        clrOut->r = NormalizeColorValue(GetProperty(data.alColumns, aiPositions[0]).Get<ai_real>(instance),
                 aiTypes[0]);
     }
 
     if (0xFFFFFFFF == aiPositions[1])
         clrOut->g = 0.0f;
     else {
-        clrOut->g = NormalizeColorValue(GetProperty(avList,
-                                                aiPositions[1])
-                                                .avList.front(),
+        clrOut->g = NormalizeColorValue(GetProperty(data.alColumns, aiPositions[1]).Get<ai_real>(instance),
                 aiTypes[1]);
     }
 
     if (0xFFFFFFFF == aiPositions[2])
         clrOut->b = 0.0f;
     else {
-        clrOut->b = NormalizeColorValue(GetProperty(avList,
-                                                aiPositions[2])
-                                                .avList.front(),
+        clrOut->b = NormalizeColorValue(GetProperty(data.alColumns, aiPositions[2]).Get<ai_real>(instance),
                 aiTypes[2]);
     }
 
@@ -726,9 +754,7 @@ void PLYImporter::GetMaterialColor(const std::vector<PLY::PropertyInstance> &avL
     if (0xFFFFFFFF == aiPositions[3])
         clrOut->a = 1.0f;
     else {
-        clrOut->a = NormalizeColorValue(GetProperty(avList,
-                                                aiPositions[3])
-                                                .avList.front(),
+        clrOut->a = NormalizeColorValue(GetProperty(data.alColumns, aiPositions[3]).Get<ai_real>(instance),
                 aiTypes[3]);
     }
 }
@@ -752,13 +778,10 @@ void PLYImporter::LoadMaterial(std::vector<aiMaterial *> *pvOut, std::string &de
         { EDT_Char, EDT_Char, EDT_Char, EDT_Char },
         { EDT_Char, EDT_Char, EDT_Char, EDT_Char }
     };
-    PLY::ElementInstanceList *pcList = nullptr;
+    PLY::ElementData *pcList = nullptr;
 
     unsigned int iPhong = 0xFFFFFFFF;
-    PLY::EDataType ePhong = EDT_Char;
-
     unsigned int iOpacity = 0xFFFFFFFF;
-    PLY::EDataType eOpacity = EDT_Char;
 
     // search in the DOM for a vertex entry
     unsigned int _i = 0;
@@ -777,13 +800,11 @@ void PLYImporter::LoadMaterial(std::vector<aiMaterial *> *pvOut, std::string &de
                 // pohng specularity      -----------------------------------
                 if (PLY::EST_PhongPower == (*a).Semantic) {
                     iPhong = _a;
-                    ePhong = (*a).eType;
                 }
 
                 // general opacity        -----------------------------------
                 if (PLY::EST_Opacity == (*a).Semantic) {
                     iOpacity = _a;
-                    eOpacity = (*a).eType;
                 }
 
                 // diffuse color channels -----------------------------------
@@ -836,26 +857,26 @@ void PLYImporter::LoadMaterial(std::vector<aiMaterial *> *pvOut, std::string &de
     }
     // check whether we have a valid source for the material data
     if (nullptr != pcList) {
-        for (std::vector<ElementInstance>::const_iterator i = pcList->alInstances.begin(); i != pcList->alInstances.end(); ++i) {
+        for (unsigned int i = 0; i < pcList->NumInstances; ++i) {
             aiColor4D clrOut;
             aiMaterial *pcHelper = new aiMaterial();
 
             // build the diffuse material color
-            GetMaterialColor((*i).alProperties, aaiPositions[0], aaiTypes[0], &clrOut);
+            GetMaterialColor(*pcList, i, aaiPositions[0], aaiTypes[0], &clrOut);
             pcHelper->AddProperty<aiColor4D>(&clrOut, 1, AI_MATKEY_COLOR_DIFFUSE);
 
             // build the specular material color
-            GetMaterialColor((*i).alProperties, aaiPositions[1], aaiTypes[1], &clrOut);
+            GetMaterialColor(*pcList, i, aaiPositions[1], aaiTypes[1], &clrOut);
             pcHelper->AddProperty<aiColor4D>(&clrOut, 1, AI_MATKEY_COLOR_SPECULAR);
 
             // build the ambient material color
-            GetMaterialColor((*i).alProperties, aaiPositions[2], aaiTypes[2], &clrOut);
+            GetMaterialColor(*pcList, i, aaiPositions[2], aaiTypes[2], &clrOut);
             pcHelper->AddProperty<aiColor4D>(&clrOut, 1, AI_MATKEY_COLOR_AMBIENT);
 
             // handle phong power and shading mode
             int iMode = (int)aiShadingMode_Gouraud;
             if (0xFFFFFFFF != iPhong) {
-                ai_real fSpec = PLY::PropertyInstance::ConvertTo<ai_real>(GetProperty((*i).alProperties, iPhong).avList.front(), ePhong);
+                ai_real fSpec = GetProperty(pcList->alColumns, iPhong).Get<ai_real>(i);
 
                 // if shininess is 0 (and the pow() calculation would therefore always
                 // become 1, not depending on the angle), use gouraud lighting
@@ -871,7 +892,7 @@ void PLYImporter::LoadMaterial(std::vector<aiMaterial *> *pvOut, std::string &de
 
             // handle opacity
             if (0xFFFFFFFF != iOpacity) {
-                ai_real fOpacity = PLY::PropertyInstance::ConvertTo<ai_real>(GetProperty((*i).alProperties, iPhong).avList.front(), eOpacity);
+                ai_real fOpacity = GetProperty(pcList->alColumns, iPhong).Get<ai_real>(i);
                 pcHelper->AddProperty<ai_real>(&fOpacity, 1, AI_MATKEY_OPACITY);
             }
 
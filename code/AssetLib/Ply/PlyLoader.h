@@ -74,14 +74,22 @@ public:
             bool checkSig) const;
 
     // -------------------------------------------------------------------
-    /** Extract a vertex from the DOM
+    /** Reads the stream buffer configuration.
+     * See BaseImporter::SetupProperties() for details
+     */
+    void SetupProperties(const Importer *pImp);
+
+    // -------------------------------------------------------------------
+    /** Extract a run of vertices from the DOM, pos is the index of the
+    *  first one
     */
-    void LoadVertex(const PLY::Element *pcElement, const PLY::ElementInstance *instElement, unsigned int pos);
+    void LoadVertices(const PLY::Element *pcElement, const PLY::ElementData *data, unsigned int pos);
 
     // -------------------------------------------------------------------
-    /** Extract a face from the DOM
+    /** Extract a run of faces from the DOM, pos is the index of the
+    *  first one
     */
-    void LoadFace(const PLY::Element *pcElement, const PLY::ElementInstance *instElement, unsigned int pos);
+    void LoadFaces(const PLY::Element *pcElement, const PLY::ElementData *data, unsigned int pos);
 
 protected:
     // -------------------------------------------------------------------
@@ -97,6 +105,12 @@ protected:
     void InternReadFile(const std::string &pFile, aiScene *pScene,
             IOSystem *pIOHandler);
 
+    // -------------------------------------------------------------------
+    /** Grow the index block of mGeneratedMesh to hold at least count
+    *  indices, numFaces is the total number of faces of the face list
+    */
+    void ReserveFaceIndices(size_t count, unsigned int numFaces);
+
     // -------------------------------------------------------------------
     /** Extract a material list from the DOM
     */
@@ -106,7 +120,8 @@ protected:
     /** Static helper to parse a color from four single channels in
     */
     static void GetMaterialColor(
-            const std::vector<PLY::PropertyInstance> &avList,
+            const PLY::ElementData &data,
+            unsigned int instance,
             unsigned int aiPositions[4],
             PLY::EDataType aiTypes[4],
             aiColor4D *clrOut);
@@ -116,7 +131,7 @@ protected:
     *  is normalized to 0-1.
     */
     static ai_real NormalizeColorValue(
-            PLY::PropertyInstance::ValueUnion val,
+            ai_real val,
             PLY::EDataType eType);
 
     /** Buffer to hold the loaded file */
@@ -127,6 +142,21 @@ protected:
 
     /** Mesh generated by loader */
     aiMesh *mGeneratedMesh;
+
+    /** Whether the vertices of a point cloud are handed to the mesh
+     *  sink in chunks, and the index of the first vertex of the chunk
+     *  in mGeneratedMesh */
+    bool mStreamPoints;
+    unsigned int mChunkStart;
+
+    /** Number of indices of the face list read into the index block of
+     *  mGeneratedMesh, the faces point into it once all are read */
+    size_t mNumFaceIndices;
+
+    /** Size of the blocks the file is read in, 0 for the default, and
+     *  the number of blocks read ahead in the background */
+    size_t mReadBlockSize;
+    size_t mReadAheadDepth;
 };
 
 } // end of namespace Assimp
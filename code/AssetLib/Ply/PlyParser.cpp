@@ -47,10 +47,100 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "PlyLoader.h"
 #include <assimp/ByteSwapper.h>
 #include <assimp/fast_atof.h>
+#include <assimp/ImportLimits.h>
 #include <assimp/DefaultLogger.hpp>
 
+#include <algorithm>
+#include <limits>
+
 using namespace Assimp;
 
+namespace {
+
+// ------------------------------------------------------------------------------------------------
+// Swaps the byte order of a value of the given size
+inline void SwapValue(uint8_t *value, unsigned int size) {
+    switch (size) {
+    case 2:
+        ByteSwap::Swap2(value);
+        break;
+    case 4:
+        ByteSwap::Swap4(value);
+        break;
+    case 8:
+        ByteSwap::Swap8(value);
+        break;
+    default:
+        break;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+// Copies one value of each of count records into a column
+template <unsigned int SIZE>
+void CopyColumn(const char *records, size_t stride, unsigned int count, uint8_t *out, bool swap) {
+    for (unsigned int i = 0; i < count; ++i, records += stride, out += SIZE) {
+        ::memcpy(out, records, SIZE);
+    }
+    if (swap) {
+        out -= static_cast<size_t>(count) * SIZE;
+        for (unsigned int i = 0; i < count; ++i, out += SIZE) {
+            SwapValue(out, SIZE);
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+// Makes sure that at least the given number of bytes are left in the binary buffer,
+// the rest of the buffer is joined with the next file block otherwise
+void FillBinaryBuffer(IOStreamBuffer<char> &streamBuffer, std::vector<char> &buffer,
+        const char *&pCur, unsigned int &bufferSize, unsigned int required) {
+    while (bufferSize < required) {
+        std::vector<char> nbuffer;
+        if (!streamBuffer.getNextBlock(nbuffer) || nbuffer.empty()) {
+            throw DeadlyImportError("Invalid .ply file: File corrupted");
+        }
+
+        //concat buffer contents
+        std::vector<char> joined(pCur, pCur + bufferSize);
+        joined.insert(joined.end(), nbuffer.begin(), nbuffer.end());
+        buffer.swap(joined);
+        bufferSize = static_cast<unsigned int>(buffer.size());
+        pCur = buffer.data();
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+// Rejects list sizes which can't be satisfied by the rest of the file, before storage
+// is allocated for them. A value takes at least one byte in the file
+void CheckListSize(size_t count, size_t valueSize, size_t remaining) {
+    if (count > remaining / std::max<size_t>(1, valueSize)) {
+        throw DeadlyImportError("Invalid .ply file: List of ", count, " values exceeds the file size");
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+// Returns the number of characters up to the end of the line
+size_t GetLineLength(const char *pCur) {
+    const char *end = pCur;
+    while (!IsLineEnd(*end)) {
+        ++end;
+    }
+    return static_cast<size_t>(end - pCur);
+}
+
+// ------------------------------------------------------------------------------------------------
+// Hands a run of vertices or faces over to the loader
+void LoadRun(PLYImporter *loader, const PLY::Element *pcElement, const PLY::ElementData *data, unsigned int pos) {
+    if (pcElement->eSemantic == PLY::EEST_Vertex) {
+        loader->LoadVertices(pcElement, data, pos);
+    } else if (pcElement->eSemantic == PLY::EEST_Face || pcElement->eSemantic == PLY::EEST_TriStrip) {
+        loader->LoadFaces(pcElement, data, pos);
+    }
+}
+
+} // namespace
+
 // ------------------------------------------------------------------------------------------------
 PLY::EDataType PLY::Property::ParseDataType(std::vector<char> &buffer) {
     ai_assert(!buffer.empty());
@@ -225,6 +315,32 @@ bool PLY::Property::ParseProperty(std::vector<char> &buffer, PLY::Property *pOut
     return true;
 }
 
+// ------------------------------------------------------------------------------------------------
+unsigned int PLY::Property::GetDataTypeSize(PLY::EDataType eType) {
+    switch (eType) {
+    case EDT_Char:
+    case EDT_UChar:
+        return 1;
+
+    case EDT_UShort:
+    case EDT_Short:
+        return 2;
+
+    case EDT_UInt:
+    case EDT_Int:
+    case EDT_Float:
+        return 4;
+
+    case EDT_Double:
+        return 8;
+
+    case EDT_INVALID:
+    default:
+        break;
+    }
+    return 0;
+}
+
 // ------------------------------------------------------------------------------------------------
 PLY::EElementSemantic PLY::Element::ParseSemantic(std::vector<char> &buffer) {
     ai_assert(!buffer.empty());
@@ -320,6 +436,18 @@ bool PLY::Element::ParseElement(IOStreamBuffer<char> &streamBuffer, std::vector<
     return true;
 }
 
+// ------------------------------------------------------------------------------------------------
+unsigned int PLY::Element::GetRecordSize() const {
+    unsigned int size = 0;
+    for (const PLY::Property &prop : alProperties) {
+        if (prop.bIsList) {
+            return 0;
+        }
+        size += PLY::Property::GetDataTypeSize(prop.eType);
+    }
+    return size;
+}
+
 // ------------------------------------------------------------------------------------------------
 bool PLY::DOM::SkipSpaces(std::vector<char> &buffer) {
     const char *pCur = buffer.empty() ? nullptr : (char *)&buffer[0];
@@ -441,16 +569,17 @@ bool PLY::DOM::ParseElementInstanceLists(IOStreamBuffer<char> &streamBuffer, std
     alElementData.resize(alElements.size());
 
     std::vector<PLY::Element>::const_iterator i = alElements.begin();
-    std::vector<PLY::ElementInstanceList>::iterator a = alElementData.begin();
+    std::vector<PLY::ElementData>::iterator a = alElementData.begin();
 
     // parse all element instances
     //construct vertices and faces
     for (; i != alElements.end(); ++i, ++a) {
+        (*a).Reset(&(*i), true);
         if ((*i).eSemantic == EEST_Vertex || (*i).eSemantic == EEST_Face || (*i).eSemantic == EEST_TriStrip) {
-            PLY::ElementInstanceList::ParseInstanceList(streamBuffer, buffer, &(*i), nullptr, loader);
+            PLY::ElementData::ParseInstanceList(streamBuffer, buffer, &(*i), &(*a), loader);
         } else {
-            (*a).alInstances.resize((*i).NumOccur);
-            PLY::ElementInstanceList::ParseInstanceList(streamBuffer, buffer, &(*i), &(*a), nullptr);
+            (*a).Reserve((*i).NumOccur);
+            PLY::ElementData::ParseInstanceList(streamBuffer, buffer, &(*i), &(*a), nullptr);
         }
     }
 
@@ -468,15 +597,16 @@ bool PLY::DOM::ParseElementInstanceListsBinary(IOStreamBuffer<char> &streamBuffe
     alElementData.resize(alElements.size());
 
     std::vector<PLY::Element>::const_iterator i = alElements.begin();
-    std::vector<PLY::ElementInstanceList>::iterator a = alElementData.begin();
+    std::vector<PLY::ElementData>::iterator a = alElementData.begin();
 
     // parse all element instances
     for (; i != alElements.end(); ++i, ++a) {
+        (*a).Reset(&(*i), false);
         if ((*i).eSemantic == EEST_Vertex || (*i).eSemantic == EEST_Face || (*i).eSemantic == EEST_TriStrip) {
-            PLY::ElementInstanceList::ParseInstanceListBinary(streamBuffer, buffer, pCur, bufferSize, &(*i), nullptr, loader, p_bBE);
+            PLY::ElementData::ParseInstanceListBinary(streamBuffer, buffer, pCur, bufferSize, &(*i), &(*a), loader, p_bBE);
         } else {
-            (*a).alInstances.resize((*i).NumOccur);
-            PLY::ElementInstanceList::ParseInstanceListBinary(streamBuffer, buffer, pCur, bufferSize, &(*i), &(*a), nullptr, p_bBE);
+            (*a).Reserve((*i).NumOccur);
+            PLY::ElementData::ParseInstanceListBinary(streamBuffer, buffer, pCur, bufferSize, &(*i), &(*a), nullptr, p_bBE);
         }
     }
 
@@ -499,14 +629,31 @@ bool PLY::DOM::ParseInstanceBinary(IOStreamBuffer<char> &streamBuffer, DOM *p_pc
         return false;
     }
 
-    streamBuffer.getNextBlock(buffer);
+    // parse the binary body in-place if the whole file is accessible in memory,
+    // otherwise block-wise through the stream buffer
+    unsigned int bufferSize = 0;
+    const char *pCur = nullptr;
+    const char *view = nullptr;
+    size_t viewSize = 0;
+    if (streamBuffer.size() <= std::numeric_limits<unsigned int>::max() && streamBuffer.getRemainingView(view, viewSize)) {
+        // remove first char if it's /n in case of file with /r/n
+        if (viewSize > 0 && view[0] == '\n') {
+            ++view;
+            --viewSize;
+        }
+        buffer.clear();
+        bufferSize = static_cast<unsigned int>(viewSize);
+        pCur = view;
+    } else {
+        streamBuffer.getNextBlock(buffer);
 
-    // remove first char if it's /n in case of file with /r/n
-    if (((char *)&buffer[0])[0] == '\n')
-        buffer.erase(buffer.begin(), buffer.begin() + 1);
+        // remove first char if it's /n in case of file with /r/n
+        if (((char *)&buffer[0])[0] == '\n')
+            buffer.erase(buffer.begin(), buffer.begin() + 1);
 
-    unsigned int bufferSize = static_cast<unsigned int>(buffer.size());
-    const char *pCur = (char *)&buffer[0];
+        bufferSize = static_cast<unsigned int>(buffer.size());
+        pCur = (char *)&buffer[0];
+    }
     if (!p_pcOut->ParseElementInstanceListsBinary(streamBuffer, buffer, pCur, bufferSize, loader, p_bBE)) {
         ASSIMP_LOG_VERBOSE_DEBUG("PLY::DOM::ParseInstanceBinary() failure");
         return false;
@@ -541,13 +688,74 @@ bool PLY::DOM::ParseInstance(IOStreamBuffer<char> &streamBuffer, DOM *p_pcOut, P
 }
 
 // ------------------------------------------------------------------------------------------------
-bool PLY::ElementInstanceList::ParseInstanceList(
+const unsigned int PLY::ElementData::RunSize;
+
+// ------------------------------------------------------------------------------------------------
+void PLY::ElementData::Reset(const PLY::Element *pcElement, bool bAscii) {
+    ai_assert(nullptr != pcElement);
+
+    alColumns.resize(pcElement->alProperties.size());
+    for (size_t i = 0; i < alColumns.size(); ++i) {
+        const PLY::Property &prop = pcElement->alProperties[i];
+        PLY::PropertyColumn &column = alColumns[i];
+        column.eType = bAscii ? GetAsciiStorageType(prop.eType) : prop.eType;
+        column.iTypeSize = std::max(1u, PLY::Property::GetDataTypeSize(column.eType));
+        column.aValues.clear();
+        column.aiListStart.clear();
+        if (prop.bIsList) {
+            column.aiListStart.push_back(0);
+        }
+    }
+    NumInstances = 0;
+}
+
+// ------------------------------------------------------------------------------------------------
+void PLY::ElementData::Clear() {
+    for (PLY::PropertyColumn &column : alColumns) {
+        column.aValues.clear();
+        if (!column.aiListStart.empty()) {
+            column.aiListStart.resize(1);
+        }
+    }
+    NumInstances = 0;
+}
+
+// ------------------------------------------------------------------------------------------------
+void PLY::ElementData::ReserveColumns(uint64_t iAppend) {
+    uint64_t iBytes = iAppend;
+    for (const PLY::PropertyColumn &column : alColumns) {
+        iBytes += column.aValues.capacity() + column.aiListStart.capacity() * sizeof(unsigned int);
+    }
+    Reserved.Resize(iBytes);
+}
+
+// ------------------------------------------------------------------------------------------------
+void PLY::ElementData::Reserve(unsigned int iNumInstances) {
+    // lists store one start index per instance besides their values
+    uint64_t iBytes = 0;
+    for (const PLY::PropertyColumn &column : alColumns) {
+        iBytes += static_cast<uint64_t>(iNumInstances) * (column.aiListStart.empty() ? column.iTypeSize : sizeof(unsigned int));
+    }
+    ReserveColumns(iBytes);
+
+    for (PLY::PropertyColumn &column : alColumns) {
+        if (column.aiListStart.empty()) {
+            column.aValues.reserve(static_cast<size_t>(iNumInstances) * column.iTypeSize);
+        } else {
+            column.aiListStart.reserve(static_cast<size_t>(iNumInstances) + 1);
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+bool PLY::ElementData::ParseInstanceList(
         IOStreamBuffer<char> &streamBuffer,
         std::vector<char> &buffer,
         const PLY::Element *pcElement,
-        PLY::ElementInstanceList *p_pcOut,
+        PLY::ElementData *p_pcOut,
         PLYImporter *loader) {
     ai_assert(nullptr != pcElement);
+    ai_assert(nullptr != p_pcOut);
 
     // parse all elements
     if (EEST_INVALID == pcElement->eSemantic || pcElement->alProperties.empty()) {
@@ -560,219 +768,246 @@ bool PLY::ElementInstanceList::ParseInstanceList(
         }
     } else {
         const char *pCur = (const char *)&buffer[0];
-        // be sure to have enough storage
+        const char *line = nullptr;
+        size_t lineLength = 0;
+        unsigned int first = 0;
         for (unsigned int i = 0; i < pcElement->NumOccur; ++i) {
-            if (p_pcOut)
-                PLY::ElementInstance::ParseInstance(pCur, pcElement, &p_pcOut->alInstances[i]);
-            else {
-                ElementInstance elt;
-                PLY::ElementInstance::ParseInstance(pCur, pcElement, &elt);
-
-                // Create vertex or face
-                if (pcElement->eSemantic == EEST_Vertex) {
-                    //call loader instance from here
-                    loader->LoadVertex(pcElement, &elt, i);
-                } else if (pcElement->eSemantic == EEST_Face) {
-                    //call loader instance from here
-                    loader->LoadFace(pcElement, &elt, i);
-                } else if (pcElement->eSemantic == EEST_TriStrip) {
-                    //call loader instance from here
-                    loader->LoadFace(pcElement, &elt, i);
-                }
+            ImportLimits::Poll();
+            p_pcOut->ParseInstance(pCur, pcElement);
+
+            // hand over complete runs of vertices and faces
+            if (nullptr != loader && (RunSize == p_pcOut->NumInstances || i + 1 == pcElement->NumOccur)) {
+                LoadRun(loader, pcElement, p_pcOut, first);
+                first = i + 1;
+                p_pcOut->Clear();
             }
 
-            streamBuffer.getNextLine(buffer);
-            pCur = (buffer.empty()) ? nullptr : (const char *)&buffer[0];
+            // the instance lines are parsed in place
+            if (streamBuffer.getNextLineView(line, lineLength)) {
+                pCur = line;
+            }
+        }
+
+        // the next element starts on the pending line
+        if (nullptr != line) {
+            buffer.assign(line, line + lineLength);
+            buffer.push_back('\n');
+            buffer.push_back('\0');
         }
     }
     return true;
 }
 
 // ------------------------------------------------------------------------------------------------
-bool PLY::ElementInstanceList::ParseInstanceListBinary(
+bool PLY::ElementData::ParseInstanceListBinary(
         IOStreamBuffer<char> &streamBuffer,
         std::vector<char> &buffer,
         const char *&pCur,
         unsigned int &bufferSize,
         const PLY::Element *pcElement,
-        PLY::ElementInstanceList *p_pcOut,
+        PLY::ElementData *p_pcOut,
         PLYImporter *loader,
         bool p_bBE /* = false */) {
     ai_assert(nullptr != pcElement);
+    ai_assert(nullptr != p_pcOut);
+
+    // elements without lists are made of records of a fixed size, all
+    // records of a run are copied column by column in one pass
+    const unsigned int recordSize = pcElement->GetRecordSize();
+    if (0 != recordSize) {
+        unsigned int first = 0;
+        while (first < pcElement->NumOccur) {
+            ImportLimits::CheckDeadline();
+            FillBinaryBuffer(streamBuffer, buffer, pCur, bufferSize, recordSize);
+
+            unsigned int count = std::min(pcElement->NumOccur - first, bufferSize / recordSize);
+            if (nullptr != loader) {
+                count = std::min(count, RunSize);
+            }
+            p_pcOut->ParseBlockBinary(pCur, pcElement, count, p_bBE);
+            pCur += count * recordSize;
+            bufferSize -= count * recordSize;
+
+            if (nullptr != loader) {
+                LoadRun(loader, pcElement, p_pcOut, first);
+                p_pcOut->Clear();
+            }
+            first += count;
+        }
+        return true;
+    }
 
     // we can add special handling code for unknown element semantics since
     // we can't skip it as a whole block (we don't know its exact size
     // due to the fact that lists could be contained in the property list
     // of the unknown element)
+    unsigned int first = 0;
     for (unsigned int i = 0; i < pcElement->NumOccur; ++i) {
-        if (p_pcOut)
-            PLY::ElementInstance::ParseInstanceBinary(streamBuffer, buffer, pCur, bufferSize, pcElement, &p_pcOut->alInstances[i], p_bBE);
-        else {
-            ElementInstance elt;
-            PLY::ElementInstance::ParseInstanceBinary(streamBuffer, buffer, pCur, bufferSize, pcElement, &elt, p_bBE);
-
-            // Create vertex or face
-            if (pcElement->eSemantic == EEST_Vertex) {
-                //call loader instance from here
-                loader->LoadVertex(pcElement, &elt, i);
-            } else if (pcElement->eSemantic == EEST_Face) {
-                //call loader instance from here
-                loader->LoadFace(pcElement, &elt, i);
-            } else if (pcElement->eSemantic == EEST_TriStrip) {
-                //call loader instance from here
-                loader->LoadFace(pcElement, &elt, i);
-            }
+        ImportLimits::Poll();
+        p_pcOut->ParseInstanceBinary(streamBuffer, buffer, pCur, bufferSize, pcElement, p_bBE);
+
+        // hand over complete runs of vertices and faces
+        if (nullptr != loader && (RunSize == p_pcOut->NumInstances || i + 1 == pcElement->NumOccur)) {
+            LoadRun(loader, pcElement, p_pcOut, first);
+            first = i + 1;
+            p_pcOut->Clear();
         }
     }
     return true;
 }
 
 // ------------------------------------------------------------------------------------------------
-bool PLY::ElementInstance::ParseInstance(const char *&pCur,
-        const PLY::Element *pcElement,
-        PLY::ElementInstance *p_pcOut) {
+bool PLY::ElementData::ParseInstance(const char *&pCur, const PLY::Element *pcElement) {
     ai_assert(nullptr != pcElement);
-    ai_assert(nullptr != p_pcOut);
-
-    // allocate enough storage
-    p_pcOut->alProperties.resize(pcElement->alProperties.size());
+    ai_assert(alColumns.size() == pcElement->alProperties.size());
+
+    uint8_t value[8];
+    for (size_t i = 0; i < alColumns.size(); ++i) {
+        const PLY::Property &prop = pcElement->alProperties[i];
+        PLY::PropertyColumn &column = alColumns[i];
+
+        // skip spaces at the beginning
+        bool ok = SkipSpaces(&pCur);
+        if (ok && prop.bIsList) {
+            // parse the number of elements in the list
+            ParseValue(pCur, prop.eFirstType, value);
+            const unsigned int iNum = PLY::PropertyColumn::ConvertTo<unsigned int>(value, GetAsciiStorageType(prop.eFirstType));
+
+            // parse all list elements, missing ones are 0
+            CheckListSize(iNum, 1, GetLineLength(pCur));
+            ReserveColumns(static_cast<uint64_t>(iNum) * column.iTypeSize);
+            const size_t offset = column.aValues.size();
+            column.aValues.resize(offset + static_cast<size_t>(iNum) * column.iTypeSize, 0);
+            for (unsigned int a = 0; a < iNum; ++a) {
+                if (!SkipSpaces(&pCur)) {
+                    ok = false;
+                    break;
+                }
+                ParseValue(pCur, prop.eType, &column.aValues[offset + static_cast<size_t>(a) * column.iTypeSize]);
+            }
+        } else if (ok) {
+            // parse the property
+            ParseValue(pCur, prop.eType, value);
+            column.aValues.insert(column.aValues.end(), value, value + column.iTypeSize);
+        }
 
-    std::vector<PLY::PropertyInstance>::iterator i = p_pcOut->alProperties.begin();
-    std::vector<PLY::Property>::const_iterator a = pcElement->alProperties.begin();
-    for (; i != p_pcOut->alProperties.end(); ++i, ++a) {
-        if (!(PLY::PropertyInstance::ParseInstance(pCur, &(*a), &(*i)))) {
+        if (ok) {
+            SkipSpacesAndLineEnd(&pCur);
+        } else {
             ASSIMP_LOG_WARN("Unable to parse property instance. "
                             "Skipping this element instance");
 
-            PLY::PropertyInstance::ValueUnion v = PLY::PropertyInstance::DefaultValue((*a).eType);
-            (*i).avList.push_back(v);
+            // append the default value
+            column.aValues.resize(column.aValues.size() + column.iTypeSize, 0);
+        }
+
+        if (prop.bIsList) {
+            column.aiListStart.push_back(static_cast<unsigned int>(column.NumValues()));
         }
     }
+    ReserveColumns();
+    ++NumInstances;
     return true;
 }
 
 // ------------------------------------------------------------------------------------------------
-bool PLY::ElementInstance::ParseInstanceBinary(
+bool PLY::ElementData::ParseInstanceBinary(
         IOStreamBuffer<char> &streamBuffer,
         std::vector<char> &buffer,
         const char *&pCur,
         unsigned int &bufferSize,
         const PLY::Element *pcElement,
-        PLY::ElementInstance *p_pcOut,
         bool p_bBE /* = false */) {
     ai_assert(nullptr != pcElement);
-    ai_assert(nullptr != p_pcOut);
-
-    // allocate enough storage
-    p_pcOut->alProperties.resize(pcElement->alProperties.size());
-
-    std::vector<PLY::PropertyInstance>::iterator i = p_pcOut->alProperties.begin();
-    std::vector<PLY::Property>::const_iterator a = pcElement->alProperties.begin();
-    for (; i != p_pcOut->alProperties.end(); ++i, ++a) {
-        if (!(PLY::PropertyInstance::ParseInstanceBinary(streamBuffer, buffer, pCur, bufferSize, &(*a), &(*i), p_bBE))) {
-            ASSIMP_LOG_WARN("Unable to parse binary property instance. "
-                            "Skipping this element instance");
-
-            (*i).avList.push_back(PLY::PropertyInstance::DefaultValue((*a).eType));
+    ai_assert(alColumns.size() == pcElement->alProperties.size());
+
+    uint8_t value[8];
+    for (size_t i = 0; i < alColumns.size(); ++i) {
+        const PLY::Property &prop = pcElement->alProperties[i];
+        PLY::PropertyColumn &column = alColumns[i];
+
+        if (prop.bIsList) {
+            // parse the number of elements in the list
+            ParseValueBinary(streamBuffer, buffer, pCur, bufferSize, prop.eFirstType, value, p_bBE);
+            const unsigned int iNum = PLY::PropertyColumn::ConvertTo<unsigned int>(value, prop.eFirstType);
+
+            // parse all list elements, the values still to be read from the file count as well
+            const size_t remaining = bufferSize + (streamBuffer.size() - std::min(streamBuffer.getFilePos(), streamBuffer.size()));
+            CheckListSize(iNum, PLY::Property::GetDataTypeSize(prop.eType), remaining);
+            ReserveColumns(static_cast<uint64_t>(iNum) * column.iTypeSize);
+            const size_t offset = column.aValues.size();
+            column.aValues.resize(offset + static_cast<size_t>(iNum) * column.iTypeSize);
+            for (unsigned int a = 0; a < iNum; ++a) {
+                ParseValueBinary(streamBuffer, buffer, pCur, bufferSize, prop.eType, &column.aValues[offset + static_cast<size_t>(a) * column.iTypeSize], p_bBE);
+            }
+            column.aiListStart.push_back(static_cast<unsigned int>(column.NumValues()));
+        } else {
+            // parse the property
+            ParseValueBinary(streamBuffer, buffer, pCur, bufferSize, prop.eType, value, p_bBE);
+            column.aValues.insert(column.aValues.end(), value, value + column.iTypeSize);
         }
     }
+    ReserveColumns();
+    ++NumInstances;
     return true;
 }
 
 // ------------------------------------------------------------------------------------------------
-bool PLY::PropertyInstance::ParseInstance(const char *&pCur,
-        const PLY::Property *prop, PLY::PropertyInstance *p_pcOut) {
-    ai_assert(nullptr != prop);
-    ai_assert(nullptr != p_pcOut);
-
-    // skip spaces at the beginning
-    if (!SkipSpaces(&pCur)) {
-        return false;
-    }
-
-    if (prop->bIsList) {
-        // parse the number of elements in the list
-        PLY::PropertyInstance::ValueUnion v;
-        PLY::PropertyInstance::ParseValue(pCur, prop->eFirstType, &v);
-
-        // convert to unsigned int
-        unsigned int iNum = PLY::PropertyInstance::ConvertTo<unsigned int>(v, prop->eFirstType);
-
-        // parse all list elements
-        p_pcOut->avList.resize(iNum);
-        for (unsigned int i = 0; i < iNum; ++i) {
-            if (!SkipSpaces(&pCur))
-                return false;
-
-            PLY::PropertyInstance::ParseValue(pCur, prop->eType, &p_pcOut->avList[i]);
-        }
-    } else {
-        // parse the property
-        PLY::PropertyInstance::ValueUnion v;
-
-        PLY::PropertyInstance::ParseValue(pCur, prop->eType, &v);
-        p_pcOut->avList.push_back(v);
-    }
-    SkipSpacesAndLineEnd(&pCur);
-    return true;
-}
-
-// ------------------------------------------------------------------------------------------------
-bool PLY::PropertyInstance::ParseInstanceBinary(IOStreamBuffer<char> &streamBuffer, std::vector<char> &buffer,
-        const char *&pCur,
-        unsigned int &bufferSize,
-        const PLY::Property *prop,
-        PLY::PropertyInstance *p_pcOut,
-        bool p_bBE) {
-    ai_assert(nullptr != prop);
-    ai_assert(nullptr != p_pcOut);
-
-    // parse all elements
-    if (prop->bIsList) {
-        // parse the number of elements in the list
-        PLY::PropertyInstance::ValueUnion v;
-        PLY::PropertyInstance::ParseValueBinary(streamBuffer, buffer, pCur, bufferSize, prop->eFirstType, &v, p_bBE);
-
-        // convert to unsigned int
-        unsigned int iNum = PLY::PropertyInstance::ConvertTo<unsigned int>(v, prop->eFirstType);
-
-        // parse all list elements
-        p_pcOut->avList.resize(iNum);
-        for (unsigned int i = 0; i < iNum; ++i) {
-            PLY::PropertyInstance::ParseValueBinary(streamBuffer, buffer, pCur, bufferSize, prop->eType, &p_pcOut->avList[i], p_bBE);
+void PLY::ElementData::ParseBlockBinary(const char *pCur, const PLY::Element *pcElement, unsigned int count, bool p_bBE) {
+    ai_assert(nullptr != pcElement);
+    ai_assert(alColumns.size() == pcElement->alProperties.size());
+
+    const size_t stride = pcElement->GetRecordSize();
+    ReserveColumns(static_cast<uint64_t>(count) * stride);
+    for (PLY::PropertyColumn &column : alColumns) {
+        const size_t offset = column.aValues.size();
+        column.aValues.resize(offset + count * column.iTypeSize);
+        uint8_t *out = column.aValues.data() + offset;
+        switch (column.iTypeSize) {
+        case 1:
+            CopyColumn<1>(pCur, stride, count, out, false);
+            break;
+        case 2:
+            CopyColumn<2>(pCur, stride, count, out, p_bBE);
+            break;
+        case 4:
+            CopyColumn<4>(pCur, stride, count, out, p_bBE);
+            break;
+        case 8:
+            CopyColumn<8>(pCur, stride, count, out, p_bBE);
+            break;
+        default:
+            ai_assert(false);
         }
-    } else {
-        // parse the property
-        PLY::PropertyInstance::ValueUnion v;
-        PLY::PropertyInstance::ParseValueBinary(streamBuffer, buffer, pCur, bufferSize, prop->eType, &v, p_bBE);
-        p_pcOut->avList.push_back(v);
+        pCur += column.iTypeSize;
     }
-    return true;
+    ReserveColumns();
+    NumInstances += count;
 }
 
 // ------------------------------------------------------------------------------------------------
-PLY::PropertyInstance::ValueUnion PLY::PropertyInstance::DefaultValue(PLY::EDataType eType) {
-    PLY::PropertyInstance::ValueUnion out;
-
+PLY::EDataType PLY::ElementData::GetAsciiStorageType(PLY::EDataType eType) {
     switch (eType) {
-    case EDT_Float:
-        out.fFloat = 0.f;
-        return out;
+    case EDT_UInt:
+    case EDT_UShort:
+    case EDT_UChar:
+        return EDT_UInt;
 
-    case EDT_Double:
-        out.fDouble = 0.;
-        return out;
+    case EDT_Int:
+    case EDT_Short:
+    case EDT_Char:
+        return EDT_Int;
 
-    default:;
-    };
-    out.iUInt = 0;
-    return out;
+    default:
+        break;
+    }
+    return eType;
 }
 
 // ------------------------------------------------------------------------------------------------
-bool PLY::PropertyInstance::ParseValue(const char *&pCur,
+bool PLY::ElementData::ParseValue(const char *&pCur,
         PLY::EDataType eType,
-        PLY::PropertyInstance::ValueUnion *out) {
+        uint8_t *out) {
     ai_assert(nullptr != pCur);
     ai_assert(nullptr != out);
 
@@ -781,31 +1016,36 @@ bool PLY::PropertyInstance::ParseValue(const char *&pCur,
     switch (eType) {
     case EDT_UInt:
     case EDT_UShort:
-    case EDT_UChar:
-
-        out->iUInt = (uint32_t)strtoul10(pCur, &pCur);
+    case EDT_UChar: {
+        const uint32_t v = (uint32_t)strtoul10(pCur, &pCur);
+        ::memcpy(out, &v, sizeof(v));
         break;
+    }
 
     case EDT_Int:
     case EDT_Short:
-    case EDT_Char:
-
-        out->iInt = (int32_t)strtol10(pCur, &pCur);
+    case EDT_Char: {
+        const int32_t v = (int32_t)strtol10(pCur, &pCur);
+        ::memcpy(out, &v, sizeof(v));
         break;
+    }
 
-    case EDT_Float:
+    case EDT_Float: {
         // technically this should cast to float, but people tend to use float descriptors for double data
         // this is the best way to not risk losing precision on import and it doesn't hurt to do this
         ai_real f;
         pCur = fast_atoreal_move<ai_real>(pCur, f);
-        out->fFloat = (ai_real)f;
+        const float v = (float)f;
+        ::memcpy(out, &v, sizeof(v));
         break;
+    }
 
-    case EDT_Double:
+    case EDT_Double: {
         double d;
         pCur = fast_atoreal_move<double>(pCur, d);
-        out->fDouble = (double)d;
+        ::memcpy(out, &d, sizeof(d));
         break;
+    }
 
     case EDT_INVALID:
     default:
@@ -817,147 +1057,34 @@ bool PLY::PropertyInstance::ParseValue(const char *&pCur,
 }
 
 // ------------------------------------------------------------------------------------------------
-bool PLY::PropertyInstance::ParseValueBinary(IOStreamBuffer<char> &streamBuffer,
+bool PLY::ElementData::ParseValueBinary(IOStreamBuffer<char> &streamBuffer,
         std::vector<char> &buffer,
         const char *&pCur,
         unsigned int &bufferSize,
         PLY::EDataType eType,
-        PLY::PropertyInstance::ValueUnion *out,
+        uint8_t *out,
         bool p_bBE) {
     ai_assert(nullptr != out);
 
     //calc element size
-    unsigned int lsize = 0;
-    switch (eType) {
-    case EDT_Char:
-    case EDT_UChar:
-        lsize = 1;
-        break;
-
-    case EDT_UShort:
-    case EDT_Short:
-        lsize = 2;
-        break;
-
-    case EDT_UInt:
-    case EDT_Int:
-    case EDT_Float:
-        lsize = 4;
-        break;
-
-    case EDT_Double:
-        lsize = 8;
-        break;
-
-    case EDT_INVALID:
-    default:
-        break;
+    const unsigned int lsize = PLY::Property::GetDataTypeSize(eType);
+    if (0 == lsize) {
+        return false;
     }
 
     //read the next file block if needed
-    if (bufferSize < lsize) {
-        std::vector<char> nbuffer;
-        if (streamBuffer.getNextBlock(nbuffer)) {
-            //concat buffer contents
-            buffer = std::vector<char>(buffer.end() - bufferSize, buffer.end());
-            buffer.insert(buffer.end(), nbuffer.begin(), nbuffer.end());
-            nbuffer.clear();
-            bufferSize = static_cast<unsigned int>(buffer.size());
-            pCur = (char *)&buffer[0];
-        } else {
-            throw DeadlyImportError("Invalid .ply file: File corrupted");
-        }
-    }
-
-    bool ret = true;
-    switch (eType) {
-    case EDT_UInt: {
-        uint32_t t;
-        memcpy(&t, pCur, sizeof(uint32_t));
-        pCur += sizeof(uint32_t);
-
-        // Swap endianness
-        if (p_bBE) ByteSwap::Swap(&t);
-        out->iUInt = t;
-        break;
-    }
-
-    case EDT_UShort: {
-        uint16_t t;
-        memcpy(&t, pCur, sizeof(uint16_t));
-        pCur += sizeof(uint16_t);
-
-        // Swap endianness
-        if (p_bBE) ByteSwap::Swap(&t);
-        out->iUInt = t;
-        break;
-    }
+    FillBinaryBuffer(streamBuffer, buffer, pCur, bufferSize, lsize);
 
-    case EDT_UChar: {
-        uint8_t t;
-        memcpy(&t, pCur, sizeof(uint8_t));
-        pCur += sizeof(uint8_t);
-        out->iUInt = t;
-        break;
-    }
-
-    case EDT_Int: {
-        int32_t t;
-        memcpy(&t, pCur, sizeof(int32_t));
-        pCur += sizeof(int32_t);
-
-        // Swap endianness
-        if (p_bBE) ByteSwap::Swap(&t);
-        out->iInt = t;
-        break;
-    }
-
-    case EDT_Short: {
-        int16_t t;
-        memcpy(&t, pCur, sizeof(int16_t));
-        pCur += sizeof(int16_t);
-
-        // Swap endianness
-        if (p_bBE) ByteSwap::Swap(&t);
-        out->iInt = t;
-        break;
-    }
-
-    case EDT_Char: {
-        int8_t t;
-        memcpy(&t, pCur, sizeof(int8_t));
-        pCur += sizeof(int8_t);
-        out->iInt = t;
-        break;
-    }
-
-    case EDT_Float: {
-        float t;
-        memcpy(&t, pCur, sizeof(float));
-        pCur += sizeof(float);
+    ::memcpy(out, pCur, lsize);
+    pCur += lsize;
+    bufferSize -= lsize;
 
-        // Swap endianness
-        if (p_bBE) ByteSwap::Swap(&t);
-        out->fFloat = t;
-        break;
+    // Swap endianness
+    if (p_bBE) {
+        SwapValue(out, lsize);
     }
-    case EDT_Double: {
-        double t;
-        memcpy(&t, pCur, sizeof(double));
-        pCur += sizeof(double);
 
-        // Swap endianness
-        if (p_bBE) ByteSwap::Swap(&t);
-        out->fDouble = t;
-        break;
-    }
-    default:
-        ret = false;
-    }
-
-    bufferSize -= lsize;
-
-    return ret;
+    return true;
 }
 
 #endif // !! ASSIMP_BUILD_NO_PLY_IMPORTER
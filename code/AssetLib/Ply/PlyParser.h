@@ -44,8 +44,10 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef AI_PLYFILEHELPER_H_INC
 #define AI_PLYFILEHELPER_H_INC
 
+#include <assimp/ImportLimits.h>
 #include <assimp/ParsingUtils.h>
 #include <assimp/IOStreamBuffer.h>
+#include <cstring>
 #include <vector>
 
 namespace Assimp
@@ -246,6 +248,10 @@ public:
     // -------------------------------------------------------------------
     //! Parse a semantic from a string
     static ESemantic ParseSemantic(std::vector<char> &buffer);
+
+    // -------------------------------------------------------------------
+    //! Get the size of a value of a data type in binary files
+    static unsigned int GetDataTypeSize(EDataType eType);
 };
 
 // ---------------------------------------------------------------------------------
@@ -284,127 +290,175 @@ public:
     //! element, too.
     static bool ParseElement(IOStreamBuffer<char> &streamBuffer, std::vector<char> &buffer, Element* pOut);
 
+    // -------------------------------------------------------------------
+    //! Get the size of a binary instance of the element, 0 if
+    //! its size varies since it contains lists
+    unsigned int GetRecordSize() const;
+
     // -------------------------------------------------------------------
     //! Parse a semantic from a string
     static EElementSemantic ParseSemantic(std::vector<char> &buffer);
 };
 
 // ---------------------------------------------------------------------------------
-/** \brief Instance of a property in a PLY file
+/** \brief Values of one property for a run of element instances in a PLY file
+ *
+ * The values of all instances are stored back to back in their data type.
+ * Lists additionally store the index of their first value, so the list of
+ * instance i covers the values [aiListStart[i], aiListStart[i+1]).
  */
-class PropertyInstance
-{
+class PropertyColumn {
 public:
-
     //! Default constructor
-    PropertyInstance() AI_NO_EXCEPT {
+    PropertyColumn() AI_NO_EXCEPT
+    : eType(EDT_Int)
+    , iTypeSize(4)
+    , aValues()
+    , aiListStart() {
         // empty
     }
 
-    union ValueUnion
-    {
-
-        //! uInt32 representation of the property. All
-        // uint types are automatically converted to uint32
-        uint32_t iUInt;
-
-        //! Int32 representation of the property. All
-        // int types are automatically converted to int32
-        int32_t iInt;
-
-        //! Float32 representation of the property
-        float fFloat;
+    //! Data type of the stored values. Integers of ASCII files
+    //! are stored with 32 bits, like they are parsed
+    EDataType eType;
 
-        //! Float64 representation of the property
-        double fDouble;
+    //! Size of one stored value in bytes
+    unsigned int iTypeSize;
 
-    };
+    //! Values of all instances in host byte order
+    std::vector<uint8_t> aValues;
 
-    // -------------------------------------------------------------------
-    //! List of all values parsed. Contains only one value
-    // for non-list properties
-    std::vector<ValueUnion> avList;
+    //! Index of the first value of each list and the number of all
+    //! values at the end. Empty for non-list properties
+    std::vector<unsigned int> aiListStart;
 
     // -------------------------------------------------------------------
-    //! Parse a property instance
-    static bool ParseInstance(const char* &pCur,
-        const Property* prop, PropertyInstance* p_pcOut);
+    //! Number of values stored in the column
+    size_t NumValues() const {
+        return aValues.size() / iTypeSize;
+    }
 
     // -------------------------------------------------------------------
-    //! Parse a property instance in binary format
-    static bool ParseInstanceBinary(IOStreamBuffer<char> &streamBuffer, std::vector<char> &buffer,
-        const char* &pCur, unsigned int &bufferSize, const Property* prop, PropertyInstance* p_pcOut, bool p_bBE);
+    //! Index of the first value of an instance
+    size_t ValueIndex(unsigned int instance) const {
+        return aiListStart.empty() ? instance : aiListStart[instance];
+    }
 
     // -------------------------------------------------------------------
-    //! Get the default value for a given data type
-    static ValueUnion DefaultValue(EDataType eType);
+    //! Number of values of an instance, 1 for non-list properties
+    unsigned int ListSize(unsigned int instance) const {
+        return aiListStart.empty() ? 1u : aiListStart[instance + 1] - aiListStart[instance];
+    }
 
     // -------------------------------------------------------------------
-    //! Parse a value
-    static bool ParseValue(const char* &pCur, EDataType eType, ValueUnion* out);
+    //! Convert a stored value to a given type TYPE
+    template <typename TYPE>
+    TYPE Get(size_t index) const {
+        return ConvertTo<TYPE>(&aValues[index * iTypeSize], eType);
+    }
 
     // -------------------------------------------------------------------
-    //! Parse a binary value
-    static bool ParseValueBinary(IOStreamBuffer<char> &streamBuffer, std::vector<char> &buffer,
-        const char* &pCur, unsigned int &bufferSize, EDataType eType, ValueUnion* out, bool p_bBE);
+    //! Convert a run of stored values to a given type TYPE. The
+    //! values are written stride elements apart
+    template <typename TYPE>
+    void Get(size_t first, size_t count, TYPE *out, size_t stride = 1) const;
 
     // -------------------------------------------------------------------
-    //! Convert a property value to a given type TYPE
+    //! Convert a value of a given data type to a given type TYPE
     template <typename TYPE>
-    static TYPE ConvertTo(ValueUnion v, EDataType eType);
+    static TYPE ConvertTo(const uint8_t *value, EDataType eType);
+
+private:
+    template <typename TYPE, typename VALUE>
+    static void ConvertRun(const uint8_t *values, size_t count, TYPE *out, size_t stride);
 };
 
 // ---------------------------------------------------------------------------------
-/** \brief Class for an element instance in a PLY file
+/** \brief Data of a run of element instances in a PLY file, one column
+ *  per property
  */
-class ElementInstance {
+class ElementData {
 public:
     //! Default constructor
-    ElementInstance()  AI_NO_EXCEPT
-    : alProperties() {
+    ElementData() AI_NO_EXCEPT
+    : alColumns()
+    , NumInstances(0)
+    , Reserved() {
         // empty
     }
 
-    //! List of all parsed properties
-    std::vector< PropertyInstance > alProperties;
+    //! Values of all properties, in the order of the element's properties
+    std::vector<PropertyColumn> alColumns;
+
+    //! Number of instances stored in the columns
+    unsigned int NumInstances;
+
+    //! Charge of the columns to the memory budget of the import
+    ImportLimits::Reservation Reserved;
 
     // -------------------------------------------------------------------
-    //! Parse an element instance
-    static bool ParseInstance(const char* &pCur,
-        const Element* pcElement, ElementInstance* p_pcOut);
+    //! Set up an empty column for each property of an element
+    void Reset(const Element *pcElement, bool bAscii);
 
     // -------------------------------------------------------------------
-    //! Parse a binary element instance
-    static bool ParseInstanceBinary(IOStreamBuffer<char> &streamBuffer, std::vector<char> &buffer,
-        const char* &pCur, unsigned int &bufferSize, const Element* pcElement, ElementInstance* p_pcOut, bool p_bBE);
-};
+    //! Remove all instances, the storage is kept for the next run
+    void Clear();
 
-// ---------------------------------------------------------------------------------
-/** \brief Class for an element instance list in a PLY file
- */
-class ElementInstanceList
-{
-public:
+    // -------------------------------------------------------------------
+    //! Charge the storage of the columns and the given number of bytes
+    //! about to be appended to them to the memory budget of the import
+    void ReserveColumns(uint64_t iAppend = 0);
 
-    //! Default constructor
-    ElementInstanceList() AI_NO_EXCEPT
-    : alInstances() {
-        // empty
-    }
+    // -------------------------------------------------------------------
+    //! Allocate and charge the columns for a number of instances which
+    //! are stored completely
+    void Reserve(unsigned int iNumInstances);
+
+    // -------------------------------------------------------------------
+    //! Parse an element instance and append it
+    bool ParseInstance(const char *&pCur, const Element *pcElement);
 
-    //! List of all element instances
-    std::vector< ElementInstance > alInstances;
+    // -------------------------------------------------------------------
+    //! Parse a binary element instance value by value and append it
+    bool ParseInstanceBinary(IOStreamBuffer<char> &streamBuffer, std::vector<char> &buffer,
+        const char *&pCur, unsigned int &bufferSize, const Element *pcElement, bool p_bBE);
 
     // -------------------------------------------------------------------
-    //! Parse an element instance list
+    //! Append count binary instances of an element without lists from
+    //! a block of records, each column is copied in one pass
+    void ParseBlockBinary(const char *pCur, const Element *pcElement, unsigned int count, bool p_bBE);
+
+    // -------------------------------------------------------------------
+    //! Parse an element instance list. With a loader, the instances are
+    //! handed over in runs and p_pcOut is empty afterwards
     static bool ParseInstanceList(IOStreamBuffer<char> &streamBuffer, std::vector<char> &buffer,
-        const Element* pcElement, ElementInstanceList* p_pcOut, PLYImporter* loader);
+        const Element *pcElement, ElementData *p_pcOut, PLYImporter *loader);
 
     // -------------------------------------------------------------------
-    //! Parse a binary element instance list
+    //! Parse a binary element instance list. With a loader, the instances
+    //! are handed over in runs and p_pcOut is empty afterwards
     static bool ParseInstanceListBinary(IOStreamBuffer<char> &streamBuffer, std::vector<char> &buffer,
-        const char* &pCur, unsigned int &bufferSize, const Element* pcElement, ElementInstanceList* p_pcOut, PLYImporter* loader, bool p_bBE);
+        const char *&pCur, unsigned int &bufferSize, const Element *pcElement, ElementData *p_pcOut, PLYImporter *loader, bool p_bBE);
+
+    // -------------------------------------------------------------------
+    //! Parse a value, it is written in the data type it is stored in
+    //! for ASCII files
+    static bool ParseValue(const char *&pCur, EDataType eType, uint8_t *out);
+
+    // -------------------------------------------------------------------
+    //! Parse a binary value, it is written in host byte order
+    static bool ParseValueBinary(IOStreamBuffer<char> &streamBuffer, std::vector<char> &buffer,
+        const char *&pCur, unsigned int &bufferSize, EDataType eType, uint8_t *out, bool p_bBE);
+
+    // -------------------------------------------------------------------
+    //! Get the data type values of a given data type are stored in
+    //! for ASCII files
+    static EDataType GetAsciiStorageType(EDataType eType);
+
+    //! Maximum number of instances handed over to the loader at once
+    static const unsigned int RunSize = 16384;
 };
+
 // ---------------------------------------------------------------------------------
 /** \brief Class to represent the document object model of an ASCII or binary
  * (both little and big-endian) PLY file
@@ -424,7 +478,7 @@ public:
     //! Contains all elements of the file format
     std::vector<Element> alElements;
     //! Contains the real data of each element's instance list
-    std::vector<ElementInstanceList> alElementData;
+    std::vector<ElementData> alElementData;
 
     //! Parse the DOM for a PLY file. The input string is assumed
     //! to be terminated with zero
@@ -459,30 +513,101 @@ private:
 
 // ---------------------------------------------------------------------------------
 template <typename TYPE>
-inline TYPE PLY::PropertyInstance::ConvertTo(
-    PLY::PropertyInstance::ValueUnion v, PLY::EDataType eType)
+inline TYPE PLY::PropertyColumn::ConvertTo(const uint8_t *value, PLY::EDataType eType)
 {
     switch (eType)
     {
-    case EDT_Float:
-        return (TYPE)v.fFloat;
-    case EDT_Double:
-        return (TYPE)v.fDouble;
-
-    case EDT_UInt:
-    case EDT_UShort:
-    case EDT_UChar:
-        return (TYPE)v.iUInt;
-
-    case EDT_Int:
-    case EDT_Short:
     case EDT_Char:
-        return (TYPE)v.iInt;
+        return (TYPE)*reinterpret_cast<const int8_t *>(value);
+    case EDT_UChar:
+        return (TYPE)*value;
+    case EDT_Short: {
+        int16_t v;
+        ::memcpy(&v, value, sizeof(v));
+        return (TYPE)v;
+    }
+    case EDT_UShort: {
+        uint16_t v;
+        ::memcpy(&v, value, sizeof(v));
+        return (TYPE)v;
+    }
+    case EDT_Int: {
+        int32_t v;
+        ::memcpy(&v, value, sizeof(v));
+        return (TYPE)v;
+    }
+    case EDT_UInt: {
+        uint32_t v;
+        ::memcpy(&v, value, sizeof(v));
+        return (TYPE)v;
+    }
+    case EDT_Float: {
+        float v;
+        ::memcpy(&v, value, sizeof(v));
+        return (TYPE)v;
+    }
+    case EDT_Double: {
+        double v;
+        ::memcpy(&v, value, sizeof(v));
+        return (TYPE)v;
+    }
     default: ;
     };
     return (TYPE)0;
 }
 
+// ---------------------------------------------------------------------------------
+template <typename TYPE, typename VALUE>
+inline void PLY::PropertyColumn::ConvertRun(const uint8_t *values, size_t count, TYPE *out, size_t stride)
+{
+    for (size_t i = 0; i < count; ++i, values += sizeof(VALUE), out += stride) {
+        VALUE v;
+        ::memcpy(&v, values, sizeof(VALUE));
+        *out = (TYPE)v;
+    }
+}
+
+// ---------------------------------------------------------------------------------
+template <typename TYPE>
+inline void PLY::PropertyColumn::Get(size_t first, size_t count, TYPE *out, size_t stride) const
+{
+    if (0 == count) {
+        return;
+    }
+    const uint8_t *values = &aValues[first * iTypeSize];
+    switch (eType)
+    {
+    case EDT_Char:
+        ConvertRun<TYPE, int8_t>(values, count, out, stride);
+        break;
+    case EDT_UChar:
+        ConvertRun<TYPE, uint8_t>(values, count, out, stride);
+        break;
+    case EDT_Short:
+        ConvertRun<TYPE, int16_t>(values, count, out, stride);
+        break;
+    case EDT_UShort:
+        ConvertRun<TYPE, uint16_t>(values, count, out, stride);
+        break;
+    case EDT_Int:
+        ConvertRun<TYPE, int32_t>(values, count, out, stride);
+        break;
+    case EDT_UInt:
+        ConvertRun<TYPE, uint32_t>(values, count, out, stride);
+        break;
+    case EDT_Float:
+        ConvertRun<TYPE, float>(values, count, out, stride);
+        break;
+    case EDT_Double:
+        ConvertRun<TYPE, double>(values, count, out, stride);
+        break;
+    default:
+        for (size_t i = 0; i < count; ++i, out += stride) {
+            *out = (TYPE)0;
+        }
+    };
+}
+
 } // Namespace PLY
 } // Namespace AssImp
 
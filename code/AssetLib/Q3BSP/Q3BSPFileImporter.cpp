@@ -293,7 +293,7 @@ void Q3BSPFileImporter::CreateNodes(const Q3BSP::Q3BSPModel *pModel, aiScene *pS
 
     pScene->mNumMeshes = static_cast<unsigned int>(MeshArray.size());
     if (pScene->mNumMeshes > 0) {
-        pScene->mMeshes = new aiMesh *[pScene->mNumMeshes];
+        pScene->mMeshes = AllocateSceneArray<aiMesh *>(pScene->mNumMeshes);
         for (size_t i = 0; i < MeshArray.size(); i++) {
             aiMesh *pMesh = MeshArray[i];
             if (nullptr != pMesh) {
@@ -303,7 +303,7 @@ void Q3BSPFileImporter::CreateNodes(const Q3BSP::Q3BSPModel *pModel, aiScene *pS
     }
 
     pParent->mNumChildren = static_cast<unsigned int>(MeshArray.size());
-    pParent->mChildren = new aiNode *[pScene->mRootNode->mNumChildren];
+    pParent->mChildren = AllocateSceneArray<aiNode *>(pScene->mRootNode->mNumChildren);
     for (size_t i = 0; i < NodeArray.size(); i++) {
         aiNode *pNode = NodeArray[i];
         pNode->mParent = pParent;
@@ -360,7 +360,7 @@ aiNode *Q3BSPFileImporter::CreateTopology(const Q3BSP::Q3BSPModel *pModel, unsig
 
     aiNode *pNode = new aiNode;
     pNode->mNumMeshes = 1;
-    pNode->mMeshes = new unsigned int[1];
+    pNode->mMeshes = AllocateSceneArray<unsigned int>(1);
     *pMesh = mesh;
 
     return pNode;
@@ -378,7 +378,7 @@ void Q3BSPFileImporter::createTriangleTopology(const Q3BSP::Q3BSPModel *pModel,
     }
 
     m_pCurrentFace->mNumIndices = 3;
-    m_pCurrentFace->mIndices = new unsigned int[m_pCurrentFace->mNumIndices];
+    m_pCurrentFace->mIndices = AllocateSceneArray<unsigned int>(m_pCurrentFace->mNumIndices);
 
     size_t idx(0);
     for (size_t i = 0; i < (size_t)pQ3BSPFace->iNumOfFaceVerts; ++i) {
@@ -396,7 +396,7 @@ void Q3BSPFileImporter::createTriangleTopology(const Q3BSP::Q3BSPModel *pModel,
             m_pCurrentFace = getNextFace(pMesh, faceIdx);
             if (nullptr != m_pCurrentFace) {
                 m_pCurrentFace->mNumIndices = 3;
-                m_pCurrentFace->mIndices = new unsigned int[3];
+                m_pCurrentFace->mIndices = AllocateSceneArray<unsigned int>(3);
                 m_pCurrentFace->mIndices[idx] = vertIdx;
             }
         }
@@ -420,7 +420,7 @@ void Q3BSPFileImporter::createMaterials(const Q3BSP::Q3BSPModel *pModel, aiScene
         return;
     }
 
-    pScene->mMaterials = new aiMaterial *[m_MaterialLookupMap.size()];
+    pScene->mMaterials = AllocateSceneArray<aiMaterial *>(m_MaterialLookupMap.size());
     aiString aiMatName;
     int textureId(-1), lightmapId(-1);
     for (FaceMapIt it = m_MaterialLookupMap.begin(); it != m_MaterialLookupMap.end();
@@ -457,7 +457,7 @@ void Q3BSPFileImporter::createMaterials(const Q3BSP::Q3BSPModel *pModel, aiScene
         pScene->mNumMaterials++;
     }
     pScene->mNumTextures = static_cast<unsigned int>(mTextures.size());
-    pScene->mTextures = new aiTexture *[pScene->mNumTextures];
+    pScene->mTextures = AllocateSceneArray<aiTexture *>(pScene->mNumTextures);
     std::copy(mTextures.begin(), mTextures.end(), pScene->mTextures);
 }
 
@@ -576,7 +576,7 @@ bool Q3BSPFileImporter::importTextureFromArchive(const Q3BSP::Q3BSPModel *model,
             aiTexture *curTexture = new aiTexture;
             curTexture->mHeight = 0;
             curTexture->mWidth = static_cast<unsigned int>(texSize);
-            unsigned char *pData = new unsigned char[curTexture->mWidth];
+            unsigned char *pData = AllocateSceneArray<unsigned char>(curTexture->mWidth);
             size_t readSize = pTextureStream->Read(pData, sizeof(unsigned char), curTexture->mWidth);
             (void)readSize;
             ai_assert(readSize == curTexture->mWidth);
@@ -629,7 +629,7 @@ bool Q3BSPFileImporter::importLightmap(const Q3BSP::Q3BSPModel *pModel, aiScene
 
     pTexture->mWidth = CE_BSP_LIGHTMAPWIDTH;
     pTexture->mHeight = CE_BSP_LIGHTMAPHEIGHT;
-    pTexture->pcData = new aiTexel[CE_BSP_LIGHTMAPWIDTH * CE_BSP_LIGHTMAPHEIGHT];
+    pTexture->pcData = AllocateSceneArray<aiTexel>(CE_BSP_LIGHTMAPWIDTH * CE_BSP_LIGHTMAPHEIGHT);
 
     ::memcpy(pTexture->pcData, pLightMap->bLMapData, pTexture->mWidth);
     size_t p = 0;
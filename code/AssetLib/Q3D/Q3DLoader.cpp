@@ -293,7 +293,7 @@ void Q3DImporter::InternReadFile(const std::string &pFile,
             if (!numTextures) {
                 break;
             }
-            pScene->mTextures = new aiTexture *[pScene->mNumTextures];
+            pScene->mTextures = AllocateSceneArray<aiTexture *>(pScene->mNumTextures);
             // to make sure we won't crash if we leave through an exception
             ::memset(pScene->mTextures, 0, sizeof(void *) * pScene->mNumTextures);
             for (unsigned int i = 0; i < pScene->mNumTextures; ++i) {
@@ -312,7 +312,7 @@ void Q3DImporter::InternReadFile(const std::string &pFile,
                 }
 
                 unsigned int mul = tex->mWidth * tex->mHeight;
-                aiTexel *begin = tex->pcData = new aiTexel[mul];
+                aiTexel *begin = tex->pcData = AllocateSceneArray<aiTexel>(mul);
                 aiTexel *const end = &begin[mul - 1] + 1;
 
                 for (; begin != end; ++begin) {
@@ -338,7 +338,7 @@ void Q3DImporter::InternReadFile(const std::string &pFile,
 
             // now setup a single camera
             pScene->mNumCameras = 1;
-            pScene->mCameras = new aiCamera *[1];
+            pScene->mCameras = AllocateSceneArray<aiCamera *>(1);
             aiCamera *cam = pScene->mCameras[0] = new aiCamera();
             cam->mPosition.x = stream.GetF4();
             cam->mPosition.y = stream.GetF4();
@@ -358,7 +358,7 @@ void Q3DImporter::InternReadFile(const std::string &pFile,
 
             // setup a single point light with no attenuation
             pScene->mNumLights = 1;
-            pScene->mLights = new aiLight *[1];
+            pScene->mLights = AllocateSceneArray<aiLight *>(1);
             aiLight *light = pScene->mLights[0] = new aiLight();
             light->mName.Set("Q3DLight");
             light->mType = aiLightSource_POINT;
@@ -425,8 +425,8 @@ outer:
         }
     }
     pScene->mNumMaterials = pScene->mNumMeshes;
-    pScene->mMaterials = new aiMaterial *[pScene->mNumMaterials];
-    pScene->mMeshes = new aiMesh *[pScene->mNumMaterials];
+    pScene->mMaterials = AllocateSceneArray<aiMaterial *>(pScene->mNumMaterials);
+    pScene->mMeshes = AllocateSceneArray<aiMesh *>(pScene->mNumMaterials);
 
     for (unsigned int i = 0, real = 0; i < (unsigned int)materials.size(); ++i) {
         if (fidx[i].empty()) continue;
@@ -495,7 +495,7 @@ outer:
             Mesh &curMesh = meshes[(*it).first];
             Face &face = curMesh.faces[(*it).second];
             faces->mNumIndices = (unsigned int)face.indices.size();
-            faces->mIndices = new unsigned int[faces->mNumIndices];
+            faces->mIndices = AllocateSceneArray<unsigned int>(faces->mNumIndices);
 
             aiVector3D faceNormal;
             bool fnOK = false;
@@ -551,7 +551,7 @@ outer:
 
     // Now we need to attach the meshes to the root node of the scene
     pScene->mRootNode->mNumMeshes = pScene->mNumMeshes;
-    pScene->mRootNode->mMeshes = new unsigned int[pScene->mNumMeshes];
+    pScene->mRootNode->mMeshes = AllocateSceneArray<unsigned int>(pScene->mNumMeshes);
     for (unsigned int i = 0; i < pScene->mNumMeshes; ++i)
         pScene->mRootNode->mMeshes[i] = i;
 
@@ -564,7 +564,7 @@ outer:
     // Add cameras and light sources to the scene root node
     pScene->mRootNode->mNumChildren = pScene->mNumLights + pScene->mNumCameras;
     if (pScene->mRootNode->mNumChildren) {
-        pScene->mRootNode->mChildren = new aiNode *[pScene->mRootNode->mNumChildren];
+        pScene->mRootNode->mChildren = AllocateSceneArray<aiNode *>(pScene->mRootNode->mNumChildren);
 
         // the light source
         aiNode *nd = pScene->mRootNode->mChildren[0] = new aiNode();
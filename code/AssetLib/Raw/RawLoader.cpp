@@ -215,19 +215,19 @@ void RAWImporter::InternReadFile(const std::string &pFile,
         throw DeadlyImportError("RAW: No meshes loaded. The file seems to be corrupt or empty.");
     }
 
-    pScene->mMeshes = new aiMesh *[pScene->mNumMeshes];
+    pScene->mMeshes = AllocateSceneArray<aiMesh *>(pScene->mNumMeshes);
     aiNode **cc;
     if (1 == pScene->mRootNode->mNumChildren) {
         cc = &pScene->mRootNode;
         pScene->mRootNode->mNumChildren = 0;
     } else {
-        cc = new aiNode *[pScene->mRootNode->mNumChildren];
+        cc = AllocateSceneArray<aiNode *>(pScene->mRootNode->mNumChildren);
         memset(cc, 0, sizeof(aiNode *) * pScene->mRootNode->mNumChildren);
         pScene->mRootNode->mChildren = cc;
     }
 
     pScene->mNumMaterials = pScene->mNumMeshes;
-    aiMaterial **mats = pScene->mMaterials = new aiMaterial *[pScene->mNumMaterials];
+    aiMaterial **mats = pScene->mMaterials = AllocateSceneArray<aiMaterial *>(pScene->mNumMaterials);
 
     unsigned int meshIdx = 0;
     for (auto &outGroup : outGroups) {
@@ -243,7 +243,7 @@ void RAWImporter::InternReadFile(const std::string &pFile,
 
         // add all meshes
         node->mNumMeshes = (unsigned int)outGroup.meshes.size();
-        unsigned int *pi = node->mMeshes = new unsigned int[node->mNumMeshes];
+        unsigned int *pi = node->mMeshes = AllocateSceneArray<unsigned int>(node->mNumMeshes);
         for (std::vector<MeshInformation>::iterator it2 = outGroup.meshes.begin(),
                                                     end2 = outGroup.meshes.end();
                 it2 != end2; ++it2) {
@@ -275,7 +275,7 @@ void RAWImporter::InternReadFile(const std::string &pFile,
             unsigned int n = 0;
             while (fc != fcEnd) {
                 aiFace &f = *fc++;
-                f.mIndices = new unsigned int[f.mNumIndices = 3];
+                f.mIndices = AllocateSceneArray<unsigned int>(f.mNumIndices = 3);
                 for (unsigned int m = 0; m < 3; ++m)
                     f.mIndices[m] = n++;
             }
@@ -835,9 +835,9 @@ void SIBImporter::InternReadFile(const std::string &pFile,
     pScene->mNumMaterials = static_cast<unsigned int>(sib.mtls.size());
     pScene->mNumMeshes = static_cast<unsigned int>(sib.meshes.size());
     pScene->mNumLights = static_cast<unsigned int>(sib.lights.size());
-    pScene->mMaterials = pScene->mNumMaterials ? new aiMaterial *[pScene->mNumMaterials] : nullptr;
-    pScene->mMeshes = pScene->mNumMeshes ? new aiMesh *[pScene->mNumMeshes] : nullptr;
-    pScene->mLights = pScene->mNumLights ? new aiLight *[pScene->mNumLights] : nullptr;
+    pScene->mMaterials = pScene->mNumMaterials ? AllocateSceneArray<aiMaterial *>(pScene->mNumMaterials) : nullptr;
+    pScene->mMeshes = pScene->mNumMeshes ? AllocateSceneArray<aiMesh *>(pScene->mNumMeshes) : nullptr;
+    pScene->mLights = pScene->mNumLights ? AllocateSceneArray<aiLight *>(pScene->mNumLights) : nullptr;
     if (pScene->mNumMaterials)
         memcpy(pScene->mMaterials, &sib.mtls[0], sizeof(aiMaterial *) * pScene->mNumMaterials);
     if (pScene->mNumMeshes)
@@ -850,7 +850,7 @@ void SIBImporter::InternReadFile(const std::string &pFile,
     aiNode *root = new aiNode();
     root->mName.Set("<SIBRoot>");
     root->mNumChildren = static_cast<unsigned int>(sib.objs.size() + sib.lights.size());
-    root->mChildren = root->mNumChildren ? new aiNode *[root->mNumChildren] : nullptr;
+    root->mChildren = root->mNumChildren ? AllocateSceneArray<aiNode *>(root->mNumChildren) : nullptr;
     pScene->mRootNode = root;
 
     // Add nodes for each object.
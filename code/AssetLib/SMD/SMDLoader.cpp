@@ -173,7 +173,7 @@ void SMDImporter::InternReadFile( const std::string& pFile, aiScene* scene, IOSy
 
         // use root node that renders all meshes
         pScene->mRootNode->mNumMeshes = pScene->mNumMeshes;
-        pScene->mRootNode->mMeshes = new unsigned int[pScene->mNumMeshes];
+        pScene->mRootNode->mMeshes = AllocateSceneArray<unsigned int>(pScene->mNumMeshes);
         for (unsigned int i = 0; i < pScene->mNumMeshes; ++i) {
             pScene->mRootNode->mMeshes[i] = i;
         }
@@ -235,7 +235,7 @@ void SMDImporter::CreateOutputMeshes() {
     // in opposition to other loaders we can be sure that each
     // material is at least used once.
     pScene->mNumMeshes = (unsigned int) aszTextures.size();
-    pScene->mMeshes = new aiMesh*[pScene->mNumMeshes];
+    pScene->mMeshes = AllocateSceneArray<aiMesh *>(pScene->mNumMeshes);
 
     typedef std::vector<unsigned int> FaceList;
     FaceList* aaiFaces = new FaceList[pScene->mNumMeshes];
@@ -296,7 +296,7 @@ void SMDImporter::CreateOutputMeshes() {
 
         iNum = 0;
         for (unsigned int iFace = 0; iFace < pcMesh->mNumFaces;++iFace) {
-            pcMesh->mFaces[iFace].mIndices = new unsigned int[3];
+            pcMesh->mFaces[iFace].mIndices = AllocateSceneArray<unsigned int>(3);
             pcMesh->mFaces[iFace].mNumIndices = 3;
 
             // fill the vertices
@@ -377,7 +377,7 @@ void SMDImporter::CreateOutputMeshes() {
 
         if (iNum) {
             pcMesh->mNumBones = iNum;
-            pcMesh->mBones = new aiBone*[pcMesh->mNumBones];
+            pcMesh->mBones = AllocateSceneArray<aiBone *>(pcMesh->mNumBones);
             iNum = 0;
             for (unsigned int iBone = 0; iBone < asBones.size();++iBone) {
                 if (aaiBones[iBone].empty()) {
@@ -420,7 +420,7 @@ void SMDImporter::AddBoneChildren(aiNode* pcNode, uint32_t iParent) {
     }
 
     // now allocate the output array
-    pcNode->mChildren = new aiNode*[pcNode->mNumChildren];
+    pcNode->mChildren = AllocateSceneArray<aiNode *>(pcNode->mNumChildren);
 
     // and fill all subnodes
     unsigned int qq( 0 );
@@ -488,7 +488,7 @@ void SMDImporter::CreateOutputAnimations(const std::string &pFile, IOSystem* pIO
     }
     int animCount = static_cast<int>( animFileList.size() + 1u );
     pScene->mNumAnimations = 1;
-    pScene->mAnimations = new aiAnimation*[animCount];
+    pScene->mAnimations = AllocateSceneArray<aiAnimation *>(animCount);
     memset(pScene->mAnimations, 0, sizeof(aiAnimation*)*animCount);
     CreateOutputAnimation(0, "");
 
@@ -513,7 +513,7 @@ void SMDImporter::CreateOutputAnimation(int index, const std::string &name) {
     anim->mNumChannels = static_cast<unsigned int>( asBones.size() );
     anim->mTicksPerSecond = 25.0; // FIXME: is this correct?
 
-    aiNodeAnim** pp = anim->mChannels = new aiNodeAnim*[anim->mNumChannels];
+    aiNodeAnim** pp = anim->mChannels = AllocateSceneArray<aiNodeAnim *>(anim->mNumChannels);
 
     // now build valid keys
     unsigned int a = 0;
@@ -602,7 +602,7 @@ void SMDImporter::CreateOutputMaterials() {
     ai_assert( nullptr != pScene );
 
     pScene->mNumMaterials = (unsigned int)aszTextures.size();
-    pScene->mMaterials = new aiMaterial*[std::max(1u, pScene->mNumMaterials)];
+    pScene->mMaterials = AllocateSceneArray<aiMaterial *>(std::max(1u, pScene->mNumMaterials));
 
     for (unsigned int iMat = 0; iMat < pScene->mNumMaterials; ++iMat) {
         aiMaterial* pcMat = new aiMaterial();
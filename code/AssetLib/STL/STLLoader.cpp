@@ -47,11 +47,14 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "STLLoader.h"
 #include <assimp/ParsingUtils.h>
 #include <assimp/fast_atof.h>
+#include <assimp/ImportLimits.h>
 #include <assimp/importerdesc.h>
 #include <assimp/scene.h>
 #include <assimp/DefaultLogger.hpp>
 #include <assimp/IOSystem.hpp>
+#include <algorithm>
 #include <memory>
+#include <utility>
 
 using namespace Assimp;
 
@@ -163,14 +166,9 @@ const aiImporterDesc *STLImporter::GetInfo() const {
 }
 
 void addFacesToMesh(aiMesh *pMesh) {
-    pMesh->mFaces = new aiFace[pMesh->mNumFaces];
-    for (unsigned int i = 0, p = 0; i < pMesh->mNumFaces; ++i) {
-
-        aiFace &face = pMesh->mFaces[i];
-        face.mIndices = new unsigned int[face.mNumIndices = 3];
-        for (unsigned int o = 0; o < 3; ++o, ++p) {
-            face.mIndices[o] = p;
-        }
+    unsigned int *indices = pMesh->AllocateUniformFaces(pMesh->mNumFaces, 3);
+    for (unsigned int p = 0; p < pMesh->mNumFaces * 3; ++p) {
+        indices[p] = p;
     }
 }
 
@@ -186,13 +184,25 @@ void STLImporter::InternReadFile(const std::string &pFile, aiScene *pScene, IOSy
 
     mFileSize = (unsigned int)file->FileSize();
 
-    // allocate storage and copy the contents of the file to a memory buffer
-    // (terminate it with zero)
+    // binary files are processed in-place if the stream can hand out the whole
+    // file (e.g. a memory mapping). Otherwise allocate storage and copy the
+    // contents of the file to a memory buffer (terminate it with zero)
     std::vector<char> buffer2;
-    TextFileToBuffer(file.get(), buffer2);
+    char header[84];
+    const char *view = reinterpret_cast<const char *>(file->GetContiguousView());
+    if (nullptr != view && IsBinarySTL(view, mFileSize)) {
+        mBuffer = view;
+    } else if ((m_deferMeshData || nullptr != m_meshSink) && mFileSize >= 84 &&
+               84 == file->Read(header, 1, 84) && IsBinarySTL(header, mFileSize)) {
+        // the facets are loaded on demand or streamed, the header is all we need for now
+        mBuffer = header;
+    } else {
+        file->Seek(0, aiOrigin_SET);
+        TextFileToBuffer(file.get(), buffer2);
+        mBuffer = &buffer2[0];
+    }
 
     mScene = pScene;
-    mBuffer = &buffer2[0];
 
     // the default vertex color is light gray.
     mClrColorDefault.r = mClrColorDefault.g = mClrColorDefault.b = mClrColorDefault.a = (ai_real)0.6;
@@ -203,7 +213,7 @@ void STLImporter::InternReadFile(const std::string &pFile, aiScene *pScene, IOSy
     bool bMatClr = false;
 
     if (IsBinarySTL(mBuffer, mFileSize)) {
-        bMatClr = LoadBinaryFile();
+        bMatClr = LoadBinaryFile(mBuffer == header ? file.get() : nullptr);
     } else if (IsAsciiSTL(mBuffer, mFileSize)) {
         LoadASCIIFile(mScene->mRootNode);
     } else {
@@ -227,12 +237,68 @@ void STLImporter::InternReadFile(const std::string &pFile, aiScene *pScene, IOSy
     pcMat->AddProperty(&clrDiffuse, 1, AI_MATKEY_COLOR_AMBIENT);
 
     mScene->mNumMaterials = 1;
-    mScene->mMaterials = new aiMaterial *[1];
+    mScene->mMaterials = AllocateSceneArray<aiMaterial *>(1);
     mScene->mMaterials[0] = pcMat;
 
     mBuffer = nullptr;
 }
 
+// ------------------------------------------------------------------------------------------------
+// Loads the facets of a deferred binary file.
+void STLImporter::InternReadMeshData(const std::string &pFile, aiScene *pScene, unsigned int pMeshIndex, IOSystem *pIOHandler) {
+    if (0 != pMeshIndex || 1 != pScene->mNumMeshes) {
+        throw DeadlyImportError("STL: deferred mesh ", pMeshIndex, " does not exist in ", pFile);
+    }
+
+    std::unique_ptr<IOStream> file(pIOHandler->Open(pFile, "rb"));
+    if (file.get() == nullptr) {
+        throw DeadlyImportError("Failed to open STL file ", pFile, ".");
+    }
+    mFileSize = (unsigned int)file->FileSize();
+    if (mFileSize < 84) {
+        throw DeadlyImportError("STL: file is too small for the header");
+    }
+
+    // take the facets from the view if there is one, read them otherwise
+    unsigned char header[84];
+    const unsigned char *sz = file->GetContiguousView();
+    if (nullptr == sz) {
+        if (84 != file->Read(header, 1, 84)) {
+            throw DeadlyImportError("STL: unexpected end of file while reading the header");
+        }
+        sz = header;
+    }
+    const bool bIsMaterialise = ReadMaterialiseHeader(sz);
+
+    std::unique_ptr<aiMesh> pMesh(new aiMesh());
+    pMesh->mNumFaces = *((uint32_t *)(sz + 80));
+    pMesh->mNumVertices = pMesh->mNumFaces * 3;
+    if (pMesh->mNumFaces != pScene->mMeshes[0]->mNumFaces || mFileSize < 84 + pMesh->mNumFaces * 50) {
+        throw DeadlyImportError("STL: ", pFile, " changed since it was imported");
+    }
+
+    std::vector<unsigned char> facets;
+    if (sz == header) {
+        facets.resize(static_cast<size_t>(pMesh->mNumFaces) * 50);
+        if (file->Read(facets.data(), 50, pMesh->mNumFaces) != pMesh->mNumFaces) {
+            throw DeadlyImportError("STL: unexpected end of file while reading facets");
+        }
+        sz = facets.data();
+    } else {
+        sz += 84;
+    }
+    LoadBinaryFacets(pMesh.get(), sz, bIsMaterialise);
+    MoveMeshData(pScene->mMeshes[0], pMesh.get());
+
+    // the header color was taken as material color as long as the facet colors
+    // were unknown, facets with colors of their own get a white material
+    if (bIsMaterialise && nullptr != pScene->mMeshes[0]->mColors[0] && 1 == pScene->mNumMaterials) {
+        const aiColor4D clrDiffuse(ai_real(1.0), ai_real(1.0), ai_real(1.0), ai_real(1.0));
+        pScene->mMaterials[0]->AddProperty(&clrDiffuse, 1, AI_MATKEY_COLOR_DIFFUSE);
+        pScene->mMaterials[0]->AddProperty(&clrDiffuse, 1, AI_MATKEY_COLOR_SPECULAR);
+    }
+}
+
 // ------------------------------------------------------------------------------------------------
 // Read an ASCII STL file
 void STLImporter::LoadASCIIFile(aiNode *root) {
@@ -283,6 +349,8 @@ void STLImporter::LoadASCIIFile(aiNode *root) {
 
         unsigned int faceVertexCounter = 3;
         for (;;) {
+            ImportLimits::Poll();
+
             // go to the next token
             if (!SkipSpacesAndLineEnd(&sz)) {
                 // seems we're finished although there was no end marker
@@ -391,19 +459,28 @@ void STLImporter::LoadASCIIFile(aiNode *root) {
         // now copy faces
         addFacesToMesh(pMesh);
 
+        // each solid is complete at this point, so it can be streamed
+        if (nullptr != m_meshSink) {
+            meshes.pop_back();
+            SinkMesh(pMesh, m_numSunkMeshes);
+            continue;
+        }
+
         // assign the meshes to the current node
         pushMeshesToNode(meshIndices, node);
     }
 
     // now add the loaded meshes
     mScene->mNumMeshes = (unsigned int)meshes.size();
-    mScene->mMeshes = new aiMesh *[mScene->mNumMeshes];
-    for (size_t i = 0; i < meshes.size(); i++) {
-        mScene->mMeshes[i] = meshes[i];
+    if (mScene->mNumMeshes) {
+        mScene->mMeshes = AllocateSceneArray<aiMesh *>(mScene->mNumMeshes);
+        for (size_t i = 0; i < meshes.size(); i++) {
+            mScene->mMeshes[i] = meshes[i];
+        }
     }
 
     root->mNumChildren = (unsigned int)nodes.size();
-    root->mChildren = new aiNode *[root->mNumChildren];
+    root->mChildren = AllocateSceneArray<aiNode *>(root->mNumChildren);
     for (size_t i = 0; i < nodes.size(); ++i) {
         root->mChildren[i] = nodes[i];
     }
@@ -411,10 +488,10 @@ void STLImporter::LoadASCIIFile(aiNode *root) {
 
 // ------------------------------------------------------------------------------------------------
 // Read a binary STL file
-bool STLImporter::LoadBinaryFile() {
+bool STLImporter::LoadBinaryFile(IOStream *pStream) {
     // allocate one mesh
     mScene->mNumMeshes = 1;
-    mScene->mMeshes = new aiMesh *[1];
+    mScene->mMeshes = AllocateSceneArray<aiMesh *>(1);
     aiMesh *pMesh = mScene->mMeshes[0] = new aiMesh();
     pMesh->mMaterialIndex = 0;
 
@@ -422,27 +499,7 @@ bool STLImporter::LoadBinaryFile() {
     if (mFileSize < 84) {
         throw DeadlyImportError("STL: file is too small for the header");
     }
-    bool bIsMaterialise = false;
-
-    // search for an occurrence of "COLOR=" in the header
-    const unsigned char *sz2 = (const unsigned char *)mBuffer;
-    const unsigned char *const szEnd = sz2 + 80;
-    while (sz2 < szEnd) {
-
-        if ('C' == *sz2++ && 'O' == *sz2++ && 'L' == *sz2++ &&
-                'O' == *sz2++ && 'R' == *sz2++ && '=' == *sz2++) {
-
-            // read the default vertex color for facets
-            bIsMaterialise = true;
-            ASSIMP_LOG_INFO("STL: Taking code path for Materialise files");
-            const ai_real invByte = (ai_real)1.0 / (ai_real)255.0;
-            mClrColorDefault.r = (*sz2++) * invByte;
-            mClrColorDefault.g = (*sz2++) * invByte;
-            mClrColorDefault.b = (*sz2++) * invByte;
-            mClrColorDefault.a = (*sz2++) * invByte;
-            break;
-        }
-    }
+    const bool bIsMaterialise = ReadMaterialiseHeader((const unsigned char *)mBuffer);
     const unsigned char *sz = (const unsigned char *)mBuffer + 80;
 
     // now read the number of facets
@@ -461,6 +518,111 @@ bool STLImporter::LoadBinaryFile() {
 
     pMesh->mNumVertices = pMesh->mNumFaces * 3;
 
+    bool bHasColors = false;
+    if (m_deferMeshData) {
+        // the facets are loaded on demand, see InternReadMeshData()
+        pMesh->mPrimitiveTypes = aiPrimitiveType_TRIANGLE;
+        mScene->mFlags |= AI_SCENE_FLAGS_DEFERRED_MESH_DATA;
+    } else if (nullptr != m_meshSink) {
+        bHasColors = StreamBinaryFacets(pStream, sz, pMesh->mNumFaces, bIsMaterialise);
+
+        // nothing is left for the scene
+        delete pMesh;
+        FreeSceneArray(mScene->mMeshes);
+        mScene->mMeshes = nullptr;
+        mScene->mNumMeshes = 0;
+    } else {
+        LoadBinaryFacets(pMesh, sz, bIsMaterialise);
+        bHasColors = nullptr != pMesh->mColors[0];
+    }
+
+    aiNode *root = mScene->mRootNode;
+
+    // allocate one node
+    aiNode *node = new aiNode();
+    node->mParent = root;
+
+    root->mNumChildren = 1u;
+    root->mChildren = AllocateSceneArray<aiNode *>(root->mNumChildren);
+    root->mChildren[0] = node;
+
+    // add all created meshes to the single node
+    if (mScene->mNumMeshes) {
+        node->mNumMeshes = mScene->mNumMeshes;
+        node->mMeshes = AllocateSceneArray<unsigned int>(mScene->mNumMeshes);
+        for (unsigned int i = 0; i < mScene->mNumMeshes; ++i) {
+            node->mMeshes[i] = i;
+        }
+    }
+
+    if (bIsMaterialise && !bHasColors) {
+        // use the color as diffuse material color
+        return true;
+    }
+    return false;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Search the header of a binary STL file for a Materialise default color
+bool STLImporter::ReadMaterialiseHeader(const unsigned char *sz) {
+    // the default vertex color is light gray.
+    mClrColorDefault.r = mClrColorDefault.g = mClrColorDefault.b = mClrColorDefault.a = (ai_real)0.6;
+
+    // search for an occurrence of "COLOR=" in the header
+    const unsigned char *const szEnd = sz + 80;
+    while (sz < szEnd) {
+
+        if ('C' == *sz++ && 'O' == *sz++ && 'L' == *sz++ &&
+                'O' == *sz++ && 'R' == *sz++ && '=' == *sz++) {
+
+            // read the default vertex color for facets
+            ASSIMP_LOG_INFO("STL: Taking code path for Materialise files");
+            const ai_real invByte = (ai_real)1.0 / (ai_real)255.0;
+            mClrColorDefault.r = (*sz++) * invByte;
+            mClrColorDefault.g = (*sz++) * invByte;
+            mClrColorDefault.b = (*sz++) * invByte;
+            mClrColorDefault.a = (*sz++) * invByte;
+            return true;
+        }
+    }
+    return false;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Hand the facets of a binary STL file to the mesh sink
+bool STLImporter::StreamBinaryFacets(IOStream *pStream, const unsigned char *sz, unsigned int numFaces, bool bIsMaterialise) {
+    const unsigned int facetsPerChunk = std::max(1u, m_meshSinkChunkSize / 3);
+
+    std::vector<unsigned char> chunkBuffer;
+    bool bHasColors = false;
+    for (unsigned int first = 0; first < numFaces; first += facetsPerChunk) {
+        const unsigned int count = std::min(facetsPerChunk, numFaces - first);
+        ImportLimits::CheckDeadline();
+
+        const unsigned char *facets = sz + static_cast<size_t>(first) * 50;
+        if (nullptr != pStream) {
+            chunkBuffer.resize(static_cast<size_t>(count) * 50);
+            if (pStream->Read(chunkBuffer.data(), 50, count) != count) {
+                throw DeadlyImportError("STL: unexpected end of file while reading facets");
+            }
+            facets = chunkBuffer.data();
+        }
+
+        std::unique_ptr<aiMesh> chunk(new aiMesh());
+        chunk->mMaterialIndex = 0;
+        chunk->mNumFaces = count;
+        chunk->mNumVertices = count * 3;
+        LoadBinaryFacets(chunk.get(), facets, bIsMaterialise);
+        bHasColors = bHasColors || nullptr != chunk->mColors[0];
+
+        SinkMesh(chunk.release(), 0);
+    }
+    return bHasColors;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Read the facets of a binary STL file
+void STLImporter::LoadBinaryFacets(aiMesh *pMesh, const unsigned char *sz, bool bIsMaterialise) {
     aiVector3D *vp = pMesh->mVertices = new aiVector3D[pMesh->mNumVertices];
     aiVector3D *vn = pMesh->mNormals = new aiVector3D[pMesh->mNumVertices];
 
@@ -545,29 +707,6 @@ bool STLImporter::LoadBinaryFile() {
 
     // now copy faces
     addFacesToMesh(pMesh);
-
-    aiNode *root = mScene->mRootNode;
-
-    // allocate one node
-    aiNode *node = new aiNode();
-    node->mParent = root;
-
-    root->mNumChildren = 1u;
-    root->mChildren = new aiNode *[root->mNumChildren];
-    root->mChildren[0] = node;
-
-    // add all created meshes to the single node
-    node->mNumMeshes = mScene->mNumMeshes;
-    node->mMeshes = new unsigned int[mScene->mNumMeshes];
-    for (unsigned int i = 0; i < mScene->mNumMeshes; ++i) {
-        node->mMeshes[i] = i;
-    }
-
-    if (bIsMaterialise && !pMesh->mColors[0]) {
-        // use the color as diffuse material color
-        return true;
-    }
-    return false;
 }
 
 void STLImporter::pushMeshesToNode(std::vector<unsigned int> &meshIndices, aiNode *node) {
@@ -577,7 +716,7 @@ void STLImporter::pushMeshesToNode(std::vector<unsigned int> &meshIndices, aiNod
     }
 
     node->mNumMeshes = static_cast<unsigned int>(meshIndices.size());
-    node->mMeshes = new unsigned int[meshIndices.size()];
+    node->mMeshes = AllocateSceneArray<unsigned int>(meshIndices.size());
     for (size_t i = 0; i < meshIndices.size(); ++i) {
         node->mMeshes[i] = meshIndices[i];
     }
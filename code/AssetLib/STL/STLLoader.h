@@ -91,11 +91,44 @@ protected:
     void InternReadFile( const std::string& pFile, aiScene* pScene,
         IOSystem* pIOHandler);
 
+    /**
+     * @brief   Loads the facets of a deferred binary file.
+     * See BaseImporter::InternReadMeshData() for details
+     */
+    void InternReadMeshData(const std::string &pFile, aiScene *pScene,
+        unsigned int pMeshIndex, IOSystem *pIOHandler) override;
+
     /**
      * @brief   Loads a binary .stl file
+     * @param   pStream The file if mBuffer only holds its header, nullptr otherwise
      * @return true if the default vertex color must be used as material color
      */
-    bool LoadBinaryFile();
+    bool LoadBinaryFile(IOStream *pStream);
+
+    /**
+     * @brief   Reads the default color of a Materialise header into mClrColorDefault
+     * @param   sz The 80 byte header of a binary .stl file
+     * @return true if the header is a Materialise one
+     */
+    bool ReadMaterialiseHeader(const unsigned char *sz);
+
+    /**
+     * @brief   Reads the facets of a binary .stl file into a mesh
+     * @param   pMesh The mesh, mNumFaces must be set
+     * @param   sz First facet
+     * @param   bIsMaterialise Whether the header is a Materialise one
+     */
+    void LoadBinaryFacets(aiMesh *pMesh, const unsigned char *sz, bool bIsMaterialise);
+
+    /**
+     * @brief   Hands the facets of a binary .stl file to the mesh sink in chunks
+     * @param   pStream The file to read the facets from, nullptr to take them from sz
+     * @param   sz First facet
+     * @param   numFaces Number of facets
+     * @param   bIsMaterialise Whether the header is a Materialise one
+     * @return true if any facet has a color
+     */
+    bool StreamBinaryFacets(IOStream *pStream, const unsigned char *sz, unsigned int numFaces, bool bIsMaterialise);
 
     /**
      * @brief   Loads a ASCII text .stl file
@@ -196,7 +196,7 @@ void TerragenImporter::InternReadFile(const std::string &pFile,
                 throw DeadlyImportError("TER: Invalid terrain size");
 
             // Allocate the output mesh
-            pScene->mMeshes = new aiMesh *[pScene->mNumMeshes = 1];
+            pScene->mMeshes = AllocateSceneArray<aiMesh *>(pScene->mNumMeshes = 1);
             aiMesh *m = pScene->mMeshes[0] = new aiMesh();
 
             // We return quads
@@ -232,7 +232,7 @@ void TerragenImporter::InternReadFile(const std::string &pFile,
                     }
 
                     // make indices
-                    f->mIndices = new unsigned int[f->mNumIndices = 4];
+                    f->mIndices = AllocateSceneArray<unsigned int>(f->mNumIndices = 4);
                     for (unsigned int i = 0; i < 4; ++i) {
                         f->mIndices[i] = t;
                         t++;
@@ -241,7 +241,7 @@ void TerragenImporter::InternReadFile(const std::string &pFile,
             }
 
             // Add the mesh to the root node
-            root->mMeshes = new unsigned int[root->mNumMeshes = 1];
+            root->mMeshes = AllocateSceneArray<unsigned int>(root->mNumMeshes = 1);
             root->mMeshes[0] = 0;
         }
 
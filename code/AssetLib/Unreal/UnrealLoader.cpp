@@ -425,11 +425,11 @@ void UnrealImporter::InternReadFile(const std::string &pFile,
     }
 
     // allocate meshes and bind them to the node graph
-    pScene->mMeshes = new aiMesh *[pScene->mNumMeshes];
-    pScene->mMaterials = new aiMaterial *[pScene->mNumMaterials = pScene->mNumMeshes];
+    pScene->mMeshes = AllocateSceneArray<aiMesh *>(pScene->mNumMeshes);
+    pScene->mMaterials = AllocateSceneArray<aiMaterial *>(pScene->mNumMaterials = pScene->mNumMeshes);
 
     nd->mNumMeshes = pScene->mNumMeshes;
-    nd->mMeshes = new unsigned int[nd->mNumMeshes];
+    nd->mMeshes = AllocateSceneArray<unsigned int>(nd->mNumMeshes);
     for (unsigned int i = 0; i < pScene->mNumMeshes; ++i) {
         aiMesh *m = pScene->mMeshes[i] = new aiMesh();
         m->mPrimitiveTypes = aiPrimitiveType_TRIANGLE;
@@ -496,7 +496,7 @@ void UnrealImporter::InternReadFile(const std::string &pFile,
 
         aiMesh *mesh = pScene->mMeshes[nt - materials.begin()];
         aiFace &f = mesh->mFaces[mesh->mNumFaces++];
-        f.mIndices = new unsigned int[f.mNumIndices = 3];
+        f.mIndices = AllocateSceneArray<unsigned int>(f.mNumIndices = 3);
 
         for (unsigned int i = 0; i < 3; ++i, mesh->mNumVertices++) {
             f.mIndices[i] = mesh->mNumVertices;
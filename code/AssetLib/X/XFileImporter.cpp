@@ -197,7 +197,7 @@ void XFileImporter::CreateDataRepresentationFromImport( aiScene* pScene, XFile::
         mat->AddProperty( &clr, 1, AI_MATKEY_COLOR_DIFFUSE);
         mat->AddProperty( &specExp, 1, AI_MATKEY_SHININESS);
 
-        pScene->mMaterials = new aiMaterial*[1];
+        pScene->mMaterials = AllocateSceneArray<aiMaterial *>(1);
         pScene->mMaterials[0] = mat;
     }
 }
@@ -223,7 +223,7 @@ aiNode* XFileImporter::CreateNodes( aiScene* pScene, aiNode* pParent, const XFil
     // handle childs
     if( !pNode->mChildren.empty() ) {
         node->mNumChildren = (unsigned int)pNode->mChildren.size();
-        node->mChildren = new aiNode* [node->mNumChildren];
+        node->mChildren = AllocateSceneArray<aiNode *>(node->mNumChildren);
 
         for ( unsigned int a = 0; a < pNode->mChildren.size(); ++a ) {
             node->mChildren[ a ] = CreateNodes( pScene, node, pNode->mChildren[ a ] );
@@ -328,7 +328,7 @@ void XFileImporter::CreateMeshes( aiScene* pScene, aiNode* pNode, const std::vec
                 // create face. either triangle or triangle fan depending on the index count
                 aiFace& df = mesh->mFaces[c]; // destination face
                 df.mNumIndices = (unsigned int)pf.mIndices.size();
-                df.mIndices = new unsigned int[ df.mNumIndices];
+                df.mIndices = AllocateSceneArray<unsigned int>(df.mNumIndices);
 
                 // collect vertex data for indices of this face
                 for( unsigned int d = 0; d < df.mNumIndices; ++d ) {
@@ -414,7 +414,7 @@ void XFileImporter::CreateMeshes( aiScene* pScene, aiNode* pNode, const std::vec
             // store the bones in the mesh
             mesh->mNumBones = (unsigned int)newBones.size();
             if( !newBones.empty()) {
-                mesh->mBones = new aiBone*[mesh->mNumBones];
+                mesh->mBones = AllocateSceneArray<aiBone *>(mesh->mNumBones);
                 std::copy( newBones.begin(), newBones.end(), mesh->mBones);
             }
         }
@@ -422,15 +422,15 @@ void XFileImporter::CreateMeshes( aiScene* pScene, aiNode* pNode, const std::vec
 
     // reallocate scene mesh array to be large enough
     aiMesh** prevArray = pScene->mMeshes;
-    pScene->mMeshes = new aiMesh*[pScene->mNumMeshes + meshes.size()];
+    pScene->mMeshes = AllocateSceneArray<aiMesh *>(pScene->mNumMeshes + meshes.size());
     if( prevArray) {
         memcpy( pScene->mMeshes, prevArray, pScene->mNumMeshes * sizeof( aiMesh*));
-        delete [] prevArray;
+        FreeSceneArray(prevArray);
     }
 
     // allocate mesh index array in the node
     pNode->mNumMeshes = (unsigned int)meshes.size();
-    pNode->mMeshes = new unsigned int[pNode->mNumMeshes];
+    pNode->mMeshes = AllocateSceneArray<unsigned int>(pNode->mNumMeshes);
 
     // store all meshes in the mesh library of the scene and store their indices in the node
     for( unsigned int a = 0; a < meshes.size(); a++) {
@@ -460,7 +460,7 @@ void XFileImporter::CreateAnimations( aiScene* pScene, const XFile::Scene* pData
         nanim->mDuration = 0;
         nanim->mTicksPerSecond = pData->mAnimTicksPerSecond;
         nanim->mNumChannels = (unsigned int)anim->mAnims.size();
-        nanim->mChannels = new aiNodeAnim*[nanim->mNumChannels];
+        nanim->mChannels = AllocateSceneArray<aiNodeAnim *>(nanim->mNumChannels);
 
         for( unsigned int b = 0; b < anim->mAnims.size(); ++b ) {
             const XFile::AnimBone* bone = anim->mAnims[b];
@@ -559,7 +559,7 @@ void XFileImporter::CreateAnimations( aiScene* pScene, const XFile::Scene* pData
     if( newAnims.size() > 0)
     {
         pScene->mNumAnimations = (unsigned int)newAnims.size();
-        pScene->mAnimations = new aiAnimation* [pScene->mNumAnimations];
+        pScene->mAnimations = AllocateSceneArray<aiAnimation *>(pScene->mNumAnimations);
         for( unsigned int a = 0; a < newAnims.size(); a++)
             pScene->mAnimations[a] = newAnims[a];
     }
@@ -580,10 +580,10 @@ void XFileImporter::ConvertMaterials( aiScene* pScene, std::vector<XFile::Materi
     // resize the scene's material list to offer enough space for the new materials
     if( numNewMaterials > 0 ) {
         aiMaterial** prevMats = pScene->mMaterials;
-        pScene->mMaterials = new aiMaterial*[pScene->mNumMaterials + numNewMaterials];
+        pScene->mMaterials = AllocateSceneArray<aiMaterial *>(pScene->mNumMaterials + numNewMaterials);
         if( nullptr != prevMats)  {
             ::memcpy( pScene->mMaterials, prevMats, pScene->mNumMaterials * sizeof( aiMaterial*));
-            delete [] prevMats;
+            FreeSceneArray(prevMats);
         }
     }
 
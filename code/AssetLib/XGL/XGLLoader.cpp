@@ -217,17 +217,17 @@ void XGLImporter::InternReadFile(const std::string &pFile, aiScene *pScene, IOSy
 
 	// copy meshes
 	m_scene->mNumMeshes = static_cast<unsigned int>(meshes.size());
-	m_scene->mMeshes = new aiMesh *[m_scene->mNumMeshes]();
+	m_scene->mMeshes = AllocateSceneArray<aiMesh *>(m_scene->mNumMeshes, nullptr);
 	std::copy(meshes.begin(), meshes.end(), m_scene->mMeshes);
 
 	// copy materials
 	m_scene->mNumMaterials = static_cast<unsigned int>(materials.size());
-	m_scene->mMaterials = new aiMaterial *[m_scene->mNumMaterials]();
+	m_scene->mMaterials = AllocateSceneArray<aiMaterial *>(m_scene->mNumMaterials, nullptr);
 	std::copy(materials.begin(), materials.end(), m_scene->mMaterials);
 
 	if (scope.light) {
 		m_scene->mNumLights = 1;
-		m_scene->mLights = new aiLight *[1];
+		m_scene->mLights = AllocateSceneArray<aiLight *>(1);
 		m_scene->mLights[0] = scope.light;
 
 		scope.light->mName = m_scene->mRootNode->mName;
@@ -362,7 +362,7 @@ aiNode *XGLImporter::ReadObject(XmlNode &node, TempScope &scope, bool skipFirst/
 	// link meshes to node
 	nd->mNumMeshes = static_cast<unsigned int>(meshes.size());
 	if (0 != nd->mNumMeshes) {
-		nd->mMeshes = new unsigned int[nd->mNumMeshes]();
+		nd->mMeshes = AllocateSceneArray<unsigned int>(nd->mNumMeshes, 0);
 		for (unsigned int i = 0; i < nd->mNumMeshes; ++i) {
 			nd->mMeshes[i] = meshes[i];
 		}
@@ -371,7 +371,7 @@ aiNode *XGLImporter::ReadObject(XmlNode &node, TempScope &scope, bool skipFirst/
 	// link children to parent
 	nd->mNumChildren = static_cast<unsigned int>(children.size());
 	if (nd->mNumChildren) {
-		nd->mChildren = new aiNode *[nd->mNumChildren]();
+		nd->mChildren = AllocateSceneArray<aiNode *>(nd->mNumChildren, nullptr);
 		for (unsigned int i = 0; i < nd->mNumChildren; ++i) {
 			nd->mChildren[i] = children[i];
 			children[i]->mParent = nd;
@@ -478,7 +478,7 @@ aiMesh *XGLImporter::ToOutputMesh(const TempMaterialMesh &m) {
 	for (unsigned int i = 0; i < mesh->mNumFaces; ++i) {
 		aiFace &f = mesh->mFaces[i];
 		f.mNumIndices = m.vcounts[i];
-		f.mIndices = new unsigned int[f.mNumIndices];
+		f.mIndices = AllocateSceneArray<unsigned int>(f.mNumIndices);
 		for (unsigned int c = 0; c < f.mNumIndices; ++c) {
 			f.mIndices[c] = idx++;
 		}
@@ -137,7 +137,7 @@ inline void SetMaterialColorProperty(std::vector<int> &embeddedTexIdxs, Asset &
 
 void glTFImporter::ImportMaterials(glTF::Asset &r) {
     mScene->mNumMaterials = unsigned(r.materials.Size());
-    mScene->mMaterials = new aiMaterial *[mScene->mNumMaterials];
+    mScene->mMaterials = AllocateSceneArray<aiMaterial *>(mScene->mNumMaterials);
 
     for (unsigned int i = 0; i < mScene->mNumMaterials; ++i) {
         aiMaterial *aimat = mScene->mMaterials[i] = new aiMaterial();
@@ -168,28 +168,28 @@ void glTFImporter::ImportMaterials(glTF::Asset &r) {
     if (mScene->mNumMaterials == 0) {
         mScene->mNumMaterials = 1;
         // Delete the array of length zero created above.
-        delete[] mScene->mMaterials;
-        mScene->mMaterials = new aiMaterial *[1];
+        FreeSceneArray(mScene->mMaterials);
+        mScene->mMaterials = AllocateSceneArray<aiMaterial *>(1);
         mScene->mMaterials[0] = new aiMaterial();
     }
 }
 
 static inline void SetFace(aiFace &face, int a) {
     face.mNumIndices = 1;
-    face.mIndices = new unsigned int[1];
+    face.mIndices = AllocateSceneArray<unsigned int>(1);
     face.mIndices[0] = a;
 }
 
 static inline void SetFace(aiFace &face, int a, int b) {
     face.mNumIndices = 2;
-    face.mIndices = new unsigned int[2];
+    face.mIndices = AllocateSceneArray<unsigned int>(2);
     face.mIndices[0] = a;
     face.mIndices[1] = b;
 }
 
 static inline void SetFace(aiFace &face, int a, int b, int c) {
     face.mNumIndices = 3;
-    face.mIndices = new unsigned int[3];
+    face.mIndices = AllocateSceneArray<unsigned int>(3);
     face.mIndices[0] = a;
     face.mIndices[1] = b;
     face.mIndices[2] = c;
@@ -473,7 +473,7 @@ void glTFImporter::ImportCameras(glTF::Asset &r) {
     }
 
     mScene->mNumCameras = r.cameras.Size();
-    mScene->mCameras = new aiCamera *[r.cameras.Size()];
+    mScene->mCameras = AllocateSceneArray<aiCamera *>(r.cameras.Size());
     for (size_t i = 0; i < r.cameras.Size(); ++i) {
         Camera &cam = r.cameras[i];
 
@@ -500,7 +500,7 @@ void glTFImporter::ImportLights(glTF::Asset &r) {
     if (!r.lights.Size()) return;
 
     mScene->mNumLights = r.lights.Size();
-    mScene->mLights = new aiLight *[r.lights.Size()];
+    mScene->mLights = AllocateSceneArray<aiLight *>(r.lights.Size());
 
     for (size_t i = 0; i < r.lights.Size(); ++i) {
         Light &l = r.lights[i];
@@ -545,7 +545,7 @@ aiNode *ImportNode(aiScene *pScene, glTF::Asset &r, std::vector<unsigned int> &m
 
     if (!node.children.empty()) {
         ainode->mNumChildren = unsigned(node.children.size());
-        ainode->mChildren = new aiNode *[ainode->mNumChildren];
+        ainode->mChildren = AllocateSceneArray<aiNode *>(ainode->mNumChildren);
 
         for (unsigned int i = 0; i < ainode->mNumChildren; ++i) {
             aiNode *child = ImportNode(pScene, r, meshOffsets, node.children[i]);
@@ -589,7 +589,7 @@ aiNode *ImportNode(aiScene *pScene, glTF::Asset &r, std::vector<unsigned int> &m
         }
 
         ainode->mNumMeshes = count;
-        ainode->mMeshes = new unsigned int[count];
+        ainode->mMeshes = AllocateSceneArray<unsigned int>(count);
 
         int k = 0;
         for (size_t i = 0; i < node.meshes.size(); ++i) {
@@ -622,7 +622,7 @@ void glTFImporter::ImportNodes(glTF::Asset &r) {
         mScene->mRootNode = ImportNode(mScene, r, meshOffsets, rootNodes[0]);
     } else if (numRootNodes > 1) { // more than one root node: create a fake root
         aiNode *root = new aiNode("ROOT");
-        root->mChildren = new aiNode *[numRootNodes];
+        root->mChildren = AllocateSceneArray<aiNode *>(numRootNodes);
         for (unsigned int i = 0; i < numRootNodes; ++i) {
             aiNode *node = ImportNode(mScene, r, meshOffsets, rootNodes[i]);
             node->mParent = root;
@@ -648,7 +648,7 @@ void glTFImporter::ImportEmbeddedTextures(glTF::Asset &r) {
     if (numEmbeddedTexs == 0)
         return;
 
-    mScene->mTextures = new aiTexture *[numEmbeddedTexs];
+    mScene->mTextures = AllocateSceneArray<aiTexture *>(numEmbeddedTexs);
 
     // Add the embedded textures
     for (size_t i = 0; i < r.images.Size(); ++i) {
@@ -661,12 +661,12 @@ void glTFImporter::ImportEmbeddedTextures(glTF::Asset &r) {
         aiTexture *tex = mScene->mTextures[idx] = new aiTexture();
 
         size_t length = img.GetDataLength();
-        void *data = img.StealData();
+        uint8_t *data = img.StealData();
 
         tex->mFilename = img.name;
         tex->mWidth = static_cast<unsigned int>(length);
         tex->mHeight = 0;
-        tex->pcData = reinterpret_cast<aiTexel *>(data);
+        tex->pcData = reinterpret_cast<aiTexel *>(AdoptSceneArray(data, length));
 
         if (!img.mimeType.empty()) {
             const char *ext = strchr(img.mimeType.c_str(), '/') + 1;
@@ -506,7 +506,10 @@ public:
 
 private:
     shared_ptr<uint8_t> mData; //!< Pointer to the data
+    bool mIsMapped; //!< Set to true if mData is the read-only view of a stream, see LoadFromStream()
     bool mIsSpecial; //!< Set to true for special cases (e.g. the body buffer)
+    std::string mDeferredFile; //!< File holding the data if it was not read, see Asset::SetDeferBufferData()
+    size_t mDeferredOffset; //!< Offset of the data in mDeferredFile
 
     /// \var EncodedRegion_List
     /// List of encoded regions.
@@ -522,6 +525,11 @@ public:
 
     bool LoadFromStream(IOStream &stream, size_t length = 0, size_t baseOffset = 0);
 
+    /// Like LoadFromStream(IOStream&, size_t, size_t), but references the data in place if the
+    /// stream offers a contiguous view of its contents. The buffer keeps the stream alive then.
+    /// The view is read-only, it is copied before the data is written, see GetWritablePointer().
+    bool LoadFromStream(const shared_ptr<IOStream> &stream, size_t length = 0, size_t baseOffset = 0);
+
     /// \fn void EncodedRegion_Mark(const size_t pOffset, const size_t pEncodedData_Length, uint8_t* pDecodedData, const size_t pDecodedData_Length, const std::string& pID)
     /// Mark region of "bufferView" as encoded. When data is request from such region then "bufferView" use decoded data.
     /// \param [in] pOffset - offset from begin of "bufferView" to encoded region, in bytes.
@@ -549,12 +557,28 @@ public:
     size_t AppendData(uint8_t *data, size_t length);
     void Grow(size_t amount);
 
+    /// Returns the data for reading. Use GetWritablePointer() to change it.
     uint8_t *GetPointer() { return mData.get(); }
 
+    /// Returns the data for writing, a read-only view of a stream is copied first.
+    uint8_t *GetWritablePointer();
+
     void MarkAsSpecial() { mIsSpecial = true; }
 
     bool IsSpecial() const { return mIsSpecial; }
 
+    /// Records where the data of the buffer is, it is not read then. See Asset::SetDeferBufferData().
+    void MarkAsDeferred(const std::string &file, size_t offset) {
+        mDeferredFile = file;
+        mDeferredOffset = offset;
+    }
+
+    bool IsDeferred() const { return !mDeferredFile.empty(); }
+
+    /// Reads a range of the data of a deferred buffer. The file is opened for each call, the
+    /// buffer keeps nothing.
+    void ReadDeferredData(Asset &r, size_t offset, size_t length, uint8_t *out);
+
     std::string GetURI() { return std::string(this->id) + ".bin"; }
 
     static const char *TranslateId(Asset &r, const char *id);
@@ -600,6 +624,13 @@ struct Accessor : public Object {
     template <class T>
     void ExtractData(T *&outData);
 
+    //! Reads the elements into decodedBuffer if the data of the buffer was deferred,
+    //! only the bytes of the accessor are read.
+    void LoadDeferredData(Asset &r);
+
+    //! Drops the elements read by LoadDeferredData()
+    void ReleaseDeferredData();
+
     void WriteData(size_t count, const void *src_buffer, size_t src_stride);
     void WriteSparseValues(size_t count, const void *src_data, size_t src_dataStride);
     void WriteSparseIndices(size_t count, const void *src_idx, size_t src_idxStride);
@@ -1104,6 +1135,8 @@ private:
     size_t mSceneLength;
     size_t mBodyOffset, mBodyLength;
 
+    bool mDeferBufferData;
+
     std::vector<LazyDictBase *> mDicts;
 
     IdMap mUsedIds;
@@ -1159,6 +1192,7 @@ public:
 public:
     Asset(IOSystem *io = nullptr) :
             mIOSystem(io),
+            mDeferBufferData(false),
             asset(),
             accessors(*this, "accessors"),
             animations(*this, "animations"),
@@ -1189,9 +1223,22 @@ public:
 
     Ref<Buffer> GetBodyBuffer() { return mBodyBuffer; }
 
+    //! Skips reading the binary body and external buffers, must be called before Load().
+    //! Only the accessor headers are usable then. Ignored if the asset needs buffer
+    //! contents to be parsed (skins, animations, embedded images, sparse accessors, Draco).
+    void SetDeferBufferData(bool defer) { mDeferBufferData = defer; }
+
+    //! Whether the buffer contents have not been read
+    bool IsBufferDataDeferred() const { return mDeferBufferData; }
+
+    //! Replaces the IO system, deferred buffer data is read through it
+    void SetIOSystem(IOSystem *io) { mIOSystem = io; }
+
 private:
     void ReadBinaryHeader(IOStream &stream, std::vector<char> &sceneData);
 
+    bool CanDeferBufferData(Document &doc);
+
     void ReadExtensionsUsed(Document &doc);
     void ReadExtensionsRequired(Document &doc);
 
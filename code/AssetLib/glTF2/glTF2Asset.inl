@@ -674,7 +674,9 @@ inline Buffer::Buffer() :
         byteLength(0),
         type(Type_arraybuffer),
         EncodedRegion_Current(nullptr),
-        mIsSpecial(false) {}
+        mIsMapped(false),
+        mIsSpecial(false),
+        mDeferredOffset(0) {}
 
 inline Buffer::~Buffer() {
     for (SEncodedRegion *reg : EncodedRegion_List)
@@ -705,6 +707,7 @@ inline void Buffer::Read(Value &obj, Asset &r) {
             uint8_t *data = nullptr;
             this->byteLength = glTFCommon::Util::DecodeBase64(dataURI.data, dataURI.dataLength, data);
             this->mData.reset(data, std::default_delete<uint8_t[]>());
+            this->mIsMapped = false;
 
             if (statedLength > 0 && this->byteLength != statedLength) {
                 throw DeadlyImportError("GLTF: buffer \"", id, "\", expected ", ai_to_string(statedLength),
@@ -717,16 +720,19 @@ inline void Buffer::Read(Value &obj, Asset &r) {
             }
 
             this->mData.reset(new uint8_t[dataURI.dataLength], std::default_delete<uint8_t[]>());
+            this->mIsMapped = false;
             memcpy(this->mData.get(), dataURI.data, dataURI.dataLength);
         }
     } else { // Local file
-        if (byteLength > 0) {
+        if (byteLength > 0 && r.mDeferBufferData) {
+            std::string dir = !r.mCurrentAssetDir.empty() ? (r.mCurrentAssetDir.back() == '/' ? r.mCurrentAssetDir : r.mCurrentAssetDir + '/') : "";
+            MarkAsDeferred(dir + uri, 0);
+        } else if (byteLength > 0) {
             std::string dir = !r.mCurrentAssetDir.empty() ? (r.mCurrentAssetDir.back() == '/' ? r.mCurrentAssetDir : r.mCurrentAssetDir + '/') : "";
 
-            IOStream *file = r.OpenFile(dir + uri, "rb");
+            shared_ptr<IOStream> file(r.OpenFile(dir + uri, "rb"));
             if (file) {
-                bool ok = LoadFromStream(*file, byteLength);
-                delete file;
+                bool ok = LoadFromStream(file, byteLength);
 
                 if (!ok)
                     throw DeadlyImportError("GLTF: error while reading referenced file \"", uri, "\"");
@@ -745,6 +751,7 @@ inline bool Buffer::LoadFromStream(IOStream &stream, size_t length, size_t baseO
     }
 
     mData.reset(new uint8_t[byteLength], std::default_delete<uint8_t[]>());
+    mIsMapped = false;
 
     if (stream.Read(mData.get(), byteLength, 1) != 1) {
         return false;
@@ -752,6 +759,48 @@ inline bool Buffer::LoadFromStream(IOStream &stream, size_t length, size_t baseO
     return true;
 }
 
+inline bool Buffer::LoadFromStream(const shared_ptr<IOStream> &stream, size_t length, size_t baseOffset) {
+    const uint8_t *view = stream->GetContiguousView();
+    const size_t fileSize = stream->FileSize();
+    const size_t viewLength = length ? length : fileSize;
+    if (nullptr == view || baseOffset > fileSize || viewLength > fileSize - baseOffset) {
+        return LoadFromStream(*stream, length, baseOffset);
+    }
+
+    // share ownership with the stream, so the view stays valid as long as the data is in use
+    byteLength = viewLength;
+    // the view is never written through, GetWritablePointer() and Grow() copy it first
+    mData = shared_ptr<uint8_t>(stream, const_cast<uint8_t *>(view + baseOffset));
+    mIsMapped = true;
+
+    return true;
+}
+
+inline uint8_t *Buffer::GetWritablePointer() {
+    if (mIsMapped) {
+        uint8_t *b = new uint8_t[byteLength];
+        memcpy(b, mData.get(), byteLength);
+        mData.reset(b, std::default_delete<uint8_t[]>());
+        capacity = byteLength;
+        mIsMapped = false;
+    }
+    return mData.get();
+}
+
+inline void Buffer::ReadDeferredData(Asset &r, size_t offset, size_t length, uint8_t *out) {
+    if (offset > byteLength || length > byteLength - offset) {
+        throw DeadlyImportError("GLTF: range ", offset, "/", length, " is out of range of buffer \"", id, "\"");
+    }
+
+    std::unique_ptr<IOStream> file(r.OpenFile(mDeferredFile, "rb", true));
+    if (!file) {
+        throw DeadlyImportError("GLTF: could not open referenced file \"", mDeferredFile, "\"");
+    }
+    if (file->Seek(mDeferredOffset + offset, aiOrigin_SET) != aiReturn_SUCCESS || file->Read(out, length, 1) != 1) {
+        throw DeadlyImportError("GLTF: error while reading referenced file \"", mDeferredFile, "\"");
+    }
+}
+
 inline void Buffer::EncodedRegion_Mark(const size_t pOffset, const size_t pEncodedData_Length, uint8_t *pDecodedData, const size_t pDecodedData_Length, const std::string &pID) {
     // Check pointer to data
     if (pDecodedData == nullptr) throw DeadlyImportError("GLTF: for marking encoded region pointer to decoded data must be provided.");
@@ -813,6 +862,7 @@ inline bool Buffer::ReplaceData(const size_t pBufferData_Offset, const size_t pB
     ::memcpy(&new_data[pBufferData_Offset + pReplace_Count], &mData.get()[pBufferData_Offset + pBufferData_Count], pBufferData_Offset);
     // Apply new data
     mData.reset(new_data, std::default_delete<uint8_t[]>());
+    mIsMapped = false;
     byteLength = new_data_size;
 
     return true;
@@ -833,6 +883,7 @@ inline bool Buffer::ReplaceData_joint(const size_t pBufferData_Offset, const siz
     memcpy(&new_data[pBufferData_Offset + pReplace_Count], &mData.get()[pBufferData_Offset + pBufferData_Count], new_data_size - (pBufferData_Offset + pReplace_Count));
     // Apply new data
     mData.reset(new_data, std::default_delete<uint8_t[]>());
+    mIsMapped = false;
     byteLength = new_data_size;
 
     return true;
@@ -855,7 +906,7 @@ inline void Buffer::Grow(size_t amount) {
     }
 
     // Capacity is big enough
-    if (capacity >= byteLength + amount) {
+    if (!mIsMapped && capacity >= byteLength + amount) {
         byteLength += amount;
         return;
     }
@@ -868,6 +919,7 @@ inline void Buffer::Grow(size_t amount) {
         memcpy(b, mData.get(), byteLength);
     }
     mData.reset(b, std::default_delete<uint8_t[]>());
+    mIsMapped = false;
     byteLength += amount;
 }
 
@@ -1133,8 +1185,39 @@ void Accessor::ExtractData(T *&outData) {
     }
 }
 
+inline void Accessor::LoadDeferredData(Asset &r) {
+    if (decodedBuffer || sparse || !bufferView || !bufferView->buffer || !bufferView->buffer->IsDeferred() || 0 == count) {
+        return;
+    }
+
+    const size_t elemSize = GetElementSize();
+    const size_t stride = bufferView->byteStride ? bufferView->byteStride : elemSize;
+    const size_t offset = bufferView->byteOffset + byteOffset;
+    const size_t span = (count - 1) * stride + elemSize;
+
+    // the decoded buffer is packed, gather the elements if they are interleaved
+    std::unique_ptr<Buffer> data(new Buffer());
+    data->Grow(count * elemSize);
+    if (stride == elemSize) {
+        bufferView->buffer->ReadDeferredData(r, offset, span, data->GetPointer());
+    } else {
+        std::vector<uint8_t> strided(span);
+        bufferView->buffer->ReadDeferredData(r, offset, span, strided.data());
+        for (size_t i = 0; i < count; ++i) {
+            memcpy(data->GetPointer() + i * elemSize, strided.data() + i * stride, elemSize);
+        }
+    }
+    decodedBuffer.swap(data);
+}
+
+inline void Accessor::ReleaseDeferredData() {
+    if (bufferView && bufferView->buffer && bufferView->buffer->IsDeferred()) {
+        decodedBuffer.reset();
+    }
+}
+
 inline void Accessor::WriteData(size_t _count, const void *src_buffer, size_t src_stride) {
-    uint8_t *buffer_ptr = bufferView->buffer->GetPointer();
+    uint8_t *buffer_ptr = bufferView->buffer->GetWritablePointer();
     size_t offset = byteOffset + bufferView->byteOffset;
 
     size_t dst_stride = GetNumComponents() * GetBytesPerComponent();
@@ -1151,7 +1234,7 @@ inline void Accessor::WriteSparseValues(size_t _count, const void *src_data, siz
         return;
 
     // values
-    uint8_t *value_buffer_ptr = sparse->values->buffer->GetPointer();
+    uint8_t *value_buffer_ptr = sparse->values->buffer->GetWritablePointer();
     size_t value_offset = sparse->valuesByteOffset + sparse->values->byteOffset;
     size_t value_dst_stride = GetNumComponents() * GetBytesPerComponent();
     const uint8_t *value_src = reinterpret_cast<const uint8_t *>(src_data);
@@ -1165,7 +1248,7 @@ inline void Accessor::WriteSparseIndices(size_t _count, const void *src_idx, siz
         return;
 
     // indices
-    uint8_t *indices_buffer_ptr = sparse->indices->buffer->GetPointer();
+    uint8_t *indices_buffer_ptr = sparse->indices->buffer->GetWritablePointer();
     size_t indices_offset = sparse->indicesByteOffset + sparse->indices->byteOffset;
     size_t indices_dst_stride = 1 * sizeof(unsigned short);
     const uint8_t *indices_src = reinterpret_cast<const uint8_t *>(src_idx);
@@ -2039,9 +2122,17 @@ inline void Asset::Load(const std::string &pFile, bool isBinary) {
         throw DeadlyImportError("GLTF: JSON document root must be a JSON object");
     }
 
+    if (mDeferBufferData && !CanDeferBufferData(doc)) {
+        ASSIMP_LOG_DEBUG("GLTF2: buffer contents are needed to parse the asset, reading them now");
+        mDeferBufferData = false;
+    }
+
     // Fill the buffer instance for the current file embedded contents
     if (mBodyLength > 0) {
-        if (!mBodyBuffer->LoadFromStream(*stream, mBodyLength, mBodyOffset)) {
+        if (mDeferBufferData) {
+            mBodyBuffer->byteLength = mBodyLength;
+            mBodyBuffer->MarkAsDeferred(pFile, mBodyOffset);
+        } else if (!mBodyBuffer->LoadFromStream(stream, mBodyLength, mBodyOffset)) {
             throw DeadlyImportError("GLTF: Unable to read gltf file");
         }
     }
@@ -2095,6 +2186,39 @@ inline void Asset::Load(const std::string &pFile, bool isBinary) {
     }
 }
 
+inline bool Asset::CanDeferBufferData(Document &doc) {
+    Value *skinsArray = FindArray(doc, "skins");
+    Value *animsArray = FindArray(doc, "animations");
+    if ((skinsArray && !skinsArray->Empty()) || (animsArray && !animsArray->Empty())) {
+        return false;
+    }
+
+    if (Value *extsUsed = FindArray(doc, "extensionsUsed")) {
+        for (unsigned int i = 0; i < extsUsed->Size(); ++i) {
+            if ((*extsUsed)[i].IsString() && 0 == strcmp((*extsUsed)[i].GetString(), "KHR_draco_mesh_compression")) {
+                return false;
+            }
+        }
+    }
+
+    // embedded images and sparse accessors are resolved while parsing
+    if (Value *imagesArray = FindArray(doc, "images")) {
+        for (unsigned int i = 0; i < imagesArray->Size(); ++i) {
+            if ((*imagesArray)[i].IsObject() && (*imagesArray)[i].HasMember("bufferView")) {
+                return false;
+            }
+        }
+    }
+    if (Value *accessorsArray = FindArray(doc, "accessors")) {
+        for (unsigned int i = 0; i < accessorsArray->Size(); ++i) {
+            if ((*accessorsArray)[i].IsObject() && (*accessorsArray)[i].HasMember("sparse")) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
 inline void Asset::SetAsBinary() {
     if (!mBodyBuffer) {
         mBodyBuffer = buffers.Create("binary_glTF");
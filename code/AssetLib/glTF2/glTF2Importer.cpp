@@ -49,6 +49,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #endif
 
 #include <assimp/CreateAnimMesh.h>
+#include <assimp/Profiler.h>
 #include <assimp/StringComparison.h>
 #include <assimp/StringUtils.h>
 #include <assimp/ai_assert.h>
@@ -344,7 +345,7 @@ void glTF2Importer::ImportMaterials(glTF2::Asset &r) {
     Material defaultMaterial;
 
     mScene->mNumMaterials = numImportedMaterials + 1;
-    mScene->mMaterials = new aiMaterial *[mScene->mNumMaterials];
+    mScene->mMaterials = AllocateSceneArray<aiMaterial *>(mScene->mNumMaterials);
     std::fill(mScene->mMaterials, mScene->mMaterials + mScene->mNumMaterials, nullptr);
     mScene->mMaterials[numImportedMaterials] = ImportMaterial(embeddedTexIdxs, r, defaultMaterial);
 
@@ -353,37 +354,46 @@ void glTF2Importer::ImportMaterials(glTF2::Asset &r) {
     }
 }
 
-static inline void SetFaceAndAdvance1(aiFace*& face, unsigned int numVertices, unsigned int a) {
+// Allocates the faces of a mesh together with one block for their indices
+static inline aiFace *AllocateFaces(aiMesh *mesh, size_t numFaces, unsigned int numIndices, unsigned int *&indices) {
+    indices = mesh->AllocateFaces(static_cast<unsigned int>(numFaces), static_cast<unsigned int>(numFaces) * numIndices);
+    return mesh->mFaces;
+}
+
+static inline void SetFaceAndAdvance1(aiFace*& face, unsigned int*& indices, unsigned int numVertices, unsigned int a) {
     if (a >= numVertices) {
         return;
     }
     face->mNumIndices = 1;
-    face->mIndices = new unsigned int[1];
+    face->mIndices = indices;
     face->mIndices[0] = a;
     ++face;
+    indices += 1;
 }
 
-static inline void SetFaceAndAdvance2(aiFace*& face, unsigned int numVertices, unsigned int a, unsigned int b) {
+static inline void SetFaceAndAdvance2(aiFace*& face, unsigned int*& indices, unsigned int numVertices, unsigned int a, unsigned int b) {
     if ((a >= numVertices) || (b >= numVertices)) {
         return;
     }
     face->mNumIndices = 2;
-    face->mIndices = new unsigned int[2];
+    face->mIndices = indices;
     face->mIndices[0] = a;
     face->mIndices[1] = b;
     ++face;
+    indices += 2;
 }
 
-static inline void SetFaceAndAdvance3(aiFace*& face, unsigned int numVertices, unsigned int a, unsigned int b, unsigned int c) {
+static inline void SetFaceAndAdvance3(aiFace*& face, unsigned int*& indices, unsigned int numVertices, unsigned int a, unsigned int b, unsigned int c) {
     if ((a >= numVertices) || (b >= numVertices) || (c >= numVertices)) {
         return;
     }
     face->mNumIndices = 3;
-    face->mIndices = new unsigned int[3];
+    face->mIndices = indices;
     face->mIndices[0] = a;
     face->mIndices[1] = b;
     face->mIndices[2] = c;
     ++face;
+    indices += 3;
 }
 
 #ifdef ASSIMP_BUILD_DEBUG
@@ -416,371 +426,451 @@ aiColor4D* GetVertexColorsForType(glTF2::Ref<glTF2::Accessor> input) {
     return output;
 }
 
-void glTF2Importer::ImportMeshes(glTF2::Asset &r) {
-    ASSIMP_LOG_DEBUG("Importing ", r.meshes.Size(), " meshes");
-    std::vector<std::unique_ptr<aiMesh>> meshes;
+static void SetupMeshHeader(aiMesh *aim, const Mesh &mesh, unsigned int p) {
+    const Mesh::Primitive &prim = mesh.primitives[p];
 
-    unsigned int k = 0;
-    meshOffsets.clear();
+    aim->mName = mesh.name.empty() ? mesh.id : mesh.name;
 
-    for (unsigned int m = 0; m < r.meshes.Size(); ++m) {
-        Mesh &mesh = r.meshes[m];
+    if (mesh.primitives.size() > 1) {
+        ai_uint32 &len = aim->mName.length;
+        aim->mName.data[len] = '-';
+        len += 1 + ASSIMP_itoa10(aim->mName.data + len + 1, unsigned(MAXLEN - len - 1), p);
+    }
 
-        meshOffsets.push_back(k);
-        k += unsigned(mesh.primitives.size());
+    switch (prim.mode) {
+        case PrimitiveMode_POINTS:
+            aim->mPrimitiveTypes |= aiPrimitiveType_POINT;
+            break;
+
+        case PrimitiveMode_LINES:
+        case PrimitiveMode_LINE_LOOP:
+        case PrimitiveMode_LINE_STRIP:
+            aim->mPrimitiveTypes |= aiPrimitiveType_LINE;
+            break;
+
+        case PrimitiveMode_TRIANGLES:
+        case PrimitiveMode_TRIANGLE_STRIP:
+        case PrimitiveMode_TRIANGLE_FAN:
+            aim->mPrimitiveTypes |= aiPrimitiveType_TRIANGLE;
+            break;
+    }
+}
 
-        for (unsigned int p = 0; p < mesh.primitives.size(); ++p) {
-            Mesh::Primitive &prim = mesh.primitives[p];
+void glTF2Importer::ImportPrimitive(glTF2::Mesh &mesh, unsigned int p, aiMesh *aim) {
+    Mesh::Primitive &prim = mesh.primitives[p];
 
-            aiMesh *aim = new aiMesh();
-            meshes.push_back(std::unique_ptr<aiMesh>(aim));
+    SetupMeshHeader(aim, mesh, p);
 
-            aim->mName = mesh.name.empty() ? mesh.id : mesh.name;
+    Mesh::Primitive::Attributes &attr = prim.attributes;
 
-            if (mesh.primitives.size() > 1) {
-                ai_uint32 &len = aim->mName.length;
-                aim->mName.data[len] = '-';
-                len += 1 + ASSIMP_itoa10(aim->mName.data + len + 1, unsigned(MAXLEN - len - 1), p);
-            }
+    if (attr.position.size() > 0 && attr.position[0]) {
+        aim->mNumVertices = static_cast<unsigned int>(attr.position[0]->count);
+        attr.position[0]->ExtractData(aim->mVertices);
+    }
 
-            switch (prim.mode) {
-                case PrimitiveMode_POINTS:
-                    aim->mPrimitiveTypes |= aiPrimitiveType_POINT;
-                    break;
+    if (attr.normal.size() > 0 && attr.normal[0]) {
+        if (attr.normal[0]->count != aim->mNumVertices) {
+            DefaultLogger::get()->warn("Normal count in mesh \"", mesh.name, "\" does not match the vertex count, normals ignored.");
+        } else {
+            attr.normal[0]->ExtractData(aim->mNormals);
 
-                case PrimitiveMode_LINES:
-                case PrimitiveMode_LINE_LOOP:
-                case PrimitiveMode_LINE_STRIP:
-                    aim->mPrimitiveTypes |= aiPrimitiveType_LINE;
-                    break;
+            // only extract tangents if normals are present
+            if (attr.tangent.size() > 0 && attr.tangent[0]) {
+                if (attr.tangent[0]->count != aim->mNumVertices) {
+                    DefaultLogger::get()->warn("Tangent count in mesh \"", mesh.name, "\" does not match the vertex count, tangents ignored.");
+                } else {
+                    // generate bitangents from normals and tangents according to spec
+                    Tangent *tangents = nullptr;
 
-                case PrimitiveMode_TRIANGLES:
-                case PrimitiveMode_TRIANGLE_STRIP:
-                case PrimitiveMode_TRIANGLE_FAN:
-                    aim->mPrimitiveTypes |= aiPrimitiveType_TRIANGLE;
-                    break;
+                    attr.tangent[0]->ExtractData(tangents);
+
+                    aim->mTangents = new aiVector3D[aim->mNumVertices];
+                    aim->mBitangents = new aiVector3D[aim->mNumVertices];
+
+                    for (unsigned int i = 0; i < aim->mNumVertices; ++i) {
+                        aim->mTangents[i] = tangents[i].xyz;
+                        aim->mBitangents[i] = (aim->mNormals[i] ^ tangents[i].xyz) * tangents[i].w;
+                    }
+
+                    delete[] tangents;
+                }
             }
+        }
+    }
 
-            Mesh::Primitive::Attributes &attr = prim.attributes;
+    for (size_t c = 0; c < attr.color.size() && c < AI_MAX_NUMBER_OF_COLOR_SETS; ++c) {
+        if (attr.color[c]->count != aim->mNumVertices) {
+            DefaultLogger::get()->warn("Color stream size in mesh \"", mesh.name,
+                                       "\" does not match the vertex count");
+            continue;
+        }
 
-            if (attr.position.size() > 0 && attr.position[0]) {
-                aim->mNumVertices = static_cast<unsigned int>(attr.position[0]->count);
-                attr.position[0]->ExtractData(aim->mVertices);
+        auto componentType = attr.color[c]->componentType;
+        if (componentType == glTF2::ComponentType_FLOAT) {
+            attr.color[c]->ExtractData(aim->mColors[c]);
+        } else {
+            if (componentType == glTF2::ComponentType_UNSIGNED_BYTE) {
+                aim->mColors[c] = GetVertexColorsForType<unsigned char>(attr.color[c]);
+            } else if (componentType == glTF2::ComponentType_UNSIGNED_SHORT) {
+                aim->mColors[c] = GetVertexColorsForType<unsigned short>(attr.color[c]);
             }
+        }
+    }
+    for (size_t tc = 0; tc < attr.texcoord.size() && tc < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++tc) {
+        if (!attr.texcoord[tc]) {
+            DefaultLogger::get()->warn("Texture coordinate accessor not found or non-contiguous texture coordinate sets.");
+            continue;
+        }
 
-            if (attr.normal.size() > 0 && attr.normal[0]) {
-                if (attr.normal[0]->count != aim->mNumVertices) {
-                    DefaultLogger::get()->warn("Normal count in mesh \"", mesh.name, "\" does not match the vertex count, normals ignored.");
-                } else {
-                    attr.normal[0]->ExtractData(aim->mNormals);
+        if (attr.texcoord[tc]->count != aim->mNumVertices) {
+            DefaultLogger::get()->warn("Texcoord stream size in mesh \"", mesh.name,
+                                       "\" does not match the vertex count");
+            continue;
+        }
 
-                    // only extract tangents if normals are present
-                    if (attr.tangent.size() > 0 && attr.tangent[0]) {
-                        if (attr.tangent[0]->count != aim->mNumVertices) {
-                            DefaultLogger::get()->warn("Tangent count in mesh \"", mesh.name, "\" does not match the vertex count, tangents ignored.");
-                        } else {
-                            // generate bitangents from normals and tangents according to spec
-                            Tangent *tangents = nullptr;
+        attr.texcoord[tc]->ExtractData(aim->mTextureCoords[tc]);
+        aim->mNumUVComponents[tc] = attr.texcoord[tc]->GetNumComponents();
 
-                            attr.tangent[0]->ExtractData(tangents);
+        aiVector3D *values = aim->mTextureCoords[tc];
+        for (unsigned int i = 0; i < aim->mNumVertices; ++i) {
+            values[i].y = 1 - values[i].y; // Flip Y coords
+        }
+    }
 
-                            aim->mTangents = new aiVector3D[aim->mNumVertices];
-                            aim->mBitangents = new aiVector3D[aim->mNumVertices];
+    std::vector<Mesh::Primitive::Target> &targets = prim.targets;
+    if (targets.size() > 0) {
+        aim->mNumAnimMeshes = (unsigned int)targets.size();
+        aim->mAnimMeshes = AllocateSceneArray<aiAnimMesh *>(aim->mNumAnimMeshes);
+        std::fill(aim->mAnimMeshes, aim->mAnimMeshes + aim->mNumAnimMeshes, nullptr);
+        for (size_t i = 0; i < targets.size(); i++) {
+            bool needPositions = targets[i].position.size() > 0;
+            bool needNormals = (targets[i].normal.size() > 0) && aim->HasNormals();
+            bool needTangents = (targets[i].tangent.size() > 0) && aim->HasTangentsAndBitangents();
+            // GLTF morph does not support colors and texCoords
+            aim->mAnimMeshes[i] = aiCreateAnimMesh(aim,
+                    needPositions, needNormals, needTangents, false, false);
+            aiAnimMesh &aiAnimMesh = *(aim->mAnimMeshes[i]);
+            Mesh::Primitive::Target &target = targets[i];
+
+            if (needPositions) {
+                if (target.position[0]->count != aim->mNumVertices) {
+                    ASSIMP_LOG_WARN("Positions of target ", i, " in mesh \"", mesh.name, "\" does not match the vertex count");
+                } else {
+                    aiVector3D *positionDiff = nullptr;
+                    target.position[0]->ExtractData(positionDiff);
+                    for (unsigned int vertexId = 0; vertexId < aim->mNumVertices; vertexId++) {
+                        aiAnimMesh.mVertices[vertexId] += positionDiff[vertexId];
+                    }
+                    delete[] positionDiff;
+                }
+            }
+            if (needNormals) {
+                if (target.normal[0]->count != aim->mNumVertices) {
+                    ASSIMP_LOG_WARN("Normals of target ", i, " in mesh \"", mesh.name, "\" does not match the vertex count");
+                } else {
+                    aiVector3D *normalDiff = nullptr;
+                    target.normal[0]->ExtractData(normalDiff);
+                    for (unsigned int vertexId = 0; vertexId < aim->mNumVertices; vertexId++) {
+                        aiAnimMesh.mNormals[vertexId] += normalDiff[vertexId];
+                    }
+                    delete[] normalDiff;
+                }
+            }
+            if (needTangents) {
+                if (target.tangent[0]->count != aim->mNumVertices) {
+                    ASSIMP_LOG_WARN("Tangents of target ", i, " in mesh \"", mesh.name, "\" does not match the vertex count");
+                } else {
+                    Tangent *tangent = nullptr;
+                    attr.tangent[0]->ExtractData(tangent);
 
-                            for (unsigned int i = 0; i < aim->mNumVertices; ++i) {
-                                aim->mTangents[i] = tangents[i].xyz;
-                                aim->mBitangents[i] = (aim->mNormals[i] ^ tangents[i].xyz) * tangents[i].w;
-                            }
+                    aiVector3D *tangentDiff = nullptr;
+                    target.tangent[0]->ExtractData(tangentDiff);
 
-                            delete[] tangents;
-                        }
+                    for (unsigned int vertexId = 0; vertexId < aim->mNumVertices; ++vertexId) {
+                        tangent[vertexId].xyz += tangentDiff[vertexId];
+                        aiAnimMesh.mTangents[vertexId] = tangent[vertexId].xyz;
+                        aiAnimMesh.mBitangents[vertexId] = (aiAnimMesh.mNormals[vertexId] ^ tangent[vertexId].xyz) * tangent[vertexId].w;
                     }
+                    delete[] tangent;
+                    delete[] tangentDiff;
+                }
+            }
+            if (mesh.weights.size() > i) {
+                aiAnimMesh.mWeight = mesh.weights[i];
+            }
+            if (mesh.targetNames.size() > i) {
+                aiAnimMesh.mName = mesh.targetNames[i];
+            }
+        }
+    }
+
+    aiFace *faces = nullptr;
+    aiFace *facePtr = nullptr;
+    unsigned int *indices = nullptr;
+    size_t nFaces = 0;
+
+    if (prim.indices) {
+        size_t count = prim.indices->count;
+
+        Accessor::Indexer data = prim.indices->GetIndexer();
+        if (!data.IsValid()) {
+            throw DeadlyImportError("GLTF: Invalid accessor without data in mesh ", getContextForErrorMessages(mesh.id, mesh.name));
+        }
+
+        switch (prim.mode) {
+            case PrimitiveMode_POINTS: {
+                nFaces = count;
+                facePtr = faces = AllocateFaces(aim, nFaces, 1, indices);
+                for (unsigned int i = 0; i < count; ++i) {
+                    SetFaceAndAdvance1(facePtr, indices, aim->mNumVertices, data.GetUInt(i));
                 }
+                break;
             }
 
-            for (size_t c = 0; c < attr.color.size() && c < AI_MAX_NUMBER_OF_COLOR_SETS; ++c) {
-                if (attr.color[c]->count != aim->mNumVertices) {
-                    DefaultLogger::get()->warn("Color stream size in mesh \"", mesh.name,
-                                               "\" does not match the vertex count");
-                    continue;
+            case PrimitiveMode_LINES: {
+                nFaces = count / 2;
+                if (nFaces * 2 != count) {
+                    ASSIMP_LOG_WARN("The number of vertices was not compatible with the LINES mode. Some vertices were dropped.");
+                    count = nFaces * 2;
                 }
+                facePtr = faces = AllocateFaces(aim, nFaces, 2, indices);
+                for (unsigned int i = 0; i < count; i += 2) {
+                    SetFaceAndAdvance2(facePtr, indices, aim->mNumVertices, data.GetUInt(i), data.GetUInt(i + 1));
+                }
+                break;
+            }
 
-                auto componentType = attr.color[c]->componentType;
-                if (componentType == glTF2::ComponentType_FLOAT) {
-                    attr.color[c]->ExtractData(aim->mColors[c]);
-                } else {
-                    if (componentType == glTF2::ComponentType_UNSIGNED_BYTE) {
-                        aim->mColors[c] = GetVertexColorsForType<unsigned char>(attr.color[c]);
-                    } else if (componentType == glTF2::ComponentType_UNSIGNED_SHORT) {
-                        aim->mColors[c] = GetVertexColorsForType<unsigned short>(attr.color[c]);
+            case PrimitiveMode_LINE_LOOP:
+            case PrimitiveMode_LINE_STRIP: {
+                nFaces = count - ((prim.mode == PrimitiveMode_LINE_STRIP) ? 1 : 0);
+                facePtr = faces = AllocateFaces(aim, nFaces, 2, indices);
+                SetFaceAndAdvance2(facePtr, indices, aim->mNumVertices, data.GetUInt(0), data.GetUInt(1));
+                for (unsigned int i = 2; i < count; ++i) {
+                    SetFaceAndAdvance2(facePtr, indices, aim->mNumVertices, data.GetUInt(i - 1), data.GetUInt(i));
+                }
+                if (prim.mode == PrimitiveMode_LINE_LOOP) { // close the loop
+                    SetFaceAndAdvance2(facePtr, indices, aim->mNumVertices, data.GetUInt(static_cast<int>(count) - 1), faces[0].mIndices[0]);
+                }
+                break;
+            }
+
+            case PrimitiveMode_TRIANGLES: {
+                nFaces = count / 3;
+                if (nFaces * 3 != count) {
+                    ASSIMP_LOG_WARN("The number of vertices was not compatible with the TRIANGLES mode. Some vertices were dropped.");
+                    count = nFaces * 3;
+                }
+                facePtr = faces = AllocateFaces(aim, nFaces, 3, indices);
+                for (unsigned int i = 0; i < count; i += 3) {
+                    SetFaceAndAdvance3(facePtr, indices, aim->mNumVertices, data.GetUInt(i), data.GetUInt(i + 1), data.GetUInt(i + 2));
+                }
+                break;
+            }
+            case PrimitiveMode_TRIANGLE_STRIP: {
+                nFaces = count - 2;
+                facePtr = faces = AllocateFaces(aim, nFaces, 3, indices);
+                for (unsigned int i = 0; i < nFaces; ++i) {
+                    //The ordering is to ensure that the triangles are all drawn with the same orientation
+                    if ((i + 1) % 2 == 0) {
+                        //For even n, vertices n + 1, n, and n + 2 define triangle n
+                        SetFaceAndAdvance3(facePtr, indices, aim->mNumVertices, data.GetUInt(i + 1), data.GetUInt(i), data.GetUInt(i + 2));
+                    } else {
+                        //For odd n, vertices n, n+1, and n+2 define triangle n
+                        SetFaceAndAdvance3(facePtr, indices, aim->mNumVertices, data.GetUInt(i), data.GetUInt(i + 1), data.GetUInt(i + 2));
                     }
                 }
+                break;
             }
-            for (size_t tc = 0; tc < attr.texcoord.size() && tc < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++tc) {
-                if (!attr.texcoord[tc]) {
-                    DefaultLogger::get()->warn("Texture coordinate accessor not found or non-contiguous texture coordinate sets.");
-                    continue;
+            case PrimitiveMode_TRIANGLE_FAN:
+                nFaces = count - 2;
+                facePtr = faces = AllocateFaces(aim, nFaces, 3, indices);
+                SetFaceAndAdvance3(facePtr, indices, aim->mNumVertices, data.GetUInt(0), data.GetUInt(1), data.GetUInt(2));
+                for (unsigned int i = 1; i < nFaces; ++i) {
+                    SetFaceAndAdvance3(facePtr, indices, aim->mNumVertices, data.GetUInt(0), data.GetUInt(i + 1), data.GetUInt(i + 2));
                 }
+                break;
+        }
+    } else { // no indices provided so directly generate from counts
+
+        // use the already determined count as it includes checks
+        unsigned int count = aim->mNumVertices;
 
-                if (attr.texcoord[tc]->count != aim->mNumVertices) {
-                    DefaultLogger::get()->warn("Texcoord stream size in mesh \"", mesh.name,
-                                               "\" does not match the vertex count");
-                    continue;
+        switch (prim.mode) {
+            case PrimitiveMode_POINTS: {
+                nFaces = count;
+                facePtr = faces = AllocateFaces(aim, nFaces, 1, indices);
+                for (unsigned int i = 0; i < count; ++i) {
+                    SetFaceAndAdvance1(facePtr, indices, aim->mNumVertices, i);
                 }
+                break;
+            }
 
-                attr.texcoord[tc]->ExtractData(aim->mTextureCoords[tc]);
-                aim->mNumUVComponents[tc] = attr.texcoord[tc]->GetNumComponents();
+            case PrimitiveMode_LINES: {
+                nFaces = count / 2;
+                if (nFaces * 2 != count) {
+                    ASSIMP_LOG_WARN("The number of vertices was not compatible with the LINES mode. Some vertices were dropped.");
+                    count = (unsigned int)nFaces * 2;
+                }
+                facePtr = faces = AllocateFaces(aim, nFaces, 2, indices);
+                for (unsigned int i = 0; i < count; i += 2) {
+                    SetFaceAndAdvance2(facePtr, indices, aim->mNumVertices, i, i + 1);
+                }
+                break;
+            }
 
-                aiVector3D *values = aim->mTextureCoords[tc];
-                for (unsigned int i = 0; i < aim->mNumVertices; ++i) {
-                    values[i].y = 1 - values[i].y; // Flip Y coords
+            case PrimitiveMode_LINE_LOOP:
+            case PrimitiveMode_LINE_STRIP: {
+                nFaces = count - ((prim.mode == PrimitiveMode_LINE_STRIP) ? 1 : 0);
+                facePtr = faces = AllocateFaces(aim, nFaces, 2, indices);
+                SetFaceAndAdvance2(facePtr, indices, aim->mNumVertices, 0, 1);
+                for (unsigned int i = 2; i < count; ++i) {
+                    SetFaceAndAdvance2(facePtr, indices, aim->mNumVertices, i - 1, i);
                 }
+                if (prim.mode == PrimitiveMode_LINE_LOOP) { // close the loop
+                    SetFaceAndAdvance2(facePtr, indices, aim->mNumVertices, count - 1, 0);
+                }
+                break;
             }
 
-            std::vector<Mesh::Primitive::Target> &targets = prim.targets;
-            if (targets.size() > 0) {
-                aim->mNumAnimMeshes = (unsigned int)targets.size();
-                aim->mAnimMeshes = new aiAnimMesh *[aim->mNumAnimMeshes];
-                std::fill(aim->mAnimMeshes, aim->mAnimMeshes + aim->mNumAnimMeshes, nullptr);
-                for (size_t i = 0; i < targets.size(); i++) {
-                    bool needPositions = targets[i].position.size() > 0;
-                    bool needNormals = (targets[i].normal.size() > 0) && aim->HasNormals();
-                    bool needTangents = (targets[i].tangent.size() > 0) && aim->HasTangentsAndBitangents();
-                    // GLTF morph does not support colors and texCoords
-                    aim->mAnimMeshes[i] = aiCreateAnimMesh(aim,
-                            needPositions, needNormals, needTangents, false, false);
-                    aiAnimMesh &aiAnimMesh = *(aim->mAnimMeshes[i]);
-                    Mesh::Primitive::Target &target = targets[i];
-
-                    if (needPositions) {
-                        if (target.position[0]->count != aim->mNumVertices) {
-                            ASSIMP_LOG_WARN("Positions of target ", i, " in mesh \"", mesh.name, "\" does not match the vertex count");
-                        } else {
-                            aiVector3D *positionDiff = nullptr;
-                            target.position[0]->ExtractData(positionDiff);
-                            for (unsigned int vertexId = 0; vertexId < aim->mNumVertices; vertexId++) {
-                                aiAnimMesh.mVertices[vertexId] += positionDiff[vertexId];
-                            }
-                            delete[] positionDiff;
-                        }
-                    }
-                    if (needNormals) {
-                        if (target.normal[0]->count != aim->mNumVertices) {
-                            ASSIMP_LOG_WARN("Normals of target ", i, " in mesh \"", mesh.name, "\" does not match the vertex count");
-                        } else {
-                            aiVector3D *normalDiff = nullptr;
-                            target.normal[0]->ExtractData(normalDiff);
-                            for (unsigned int vertexId = 0; vertexId < aim->mNumVertices; vertexId++) {
-                                aiAnimMesh.mNormals[vertexId] += normalDiff[vertexId];
-                            }
-                            delete[] normalDiff;
-                        }
-                    }
-                    if (needTangents) {
-                        if (target.tangent[0]->count != aim->mNumVertices) {
-                            ASSIMP_LOG_WARN("Tangents of target ", i, " in mesh \"", mesh.name, "\" does not match the vertex count");
-                        } else {
-                            Tangent *tangent = nullptr;
-                            attr.tangent[0]->ExtractData(tangent);
-
-                            aiVector3D *tangentDiff = nullptr;
-                            target.tangent[0]->ExtractData(tangentDiff);
-
-                            for (unsigned int vertexId = 0; vertexId < aim->mNumVertices; ++vertexId) {
-                                tangent[vertexId].xyz += tangentDiff[vertexId];
-                                aiAnimMesh.mTangents[vertexId] = tangent[vertexId].xyz;
-                                aiAnimMesh.mBitangents[vertexId] = (aiAnimMesh.mNormals[vertexId] ^ tangent[vertexId].xyz) * tangent[vertexId].w;
-                            }
-                            delete[] tangent;
-                            delete[] tangentDiff;
-                        }
-                    }
-                    if (mesh.weights.size() > i) {
-                        aiAnimMesh.mWeight = mesh.weights[i];
-                    }
-                    if (mesh.targetNames.size() > i) {
-                        aiAnimMesh.mName = mesh.targetNames[i];
+            case PrimitiveMode_TRIANGLES: {
+                nFaces = count / 3;
+                if (nFaces * 3 != count) {
+                    ASSIMP_LOG_WARN("The number of vertices was not compatible with the TRIANGLES mode. Some vertices were dropped.");
+                    count = (unsigned int)nFaces * 3;
+                }
+                facePtr = faces = AllocateFaces(aim, nFaces, 3, indices);
+                for (unsigned int i = 0; i < count; i += 3) {
+                    SetFaceAndAdvance3(facePtr, indices, aim->mNumVertices, i, i + 1, i + 2);
+                }
+                break;
+            }
+            case PrimitiveMode_TRIANGLE_STRIP: {
+                nFaces = count - 2;
+                facePtr = faces = AllocateFaces(aim, nFaces, 3, indices);
+                for (unsigned int i = 0; i < nFaces; ++i) {
+                    //The ordering is to ensure that the triangles are all drawn with the same orientation
+                    if ((i + 1) % 2 == 0) {
+                        //For even n, vertices n + 1, n, and n + 2 define triangle n
+                        SetFaceAndAdvance3(facePtr, indices, aim->mNumVertices, i + 1, i, i + 2);
+                    } else {
+                        //For odd n, vertices n, n+1, and n+2 define triangle n
+                        SetFaceAndAdvance3(facePtr, indices, aim->mNumVertices, i, i + 1, i + 2);
                     }
                 }
+                break;
             }
+            case PrimitiveMode_TRIANGLE_FAN:
+                nFaces = count - 2;
+                facePtr = faces = AllocateFaces(aim, nFaces, 3, indices);
+                SetFaceAndAdvance3(facePtr, indices, aim->mNumVertices, 0, 1, 2);
+                for (unsigned int i = 1; i < nFaces; ++i) {
+                    SetFaceAndAdvance3(facePtr, indices, aim->mNumVertices, 0, i + 1, i + 2);
+                }
+                break;
+        }
+    }
 
-            aiFace *faces = nullptr;
-            aiFace *facePtr = nullptr;
-            size_t nFaces = 0;
+    if (faces || nFaces) {
+        const unsigned int actualNumFaces = static_cast<unsigned int>(facePtr - faces);
+        if (actualNumFaces < nFaces) {
+            ASSIMP_LOG_WARN("Some faces had out-of-range indices. Those faces were dropped.");
+        }
+        if (actualNumFaces == 0)
+        {
+            throw DeadlyImportError("Mesh \"", aim->mName.C_Str(), "\" has no faces");
+        }
+        aim->mNumFaces = actualNumFaces;
+        ai_assert(CheckValidFacesIndices(faces, actualNumFaces, aim->mNumVertices));
+    }
 
-            if (prim.indices) {
-                size_t count = prim.indices->count;
+    if (prim.material) {
+        aim->mMaterialIndex = prim.material.GetIndex();
+    } else {
+        aim->mMaterialIndex = mScene->mNumMaterials - 1;
+    }
+}
 
-                Accessor::Indexer data = prim.indices->GetIndexer();
-                if (!data.IsValid()) {
-                    throw DeadlyImportError("GLTF: Invalid accessor without data in mesh ", getContextForErrorMessages(mesh.id, mesh.name));
-                }
+void glTF2Importer::ImportMeshes(glTF2::Asset &r) {
+    ASSIMP_LOG_DEBUG("Importing ", r.meshes.Size(), " meshes");
+    std::vector<std::unique_ptr<aiMesh>> meshes;
 
-                switch (prim.mode) {
-                    case PrimitiveMode_POINTS: {
-                        nFaces = count;
-                        facePtr = faces = new aiFace[nFaces];
-                        for (unsigned int i = 0; i < count; ++i) {
-                            SetFaceAndAdvance1(facePtr, aim->mNumVertices, data.GetUInt(i));
-                        }
-                        break;
-                    }
+    unsigned int k = 0;
+    meshOffsets.clear();
 
-                    case PrimitiveMode_LINES: {
-                        nFaces = count / 2;
-                        if (nFaces * 2 != count) {
-                            ASSIMP_LOG_WARN("The number of vertices was not compatible with the LINES mode. Some vertices were dropped.");
-                            count = nFaces * 2;
-                        }
-                        facePtr = faces = new aiFace[nFaces];
-                        for (unsigned int i = 0; i < count; i += 2) {
-                            SetFaceAndAdvance2(facePtr, aim->mNumVertices, data.GetUInt(i), data.GetUInt(i + 1));
-                        }
-                        break;
-                    }
+    for (unsigned int m = 0; m < r.meshes.Size(); ++m) {
+        Mesh &mesh = r.meshes[m];
 
-                    case PrimitiveMode_LINE_LOOP:
-                    case PrimitiveMode_LINE_STRIP: {
-                        nFaces = count - ((prim.mode == PrimitiveMode_LINE_STRIP) ? 1 : 0);
-                        facePtr = faces = new aiFace[nFaces];
-                        SetFaceAndAdvance2(facePtr, aim->mNumVertices, data.GetUInt(0), data.GetUInt(1));
-                        for (unsigned int i = 2; i < count; ++i) {
-                            SetFaceAndAdvance2(facePtr, aim->mNumVertices, data.GetUInt(i - 1), data.GetUInt(i));
-                        }
-                        if (prim.mode == PrimitiveMode_LINE_LOOP) { // close the loop
-                            SetFaceAndAdvance2(facePtr, aim->mNumVertices, data.GetUInt(static_cast<int>(count) - 1), faces[0].mIndices[0]);
-                        }
-                        break;
-                    }
+        meshOffsets.push_back(k);
+        k += unsigned(mesh.primitives.size());
 
-                    case PrimitiveMode_TRIANGLES: {
-                        nFaces = count / 3;
-                        if (nFaces * 3 != count) {
-                            ASSIMP_LOG_WARN("The number of vertices was not compatible with the TRIANGLES mode. Some vertices were dropped.");
-                            count = nFaces * 3;
-                        }
-                        facePtr = faces = new aiFace[nFaces];
-                        for (unsigned int i = 0; i < count; i += 3) {
-                            SetFaceAndAdvance3(facePtr, aim->mNumVertices, data.GetUInt(i), data.GetUInt(i + 1), data.GetUInt(i + 2));
-                        }
-                        break;
-                    }
-                    case PrimitiveMode_TRIANGLE_STRIP: {
-                        nFaces = count - 2;
-                        facePtr = faces = new aiFace[nFaces];
-                        for (unsigned int i = 0; i < nFaces; ++i) {
-                            //The ordering is to ensure that the triangles are all drawn with the same orientation
-                            if ((i + 1) % 2 == 0) {
-                                //For even n, vertices n + 1, n, and n + 2 define triangle n
-                                SetFaceAndAdvance3(facePtr, aim->mNumVertices, data.GetUInt(i + 1), data.GetUInt(i), data.GetUInt(i + 2));
-                            } else {
-                                //For odd n, vertices n, n+1, and n+2 define triangle n
-                                SetFaceAndAdvance3(facePtr, aim->mNumVertices, data.GetUInt(i), data.GetUInt(i + 1), data.GetUInt(i + 2));
-                            }
-                        }
-                        break;
-                    }
-                    case PrimitiveMode_TRIANGLE_FAN:
-                        nFaces = count - 2;
-                        facePtr = faces = new aiFace[nFaces];
-                        SetFaceAndAdvance3(facePtr, aim->mNumVertices, data.GetUInt(0), data.GetUInt(1), data.GetUInt(2));
-                        for (unsigned int i = 1; i < nFaces; ++i) {
-                            SetFaceAndAdvance3(facePtr, aim->mNumVertices, data.GetUInt(0), data.GetUInt(i + 1), data.GetUInt(i + 2));
-                        }
-                        break;
-                }
-            } else { // no indices provided so directly generate from counts
+        for (unsigned int p = 0; p < mesh.primitives.size(); ++p) {
+            aiMesh *aim = new aiMesh();
+            meshes.push_back(std::unique_ptr<aiMesh>(aim));
 
-                // use the already determined count as it includes checks
-                unsigned int count = aim->mNumVertices;
+            ImportPrimitive(mesh, p, aim);
+        }
+    }
 
-                switch (prim.mode) {
-                    case PrimitiveMode_POINTS: {
-                        nFaces = count;
-                        facePtr = faces = new aiFace[nFaces];
-                        for (unsigned int i = 0; i < count; ++i) {
-                            SetFaceAndAdvance1(facePtr, aim->mNumVertices, i);
-                        }
-                        break;
-                    }
+    meshOffsets.push_back(k);
 
-                    case PrimitiveMode_LINES: {
-                        nFaces = count / 2;
-                        if (nFaces * 2 != count) {
-                            ASSIMP_LOG_WARN("The number of vertices was not compatible with the LINES mode. Some vertices were dropped.");
-                            count = (unsigned int)nFaces * 2;
-                        }
-                        facePtr = faces = new aiFace[nFaces];
-                        for (unsigned int i = 0; i < count; i += 2) {
-                            SetFaceAndAdvance2(facePtr, aim->mNumVertices, i, i + 1);
-                        }
-                        break;
-                    }
+    CopyVector(meshes, mScene->mMeshes, mScene->mNumMeshes);
+}
 
-                    case PrimitiveMode_LINE_LOOP:
-                    case PrimitiveMode_LINE_STRIP: {
-                        nFaces = count - ((prim.mode == PrimitiveMode_LINE_STRIP) ? 1 : 0);
-                        facePtr = faces = new aiFace[nFaces];
-                        SetFaceAndAdvance2(facePtr, aim->mNumVertices, 0, 1);
-                        for (unsigned int i = 2; i < count; ++i) {
-                            SetFaceAndAdvance2(facePtr, aim->mNumVertices, i - 1, i);
-                        }
-                        if (prim.mode == PrimitiveMode_LINE_LOOP) { // close the loop
-                            SetFaceAndAdvance2(facePtr, aim->mNumVertices, count - 1, 0);
-                        }
-                        break;
-                    }
+void glTF2Importer::ImportMeshHeaders(glTF2::Asset &r) {
+    ASSIMP_LOG_DEBUG("Importing ", r.meshes.Size(), " mesh headers");
+    std::vector<std::unique_ptr<aiMesh>> meshes;
 
-                    case PrimitiveMode_TRIANGLES: {
-                        nFaces = count / 3;
-                        if (nFaces * 3 != count) {
-                            ASSIMP_LOG_WARN("The number of vertices was not compatible with the TRIANGLES mode. Some vertices were dropped.");
-                            count = (unsigned int)nFaces * 3;
-                        }
-                        facePtr = faces = new aiFace[nFaces];
-                        for (unsigned int i = 0; i < count; i += 3) {
-                            SetFaceAndAdvance3(facePtr, aim->mNumVertices, i, i + 1, i + 2);
-                        }
-                        break;
-                    }
-                    case PrimitiveMode_TRIANGLE_STRIP: {
-                        nFaces = count - 2;
-                        facePtr = faces = new aiFace[nFaces];
-                        for (unsigned int i = 0; i < nFaces; ++i) {
-                            //The ordering is to ensure that the triangles are all drawn with the same orientation
-                            if ((i + 1) % 2 == 0) {
-                                //For even n, vertices n + 1, n, and n + 2 define triangle n
-                                SetFaceAndAdvance3(facePtr, aim->mNumVertices, i + 1, i, i + 2);
-                            } else {
-                                //For odd n, vertices n, n+1, and n+2 define triangle n
-                                SetFaceAndAdvance3(facePtr, aim->mNumVertices, i, i + 1, i + 2);
-                            }
-                        }
-                        break;
-                    }
-                    case PrimitiveMode_TRIANGLE_FAN:
-                        nFaces = count - 2;
-                        facePtr = faces = new aiFace[nFaces];
-                        SetFaceAndAdvance3(facePtr, aim->mNumVertices, 0, 1, 2);
-                        for (unsigned int i = 1; i < nFaces; ++i) {
-                            SetFaceAndAdvance3(facePtr, aim->mNumVertices, 0, i + 1, i + 2);
-                        }
-                        break;
-                }
+    unsigned int k = 0;
+    meshOffsets.clear();
+
+    for (unsigned int m = 0; m < r.meshes.Size(); ++m) {
+        Mesh &mesh = r.meshes[m];
+
+        meshOffsets.push_back(k);
+        k += unsigned(mesh.primitives.size());
+
+        for (unsigned int p = 0; p < mesh.primitives.size(); ++p) {
+            Mesh::Primitive &prim = mesh.primitives[p];
+
+            aiMesh *aim = new aiMesh();
+            meshes.push_back(std::unique_ptr<aiMesh>(aim));
+
+            SetupMeshHeader(aim, mesh, p);
+
+            Mesh::Primitive::Attributes &attr = prim.attributes;
+            if (attr.position.size() > 0 && attr.position[0]) {
+                aim->mNumVertices = static_cast<unsigned int>(attr.position[0]->count);
             }
 
-            if (faces) {
-                aim->mFaces = faces;
-                const unsigned int actualNumFaces = static_cast<unsigned int>(facePtr - faces);
-                if (actualNumFaces < nFaces) {
-                    ASSIMP_LOG_WARN("Some faces had out-of-range indices. Those faces were dropped.");
-                }
-                if (actualNumFaces == 0)
-                {
-                    throw DeadlyImportError("Mesh \"", aim->mName.C_Str(), "\" has no faces");
-                }
-                aim->mNumFaces = actualNumFaces;
-                ai_assert(CheckValidFacesIndices(faces, actualNumFaces, aim->mNumVertices));
+            // the face counts match the ones ImportMeshes() generates as long as
+            // no index is out of range
+            const size_t count = prim.indices ? prim.indices->count : aim->mNumVertices;
+            size_t nFaces = 0;
+            switch (prim.mode) {
+                case PrimitiveMode_POINTS:
+                    nFaces = count;
+                    break;
+                case PrimitiveMode_LINES:
+                    nFaces = count / 2;
+                    break;
+                case PrimitiveMode_LINE_LOOP:
+                    nFaces = count;
+                    break;
+                case PrimitiveMode_LINE_STRIP:
+                    nFaces = count > 1 ? count - 1 : 0;
+                    break;
+                case PrimitiveMode_TRIANGLES:
+                    nFaces = count / 3;
+                    break;
+                case PrimitiveMode_TRIANGLE_STRIP:
+                case PrimitiveMode_TRIANGLE_FAN:
+                    nFaces = count > 2 ? count - 2 : 0;
+                    break;
+            }
+            aim->mNumFaces = static_cast<unsigned int>(nFaces);
+
+            if (aim->mNumVertices || aim->mNumFaces) {
+                mScene->mFlags |= AI_SCENE_FLAGS_DEFERRED_MESH_DATA;
             }
 
             if (prim.material) {
@@ -802,7 +892,7 @@ void glTF2Importer::ImportCameras(glTF2::Asset &r) {
     const unsigned int numCameras = r.cameras.Size();
     ASSIMP_LOG_DEBUG("Importing ", numCameras, " cameras");
     mScene->mNumCameras = numCameras;
-    mScene->mCameras = new aiCamera *[numCameras];
+    mScene->mCameras = AllocateSceneArray<aiCamera *>(numCameras);
     std::fill(mScene->mCameras, mScene->mCameras + numCameras, nullptr);
 
     for (size_t i = 0; i < numCameras; ++i) {
@@ -839,7 +929,7 @@ void glTF2Importer::ImportLights(glTF2::Asset &r) {
     const unsigned int numLights = r.lights.Size();
     ASSIMP_LOG_DEBUG("Importing ", numLights, " lights");
     mScene->mNumLights = numLights;
-    mScene->mLights = new aiLight *[numLights];
+    mScene->mLights = AllocateSceneArray<aiLight *>(numLights);
     std::fill(mScene->mLights, mScene->mLights + numLights, nullptr);
 
     for (size_t i = 0; i < numLights; ++i) {
@@ -1015,7 +1105,7 @@ aiNode *ImportNode(aiScene *pScene, glTF2::Asset &r, std::vector<unsigned int> &
     try {
         if (!node.children.empty()) {
             ainode->mNumChildren = unsigned(node.children.size());
-            ainode->mChildren = new aiNode *[ainode->mNumChildren];
+            ainode->mChildren = AllocateSceneArray<aiNode *>(ainode->mNumChildren);
             std::fill(ainode->mChildren, ainode->mChildren + ainode->mNumChildren, nullptr);
 
             for (unsigned int i = 0; i < ainode->mNumChildren; ++i) {
@@ -1047,7 +1137,7 @@ aiNode *ImportNode(aiScene *pScene, glTF2::Asset &r, std::vector<unsigned int> &
             int count = meshOffsets[mesh_idx + 1] - meshOffsets[mesh_idx];
 
             ainode->mNumMeshes = count;
-            ainode->mMeshes = new unsigned int[count];
+            ainode->mMeshes = AllocateSceneArray<unsigned int>(count);
 
             if (node.skin) {
                 for (int primitiveNo = 0; primitiveNo < count; ++primitiveNo) {
@@ -1058,7 +1148,7 @@ aiNode *ImportNode(aiScene *pScene, glTF2::Asset &r, std::vector<unsigned int> &
                     BuildVertexWeightMapping(node.meshes[0]->primitives[primitiveNo], weighting);
 
                     mesh->mNumBones = static_cast<unsigned int>(numBones);
-                    mesh->mBones = new aiBone *[mesh->mNumBones];
+                    mesh->mBones = AllocateSceneArray<aiBone *>(mesh->mNumBones);
                     std::fill(mesh->mBones, mesh->mBones + mesh->mNumBones, nullptr);
 
                     // GLTF and Assimp choose to store bone weights differently.
@@ -1164,7 +1254,7 @@ void glTF2Importer::ImportNodes(glTF2::Asset &r) {
     } else if (numRootNodes > 1) { // more than one root node: create a fake root
         aiNode *root = mScene->mRootNode = new aiNode("ROOT");
 
-        root->mChildren = new aiNode *[numRootNodes];
+        root->mChildren = AllocateSceneArray<aiNode *>(numRootNodes);
         std::fill(root->mChildren, root->mChildren + numRootNodes, nullptr);
 
         for (unsigned int i = 0; i < numRootNodes; ++i) {
@@ -1308,8 +1398,8 @@ aiMeshMorphAnim *CreateMeshMorphAnim(glTF2::Asset&, Node &node, AnimationSampler
                 unsigned int k = weightStride * i + ii;
                 anim->mKeys[i].mTime = times[i] * kMillisecondsFromSeconds;
                 anim->mKeys[i].mNumValuesAndWeights = numMorphs;
-                anim->mKeys[i].mValues = new unsigned int[numMorphs];
-                anim->mKeys[i].mWeights = new double[numMorphs];
+                anim->mKeys[i].mValues = AllocateSceneArray<unsigned int>(numMorphs);
+                anim->mKeys[i].mWeights = AllocateSceneArray<double>(numMorphs);
 
                 for (unsigned int j = 0u; j < numMorphs; ++j, ++k) {
                     anim->mKeys[i].mValues[j] = j;
@@ -1363,7 +1453,7 @@ void glTF2Importer::ImportAnimations(glTF2::Asset &r) {
         return;
     }
 
-    mScene->mAnimations = new aiAnimation *[numAnimations];
+    mScene->mAnimations = AllocateSceneArray<aiAnimation *>(numAnimations);
     std::fill(mScene->mAnimations, mScene->mAnimations + numAnimations, nullptr);
 
     for (unsigned int i = 0; i < numAnimations; ++i) {
@@ -1391,7 +1481,7 @@ void glTF2Importer::ImportAnimations(glTF2::Asset &r) {
 
         ai_anim->mNumChannels = numChannels;
         if (ai_anim->mNumChannels > 0) {
-            ai_anim->mChannels = new aiNodeAnim *[ai_anim->mNumChannels];
+            ai_anim->mChannels = AllocateSceneArray<aiNodeAnim *>(ai_anim->mNumChannels);
             std::fill(ai_anim->mChannels, ai_anim->mChannels + ai_anim->mNumChannels, nullptr);
             int j = 0;
             for (auto &iter : samplers) {
@@ -1404,7 +1494,7 @@ void glTF2Importer::ImportAnimations(glTF2::Asset &r) {
 
         ai_anim->mNumMorphMeshChannels = numMorphMeshChannels;
         if (ai_anim->mNumMorphMeshChannels > 0) {
-            ai_anim->mMorphMeshChannels = new aiMeshMorphAnim *[ai_anim->mNumMorphMeshChannels];
+            ai_anim->mMorphMeshChannels = AllocateSceneArray<aiMeshMorphAnim *>(ai_anim->mNumMorphMeshChannels);
             std::fill(ai_anim->mMorphMeshChannels, ai_anim->mMorphMeshChannels + ai_anim->mNumMorphMeshChannels, nullptr);
             int j = 0;
             for (auto &iter : samplers) {
@@ -1475,7 +1565,7 @@ void glTF2Importer::ImportEmbeddedTextures(glTF2::Asset &r) {
 
       ASSIMP_LOG_DEBUG("Importing ", numEmbeddedTexs, " embedded textures");
 
-    mScene->mTextures = new aiTexture *[numEmbeddedTexs];
+    mScene->mTextures = AllocateSceneArray<aiTexture *>(numEmbeddedTexs);
     std::fill(mScene->mTextures, mScene->mTextures + numEmbeddedTexs, nullptr);
 
     // Add the embedded textures
@@ -1491,12 +1581,12 @@ void glTF2Importer::ImportEmbeddedTextures(glTF2::Asset &r) {
         aiTexture *tex = mScene->mTextures[idx] = new aiTexture();
 
         size_t length = img.GetDataLength();
-        void *data = img.StealData();
+        uint8_t *data = img.StealData();
 
         tex->mFilename = img.name;
         tex->mWidth = static_cast<unsigned int>(length);
         tex->mHeight = 0;
-        tex->pcData = reinterpret_cast<aiTexel *>(data);
+        tex->pcData = reinterpret_cast<aiTexel *>(AdoptSceneArray(data, length));
 
         if (!img.mimeType.empty()) {
             const char *ext = strchr(img.mimeType.c_str(), '/') + 1;
@@ -1555,7 +1645,10 @@ void glTF2Importer::InternReadFile(const std::string &pFile, aiScene *pScene, IO
     this->mScene = pScene;
 
     // read the asset file
-    glTF2::Asset asset(pIOHandler);
+    Profiling::ScopedRegion phase(m_profiler, "parse");
+    std::unique_ptr<glTF2::Asset> assetPtr(new glTF2::Asset(pIOHandler));
+    glTF2::Asset &asset = *assetPtr;
+    asset.SetDeferBufferData(m_deferMeshData);
     asset.Load(pFile, GetExtension(pFile) == "glb");
     if (asset.scene) {
         pScene->mName = asset.scene->name;
@@ -1564,11 +1657,16 @@ void glTF2Importer::InternReadFile(const std::string &pFile, aiScene *pScene, IO
     //
     // Copy the data out
     //
+    phase.Next("convert");
 
     ImportEmbeddedTextures(asset);
     ImportMaterials(asset);
 
-    ImportMeshes(asset);
+    if (asset.IsBufferDataDeferred()) {
+        ImportMeshHeaders(asset);
+    } else {
+        ImportMeshes(asset);
+    }
 
     ImportCameras(asset);
     ImportLights(asset);
@@ -1582,6 +1680,74 @@ void glTF2Importer::InternReadFile(const std::string &pFile, aiScene *pScene, IO
     if (pScene->mNumMeshes == 0) {
         pScene->mFlags |= AI_SCENE_FLAGS_INCOMPLETE;
     }
+
+    // keep the asset to read the primitives from, the IO system is gone once we return
+    if (pScene->mFlags & AI_SCENE_FLAGS_DEFERRED_MESH_DATA) {
+        asset.SetIOSystem(nullptr);
+        mDeferredAsset = std::move(assetPtr);
+    }
+}
+
+void glTF2Importer::InternReadMeshData(const std::string &pFile, aiScene *pScene, unsigned int pMeshIndex, IOSystem *pIOHandler) {
+    if (!mDeferredAsset || meshOffsets.empty() || pMeshIndex >= meshOffsets.back()) {
+        throw DeadlyImportError("GLTF: deferred mesh ", pMeshIndex, " does not exist in ", pFile);
+    }
+
+    // meshOffsets holds the index of the first aiMesh of each glTF mesh, one per primitive
+    const size_t m = std::upper_bound(meshOffsets.begin(), meshOffsets.end(), pMeshIndex) - meshOffsets.begin() - 1;
+    Mesh &mesh = mDeferredAsset->meshes[static_cast<unsigned int>(m)];
+    const unsigned int p = pMeshIndex - meshOffsets[m];
+    Mesh::Primitive &prim = mesh.primitives[p];
+
+    // read the elements of the accessors of this primitive only
+    std::vector<Accessor *> accessors;
+    auto addAccessors = [&accessors](Mesh::AccessorList &list) {
+        for (Ref<Accessor> &acc : list) {
+            if (acc) {
+                accessors.push_back(&*acc);
+            }
+        }
+    };
+    addAccessors(prim.attributes.position);
+    addAccessors(prim.attributes.normal);
+    addAccessors(prim.attributes.tangent);
+    addAccessors(prim.attributes.texcoord);
+    addAccessors(prim.attributes.color);
+    for (Mesh::Primitive::Target &target : prim.targets) {
+        addAccessors(target.position);
+        addAccessors(target.normal);
+        addAccessors(target.tangent);
+    }
+    if (prim.indices) {
+        accessors.push_back(&*prim.indices);
+    }
+
+    mScene = pScene;
+    mDeferredAsset->SetIOSystem(pIOHandler);
+    try {
+        for (Accessor *acc : accessors) {
+            acc->LoadDeferredData(*mDeferredAsset);
+        }
+
+        std::unique_ptr<aiMesh> aim(new aiMesh());
+        ImportPrimitive(mesh, p, aim.get());
+        MoveMeshData(pScene->mMeshes[pMeshIndex], aim.get());
+    } catch (...) {
+        for (Accessor *acc : accessors) {
+            acc->ReleaseDeferredData();
+        }
+        mDeferredAsset->SetIOSystem(nullptr);
+        throw;
+    }
+
+    for (Accessor *acc : accessors) {
+        acc->ReleaseDeferredData();
+    }
+    mDeferredAsset->SetIOSystem(nullptr);
+}
+
+void glTF2Importer::ReleaseDeferredData() {
+    mDeferredAsset.reset();
 }
 
 #endif // ASSIMP_BUILD_NO_GLTF_IMPORTER
@@ -45,12 +45,15 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/BaseImporter.h>
 #include <assimp/DefaultIOSystem.h>
 
+#include <memory>
+
 struct aiNode;
 
 
 namespace glTF2
 {
     class Asset;
+    struct Mesh;
 }
 
 namespace Assimp {
@@ -68,6 +71,8 @@ public:
 protected:
     virtual const aiImporterDesc* GetInfo() const;
     virtual void InternReadFile( const std::string& pFile, aiScene* pScene, IOSystem* pIOHandler );
+    virtual void InternReadMeshData( const std::string& pFile, aiScene* pScene, unsigned int pMeshIndex, IOSystem* pIOHandler );
+    virtual void ReleaseDeferredData();
 
 private:
 
@@ -77,9 +82,15 @@ private:
 
     aiScene* mScene;
 
+    /// Asset of the last import if it has deferred meshes, the buffer data
+    /// of single primitives is read from it on demand
+    std::unique_ptr<glTF2::Asset> mDeferredAsset;
+
     void ImportEmbeddedTextures(glTF2::Asset& a);
     void ImportMaterials(glTF2::Asset& a);
+    void ImportPrimitive(glTF2::Mesh& mesh, unsigned int p, aiMesh* aim);
     void ImportMeshes(glTF2::Asset& a);
+    void ImportMeshHeaders(glTF2::Asset& a);
     void ImportCameras(glTF2::Asset& a);
     void ImportLights(glTF2::Asset& a);
     void ImportNodes(glTF2::Asset& a);
@@ -0,0 +1,273 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2021, assimp team
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+/** @file Allocator.cpp
+ *  @brief Implementation of the scene allocator hook and the CountingAllocator
+ */
+
+#include "ScenePrivate.h"
+
+#include <assimp/Allocator.h>
+#include <assimp/ImportLimits.h>
+#include <assimp/ai_assert.h>
+
+using namespace Assimp;
+
+namespace {
+
+// The allocator bound to this thread, nullptr for the global operator new
+thread_local Allocator *tActiveAllocator = nullptr;
+
+// Every block starts with the allocator it came from, the header keeps the
+// object behind it aligned for all scene types
+static const size_t HeaderSize = alignof(std::max_align_t);
+static_assert(sizeof(Allocator *) <= HeaderSize, "header too small");
+
+// Arrays also need their size, the array delete doesn't pass it
+struct ArrayHeader {
+    Allocator *mAllocator;
+    size_t mSize;
+};
+static const size_t ArrayHeaderSize = (sizeof(ArrayHeader) + HeaderSize - 1) / HeaderSize * HeaderSize;
+
+// Layout of the arrays bound with a SceneArrayScope, -1 if there is none
+thread_local int tTrackedArrays = -1;
+
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+Allocator::~Allocator() {
+    // empty
+}
+
+// ------------------------------------------------------------------------------------------------
+Allocator::Scope::Scope(Allocator *allocator) :
+        mPrevious(tActiveAllocator),
+        mActive(nullptr != allocator) {
+    if (mActive) {
+        tActiveAllocator = allocator;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+Allocator::Scope::~Scope() {
+    if (mActive) {
+        tActiveAllocator = mPrevious;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+Allocator *Allocator::GetActive() {
+    return tActiveAllocator;
+}
+
+// ------------------------------------------------------------------------------------------------
+void *Intern::AllocateSceneMemory(size_t size) {
+    // scene data counts against the memory budget of a running import
+    ImportLimits::Allocate(size);
+
+    try {
+        Allocator *allocator = tActiveAllocator;
+        void *block = nullptr != allocator ? allocator->Allocate(HeaderSize + size) : ::operator new(HeaderSize + size);
+        *static_cast<Allocator **>(block) = allocator;
+        return static_cast<char *>(block) + HeaderSize;
+    } catch (...) {
+        ImportLimits::Free(size);
+        throw;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void Intern::FreeSceneMemory(void *data, size_t size) AI_NO_EXCEPT {
+    if (nullptr == data) {
+        return;
+    }
+    ImportLimits::Free(size);
+
+    void *block = static_cast<char *>(data) - HeaderSize;
+    Allocator *allocator = *static_cast<Allocator **>(block);
+    if (nullptr != allocator) {
+        allocator->Deallocate(block, HeaderSize + size);
+        return;
+    }
+    ::operator delete(block);
+}
+
+// ------------------------------------------------------------------------------------------------
+void *Intern::AllocateSceneArrayMemory(size_t size) {
+    ImportLimits::Allocate(size);
+
+    try {
+        Allocator *allocator = tActiveAllocator;
+        void *block = nullptr != allocator ? allocator->Allocate(ArrayHeaderSize + size) : ::operator new(ArrayHeaderSize + size);
+        ArrayHeader *header = static_cast<ArrayHeader *>(block);
+        header->mAllocator = allocator;
+        header->mSize = size;
+        return static_cast<char *>(block) + ArrayHeaderSize;
+    } catch (...) {
+        ImportLimits::Free(size);
+        throw;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void Intern::FreeSceneArrayMemory(void *data) AI_NO_EXCEPT {
+    if (nullptr == data) {
+        return;
+    }
+
+    void *block = static_cast<char *>(data) - ArrayHeaderSize;
+    const ArrayHeader *header = static_cast<const ArrayHeader *>(block);
+    ImportLimits::Free(header->mSize);
+    if (nullptr != header->mAllocator) {
+        header->mAllocator->Deallocate(block, ArrayHeaderSize + header->mSize);
+        return;
+    }
+    ::operator delete(block);
+}
+
+// ------------------------------------------------------------------------------------------------
+SceneArrayScope::SceneArrayScope(const aiScene *scene) :
+        mPrevious(tTrackedArrays),
+        mActive(nullptr != scene) {
+    if (mActive) {
+        const ScenePrivateData *priv = ScenePriv(scene);
+        tTrackedArrays = nullptr != priv && priv->mTrackedArrays;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+SceneArrayScope::SceneArrayScope(bool tracked) :
+        mPrevious(tTrackedArrays),
+        mActive(true) {
+    tTrackedArrays = tracked;
+}
+
+// ------------------------------------------------------------------------------------------------
+SceneArrayScope::~SceneArrayScope() {
+    if (mActive) {
+        tTrackedArrays = mPrevious;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+bool SceneArrayScope::IsTracked() {
+    // without a scope the arrays of an import or allocator have the header
+    if (tTrackedArrays >= 0) {
+        return 0 != tTrackedArrays;
+    }
+    return nullptr != tActiveAllocator || nullptr != ImportLimits::GetActive();
+}
+
+// ------------------------------------------------------------------------------------------------
+void *Intern::AllocateTrackedMemory(size_t size, size_t alignment) {
+    if (!SceneArrayScope::IsTracked()) {
+        return nullptr;
+    }
+
+    // the header keeps the array aligned like the element types, holds the
+    // size charged to the memory budget and the allocator, for an arena the
+    // array is reclaimed together with the arena
+    ai_assert(alignment <= HeaderSize);
+    (void)alignment;
+    return AllocateSceneArrayMemory(size);
+}
+
+// ------------------------------------------------------------------------------------------------
+bool Intern::IsTrackedMemory(const void *data) AI_NO_EXCEPT {
+    (void)data;
+    return SceneArrayScope::IsTracked();
+}
+
+// ------------------------------------------------------------------------------------------------
+bool Intern::ReleaseTrackedMemory(const void *data) AI_NO_EXCEPT {
+    if (!SceneArrayScope::IsTracked()) {
+        return false;
+    }
+    FreeSceneArrayMemory(const_cast<void *>(data));
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+CountingAllocator::CountingAllocator(Allocator *parent) :
+        mParent(parent),
+        mCurrent(0),
+        mPeak(0),
+        mTotal(0),
+        mNumAllocations(0) {
+    // empty
+}
+
+// ------------------------------------------------------------------------------------------------
+void *CountingAllocator::Allocate(size_t size) {
+    void *data = nullptr != mParent ? mParent->Allocate(size) : ::operator new(size);
+
+    mTotal.fetch_add(size, std::memory_order_relaxed);
+    mNumAllocations.fetch_add(1, std::memory_order_relaxed);
+    RaisePeak(mCurrent.fetch_add(size, std::memory_order_relaxed) + size);
+
+    return data;
+}
+
+// ------------------------------------------------------------------------------------------------
+void CountingAllocator::Deallocate(void *data, size_t size) AI_NO_EXCEPT {
+    mCurrent.fetch_sub(size, std::memory_order_relaxed);
+
+    if (nullptr != mParent) {
+        mParent->Deallocate(data, size);
+        return;
+    }
+    ::operator delete(data);
+}
+
+// ------------------------------------------------------------------------------------------------
+size_t CountingAllocator::ResetPeak() {
+    return mPeak.exchange(mCurrent.load(std::memory_order_relaxed));
+}
+
+// ------------------------------------------------------------------------------------------------
+void CountingAllocator::RaisePeak(size_t bytes) {
+    size_t peak = mPeak.load(std::memory_order_relaxed);
+    while (peak < bytes && !mPeak.compare_exchange_weak(peak, bytes, std::memory_order_relaxed)) {
+        // peak was reloaded, try again
+    }
+}
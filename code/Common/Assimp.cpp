@@ -496,6 +496,24 @@ void aiGetMemoryRequirements(const C_STRUCT aiScene *pIn,
     ASSIMP_END_EXCEPTION_REGION(void);
 }
 
+// ------------------------------------------------------------------------------------------------
+// Get the import statistics of a specific scene
+const aiImportStatistics *aiGetImportStatistics(const aiScene *pIn) {
+    const aiImportStatistics *stats = nullptr;
+    ASSIMP_BEGIN_EXCEPTION_REGION();
+
+    // find the importer associated with this data
+    const ScenePrivateData *priv = ScenePriv(pIn);
+    if (!priv || !priv->mOrigImporter) {
+        ReportSceneNotFoundError();
+        return nullptr;
+    }
+
+    stats = priv->mOrigImporter->GetImportStatistics();
+    ASSIMP_END_EXCEPTION_REGION(const aiImportStatistics *);
+    return stats;
+}
+
 // ------------------------------------------------------------------------------------------------
 ASSIMP_API aiPropertyStore *aiCreatePropertyStore(void) {
     return reinterpret_cast<aiPropertyStore *>(new PropertyMap());
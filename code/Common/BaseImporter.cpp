@@ -45,32 +45,45 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "FileSystemFilter.h"
 #include "Importer.h"
+#include "LockedIOSystem.h"
+#include "ScenePreprocessor.h"
+#include "TaskScheduler.h"
+#include <assimp/Allocator.h>
 #include <assimp/BaseImporter.h>
 #include <assimp/ByteSwapper.h>
+#include <assimp/ImportLimits.h>
+#include <assimp/MeshSink.hpp>
 #include <assimp/ParsingUtils.h>
+#include <assimp/config.h>
 #include <assimp/importerdesc.h>
 #include <assimp/postprocess.h>
 #include <assimp/scene.h>
 #include <assimp/Importer.hpp>
 
+#include <algorithm>
 #include <cctype>
+#include <condition_variable>
+#include <deque>
 #include <ios>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <sstream>
+#include <thread>
 
 using namespace Assimp;
 
 // ------------------------------------------------------------------------------------------------
 // Constructor to be privately used by Importer
 BaseImporter::BaseImporter() AI_NO_EXCEPT
-        : m_progress() {
+        : m_progress(), m_profiler(), m_deferMeshData(false),
+          m_meshSink(nullptr), m_meshSinkChunkSize(AI_MESH_SINK_DEFAULT_CHUNK_SIZE), m_numSunkMeshes(0), m_numThreads(1) {
 }
 
 // ------------------------------------------------------------------------------------------------
 // Destructor, private as well
 BaseImporter::~BaseImporter() {
-    // nothing to do here
+    // empty
 }
 
 void BaseImporter::UpdateImporterScale(Importer *pImp) {
@@ -96,6 +109,16 @@ aiScene *BaseImporter::ReadFile(Importer *pImp, const std::string &pFile, IOSyst
     }
 
     ai_assert(m_progress);
+    m_profiler = pImp->Pimpl()->mProfiler;
+    m_numThreads = pImp->Pimpl()->mTaskScheduler ? pImp->Pimpl()->mTaskScheduler->GetNumThreads() : 1;
+
+    ReleaseDeferredData();
+    m_meshSink = pImp->GetMeshSink();
+    m_meshSinkChunkSize = std::max(1, pImp->GetPropertyInteger(AI_CONFIG_IMPORT_MESH_SINK_CHUNK_SIZE, AI_MESH_SINK_DEFAULT_CHUNK_SIZE));
+    m_numSunkMeshes = 0;
+
+    // streamed meshes are complete, there is nothing to defer then
+    m_deferMeshData = nullptr == m_meshSink && pImp->GetPropertyBool(AI_CONFIG_IMPORT_DEFER_MESH_DATA, false);
 
     // Gather configuration properties for this run
     SetupProperties(pImp);
@@ -110,6 +133,10 @@ aiScene *BaseImporter::ReadFile(Importer *pImp, const std::string &pFile, IOSyst
     try {
         InternReadFile(pFile, sc.get(), &filter);
 
+        if (nullptr != m_meshSink) {
+            SinkSceneMeshes(sc.get());
+        }
+
         // Calculate import scale hook - required because pImp not available anywhere else
         // passes scale into ScaleProcess
         UpdateImporterScale(pImp);
@@ -119,13 +146,127 @@ aiScene *BaseImporter::ReadFile(Importer *pImp, const std::string &pFile, IOSyst
         m_ErrorText = err.what();
         ASSIMP_LOG_ERROR(err.what());
         m_Exception = std::current_exception();
+        m_profiler = nullptr;
+        m_meshSink = nullptr;
         return nullptr;
     }
+    m_profiler = nullptr;
+    m_meshSink = nullptr;
 
     // return what we gathered from the import.
     return sc.release();
 }
 
+// ------------------------------------------------------------------------------------------------
+bool BaseImporter::ReadMeshData(const std::string &pFile, aiScene *pScene, unsigned int pMeshIndex, IOSystem *pIOHandler) {
+    ai_assert(nullptr != pScene);
+    ai_assert(pMeshIndex < pScene->mNumMeshes);
+
+    FileSystemFilter filter(pFile, pIOHandler);
+    try {
+        InternReadMeshData(pFile, pScene, pMeshIndex, &filter);
+    } catch (const std::exception &err) {
+        m_ErrorText = err.what();
+        ASSIMP_LOG_ERROR(err.what());
+        m_Exception = std::current_exception();
+        return false;
+    }
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+void BaseImporter::ReleaseDeferredData() {
+    // the default implementation keeps nothing
+}
+
+// ------------------------------------------------------------------------------------------------
+void BaseImporter::InternReadMeshData(const std::string &pFile, aiScene * /*pScene*/, unsigned int /*pMeshIndex*/, IOSystem * /*pIOHandler*/) {
+    throw DeadlyImportError("The importer of ", pFile, " does not support loading single meshes");
+}
+
+// ------------------------------------------------------------------------------------------------
+void BaseImporter::MoveMeshData(aiMesh *dest, aiMesh *src) {
+    if (dest->mNumVertices != src->mNumVertices || dest->mNumFaces != src->mNumFaces) {
+        ASSIMP_LOG_WARN("Deferred mesh ", dest->mName.C_Str(), " has ", src->mNumVertices, " vertices and ",
+                src->mNumFaces, " faces, ", dest->mNumVertices, " and ", dest->mNumFaces, " were announced");
+    }
+
+    std::swap(dest->mNumVertices, src->mNumVertices);
+    std::swap(dest->mNumFaces, src->mNumFaces);
+    std::swap(dest->mVertices, src->mVertices);
+    std::swap(dest->mNormals, src->mNormals);
+    std::swap(dest->mTangents, src->mTangents);
+    std::swap(dest->mBitangents, src->mBitangents);
+    for (unsigned int i = 0; i < AI_MAX_NUMBER_OF_COLOR_SETS; ++i) {
+        std::swap(dest->mColors[i], src->mColors[i]);
+    }
+    for (unsigned int i = 0; i < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++i) {
+        std::swap(dest->mTextureCoords[i], src->mTextureCoords[i]);
+        std::swap(dest->mNumUVComponents[i], src->mNumUVComponents[i]);
+    }
+    std::swap(dest->mFaces, src->mFaces);
+    std::swap(dest->mFaceIndices, src->mFaceIndices);
+    std::swap(dest->mNumFaceIndices, src->mNumFaceIndices);
+    std::swap(dest->mNumBones, src->mNumBones);
+    std::swap(dest->mBones, src->mBones);
+    std::swap(dest->mNumAnimMeshes, src->mNumAnimMeshes);
+    std::swap(dest->mAnimMeshes, src->mAnimMeshes);
+    dest->mMethod = src->mMethod;
+    if (src->mPrimitiveTypes) {
+        dest->mPrimitiveTypes = src->mPrimitiveTypes;
+    }
+
+    // keep the bounds stored in the file unless the full import has some
+    if (src->mAABB.mMin != src->mAABB.mMax) {
+        dest->mAABB = src->mAABB;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void BaseImporter::SinkMesh(aiMesh *mesh, unsigned int meshIndex) {
+    ai_assert(nullptr != m_meshSink);
+    ai_assert(nullptr != mesh);
+
+    // the sink gets what the scene would get after ReadFile()
+    ScenePreprocessor().ProcessMesh(mesh);
+
+    m_numSunkMeshes = std::max(m_numSunkMeshes, meshIndex + 1);
+    if (!m_meshSink->Consume(mesh, meshIndex)) {
+        throw DeadlyImportError("Import aborted by the mesh sink");
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+static void RemoveMeshReferences(aiNode *node) {
+    FreeSceneArray(node->mMeshes);
+    node->mMeshes = nullptr;
+    node->mNumMeshes = 0;
+    for (unsigned int i = 0; i < node->mNumChildren; ++i) {
+        RemoveMeshReferences(node->mChildren[i]);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void BaseImporter::SinkSceneMeshes(aiScene *pScene) {
+    // indices continue after the meshes the importer streamed itself
+    const unsigned int base = m_numSunkMeshes;
+    for (unsigned int i = 0; i < pScene->mNumMeshes; ++i) {
+        aiMesh *mesh = pScene->mMeshes[i];
+        pScene->mMeshes[i] = nullptr;
+        if (nullptr != mesh) {
+            SinkMesh(mesh, base + i);
+        }
+    }
+    FreeSceneArray(pScene->mMeshes);
+    pScene->mMeshes = nullptr;
+    pScene->mNumMeshes = 0;
+
+    if (nullptr != pScene->mRootNode) {
+        RemoveMeshReferences(pScene->mRootNode);
+    }
+    pScene->mFlags |= AI_SCENE_FLAGS_INCOMPLETE;
+}
+
 // ------------------------------------------------------------------------------------------------
 void BaseImporter::SetupProperties(const Importer *) {
     // the default implementation does nothing
@@ -484,8 +625,8 @@ struct LoadRequest {
 // ------------------------------------------------------------------------------------------------
 // BatchLoader::pimpl data structure
 struct Assimp::BatchData {
-    BatchData(IOSystem *pIO, bool validate) :
-            pIOSystem(pIO), pImporter(nullptr), next_id(0xffff), validate(validate) {
+    BatchData(IOSystem *pIO, bool validate, unsigned int numThreads) :
+            pIOSystem(pIO), pImporter(nullptr), next_id(0xffff), validate(validate), numThreads(numThreads), runningWorkers(0) {
         ai_assert(nullptr != pIO);
 
         pImporter = new Importer();
@@ -497,15 +638,28 @@ struct Assimp::BatchData {
         delete pImporter;
     }
 
+    // Loads a request with the given importer
+    void Load(Importer *importer, LoadRequest &req) const;
+
+    // Entry point of the worker threads, they import with the limits, the
+    // allocator and the array layout of the thread which started them
+    void WorkerMain(ImportLimits *limits, Allocator *allocator, bool trackedArrays);
+
+    // Waits for running workers and joins them, requires a lock on mutex
+    void JoinWorkers(std::unique_lock<std::mutex> &lock);
+
     // IO system to be used for all imports
     IOSystem *pIOSystem;
 
-    // Importer used to load all meshes
+    // Importer used to load all meshes on the calling thread
     Importer *pImporter;
 
     // List of all imports
     std::list<LoadRequest> requests;
 
+    // Requests which have not been picked up for loading yet
+    std::deque<LoadRequest *> pending;
+
     // Base path
     std::string pathBase;
 
@@ -514,19 +668,112 @@ struct Assimp::BatchData {
 
     // Validation enabled state
     bool validate;
+
+    // Size of the worker pool
+    unsigned int numThreads;
+
+    // Guards requests, pending and runningWorkers while workers are active
+    std::mutex mutex;
+
+    // Signalled whenever a request was loaded or a worker exits
+    std::condition_variable loadedCondition;
+
+    // The workers, they exit once pending is empty
+    std::vector<std::thread> workers;
+    unsigned int runningWorkers;
+
+    // Serializes the workers' accesses to pIOSystem
+    std::mutex ioMutex;
 };
 
 typedef std::list<LoadRequest>::iterator LoadReqIt;
 
 // ------------------------------------------------------------------------------------------------
-BatchLoader::BatchLoader(IOSystem *pIO, bool validate) {
+void BatchData::Load(Importer *importer, LoadRequest &req) const {
+    // force validation in debug builds
+    unsigned int pp = req.flags;
+    if (validate) {
+        pp |= aiProcess_ValidateDataStructure;
+    }
+
+    // setup config properties if necessary
+    ImporterPimpl *pimpl = importer->Pimpl();
+    pimpl->mFloatProperties = req.map.floats;
+    pimpl->mIntProperties = req.map.ints;
+    pimpl->mStringProperties = req.map.strings;
+    pimpl->mMatrixProperties = req.map.matrices;
+
+    if (!DefaultLogger::isNullLogger()) {
+        ASSIMP_LOG_INFO("%%% BEGIN EXTERNAL FILE %%%");
+        ASSIMP_LOG_INFO("File: ", req.file);
+    }
+    importer->ReadFile(req.file, pp);
+    req.scene = importer->GetOrphanedScene();
+
+    ASSIMP_LOG_INFO("%%% END EXTERNAL FILE %%%");
+}
+
+// ------------------------------------------------------------------------------------------------
+void BatchData::WorkerMain(ImportLimits *limits, Allocator *allocator, bool trackedArrays) {
+    ImportLimits::Scope limitsScope(limits);
+    Allocator::Scope allocatorScope(allocator);
+    SceneArrayScope arrayScope(trackedArrays);
+
+    LockedIOSystem io(pIOSystem, ioMutex);
+    Importer importer;
+    importer.SetIOHandler(&io);
+
+    std::unique_lock<std::mutex> lock(mutex);
+    while (!pending.empty()) {
+        LoadRequest *req = pending.front();
+        pending.pop_front();
+
+        // file, flags and map are not touched by anyone else once queued
+        lock.unlock();
+        try {
+            Load(&importer, *req);
+        } catch (const std::exception &e) {
+            ASSIMP_LOG_ERROR("Failed to load external file ", req->file, ": ", e.what());
+        }
+        lock.lock();
+
+        req->loaded = true;
+        loadedCondition.notify_all();
+    }
+
+    --runningWorkers;
+    loadedCondition.notify_all();
+    lock.unlock();
+
+    importer.SetIOHandler(nullptr); /* get pointer back into our possession */
+}
+
+// ------------------------------------------------------------------------------------------------
+void BatchData::JoinWorkers(std::unique_lock<std::mutex> &lock) {
+    loadedCondition.wait(lock, [this] { return 0 == runningWorkers; });
+    for (std::thread &worker : workers) {
+        worker.join();
+    }
+    workers.clear();
+}
+
+// ------------------------------------------------------------------------------------------------
+BatchLoader::BatchLoader(IOSystem *pIO, bool validate, unsigned int numThreads) {
     ai_assert(nullptr != pIO);
 
-    m_data = new BatchData(pIO, validate);
+    m_data = new BatchData(pIO, validate, 1);
+    setNumThreads(numThreads);
 }
 
 // ------------------------------------------------------------------------------------------------
 BatchLoader::~BatchLoader() {
+    {
+        // let the workers finish their current file
+        std::unique_lock<std::mutex> lock(m_data->mutex);
+        m_data->pending.clear();
+        m_data->JoinWorkers(lock);
+    }
+
     // delete all scenes what have not been polled by the user
     for (LoadReqIt it = m_data->requests.begin(); it != m_data->requests.end(); ++it) {
         delete (*it).scene;
@@ -544,13 +791,29 @@ bool BatchLoader::getValidation() const {
     return m_data->validate;
 }
 
+// ------------------------------------------------------------------------------------------------
+void BatchLoader::setNumThreads(unsigned int numThreads) {
+    m_data->numThreads = numThreads ? numThreads : TaskScheduler::GetHardwareConcurrency();
+}
+
+// ------------------------------------------------------------------------------------------------
+unsigned int BatchLoader::getNumThreads() const {
+    return m_data->numThreads;
+}
+
 // ------------------------------------------------------------------------------------------------
 unsigned int BatchLoader::AddLoadRequest(const std::string &file,
         unsigned int steps /*= 0*/, const PropertyMap *map /*= nullptr*/) {
     ai_assert(!file.empty());
 
+    std::lock_guard<std::mutex> lock(m_data->mutex);
+
     // check whether we have this loading request already
     for (LoadReqIt it = m_data->requests.begin(); it != m_data->requests.end(); ++it) {
+        if ((*it).flags != steps) {
+            continue;
+        }
+
         // Call IOSystem's path comparison function here
         if (m_data->pIOSystem->ComparePaths((*it).file, file)) {
             if (map) {
@@ -568,48 +831,98 @@ unsigned int BatchLoader::AddLoadRequest(const std::string &file,
 
     // no, we don't have it. So add it to the queue ...
     m_data->requests.emplace_back(file, steps, map, m_data->next_id);
+    m_data->pending.push_back(&m_data->requests.back());
     return m_data->next_id++;
 }
 
 // ------------------------------------------------------------------------------------------------
-aiScene *BatchLoader::GetImport(unsigned int which) {
-    for (LoadReqIt it = m_data->requests.begin(); it != m_data->requests.end(); ++it) {
-        if ((*it).id == which && (*it).loaded) {
-            aiScene *sc = (*it).scene;
-            if (!(--(*it).refCnt)) {
-                m_data->requests.erase(it);
-            }
-            return sc;
+aiScene *BatchLoader::GetImport(unsigned int which, bool wait /*= false*/) {
+    std::unique_lock<std::mutex> lock(m_data->mutex);
+
+    LoadReqIt it = m_data->requests.begin();
+    for (; it != m_data->requests.end(); ++it) {
+        if ((*it).id == which) {
+            break;
+        }
+    }
+    if (it == m_data->requests.end()) {
+        return nullptr;
+    }
+
+    if (!(*it).loaded) {
+        if (!wait) {
+            return nullptr;
+        }
+
+        LoadRequest &req = *it;
+        if (m_data->numThreads > 1) {
+            lock.unlock();
+            StartLoading();
+            lock.lock();
+        }
+
+        auto queued = std::find(m_data->pending.begin(), m_data->pending.end(), &req);
+        if (queued != m_data->pending.end() && m_data->numThreads < 2) {
+            // load just this one, the others stay queued
+            m_data->pending.erase(queued);
+            lock.unlock();
+            m_data->Load(m_data->pImporter, req);
+            lock.lock();
+            req.loaded = true;
+        } else {
+            m_data->loadedCondition.wait(lock, [&req] { return req.loaded; });
         }
     }
-    return nullptr;
+
+    aiScene *sc = (*it).scene;
+    if (!(--(*it).refCnt)) {
+        m_data->requests.erase(it);
+    }
+    return sc;
+}
+
+// ------------------------------------------------------------------------------------------------
+void BatchLoader::StartLoading() {
+    std::unique_lock<std::mutex> lock(m_data->mutex);
+    if (m_data->numThreads < 2 || m_data->pending.empty()) {
+        return;
+    }
+
+    // running workers pick up new requests on their own
+    if (m_data->runningWorkers > 0) {
+        return;
+    }
+    m_data->JoinWorkers(lock);
+
+    // nested imports count against the budget and the deadline of the
+    // import running on this thread, and share its allocator or arena and
+    // the layout of its arrays
+    ImportLimits *limits = ImportLimits::GetActive();
+    Allocator *allocator = Allocator::GetActive();
+    const bool trackedArrays = SceneArrayScope::IsTracked();
+
+    const size_t numWorkers = std::min<size_t>(m_data->numThreads, m_data->pending.size());
+    for (size_t i = 0; i < numWorkers; ++i) {
+        ++m_data->runningWorkers;
+        m_data->workers.emplace_back(&BatchData::WorkerMain, m_data, limits, allocator, trackedArrays);
+    }
 }
 
 // ------------------------------------------------------------------------------------------------
 void BatchLoader::LoadAll() {
-    // no threaded implementation for the moment
-    for (LoadReqIt it = m_data->requests.begin(); it != m_data->requests.end(); ++it) {
-        // force validation in debug builds
-        unsigned int pp = (*it).flags;
-        if (m_data->validate) {
-            pp |= aiProcess_ValidateDataStructure;
-        }
+    StartLoading();
 
-        // setup config properties if necessary
-        ImporterPimpl *pimpl = m_data->pImporter->Pimpl();
-        pimpl->mFloatProperties = (*it).map.floats;
-        pimpl->mIntProperties = (*it).map.ints;
-        pimpl->mStringProperties = (*it).map.strings;
-        pimpl->mMatrixProperties = (*it).map.matrices;
+    std::unique_lock<std::mutex> lock(m_data->mutex);
+    m_data->JoinWorkers(lock);
 
-        if (!DefaultLogger::isNullLogger()) {
-            ASSIMP_LOG_INFO("%%% BEGIN EXTERNAL FILE %%%");
-            ASSIMP_LOG_INFO("File: ", (*it).file);
-        }
-        m_data->pImporter->ReadFile((*it).file, pp);
-        (*it).scene = m_data->pImporter->GetOrphanedScene();
-        (*it).loaded = true;
+    // anything left is loaded on the calling thread
+    while (!m_data->pending.empty()) {
+        LoadRequest *req = m_data->pending.front();
+        m_data->pending.pop_front();
 
-        ASSIMP_LOG_INFO("%%% END EXTERNAL FILE %%%");
+        lock.unlock();
+        m_data->Load(m_data->pImporter, *req);
+        lock.lock();
+        req->loaded = true;
     }
 }
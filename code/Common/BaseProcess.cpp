@@ -43,17 +43,30 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "BaseProcess.h"
 #include "Importer.h"
+#include "TaskScheduler.h"
 #include <assimp/BaseImporter.h>
+#include <assimp/ImportLimits.h>
 #include <assimp/scene.h>
 #include <assimp/DefaultLogger.hpp>
 
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <typeinfo>
+
+#if defined(__GNUC__)
+#   include <cxxabi.h>
+#   include <cstdlib>
+#endif
+
 using namespace Assimp;
 
 // ------------------------------------------------------------------------------------------------
 // Constructor to be privately used by Importer
 BaseProcess::BaseProcess() AI_NO_EXCEPT
         : shared(),
-          progress() {
+          progress(),
+          scheduler() {
     // empty
 }
 
@@ -64,23 +77,29 @@ BaseProcess::~BaseProcess() {
 }
 
 // ------------------------------------------------------------------------------------------------
-void BaseProcess::ExecuteOnScene(Importer *pImp) {
+void BaseProcess::ExecuteOnScene(Importer *pImp, bool setupProperties) {
     ai_assert( nullptr != pImp );
     ai_assert( nullptr != pImp->Pimpl()->mScene);
 
     progress = pImp->GetProgressHandler();
     ai_assert(nullptr != progress);
 
-    SetupProperties(pImp);
+    scheduler = pImp->Pimpl()->mTaskScheduler;
+
+    if (setupProperties) {
+        SetupProperties(pImp);
+    }
 
     // catch exceptions thrown inside the PostProcess-Step
     try {
+        ImportLimits::CheckDeadline();
         Execute(pImp->Pimpl()->mScene);
 
     } catch (const std::exception &err) {
 
         // extract error description
         pImp->Pimpl()->mErrorString = err.what();
+        pImp->Pimpl()->mException = std::current_exception();
         ASSIMP_LOG_ERROR(pImp->Pimpl()->mErrorString);
 
         // and kill the partially imported data
@@ -89,6 +108,83 @@ void BaseProcess::ExecuteOnScene(Importer *pImp) {
     }
 }
 
+// ------------------------------------------------------------------------------------------------
+void BaseProcess::ExecuteFusedOnScene(Importer *pImp, const std::vector<BaseProcess *> &steps,
+        std::vector<double> *timings) {
+    ai_assert( nullptr != pImp );
+    ai_assert( nullptr != pImp->Pimpl()->mScene);
+
+    typedef std::chrono::steady_clock Clock;
+    std::unique_ptr<std::atomic<Clock::rep>[]> ticks;
+    if (timings) {
+        ticks.reset(new std::atomic<Clock::rep>[steps.size()]);
+        for (size_t s = 0; s < steps.size(); ++s) {
+            ticks[s] = 0;
+        }
+    }
+
+    aiScene *scene = pImp->Pimpl()->mScene;
+    for (BaseProcess *step : steps) {
+        ai_assert(step->SupportsMeshPass());
+        step->progress = pImp->GetProgressHandler();
+        step->scheduler = pImp->Pimpl()->mTaskScheduler;
+    }
+
+    // catch exceptions thrown inside the PostProcess-Steps
+    try {
+        ImportLimits::CheckDeadline();
+        for (size_t s = 0; s < steps.size(); ++s) {
+            if (!ticks) {
+                steps[s]->BeginMeshPass(scene);
+                continue;
+            }
+            const Clock::time_point start = Clock::now();
+            steps[s]->BeginMeshPass(scene);
+            ticks[s] += (Clock::now() - start).count();
+        }
+
+        steps.front()->ParallelFor(scene->mNumMeshes, [&](unsigned int meshIndex) {
+            ImportLimits::CheckDeadline();
+            for (size_t s = 0; s < steps.size(); ++s) {
+                if (!ticks) {
+                    steps[s]->ExecuteMeshPass(scene, meshIndex);
+                    continue;
+                }
+                const Clock::time_point start = Clock::now();
+                steps[s]->ExecuteMeshPass(scene, meshIndex);
+                ticks[s] += (Clock::now() - start).count();
+            }
+        });
+
+        for (size_t s = 0; s < steps.size(); ++s) {
+            if (!ticks) {
+                steps[s]->EndMeshPass(scene);
+                continue;
+            }
+            const Clock::time_point start = Clock::now();
+            steps[s]->EndMeshPass(scene);
+            ticks[s] += (Clock::now() - start).count();
+        }
+    } catch (const std::exception &err) {
+
+        // extract error description
+        pImp->Pimpl()->mErrorString = err.what();
+        pImp->Pimpl()->mException = std::current_exception();
+        ASSIMP_LOG_ERROR(pImp->Pimpl()->mErrorString);
+
+        // and kill the partially imported data
+        delete pImp->Pimpl()->mScene;
+        pImp->Pimpl()->mScene = nullptr;
+    }
+
+    if (timings) {
+        timings->resize(steps.size());
+        for (size_t s = 0; s < steps.size(); ++s) {
+            (*timings)[s] = std::chrono::duration<double>(Clock::duration(ticks[s])).count();
+        }
+    }
+}
+
 // ------------------------------------------------------------------------------------------------
 void BaseProcess::SetupProperties(const Importer * /*pImp*/) {
     // the default implementation does nothing
@@ -98,3 +194,70 @@ void BaseProcess::SetupProperties(const Importer * /*pImp*/) {
 bool BaseProcess::RequireVerboseFormat() const {
     return true;
 }
+
+// ------------------------------------------------------------------------------------------------
+void BaseProcess::ParallelFor(unsigned int count, const std::function<void(unsigned int)> &func) {
+    if (nullptr == scheduler) {
+        for (unsigned int i = 0; i < count; ++i) {
+            func(i);
+        }
+        return;
+    }
+
+    scheduler->ParallelFor(count, [&func](size_t i) {
+        func(static_cast<unsigned int>(i));
+    });
+}
+
+// ------------------------------------------------------------------------------------------------
+void BaseProcess::ExecuteMeshPasses(aiScene *pScene) {
+    BeginMeshPass(pScene);
+    ParallelFor(pScene->mNumMeshes, [this, pScene](unsigned int meshIndex) {
+        ImportLimits::CheckDeadline();
+        ExecuteMeshPass(pScene, meshIndex);
+    });
+    EndMeshPass(pScene);
+}
+
+// ------------------------------------------------------------------------------------------------
+bool BaseProcess::SupportsMeshPass() const {
+    return false;
+}
+
+// ------------------------------------------------------------------------------------------------
+void BaseProcess::BeginMeshPass(aiScene * /*pScene*/) {
+    // the default implementation does nothing
+}
+
+// ------------------------------------------------------------------------------------------------
+void BaseProcess::ExecuteMeshPass(aiScene * /*pScene*/, unsigned int /*meshIndex*/) {
+    // the default implementation does nothing
+}
+
+// ------------------------------------------------------------------------------------------------
+void BaseProcess::EndMeshPass(aiScene * /*pScene*/) {
+    // the default implementation does nothing
+}
+
+// ------------------------------------------------------------------------------------------------
+std::string BaseProcess::GetName() const {
+    std::string name = typeid(*this).name();
+#if defined(__GNUC__)
+    int status = -1;
+    char *demangled = abi::__cxa_demangle(name.c_str(), nullptr, nullptr, &status);
+    if (0 == status && nullptr != demangled) {
+        name = demangled;
+    }
+    ::free(demangled);
+#endif
+    // MSVC prefixes the name with 'class '
+    const std::string::size_type space = name.rfind(' ');
+    if (std::string::npos != space) {
+        name = name.substr(space + 1);
+    }
+    const std::string::size_type scope = name.rfind("::");
+    if (std::string::npos != scope) {
+        name = name.substr(scope + 2);
+    }
+    return name;
+}
@@ -45,13 +45,17 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <assimp/GenericProperty.h>
 
+#include <functional>
 #include <map>
+#include <string>
+#include <vector>
 
 struct aiScene;
 
 namespace Assimp {
 
 class Importer;
+class TaskScheduler;
 
 // ---------------------------------------------------------------------------
 /** Helper class to allow post-processing steps to interact with each other.
@@ -204,8 +208,25 @@ public:
     * The function deletes the scene if the postprocess step fails (
     * the object pointer will be set to nullptr).
     * @param pImp Importer instance (pImp->mScene must be valid)
+    * @param setupProperties false if SetupProperties() was already called
+    *   by the caller for this run
     */
-    void ExecuteOnScene(Importer *pImp);
+    void ExecuteOnScene(Importer *pImp, bool setupProperties = true);
+
+    // -------------------------------------------------------------------
+    /** Executes several post processing steps fused into a single pass
+    * over the meshes. All steps must return true for SupportsMeshPass().
+    * The BeginMeshPass() functions are called in order, then each mesh
+    * runs through ExecuteMeshPass() of all steps back to back while its
+    * data is still in cache, and finally the EndMeshPass() functions are
+    * called in order. The scene is deleted if one of the steps fails.
+    * @param pImp Importer instance (pImp->mScene must be valid)
+    * @param steps Steps to run, SetupProperties() must have been called
+    * @param timings Receives the seconds spent per step, summed up over
+    *   all threads. May be nullptr.
+    */
+    static void ExecuteFusedOnScene(Importer *pImp, const std::vector<BaseProcess *> &steps,
+            std::vector<double> *timings);
 
     // -------------------------------------------------------------------
     /** Called prior to ExecuteOnScene().
@@ -222,6 +243,40 @@ public:
     */
     virtual void Execute(aiScene *pScene) = 0;
 
+    // -------------------------------------------------------------------
+    /** Check whether the step can be executed one mesh at a time using
+    * BeginMeshPass(), ExecuteMeshPass() and EndMeshPass(). Consecutive
+    * steps supporting this are fused by the Importer. Steps which add or
+    * remove meshes must return false. Called after SetupProperties().
+    */
+    virtual bool SupportsMeshPass() const;
+
+    // -------------------------------------------------------------------
+    /** Scene-wide preparations for ExecuteMeshPass(). Must not depend on
+    * the results of the previous steps' mesh passes.
+    * @param pScene The imported data to work at.
+    */
+    virtual void BeginMeshPass(aiScene *pScene);
+
+    // -------------------------------------------------------------------
+    /** Processes a single mesh. Calls for different meshes may run
+    * concurrently, results must be stored per mesh.
+    * @param pScene The imported data to work at.
+    * @param meshIndex Index of the mesh to process.
+    */
+    virtual void ExecuteMeshPass(aiScene *pScene, unsigned int meshIndex);
+
+    // -------------------------------------------------------------------
+    /** Combines the per-mesh results after all meshes have been processed.
+    * @param pScene The imported data to work at.
+    */
+    virtual void EndMeshPass(aiScene *pScene);
+
+    // -------------------------------------------------------------------
+    /** Get a human-readable name of the step, i.e. its class name.
+    */
+    std::string GetName() const;
+
     // -------------------------------------------------------------------
     /** Assign a new SharedPostProcessInfo to the step. This object
      *  allows multiple postprocess steps to share data.
@@ -238,12 +293,42 @@ public:
         return shared;
     }
 
+    // -------------------------------------------------------------------
+    /** Assign the scheduler used by ParallelFor(). ExecuteOnScene()
+     *  sets the Importer's scheduler automatically.
+     * @param sched May be nullptr to run everything serially
+    */
+    inline void SetTaskScheduler(TaskScheduler *sched) {
+        scheduler = sched;
+    }
+
 protected:
+    // -------------------------------------------------------------------
+    /** Calls func(i) for all i in [0, count), in parallel if a scheduler
+     *  with more than one thread is assigned. Per-index results must be
+     *  stored in per-index slots and combined afterwards so the output
+     *  does not depend on the number of threads.
+     * @param count Number of work items, usually pScene->mNumMeshes
+     * @param func Function to call per item
+    */
+    void ParallelFor(unsigned int count, const std::function<void(unsigned int)> &func);
+
+    // -------------------------------------------------------------------
+    /** Runs BeginMeshPass(), ExecuteMeshPass() for all meshes and
+     *  EndMeshPass(). Execute() of steps supporting mesh passes should
+     *  simply call this function.
+     * @param pScene The imported data to work at.
+    */
+    void ExecuteMeshPasses(aiScene *pScene);
+
     /** See the doc of #SharedPostProcessInfo for more details */
     SharedPostProcessInfo *shared;
 
     /** Currently active progress handler */
     ProgressHandler *progress;
+
+    /** Scheduler for the per-mesh work, may be nullptr */
+    TaskScheduler *scheduler;
 };
 
 } // end of namespace Assimp
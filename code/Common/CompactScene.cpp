@@ -0,0 +1,642 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2021, assimp team
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+/** @file Implementation of the interned string table and the CompactScene
+ */
+
+#include <assimp/CompactScene.h>
+#include <assimp/Hash.h>
+#include <assimp/SceneCombiner.h>
+#include <assimp/scene.h>
+
+#include <algorithm>
+#include <cstring>
+#include <unordered_map>
+
+using namespace Assimp;
+
+namespace {
+
+// SuperFastHash takes a length of 0 as zero-terminated string
+inline size_t HashString(const char *str, size_t length) {
+    return length ? SuperFastHash(str, static_cast<uint32_t>(length)) : 0;
+}
+
+template <typename T>
+T *CopyArray(const T *src, unsigned int num) {
+    if (!src || !num) {
+        return nullptr;
+    }
+    T *dest = new T[num];
+    ::memcpy(static_cast<void *>(dest), src, sizeof(T) * num);
+    return dest;
+}
+
+template <typename T>
+size_t VectorBytes(const std::vector<T> &v) {
+    return v.capacity() * sizeof(T);
+}
+
+} // namespace
+
+const StringTable::Id StringTable::EmptyId;
+const StringTable::Id StringTable::InvalidId;
+const unsigned int CompactScene::None;
+
+// ------------------------------------------------------------------------------------------------
+StringTable::StringTable() :
+        mChars(1, '\0'),
+        mOffsets(),
+        mBuckets(16, InvalidId) {
+    mOffsets.push_back(0);
+    mOffsets.push_back(1);
+    mBuckets[0] = EmptyId;
+}
+
+// ------------------------------------------------------------------------------------------------
+StringTable::Id StringTable::Find(const char *str, size_t length) const {
+    const size_t mask = mBuckets.size() - 1;
+    for (size_t b = HashString(str, length) & mask;; b = (b + 1) & mask) {
+        const Id id = mBuckets[b];
+        if (InvalidId == id) {
+            return InvalidId;
+        }
+        if (GetLength(id) == length && 0 == ::memcmp(GetString(id), str, length)) {
+            return id;
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+StringTable::Id StringTable::Intern(const char *str, size_t length) {
+    const size_t mask = mBuckets.size() - 1;
+    size_t b = HashString(str, length) & mask;
+    for (; InvalidId != mBuckets[b]; b = (b + 1) & mask) {
+        const Id id = mBuckets[b];
+        if (GetLength(id) == length && 0 == ::memcmp(GetString(id), str, length)) {
+            return id;
+        }
+    }
+
+    const Id id = GetNumStrings();
+    mChars.insert(mChars.end(), str, str + length);
+    mChars.push_back('\0');
+    mOffsets.push_back(static_cast<unsigned int>(mChars.size()));
+    mBuckets[b] = id;
+
+    // keep the load factor below 1/2
+    if (GetNumStrings() * 2 > mBuckets.size()) {
+        Grow();
+    }
+    return id;
+}
+
+// ------------------------------------------------------------------------------------------------
+void StringTable::Grow() {
+    std::vector<Id> buckets(mBuckets.size() * 2, InvalidId);
+    const size_t mask = buckets.size() - 1;
+    for (Id id = 0; id < GetNumStrings(); ++id) {
+        size_t b = HashString(GetString(id), GetLength(id)) & mask;
+        while (InvalidId != buckets[b]) {
+            b = (b + 1) & mask;
+        }
+        buckets[b] = id;
+    }
+    mBuckets.swap(buckets);
+}
+
+// ------------------------------------------------------------------------------------------------
+aiString StringTable::ToString(Id id) const {
+    aiString str;
+    const unsigned int length = std::min(GetLength(id), static_cast<unsigned int>(MAXLEN - 1));
+    str.length = static_cast<ai_uint32>(length);
+    ::memcpy(str.data, GetString(id), length);
+    str.data[length] = '\0';
+    return str;
+}
+
+// ------------------------------------------------------------------------------------------------
+size_t StringTable::GetMemoryFootprint() const {
+    return VectorBytes(mChars) + VectorBytes(mOffsets) + VectorBytes(mBuckets);
+}
+
+// ------------------------------------------------------------------------------------------------
+CompactScene::CompactScene(aiScene *scene) :
+        mStrings(),
+        mNodes(),
+        mNodeMeshes(),
+        mBones(),
+        mMeshBones(1, 0),
+        mChannels(),
+        mAnimationChannels(1, 0),
+        mProperties(),
+        mMaterialProperties(1, 0),
+        mMetadataEntries(),
+        mMetadata(1, 0),
+        mMetadataVectors(),
+        mScene(scene) {
+    ai_assert(nullptr != scene);
+
+    // nodes in breadth-first order, the children of each node are appended
+    // when the node itself is visited
+    std::vector<const aiNode *> order;
+    std::unordered_map<const aiNode *, unsigned int> nodeIndices;
+    if (scene->mRootNode) {
+        order.push_back(scene->mRootNode);
+        nodeIndices[scene->mRootNode] = 0;
+    }
+    for (size_t i = 0; i < order.size(); ++i) {
+        const aiNode *src = order[i];
+
+        Node node;
+        node.mName = mStrings.Intern(src->mName);
+        node.mParent = None;
+        node.mFirstChild = static_cast<unsigned int>(order.size());
+        node.mNumChildren = src->mNumChildren;
+        node.mFirstMesh = static_cast<unsigned int>(mNodeMeshes.size());
+        node.mNumMeshes = src->mNumMeshes;
+        node.mMetadata = AddMetadata(src->mMetaData);
+        node.mTransformation = src->mTransformation;
+        if (src->mParent) {
+            std::unordered_map<const aiNode *, unsigned int>::const_iterator it = nodeIndices.find(src->mParent);
+            if (it != nodeIndices.end()) {
+                node.mParent = it->second;
+            }
+        }
+        mNodes.push_back(node);
+
+        mNodeMeshes.insert(mNodeMeshes.end(), src->mMeshes, src->mMeshes + src->mNumMeshes);
+        for (unsigned int c = 0; c < src->mNumChildren; ++c) {
+            nodeIndices[src->mChildren[c]] = static_cast<unsigned int>(order.size());
+            order.push_back(src->mChildren[c]);
+        }
+    }
+
+    auto findNode = [&nodeIndices](const aiNode *node) {
+        std::unordered_map<const aiNode *, unsigned int>::const_iterator it = nodeIndices.find(node);
+        return it != nodeIndices.end() ? it->second : None;
+    };
+
+    // bones, their weights are taken over
+    for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+        aiMesh *mesh = scene->mMeshes[i];
+        for (unsigned int b = 0; b < mesh->mNumBones; ++b) {
+            aiBone *src = mesh->mBones[b];
+
+            Bone bone;
+            bone.mName = mStrings.Intern(src->mName);
+            bone.mNode = findNode(src->mNode);
+            bone.mArmature = findNode(src->mArmature);
+            bone.mNumWeights = src->mNumWeights;
+            bone.mWeights = src->mWeights;
+            bone.mOffsetMatrix = src->mOffsetMatrix;
+            mBones.push_back(bone);
+
+            src->mWeights = nullptr;
+            delete src;
+        }
+        FreeSceneArray(mesh->mBones);
+        mesh->mBones = nullptr;
+        mesh->mNumBones = 0;
+        mMeshBones.push_back(static_cast<unsigned int>(mBones.size()));
+    }
+
+    // node channels, their keys are taken over
+    for (unsigned int i = 0; i < scene->mNumAnimations; ++i) {
+        aiAnimation *anim = scene->mAnimations[i];
+        for (unsigned int c = 0; c < anim->mNumChannels; ++c) {
+            aiNodeAnim *src = anim->mChannels[c];
+
+            NodeAnim channel;
+            channel.mNodeName = mStrings.Intern(src->mNodeName);
+            channel.mPreState = src->mPreState;
+            channel.mPostState = src->mPostState;
+            channel.mNumPositionKeys = src->mNumPositionKeys;
+            channel.mNumRotationKeys = src->mNumRotationKeys;
+            channel.mNumScalingKeys = src->mNumScalingKeys;
+            channel.mPositionKeys = src->mPositionKeys;
+            channel.mRotationKeys = src->mRotationKeys;
+            channel.mScalingKeys = src->mScalingKeys;
+            mChannels.push_back(channel);
+
+            src->mPositionKeys = nullptr;
+            src->mRotationKeys = nullptr;
+            src->mScalingKeys = nullptr;
+            delete src;
+        }
+        FreeSceneArray(anim->mChannels);
+        anim->mChannels = nullptr;
+        anim->mNumChannels = 0;
+        mAnimationChannels.push_back(static_cast<unsigned int>(mChannels.size()));
+    }
+
+    // material properties, their data is taken over
+    for (unsigned int i = 0; i < scene->mNumMaterials; ++i) {
+        aiMaterial *mat = scene->mMaterials[i];
+        for (unsigned int p = 0; p < mat->mNumProperties; ++p) {
+            aiMaterialProperty *src = mat->mProperties[p];
+
+            MaterialProperty prop;
+            prop.mKey = mStrings.Intern(src->mKey);
+            prop.mSemantic = src->mSemantic;
+            prop.mIndex = src->mIndex;
+            prop.mDataLength = src->mDataLength;
+            prop.mType = src->mType;
+            prop.mData = src->mData;
+            mProperties.push_back(prop);
+
+            src->mData = nullptr;
+        }
+        delete mat;
+        mMaterialProperties.push_back(static_cast<unsigned int>(mProperties.size()));
+    }
+    FreeSceneArray(scene->mMaterials);
+    scene->mMaterials = nullptr;
+    scene->mNumMaterials = 0;
+
+    delete scene->mRootNode;
+    scene->mRootNode = nullptr;
+
+    // the records are meant to be kept around, drop the slack
+    mNodes.shrink_to_fit();
+    mNodeMeshes.shrink_to_fit();
+    mBones.shrink_to_fit();
+    mChannels.shrink_to_fit();
+    mProperties.shrink_to_fit();
+    mMetadataEntries.shrink_to_fit();
+    mMetadataVectors.shrink_to_fit();
+}
+
+// ------------------------------------------------------------------------------------------------
+CompactScene::~CompactScene() {
+    for (Bone &bone : mBones) {
+        delete[] bone.mWeights;
+    }
+    for (NodeAnim &channel : mChannels) {
+        delete[] channel.mPositionKeys;
+        delete[] channel.mRotationKeys;
+        delete[] channel.mScalingKeys;
+    }
+    for (MaterialProperty &prop : mProperties) {
+        FreeSceneArray(prop.mData);
+    }
+    delete mScene;
+}
+
+// ------------------------------------------------------------------------------------------------
+unsigned int CompactScene::AddMetadata(const aiMetadata *metadata) {
+    if (nullptr == metadata || 0 == metadata->mNumProperties) {
+        return None;
+    }
+
+    // reserve the entries first so nested blocks end up behind them
+    const size_t first = mMetadataEntries.size();
+    mMetadataEntries.resize(first + metadata->mNumProperties);
+    mMetadata.push_back(static_cast<unsigned int>(mMetadataEntries.size()));
+    const unsigned int block = static_cast<unsigned int>(mMetadata.size() - 2);
+
+    for (unsigned int i = 0; i < metadata->mNumProperties; ++i) {
+        const aiMetadataEntry &src = metadata->mValues[i];
+
+        MetadataEntry entry;
+        entry.mKey = mStrings.Intern(metadata->mKeys[i]);
+        entry.mType = src.mType;
+        entry.mValue = 0;
+        if (src.mData) {
+            switch (src.mType) {
+            case AI_BOOL:
+                entry.mValue = *static_cast<const bool *>(src.mData) ? 1 : 0;
+                break;
+            case AI_INT32:
+                ::memcpy(&entry.mValue, src.mData, sizeof(int32_t));
+                break;
+            case AI_UINT64:
+                ::memcpy(&entry.mValue, src.mData, sizeof(uint64_t));
+                break;
+            case AI_FLOAT:
+                ::memcpy(&entry.mValue, src.mData, sizeof(float));
+                break;
+            case AI_DOUBLE:
+                ::memcpy(&entry.mValue, src.mData, sizeof(double));
+                break;
+            case AI_AISTRING:
+                entry.mValue = mStrings.Intern(*static_cast<const aiString *>(src.mData));
+                break;
+            case AI_AIVECTOR3D:
+                entry.mValue = mMetadataVectors.size();
+                mMetadataVectors.push_back(*static_cast<const aiVector3D *>(src.mData));
+                break;
+            case AI_AIMETADATA:
+                entry.mValue = AddMetadata(static_cast<const aiMetadata *>(src.mData));
+                break;
+            default:
+                entry.mType = AI_META_MAX;
+                break;
+            }
+        } else {
+            entry.mType = AI_META_MAX;
+        }
+        mMetadataEntries[first + i] = entry;
+    }
+    return block;
+}
+
+// ------------------------------------------------------------------------------------------------
+aiMetadata *CompactScene::CreateMetadata(unsigned int block) const {
+    if (None == block) {
+        return nullptr;
+    }
+
+    const unsigned int first = mMetadata[block];
+    const unsigned int num = mMetadata[block + 1] - first;
+    aiMetadata *metadata = aiMetadata::Alloc(num);
+    for (unsigned int i = 0; i < num; ++i) {
+        const MetadataEntry &entry = mMetadataEntries[first + i];
+        metadata->mKeys[i] = mStrings.ToString(entry.mKey);
+
+        aiMetadataEntry &dest = metadata->mValues[i];
+        dest.mType = entry.mType;
+        switch (entry.mType) {
+        case AI_BOOL:
+            dest.mData = AllocateSceneObject<bool>(0 != entry.mValue);
+            break;
+        case AI_INT32: {
+            int32_t v;
+            ::memcpy(&v, &entry.mValue, sizeof(int32_t));
+            dest.mData = AllocateSceneObject<int32_t>(v);
+        } break;
+        case AI_UINT64:
+            dest.mData = AllocateSceneObject<uint64_t>(entry.mValue);
+            break;
+        case AI_FLOAT: {
+            float v;
+            ::memcpy(&v, &entry.mValue, sizeof(float));
+            dest.mData = AllocateSceneObject<float>(v);
+        } break;
+        case AI_DOUBLE: {
+            double v;
+            ::memcpy(&v, &entry.mValue, sizeof(double));
+            dest.mData = AllocateSceneObject<double>(v);
+        } break;
+        case AI_AISTRING:
+            dest.mData = AllocateSceneObject<aiString>(mStrings.ToString(static_cast<Id>(entry.mValue)));
+            break;
+        case AI_AIVECTOR3D:
+            dest.mData = AllocateSceneObject<aiVector3D>(mMetadataVectors[static_cast<size_t>(entry.mValue)]);
+            break;
+        case AI_AIMETADATA: {
+            // an empty nested block was dropped by AddMetadata
+            aiMetadata *nested = CreateMetadata(static_cast<unsigned int>(entry.mValue));
+            dest.mData = nested ? nested : new aiMetadata();
+        } break;
+        default:
+            dest.mData = nullptr;
+            break;
+        }
+    }
+    return metadata;
+}
+
+// ------------------------------------------------------------------------------------------------
+unsigned int CompactScene::FindNode(const char *name) const {
+    const Id id = mStrings.Find(name, ::strlen(name));
+    if (StringTable::InvalidId == id) {
+        return None;
+    }
+    for (unsigned int i = 0; i < GetNumNodes(); ++i) {
+        if (mNodes[i].mName == id) {
+            return i;
+        }
+    }
+    return None;
+}
+
+// ------------------------------------------------------------------------------------------------
+aiMetadata *CompactScene::CreateNodeMetadata(unsigned int node) const {
+    return CreateMetadata(mNodes[node].mMetadata);
+}
+
+// ------------------------------------------------------------------------------------------------
+unsigned int CompactScene::GetNumMeshes() const {
+    return mScene->mNumMeshes;
+}
+
+// ------------------------------------------------------------------------------------------------
+const aiMesh *CompactScene::GetMesh(unsigned int mesh) const {
+    return mScene->mMeshes[mesh];
+}
+
+// ------------------------------------------------------------------------------------------------
+unsigned int CompactScene::GetNumAnimations() const {
+    return mScene->mNumAnimations;
+}
+
+// ------------------------------------------------------------------------------------------------
+const aiAnimation *CompactScene::GetAnimation(unsigned int animation) const {
+    return mScene->mAnimations[animation];
+}
+
+// ------------------------------------------------------------------------------------------------
+aiMaterial *CompactScene::CreateMaterial(unsigned int material) const {
+    aiMaterial *mat = new aiMaterial();
+    for (unsigned int p = 0; p < GetNumProperties(material); ++p) {
+        const MaterialProperty &prop = GetProperty(material, p);
+        mat->AddBinaryProperty(prop.mData, prop.mDataLength, mStrings.GetString(prop.mKey),
+                prop.mSemantic, prop.mIndex, prop.mType);
+    }
+    return mat;
+}
+
+// ------------------------------------------------------------------------------------------------
+aiScene *CompactScene::ToScene() const {
+    aiScene *scene = new aiScene();
+    scene->mFlags = mScene->mFlags;
+    scene->mName = mScene->mName;
+    SceneCombiner::Copy(&scene->mMetaData, mScene->mMetaData);
+
+    // nodes
+    std::vector<aiNode *> nodes(mNodes.size());
+    for (size_t i = 0; i < mNodes.size(); ++i) {
+        nodes[i] = new aiNode();
+    }
+    for (size_t i = 0; i < mNodes.size(); ++i) {
+        const Node &src = mNodes[i];
+        aiNode *node = nodes[i];
+        node->mName = mStrings.ToString(src.mName);
+        node->mTransformation = src.mTransformation;
+        node->mParent = None != src.mParent ? nodes[src.mParent] : nullptr;
+        node->mNumChildren = src.mNumChildren;
+        if (src.mNumChildren) {
+            node->mChildren = AllocateSceneArray<aiNode *>(src.mNumChildren);
+            for (unsigned int c = 0; c < src.mNumChildren; ++c) {
+                node->mChildren[c] = nodes[src.mFirstChild + c];
+            }
+        }
+        node->mNumMeshes = src.mNumMeshes;
+        if (src.mNumMeshes) {
+            node->mMeshes = AllocateSceneArray<unsigned int>(src.mNumMeshes);
+            ::memcpy(node->mMeshes, mNodeMeshes.data() + src.mFirstMesh, sizeof(unsigned int) * src.mNumMeshes);
+        }
+        node->mMetaData = CreateMetadata(src.mMetadata);
+    }
+    scene->mRootNode = nodes.empty() ? nullptr : nodes[0];
+
+    // meshes and their bones
+    if (mScene->mNumMeshes) {
+        scene->mNumMeshes = mScene->mNumMeshes;
+        scene->mMeshes = AllocateSceneArray<aiMesh *>(scene->mNumMeshes);
+        for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+            aiMesh *mesh = nullptr;
+            SceneCombiner::Copy(&mesh, mScene->mMeshes[i]);
+            scene->mMeshes[i] = mesh;
+
+            mesh->mNumBones = GetNumBones(i);
+            if (mesh->mNumBones) {
+                mesh->mBones = AllocateSceneArray<aiBone *>(mesh->mNumBones);
+            }
+            for (unsigned int b = 0; b < mesh->mNumBones; ++b) {
+                const Bone &src = GetBone(i, b);
+                aiBone *bone = mesh->mBones[b] = new aiBone();
+                bone->mName = mStrings.ToString(src.mName);
+                bone->mNode = None != src.mNode ? nodes[src.mNode] : nullptr;
+                bone->mArmature = None != src.mArmature ? nodes[src.mArmature] : nullptr;
+                bone->mNumWeights = src.mNumWeights;
+                bone->mWeights = CopyArray(src.mWeights, src.mNumWeights);
+                bone->mOffsetMatrix = src.mOffsetMatrix;
+            }
+        }
+    }
+
+    // materials
+    if (GetNumMaterials()) {
+        scene->mNumMaterials = GetNumMaterials();
+        scene->mMaterials = AllocateSceneArray<aiMaterial *>(scene->mNumMaterials);
+        for (unsigned int i = 0; i < scene->mNumMaterials; ++i) {
+            scene->mMaterials[i] = CreateMaterial(i);
+        }
+    }
+
+    // animations and their channels
+    if (mScene->mNumAnimations) {
+        scene->mNumAnimations = mScene->mNumAnimations;
+        scene->mAnimations = AllocateSceneArray<aiAnimation *>(scene->mNumAnimations);
+        for (unsigned int i = 0; i < scene->mNumAnimations; ++i) {
+            const aiAnimation *src = mScene->mAnimations[i];
+            aiAnimation *anim = scene->mAnimations[i] = new aiAnimation();
+            anim->mName = src->mName;
+            anim->mDuration = src->mDuration;
+            anim->mTicksPerSecond = src->mTicksPerSecond;
+
+            anim->mNumChannels = GetNumChannels(i);
+            if (anim->mNumChannels) {
+                anim->mChannels = AllocateSceneArray<aiNodeAnim *>(anim->mNumChannels);
+            }
+            for (unsigned int c = 0; c < anim->mNumChannels; ++c) {
+                const NodeAnim &channel = GetChannel(i, c);
+                aiNodeAnim *dest = anim->mChannels[c] = new aiNodeAnim();
+                dest->mNodeName = mStrings.ToString(channel.mNodeName);
+                dest->mPreState = channel.mPreState;
+                dest->mPostState = channel.mPostState;
+                dest->mNumPositionKeys = channel.mNumPositionKeys;
+                dest->mNumRotationKeys = channel.mNumRotationKeys;
+                dest->mNumScalingKeys = channel.mNumScalingKeys;
+                dest->mPositionKeys = CopyArray(channel.mPositionKeys, channel.mNumPositionKeys);
+                dest->mRotationKeys = CopyArray(channel.mRotationKeys, channel.mNumRotationKeys);
+                dest->mScalingKeys = CopyArray(channel.mScalingKeys, channel.mNumScalingKeys);
+            }
+
+            if (src->mNumMeshChannels) {
+                anim->mNumMeshChannels = src->mNumMeshChannels;
+                anim->mMeshChannels = AllocateSceneArray<aiMeshAnim *>(anim->mNumMeshChannels);
+                for (unsigned int c = 0; c < anim->mNumMeshChannels; ++c) {
+                    const aiMeshAnim *channel = src->mMeshChannels[c];
+                    aiMeshAnim *dest = anim->mMeshChannels[c] = new aiMeshAnim();
+                    dest->mName = channel->mName;
+                    dest->mNumKeys = channel->mNumKeys;
+                    dest->mKeys = CopyArray(channel->mKeys, channel->mNumKeys);
+                }
+            }
+
+            if (src->mNumMorphMeshChannels) {
+                anim->mNumMorphMeshChannels = src->mNumMorphMeshChannels;
+                anim->mMorphMeshChannels = AllocateSceneArray<aiMeshMorphAnim *>(anim->mNumMorphMeshChannels);
+                for (unsigned int c = 0; c < anim->mNumMorphMeshChannels; ++c) {
+                    SceneCombiner::Copy(&anim->mMorphMeshChannels[c], src->mMorphMeshChannels[c]);
+                }
+            }
+        }
+    }
+
+    // everything else is copied as it is
+    if (mScene->mNumTextures) {
+        scene->mNumTextures = mScene->mNumTextures;
+        scene->mTextures = AllocateSceneArray<aiTexture *>(scene->mNumTextures);
+        for (unsigned int i = 0; i < scene->mNumTextures; ++i) {
+            SceneCombiner::Copy(&scene->mTextures[i], mScene->mTextures[i]);
+        }
+    }
+    if (mScene->mNumLights) {
+        scene->mNumLights = mScene->mNumLights;
+        scene->mLights = AllocateSceneArray<aiLight *>(scene->mNumLights);
+        for (unsigned int i = 0; i < scene->mNumLights; ++i) {
+            SceneCombiner::Copy(&scene->mLights[i], mScene->mLights[i]);
+        }
+    }
+    if (mScene->mNumCameras) {
+        scene->mNumCameras = mScene->mNumCameras;
+        scene->mCameras = AllocateSceneArray<aiCamera *>(scene->mNumCameras);
+        for (unsigned int i = 0; i < scene->mNumCameras; ++i) {
+            SceneCombiner::Copy(&scene->mCameras[i], mScene->mCameras[i]);
+        }
+    }
+    return scene;
+}
+
+// ------------------------------------------------------------------------------------------------
+size_t CompactScene::GetMemoryFootprint() const {
+    return sizeof(*this) + mStrings.GetMemoryFootprint() +
+           VectorBytes(mNodes) + VectorBytes(mNodeMeshes) +
+           VectorBytes(mBones) + VectorBytes(mMeshBones) +
+           VectorBytes(mChannels) + VectorBytes(mAnimationChannels) +
+           VectorBytes(mProperties) + VectorBytes(mMaterialProperties) +
+           VectorBytes(mMetadataEntries) + VectorBytes(mMetadata) + VectorBytes(mMetadataVectors);
+}
@@ -0,0 +1,250 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2021, assimp team
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file CountingIOSystem.h
+ *  Implements an IOSystem wrapper which counts the bytes read through it.
+ */
+#pragma once
+#ifndef AI_COUNTINGIOSYSTEM_H_INC
+#define AI_COUNTINGIOSYSTEM_H_INC
+
+#include <assimp/IOStream.hpp>
+#include <assimp/IOSystem.hpp>
+#include <assimp/ai_assert.h>
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+namespace Assimp {
+
+// ---------------------------------------------------------------------------
+/** Stream wrapper adding the number of bytes read to a counter. A
+ *  contiguous view counts with the full size of the file, once. The
+ *  counter is shared by all streams of an import, which may be read on
+ *  different threads, e.g. by the read-ahead of an IOStreamBuffer. */
+class CountingIOStream : public IOStream {
+public:
+    CountingIOStream(IOStream *wrapped, std::atomic<size_t> &bytesRead) :
+            mWrapped(wrapped), mBytesRead(bytesRead), mViewCounted(false) {
+        ai_assert(nullptr != mWrapped);
+    }
+
+    /** Returns the wrapped stream. */
+    IOStream *Wrapped() const {
+        return mWrapped;
+    }
+
+    // -------------------------------------------------------------------
+    /** Read from stream */
+    size_t Read(void *pvBuffer, size_t pSize, size_t pCount) override {
+        const size_t read = mWrapped->Read(pvBuffer, pSize, pCount);
+        mBytesRead.fetch_add(read * pSize, std::memory_order_relaxed);
+        return read;
+    }
+
+    // -------------------------------------------------------------------
+    /** Write to stream */
+    size_t Write(const void *pvBuffer, size_t pSize, size_t pCount) override {
+        return mWrapped->Write(pvBuffer, pSize, pCount);
+    }
+
+    // -------------------------------------------------------------------
+    /** Seek specific position */
+    aiReturn Seek(size_t pOffset, aiOrigin pOrigin) override {
+        return mWrapped->Seek(pOffset, pOrigin);
+    }
+
+    // -------------------------------------------------------------------
+    /** Get current seek position */
+    size_t Tell() const override {
+        return mWrapped->Tell();
+    }
+
+    // -------------------------------------------------------------------
+    /** Get size of file */
+    size_t FileSize() const override {
+        return mWrapped->FileSize();
+    }
+
+    // -------------------------------------------------------------------
+    /** Flush file contents */
+    void Flush() override {
+        mWrapped->Flush();
+    }
+
+    // -------------------------------------------------------------------
+    /** Forwards the view of the wrapped stream */
+    const uint8_t *GetContiguousView() const override {
+        const uint8_t *view = mWrapped->GetContiguousView();
+        if (nullptr != view && !mViewCounted.exchange(true)) {
+            mBytesRead.fetch_add(mWrapped->FileSize(), std::memory_order_relaxed);
+        }
+        return view;
+    }
+
+private:
+    IOStream *mWrapped;
+    std::atomic<size_t> &mBytesRead;
+    mutable std::atomic<bool> mViewCounted;
+};
+
+// ---------------------------------------------------------------------------
+/** IOSystem wrapper used by Importer::ReadFile to count the bytes read
+ *  from all files of an import if time measurement is enabled. It also
+ *  records the files an import tried to read, the import cache checks
+ *  them for changes. */
+class CountingIOSystem : public IOSystem {
+public:
+    /** Constructor. */
+    explicit CountingIOSystem(IOSystem *wrapped) :
+            mWrapped(wrapped), mBytesRead(0), mOpenedFiles() {
+        ai_assert(nullptr != mWrapped);
+    }
+
+    /** Returns the number of bytes read so far. */
+    size_t GetBytesRead() const {
+        return mBytesRead.load(std::memory_order_relaxed);
+    }
+
+    /** Returns the paths of all files opened for reading so far, including
+     *  the ones which failed to open. */
+    const std::vector<std::string> &GetOpenedFiles() const {
+        return mOpenedFiles;
+    }
+
+    // -------------------------------------------------------------------
+    /** Tests for the existence of a file at the given path. */
+    bool Exists(const char *pFile) const override {
+        return mWrapped->Exists(pFile);
+    }
+
+    // -------------------------------------------------------------------
+    /** Returns the directory separator. */
+    char getOsSeparator() const override {
+        return mWrapped->getOsSeparator();
+    }
+
+    // -------------------------------------------------------------------
+    /** Open a new file with a given path. */
+    IOStream *Open(const char *pFile, const char *pMode = "rb") override {
+        if (nullptr != pFile && nullptr != pMode && 'r' == pMode[0]) {
+            mOpenedFiles.push_back(pFile);
+        }
+        IOStream *stream = mWrapped->Open(pFile, pMode);
+        return nullptr != stream ? new CountingIOStream(stream, mBytesRead) : nullptr;
+    }
+
+    // -------------------------------------------------------------------
+    /** Closes the given file and releases all resources associated with it. */
+    void Close(IOStream *pFile) override {
+        if (nullptr == pFile) {
+            return;
+        }
+        CountingIOStream *counting = dynamic_cast<CountingIOStream *>(pFile);
+        ai_assert(nullptr != counting);
+
+        mWrapped->Close(counting->Wrapped());
+        delete counting;
+    }
+
+    // -------------------------------------------------------------------
+    /** Compare two paths */
+    bool ComparePaths(const char *one, const char *second) const override {
+        return mWrapped->ComparePaths(one, second);
+    }
+
+    // -------------------------------------------------------------------
+    /** Pushes a new directory onto the directory stack. */
+    bool PushDirectory(const std::string &path) override {
+        return mWrapped->PushDirectory(path);
+    }
+
+    // -------------------------------------------------------------------
+    /** Returns the top directory from the stack. */
+    const std::string &CurrentDirectory() const override {
+        return mWrapped->CurrentDirectory();
+    }
+
+    // -------------------------------------------------------------------
+    /** Returns the number of directories stored on the stack. */
+    size_t StackSize() const override {
+        return mWrapped->StackSize();
+    }
+
+    // -------------------------------------------------------------------
+    /** Pops the top directory from the stack. */
+    bool PopDirectory() override {
+        return mWrapped->PopDirectory();
+    }
+
+    // -------------------------------------------------------------------
+    /** Creates an new directory at the given path. */
+    bool CreateDirectory(const std::string &path) override {
+        return mWrapped->CreateDirectory(path);
+    }
+
+    // -------------------------------------------------------------------
+    /** Will change the current directory to the given path. */
+    bool ChangeDirectory(const std::string &path) override {
+        return mWrapped->ChangeDirectory(path);
+    }
+
+    // -------------------------------------------------------------------
+    /** Delete file. */
+    bool DeleteFile(const std::string &file) override {
+        return mWrapped->DeleteFile(file);
+    }
+
+    // -------------------------------------------------------------------
+    /** Rename file. */
+    bool RenameFile(const std::string &from, const std::string &to) override {
+        return mWrapped->RenameFile(from, to);
+    }
+
+private:
+    IOSystem *mWrapped;
+    std::atomic<size_t> mBytesRead;
+    std::vector<std::string> mOpenedFiles;
+};
+
+} // namespace Assimp
+
+#endif // AI_COUNTINGIOSYSTEM_H_INC
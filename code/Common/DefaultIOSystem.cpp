@@ -196,6 +196,18 @@ bool DefaultIOSystem::ComparePaths(const char *one, const char *second) const {
     return !ASSIMP_stricmp(temp1, temp2);
 }
 
+// ------------------------------------------------------------------------------------------------
+bool DefaultIOSystem::RenameFile(const std::string &from, const std::string &to) {
+    if (from.empty() || to.empty()) {
+        return false;
+    }
+#ifdef _WIN32
+    return 0 != ::MoveFileExW(Utf8ToWide(from.c_str()).c_str(), Utf8ToWide(to.c_str()).c_str(), MOVEFILE_REPLACE_EXISTING);
+#else
+    return 0 == ::rename(from.c_str(), to.c_str());
+#endif
+}
+
 // ------------------------------------------------------------------------------------------------
 std::string DefaultIOSystem::fileName(const std::string &path) {
     std::string ret = path;
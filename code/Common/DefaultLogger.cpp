@@ -58,12 +58,16 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/NullLogger.hpp>
 #include <iostream>
 
-#ifndef ASSIMP_BUILD_SINGLETHREADED
 #include <mutex>
+#ifndef ASSIMP_BUILD_SINGLETHREADED
 #include <thread>
 std::mutex loggerMutex;
 #endif
 
+// Post-processing steps may log from several threads at once, so writing
+// to the streams is always serialized.
+static std::mutex streamMutex;
+
 namespace Assimp {
 
 // ----------------------------------------------------------------------------------
@@ -387,6 +391,8 @@ DefaultLogger::~DefaultLogger() {
 void DefaultLogger::WriteToStreams(const char *message, ErrorSeverity ErrorSev) {
     ai_assert(nullptr != message);
 
+    std::lock_guard<std::mutex> lock(streamMutex);
+
     // Check whether this is a repeated message
     if (!::strncmp(message, lastMsg, lastLen - 1)) {
         if (!noRepeatMsg) {
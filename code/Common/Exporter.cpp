@@ -64,6 +64,7 @@ Here we implement only the C++ interface (Assimp::Exporter).
 #include "Common/DefaultProgressHandler.h"
 #include "Common/BaseProcess.h"
 #include "Common/ScenePrivate.h"
+#include "Common/TaskScheduler.h"
 #include "PostProcessing/CalcTangentsProcess.h"
 #include "PostProcessing/MakeVerboseFormat.h"
 #include "PostProcessing/JoinVerticesProcess.h"
@@ -243,7 +244,8 @@ public:
     , mIsDefaultProgressHandler( true )
     , mPostProcessingSteps()
     , mError()
-    , mExporters() {
+    , mExporters()
+    , mTaskScheduler() {
         GetPostProcessingStepInstanceList(mPostProcessingSteps);
 
         // grab all built-in exporters
@@ -277,6 +279,24 @@ public:
 
     /** Exporters, this includes those registered using #Assimp::Exporter::RegisterExporter */
     std::vector<Exporter::ExportFormatEntry> mExporters;
+
+    /** Threads to copy the scene on, kept across exports,
+     *  see #AI_CONFIG_GLOB_MULTITHREADING */
+    std::unique_ptr<TaskScheduler> mTaskScheduler;
+
+    /** Get the scheduler for the given properties, nullptr to copy
+     *  the scene on the calling thread */
+    TaskScheduler *GetTaskScheduler(const ExportProperties *pProperties) {
+        const int setting = pProperties ? pProperties->GetPropertyInteger(AI_CONFIG_GLOB_MULTITHREADING, 0) : 0;
+        const unsigned int numThreads = TaskScheduler::GetNumThreadsForSetting(setting);
+        if (numThreads < 2) {
+            return nullptr;
+        }
+        if (!mTaskScheduler || mTaskScheduler->GetNumThreads() != numThreads) {
+            mTaskScheduler.reset(new TaskScheduler(numThreads));
+        }
+        return mTaskScheduler.get();
+    }
 };
 
 } // end of namespace Assimp
@@ -379,10 +399,11 @@ aiReturn Exporter::Export( const aiScene* pScene, const char* pFormatId, const c
         const Exporter::ExportFormatEntry& exp = pimpl->mExporters[i];
         if (!strcmp(exp.mDescription.id,pFormatId)) {
             try {
-                // Always create a full copy of the scene. We might optimize this one day,
-                // but for now it is the most pragmatic way.
+                // Always create a copy of the scene. The meshes borrow the vertex and face
+                // arrays of the source until a post processing step needs to modify them.
+                TaskScheduler *scheduler = pimpl->GetTaskScheduler(pProperties);
                 aiScene* scenecopy_tmp = nullptr;
-                SceneCombiner::CopyScene(&scenecopy_tmp,pScene);
+                SceneCombiner::CopyScene(&scenecopy_tmp,pScene,true,AI_INT_COPY_SCENE_SHARE_MESH_DATA,scheduler);
 
                 pimpl->mProgressHandler->UpdateFileWrite(1, 4);
 
@@ -406,6 +427,11 @@ aiReturn Exporter::Export( const aiScene* pScene, const char* pFormatId, const c
                 //  pp |= (nonIdempotentSteps & priv->mPPStepsApplied);
                 //}
 
+                // the steps below work in place
+                if (pp || !is_verbose_format) {
+                    SceneCombiner::MakeMeshDataUnique(scenecopy.get(), scheduler);
+                }
+
                 // If the input scene is not in verbose format, but there is at least post-processing step that relies on it,
                 // we need to run the MakeVerboseFormat step first.
                 bool must_join_again = false;
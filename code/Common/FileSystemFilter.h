@@ -217,6 +217,13 @@ public:
         return mWrapped->DeleteFile(file);
     }
 
+    // -------------------------------------------------------------------
+    /** Rename file. */
+    bool RenameFile(const std::string &from, const std::string &to) {
+        ai_assert( nullptr != mWrapped );
+        return mWrapped->RenameFile(from, to);
+    }
+
 private:
     // -------------------------------------------------------------------
     /** Build a valid path from a given relative or absolute path.
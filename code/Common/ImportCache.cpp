@@ -0,0 +1,885 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2021, assimp team
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+/** @file Implementation of the on-disk import cache
+ */
+
+#include "ImportCache.h"
+
+#ifdef AI_IMPORT_CACHE_SUPPORTED
+
+#include "AssetLib/Assbin/AssbinFileWriter.h"
+#include "Common/assbin_chunks.h"
+#include "Common/Importer.h"
+
+#include <assimp/BlobIOSystem.h>
+#include <assimp/DefaultLogger.hpp>
+#include <assimp/Hash.h>
+#include <assimp/IOSystem.hpp>
+#include <assimp/Importer.hpp>
+#include <assimp/ai_assert.h>
+#include <assimp/StringUtils.h>
+#include <assimp/config.h>
+#include <assimp/scene.h>
+#include <assimp/version.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <unordered_map>
+
+#ifdef _WIN32
+#   include <direct.h>
+#   include <io.h>
+#   include <process.h>
+#   include <sys/utime.h>
+#else
+#   include <dirent.h>
+#   include <sys/stat.h>
+#   include <unistd.h>
+#   include <utime.h>
+#endif
+
+using namespace Assimp;
+
+namespace {
+
+static const char EntryMagic[] = "AICACHE3";
+static const char EntryExtension[] = ".aicache";
+
+// marks a dependency which did not exist when the entry was written
+static const uint64_t MissingFile = ~static_cast<uint64_t>(0);
+
+// ------------------------------------------------------------------------------------------------
+// 128 bit FNV-1a. Every byte is mixed in on its own, so the result does not
+// depend on how the input is split into blocks.
+class Hasher {
+public:
+    Hasher() :
+            mLow(0x62b821756295c58dull), mHigh(0x6c62272e07bb0142ull) {}
+
+    void Update(const void *data, size_t size) {
+        const uint8_t *in = static_cast<const uint8_t *>(data);
+        for (const uint8_t *end = in + size; in != end; ++in) {
+            mLow ^= *in;
+            Multiply();
+        }
+    }
+
+    template <typename T>
+    void UpdateValue(const T &value) {
+        Update(&value, sizeof(T));
+    }
+
+    void UpdateString(const std::string &value) {
+        UpdateValue(static_cast<uint64_t>(value.length()));
+        Update(value.c_str(), value.length());
+    }
+
+    void Get(uint64_t hash[2]) const {
+        hash[0] = mLow;
+        hash[1] = mHigh;
+    }
+
+private:
+    // multiply by the FNV prime 2^88 + 0x13b, modulo 2^128
+    void Multiply() {
+        const uint64_t a = (mLow & 0xffffffffull) * 0x13b;
+        const uint64_t b = (mLow >> 32) * 0x13b;
+        const uint64_t mid = (a >> 32) + (b & 0xffffffffull);
+        mHigh = mHigh * 0x13b + (b >> 32) + (mid >> 32) + (mLow << 24);
+        mLow = (a & 0xffffffffull) | (mid << 32);
+    }
+
+    uint64_t mLow;
+    uint64_t mHigh;
+};
+
+typedef std::unique_ptr<IOStream, std::function<void(IOStream *)>> StreamPtr;
+
+StreamPtr OpenStream(IOSystem *io, const std::string &file, const char *mode) {
+    return StreamPtr(io->Open(file.c_str(), mode), [io](IOStream *s) { io->Close(s); });
+}
+
+// ------------------------------------------------------------------------------------------------
+// Hash the contents of a file. If the size differs from the expected one the
+// contents are not read, the hash is zero then.
+bool HashFile(IOSystem *io, const std::string &file, uint64_t &size, uint64_t hash[2],
+        uint64_t expectedSize = MissingFile) {
+    hash[0] = hash[1] = 0;
+    StreamPtr stream = OpenStream(io, file, "rb");
+    if (!stream) {
+        return false;
+    }
+
+    size = stream->FileSize();
+    if (MissingFile != expectedSize && size != expectedSize) {
+        return true;
+    }
+
+    Hasher hasher;
+    if (const uint8_t *view = stream->GetContiguousView()) {
+        hasher.Update(view, static_cast<size_t>(size));
+    } else {
+        std::vector<uint8_t> block(1 << 16);
+        size_t read;
+        while (0 != (read = stream->Read(&block[0], 1, block.size()))) {
+            hasher.Update(&block[0], read);
+        }
+    }
+    hasher.Get(hash);
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Properties which don't change the imported scene or are written by the import itself
+bool IsIgnoredProperty(ImporterPimpl::KeyType key) {
+    static const ImporterPimpl::KeyType ignored[] = {
+        SuperFastHash(AI_CONFIG_APP_SCALE_KEY),
+        SuperFastHash(AI_CONFIG_IMPORT_CACHE_DIRECTORY),
+        SuperFastHash(AI_CONFIG_IMPORT_CACHE_MAX_SIZE),
+        SuperFastHash(AI_CONFIG_GLOB_MEASURE_TIME),
+        SuperFastHash(AI_CONFIG_GLOB_MEASURE_TIME_FILE),
+        SuperFastHash(AI_CONFIG_GLOB_MULTITHREADING),
+        SuperFastHash(AI_CONFIG_GLOB_SCENE_ARENA),
+        SuperFastHash("importerIndex"),
+        SuperFastHash("sourceFilePath")
+    };
+    return std::end(ignored) != std::find(std::begin(ignored), std::end(ignored), key);
+}
+
+// ------------------------------------------------------------------------------------------------
+template <typename Map>
+void HashProperties(Hasher &hasher, const Map &properties) {
+    uint64_t count = 0;
+    for (const auto &property : properties) {
+        count += IsIgnoredProperty(property.first) ? 0 : 1;
+    }
+    hasher.UpdateValue(count);
+    for (const auto &property : properties) {
+        if (!IsIgnoredProperty(property.first)) {
+            hasher.UpdateValue(property.first);
+            hasher.UpdateValue(property.second);
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+// Get the directory of a file including the trailing separator
+std::string GetBaseDirectory(const std::string &file) {
+    const std::string::size_type pos = file.find_last_of("/\\");
+    return std::string::npos == pos ? std::string() : file.substr(0, pos + 1);
+}
+
+// ------------------------------------------------------------------------------------------------
+// Append plain values to an entry and read them back, all in host byte order
+template <typename T>
+void Append(std::vector<uint8_t> &out, const T &value) {
+    const uint8_t *in = reinterpret_cast<const uint8_t *>(&value);
+    out.insert(out.end(), in, in + sizeof(T));
+}
+
+class EntryReader {
+public:
+    EntryReader(const uint8_t *data, size_t size) :
+            mCursor(data), mEnd(data + size) {}
+
+    template <typename T>
+    bool Read(T &value) {
+        if (static_cast<size_t>(mEnd - mCursor) < sizeof(T)) {
+            return false;
+        }
+        ::memcpy(&value, mCursor, sizeof(T));
+        mCursor += sizeof(T);
+        return true;
+    }
+
+    bool Read(std::string &value, size_t length) {
+        if (static_cast<size_t>(mEnd - mCursor) < length) {
+            return false;
+        }
+        value.assign(reinterpret_cast<const char *>(mCursor), length);
+        mCursor += length;
+        return true;
+    }
+
+    const uint8_t *Skip(uint64_t length) {
+        if (static_cast<uint64_t>(mEnd - mCursor) < length) {
+            return nullptr;
+        }
+        const uint8_t *data = mCursor;
+        mCursor += length;
+        return data;
+    }
+
+    size_t Remaining() const {
+        return static_cast<size_t>(mEnd - mCursor);
+    }
+
+private:
+    const uint8_t *mCursor;
+    const uint8_t *mEnd;
+};
+
+// ------------------------------------------------------------------------------------------------
+// Scene data the Assbin format doesn't hold is stored behind the payload:
+// the scene name and metadata, node metadata with nested metadata, mesh
+// names, bounding boxes, texture coordinate names and the armature links
+// of the bones.
+
+// nested metadata deeper than this is not read back
+static const unsigned int MaxMetadataDepth = 32;
+
+void AppendString(std::vector<uint8_t> &out, const aiString &value) {
+    Append(out, static_cast<uint32_t>(value.length));
+    out.insert(out.end(), value.data, value.data + value.length);
+}
+
+bool ReadString(EntryReader &reader, aiString &value) {
+    uint32_t length;
+    const uint8_t *data = reader.Read(length) && length < MAXLEN ? reader.Skip(length) : nullptr;
+    if (nullptr == data) {
+        return false;
+    }
+    value.Set(std::string(reinterpret_cast<const char *>(data), length));
+    return true;
+}
+
+void AppendMetadata(std::vector<uint8_t> &out, const aiMetadata *metadata) {
+    const uint32_t count = nullptr != metadata ? metadata->mNumProperties : 0;
+    Append(out, count);
+    for (uint32_t i = 0; i < count; ++i) {
+        const aiMetadataEntry &entry = metadata->mValues[i];
+        AppendString(out, metadata->mKeys[i]);
+        Append(out, static_cast<uint16_t>(entry.mType));
+        Append(out, static_cast<uint8_t>(nullptr != entry.mData ? 1 : 0));
+        if (nullptr == entry.mData) {
+            continue;
+        }
+        switch (entry.mType) {
+        case AI_BOOL:
+            Append(out, static_cast<uint8_t>(*static_cast<const bool *>(entry.mData) ? 1 : 0));
+            break;
+        case AI_INT32:
+            Append(out, *static_cast<const int32_t *>(entry.mData));
+            break;
+        case AI_UINT64:
+            Append(out, *static_cast<const uint64_t *>(entry.mData));
+            break;
+        case AI_FLOAT:
+            Append(out, *static_cast<const float *>(entry.mData));
+            break;
+        case AI_DOUBLE:
+            Append(out, *static_cast<const double *>(entry.mData));
+            break;
+        case AI_AISTRING:
+            AppendString(out, *static_cast<const aiString *>(entry.mData));
+            break;
+        case AI_AIVECTOR3D:
+            Append(out, *static_cast<const aiVector3D *>(entry.mData));
+            break;
+        case AI_AIMETADATA:
+            AppendMetadata(out, static_cast<const aiMetadata *>(entry.mData));
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+template <typename T>
+bool ReadValue(EntryReader &reader, void *&data) {
+    T value;
+    if (!reader.Read(value)) {
+        return false;
+    }
+    data = new T(value);
+    return true;
+}
+
+bool ReadMetadata(EntryReader &reader, aiMetadata *&metadata, unsigned int depth) {
+    uint32_t count;
+    // every property takes at least 7 bytes
+    if (depth > MaxMetadataDepth || !reader.Read(count) || count > reader.Remaining() / 7) {
+        return false;
+    }
+
+    std::unique_ptr<aiMetadata> result(aiMetadata::Alloc(count));
+    for (uint32_t i = 0; i < count; ++i) {
+        aiMetadataEntry &entry = result->mValues[i];
+        uint16_t type;
+        uint8_t present;
+        if (!ReadString(reader, result->mKeys[i]) || !reader.Read(type) || type >= AI_META_MAX || !reader.Read(present)) {
+            return false;
+        }
+        entry.mType = static_cast<aiMetadataType>(type);
+        entry.mData = nullptr;
+        if (!present) {
+            continue;
+        }
+
+        bool ok = true;
+        switch (entry.mType) {
+        case AI_BOOL: {
+            uint8_t value;
+            ok = reader.Read(value);
+            entry.mData = ok ? new bool(0 != value) : nullptr;
+        } break;
+        case AI_INT32:
+            ok = ReadValue<int32_t>(reader, entry.mData);
+            break;
+        case AI_UINT64:
+            ok = ReadValue<uint64_t>(reader, entry.mData);
+            break;
+        case AI_FLOAT:
+            ok = ReadValue<float>(reader, entry.mData);
+            break;
+        case AI_DOUBLE:
+            ok = ReadValue<double>(reader, entry.mData);
+            break;
+        case AI_AISTRING: {
+            aiString value;
+            ok = ReadString(reader, value);
+            entry.mData = ok ? new aiString(value) : nullptr;
+        } break;
+        case AI_AIVECTOR3D:
+            ok = ReadValue<aiVector3D>(reader, entry.mData);
+            break;
+        case AI_AIMETADATA: {
+            aiMetadata *nested = nullptr;
+            ok = ReadMetadata(reader, nested, depth + 1);
+            entry.mData = ok ? (nullptr != nested ? nested : new aiMetadata) : nullptr;
+        } break;
+        default:
+            break;
+        }
+        if (!ok) {
+            return false;
+        }
+    }
+
+    metadata = result.release();
+    return true;
+}
+
+bool HasNestedMetadata(const aiMetadata *metadata) {
+    for (unsigned int i = 0; nullptr != metadata && i < metadata->mNumProperties; ++i) {
+        if (AI_AIMETADATA == metadata->mValues[i].mType) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// all nodes of a scene in depth-first order, the Assbin reader restores this order
+template <typename Node>
+void CollectNodes(Node *node, std::vector<Node *> &nodes) {
+    nodes.push_back(node);
+    for (unsigned int i = 0; i < node->mNumChildren; ++i) {
+        CollectNodes<Node>(node->mChildren[i], nodes);
+    }
+}
+
+void AppendSceneExtras(std::vector<uint8_t> &out, const aiScene *scene) {
+    std::vector<const aiNode *> nodes;
+    if (nullptr != scene->mRootNode) {
+        CollectNodes(static_cast<const aiNode *>(scene->mRootNode), nodes);
+    }
+
+    AppendString(out, scene->mName);
+    AppendMetadata(out, scene->mMetaData);
+
+    uint32_t numNodeMetadata = 0;
+    for (const aiNode *node : nodes) {
+        numNodeMetadata += HasNestedMetadata(node->mMetaData) ? 1 : 0;
+    }
+    Append(out, numNodeMetadata);
+    for (uint32_t i = 0; i < nodes.size(); ++i) {
+        if (HasNestedMetadata(nodes[i]->mMetaData)) {
+            Append(out, i);
+            AppendMetadata(out, nodes[i]->mMetaData);
+        }
+    }
+
+    std::unordered_map<const aiNode *, int32_t> nodeIndices;
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        nodeIndices[nodes[i]] = static_cast<int32_t>(i);
+    }
+    auto nodeIndex = [&nodeIndices](const aiNode *node) -> int32_t {
+        const auto it = nodeIndices.find(node);
+        return nodeIndices.end() != it ? it->second : -1;
+    };
+
+    for (unsigned int m = 0; m < scene->mNumMeshes; ++m) {
+        const aiMesh *mesh = scene->mMeshes[m];
+        AppendString(out, mesh->mName);
+        Append(out, mesh->mAABB.mMin);
+        Append(out, mesh->mAABB.mMax);
+
+        uint8_t names = 0;
+        for (unsigned int t = 0; t < AI_MAX_NUMBER_OF_TEXTURECOORDS && t < 8; ++t) {
+            names |= mesh->mTextureCoordsNames[t].length ? static_cast<uint8_t>(1 << t) : 0;
+        }
+        Append(out, names);
+        for (unsigned int t = 0; t < AI_MAX_NUMBER_OF_TEXTURECOORDS && t < 8; ++t) {
+            if (names & (1 << t)) {
+                AppendString(out, mesh->mTextureCoordsNames[t]);
+            }
+        }
+
+        for (unsigned int b = 0; b < mesh->mNumBones; ++b) {
+#ifndef ASSIMP_BUILD_NO_ARMATUREPOPULATE_PROCESS
+            Append(out, nodeIndex(mesh->mBones[b]->mArmature));
+            Append(out, nodeIndex(mesh->mBones[b]->mNode));
+#else
+            Append(out, static_cast<int32_t>(-1));
+            Append(out, static_cast<int32_t>(-1));
+#endif
+        }
+    }
+}
+
+bool ReadSceneExtras(EntryReader &reader, aiScene *scene) {
+    std::vector<aiNode *> nodes;
+    if (nullptr != scene->mRootNode) {
+        CollectNodes(scene->mRootNode, nodes);
+    }
+
+    aiMetadata *metadata = nullptr;
+    if (!ReadString(reader, scene->mName) || !ReadMetadata(reader, metadata, 0)) {
+        return false;
+    }
+    delete scene->mMetaData;
+    scene->mMetaData = metadata;
+
+    uint32_t numNodeMetadata;
+    if (!reader.Read(numNodeMetadata)) {
+        return false;
+    }
+    for (uint32_t i = 0; i < numNodeMetadata; ++i) {
+        uint32_t index;
+        if (!reader.Read(index) || index >= nodes.size() || !ReadMetadata(reader, metadata, 0)) {
+            return false;
+        }
+        delete nodes[index]->mMetaData;
+        nodes[index]->mMetaData = metadata;
+    }
+
+    for (unsigned int m = 0; m < scene->mNumMeshes; ++m) {
+        aiMesh *mesh = scene->mMeshes[m];
+        uint8_t names;
+        if (!ReadString(reader, mesh->mName) || !reader.Read(mesh->mAABB.mMin) || !reader.Read(mesh->mAABB.mMax) ||
+                !reader.Read(names)) {
+            return false;
+        }
+        for (unsigned int t = 0; t < AI_MAX_NUMBER_OF_TEXTURECOORDS && t < 8; ++t) {
+            if ((names & (1 << t)) && !ReadString(reader, mesh->mTextureCoordsNames[t])) {
+                return false;
+            }
+        }
+
+        for (unsigned int b = 0; b < mesh->mNumBones; ++b) {
+            int32_t armature, node;
+            if (!reader.Read(armature) || !reader.Read(node) ||
+                    armature >= static_cast<int32_t>(nodes.size()) || node >= static_cast<int32_t>(nodes.size())) {
+                return false;
+            }
+#ifndef ASSIMP_BUILD_NO_ARMATUREPOPULATE_PROCESS
+            mesh->mBones[b]->mArmature = armature >= 0 ? nodes[armature] : nullptr;
+            mesh->mBones[b]->mNode = node >= 0 ? nodes[node] : nullptr;
+#endif
+        }
+    }
+
+    return 0 == reader.Remaining();
+}
+
+// ------------------------------------------------------------------------------------------------
+// Read an entry, which starts with its magic and its total size. Truncated
+// or overlong files are rejected before any of their contents are trusted.
+bool ReadEntry(IOSystem *io, const std::string &path, std::vector<uint8_t> &data) {
+    StreamPtr stream = OpenStream(io, path, "rb");
+    if (!stream) {
+        return false;
+    }
+
+    const size_t magicLength = sizeof(EntryMagic) - 1;
+    const size_t size = stream->FileSize();
+    uint8_t header[sizeof(EntryMagic) - 1 + sizeof(uint64_t)];
+    if (size < sizeof(header) || 1 != stream->Read(header, sizeof(header), 1) ||
+            0 != ::memcmp(header, EntryMagic, magicLength)) {
+        return false;
+    }
+    uint64_t storedSize;
+    ::memcpy(&storedSize, header + magicLength, sizeof(storedSize));
+    if (storedSize != size) {
+        return false;
+    }
+
+    data.resize(size - sizeof(header));
+    return data.empty() || 1 == stream->Read(&data[0], data.size(), 1);
+}
+
+// ------------------------------------------------------------------------------------------------
+// Mark an entry as recently used. Neither this nor listing the entries is
+// covered by IOSystem, so eviction only works for caches on disk.
+void TouchFile(const std::string &path) {
+#ifdef _WIN32
+    ::_utime(path.c_str(), nullptr);
+#else
+    ::utime(path.c_str(), nullptr);
+#endif
+}
+
+// ------------------------------------------------------------------------------------------------
+struct EntryInfo {
+    std::string mPath;
+    uint64_t mSize;
+    int64_t mTime;
+};
+
+// ------------------------------------------------------------------------------------------------
+// List all entries of a cache directory
+void ListEntries(const std::string &directory, std::vector<EntryInfo> &entries) {
+    const size_t extLength = sizeof(EntryExtension) - 1;
+    auto isEntry = [extLength](const std::string &name) {
+        return name.length() > extLength && 0 == name.compare(name.length() - extLength, extLength, EntryExtension);
+    };
+
+#ifdef _WIN32
+    _finddata_t data;
+    const intptr_t handle = ::_findfirst((directory + "/*" + EntryExtension).c_str(), &data);
+    if (-1 == handle) {
+        return;
+    }
+    do {
+        if (isEntry(data.name)) {
+            entries.push_back({ directory + "/" + data.name, static_cast<uint64_t>(data.size), static_cast<int64_t>(data.time_write) });
+        }
+    } while (0 == ::_findnext(handle, &data));
+    ::_findclose(handle);
+#else
+    DIR *dir = ::opendir(directory.c_str());
+    if (nullptr == dir) {
+        return;
+    }
+    while (const dirent *entry = ::readdir(dir)) {
+        if (!isEntry(entry->d_name)) {
+            continue;
+        }
+        const std::string path = directory + "/" + entry->d_name;
+        struct stat info;
+        if (0 == ::stat(path.c_str(), &info)) {
+            entries.push_back({ path, static_cast<uint64_t>(info.st_size), static_cast<int64_t>(info.st_mtime) });
+        }
+    }
+    ::closedir(dir);
+#endif
+}
+
+// ------------------------------------------------------------------------------------------------
+// Get a file name no other thread or process uses at the same time
+std::string GetTemporaryPath(const std::string &entry) {
+    static std::atomic<unsigned int> counter(0);
+#ifdef _WIN32
+    const int pid = ::_getpid();
+#else
+    const int pid = static_cast<int>(::getpid());
+#endif
+    const size_t thread = std::hash<std::thread::id>()(std::this_thread::get_id());
+    return entry + "." + ai_to_string(pid) + "-" + ai_to_string(thread) + "-" + ai_to_string(counter++) + ".tmp";
+}
+
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+ImportCache::ImportCache(const std::string &directory, uint64_t maxSize) :
+        mDirectory(directory),
+        mMaxSize(maxSize),
+        mFile(),
+        mKey() {
+    while (mDirectory.length() > 1 && ('/' == mDirectory.back() || '\\' == mDirectory.back())) {
+        mDirectory.pop_back();
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+bool ImportCache::ComputeKey(const ImporterPimpl *pimpl, const std::string &file, IOSystem *io, unsigned int flags) {
+    uint64_t size, hash[2];
+    if (!HashFile(io, file, size, hash)) {
+        return false;
+    }
+
+    Hasher hasher;
+    hasher.Update(EntryMagic, sizeof(EntryMagic) - 1);
+    hasher.UpdateValue(aiGetVersionMajor());
+    hasher.UpdateValue(aiGetVersionMinor());
+    hasher.UpdateValue(aiGetVersionPatch());
+    hasher.UpdateValue(aiGetVersionRevision());
+
+    // the extension selects the importer for files without a signature
+    const std::string::size_type dot = file.find_last_of('.');
+    std::string ext = std::string::npos == dot ? std::string() : file.substr(dot + 1);
+    std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+    hasher.UpdateString(ext);
+
+    hasher.UpdateValue(size);
+    hasher.UpdateValue(hash[0]);
+    hasher.UpdateValue(hash[1]);
+    hasher.UpdateValue(flags);
+
+    HashProperties(hasher, pimpl->mIntProperties);
+    HashProperties(hasher, pimpl->mFloatProperties);
+    HashProperties(hasher, pimpl->mMatrixProperties);
+
+    uint64_t count = 0;
+    for (const auto &property : pimpl->mStringProperties) {
+        count += IsIgnoredProperty(property.first) ? 0 : 1;
+    }
+    hasher.UpdateValue(count);
+    for (const auto &property : pimpl->mStringProperties) {
+        if (!IsIgnoredProperty(property.first)) {
+            hasher.UpdateValue(property.first);
+            hasher.UpdateString(property.second);
+        }
+    }
+
+    mFile = file;
+    hasher.Get(mKey);
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+std::string ImportCache::GetEntryPath() const {
+    char name[33];
+    ai_snprintf(name, sizeof(name), "%016llx%016llx", static_cast<unsigned long long>(mKey[1]),
+            static_cast<unsigned long long>(mKey[0]));
+    return mDirectory + "/" + name + EntryExtension;
+}
+
+// ------------------------------------------------------------------------------------------------
+aiScene *ImportCache::Load(IOSystem *io) {
+    const std::string path = GetEntryPath();
+    std::vector<uint8_t> data;
+    if (!ReadEntry(io, path, data)) {
+        return nullptr;
+    }
+
+    EntryReader reader(data.data(), data.size());
+    uint64_t key[2];
+    uint32_t numDependencies;
+    if (!reader.Read(key[0]) || !reader.Read(key[1]) || key[0] != mKey[0] || key[1] != mKey[1] ||
+            !reader.Read(numDependencies)) {
+        return nullptr;
+    }
+
+    // all other files read by the import must be unchanged
+    const std::string baseDirectory = GetBaseDirectory(mFile);
+    for (uint32_t i = 0; i < numDependencies; ++i) {
+        uint8_t relative;
+        uint32_t length;
+        std::string dependency;
+        uint64_t size, hash[2];
+        if (!reader.Read(relative) || !reader.Read(length) || !reader.Read(dependency, length) ||
+                !reader.Read(size) || !reader.Read(hash[0]) || !reader.Read(hash[1])) {
+            return nullptr;
+        }
+        if (relative) {
+            dependency = baseDirectory + dependency;
+        }
+
+        // files of another size are not hashed at all
+        uint64_t currentSize = MissingFile, currentHash[2];
+        if (!HashFile(io, dependency, currentSize, currentHash, size)) {
+            currentSize = MissingFile;
+        }
+        if (currentSize != size || currentHash[0] != hash[0] || currentHash[1] != hash[1]) {
+            ASSIMP_LOG_DEBUG("Import cache: ", dependency, " changed, ignoring ", path);
+            return nullptr;
+        }
+    }
+
+    uint64_t payloadSize;
+    const uint8_t *payload = reader.Read(payloadSize) ? reader.Skip(payloadSize) : nullptr;
+    if (nullptr == payload || 0 == payloadSize) {
+        return nullptr;
+    }
+
+    Importer importer;
+    if (nullptr == importer.ReadFileFromMemory(payload, static_cast<size_t>(payloadSize), 0, "assbin")) {
+        ASSIMP_LOG_WARN("Import cache: unable to read ", path, ": ", importer.GetErrorString());
+        return nullptr;
+    }
+    std::unique_ptr<aiScene> scene(importer.GetOrphanedScene());
+    if (!ReadSceneExtras(reader, scene.get())) {
+        ASSIMP_LOG_WARN("Import cache: unable to read ", path);
+        return nullptr;
+    }
+
+    TouchFile(path);
+    return scene.release();
+}
+
+// ------------------------------------------------------------------------------------------------
+void ImportCache::Store(const aiScene *scene, const std::vector<std::string> &dependencies, IOSystem *io) {
+    ai_assert(nullptr != scene);
+
+    // the Assbin writer goes through an IOSystem, let it write into memory
+    aiExportDataBlob *blob = nullptr;
+    {
+        BlobIOSystem blobIO;
+        DumpSceneToAssbin(blobIO.GetMagicFileName(), "cache", &blobIO, scene, false, false, ASSBIN_VERSION_MAJOR_ALIGNED);
+        blob = blobIO.GetBlobChain();
+    }
+    std::unique_ptr<aiExportDataBlob> payload(blob);
+    if (!payload || 0 == payload->size) {
+        return;
+    }
+
+    // the total size is patched in once the entry is complete
+    std::vector<uint8_t> data(EntryMagic, EntryMagic + sizeof(EntryMagic) - 1);
+    const size_t sizeOffset = data.size();
+    Append(data, static_cast<uint64_t>(0));
+    Append(data, mKey[0]);
+    Append(data, mKey[1]);
+
+    // unique dependencies in the order they were opened, files next to the
+    // main file are stored relative to it to keep moved copies cacheable
+    std::vector<std::string> unique;
+    for (const std::string &dependency : dependencies) {
+        if (dependency != mFile && unique.end() == std::find(unique.begin(), unique.end(), dependency)) {
+            unique.push_back(dependency);
+        }
+    }
+
+    const std::string baseDirectory = GetBaseDirectory(mFile);
+    Append(data, static_cast<uint32_t>(unique.size()));
+    for (const std::string &dependency : unique) {
+        uint64_t size = MissingFile, hash[2];
+        if (!HashFile(io, dependency, size, hash)) {
+            size = MissingFile;
+        }
+
+        const bool relative = !baseDirectory.empty() && 0 == dependency.compare(0, baseDirectory.length(), baseDirectory);
+        const std::string stored = relative ? dependency.substr(baseDirectory.length()) : dependency;
+        Append(data, static_cast<uint8_t>(relative ? 1 : 0));
+        Append(data, static_cast<uint32_t>(stored.length()));
+        data.insert(data.end(), stored.begin(), stored.end());
+        Append(data, size);
+        Append(data, hash[0]);
+        Append(data, hash[1]);
+    }
+
+    Append(data, static_cast<uint64_t>(payload->size));
+    const uint8_t *payloadData = static_cast<const uint8_t *>(payload->data);
+    data.insert(data.end(), payloadData, payloadData + payload->size);
+    AppendSceneExtras(data, scene);
+
+    const uint64_t totalSize = data.size();
+    ::memcpy(&data[sizeOffset], &totalSize, sizeof(totalSize));
+
+    io->CreateDirectory(mDirectory);
+
+    // publish the entry atomically, readers never see a partial file
+    const std::string path = GetEntryPath();
+    const std::string temporary = GetTemporaryPath(path);
+    bool written = false;
+    {
+        StreamPtr stream = OpenStream(io, temporary, "wb");
+        if (!stream) {
+            ASSIMP_LOG_WARN("Import cache: unable to write ", temporary);
+            return;
+        }
+        written = 1 == stream->Write(&data[0], data.size(), 1);
+    }
+    if (!written) {
+        ASSIMP_LOG_WARN("Import cache: unable to write ", temporary);
+        io->DeleteFile(temporary);
+        return;
+    }
+    if (!io->RenameFile(temporary, path)) {
+        ASSIMP_LOG_WARN("Import cache: unable to replace ", path);
+        io->DeleteFile(temporary);
+        return;
+    }
+
+    Evict(path, io);
+}
+
+// ------------------------------------------------------------------------------------------------
+void ImportCache::Evict(const std::string &current, IOSystem *io) {
+    if (0 == mMaxSize) {
+        return;
+    }
+
+    std::vector<EntryInfo> entries;
+    ListEntries(mDirectory, entries);
+
+    uint64_t total = 0;
+    for (const EntryInfo &entry : entries) {
+        total += entry.mSize;
+    }
+    if (total <= mMaxSize) {
+        return;
+    }
+
+    // least recently used first, the new entry goes last on ties
+    std::sort(entries.begin(), entries.end(), [&current](const EntryInfo &a, const EntryInfo &b) {
+        if (a.mTime != b.mTime) {
+            return a.mTime < b.mTime;
+        }
+        return a.mPath != current && b.mPath == current;
+    });
+    for (const EntryInfo &entry : entries) {
+        if (total <= mMaxSize) {
+            break;
+        }
+        // entries may vanish concurrently, they count as removed either way
+        io->DeleteFile(entry.mPath);
+        total -= entry.mSize;
+    }
+}
+
+#endif // AI_IMPORT_CACHE_SUPPORTED
@@ -0,0 +1,131 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2021, assimp team
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+/** @file ImportCache.h
+ *  Declares the on-disk cache of imported scenes, see
+ *  #AI_CONFIG_IMPORT_CACHE_DIRECTORY.
+ */
+#pragma once
+#ifndef AI_IMPORTCACHE_H_INC
+#define AI_IMPORTCACHE_H_INC
+
+#include <assimp/defs.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#if !defined(ASSIMP_BUILD_NO_EXPORT) && !defined(ASSIMP_BUILD_NO_ASSBIN_EXPORTER) && !defined(ASSIMP_BUILD_NO_ASSBIN_IMPORTER)
+#   define AI_IMPORT_CACHE_SUPPORTED
+#endif
+
+struct aiScene;
+
+namespace Assimp {
+
+class ImporterPimpl;
+class IOSystem;
+
+// ---------------------------------------------------------------------------
+/** @brief Content-addressed cache of post-processed scenes.
+ *
+ *  An entry is named after a 128 bit hash of the imported file, the post
+ *  processing flags and all import properties. It holds its own size and
+ *  the scene in the Assbin format, preceded by the paths, sizes and hashes
+ *  of the other files the import read and followed by the scene data Assbin
+ *  doesn't hold, e.g. the scene metadata, the bounding boxes of meshes and
+ *  the armature links of bones.
+ *  An entry is only used if its size matches and all of the files are
+ *  unchanged.
+ *
+ *  Entries are read and written through the importer's IOSystem. They are
+ *  written to a temporary file first and renamed into place, replacing an
+ *  older entry, so concurrent writers never expose partial data. Storing an
+ *  entry evicts the least recently used ones to keep the cache below its
+ *  size limit. */
+// ---------------------------------------------------------------------------
+class ImportCache {
+public:
+    /** @brief Construct a cache for a directory.
+     *  @param directory Cache directory, created on demand
+     *  @param maxSize Maximum total size of all entries in bytes, 0 for no limit */
+    ImportCache(const std::string &directory, uint64_t maxSize);
+
+    // -------------------------------------------------------------------
+    /** @brief Compute the key of an import and make it the current one.
+     *  @param pimpl Importer whose properties are hashed
+     *  @param file Imported file
+     *  @param io IOSystem to read the file from
+     *  @param flags Post processing flags of the import
+     *  @return false if the file can't be read */
+    bool ComputeKey(const ImporterPimpl *pimpl, const std::string &file, IOSystem *io, unsigned int flags);
+
+    // -------------------------------------------------------------------
+    /** @brief Load the entry for the current key.
+     *  @param io IOSystem to read the entry and check the dependencies with
+     *  @return The scene or nullptr if there is no valid entry */
+    aiScene *Load(IOSystem *io);
+
+    // -------------------------------------------------------------------
+    /** @brief Store a scene under the current key.
+     *  @param scene Post-processed scene
+     *  @param dependencies All files the import tried to read, the
+     *    imported file itself is covered by the key already
+     *  @param io IOSystem to hash the dependencies and write the entry with */
+    void Store(const aiScene *scene, const std::vector<std::string> &dependencies, IOSystem *io);
+
+    // -------------------------------------------------------------------
+    /** @brief Get the path of the entry for the current key */
+    std::string GetEntryPath() const;
+
+private:
+    void Evict(const std::string &current, IOSystem *io);
+
+    std::string mDirectory;
+    uint64_t mMaxSize;
+    std::string mFile;
+    uint64_t mKey[2];
+};
+
+} // namespace Assimp
+
+#endif // AI_IMPORTCACHE_H_INC
@@ -0,0 +1,245 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2021, assimp team
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+/** @file ImportLimits.cpp
+ *  @brief Implementation of the memory budget and deadline of imports
+ */
+
+#include <assimp/ImportLimits.h>
+
+#include <limits>
+
+using namespace Assimp;
+
+namespace {
+
+// Number of calls to ImportLimits::Poll() between two reads of the clock
+static const unsigned int PollInterval = 256;
+
+// The limits of the import running on this thread
+thread_local ImportLimits *tActiveLimits = nullptr;
+thread_local unsigned int tPollCountdown = PollInterval;
+
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+ImportLimits::ImportLimits(size_t maxBytes, unsigned int timeoutMs) :
+        mMaxBytes(maxBytes),
+        mTimeoutMs(timeoutMs),
+        mDeadline(Clock::now() + std::chrono::milliseconds(timeoutMs)),
+        mUsedBytes(0),
+        mExceeded(0) {
+    // empty
+}
+
+// ------------------------------------------------------------------------------------------------
+size_t ImportLimits::GetUsedBytes() const {
+    const int64_t used = mUsedBytes.load(std::memory_order_relaxed);
+    return used > 0 ? static_cast<size_t>(used) : 0;
+}
+
+// ------------------------------------------------------------------------------------------------
+ImportLimits::Scope::Scope(ImportLimits *limits) :
+        mPrevious(tActiveLimits),
+        mActive(nullptr != limits) {
+    if (mActive) {
+        tActiveLimits = limits;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+ImportLimits::Scope::~Scope() {
+    if (mActive) {
+        tActiveLimits = mPrevious;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+ImportLimits *ImportLimits::GetActive() {
+    return tActiveLimits;
+}
+
+// ------------------------------------------------------------------------------------------------
+void ImportLimits::Allocate(size_t bytes) {
+    ImportLimits *limits = tActiveLimits;
+    if (nullptr != limits) {
+        limits->Charge(bytes);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void ImportLimits::Free(size_t bytes) AI_NO_EXCEPT {
+    ImportLimits *limits = tActiveLimits;
+    if (nullptr != limits && limits->mMaxBytes) {
+        limits->mUsedBytes.fetch_sub(static_cast<int64_t>(bytes), std::memory_order_relaxed);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void ImportLimits::Charge(size_t bytes) {
+    if (mExceeded) {
+        Fail(static_cast<ImportLimitError::Kind>(mExceeded - 1));
+    }
+    if (0 == mMaxBytes) {
+        return;
+    }
+
+    const int64_t used = mUsedBytes.fetch_add(static_cast<int64_t>(bytes), std::memory_order_relaxed) + static_cast<int64_t>(bytes);
+    if (used > 0 && static_cast<uint64_t>(used) > mMaxBytes) {
+        mUsedBytes.fetch_sub(static_cast<int64_t>(bytes), std::memory_order_relaxed);
+        Fail(ImportLimitError::Memory);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+ImportLimits::Reservation::Reservation() AI_NO_EXCEPT :
+        mLimits(nullptr),
+        mBytes(0) {
+    // empty
+}
+
+// ------------------------------------------------------------------------------------------------
+ImportLimits::Reservation::Reservation(uint64_t count, size_t elementSize) :
+        mLimits(nullptr),
+        mBytes(0) {
+    Add(count, elementSize);
+}
+
+// ------------------------------------------------------------------------------------------------
+ImportLimits::Reservation::Reservation(Reservation &&other) AI_NO_EXCEPT :
+        mLimits(other.mLimits),
+        mBytes(other.mBytes) {
+    other.mBytes = 0;
+}
+
+// ------------------------------------------------------------------------------------------------
+ImportLimits::Reservation &ImportLimits::Reservation::operator=(Reservation &&other) AI_NO_EXCEPT {
+    if (this != &other) {
+        Release();
+        mLimits = other.mLimits;
+        mBytes = other.mBytes;
+        other.mBytes = 0;
+    }
+    return *this;
+}
+
+// ------------------------------------------------------------------------------------------------
+ImportLimits::Reservation::~Reservation() {
+    Release();
+}
+
+// ------------------------------------------------------------------------------------------------
+void ImportLimits::Reservation::Add(uint64_t count, size_t elementSize) {
+    if (elementSize && count > (std::numeric_limits<size_t>::max() - mBytes) / elementSize) {
+        throw DeadlyImportError("Element count ", count, " is too large to be allocated");
+    }
+
+    ImportLimits *limits = tActiveLimits;
+    if (nullptr == limits) {
+        return;
+    }
+    if (0 != mBytes && limits != mLimits) {
+        // the charge of an import which is over isn't returned to another
+        Release();
+    }
+
+    const size_t bytes = static_cast<size_t>(count * elementSize);
+    limits->Charge(bytes);
+    mLimits = limits;
+    mBytes += bytes;
+}
+
+// ------------------------------------------------------------------------------------------------
+void ImportLimits::Reservation::Resize(uint64_t bytes) {
+    if (bytes > mBytes) {
+        const uint64_t blocks = bytes / BlockSize + (bytes % BlockSize ? 1 : 0);
+        Add(blocks * BlockSize - mBytes, 1);
+    } else if (mBytes - bytes >= BlockSize) {
+        const size_t keep = static_cast<size_t>((bytes / BlockSize + (bytes % BlockSize ? 1 : 0)) * BlockSize);
+        if (tActiveLimits == mLimits) {
+            Free(mBytes - keep);
+        }
+        mBytes = keep;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void ImportLimits::Reservation::Release() AI_NO_EXCEPT {
+    if (0 != mBytes && tActiveLimits == mLimits) {
+        Free(mBytes);
+    }
+    mBytes = 0;
+}
+
+// ------------------------------------------------------------------------------------------------
+void ImportLimits::CheckDeadline() {
+    ImportLimits *limits = tActiveLimits;
+    if (nullptr == limits) {
+        return;
+    }
+    if (limits->mExceeded) {
+        limits->Fail(static_cast<ImportLimitError::Kind>(limits->mExceeded - 1));
+    }
+    if (limits->mTimeoutMs && Clock::now() >= limits->mDeadline) {
+        limits->Fail(ImportLimitError::Deadline);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void ImportLimits::Poll() {
+    if (nullptr == tActiveLimits || --tPollCountdown) {
+        return;
+    }
+    tPollCountdown = PollInterval;
+    CheckDeadline();
+}
+
+// ------------------------------------------------------------------------------------------------
+void ImportLimits::Fail(ImportLimitError::Kind kind) {
+    int expected = 0;
+    mExceeded.compare_exchange_strong(expected, kind + 1);
+
+    if (ImportLimitError::Memory == kind) {
+        throw ImportLimitError(kind, "Import exceeded its memory budget of ", mMaxBytes, " bytes");
+    }
+    throw ImportLimitError(kind, "Import exceeded its deadline of ", mTimeoutMs, " ms");
+}
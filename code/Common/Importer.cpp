@@ -68,18 +68,27 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "PostProcessing/ProcessHelper.h"
 #include "Common/ScenePreprocessor.h"
 #include "Common/ScenePrivate.h"
+#include "Common/SceneArena.h"
+#include "Common/ProbeIOSystem.h"
+#include "Common/CountingIOSystem.h"
+#include "Common/ImportCache.h"
+#include "Common/TaskScheduler.h"
 
 #include <assimp/BaseImporter.h>
 #include <assimp/GenericProperty.h>
+#include <assimp/Allocator.h>
+#include <assimp/ImportLimits.h>
 #include <assimp/MemoryIOWrapper.h>
 #include <assimp/Profiler.h>
 #include <assimp/TinyFormatter.h>
 #include <assimp/Exceptional.h>
-#include <assimp/Profiler.h>
 #include <assimp/commonMetaData.h>
 
+#include <algorithm>
 #include <exception>
+#include <iomanip>
 #include <set>
+#include <sstream>
 #include <memory>
 #include <cctype>
 
@@ -160,6 +169,7 @@ Importer::Importer()
     pimpl->mIsDefaultProgressHandler = true;
 
     GetImporterInstanceList(pimpl->mImporter);
+    pimpl->UpdateExtensionMap();
     GetPostProcessingStepInstanceList(pimpl->mPostProcessingSteps);
 
     // Allocate a SharedPostProcessInfo object and store pointers to it in all post-process steps in the list.
@@ -193,6 +203,11 @@ Importer::~Importer() {
     // Delete shared post-processing data
     delete pimpl->mPPShared;
 
+    // Stop the post-processing worker threads
+    delete pimpl->mTaskScheduler;
+
+    delete pimpl->mStatistics;
+
     // and finally the pimpl itself
     delete pimpl;
 }
@@ -240,6 +255,7 @@ aiReturn Importer::RegisterLoader(BaseImporter* pImp) {
 
     // add the loader
     pimpl->mImporter.push_back(pImp);
+    pimpl->UpdateExtensionMap();
     ASSIMP_LOG_INFO("Registering custom importer for these file extensions: ", baked);
     ASSIMP_END_EXCEPTION_REGION(aiReturn);
     
@@ -260,6 +276,7 @@ aiReturn Importer::UnregisterLoader(BaseImporter* pImp) {
 
     if (it != pimpl->mImporter.end())   {
         pimpl->mImporter.erase(it);
+        pimpl->UpdateExtensionMap();
         ASSIMP_LOG_INFO("Unregistering custom importer: ");
         return AI_SUCCESS;
     }
@@ -363,6 +380,38 @@ bool Importer::IsDefaultProgressHandler() const {
     return pimpl->mIsDefaultProgressHandler;
 }
 
+// ------------------------------------------------------------------------------------------------
+// Supplies a sink for the meshes of the following imports
+void Importer::SetMeshSink(MeshSink *pSink) {
+    ai_assert(nullptr != pimpl);
+
+    pimpl->mMeshSink = pSink;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Get the currently set mesh sink
+MeshSink *Importer::GetMeshSink() const {
+    ai_assert(nullptr != pimpl);
+
+    return pimpl->mMeshSink;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Supplies the allocator of the scene objects
+void Importer::SetAllocator(Allocator *pAllocator) {
+    ai_assert(nullptr != pimpl);
+
+    pimpl->mAllocator = pAllocator;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Get the currently set allocator
+Allocator *Importer::GetAllocator() const {
+    ai_assert(nullptr != pimpl);
+
+    return pimpl->mAllocator;
+}
+
 // ------------------------------------------------------------------------------------------------
 // Validate post process step flags
 bool _ValidateFlags(unsigned int pFlags) {
@@ -377,6 +426,16 @@ bool _ValidateFlags(unsigned int pFlags) {
     return true;
 }
 
+// ------------------------------------------------------------------------------------------------
+// Forget about the deferred meshes of the current scene
+static void ReleaseDeferredMeshes(ImporterPimpl *pimpl) {
+    if (pimpl->mDeferredImporter) {
+        pimpl->mDeferredImporter->ReleaseDeferredData();
+        pimpl->mDeferredImporter = nullptr;
+        pimpl->mDeferredFile.clear();
+    }
+}
+
 // ------------------------------------------------------------------------------------------------
 // Free the current scene
 void Importer::FreeScene( ) {
@@ -384,6 +443,8 @@ void Importer::FreeScene( ) {
     
     ASSIMP_BEGIN_EXCEPTION_REGION();
 
+    // the deferred data of the importer may live in the arena of the scene
+    ReleaseDeferredMeshes(pimpl);
     delete pimpl->mScene;
     pimpl->mScene = nullptr;
 
@@ -433,6 +494,7 @@ aiScene* Importer::GetOrphanedScene() {
 
     ASSIMP_BEGIN_EXCEPTION_REGION();
     pimpl->mScene = nullptr;
+    ReleaseDeferredMeshes(pimpl);
 
     pimpl->mErrorString = std::string();
     pimpl->mException = std::exception_ptr();
@@ -509,7 +571,11 @@ const aiScene* Importer::ReadFileFromMemory( const void* pBuffer,
     char fbuff[BufSize];
     ai_snprintf(fbuff, BufSize, "%s.%s",AI_MEMORYIO_MAGIC_FILENAME,pHint);
 
+    // the buffer is gone once we return, so no mesh may be deferred
+    const bool defer = GetPropertyBool(AI_CONFIG_IMPORT_DEFER_MESH_DATA, false);
+    SetPropertyBool(AI_CONFIG_IMPORT_DEFER_MESH_DATA, false);
     ReadFile(fbuff,pFlags);
+    SetPropertyBool(AI_CONFIG_IMPORT_DEFER_MESH_DATA, defer);
     SetIOHandler(io);
 
     ASSIMP_END_EXCEPTION_REGION_WITH_ERROR_STRING(const aiScene*, pimpl->mErrorString, pimpl->mException);
@@ -576,6 +642,354 @@ void WriteLogOpening(const std::string& file) {
     ASSIMP_LOG_DEBUG(stream.str());
 }
 
+// ------------------------------------------------------------------------------------------------
+// Rebuild the extension lookup table
+void ImporterPimpl::UpdateExtensionMap() {
+    mExtensionMap.clear();
+
+    std::set<std::string> extensions;
+    for (unsigned int a = 0; a < mImporter.size(); ++a) {
+        extensions.clear();
+        mImporter[a]->GetExtensionList(extensions);
+        for (const std::string &ext : extensions) {
+            if (!ext.empty()) {
+                mExtensionMap[ai_tolower(ext)].push_back(a);
+            }
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void ImporterPimpl::UpdateTaskScheduler() {
+    const int setting = GetGenericProperty<int>(mIntProperties, AI_CONFIG_GLOB_MULTITHREADING, 0);
+    const unsigned int numThreads = TaskScheduler::GetNumThreadsForSetting(setting);
+
+    if (numThreads < 2) {
+        delete mTaskScheduler;
+        mTaskScheduler = nullptr;
+    } else if (nullptr == mTaskScheduler || mTaskScheduler->GetNumThreads() != numThreads) {
+        delete mTaskScheduler;
+        mTaskScheduler = new TaskScheduler(numThreads);
+        ASSIMP_LOG_DEBUG("Running parallel work on ", numThreads, " threads");
+    }
+}
+
+namespace {
+
+// ------------------------------------------------------------------------------------------------
+// Creates the limits configured by AI_CONFIG_IMPORT_MAX_MEMORY and AI_CONFIG_IMPORT_TIMEOUT.
+ImportLimits *CreateImportLimits(const Importer &importer) {
+    const int maxMemory = importer.GetPropertyInteger(AI_CONFIG_IMPORT_MAX_MEMORY, 0);
+    const int timeout = importer.GetPropertyInteger(AI_CONFIG_IMPORT_TIMEOUT, 0);
+    if (maxMemory <= 0 && timeout <= 0) {
+        return nullptr;
+    }
+    return new ImportLimits(static_cast<size_t>(std::max(0, maxMemory)) << 20, static_cast<unsigned int>(std::max(0, timeout)));
+}
+
+// ------------------------------------------------------------------------------------------------
+// Enforces the import limits and binds the allocator of the importer for the
+// duration of one public call. Calls nested into ReadFile() share the limits
+// of the whole import. Calls on an existing scene keep the layout of its arrays.
+class ImportScope {
+public:
+    ImportScope(const Importer &importer, ImporterPimpl *pimpl) :
+            mPimpl(pimpl),
+            mLimits(pimpl->mLimits ? nullptr : CreateImportLimits(importer)),
+            mScope(mLimits.get()),
+            mAllocatorScope(pimpl->mAllocator),
+            mArrayScope(pimpl->mScene) {
+        if (mLimits) {
+            mPimpl->mLimits = mLimits.get();
+        }
+    }
+
+    ~ImportScope() {
+        if (mLimits) {
+            mPimpl->mLimits = nullptr;
+        }
+    }
+
+private:
+    ImporterPimpl *mPimpl;
+    std::unique_ptr<ImportLimits> mLimits;
+    ImportLimits::Scope mScope;
+    Allocator::Scope mAllocatorScope;
+    SceneArrayScope mArrayScope;
+};
+
+// ------------------------------------------------------------------------------------------------
+// Binds the arena of the current scene while it is imported or post-processed. The arena is held
+// here meanwhile, it ends up with the scene which exists at the end or is released with it.
+class ArenaScope {
+public:
+    ArenaScope(ImporterPimpl *pimpl, SceneArena *arena) :
+            mPimpl(pimpl),
+            mArena(arena),
+            mScope(arena) {
+        // empty
+    }
+
+    ~ArenaScope() {
+        if (mArena && mPimpl->mScene && nullptr == ScenePriv(mPimpl->mScene)->mArena) {
+            ScenePriv(mPimpl->mScene)->mArena = mArena.release();
+        }
+    }
+
+    // Creates the arena for a new import if AI_CONFIG_GLOB_SCENE_ARENA is set. Nested imports,
+    // e.g. of a BatchLoader, use the arena of the outer import since their objects end up in its
+    // scene.
+    static SceneArena *Create(const Importer &importer) {
+        if (!importer.GetPropertyBool(AI_CONFIG_GLOB_SCENE_ARENA, false) ||
+                nullptr != dynamic_cast<SceneArena *>(Allocator::GetActive())) {
+            return nullptr;
+        }
+        return new SceneArena(Allocator::GetActive());
+    }
+
+    // Takes the arena away from the current scene for the duration of the scope
+    static SceneArena *Detach(ImporterPimpl *pimpl) {
+        SceneArena *arena = SceneArena::Get(pimpl->mScene);
+        if (arena) {
+            ScenePriv(pimpl->mScene)->mArena = nullptr;
+        }
+        return arena;
+    }
+
+private:
+    ArenaScope(const ArenaScope &) = delete;
+    ArenaScope &operator=(const ArenaScope &) = delete;
+
+    ImporterPimpl *mPimpl;
+    std::unique_ptr<SceneArena> mArena;
+    Allocator::Scope mScope;
+};
+
+// ------------------------------------------------------------------------------------------------
+// Well-known magic numbers at the start of a file and the file extension
+// of the format they identify. Used to pick the importers to ask first
+// during signature-based detection.
+struct MagicToken {
+    const char *magic;
+    const char *extension;
+};
+
+const MagicToken MagicTokens[] = {
+    { "Kaydara FBX Binary", "fbx" },
+    { "; FBX", "fbx" },
+    { "ply", "ply" },
+    { "PLY", "ply" },
+    { "ASSIMP.binary-dump.", "assbin" },
+    { "ISO-10303-21", "ifc" },
+    { "xof ", "x" },
+    { "IDP2", "md2" },
+    { "IDP3", "md3" },
+    { "HIERARCHY", "bvh" }
+};
+
+// ------------------------------------------------------------------------------------------------
+// Asks the importers registered for an extension whether they can read the file.
+size_t ProbeImportersForExtension(const ImporterPimpl *pimpl, const std::string &ext, const std::string &pFile,
+        IOSystem &io, bool checkSig, std::vector<bool> &probed) {
+    const ImporterPimpl::ExtensionMap::const_iterator it = pimpl->mExtensionMap.find(ext);
+    if (it == pimpl->mExtensionMap.end()) {
+        return static_cast<size_t>(-1);
+    }
+    for (const unsigned int a : it->second) {
+        if (probed[a]) {
+            continue;
+        }
+        probed[a] = true;
+        if (pimpl->mImporter[a]->CanRead(pFile, &io, checkSig)) {
+            return a;
+        }
+    }
+    return static_cast<size_t>(-1);
+}
+
+// ------------------------------------------------------------------------------------------------
+// Find the index of the importer which can handle the file, all probes work on the already
+// opened file.
+size_t FindImporterForFile(const ImporterPimpl *pimpl, const std::string &pFile, ProbeIOSystem &io) {
+    const size_t numImporters = pimpl->mImporter.size();
+    std::vector<bool> probed(numImporters, false);
+
+    // The importers registered for the file extension are the most likely candidates
+    const std::string ext = BaseImporter::GetExtension(pFile);
+    size_t index = ProbeImportersForExtension(pimpl, ext, pFile, io, false, probed);
+    if (index < numImporters) {
+        return index;
+    }
+
+    // Some importers also accept files without or with unusual extensions
+    for (size_t a = 0; a < numImporters; ++a) {
+        if (!probed[a] && pimpl->mImporter[a]->CanRead(pFile, &io, false)) {
+            return a;
+        }
+    }
+
+    // not so bad yet ... try format auto detection.
+    const std::string::size_type s = pFile.find_last_of('.');
+    if (s == std::string::npos) {
+        return static_cast<size_t>(-1);
+    }
+    ASSIMP_LOG_INFO("File extension not known, trying signature-based detection");
+
+    // Start with the importers whose magic number is found in the header
+    std::fill(probed.begin(), probed.end(), false);
+    size_t headerSize = 0;
+    const uint8_t *header = io.Header(headerSize);
+    for (const MagicToken &token : MagicTokens) {
+        const size_t len = ::strlen(token.magic);
+        if (len <= headerSize && 0 == ::memcmp(header, token.magic, len)) {
+            index = ProbeImportersForExtension(pimpl, token.extension, pFile, io, true, probed);
+            if (index < numImporters) {
+                return index;
+            }
+        }
+    }
+
+    for (size_t a = 0; a < numImporters; ++a) {
+        if (!probed[a] && pimpl->mImporter[a]->CanRead(pFile, &io, true)) {
+            return a;
+        }
+    }
+
+    return static_cast<size_t>(-1);
+}
+
+// ------------------------------------------------------------------------------------------------
+// Creates a profiler recording the memory counters of the allocator of the importer, if it counts them.
+Profiler *CreateProfiler(const ImporterPimpl *pimpl) {
+    Profiler *profiler = new Profiler();
+    profiler->SetAllocator(dynamic_cast<CountingAllocator *>(pimpl->mAllocator));
+    return profiler;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Creates the import cache if one is configured and the import doesn't bypass it.
+ImportCache *CreateImportCache(const Importer &importer, const ImporterPimpl *pimpl) {
+#ifdef AI_IMPORT_CACHE_SUPPORTED
+    const std::string directory = importer.GetPropertyString(AI_CONFIG_IMPORT_CACHE_DIRECTORY, "");
+    if (directory.empty() || nullptr != pimpl->mMeshSink || importer.GetPropertyBool(AI_CONFIG_IMPORT_DEFER_MESH_DATA, false)) {
+        return nullptr;
+    }
+    const int maxSize = importer.GetPropertyInteger(AI_CONFIG_IMPORT_CACHE_MAX_SIZE, AI_IMPORT_CACHE_DEFAULT_MAX_SIZE);
+    return new ImportCache(directory, maxSize > 0 ? static_cast<uint64_t>(maxSize) * 1024 : 0);
+#else
+    (void)importer;
+    (void)pimpl;
+    return nullptr;
+#endif
+}
+
+// ------------------------------------------------------------------------------------------------
+// Makes the profiler of an import visible to importers and post-processing steps.
+struct ProfilerScope {
+    ImporterPimpl *mPimpl;
+    ProfilerScope(ImporterPimpl *pimpl, Profiler *profiler) :
+            mPimpl(pimpl) {
+        mPimpl->mProfiler = profiler;
+    }
+    ~ProfilerScope() {
+        mPimpl->mProfiler = nullptr;
+    }
+};
+
+// ------------------------------------------------------------------------------------------------
+// Replaces the statistics of the importer by the regions recorded by the profiler and the
+// counts of the given scene.
+void UpdateImportStatistics(ImporterPimpl *pimpl, const Profiler &profiler, size_t bytesRead) {
+    delete pimpl->mStatistics;
+    aiImportStatistics *stats = pimpl->mStatistics = new aiImportStatistics();
+
+    const std::vector<Profiler::Region> &regions = profiler.GetRegions();
+    stats->mNumRegions = static_cast<unsigned int>(regions.size());
+    stats->mRegions = new aiProfileRegion[regions.size()];
+    for (size_t i = 0; i < regions.size(); ++i) {
+        aiProfileRegion &region = stats->mRegions[i];
+        region.mName.Set(regions[i].mName);
+        region.mSeconds = regions[i].mSeconds;
+        region.mParent = regions[i].mParent;
+        region.mDepth = regions[i].mDepth;
+        region.mAllocatedBytes = regions[i].mAllocatedBytes;
+        region.mPeakBytes = regions[i].mPeakBytes;
+        region.mFused = regions[i].mFused ? 1 : 0;
+    }
+
+    stats->mBytesRead = bytesRead;
+    if (const aiScene *scene = pimpl->mScene) {
+        stats->mNumMeshes = scene->mNumMeshes;
+        for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+            stats->mNumVertices += scene->mMeshes[i]->mNumVertices;
+            stats->mNumFaces += scene->mMeshes[i]->mNumFaces;
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+// Appends s to out as JSON string literal.
+void WriteJSONString(std::ostringstream &out, const char *s) {
+    out << '"';
+    for (; *s; ++s) {
+        const unsigned char c = static_cast<unsigned char>(*s);
+        if ('"' == c || '\\' == c) {
+            out << '\\' << c;
+        } else if (c < 0x20) {
+            out << "\\u00" << std::hex << std::setw(2) << std::setfill('0') << static_cast<unsigned int>(c) << std::dec;
+        } else {
+            out << c;
+        }
+    }
+    out << '"';
+}
+
+// ------------------------------------------------------------------------------------------------
+// Writes the statistics of an import as JSON document to the given file.
+void WriteImportStatistics(const aiImportStatistics &stats, const std::string &pFile, const std::string &outFile, IOSystem *io) {
+    std::ostringstream out;
+    out.imbue(std::locale::classic());
+    out << std::setprecision(9);
+
+    out << "{\n  \"file\": ";
+    WriteJSONString(out, pFile.c_str());
+    out << ",\n  \"bytesRead\": " << stats.mBytesRead
+        << ",\n  \"meshes\": " << stats.mNumMeshes
+        << ",\n  \"vertices\": " << stats.mNumVertices
+        << ",\n  \"faces\": " << stats.mNumFaces
+        << ",\n  \"regions\": [";
+    for (unsigned int i = 0; i < stats.mNumRegions; ++i) {
+        const aiProfileRegion &region = stats.mRegions[i];
+        out << (i ? "," : "") << "\n    { \"name\": ";
+        WriteJSONString(out, region.mName.C_Str());
+        out << ", \"seconds\": " << region.mSeconds
+            << ", \"parent\": " << region.mParent
+            << ", \"depth\": " << region.mDepth
+            << ", \"allocatedBytes\": " << region.mAllocatedBytes
+            << ", \"peakBytes\": " << region.mPeakBytes
+            << ", \"fused\": " << (region.mFused ? "true" : "false") << " }";
+    }
+    out << "\n  ]\n}\n";
+
+    const std::string json = out.str();
+    std::unique_ptr<IOStream> stream(io->Open(outFile, "wb"));
+    if (!stream || json.size() != stream->Write(json.c_str(), 1, json.size())) {
+        ASSIMP_LOG_WARN("Unable to write import statistics to ", outFile);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+// Updates the statistics of an import and writes them to the configured file, if any.
+void FinishImportStatistics(const Importer &importer, ImporterPimpl *pimpl, const Profiler &profiler, size_t bytesRead, const std::string &pFile) {
+    UpdateImportStatistics(pimpl, profiler, bytesRead);
+    const std::string statisticsFile = importer.GetPropertyString(AI_CONFIG_GLOB_MEASURE_TIME_FILE, "");
+    if (!statisticsFile.empty()) {
+        WriteImportStatistics(*pimpl->mStatistics, pFile, statisticsFile, pimpl->mIOHandler);
+    }
+}
+
+} // namespace
+
 // ------------------------------------------------------------------------------------------------
 // Reads the given file and returns its contents if successful.
 const aiScene* Importer::ReadFile( const char* _pFile, unsigned int pFlags) {
@@ -584,6 +998,22 @@ const aiScene* Importer::ReadFile( const char* _pFile, unsigned int pFlags) {
     ASSIMP_BEGIN_EXCEPTION_REGION();
     const std::string pFile(_pFile);
 
+    // Check whether this Importer instance has already loaded
+    // a scene. In this case we need to delete the old one. This
+    // happens before the limits of the new import are bound, the
+    // old scene doesn't count against them.
+    if (pimpl->mScene)  {
+
+        ASSIMP_LOG_DEBUG("(Deleting previous scene)");
+        FreeScene();
+    }
+
+    delete pimpl->mStatistics;
+    pimpl->mStatistics = nullptr;
+
+    ImportScope importScope(*this, pimpl);
+    ArenaScope arenaScope(pimpl, ArenaScope::Create(*this));
+
     // ----------------------------------------------------------------------
     // Put a large try block around everything to catch all std::exception's
     // that might be thrown by STL containers or by new().
@@ -596,69 +1026,77 @@ const aiScene* Importer::ReadFile( const char* _pFile, unsigned int pFlags) {
     try
 #endif // ! ASSIMP_CATCH_GLOBAL_EXCEPTIONS
     {
-        // Check whether this Importer instance has already loaded
-        // a scene. In this case we need to delete the old one
-        if (pimpl->mScene)  {
-
-            ASSIMP_LOG_DEBUG("(Deleting previous scene)");
-            FreeScene();
-        }
-
-        // First check if the file is accessible at all
-        if( !pimpl->mIOHandler->Exists( pFile)) {
+        // With time measurement enabled, count the bytes read from all files. The
+        // import cache needs to know which files were read.
+        std::unique_ptr<Profiler> profiler(GetPropertyInteger(AI_CONFIG_GLOB_MEASURE_TIME, 0) ? CreateProfiler(pimpl) : nullptr);
+        std::unique_ptr<ImportCache> cache(CreateImportCache(*this, pimpl));
+        std::unique_ptr<CountingIOSystem> countingIO((profiler || cache) ? new CountingIOSystem(pimpl->mIOHandler) : nullptr);
+        ProfilerScope profilerScope(pimpl, profiler.get());
+
+        // First check if the file is accessible at all. It is opened only once,
+        // format detection and the import itself share this stream.
+        ProbeIOSystem probeIO(pFile, countingIO ? countingIO.get() : pimpl->mIOHandler);
+        if( !probeIO.OpenFile() && !pimpl->mIOHandler->Exists( pFile)) {
 
             pimpl->mErrorString = "Unable to open file \"" + pFile + "\".";
             ASSIMP_LOG_ERROR(pimpl->mErrorString);
             return nullptr;
         }
 
-        std::unique_ptr<Profiler> profiler(GetPropertyInteger(AI_CONFIG_GLOB_MEASURE_TIME, 0) ? new Profiler() : nullptr);
         if (profiler) {
             profiler->BeginRegion("total");
         }
 
-        // Find an worker class which can handle the file
-        BaseImporter* imp = nullptr;
-        SetPropertyInteger("importerIndex", -1);
-        for( unsigned int a = 0; a < pimpl->mImporter.size(); a++)  {
+#ifdef AI_IMPORT_CACHE_SUPPORTED
+        // Serve the post-processed scene from the cache if the input didn't change
+        if (cache) {
+            if (profiler) {
+                profiler->BeginRegion("cache");
+            }
 
-            if( pimpl->mImporter[a]->CanRead( pFile, pimpl->mIOHandler, false)) {
-                imp = pimpl->mImporter[a];
-                SetPropertyInteger("importerIndex", a);
-                break;
+            if (!cache->ComputeKey(pimpl, pFile, &probeIO, pFlags)) {
+                cache.reset();
+            } else if (nullptr != (pimpl->mScene = cache->Load(pimpl->mIOHandler))) {
+                ASSIMP_LOG_INFO("Loaded the scene from the import cache: ", cache->GetEntryPath());
             }
-        }
 
-        if (!imp)   {
-            // not so bad yet ... try format auto detection.
-            const std::string::size_type s = pFile.find_last_of('.');
-            if (s != std::string::npos) {
-                ASSIMP_LOG_INFO("File extension not known, trying signature-based detection");
-                for( unsigned int a = 0; a < pimpl->mImporter.size(); a++)  {
-                    if( pimpl->mImporter[a]->CanRead( pFile, pimpl->mIOHandler, true)) {
-                        imp = pimpl->mImporter[a];
-                        SetPropertyInteger("importerIndex", a);
-                        break;
-                    }
-                }
+            if (profiler) {
+                profiler->EndRegion("cache");
             }
-            // Put a proper error message if no suitable importer was found
-            if( !imp)   {
-                pimpl->mErrorString = "No suitable reader found for the file format of file \"" + pFile + "\".";
-                ASSIMP_LOG_ERROR(pimpl->mErrorString);
-                return nullptr;
+        }
+
+        if (pimpl->mScene) {
+            // the entry holds the scene after these steps, don't let the exporter repeat them
+            ScenePriv(pimpl->mScene)->mPPStepsApplied |= pFlags & ~aiProcess_ValidateDataStructure;
+            SetPropertyInteger("importerIndex", -1);
+            SetPropertyString("sourceFilePath", pFile);
+            if (profiler) {
+                profiler->EndRegion("total");
+                FinishImportStatistics(*this, pimpl, *profiler, countingIO->GetBytesRead(), pFile);
             }
+            return pimpl->mScene;
         }
+#endif // AI_IMPORT_CACHE_SUPPORTED
 
-        // Get file size for progress handler
-        IOStream * fileIO = pimpl->mIOHandler->Open( pFile );
-        uint32_t fileSize = 0;
-        if (fileIO)
-        {
-            fileSize = static_cast<uint32_t>(fileIO->FileSize());
-            pimpl->mIOHandler->Close( fileIO );
+        // Find an worker class which can handle the file
+        BaseImporter* imp = nullptr;
+        SetPropertyInteger("importerIndex", -1);
+        const size_t impIndex = FindImporterForFile(pimpl, pFile, probeIO);
+        if (impIndex < pimpl->mImporter.size()) {
+            imp = pimpl->mImporter[impIndex];
+            SetPropertyInteger("importerIndex", static_cast<int>(impIndex));
+        }
+
+        // Put a proper error message if no suitable importer was found
+        if( !imp)   {
+            pimpl->mErrorString = "No suitable reader found for the file format of file \"" + pFile + "\".";
+            ASSIMP_LOG_ERROR(pimpl->mErrorString);
+            return nullptr;
         }
 
+        // Get file size for progress handler
+        const uint32_t fileSize = static_cast<uint32_t>(probeIO.FileSize());
+
         // Dispatch the reading to the worker class for this format
         const aiImporterDesc *desc( imp->GetInfo() );
         std::string ext( "unknown" );
@@ -668,11 +1106,14 @@ const aiScene* Importer::ReadFile( const char* _pFile, unsigned int pFlags) {
         ASSIMP_LOG_INFO("Found a matching importer for this file format: ", ext, "." );
         pimpl->mProgressHandler->UpdateFileRead( 0, fileSize );
 
+        // importers may parse on the worker threads as well
+        pimpl->UpdateTaskScheduler();
+
         if (profiler) {
             profiler->BeginRegion("import");
         }
 
-        pimpl->mScene = imp->ReadFile( this, pFile, pimpl->mIOHandler);
+        pimpl->mScene = imp->ReadFile( this, pFile, &probeIO);
         pimpl->mProgressHandler->UpdateFileRead( fileSize, fileSize );
 
         if (profiler) {
@@ -690,9 +1131,12 @@ const aiScene* Importer::ReadFile( const char* _pFile, unsigned int pFlags) {
                 pimpl->mScene->mMetaData->Add(AI_METADATA_SOURCE_FORMAT, aiString(ext));
             }
 
+            // meshes without payload can't be validated or post-processed
+            const bool deferred = 0 != (pimpl->mScene->mFlags & AI_SCENE_FLAGS_DEFERRED_MESH_DATA);
+
 #ifndef ASSIMP_BUILD_NO_VALIDATEDS_PROCESS
             // The ValidateDS process is an exception. It is executed first, even before ScenePreprocessor is called.
-            if (pFlags & aiProcess_ValidateDataStructure) {
+            if ((pFlags & aiProcess_ValidateDataStructure) && !deferred) {
                 ValidateDSProcess ds;
                 ds.ExecuteOnScene (this);
                 if (!pimpl->mScene) {
@@ -713,8 +1157,36 @@ const aiScene* Importer::ReadFile( const char* _pFile, unsigned int pFlags) {
                 profiler->EndRegion("preprocess");
             }
 
-            // Ensure that the validation process won't be called twice
-            ApplyPostProcessing(pFlags & (~aiProcess_ValidateDataStructure));
+            if (deferred) {
+                // the payload is loaded on demand, see LoadMeshData()
+                pimpl->mDeferredImporter = imp;
+                pimpl->mDeferredFile = pFile;
+                if (pFlags) {
+                    ASSIMP_LOG_INFO("Skipping post processing, the scene has deferred meshes");
+                }
+            } else {
+                // Ensure that the validation process won't be called twice
+                ApplyPostProcessing(pFlags & (~aiProcess_ValidateDataStructure));
+            }
+
+#ifdef AI_IMPORT_CACHE_SUPPORTED
+            if (pimpl->mScene && cache && !deferred) {
+                if (profiler) {
+                    profiler->BeginRegion("cache");
+                }
+
+                // a failure to write the cache doesn't fail the import
+                try {
+                    cache->Store(pimpl->mScene, countingIO->GetOpenedFiles(), pimpl->mIOHandler);
+                } catch (const std::exception &e) {
+                    ASSIMP_LOG_WARN("Unable to store the scene in the import cache: ", e.what());
+                }
+
+                if (profiler) {
+                    profiler->EndRegion("cache");
+                }
+            }
+#endif // AI_IMPORT_CACHE_SUPPORTED
         }
         // if failed, extract the error string
         else if( !pimpl->mScene) {
@@ -727,6 +1199,7 @@ const aiScene* Importer::ReadFile( const char* _pFile, unsigned int pFlags) {
 
         if (profiler) {
             profiler->EndRegion("total");
+            FinishImportStatistics(*this, pimpl, *profiler, countingIO->GetBytesRead(), pFile);
         }
     }
 #ifdef ASSIMP_CATCH_GLOBAL_EXCEPTIONS
@@ -737,6 +1210,7 @@ const aiScene* Importer::ReadFile( const char* _pFile, unsigned int pFlags) {
 #else
         pimpl->mErrorString = std::string("std::exception: ") + e.what();
 #endif
+        pimpl->mException = std::current_exception();
 
         ASSIMP_LOG_ERROR(pimpl->mErrorString);
         delete pimpl->mScene; pimpl->mScene = nullptr;
@@ -760,12 +1234,22 @@ const aiScene* Importer::ApplyPostProcessing(unsigned int pFlags) {
     if (!pimpl->mScene) {
         return nullptr;
     }
+    ImportScope importScope(*this, pimpl);
 
     // If no flags are given, return the current scene with no further action
     if (!pFlags) {
         return pimpl->mScene;
     }
 
+    if (pimpl->mScene->mFlags & AI_SCENE_FLAGS_DEFERRED_MESH_DATA) {
+        pimpl->mErrorString = "Post processing needs the data of all meshes, load them with LoadMeshData() first";
+        ASSIMP_LOG_ERROR(pimpl->mErrorString);
+        return nullptr;
+    }
+
+    // objects created by the steps go to the arena of the scene as well
+    ArenaScope arenaScope(pimpl, ArenaScope::Detach(pimpl));
+
     // In debug builds: run basic flag validation
     ai_assert(_ValidateFlags(pFlags));
     ASSIMP_LOG_INFO("Entering post processing pipeline");
@@ -795,19 +1279,77 @@ const aiScene* Importer::ApplyPostProcessing(unsigned int pFlags) {
     }
 #endif // ! DEBUG
 
-    std::unique_ptr<Profiler> profiler(GetPropertyInteger(AI_CONFIG_GLOB_MEASURE_TIME, 0) ? new Profiler() : nullptr);
+    pimpl->UpdateTaskScheduler();
+
+    // Record into the profiler of the running import, if any
+    std::unique_ptr<Profiler> ownProfiler;
+    Profiler* profiler = pimpl->mProfiler;
+    if (!profiler && GetPropertyInteger(AI_CONFIG_GLOB_MEASURE_TIME, 0)) {
+        ownProfiler.reset(CreateProfiler(pimpl));
+        profiler = ownProfiler.get();
+    }
+    if (profiler) {
+        profiler->BeginRegion("postprocess");
+    }
+
+    // Consecutive steps supporting mesh passes are run back to back on each mesh.
+    // Re-validating after each step requires them to run separately, though.
+    const bool fuseSteps = GetPropertyBool(AI_CONFIG_PP_FUSE_STEPS, true) && !pimpl->bExtraVerbose;
+    std::vector<BaseProcess*> fused;
+    std::vector<double> timings;
+    // Steps below this index already got their SetupProperties() call while grouping
+    unsigned int setUp = 0;
+
     for( unsigned int a = 0; a < pimpl->mPostProcessingSteps.size(); a++)   {
         BaseProcess* process = pimpl->mPostProcessingSteps[a];
         pimpl->mProgressHandler->UpdatePostProcess(static_cast<int>(a), static_cast<int>(pimpl->mPostProcessingSteps.size()) );
         if( process->IsActive( pFlags)) {
-            if (profiler) {
-                profiler->BeginRegion("postprocess");
+            fused.clear();
+            unsigned int last = a;
+            if (fuseSteps) {
+                if (a >= setUp) {
+                    process->SetupProperties(this);
+                    setUp = a + 1;
+                }
+                if (process->SupportsMeshPass()) {
+                    fused.push_back(process);
+                    for (unsigned int b = a + 1; b < pimpl->mPostProcessingSteps.size(); ++b) {
+                        BaseProcess* next = pimpl->mPostProcessingSteps[b];
+                        if (next->IsActive(pFlags)) {
+                            next->SetupProperties(this);
+                            setUp = b + 1;
+                            if (!next->SupportsMeshPass()) {
+                                break;
+                            }
+                            fused.push_back(next);
+                        }
+                        last = b;
+                    }
+                }
             }
 
-            process->ExecuteOnScene ( this );
+            if (fused.size() > 1) {
+                for (; a < last; ++a) {
+                    pimpl->mProgressHandler->UpdatePostProcess(static_cast<int>(a + 1), static_cast<int>(pimpl->mPostProcessingSteps.size()) );
+                }
+
+                BaseProcess::ExecuteFusedOnScene(this, fused, profiler ? &timings : nullptr);
 
-            if (profiler) {
-                profiler->EndRegion("postprocess");
+                if (profiler) {
+                    for (size_t f = 0; f < fused.size(); ++f) {
+                        profiler->AddRegion(fused[f]->GetName(), timings[f]);
+                    }
+                }
+            } else {
+                if (profiler) {
+                    profiler->BeginRegion(process->GetName());
+                }
+
+                process->ExecuteOnScene ( this, !fuseSteps );
+
+                if (profiler) {
+                    profiler->EndRegion(process->GetName());
+                }
             }
         }
         if( !pimpl->mScene) {
@@ -835,6 +1377,13 @@ const aiScene* Importer::ApplyPostProcessing(unsigned int pFlags) {
     pimpl->mProgressHandler->UpdatePostProcess( static_cast<int>(pimpl->mPostProcessingSteps.size()), 
         static_cast<int>(pimpl->mPostProcessingSteps.size()) );
 
+    if (profiler) {
+        profiler->EndRegion("postprocess");
+    }
+    if (ownProfiler) {
+        UpdateImportStatistics(pimpl, *ownProfiler, 0);
+    }
+
     // update private scene flags
     if( pimpl->mScene ) {
       ScenePriv(pimpl->mScene)->mPPStepsApplied |= pFlags;
@@ -859,12 +1408,21 @@ const aiScene* Importer::ApplyCustomizedPostProcessing( BaseProcess *rootProcess
     if ( nullptr == pimpl->mScene ) {
         return nullptr;
     }
+    ImportScope importScope(*this, pimpl);
 
     // If no flags are given, return the current scene with no further action
     if (nullptr == rootProcess) {
         return pimpl->mScene;
     }
 
+    if (pimpl->mScene->mFlags & AI_SCENE_FLAGS_DEFERRED_MESH_DATA) {
+        pimpl->mErrorString = "Post processing needs the data of all meshes, load them with LoadMeshData() first";
+        ASSIMP_LOG_ERROR(pimpl->mErrorString);
+        return nullptr;
+    }
+
+    ArenaScope arenaScope(pimpl, ArenaScope::Detach(pimpl));
+
     // In debug builds: run basic flag validation
     ASSIMP_LOG_INFO( "Entering customized post processing pipeline" );
 
@@ -893,7 +1451,9 @@ const aiScene* Importer::ApplyCustomizedPostProcessing( BaseProcess *rootProcess
     }
 #endif // ! DEBUG
 
-    std::unique_ptr<Profiler> profiler(GetPropertyInteger(AI_CONFIG_GLOB_MEASURE_TIME, 0) ? new Profiler() : nullptr);
+    pimpl->UpdateTaskScheduler();
+
+    std::unique_ptr<Profiler> profiler(GetPropertyInteger(AI_CONFIG_GLOB_MEASURE_TIME, 0) ? CreateProfiler(pimpl) : nullptr);
 
     if ( profiler ) {
         profiler->BeginRegion( "postprocess" );
@@ -903,6 +1463,7 @@ const aiScene* Importer::ApplyCustomizedPostProcessing( BaseProcess *rootProcess
 
     if ( profiler ) {
         profiler->EndRegion( "postprocess" );
+        UpdateImportStatistics( pimpl, *profiler, 0 );
     }
 
     // If the extra verbose mode is active, execute the ValidateDataStructureStep again - after each step
@@ -925,6 +1486,57 @@ const aiScene* Importer::ApplyCustomizedPostProcessing( BaseProcess *rootProcess
     return pimpl->mScene;
 }
 
+// ------------------------------------------------------------------------------------------------
+// Load the payload of a deferred mesh of the current scene
+bool Importer::LoadMeshData(unsigned int meshIndex) {
+    ai_assert(nullptr != pimpl);
+
+    ASSIMP_BEGIN_EXCEPTION_REGION();
+    aiScene *scene = pimpl->mScene;
+    if (nullptr == scene || meshIndex >= scene->mNumMeshes) {
+        return false;
+    }
+
+    aiMesh *mesh = scene->mMeshes[meshIndex];
+    if (!mesh->HasDeferredData()) {
+        return true;
+    }
+
+    if (nullptr == pimpl->mDeferredImporter) {
+        pimpl->mErrorString = "The importer of the scene is gone, deferred meshes can't be loaded anymore";
+        ASSIMP_LOG_ERROR(pimpl->mErrorString);
+        return false;
+    }
+
+    ImportScope importScope(*this, pimpl);
+    ArenaScope arenaScope(pimpl, ArenaScope::Detach(pimpl));
+    BaseImporter *imp = pimpl->mDeferredImporter;
+    if (!imp->ReadMeshData(pimpl->mDeferredFile, scene, meshIndex, pimpl->mIOHandler)) {
+        pimpl->mErrorString = imp->GetErrorText();
+        pimpl->mException = imp->GetException();
+        return false;
+    }
+    if (mesh->HasDeferredData()) {
+        pimpl->mErrorString = "The importer did not provide the data of the deferred mesh";
+        ASSIMP_LOG_ERROR(pimpl->mErrorString);
+        return false;
+    }
+
+    ScenePreprocessor pre(scene);
+    pre.ProcessMesh(mesh);
+
+    // the scene is complete once the last mesh is there
+    for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+        if (scene->mMeshes[i]->HasDeferredData()) {
+            return true;
+        }
+    }
+    scene->mFlags &= ~AI_SCENE_FLAGS_DEFERRED_MESH_DATA;
+    ReleaseDeferredMeshes(pimpl);
+    ASSIMP_END_EXCEPTION_REGION(bool);
+    return true;
+}
+
 // ------------------------------------------------------------------------------------------------
 // Helper function to check whether an extension is supported by ASSIMP
 bool Importer::IsExtensionSupported(const char* szExtension) const {
@@ -983,16 +1595,9 @@ size_t Importer::GetImporterIndex (const char* szExtension) const {
         return static_cast<size_t>(-1);
     }
     ext = ai_tolower(ext);
-    std::set<std::string> str;
-    for (std::vector<BaseImporter*>::const_iterator i =  pimpl->mImporter.begin();i != pimpl->mImporter.end();++i)  {
-        str.clear();
-
-        (*i)->GetExtensionList(str);
-        for (std::set<std::string>::const_iterator it = str.begin(); it != str.end(); ++it) {
-            if (ext == *it) {
-                return std::distance(static_cast< std::vector<BaseImporter*>::const_iterator >(pimpl->mImporter.begin()), i);
-            }
-        }
+    const ImporterPimpl::ExtensionMap::const_iterator it = pimpl->mExtensionMap.find(ext);
+    if (it != pimpl->mExtensionMap.end()) {
+        return it->second.front();
     }
     ASSIMP_END_EXCEPTION_REGION(size_t);
     return static_cast<size_t>(-1);
@@ -1120,6 +1725,14 @@ void AddNodeWeight(unsigned int& iScene,const aiNode* pcNode) {
     }
 }
 
+// ------------------------------------------------------------------------------------------------
+// Get the statistics of the last measured import
+const aiImportStatistics* Importer::GetImportStatistics() const {
+    ai_assert(nullptr != pimpl);
+
+    return pimpl->mStatistics;
+}
+
 // ------------------------------------------------------------------------------------------------
 // Get the memory requirements of the scene
 void Importer::GetMemoryRequirements(aiMemoryInfo& in) const {
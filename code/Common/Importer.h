@@ -46,6 +46,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <exception>
 #include <map>
+#include <unordered_map>
 #include <vector>
 #include <string>
 #include <assimp/matrix4x4.h>
@@ -54,10 +55,18 @@ struct aiScene;
 
 namespace Assimp    {
     class ProgressHandler;
+    class MeshSink;
     class IOSystem;
     class BaseImporter;
     class BaseProcess;
     class SharedPostProcessInfo;
+    class TaskScheduler;
+    class ImportLimits;
+    class Allocator;
+
+    namespace Profiling {
+        class Profiler;
+    }
 
 
 //! @cond never
@@ -80,6 +89,9 @@ public:
     typedef std::map<KeyType, std::string> StringPropertyMap;
     typedef std::map<KeyType, aiMatrix4x4> MatrixPropertyMap;
 
+    // lower-case file extension to the indices of all importers supporting it
+    typedef std::unordered_map<std::string, std::vector<unsigned int> > ExtensionMap;
+
     /** IO handler to use for all file accesses. */
     IOSystem* mIOHandler;
     bool mIsDefaultHandler;
@@ -88,9 +100,19 @@ public:
     ProgressHandler* mProgressHandler;
     bool mIsDefaultProgressHandler;
 
+    /** Receiver of streamed meshes, not owned. */
+    MeshSink* mMeshSink;
+
+    /** Allocator of the scene objects, not owned. */
+    Allocator* mAllocator;
+
     /** Format-specific importer worker objects - one for each format we can read.*/
     std::vector< BaseImporter* > mImporter;
 
+    /** Lookup table for mImporter by file extension, importer indices are
+     *  stored in registration order. */
+    ExtensionMap mExtensionMap;
+
     /** Post processing steps we can apply at the imported data. */
     std::vector< BaseProcess* > mPostProcessingSteps;
 
@@ -123,8 +145,34 @@ public:
     /** Used by post-process steps to share data */
     SharedPostProcessInfo* mPPShared;
 
+    /** Runs the per-mesh work of post-process steps, nullptr if
+     *  AI_CONFIG_GLOB_MULTITHREADING disables multithreading. */
+    TaskScheduler* mTaskScheduler;
+
+    /** Records the timings of the running import, nullptr unless
+     *  AI_CONFIG_GLOB_MEASURE_TIME is enabled. */
+    Profiling::Profiler* mProfiler;
+
+    /** Statistics of the last measured import, nullptr if there are none. */
+    aiImportStatistics* mStatistics;
+
+    /** Importer and file of mScene if it has deferred meshes, see
+     *  AI_CONFIG_IMPORT_DEFER_MESH_DATA. */
+    BaseImporter* mDeferredImporter;
+    std::string mDeferredFile;
+
+    /** Limits of the running import, nullptr outside of it or if
+     *  AI_CONFIG_IMPORT_MAX_MEMORY and AI_CONFIG_IMPORT_TIMEOUT are unset. */
+    ImportLimits* mLimits;
+
     /// The default class constructor.
     ImporterPimpl() AI_NO_EXCEPT;
+
+    /// Rebuilds mExtensionMap, to be called whenever mImporter changes.
+    void UpdateExtensionMap();
+
+    /// (Re-)creates mTaskScheduler according to AI_CONFIG_GLOB_MULTITHREADING.
+    void UpdateTaskScheduler();
 };
 
 inline
@@ -133,7 +181,10 @@ ImporterPimpl::ImporterPimpl() AI_NO_EXCEPT :
         mIsDefaultHandler( false ),
         mProgressHandler( nullptr ),
         mIsDefaultProgressHandler( false ),
+        mMeshSink( nullptr ),
+        mAllocator( nullptr ),
         mImporter(),
+        mExtensionMap(),
         mPostProcessingSteps(),
         mScene( nullptr ),
         mErrorString(),
@@ -143,7 +194,13 @@ ImporterPimpl::ImporterPimpl() AI_NO_EXCEPT :
         mStringProperties(),
         mMatrixProperties(),
         bExtraVerbose( false ),
-        mPPShared( nullptr ) {
+        mPPShared( nullptr ),
+        mTaskScheduler( nullptr ),
+        mProfiler( nullptr ),
+        mStatistics( nullptr ),
+        mDeferredImporter( nullptr ),
+        mDeferredFile(),
+        mLimits( nullptr ) {
     // empty
 }
 //! @endcond
@@ -154,10 +211,15 @@ struct BatchData;
 /** FOR IMPORTER PLUGINS ONLY: A helper class to the pleasure of importers
  *  that need to load many external meshes recursively.
  *
- *  The class uses several threads to load these meshes (or at least it
- *  could, this has not yet been implemented at the moment).
+ *  The requests are loaded by a pool of worker threads, each of them using
+ *  its own Importer. All workers share the IOSystem passed to the
+ *  constructor, their accesses to it are serialized. Importers pass their
+ *  own thread count (see #AI_CONFIG_GLOB_MULTITHREADING) to the constructor;
+ *  with a single thread all requests are loaded on the calling thread and
+ *  the IOSystem is used as is.
  *
- *  @note The class may not be used by more than one thread*/
+ *  @note The class may not be used by more than one thread. While loading
+ *    runs in the background, the IOSystem may not be used directly. */
 class ASSIMP_API BatchLoader {
 public:
     //! @cond never
@@ -184,8 +246,10 @@ public:
     // -------------------------------------------------------------------
     /** Construct a batch loader from a given IO system to be used
      *  to access external files 
+     *  @param  numThreads  Initial size of the worker pool, see
+     *    setNumThreads(). Importers pass BaseImporter::m_numThreads.
      */
-    explicit BatchLoader(IOSystem* pIO, bool validate = false );
+    explicit BatchLoader(IOSystem* pIO, bool validate = false, unsigned int numThreads = 1 );
 
     // -------------------------------------------------------------------
     /** The class destructor.
@@ -203,9 +267,23 @@ public:
      *  @return The current validation step.
      */
     bool getValidation() const;
+
+    // -------------------------------------------------------------------
+    /** Sets the number of threads used to load the requests.
+     *  Takes effect with the next call to LoadAll() or StartLoading().
+     *  @param  numThreads  Number of worker threads, 0 selects the number
+     *    of hardware threads. 1 loads all files on the calling thread. */
+    void setNumThreads( unsigned int numThreads );
+
+    // -------------------------------------------------------------------
+    /** Returns the number of threads used to load the requests.
+     *  @return The number of threads, at least 1. */
+    unsigned int getNumThreads() const;
     
     // -------------------------------------------------------------------
     /** Add a new file to the list of files to be loaded.
+     *  Requests for the same file with the same post-processing steps
+     *  and properties share one channel, the file is loaded only once.
      *  @param file File to be loaded
      *  @param steps Post-processing steps to be executed on the file
      *  @param map Optional configuration properties
@@ -225,12 +303,23 @@ public:
      *  can be called several times, too.
      *
      *  @param which LRWC returned by AddLoadRequest().
+     *  @param wait If the scene hasn't been loaded yet, load it or wait
+     *    for the worker thread loading it instead of returning nullptr.
+     *    The other queued requests are not waited for.
      *  @return nullptr if there is no scene with this file name
      *  in the queue of the scene hasn't been loaded yet. */
     aiScene* GetImport(
-        unsigned int which
+        unsigned int which,
+        bool wait = false
         );
 
+    // -------------------------------------------------------------------
+    /** Starts loading all queued scenes in the background and returns
+     *  immediately. Use GetImport() with wait set to pick up single
+     *  scenes as soon as they are available. Does nothing if only one
+     *  thread is used. */
+    void StartLoading();
+
     // -------------------------------------------------------------------
     /** Waits until all scenes have been loaded. This returns
      *  immediately if no scenes are queued.*/
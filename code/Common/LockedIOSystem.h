@@ -0,0 +1,229 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2021, assimp team
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file LockedIOSystem.h
+ *  Implements an IOSystem wrapper which serializes all accesses to an
+ *  IOSystem shared by several threads.
+ */
+#pragma once
+#ifndef AI_LOCKEDIOSYSTEM_H_INC
+#define AI_LOCKEDIOSYSTEM_H_INC
+
+#include <assimp/IOStream.hpp>
+#include <assimp/IOSystem.hpp>
+#include <assimp/ai_assert.h>
+
+#include <mutex>
+#include <string>
+
+namespace Assimp {
+
+// ---------------------------------------------------------------------------
+/** Stream wrapper which locks the mutex of its LockedIOSystem for every
+ *  call on the wrapped stream. */
+class LockedIOStream : public IOStream {
+public:
+    LockedIOStream(IOStream *wrapped, std::mutex &mutex) :
+            mWrapped(wrapped), mMutex(mutex) {
+        ai_assert(nullptr != mWrapped);
+    }
+
+    /** Returns the wrapped stream. */
+    IOStream *Wrapped() const {
+        return mWrapped;
+    }
+
+    // -------------------------------------------------------------------
+    /** Read from stream */
+    size_t Read(void *pvBuffer, size_t pSize, size_t pCount) override {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return mWrapped->Read(pvBuffer, pSize, pCount);
+    }
+
+    // -------------------------------------------------------------------
+    /** Write to stream */
+    size_t Write(const void *pvBuffer, size_t pSize, size_t pCount) override {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return mWrapped->Write(pvBuffer, pSize, pCount);
+    }
+
+    // -------------------------------------------------------------------
+    /** Seek specific position */
+    aiReturn Seek(size_t pOffset, aiOrigin pOrigin) override {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return mWrapped->Seek(pOffset, pOrigin);
+    }
+
+    // -------------------------------------------------------------------
+    /** Get current seek position */
+    size_t Tell() const override {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return mWrapped->Tell();
+    }
+
+    // -------------------------------------------------------------------
+    /** Get size of file */
+    size_t FileSize() const override {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return mWrapped->FileSize();
+    }
+
+    // -------------------------------------------------------------------
+    /** Flush file contents */
+    void Flush() override {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mWrapped->Flush();
+    }
+
+    // -------------------------------------------------------------------
+    /** Forwards the view of the wrapped stream. The view itself is
+     *  immutable, reading from it needs no lock. */
+    const uint8_t *GetContiguousView() const override {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return mWrapped->GetContiguousView();
+    }
+
+private:
+    IOStream *mWrapped;
+    std::mutex &mMutex;
+};
+
+// ---------------------------------------------------------------------------
+/** IOSystem wrapper used by BatchLoader to share one IOSystem between
+ *  its worker threads. Every worker gets its own LockedIOSystem, all of
+ *  them lock the same mutex before calling into the wrapped IOSystem.
+ *
+ *  The directory stack is kept per wrapper, so the Push/PopDirectory calls
+ *  of importers running on different threads do not interfere. It starts
+ *  with the current directory of the wrapped IOSystem. */
+class LockedIOSystem : public IOSystem {
+public:
+    /** Constructor. */
+    LockedIOSystem(IOSystem *wrapped, std::mutex &mutex) :
+            mWrapped(wrapped), mMutex(mutex) {
+        ai_assert(nullptr != mWrapped);
+
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (mWrapped->StackSize() > 0) {
+            IOSystem::PushDirectory(mWrapped->CurrentDirectory());
+        }
+    }
+
+    // -------------------------------------------------------------------
+    /** Tests for the existence of a file at the given path. */
+    bool Exists(const char *pFile) const override {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return mWrapped->Exists(pFile);
+    }
+
+    // -------------------------------------------------------------------
+    /** Returns the directory separator. */
+    char getOsSeparator() const override {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return mWrapped->getOsSeparator();
+    }
+
+    // -------------------------------------------------------------------
+    /** Open a new file with a given path. */
+    IOStream *Open(const char *pFile, const char *pMode = "rb") override {
+        std::lock_guard<std::mutex> lock(mMutex);
+        IOStream *stream = mWrapped->Open(pFile, pMode);
+        return nullptr != stream ? new LockedIOStream(stream, mMutex) : nullptr;
+    }
+
+    // -------------------------------------------------------------------
+    /** Closes the given file and releases all resources associated with it. */
+    void Close(IOStream *pFile) override {
+        if (nullptr == pFile) {
+            return;
+        }
+        LockedIOStream *locked = dynamic_cast<LockedIOStream *>(pFile);
+        ai_assert(nullptr != locked);
+
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mWrapped->Close(locked->Wrapped());
+        }
+        delete locked;
+    }
+
+    // -------------------------------------------------------------------
+    /** Compare two paths */
+    bool ComparePaths(const char *one, const char *second) const override {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return mWrapped->ComparePaths(one, second);
+    }
+
+    // -------------------------------------------------------------------
+    /** Creates an new directory at the given path. */
+    bool CreateDirectory(const std::string &path) override {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return mWrapped->CreateDirectory(path);
+    }
+
+    // -------------------------------------------------------------------
+    /** Will change the current directory to the given path. */
+    bool ChangeDirectory(const std::string &path) override {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return mWrapped->ChangeDirectory(path);
+    }
+
+    // -------------------------------------------------------------------
+    /** Delete file. */
+    bool DeleteFile(const std::string &file) override {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return mWrapped->DeleteFile(file);
+    }
+
+    // -------------------------------------------------------------------
+    /** Rename file. */
+    bool RenameFile(const std::string &from, const std::string &to) override {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return mWrapped->RenameFile(from, to);
+    }
+
+private:
+    IOSystem *mWrapped;
+    std::mutex &mMutex;
+};
+
+} // namespace Assimp
+
+#endif // AI_LOCKEDIOSYSTEM_H_INC
@@ -0,0 +1,249 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2021, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+/** @file  MemoryMappedIOSystem.cpp
+ *  @brief Memory mapped file I/O implementation for #Importer
+ */
+
+#include <assimp/MemoryMappedIOSystem.h>
+#include <assimp/ai_assert.h>
+#include <assimp/DefaultLogger.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+#ifdef _WIN32
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+using namespace Assimp;
+
+namespace {
+
+// ------------------------------------------------------------------------------------------------
+// Only pure read modes are served by a mapping, everything else goes to the default IO.
+bool IsReadOnlyMode(const char *mode) {
+    return nullptr != ::strchr(mode, 'r') && nullptr == ::strchr(mode, '+') &&
+           nullptr == ::strchr(mode, 'w') && nullptr == ::strchr(mode, 'a');
+}
+
+#ifdef _WIN32
+// ------------------------------------------------------------------------------------------------
+std::wstring Utf8ToWide(const char *in) {
+    int size = MultiByteToWideChar(CP_UTF8, 0, in, -1, nullptr, 0);
+    if (size <= 0) {
+        return std::wstring();
+    }
+    // size includes terminating null; std::wstring adds null automatically
+    std::wstring out(static_cast<size_t>(size) - 1, L'\0');
+    MultiByteToWideChar(CP_UTF8, 0, in, -1, &out[0], size);
+    return out;
+}
+
+// ------------------------------------------------------------------------------------------------
+const uint8_t *MapFile(const char *path, size_t &length) {
+    const std::wstring name = Utf8ToWide(path);
+    if (name.empty()) {
+        return nullptr;
+    }
+    HANDLE file = ::CreateFileW(name.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+            FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (INVALID_HANDLE_VALUE == file) {
+        return nullptr;
+    }
+    LARGE_INTEGER size;
+    if (!::GetFileSizeEx(file, &size) || 0 == size.QuadPart) {
+        ::CloseHandle(file);
+        return nullptr;
+    }
+    HANDLE mapping = ::CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    ::CloseHandle(file);
+    if (nullptr == mapping) {
+        return nullptr;
+    }
+    // the view keeps the mapping object alive
+    void *data = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    ::CloseHandle(mapping);
+    if (nullptr == data) {
+        return nullptr;
+    }
+    length = static_cast<size_t>(size.QuadPart);
+    return static_cast<const uint8_t *>(data);
+}
+
+// ------------------------------------------------------------------------------------------------
+void UnmapFile(const uint8_t *data, size_t /*length*/) {
+    ::UnmapViewOfFile(data);
+}
+#else
+// ------------------------------------------------------------------------------------------------
+const uint8_t *MapFile(const char *path, size_t &length) {
+    const int fd = ::open(path, O_RDONLY);
+    if (-1 == fd) {
+        return nullptr;
+    }
+    struct stat fileStat;
+    if (0 != ::fstat(fd, &fileStat) || !S_ISREG(fileStat.st_mode) || 0 == fileStat.st_size) {
+        ::close(fd);
+        return nullptr;
+    }
+    const size_t size = static_cast<size_t>(fileStat.st_size);
+    // the mapping stays valid after the descriptor has been closed
+    void *data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (MAP_FAILED == data) {
+        return nullptr;
+    }
+    length = size;
+    return static_cast<const uint8_t *>(data);
+}
+
+// ------------------------------------------------------------------------------------------------
+void UnmapFile(const uint8_t *data, size_t length) {
+    ::munmap(const_cast<uint8_t *>(data), length);
+}
+#endif
+
+} // namespace
+
+// ----------------------------------------------------------------------------------
+MemoryMappedIOStream::MemoryMappedIOStream(const uint8_t *data, size_t length, const std::string &filename) :
+        mData(data),
+        mLength(length),
+        mPos(0),
+        mFilename(filename) {
+    ai_assert(nullptr != data);
+}
+
+// ----------------------------------------------------------------------------------
+MemoryMappedIOStream::~MemoryMappedIOStream() {
+    UnmapFile(mData, mLength);
+}
+
+// ----------------------------------------------------------------------------------
+size_t MemoryMappedIOStream::Read(void *pvBuffer, size_t pSize, size_t pCount) {
+    if (0 == pCount) {
+        return 0;
+    }
+    ai_assert(nullptr != pvBuffer);
+    ai_assert(0 != pSize);
+
+    const size_t cnt = std::min(pCount, (mLength - mPos) / pSize);
+    const size_t ofs = pSize * cnt;
+    ::memcpy(pvBuffer, mData + mPos, ofs);
+    mPos += ofs;
+
+    return cnt;
+}
+
+// ----------------------------------------------------------------------------------
+size_t MemoryMappedIOStream::Write(const void * /*pvBuffer*/, size_t /*pSize*/, size_t /*pCount*/) {
+    return 0;
+}
+
+// ----------------------------------------------------------------------------------
+aiReturn MemoryMappedIOStream::Seek(size_t pOffset, aiOrigin pOrigin) {
+    size_t base = 0;
+    if (aiOrigin_CUR == pOrigin) {
+        base = mPos;
+    } else if (aiOrigin_END == pOrigin) {
+        if (pOffset > mLength) {
+            return AI_FAILURE;
+        }
+        mPos = mLength - pOffset;
+        return AI_SUCCESS;
+    }
+
+    if (pOffset > mLength - base) {
+        return AI_FAILURE;
+    }
+    mPos = base + pOffset;
+
+    return AI_SUCCESS;
+}
+
+// ----------------------------------------------------------------------------------
+size_t MemoryMappedIOStream::Tell() const {
+    return mPos;
+}
+
+// ----------------------------------------------------------------------------------
+size_t MemoryMappedIOStream::FileSize() const {
+    return mLength;
+}
+
+// ----------------------------------------------------------------------------------
+void MemoryMappedIOStream::Flush() {
+    // empty
+}
+
+// ----------------------------------------------------------------------------------
+const uint8_t *MemoryMappedIOStream::GetContiguousView() const {
+    return mData;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Open a new file with a given path.
+IOStream *MemoryMappedIOSystem::Open(const char *strFile, const char *strMode) {
+    ai_assert(strFile != nullptr);
+    ai_assert(strMode != nullptr);
+
+    if (IsReadOnlyMode(strMode)) {
+        size_t length = 0;
+        const uint8_t *data = MapFile(strFile, length);
+        if (nullptr != data) {
+            return new MemoryMappedIOStream(data, length, strFile);
+        }
+        ASSIMP_LOG_VERBOSE_DEBUG("Unable to map ", strFile, ", falling back to buffered reading");
+    }
+
+    return DefaultIOSystem::Open(strFile, strMode);
+}
+
+// ------------------------------------------------------------------------------------------------
+// Closes the given file and releases all resources associated with it.
+void MemoryMappedIOSystem::Close(IOStream *pFile) {
+    delete pFile;
+}
@@ -0,0 +1,365 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2021, assimp team
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file ProbeIOSystem.h
+ *  Implements an IOSystem wrapper which opens the file to be imported once
+ *  and serves format detection and the actual import from that stream.
+ */
+#pragma once
+#ifndef AI_PROBEIOSYSTEM_H_INC
+#define AI_PROBEIOSYSTEM_H_INC
+
+#include <assimp/IOStream.hpp>
+#include <assimp/IOSystem.hpp>
+#include <assimp/ai_assert.h>
+
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Assimp {
+
+// ---------------------------------------------------------------------------
+/** State of the file shared by all streams a ProbeIOSystem hands out. */
+struct ProbeFile {
+    /// The one stream opened on the wrapped IOSystem.
+    IOStream *mStream;
+    /// Its size, queried once.
+    size_t mFileSize;
+    /// The stream which moved mStream last, or nullptr. Only this one may
+    /// read on without a seek.
+    const IOStream *mLastReader;
+    /// Guards mStream and mLastReader, the streams on top of it may be read
+    /// on different threads, e.g. by the read-ahead of an IOStreamBuffer.
+    std::mutex mMutex;
+    /// The contiguous view of mStream, if it offers one.
+    const uint8_t *mView;
+    /// The leading bytes of the file, all header checks are served from here.
+    std::vector<uint8_t> mHeader;
+
+    ProbeFile() :
+            mStream(nullptr), mFileSize(0), mLastReader(nullptr), mMutex(), mView(nullptr), mHeader() {
+        // empty
+    }
+};
+
+// ---------------------------------------------------------------------------
+/** Lightweight read-only stream on top of a ProbeFile. Deleting it does
+ *  not close the underlying file. */
+class ProbeIOStream : public IOStream {
+public:
+    explicit ProbeIOStream(ProbeFile &file) :
+            mFile(file), mPos(0), mStreamPos(0) {
+        // empty
+    }
+
+    /** Destructor, a later stream at the same address must seek. */
+    ~ProbeIOStream() override {
+        std::lock_guard<std::mutex> lock(mFile.mMutex);
+        if (mFile.mLastReader == this) {
+            mFile.mLastReader = nullptr;
+        }
+    }
+
+    // -------------------------------------------------------------------
+    /** Read from stream, the header is served from memory. */
+    size_t Read(void *pvBuffer, size_t pSize, size_t pCount) override {
+        if (0 == pSize || 0 == pCount) {
+            return 0;
+        }
+        ai_assert(nullptr != pvBuffer);
+
+        uint8_t *out = static_cast<uint8_t *>(pvBuffer);
+        const size_t wanted = pSize * pCount;
+        size_t done = 0;
+        if (nullptr != mFile.mView) {
+            done = mPos < mFile.mFileSize ? std::min(wanted, mFile.mFileSize - mPos) : 0;
+            ::memcpy(out, mFile.mView + mPos, done);
+        } else {
+            if (mPos < mFile.mHeader.size()) {
+                done = std::min(wanted, mFile.mHeader.size() - mPos);
+                ::memcpy(out, &mFile.mHeader[mPos], done);
+            }
+            if (done < wanted) {
+                std::lock_guard<std::mutex> lock(mFile.mMutex);
+                const size_t pos = mPos + done;
+                if (mFile.mLastReader != this || pos != mStreamPos) {
+                    mFile.mLastReader = nullptr;
+                    if (aiReturn_SUCCESS != mFile.mStream->Seek(pos, aiOrigin_SET)) {
+                        mPos = pos;
+                        return done / pSize;
+                    }
+                }
+                const size_t read = mFile.mStream->Read(out + done, 1, wanted - done);
+                mFile.mLastReader = this;
+                mStreamPos = pos + read;
+                done += read;
+            }
+        }
+        mPos += done;
+
+        return done / pSize;
+    }
+
+    // -------------------------------------------------------------------
+    /** Write to stream, not supported. */
+    size_t Write(const void * /*pvBuffer*/, size_t /*pSize*/, size_t /*pCount*/) override {
+        return 0;
+    }
+
+    // -------------------------------------------------------------------
+    /** Seek specific position */
+    aiReturn Seek(size_t pOffset, aiOrigin pOrigin) override {
+        size_t base = 0;
+        if (aiOrigin_CUR == pOrigin) {
+            base = mPos;
+        } else if (aiOrigin_END == pOrigin) {
+            if (pOffset > mFile.mFileSize) {
+                return AI_FAILURE;
+            }
+            mPos = mFile.mFileSize - pOffset;
+            return AI_SUCCESS;
+        }
+        if (base > mFile.mFileSize || pOffset > mFile.mFileSize - base) {
+            return AI_FAILURE;
+        }
+        mPos = base + pOffset;
+
+        return AI_SUCCESS;
+    }
+
+    // -------------------------------------------------------------------
+    /** Get current seek position */
+    size_t Tell() const override {
+        return mPos;
+    }
+
+    // -------------------------------------------------------------------
+    /** Get size of file */
+    size_t FileSize() const override {
+        return mFile.mFileSize;
+    }
+
+    // -------------------------------------------------------------------
+    /** Flush file contents, nothing to do */
+    void Flush() override {
+        // empty
+    }
+
+    // -------------------------------------------------------------------
+    /** Forwards the view of the underlying stream */
+    const uint8_t *GetContiguousView() const override {
+        return mFile.mView;
+    }
+
+private:
+    ProbeFile &mFile;
+    /// Read position of this stream.
+    size_t mPos;
+    /// Position of the underlying stream after the last read of this
+    /// stream, valid while mFile.mLastReader is this stream.
+    size_t mStreamPos;
+};
+
+// ---------------------------------------------------------------------------
+/** IOSystem wrapper used by Importer::ReadFile. The file to be imported is
+ *  opened only once on the wrapped IOSystem, its first bytes are read into a
+ *  shared header block. All read accesses to that file, i.e. the CanRead()
+ *  probes of all importers and the import itself, are served from there.
+ *  Everything else is passed through to the wrapped IOSystem. */
+class ProbeIOSystem : public IOSystem {
+public:
+    /// Number of bytes kept in the header block, enough for all signature checks.
+    static const size_t HeaderSize = 4096;
+
+    /** Constructor. */
+    ProbeIOSystem(const std::string &file, IOSystem *wrapped) :
+            mFileName(file), mWrapped(wrapped), mFile() {
+        ai_assert(nullptr != mWrapped);
+    }
+
+    /** Destructor, closes the file. */
+    ~ProbeIOSystem() {
+        if (nullptr != mFile.mStream) {
+            mWrapped->Close(mFile.mStream);
+        }
+    }
+
+    // -------------------------------------------------------------------
+    /** Opens the file and reads the header block. If this fails, all
+     *  accesses are passed through to the wrapped IOSystem.
+     *  @return false if the file cannot be opened. */
+    bool OpenFile() {
+        ai_assert(nullptr == mFile.mStream);
+        mFile.mStream = mWrapped->Open(mFileName, "rb");
+        if (nullptr == mFile.mStream) {
+            return false;
+        }
+
+        mFile.mFileSize = mFile.mStream->FileSize();
+        mFile.mView = mFile.mStream->GetContiguousView();
+        if (nullptr == mFile.mView) {
+            mFile.mHeader.resize(HeaderSize);
+            const size_t read = mFile.mStream->Read(&mFile.mHeader[0], 1, HeaderSize);
+            mFile.mHeader.resize(read);
+        }
+
+        return true;
+    }
+
+    // -------------------------------------------------------------------
+    /** Returns the size of the file. */
+    size_t FileSize() const {
+        return mFile.mFileSize;
+    }
+
+    // -------------------------------------------------------------------
+    /** Returns the leading bytes of the file.
+     *  @param size Receives the number of bytes available. */
+    const uint8_t *Header(size_t &size) const {
+        if (nullptr != mFile.mView) {
+            size = mFile.mFileSize;
+            return mFile.mView;
+        }
+        size = mFile.mHeader.size();
+        return size ? &mFile.mHeader[0] : nullptr;
+    }
+
+    // -------------------------------------------------------------------
+    /** Tests for the existence of a file at the given path. */
+    bool Exists(const char *pFile) const override {
+        return mFileName == pFile || mWrapped->Exists(pFile);
+    }
+
+    // -------------------------------------------------------------------
+    /** Returns the directory separator. */
+    char getOsSeparator() const override {
+        return mWrapped->getOsSeparator();
+    }
+
+    // -------------------------------------------------------------------
+    /** Open a new file with a given path. Binary read accesses to the
+     *  probed file are served from the shared stream, each with its own
+     *  position. All other modes, text mode reads included, are passed
+     *  through so the wrapped IOSystem keeps translating line ends. */
+    IOStream *Open(const char *pFile, const char *pMode = "rb") override {
+        ai_assert(nullptr != pFile);
+        ai_assert(nullptr != pMode);
+        if (nullptr != mFile.mStream && 0 == ::strcmp(pMode, "rb") && mFileName == pFile) {
+            return new ProbeIOStream(mFile);
+        }
+        return mWrapped->Open(pFile, pMode);
+    }
+
+    // -------------------------------------------------------------------
+    /** Closes the given file and releases all resources associated with it. */
+    void Close(IOStream *pFile) override {
+        if (nullptr != dynamic_cast<ProbeIOStream *>(pFile)) {
+            delete pFile;
+            return;
+        }
+        mWrapped->Close(pFile);
+    }
+
+    // -------------------------------------------------------------------
+    /** Compare two paths */
+    bool ComparePaths(const char *one, const char *second) const override {
+        return mWrapped->ComparePaths(one, second);
+    }
+
+    // -------------------------------------------------------------------
+    /** Pushes a new directory onto the directory stack. */
+    bool PushDirectory(const std::string &path) override {
+        return mWrapped->PushDirectory(path);
+    }
+
+    // -------------------------------------------------------------------
+    /** Returns the top directory from the stack. */
+    const std::string &CurrentDirectory() const override {
+        return mWrapped->CurrentDirectory();
+    }
+
+    // -------------------------------------------------------------------
+    /** Returns the number of directories stored on the stack. */
+    size_t StackSize() const override {
+        return mWrapped->StackSize();
+    }
+
+    // -------------------------------------------------------------------
+    /** Pops the top directory from the stack. */
+    bool PopDirectory() override {
+        return mWrapped->PopDirectory();
+    }
+
+    // -------------------------------------------------------------------
+    /** Creates an new directory at the given path. */
+    bool CreateDirectory(const std::string &path) override {
+        return mWrapped->CreateDirectory(path);
+    }
+
+    // -------------------------------------------------------------------
+    /** Will change the current directory to the given path. */
+    bool ChangeDirectory(const std::string &path) override {
+        return mWrapped->ChangeDirectory(path);
+    }
+
+    // -------------------------------------------------------------------
+    /** Delete file. */
+    bool DeleteFile(const std::string &file) override {
+        return mWrapped->DeleteFile(file);
+    }
+
+    // -------------------------------------------------------------------
+    /** Rename file. */
+    bool RenameFile(const std::string &from, const std::string &to) override {
+        return mWrapped->RenameFile(from, to);
+    }
+
+private:
+    std::string mFileName;
+    IOSystem *mWrapped;
+    ProbeFile mFile;
+};
+
+} // namespace Assimp
+
+#endif // AI_PROBEIOSYSTEM_H_INC
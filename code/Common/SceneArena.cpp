@@ -0,0 +1,157 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2021, assimp team
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+/** @file Implementation of the SceneArena which holds the objects of an
+ *  imported scene.
+ */
+
+#include "SceneArena.h"
+#include "ScenePrivate.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <new>
+
+using namespace Assimp;
+
+namespace {
+
+// Size of the first chunk, each further chunk doubles up to the maximum.
+// Requests larger than a chunk get a chunk of their own.
+static const size_t FirstChunkSize = 64 * 1024;
+static const size_t MaxChunkSize = 64 * 1024 * 1024;
+
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+struct SceneArena::Chunk {
+    Chunk *mNext;
+    size_t mSize;
+};
+
+// ------------------------------------------------------------------------------------------------
+SceneArena::SceneArena(Allocator *parent) :
+        mParent(parent),
+        mMutex(),
+        mChunks(nullptr),
+        mCursor(nullptr),
+        mEnd(nullptr),
+        mNextChunkSize(FirstChunkSize),
+        mUsedBytes(0),
+        mNumChunks(0) {
+    // empty
+}
+
+// ------------------------------------------------------------------------------------------------
+SceneArena::~SceneArena() {
+    while (mChunks) {
+        Chunk *next = mChunks->mNext;
+        if (nullptr != mParent) {
+            mParent->Deallocate(mChunks, mChunks->mSize);
+        } else {
+            ::operator delete(mChunks);
+        }
+        mChunks = next;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void *SceneArena::Allocate(size_t size, size_t alignment) {
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    size_t misalignment = reinterpret_cast<uintptr_t>(mCursor) & (alignment - 1);
+    size_t padding = misalignment ? alignment - misalignment : 0;
+    if (nullptr == mCursor || size + padding > static_cast<size_t>(mEnd - mCursor)) {
+        // the chunk header keeps the payload aligned for all scene types
+        const size_t header = std::max(sizeof(Chunk), alignof(std::max_align_t));
+        const size_t payload = std::max(mNextChunkSize, size + alignment);
+        void *block = nullptr != mParent ? mParent->Allocate(header + payload) : ::operator new(header + payload);
+        Chunk *chunk = static_cast<Chunk *>(block);
+        chunk->mNext = nullptr;
+        chunk->mSize = header + payload;
+        chunk->mNext = mChunks;
+        mChunks = chunk;
+        ++mNumChunks;
+
+        mCursor = reinterpret_cast<char *>(chunk) + header;
+        mEnd = mCursor + payload;
+        mNextChunkSize = std::min(mNextChunkSize * 2, MaxChunkSize);
+
+        misalignment = reinterpret_cast<uintptr_t>(mCursor) & (alignment - 1);
+        padding = misalignment ? alignment - misalignment : 0;
+    }
+
+    void *result = mCursor + padding;
+    mCursor += padding + size;
+    mUsedBytes += size;
+    return result;
+}
+
+// ------------------------------------------------------------------------------------------------
+void *SceneArena::Allocate(size_t size) {
+    return Allocate(size, alignof(std::max_align_t));
+}
+
+// ------------------------------------------------------------------------------------------------
+void SceneArena::Deallocate(void * /*data*/, size_t /*size*/) AI_NO_EXCEPT {
+    // the memory is released together with the arena
+}
+
+// ------------------------------------------------------------------------------------------------
+bool SceneArena::Contains(const void *data) const {
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    const char *address = static_cast<const char *>(data);
+    for (const Chunk *chunk = mChunks; nullptr != chunk; chunk = chunk->mNext) {
+        const char *start = reinterpret_cast<const char *>(chunk);
+        if (address >= start && address < start + chunk->mSize) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// ------------------------------------------------------------------------------------------------
+SceneArena *SceneArena::Get(const aiScene *scene) {
+    const ScenePrivateData *priv = ScenePriv(scene);
+    return priv ? priv->mArena : nullptr;
+}
@@ -0,0 +1,130 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2021, assimp team
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file SceneArena.h
+ *  Declares the monotonic arena which holds the objects of an imported
+ *  scene, see #AI_CONFIG_GLOB_SCENE_ARENA.
+ */
+#pragma once
+#ifndef AI_SCENEARENA_H_INC
+#define AI_SCENEARENA_H_INC
+
+#include <assimp/Allocator.h>
+
+#include <cstddef>
+#include <mutex>
+
+struct aiScene;
+
+namespace Assimp {
+
+// ---------------------------------------------------------------------------
+/** @brief Monotonic arena for the objects of one aiScene.
+ *
+ *  The arena hands out memory from a short list of geometrically growing
+ *  chunks and never frees single allocations. The Importer binds it while
+ *  it imports or post-processes a scene, so all objects of the scene and
+ *  their arrays end up in it right away, and attaches it to the private
+ *  data of the scene. The destructor of the scene then releases the arena
+ *  without visiting a single object.
+ *
+ *  Objects allocated in the arena must not outlive their scene, e.g. by
+ *  moving a mesh into another scene. Memory of objects and arrays which are
+ *  replaced while the scene exists is reclaimed with the scene. */
+// ---------------------------------------------------------------------------
+class ASSIMP_API SceneArena : public Allocator {
+public:
+    // -------------------------------------------------------------------
+    /** @brief Construction
+     *  @param parent Allocator for the chunks, nullptr for the global
+     *    operator new. */
+    explicit SceneArena(Allocator *parent = nullptr);
+    ~SceneArena() override;
+
+    // -------------------------------------------------------------------
+    /** @brief Get uninitialized memory from the arena. Thread-safe.
+     *  @param size Number of bytes
+     *  @param alignment Required alignment, a power of two
+     *  @return Never nullptr, throws std::bad_alloc on failure */
+    void *Allocate(size_t size, size_t alignment);
+
+    void *Allocate(size_t size) override;
+    void Deallocate(void *data, size_t size) AI_NO_EXCEPT override;
+
+    // -------------------------------------------------------------------
+    /** @brief Get the number of bytes handed out so far */
+    size_t GetUsedBytes() const {
+        return mUsedBytes;
+    }
+
+    // -------------------------------------------------------------------
+    /** @brief Get the number of chunks allocated from the parent */
+    size_t GetNumChunks() const {
+        return mNumChunks;
+    }
+
+    // -------------------------------------------------------------------
+    /** @brief Check whether memory was handed out by the arena. Thread-safe.
+     *  @param data Address to check */
+    bool Contains(const void *data) const;
+
+    // -------------------------------------------------------------------
+    /** @brief Get the arena holding the objects of a scene, if any */
+    static SceneArena *Get(const aiScene *scene);
+
+private:
+    SceneArena(const SceneArena &) = delete;
+    SceneArena &operator=(const SceneArena &) = delete;
+
+    struct Chunk;
+
+    Allocator *mParent;
+    mutable std::mutex mMutex;
+    Chunk *mChunks;
+    char *mCursor;
+    char *mEnd;
+    size_t mNextChunkSize;
+    size_t mUsedBytes;
+    size_t mNumChunks;
+};
+
+} // namespace Assimp
+
+#endif // AI_SCENEARENA_H_INC
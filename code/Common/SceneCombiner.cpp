@@ -53,6 +53,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
   */
 // ----------------------------------------------------------------------------
 #include "ScenePrivate.h"
+#include "TaskScheduler.h"
 #include "time.h"
 #include <assimp/Hash.h>
 #include <assimp/SceneCombiner.h>
@@ -63,6 +64,10 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/scene.h>
 #include <stdio.h>
 #include <assimp/DefaultLogger.hpp>
+#include <assimp/Exceptional.h>
+
+#include <limits>
+#include <map>
 
 namespace Assimp {
 
@@ -218,10 +223,10 @@ void SceneCombiner::AttachToGraph(aiNode *attach, std::vector<NodeAttachmentInfo
     }
 
     if (cnt) {
-        aiNode **n = new aiNode *[cnt + attach->mNumChildren];
+        aiNode **n = AllocateSceneArray<aiNode *>(cnt + attach->mNumChildren);
         if (attach->mNumChildren) {
             ::memcpy(n, attach->mChildren, sizeof(void *) * attach->mNumChildren);
-            delete[] attach->mChildren;
+            FreeSceneArray(attach->mChildren);
         }
         attach->mChildren = n;
 
@@ -249,6 +254,38 @@ void SceneCombiner::AttachToGraph(aiScene *master, std::vector<NodeAttachmentInf
     AttachToGraph(master->mRootNode, src);
 }
 
+// ------------------------------------------------------------------------------------------------
+// Returns the node of a copied graph which corresponds to a node of the original graph
+static aiNode *FindCopiedNode(const aiNode *original, aiNode *copy, const aiNode *node) {
+    if (original == node) {
+        return copy;
+    }
+    for (unsigned int i = 0; i < original->mNumChildren && i < copy->mNumChildren; ++i) {
+        aiNode *found = FindCopiedNode(original->mChildren[i], copy->mChildren[i], node);
+        if (nullptr != found) {
+            return found;
+        }
+    }
+    return nullptr;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Replaces a scene whose objects live in its own arena, or whose arrays have another layout than
+// the ones of the merged scene, by a copy, so its objects can be moved into the merged scene. Each
+// scene is copied once, the caller deletes the originals.
+static aiScene *DetachFromArena(aiScene *scene, std::map<aiScene *, aiScene *> &copies) {
+    const ScenePrivateData *priv = nullptr != scene && nullptr != scene->mPrivate ? ScenePriv(scene) : nullptr;
+    if (nullptr == priv || (nullptr == priv->mArena && priv->mTrackedArrays == SceneArrayScope::IsTracked())) {
+        return scene;
+    }
+
+    aiScene *&copy = copies[scene];
+    if (nullptr == copy) {
+        SceneCombiner::CopySceneFlat(&copy, scene);
+    }
+    return copy;
+}
+
 // ------------------------------------------------------------------------------------------------
 void SceneCombiner::MergeScenes(aiScene **_dest, aiScene *master, std::vector<AttachmentInfo> &srcList, unsigned int flags) {
     if (nullptr == _dest) {
@@ -263,6 +300,21 @@ void SceneCombiner::MergeScenes(aiScene **_dest, aiScene *master, std::vector<At
             *_dest = master;
         return;
     }
+
+    // objects in the arena of a source scene die with it and arrays are released the way the
+    // merged scene allocates them, such scenes are merged from copies
+    std::map<aiScene *, aiScene *> copies;
+    aiScene *const masterCopy = DetachFromArena(master, copies);
+    for (AttachmentInfo &info : srcList) {
+        if (masterCopy != master && nullptr != info.attachToNode) {
+            info.attachToNode = FindCopiedNode(master->mRootNode, masterCopy->mRootNode, info.attachToNode);
+        }
+        info.scene = DetachFromArena(info.scene, copies);
+    }
+    master = masterCopy;
+    for (const std::pair<aiScene *const, aiScene *> &copy : copies) {
+        delete copy.first;
+    }
     if (*_dest) {
         (*_dest)->~aiScene();
         new (*_dest) aiScene();
@@ -359,7 +411,7 @@ void SceneCombiner::MergeScenes(aiScene **_dest, aiScene *master, std::vector<At
 
     // generate the output texture list + an offset table for all texture indices
     if (dest->mNumTextures) {
-        aiTexture **pip = dest->mTextures = new aiTexture *[dest->mNumTextures];
+        aiTexture **pip = dest->mTextures = AllocateSceneArray<aiTexture *>(dest->mNumTextures);
         cnt = 0;
         for (unsigned int n = 0; n < src.size(); ++n) {
             SceneHelper *cur = &src[n];
@@ -382,7 +434,7 @@ void SceneCombiner::MergeScenes(aiScene **_dest, aiScene *master, std::vector<At
 
     // generate the output material list + an offset table for all material indices
     if (dest->mNumMaterials) {
-        aiMaterial **pip = dest->mMaterials = new aiMaterial *[dest->mNumMaterials];
+        aiMaterial **pip = dest->mMaterials = AllocateSceneArray<aiMaterial *>(dest->mNumMaterials);
         cnt = 0;
         for (unsigned int n = 0; n < src.size(); ++n) {
             SceneHelper *cur = &src[n];
@@ -420,8 +472,8 @@ void SceneCombiner::MergeScenes(aiScene **_dest, aiScene *master, std::vector<At
                                 // The string changed in size so we need to reallocate the buffer for the property.
                                 if (oldLen < s.length) {
                                     prop->mDataLength += s.length - oldLen;
-                                    delete[] prop->mData;
-                                    prop->mData = new char[prop->mDataLength];
+                                    FreeSceneArray(prop->mData);
+                                    prop->mData = AllocateSceneArray<char>(prop->mDataLength);
                                 }
 
                                 memcpy(prop->mData, static_cast<void*>(&s), prop->mDataLength);
@@ -445,7 +497,7 @@ void SceneCombiner::MergeScenes(aiScene **_dest, aiScene *master, std::vector<At
 
     // generate the output mesh list + again an offset table for all mesh indices
     if (dest->mNumMeshes) {
-        aiMesh **pip = dest->mMeshes = new aiMesh *[dest->mNumMeshes];
+        aiMesh **pip = dest->mMeshes = AllocateSceneArray<aiMesh *>(dest->mNumMeshes);
         cnt = 0;
         for (unsigned int n = 0; n < src.size(); ++n) {
             SceneHelper *cur = &src[n];
@@ -483,11 +535,11 @@ void SceneCombiner::MergeScenes(aiScene **_dest, aiScene *master, std::vector<At
     // ----------------------------------------------------------------------------
 
     // Allocate space for light sources, cameras and animations
-    aiLight **ppLights = dest->mLights = (dest->mNumLights ? new aiLight *[dest->mNumLights] : nullptr);
+    aiLight **ppLights = dest->mLights = (dest->mNumLights ? AllocateSceneArray<aiLight *>(dest->mNumLights) : nullptr);
 
-    aiCamera **ppCameras = dest->mCameras = (dest->mNumCameras ? new aiCamera *[dest->mNumCameras] : nullptr);
+    aiCamera **ppCameras = dest->mCameras = (dest->mNumCameras ? AllocateSceneArray<aiCamera *>(dest->mNumCameras) : nullptr);
 
-    aiAnimation **ppAnims = dest->mAnimations = (dest->mNumAnimations ? new aiAnimation *[dest->mNumAnimations] : nullptr);
+    aiAnimation **ppAnims = dest->mAnimations = (dest->mNumAnimations ? AllocateSceneArray<aiAnimation *>(dest->mNumAnimations) : nullptr);
 
     for (int n = static_cast<int>(src.size() - 1); n >= 0; --n) /* !!! important !!! */
     {
@@ -642,17 +694,17 @@ void SceneCombiner::MergeScenes(aiScene **_dest, aiScene *master, std::vector<At
 
         // We need to delete the arrays before the destructor is called -
         // we are reusing the array members
-        delete[] deleteMe->mMeshes;
+        FreeSceneArray(deleteMe->mMeshes);
         deleteMe->mMeshes = nullptr;
-        delete[] deleteMe->mCameras;
+        FreeSceneArray(deleteMe->mCameras);
         deleteMe->mCameras = nullptr;
-        delete[] deleteMe->mLights;
+        FreeSceneArray(deleteMe->mLights);
         deleteMe->mLights = nullptr;
-        delete[] deleteMe->mMaterials;
+        FreeSceneArray(deleteMe->mMaterials);
         deleteMe->mMaterials = nullptr;
-        delete[] deleteMe->mAnimations;
+        FreeSceneArray(deleteMe->mAnimations);
         deleteMe->mAnimations = nullptr;
-        delete[] deleteMe->mTextures;
+        FreeSceneArray(deleteMe->mTextures);
         deleteMe->mTextures = nullptr;
 
         deleteMe->mRootNode = nullptr;
@@ -720,7 +772,7 @@ void SceneCombiner::MergeBones(aiMesh *out, std::vector<aiMesh *>::const_iterato
 
     // now create the output bones
     out->mNumBones = 0;
-    out->mBones = new aiBone *[asBones.size()];
+    out->mBones = AllocateSceneArray<aiBone *>(asBones.size());
 
     for (std::list<BoneWithHash>::const_iterator boneIt = asBones.begin(), boneEnd = asBones.end(); boneIt != boneEnd; ++boneIt) {
         // Allocate a bone and setup it's name
@@ -876,8 +928,27 @@ void SceneCombiner::MergeMeshes(aiMesh **_out, unsigned int /*flags*/,
 
     if (out->mNumFaces) // just for safety
     {
-        // copy faces
+        // the faces take over the index arrays they own, only the indices in
+        // the index blocks of the source meshes are copied, to one new block
+        size_t numBlockIndices = 0;
+        for (std::vector<aiMesh *>::const_iterator it = begin; it != end; ++it) {
+            for (unsigned int m = 0; m < (*it)->mNumFaces; ++m) {
+                const aiFace &face = (*it)->mFaces[m];
+                if ((*it)->IsInFaceIndexBlock(face.mIndices)) {
+                    numBlockIndices += face.mNumIndices;
+                }
+            }
+        }
+        if (numBlockIndices > std::numeric_limits<unsigned int>::max()) {
+            throw DeadlyImportError("JoinMeshes: too many face indices (", numBlockIndices, ") for one mesh");
+        }
+
         out->mFaces = new aiFace[out->mNumFaces];
+        unsigned int *pi = nullptr;
+        if (numBlockIndices) {
+            out->mNumFaceIndices = static_cast<unsigned int>(numBlockIndices);
+            out->mFaceIndices = pi = AllocateSceneArray<unsigned int>(numBlockIndices);
+        }
         aiFace *pf2 = out->mFaces;
 
         unsigned int ofs = 0;
@@ -885,8 +956,17 @@ void SceneCombiner::MergeMeshes(aiMesh **_out, unsigned int /*flags*/,
             for (unsigned int m = 0; m < (*it)->mNumFaces; ++m, ++pf2) {
                 aiFace &face = (*it)->mFaces[m];
                 pf2->mNumIndices = face.mNumIndices;
-                pf2->mIndices = face.mIndices;
 
+                if ((*it)->IsInFaceIndexBlock(face.mIndices)) {
+                    pf2->mIndices = pi;
+                    for (unsigned int q = 0; q < face.mNumIndices; ++q) {
+                        pi[q] = face.mIndices[q] + ofs;
+                    }
+                    pi += face.mNumIndices;
+                    continue;
+                }
+
+                pf2->mIndices = face.mIndices;
                 if (ofs) {
                     // add the offset to the vertex
                     for (unsigned int q = 0; q < face.mNumIndices; ++q) {
@@ -931,11 +1011,11 @@ void SceneCombiner::MergeMaterials(aiMaterial **dest,
     }
 
     out->Clear();
-    delete[] out->mProperties;
+    FreeSceneArray(out->mProperties);
 
     out->mNumAllocated = size;
     out->mNumProperties = 0;
-    out->mProperties = new aiMaterialProperty *[out->mNumAllocated];
+    out->mProperties = AllocateSceneArray<aiMaterialProperty *>(out->mNumAllocated);
 
     for (std::vector<aiMaterial *>::const_iterator it = begin; it != end; ++it) {
         for (unsigned int i = 0; i < (*it)->mNumProperties; ++i) {
@@ -948,7 +1028,7 @@ void SceneCombiner::MergeMaterials(aiMaterial **dest,
                 aiMaterialProperty *prop = out->mProperties[out->mNumProperties] = new aiMaterialProperty();
 
                 prop->mDataLength = sprop->mDataLength;
-                prop->mData = new char[prop->mDataLength];
+                prop->mData = AllocateSceneArray<char>(prop->mDataLength);
                 ::memcpy(prop->mData, sprop->mData, prop->mDataLength);
 
                 prop->mIndex = sprop->mIndex;
@@ -987,6 +1067,87 @@ inline void GetArrayCopy(Type *&dest, ai_uint num) {
     ::memcpy(dest, old, sizeof(Type) * num);
 }
 
+// ------------------------------------------------------------------------------------------------
+template <typename Type>
+inline void AllocPtrArray(Type **&dest, ai_uint num) {
+    dest = num ? new Type *[num]() : nullptr;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Run a task for all indices below count, on the threads of the scheduler if there is one
+static void ForEachIndex(size_t count, TaskScheduler *scheduler, const TaskScheduler::Task &task) {
+    if (nullptr != scheduler) {
+        scheduler->ParallelFor(count, task);
+        return;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        task(i);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+// Give a mesh its own copies of the vertex arrays it points to and of the given faces
+static void CopyMeshArrays(aiMesh *dest, const aiFace *faces, unsigned int numFaces) {
+    GetArrayCopy(dest->mVertices, dest->mNumVertices);
+    GetArrayCopy(dest->mNormals, dest->mNumVertices);
+    GetArrayCopy(dest->mTangents, dest->mNumVertices);
+    GetArrayCopy(dest->mBitangents, dest->mNumVertices);
+
+    unsigned int n = 0;
+    while (dest->HasTextureCoords(n)) {
+        GetArrayCopy(dest->mTextureCoords[n++], dest->mNumVertices);
+    }
+
+    n = 0;
+    while (dest->HasVertexColors(n)) {
+        GetArrayCopy(dest->mColors[n++], dest->mNumVertices);
+    }
+
+    // make a deep copy of all faces, the indices go to one block
+    dest->mFaces = nullptr;
+    dest->mFaceIndices = nullptr;
+    dest->mNumFaceIndices = 0;
+    if (faces && numFaces) {
+        size_t numIndices = 0;
+        for (unsigned int i = 0; i < numFaces; ++i) {
+            numIndices += faces[i].mNumIndices;
+        }
+        if (numIndices > std::numeric_limits<unsigned int>::max()) {
+            throw DeadlyImportError("Too many face indices (", numIndices, ") to copy mesh \"", dest->mName.C_Str(), "\"");
+        }
+
+        unsigned int *pi = dest->AllocateFaces(numFaces, static_cast<unsigned int>(numIndices));
+        for (unsigned int i = 0; i < numFaces; ++i) {
+            const aiFace &f = faces[i];
+            if (f.mIndices && f.mNumIndices) {
+                dest->mFaces[i].mNumIndices = f.mNumIndices;
+                dest->mFaces[i].mIndices = pi;
+                ::memcpy(pi, f.mIndices, f.mNumIndices * sizeof(unsigned int));
+                pi += f.mNumIndices;
+            }
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+// Reset the arrays a mesh shares with another one
+static void DetachMeshArrays(aiMesh *mesh) {
+    mesh->mVertices = nullptr;
+    mesh->mNormals = nullptr;
+    mesh->mTangents = nullptr;
+    mesh->mBitangents = nullptr;
+    for (unsigned int n = 0; n < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++n) {
+        mesh->mTextureCoords[n] = nullptr;
+    }
+    for (unsigned int n = 0; n < AI_MAX_NUMBER_OF_COLOR_SETS; ++n) {
+        mesh->mColors[n] = nullptr;
+    }
+    mesh->mFaces = nullptr;
+    mesh->mNumFaces = 0;
+    mesh->mFaceIndices = nullptr;
+    mesh->mNumFaceIndices = 0;
+}
+
 // ------------------------------------------------------------------------------------------------
 void SceneCombiner::CopySceneFlat(aiScene **_dest, const aiScene *src) {
     if (nullptr == _dest || nullptr == src) {
@@ -1004,7 +1165,7 @@ void SceneCombiner::CopySceneFlat(aiScene **_dest, const aiScene *src) {
 }
 
 // ------------------------------------------------------------------------------------------------
-void SceneCombiner::CopyScene(aiScene **_dest, const aiScene *src, bool allocate) {
+void SceneCombiner::CopyScene(aiScene **_dest, const aiScene *src, bool allocate, unsigned int flags, TaskScheduler *scheduler) {
     if (nullptr == _dest || nullptr == src) {
         return;
     }
@@ -1015,25 +1176,56 @@ void SceneCombiner::CopyScene(aiScene **_dest, const aiScene *src, bool allocate
     aiScene *dest = *_dest;
     ai_assert(nullptr != dest);
 
+    // the arrays of the copy get the layout of its scene
+    SceneArrayScope arrays(dest);
+
     // copy metadata
     if (nullptr != src->mMetaData) {
         dest->mMetaData = new aiMetadata(*src->mMetaData);
     }
 
-    // copy animations
+    // meshes, animations, textures and materials don't depend on each other,
+    // so their pointer arrays are set up first and the objects copied in any order
+    dest->mNumMeshes = src->mNumMeshes;
+    AllocPtrArray(dest->mMeshes, dest->mNumMeshes);
     dest->mNumAnimations = src->mNumAnimations;
-    CopyPtrArray(dest->mAnimations, src->mAnimations,
-            dest->mNumAnimations);
-
-    // copy textures
+    AllocPtrArray(dest->mAnimations, dest->mNumAnimations);
     dest->mNumTextures = src->mNumTextures;
-    CopyPtrArray(dest->mTextures, src->mTextures,
-            dest->mNumTextures);
-
-    // copy materials
+    AllocPtrArray(dest->mTextures, dest->mNumTextures);
     dest->mNumMaterials = src->mNumMaterials;
-    CopyPtrArray(dest->mMaterials, src->mMaterials,
-            dest->mNumMaterials);
+    AllocPtrArray(dest->mMaterials, dest->mNumMaterials);
+
+    ScenePrivateData *priv = dest->mPrivate ? ScenePriv(dest) : nullptr;
+    const bool share = (flags & AI_INT_COPY_SCENE_SHARE_MESH_DATA) && nullptr != priv;
+
+    const size_t count = static_cast<size_t>(dest->mNumMeshes) + dest->mNumAnimations + dest->mNumTextures + dest->mNumMaterials;
+    ForEachIndex(count, scheduler, [&](size_t i) {
+        if (i < dest->mNumMeshes) {
+            if (share) {
+                CopyShared(&dest->mMeshes[i], src->mMeshes[i]);
+            } else {
+                Copy(&dest->mMeshes[i], src->mMeshes[i]);
+            }
+            return;
+        }
+        i -= dest->mNumMeshes;
+        if (i < dest->mNumAnimations) {
+            Copy(&dest->mAnimations[i], src->mAnimations[i]);
+            return;
+        }
+        i -= dest->mNumAnimations;
+        if (i < dest->mNumTextures) {
+            Copy(&dest->mTextures[i], src->mTextures[i]);
+            return;
+        }
+        i -= dest->mNumTextures;
+        Copy(&dest->mMaterials[i], src->mMaterials[i]);
+    });
+
+    if (share && dest->mNumMeshes) {
+        delete priv->mSharedMeshes;
+        priv->mSharedMeshes = new std::unordered_set<const aiMesh *>(dest->mMeshes, dest->mMeshes + dest->mNumMeshes);
+    }
 
     // copy lights
     dest->mNumLights = src->mNumLights;
@@ -1045,11 +1237,6 @@ void SceneCombiner::CopyScene(aiScene **_dest, const aiScene *src, bool allocate
     CopyPtrArray(dest->mCameras, src->mCameras,
             dest->mNumCameras);
 
-    // copy meshes
-    dest->mNumMeshes = src->mNumMeshes;
-    CopyPtrArray(dest->mMeshes, src->mMeshes,
-            dest->mNumMeshes);
-
     // now - copy the root node of the scene (deep copy, too)
     Copy(&dest->mRootNode, src->mRootNode);
 
@@ -1074,33 +1261,69 @@ void SceneCombiner::Copy(aiMesh **_dest, const aiMesh *src) {
     *dest = *src;
 
     // and reallocate all arrays
-    GetArrayCopy(dest->mVertices, dest->mNumVertices);
-    GetArrayCopy(dest->mNormals, dest->mNumVertices);
-    GetArrayCopy(dest->mTangents, dest->mNumVertices);
-    GetArrayCopy(dest->mBitangents, dest->mNumVertices);
+    CopyMeshArrays(dest, src->mFaces, src->mNumFaces);
 
-    unsigned int n = 0;
-    while (dest->HasTextureCoords(n)) {
-        GetArrayCopy(dest->mTextureCoords[n++], dest->mNumVertices);
-    }
+    // make a deep copy of all bones
+    CopyPtrArray(dest->mBones, dest->mBones, dest->mNumBones);
 
-    n = 0;
-    while (dest->HasVertexColors(n)) {
-        GetArrayCopy(dest->mColors[n++], dest->mNumVertices);
+    // make a deep copy of all blend shapes
+    CopyPtrArray(dest->mAnimMeshes, dest->mAnimMeshes, dest->mNumAnimMeshes);
+}
+
+// ------------------------------------------------------------------------------------------------
+void SceneCombiner::CopyShared(aiMesh **_dest, const aiMesh *src) {
+    if (nullptr == _dest || nullptr == src) {
+        return;
     }
 
-    // make a deep copy of all bones
+    aiMesh *dest = *_dest = new aiMesh();
+
+    // get a flat copy, the vertex and face arrays stay where they are
+    *dest = *src;
+
     CopyPtrArray(dest->mBones, dest->mBones, dest->mNumBones);
+    CopyPtrArray(dest->mAnimMeshes, dest->mAnimMeshes, dest->mNumAnimMeshes);
+}
 
-    // make a deep copy of all faces
-    GetArrayCopy(dest->mFaces, dest->mNumFaces);
-    for (unsigned int i = 0; i < dest->mNumFaces; ++i) {
-        aiFace &f = dest->mFaces[i];
-        GetArrayCopy(f.mIndices, f.mNumIndices);
+// ------------------------------------------------------------------------------------------------
+void SceneCombiner::MakeMeshDataUnique(aiScene *scene, TaskScheduler *scheduler) {
+    ScenePrivateData *priv = scene && scene->mPrivate ? ScenePriv(scene) : nullptr;
+    if (nullptr == priv || nullptr == priv->mSharedMeshes) {
+        return;
     }
 
-    // make a deep copy of all blend shapes
-    CopyPtrArray(dest->mAnimMeshes, dest->mAnimMeshes, dest->mNumAnimMeshes);
+    const std::unordered_set<const aiMesh *> &shared = *priv->mSharedMeshes;
+    ForEachIndex(scene->mNumMeshes, scheduler, [&](size_t i) {
+        aiMesh *mesh = scene->mMeshes[i];
+        if (!shared.count(mesh)) {
+            return;
+        }
+        const aiFace *faces = mesh->mFaces;
+        const unsigned int numFaces = mesh->mNumFaces;
+        CopyMeshArrays(mesh, faces, numFaces);
+    });
+
+    delete priv->mSharedMeshes;
+    priv->mSharedMeshes = nullptr;
+}
+
+// ------------------------------------------------------------------------------------------------
+void SceneCombiner::DetachSharedMeshData(aiScene *scene) {
+    ScenePrivateData *priv = scene && scene->mPrivate ? ScenePriv(scene) : nullptr;
+    if (nullptr == priv || nullptr == priv->mSharedMeshes) {
+        return;
+    }
+
+    if (scene->mMeshes) {
+        for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+            if (scene->mMeshes[i] && priv->mSharedMeshes->count(scene->mMeshes[i])) {
+                DetachMeshArrays(scene->mMeshes[i]);
+            }
+        }
+    }
+
+    delete priv->mSharedMeshes;
+    priv->mSharedMeshes = nullptr;
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -1138,18 +1361,18 @@ void SceneCombiner::Copy(aiMaterial **_dest, const aiMaterial *src) {
     aiMaterial *dest = (aiMaterial *)(*_dest = new aiMaterial());
 
     dest->Clear();
-    delete[] dest->mProperties;
+    FreeSceneArray(dest->mProperties);
 
     dest->mNumAllocated = src->mNumAllocated;
     dest->mNumProperties = src->mNumProperties;
-    dest->mProperties = new aiMaterialProperty *[dest->mNumAllocated];
+    dest->mProperties = AllocateSceneArray<aiMaterialProperty *>(dest->mNumAllocated);
 
     for (unsigned int i = 0; i < dest->mNumProperties; ++i) {
         aiMaterialProperty *prop = dest->mProperties[i] = new aiMaterialProperty();
         aiMaterialProperty *sprop = src->mProperties[i];
 
         prop->mDataLength = sprop->mDataLength;
-        prop->mData = new char[prop->mDataLength];
+        prop->mData = AllocateSceneArray<char>(prop->mDataLength);
         ::memcpy(prop->mData, sprop->mData, prop->mDataLength);
 
         prop->mIndex = sprop->mIndex;
@@ -1184,7 +1407,7 @@ void SceneCombiner::Copy(aiTexture **_dest, const aiTexture *src) {
             return;
         }
         // the cast is legal, the aiTexel c'tor does nothing important
-        dest->pcData = (aiTexel *)new char[cpy];
+        dest->pcData = reinterpret_cast<aiTexel *>(AllocateSceneArray<char>(cpy));
         ::memcpy(dest->pcData, old, cpy);
     }
 }
@@ -1235,8 +1458,8 @@ void SceneCombiner::Copy(aiMeshMorphAnim **_dest, const aiMeshMorphAnim *src) {
     // and reallocate all arrays
     GetArrayCopy(dest->mKeys, dest->mNumKeys);
     for (ai_uint i = 0; i < dest->mNumKeys; ++i) {
-        dest->mKeys[i].mValues = new unsigned int[dest->mKeys[i].mNumValuesAndWeights];
-        dest->mKeys[i].mWeights = new double[dest->mKeys[i].mNumValuesAndWeights];
+        dest->mKeys[i].mValues = AllocateSceneArray<unsigned int>(dest->mKeys[i].mNumValuesAndWeights);
+        dest->mKeys[i].mWeights = AllocateSceneArray<double>(dest->mKeys[i].mNumValuesAndWeights);
         ::memcpy(dest->mKeys[i].mValues, src->mKeys[i].mValues, dest->mKeys[i].mNumValuesAndWeights * sizeof(unsigned int));
         ::memcpy(dest->mKeys[i].mWeights, src->mKeys[i].mWeights, dest->mKeys[i].mNumValuesAndWeights * sizeof(double));
     }
@@ -1321,25 +1544,25 @@ void SceneCombiner::Copy(aiMetadata **_dest, const aiMetadata *src) {
         out.mType = in.mType;
         switch (dest->mValues[i].mType) {
         case AI_BOOL:
-            out.mData = new bool(*static_cast<bool *>(in.mData));
+            out.mData = AllocateSceneObject<bool>(*static_cast<bool *>(in.mData));
             break;
         case AI_INT32:
-            out.mData = new int32_t(*static_cast<int32_t *>(in.mData));
+            out.mData = AllocateSceneObject<int32_t>(*static_cast<int32_t *>(in.mData));
             break;
         case AI_UINT64:
-            out.mData = new uint64_t(*static_cast<uint64_t *>(in.mData));
+            out.mData = AllocateSceneObject<uint64_t>(*static_cast<uint64_t *>(in.mData));
             break;
         case AI_FLOAT:
-            out.mData = new float(*static_cast<float *>(in.mData));
+            out.mData = AllocateSceneObject<float>(*static_cast<float *>(in.mData));
             break;
         case AI_DOUBLE:
-            out.mData = new double(*static_cast<double *>(in.mData));
+            out.mData = AllocateSceneObject<double>(*static_cast<double *>(in.mData));
             break;
         case AI_AISTRING:
-            out.mData = new aiString(*static_cast<aiString *>(in.mData));
+            out.mData = AllocateSceneObject<aiString>(*static_cast<aiString *>(in.mData));
             break;
         case AI_AIVECTOR3D:
-            out.mData = new aiVector3D(*static_cast<aiVector3D *>(in.mData));
+            out.mData = AllocateSceneObject<aiVector3D>(*static_cast<aiVector3D *>(in.mData));
             break;
         default:
             ai_assert(false);
@@ -0,0 +1,281 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2021, assimp team
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+/** @file Implementation of the SceneGenerator helper class
+ */
+
+#include <assimp/SceneGenerator.h>
+#include <assimp/StandardShapes.h>
+#include <assimp/anim.h>
+#include <assimp/material.h>
+#include <assimp/mesh.h>
+#include <assimp/scene.h>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace Assimp;
+
+namespace {
+
+// ------------------------------------------------------------------------------------------------
+// SplitMix64, gives the same sequence on every platform unlike the std distributions
+class Random {
+public:
+    explicit Random(uint64_t seed) :
+            mState(seed) {
+        // empty
+    }
+
+    uint64_t Next() {
+        uint64_t z = (mState += 0x9e3779b97f4a7c15ull);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+        return z ^ (z >> 31);
+    }
+
+    // Uniform number in [lo, hi)
+    ai_real Range(ai_real lo, ai_real hi) {
+        return lo + (hi - lo) * static_cast<ai_real>(static_cast<double>(Next() >> 11) * (1.0 / 9007199254740992.0));
+    }
+
+private:
+    uint64_t mState;
+};
+
+// ------------------------------------------------------------------------------------------------
+aiNode *AddChild(aiNode *parent, const std::string &name) {
+    aiNode *node = new aiNode(name);
+    node->mParent = parent;
+
+    aiNode **children = AllocateSceneArray<aiNode *>(parent->mNumChildren + 1);
+    std::copy(parent->mChildren, parent->mChildren + parent->mNumChildren, children);
+    children[parent->mNumChildren] = node;
+    FreeSceneArray(parent->mChildren);
+    parent->mChildren = children;
+    ++parent->mNumChildren;
+    return node;
+}
+
+// ------------------------------------------------------------------------------------------------
+aiMatrix4x4 RandomTransform(Random &random, ai_real extent) {
+    aiMatrix4x4 rotation, translation;
+    aiMatrix4x4::Rotation(random.Range(0, ai_real(AI_MATH_TWO_PI)),
+            aiVector3D(random.Range(-1, 1), random.Range(-1, 1), 1).Normalize(), rotation);
+    aiMatrix4x4::Translation(aiVector3D(random.Range(-extent, extent), random.Range(-extent, extent),
+            random.Range(-extent, extent)), translation);
+    return translation * rotation;
+}
+
+// ------------------------------------------------------------------------------------------------
+// A copy of the unit sphere with waves of random frequency and phase on its surface
+aiMesh *MakeSphereMesh(const std::vector<aiVector3D> &sphere, Random &random) {
+    aiMesh *mesh = new aiMesh();
+    mesh->mPrimitiveTypes = aiPrimitiveType_TRIANGLE;
+    mesh->mNumVertices = static_cast<unsigned int>(sphere.size());
+    mesh->mVertices = new aiVector3D[mesh->mNumVertices];
+    mesh->mNormals = new aiVector3D[mesh->mNumVertices];
+    mesh->mTextureCoords[0] = new aiVector3D[mesh->mNumVertices];
+    mesh->mNumUVComponents[0] = 2;
+
+    const ai_real radius = random.Range(ai_real(0.5), ai_real(2.0));
+    const ai_real frequency = random.Range(ai_real(2.0), ai_real(12.0));
+    const ai_real phase = random.Range(0, ai_real(AI_MATH_TWO_PI));
+    for (unsigned int v = 0; v < mesh->mNumVertices; ++v) {
+        const aiVector3D &n = sphere[v];
+        const ai_real wave = std::sin(frequency * n.x + phase) * std::cos(frequency * n.y - phase);
+        mesh->mVertices[v] = n * (radius * (1 + ai_real(0.05) * wave));
+        mesh->mNormals[v] = n;
+        mesh->mTextureCoords[0][v] = aiVector3D(
+                std::atan2(n.z, n.x) / ai_real(AI_MATH_TWO_PI) + ai_real(0.5),
+                std::asin(std::max(ai_real(-1), std::min(ai_real(1), n.y))) / ai_real(AI_MATH_PI) + ai_real(0.5),
+                0);
+    }
+
+    unsigned int *indices = mesh->AllocateUniformFaces(mesh->mNumVertices / 3, 3);
+    for (unsigned int i = 0; i < mesh->mNumVertices; ++i) {
+        indices[i] = i;
+    }
+    return mesh;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Bind each vertex to one of the bones, in runs of consecutive vertices
+void AddBones(aiMesh *mesh, aiNode *meshNode, unsigned int numBones) {
+    mesh->mNumBones = numBones;
+    mesh->mBones = AllocateSceneArray<aiBone *>(numBones);
+
+    aiNode *skeleton = nullptr;
+    const unsigned int numVertices = mesh->mNumVertices;
+    for (unsigned int b = 0; b < numBones; ++b) {
+        const std::string name = std::string(meshNode->mName.C_Str()) + "_bone_" + std::to_string(b);
+        aiNode *node = AddChild(skeleton ? skeleton : meshNode, name);
+        if (!skeleton) {
+            skeleton = node;
+        }
+
+        const unsigned int first = static_cast<unsigned int>(static_cast<uint64_t>(numVertices) * b / numBones);
+        const unsigned int last = static_cast<unsigned int>(static_cast<uint64_t>(numVertices) * (b + 1) / numBones);
+
+        aiBone *bone = mesh->mBones[b] = new aiBone();
+        bone->mName = name;
+        bone->mNumWeights = last - first;
+        bone->mWeights = bone->mNumWeights ? new aiVertexWeight[bone->mNumWeights] : nullptr;
+        for (unsigned int v = first; v < last; ++v) {
+            bone->mWeights[v - first] = aiVertexWeight(v, 1);
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+aiNodeAnim *MakeChannel(const aiNode *node, unsigned int numKeys, Random &random) {
+    aiNodeAnim *channel = new aiNodeAnim();
+    channel->mNodeName = node->mName;
+    channel->mNumPositionKeys = channel->mNumRotationKeys = channel->mNumScalingKeys = numKeys;
+    channel->mPositionKeys = new aiVectorKey[numKeys];
+    channel->mRotationKeys = new aiQuatKey[numKeys];
+    channel->mScalingKeys = new aiVectorKey[numKeys];
+
+    aiVector3D scaling, position;
+    aiQuaternion rotation;
+    node->mTransformation.Decompose(scaling, rotation, position);
+
+    const aiVector3D axis = aiVector3D(random.Range(-1, 1), random.Range(-1, 1), 1).Normalize();
+    for (unsigned int k = 0; k < numKeys; ++k) {
+        const double time = static_cast<double>(k);
+        position += aiVector3D(random.Range(-1, 1), random.Range(-1, 1), random.Range(-1, 1)) * ai_real(0.1);
+        channel->mPositionKeys[k] = aiVectorKey(time, position);
+        channel->mRotationKeys[k] = aiQuatKey(time, rotation * aiQuaternion(axis, random.Range(-1, 1)));
+        channel->mScalingKeys[k] = aiVectorKey(time, scaling);
+    }
+    return channel;
+}
+
+} // namespace
+
+const unsigned int SceneGenerator::MaxTrianglesPerMesh;
+
+// ------------------------------------------------------------------------------------------------
+aiScene *SceneGenerator::Generate(const Params &params) {
+    std::unique_ptr<aiScene> scene(new aiScene());
+    Random random(params.mSeed);
+
+    // materials
+    scene->mNumMaterials = std::max(1u, params.mNumMaterials);
+    scene->mMaterials = AllocateSceneArray<aiMaterial *>(scene->mNumMaterials);
+    for (unsigned int i = 0; i < scene->mNumMaterials; ++i) {
+        aiMaterial *mat = scene->mMaterials[i] = new aiMaterial();
+        const aiString name("material_" + std::to_string(i));
+        mat->AddProperty(&name, AI_MATKEY_NAME);
+        const aiColor3D diffuse(random.Range(0, 1), random.Range(0, 1), random.Range(0, 1));
+        mat->AddProperty(&diffuse, 1, AI_MATKEY_COLOR_DIFFUSE);
+        const ai_real shininess = random.Range(1, 128);
+        mat->AddProperty(&shininess, 1, AI_MATKEY_SHININESS);
+    }
+
+    // the chain of nested nodes
+    scene->mRootNode = new aiNode("root");
+    std::vector<aiNode *> levels(1, scene->mRootNode);
+    for (unsigned int d = 0; d < params.mNodeDepth; ++d) {
+        aiNode *node = AddChild(levels.back(), "level_" + std::to_string(d));
+        node->mTransformation = RandomTransform(random, 1);
+        levels.push_back(node);
+    }
+
+    // all meshes start from the same sphere, cut to the requested size
+    const unsigned int numTriangles = std::max(1u, std::min(params.mNumTriangles, MaxTrianglesPerMesh));
+    unsigned int tess = 0;
+    while ((8u << (2 * tess)) < numTriangles) {
+        ++tess;
+    }
+    std::vector<aiVector3D> sphere;
+    StandardShapes::MakeSphere(tess, sphere);
+    sphere.resize(static_cast<size_t>(numTriangles) * 3);
+
+    std::vector<aiNode *> animated;
+    scene->mNumMeshes = params.mNumMeshes;
+    scene->mMeshes = params.mNumMeshes ? AllocateSceneArray<aiMesh *>(params.mNumMeshes, nullptr) : nullptr;
+    for (unsigned int i = 0; i < params.mNumMeshes; ++i) {
+        aiMesh *mesh = scene->mMeshes[i] = MakeSphereMesh(sphere, random);
+        mesh->mName = "mesh_" + std::to_string(i);
+        mesh->mMaterialIndex = i % scene->mNumMaterials;
+
+        aiNode *node = AddChild(levels[i % levels.size()], mesh->mName.C_Str());
+        node->mTransformation = RandomTransform(random, 100);
+        node->mNumMeshes = 1;
+        node->mMeshes = AllocateSceneArray<unsigned int>(1);
+        node->mMeshes[0] = i;
+
+        if (params.mNumBones) {
+            AddBones(mesh, node, params.mNumBones);
+            for (unsigned int c = 0; c < node->mNumChildren; ++c) {
+                animated.push_back(node->mChildren[c]);
+            }
+            for (unsigned int c = 0; node->mNumChildren && c < node->mChildren[0]->mNumChildren; ++c) {
+                animated.push_back(node->mChildren[0]->mChildren[c]);
+            }
+        } else {
+            animated.push_back(node);
+        }
+    }
+
+    if (params.mNumKeys && !animated.empty()) {
+        aiAnimation *anim = new aiAnimation();
+        anim->mName = "generated";
+        anim->mTicksPerSecond = 24;
+        anim->mDuration = params.mNumKeys - 1;
+        anim->mNumChannels = static_cast<unsigned int>(animated.size());
+        anim->mChannels = AllocateSceneArray<aiNodeAnim *>(anim->mNumChannels);
+        for (unsigned int c = 0; c < anim->mNumChannels; ++c) {
+            anim->mChannels[c] = MakeChannel(animated[c], params.mNumKeys, random);
+        }
+
+        scene->mNumAnimations = 1;
+        scene->mAnimations = AllocateSceneArray<aiAnimation *>(1);
+        scene->mAnimations[0] = anim;
+    }
+
+    return scene.release();
+}
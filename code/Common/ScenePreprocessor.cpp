@@ -73,7 +73,7 @@ void ScenePreprocessor::ProcessScene() {
 
     // Generate a default material if none was specified
     if (!scene->mNumMaterials && scene->mNumMeshes) {
-        scene->mMaterials = new aiMaterial *[2];
+        scene->mMaterials = AllocateSceneArray<aiMaterial *>(2);
         aiMaterial *helper;
 
         aiString name;
@@ -136,8 +136,9 @@ void ScenePreprocessor::ProcessMesh(aiMesh *mesh) {
     }
 
     // If the information which primitive types are there in the
-    // mesh is currently not available, compute it.
-    if (!mesh->mPrimitiveTypes) {
+    // mesh is currently not available, compute it. Deferred meshes
+    // get it once their faces are loaded.
+    if (!mesh->mPrimitiveTypes && mesh->mFaces) {
         for (unsigned int a = 0; a < mesh->mNumFaces; ++a) {
             aiFace &face = mesh->mFaces[a];
             switch (face.mNumIndices) {
@@ -95,6 +95,13 @@ public:
      */
     void ProcessScene();
 
+    // ----------------------------------------------------------------
+    /** Preprocess a mesh in the scene, e.g. one whose payload was
+     *  loaded after the import.
+     *  @param mesh Mesh to be preprocessed.
+     */
+    void ProcessMesh(aiMesh *mesh);
+
 protected:
     // ----------------------------------------------------------------
     /** Preprocess an animation in the scene
@@ -102,12 +109,6 @@ protected:
      */
     void ProcessAnimation(aiAnimation *anim);
 
-    // ----------------------------------------------------------------
-    /** Preprocess a mesh in the scene
-     *  @param mesh Mesh to be preprocessed.
-     */
-    void ProcessMesh(aiMesh *mesh);
-
 protected:
     //! Scene we're currently working on
     aiScene *scene;
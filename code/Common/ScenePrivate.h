@@ -46,13 +46,17 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef AI_SCENEPRIVATE_H_INCLUDED
 #define AI_SCENEPRIVATE_H_INCLUDED
 
+#include <assimp/Allocator.h>
 #include <assimp/ai_assert.h>
 #include <assimp/scene.h>
 
+#include <unordered_set>
+
 namespace Assimp {
 
 // Forward declarations
 class Importer;
+class SceneArena;
 
 struct ScenePrivateData {
     //  The struct constructor.
@@ -71,13 +75,31 @@ struct ScenePrivateData {
     // and mOrigImporter are no longer safe to rely on and only
     // serve informative purposes.
     bool mIsCopy;
+
+    // Arena holding the nodes, meshes, bones and animations of the scene
+    // if it was imported with AI_CONFIG_GLOB_SCENE_ARENA. Owned by this
+    // instance, the destructor of the scene releases it last.
+    SceneArena* mArena;
+
+    // Meshes of a copy made with AI_INT_COPY_SCENE_SHARE_MESH_DATA whose
+    // vertex and face arrays are borrowed from the source scene. Owned by
+    // this instance, the destructor of the scene doesn't free those arrays.
+    std::unordered_set<const aiMesh*>* mSharedMeshes;
+
+    // true if the index, pointer and byte arrays of the scene have the
+    // header of AllocateSceneArray(), see SceneArrayScope. Taken from the
+    // thread constructing the scene.
+    bool mTrackedArrays;
 };
 
 inline
 ScenePrivateData::ScenePrivateData() AI_NO_EXCEPT
 : mOrigImporter( nullptr )
 , mPPStepsApplied( 0 )
-, mIsCopy( false ) {
+, mIsCopy( false )
+, mArena( nullptr )
+, mSharedMeshes( nullptr )
+, mTrackedArrays( SceneArrayScope::IsTracked() ) {
     // empty
 }
 
@@ -68,17 +68,17 @@ SkeletonMeshBuilder::SkeletonMeshBuilder(aiScene *pScene, aiNode *root, bool bKn
 
     // create a mesh to hold all the generated faces
     pScene->mNumMeshes = 1;
-    pScene->mMeshes = new aiMesh *[1];
+    pScene->mMeshes = AllocateSceneArray<aiMesh *>(1);
     pScene->mMeshes[0] = CreateMesh();
     // and install it at the root node
     root->mNumMeshes = 1;
-    root->mMeshes = new unsigned int[1];
+    root->mMeshes = AllocateSceneArray<unsigned int>(1);
     root->mMeshes[0] = 0;
 
     // create a dummy material for the mesh
     if (pScene->mNumMaterials == 0) {
         pScene->mNumMaterials = 1;
-        pScene->mMaterials = new aiMaterial *[1];
+        pScene->mMaterials = AllocateSceneArray<aiMaterial *>(1);
         pScene->mMaterials[0] = CreateMaterial();
     }
 }
@@ -217,7 +217,7 @@ aiMesh *SkeletonMeshBuilder::CreateMesh() {
         const Face &inface = mFaces[a];
         aiFace &outface = mesh->mFaces[a];
         outface.mNumIndices = 3;
-        outface.mIndices = new unsigned int[3];
+        outface.mIndices = AllocateSceneArray<unsigned int>(3);
         outface.mIndices[0] = inface.mIndices[0];
         outface.mIndices[1] = inface.mIndices[1];
         outface.mIndices[2] = inface.mIndices[2];
@@ -236,7 +236,7 @@ aiMesh *SkeletonMeshBuilder::CreateMesh() {
 
     // add the bones
     mesh->mNumBones = static_cast<unsigned int>(mBones.size());
-    mesh->mBones = new aiBone *[mesh->mNumBones];
+    mesh->mBones = AllocateSceneArray<aiBone *>(mesh->mNumBones);
     std::copy(mBones.begin(), mBones.end(), mesh->mBones);
 
     // default
@@ -138,7 +138,7 @@ aiMesh *StandardShapes::MakeMesh(const std::vector<aiVector3D> &positions,
     for (unsigned int i = 0, a = 0; i < out->mNumFaces; ++i) {
         aiFace &f = out->mFaces[i];
         f.mNumIndices = numIndices;
-        f.mIndices = new unsigned int[numIndices];
+        f.mIndices = AllocateSceneArray<unsigned int>(numIndices);
         for (unsigned int j = 0; j < numIndices; ++j, ++a) {
             f.mIndices[j] = a;
         }
@@ -0,0 +1,302 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2021, assimp team
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+/** @file Implementation of the work-stealing TaskScheduler
+ */
+
+#include "TaskScheduler.h"
+
+#include <assimp/Allocator.h>
+#include <assimp/ImportLimits.h>
+
+#include <algorithm>
+
+using namespace Assimp;
+
+namespace {
+
+// Number of chunks queued per thread, more chunks balance uneven meshes
+// better at the cost of some queue traffic.
+static const size_t ChunksPerThread = 8;
+
+// Set on worker threads and on the calling thread while it executes tasks,
+// nested ParallelFor calls run serially then.
+thread_local bool tInsideTask = false;
+
+struct InsideTaskScope {
+    bool mPrevious;
+    InsideTaskScope() :
+            mPrevious(tInsideTask) {
+        tInsideTask = true;
+    }
+    ~InsideTaskScope() {
+        tInsideTask = mPrevious;
+    }
+};
+
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+TaskScheduler::TaskScheduler(unsigned int numThreads) :
+        mNumThreads(numThreads ? numThreads : GetHardwareConcurrency()),
+        mQueues(),
+        mThreads(),
+        mGeneration(0),
+        mStop(false),
+        mPendingChunks(0),
+        mTask(nullptr),
+        mLimits(nullptr),
+        mAllocator(nullptr),
+        mTrackedArrays(false),
+        mErrorIndex(0),
+        mError() {
+    for (unsigned int i = 0; i < mNumThreads; ++i) {
+        mQueues.emplace_back(new Queue());
+    }
+
+    // thread 0 is the one calling ParallelFor
+    for (unsigned int i = 1; i < mNumThreads; ++i) {
+        mThreads.emplace_back(&TaskScheduler::WorkerMain, this, i);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+TaskScheduler::~TaskScheduler() {
+    {
+        std::lock_guard<std::mutex> lock(mWakeMutex);
+        mStop = true;
+    }
+    mWakeCondition.notify_all();
+
+    for (std::thread &thread : mThreads) {
+        thread.join();
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+unsigned int TaskScheduler::GetHardwareConcurrency() {
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+// ------------------------------------------------------------------------------------------------
+unsigned int TaskScheduler::GetNumThreadsForSetting(int setting) {
+    if (setting < 0) {
+        return GetHardwareConcurrency();
+    }
+    return setting > 1 ? static_cast<unsigned int>(setting) : 1u;
+}
+
+// ------------------------------------------------------------------------------------------------
+void TaskScheduler::ParallelFor(size_t count, const Task &task) {
+    if (0 == count) {
+        return;
+    }
+
+    if (mNumThreads < 2 || count < 2 || tInsideTask) {
+        for (size_t i = 0; i < count; ++i) {
+            task(i);
+        }
+        return;
+    }
+
+    std::lock_guard<std::mutex> run(mRunMutex);
+
+    const size_t grain = std::max<size_t>(1, count / (mNumThreads * ChunksPerThread));
+    const size_t numChunks = (count + grain - 1) / grain;
+
+    mError = nullptr;
+    mErrorIndex = count;
+    mPendingChunks = numChunks;
+
+    // only this thread changes the generation, it is bumped once the
+    // chunks of the batch are queued
+    const unsigned int generation = mGeneration + 1;
+
+    // hand out consecutive chunks round-robin, each thread starts at the
+    // back of its own queue while thieves take from the front
+    for (size_t c = 0; c < numChunks; ++c) {
+        Chunk chunk;
+        chunk.mBegin = c * grain;
+        chunk.mEnd = std::min(count, chunk.mBegin + grain);
+        chunk.mGeneration = generation;
+
+        Queue &queue = *mQueues[c % mNumThreads];
+        std::lock_guard<std::mutex> lock(queue.mMutex);
+        queue.mChunks.push_back(chunk);
+    }
+
+    // the workers take the batch and its context under the same lock
+    {
+        std::lock_guard<std::mutex> lock(mWakeMutex);
+        mTask = &task;
+        mLimits = ImportLimits::GetActive();
+        mAllocator = Allocator::GetActive();
+        mTrackedArrays = SceneArrayScope::IsTracked();
+        mGeneration = generation;
+    }
+    mWakeCondition.notify_all();
+
+    {
+        InsideTaskScope scope;
+        RunChunks(0, generation, task);
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(mDoneMutex);
+        mDoneCondition.wait(lock, [this] { return 0 == mPendingChunks; });
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mWakeMutex);
+        mTask = nullptr;
+        mLimits = nullptr;
+        mAllocator = nullptr;
+    }
+    if (mError) {
+        std::exception_ptr error = mError;
+        mError = nullptr;
+        std::rethrow_exception(error);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void TaskScheduler::WorkerMain(unsigned int index) {
+    tInsideTask = true;
+
+    unsigned int generation = 0;
+    for (;;) {
+        const Task *task = nullptr;
+        ImportLimits *activeLimits = nullptr;
+        Allocator *activeAllocator = nullptr;
+        bool trackedArrays = false;
+        {
+            std::unique_lock<std::mutex> lock(mWakeMutex);
+            mWakeCondition.wait(lock, [&] { return mStop || generation != mGeneration; });
+            if (mStop) {
+                return;
+            }
+            generation = mGeneration;
+            task = mTask;
+            activeLimits = mLimits;
+            activeAllocator = mAllocator;
+            trackedArrays = mTrackedArrays;
+        }
+        if (nullptr == task) {
+            // the batch finished before this thread woke up
+            continue;
+        }
+        ImportLimits::Scope limits(activeLimits);
+        Allocator::Scope allocator(activeAllocator);
+        SceneArrayScope arrays(trackedArrays);
+        RunChunks(index, generation, *task);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void TaskScheduler::RunChunks(unsigned int index, unsigned int generation, const Task &task) {
+    Chunk chunk;
+    while (PopChunk(index, chunk) || StealChunk(index, chunk)) {
+        if (chunk.mGeneration != generation) {
+            // a thread late for the previous batch ran into the next one,
+            // leave the chunk to a thread with the right context
+            std::lock_guard<std::mutex> lock(mQueues[index]->mMutex);
+            mQueues[index]->mChunks.push_front(chunk);
+            return;
+        }
+        ExecuteChunk(chunk, task);
+
+        if (1 == mPendingChunks.fetch_sub(1)) {
+            std::lock_guard<std::mutex> lock(mDoneMutex);
+            mDoneCondition.notify_all();
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+bool TaskScheduler::PopChunk(unsigned int index, Chunk &chunk) {
+    Queue &queue = *mQueues[index];
+    std::lock_guard<std::mutex> lock(queue.mMutex);
+    if (queue.mChunks.empty()) {
+        return false;
+    }
+    chunk = queue.mChunks.back();
+    queue.mChunks.pop_back();
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+bool TaskScheduler::StealChunk(unsigned int index, Chunk &chunk) {
+    for (unsigned int i = 1; i < mNumThreads; ++i) {
+        Queue &queue = *mQueues[(index + i) % mNumThreads];
+        std::lock_guard<std::mutex> lock(queue.mMutex);
+        if (!queue.mChunks.empty()) {
+            chunk = queue.mChunks.front();
+            queue.mChunks.pop_front();
+            return true;
+        }
+    }
+    return false;
+}
+
+// ------------------------------------------------------------------------------------------------
+void TaskScheduler::ExecuteChunk(const Chunk &chunk, const Task &task) {
+    {
+        // indices behind a failed one can't change the outcome anymore
+        std::lock_guard<std::mutex> lock(mErrorMutex);
+        if (mError && chunk.mBegin > mErrorIndex) {
+            return;
+        }
+    }
+
+    for (size_t i = chunk.mBegin; i < chunk.mEnd; ++i) {
+        try {
+            task(i);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(mErrorMutex);
+            if (!mError || i < mErrorIndex) {
+                mError = std::current_exception();
+                mErrorIndex = i;
+            }
+            return;
+        }
+    }
+}
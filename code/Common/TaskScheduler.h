@@ -0,0 +1,176 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2021, assimp team
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file Defines a small work-stealing task scheduler used to run the
+ *  per-mesh part of post processing steps in parallel */
+#ifndef AI_TASKSCHEDULER_H_INC
+#define AI_TASKSCHEDULER_H_INC
+
+#include <assimp/defs.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Assimp {
+
+class Allocator;
+class ImportLimits;
+
+// --------------------------------------------------------------------------------------------
+/** @brief A fixed-size pool of worker threads executing index ranges.
+ *
+ *  #ParallelFor splits the index range into chunks which are distributed
+ *  over per-thread queues. Every thread pops work from the back of its own
+ *  queue and steals from the front of the other queues once it runs dry. The
+ *  calling thread takes part in the work, so a scheduler with one thread
+ *  does not spawn any threads at all.
+ *
+ *  The scheduler makes no promise about the order in which the indices are
+ *  visited, callers must write their results to per-index slots and combine
+ *  them afterwards to get deterministic output. The import limits active
+ *  on the calling thread apply to the workers as well. */
+// --------------------------------------------------------------------------------------------
+class ASSIMP_API TaskScheduler {
+public:
+    /** Function called once per index. */
+    typedef std::function<void(size_t)> Task;
+
+    // ----------------------------------------------------------------------------
+    /** @brief Construction
+     *  @param numThreads Total number of threads including the caller's
+     *    thread. 0 selects #GetHardwareConcurrency(). */
+    explicit TaskScheduler(unsigned int numThreads);
+
+    // ----------------------------------------------------------------------------
+    /** @brief Destructor, joins all worker threads */
+    ~TaskScheduler();
+
+    // ----------------------------------------------------------------------------
+    /** @brief Calls task(i) for all i in [0, count) and waits for completion.
+     *
+     *  Calls made from within a running task are executed serially on the
+     *  calling thread. If one or more tasks throw, the exception of the
+     *  lowest index is rethrown once all work has finished.
+     *  @param count Number of indices
+     *  @param task Function to invoke per index */
+    void ParallelFor(size_t count, const Task &task);
+
+    // ----------------------------------------------------------------------------
+    /** @brief Get the total number of threads used by #ParallelFor */
+    unsigned int GetNumThreads() const {
+        return mNumThreads;
+    }
+
+    // ----------------------------------------------------------------------------
+    /** @brief Get the number of hardware threads, at least 1 */
+    static unsigned int GetHardwareConcurrency();
+
+    // ----------------------------------------------------------------------------
+    /** @brief Get the number of threads for a value of
+     *  #AI_CONFIG_GLOB_MULTITHREADING: -1 selects #GetHardwareConcurrency(),
+     *  0 and 1 both mean single-threaded. */
+    static unsigned int GetNumThreadsForSetting(int setting);
+
+private:
+    TaskScheduler(const TaskScheduler &) = delete;
+    TaskScheduler &operator=(const TaskScheduler &) = delete;
+
+    //! Half-open index range of the batch with the given generation
+    struct Chunk {
+        size_t mBegin;
+        size_t mEnd;
+        unsigned int mGeneration;
+    };
+
+    //! Per-thread work queue
+    struct Queue {
+        std::mutex mMutex;
+        std::deque<Chunk> mChunks;
+    };
+
+    void WorkerMain(unsigned int index);
+    void RunChunks(unsigned int index, unsigned int generation, const Task &task);
+    bool PopChunk(unsigned int index, Chunk &chunk);
+    bool StealChunk(unsigned int index, Chunk &chunk);
+    void ExecuteChunk(const Chunk &chunk, const Task &task);
+
+    unsigned int mNumThreads;
+    std::vector<std::unique_ptr<Queue>> mQueues;
+    std::vector<std::thread> mThreads;
+
+    //! Serializes concurrent ParallelFor calls from different threads
+    std::mutex mRunMutex;
+
+    //! Wakes up the workers when a new batch of work was queued
+    std::mutex mWakeMutex;
+    std::condition_variable mWakeCondition;
+    unsigned int mGeneration;
+    bool mStop;
+
+    //! Signals the caller once all chunks have been executed
+    std::mutex mDoneMutex;
+    std::condition_variable mDoneCondition;
+    std::atomic<size_t> mPendingChunks;
+
+    //! The task of the current batch and the limits, the allocator and the
+    //! array layout of its caller, guarded by mWakeMutex, and the first
+    //! error it produced
+    const Task *mTask;
+    ImportLimits *mLimits;
+    Allocator *mAllocator;
+    bool mTrackedArrays;
+    std::mutex mErrorMutex;
+    size_t mErrorIndex;
+    std::exception_ptr mError;
+};
+
+} // namespace Assimp
+
+#endif // AI_TASKSCHEDULER_H_INC
@@ -42,7 +42,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 // Actually just a dummy, used by the compiler to build the pre-compiled header.
 
+#include "SceneArena.h"
 #include "ScenePrivate.h"
+#include <assimp/SceneCombiner.h>
 #include <assimp/scene.h>
 #include <assimp/version.h>
 
@@ -142,6 +144,25 @@ ASSIMP_API aiScene::aiScene() :
 
 // ------------------------------------------------------------------------------------------------
 ASSIMP_API aiScene::~aiScene() {
+    Assimp::ScenePrivateData *priv = static_cast<Assimp::ScenePrivateData *>(mPrivate);
+
+    // all objects and arrays of an arena scene live in the arena, their
+    // destructors release nothing else
+    if (nullptr != priv && nullptr != priv->mArena) {
+        delete priv->mSharedMeshes;
+        delete priv->mArena;
+        delete priv;
+        return;
+    }
+
+    // the arrays are released the way they were allocated
+    Assimp::SceneArrayScope arrays(this);
+
+    // meshes of a shared copy don't own their vertex and face arrays
+    if (nullptr != priv && nullptr != priv->mSharedMeshes) {
+        Assimp::SceneCombiner::DetachSharedMeshData(this);
+    }
+
     // delete all sub-objects recursively
     delete mRootNode;
 
@@ -151,37 +172,37 @@ ASSIMP_API aiScene::~aiScene() {
     if (mNumMeshes && mMeshes)
         for (unsigned int a = 0; a < mNumMeshes; a++)
             delete mMeshes[a];
-    delete[] mMeshes;
+    Assimp::FreeSceneArray(mMeshes);
 
     if (mNumMaterials && mMaterials) {
         for (unsigned int a = 0; a < mNumMaterials; ++a) {
             delete mMaterials[a];
         }
     }
-    delete[] mMaterials;
+    Assimp::FreeSceneArray(mMaterials);
 
     if (mNumAnimations && mAnimations)
         for (unsigned int a = 0; a < mNumAnimations; a++)
             delete mAnimations[a];
-    delete[] mAnimations;
+    Assimp::FreeSceneArray(mAnimations);
 
     if (mNumTextures && mTextures)
         for (unsigned int a = 0; a < mNumTextures; a++)
             delete mTextures[a];
-    delete[] mTextures;
+    Assimp::FreeSceneArray(mTextures);
 
     if (mNumLights && mLights)
         for (unsigned int a = 0; a < mNumLights; a++)
             delete mLights[a];
-    delete[] mLights;
+    Assimp::FreeSceneArray(mLights);
 
     if (mNumCameras && mCameras)
         for (unsigned int a = 0; a < mNumCameras; a++)
             delete mCameras[a];
-    delete[] mCameras;
+    Assimp::FreeSceneArray(mCameras);
 
     aiMetadata::Dealloc(mMetaData);
     mMetaData = nullptr;
 
-    delete static_cast<Assimp::ScenePrivateData *>(mPrivate);
+    delete priv;
 }
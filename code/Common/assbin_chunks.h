@@ -4,6 +4,9 @@
 #define ASSBIN_VERSION_MAJOR 1
 #define ASSBIN_VERSION_MINOR 0
 
+// major version of the aligned layout, see section 4 below
+#define ASSBIN_VERSION_MAJOR_ALIGNED 2
+
 /**
 @page assfile .ASS File formats
 
@@ -164,6 +167,47 @@ The general 'rule' to get from Assimp headers to the serialized layout is:
 
    - mNumAllocated is omitted, for obvious reasons :-)
 
+-------------------------------------------------------------------------------
+4. Aligned layout (major version 2):
+-------------------------------------------------------------------------------
+
+Files with major version ASSBIN_VERSION_MAJOR_ALIGNED are never compressed
+or shortened. The vertex and face data of the meshes is stored in streams
+which are aligned to ASSBIN_STREAM_ALIGNMENT bytes, so a reader can copy
+each of them into place with a single read, or take it straight from a
+memory mapping of the file.
+
+----------------------
+| Header (512 bytes) |
+----------------------
+| Table of contents  |
+----------------------
+| Scene chunk        |
+----------------------
+| Aligned streams    |
+----------------------
+
+Table of contents:
+
+integer     ASSBIN_CHUNK_AITOC
+integer     Number of meshes n
+long        File offset of the ASSBIN_CHUNK_AISCENE chunk
+[n times]
+    integer     aiMesh::mNumVertices
+    integer     aiMesh::mNumFaces
+    integer     Total number of indices of all faces
+    integer     Number of indices of every face, 0 if they differ
+    long[ASSBIN_STREAM_COUNT]
+                File offsets of the streams, 0 for absent streams
+
+long is eight bytes wide, stored in little-endian byte order.
+
+The scene chunk is stored as in version 1, except that ASSBIN_CHUNK_AIMESH
+chunks only keep the integer of ASSBIN_MESH_HAS_xxx bits and the
+mNumUVComponents of each channel. Vertex streams hold float[3] (float[4]
+for colors) per vertex, the face size stream one integer per face and the
+face index stream one integer per index.
+
 
  @endverbatim*/
 
@@ -182,6 +226,7 @@ The general 'rule' to get from Assimp headers to the serialized layout is:
 #define ASSBIN_CHUNK_AINODE                     0x123c
 #define ASSBIN_CHUNK_AIMATERIAL                 0x123d
 #define ASSBIN_CHUNK_AIMATERIALPROPERTY         0x123e
+#define ASSBIN_CHUNK_AITOC                      0x123f
 
 #define ASSBIN_MESH_HAS_POSITIONS                   0x1
 #define ASSBIN_MESH_HAS_NORMALS                     0x2
@@ -192,5 +237,23 @@ The general 'rule' to get from Assimp headers to the serialized layout is:
 #define ASSBIN_MESH_HAS_TEXCOORD(n) (ASSBIN_MESH_HAS_TEXCOORD_BASE << n)
 #define ASSBIN_MESH_HAS_COLOR(n)    (ASSBIN_MESH_HAS_COLOR_BASE << n)
 
+// streams of a mesh in the aligned layout
+#define ASSBIN_STREAM_ALIGNMENT                     16
+#define ASSBIN_STREAM_MAX_COLOR_SETS                8
+#define ASSBIN_STREAM_MAX_TEXCOORDS                 8
+
+#define ASSBIN_STREAM_POSITIONS                     0
+#define ASSBIN_STREAM_NORMALS                       1
+#define ASSBIN_STREAM_TANGENTS                      2
+#define ASSBIN_STREAM_BITANGENTS                    3
+#define ASSBIN_STREAM_COLOR_BASE                    4
+#define ASSBIN_STREAM_TEXCOORD_BASE                 12
+#define ASSBIN_STREAM_FACE_SIZES                    20
+#define ASSBIN_STREAM_FACE_INDICES                  21
+#define ASSBIN_STREAM_COUNT                         22
+
+#define ASSBIN_STREAM_COLOR(n)      (ASSBIN_STREAM_COLOR_BASE + n)
+#define ASSBIN_STREAM_TEXCOORD(n)   (ASSBIN_STREAM_TEXCOORD_BASE + n)
+
 
 #endif // INCLUDED_ASSBIN_CHUNKS_H
@@ -73,8 +73,8 @@ aiNode::~aiNode() {
         for (unsigned int a = 0; a < mNumChildren; a++)
             delete mChildren[a];
     }
-    delete[] mChildren;
-    delete[] mMeshes;
+    Assimp::FreeSceneArray(mChildren);
+    Assimp::FreeSceneArray(mMeshes);
     delete mMetaData;
 }
 
@@ -121,17 +121,17 @@ void aiNode::addChildren(unsigned int numChildren, aiNode **children) {
     }
 
     if (mNumChildren > 0) {
-        aiNode **tmp = new aiNode*[mNumChildren];
+        aiNode **tmp = Assimp::AllocateSceneArray<aiNode *>(mNumChildren);
         ::memcpy(tmp, mChildren, sizeof(aiNode*) * mNumChildren);
-        delete[] mChildren;
-        mChildren = new aiNode*[mNumChildren + numChildren];
+        Assimp::FreeSceneArray(mChildren);
+        mChildren = Assimp::AllocateSceneArray<aiNode *>(mNumChildren + numChildren);
         ::memcpy(mChildren, tmp, sizeof(aiNode*) * mNumChildren);
         ::memcpy(&mChildren[mNumChildren], children, sizeof(aiNode*)* numChildren);
         mNumChildren += numChildren;
-        delete[] tmp;
+        Assimp::FreeSceneArray(tmp);
     }
     else {
-        mChildren = new aiNode*[numChildren];
+        mChildren = Assimp::AllocateSceneArray<aiNode *>(numChildren);
         for (unsigned int i = 0; i < numChildren; i++) {
             mChildren[i] = children[i];
         }
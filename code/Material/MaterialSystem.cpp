@@ -390,14 +390,14 @@ static const unsigned int DefaultNumAllocated = 5;
 aiMaterial::aiMaterial() :
         mProperties(nullptr), mNumProperties(0), mNumAllocated(DefaultNumAllocated) {
     // Allocate 5 entries by default
-    mProperties = new aiMaterialProperty *[DefaultNumAllocated];
+    mProperties = AllocateSceneArray<aiMaterialProperty *>(DefaultNumAllocated);
 }
 
 // ------------------------------------------------------------------------------------------------
 aiMaterial::~aiMaterial() {
     Clear();
 
-    delete[] mProperties;
+    FreeSceneArray(mProperties);
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -481,7 +481,7 @@ aiReturn aiMaterial::AddBinaryProperty(const void *pInput,
     pcNew->mIndex = index;
 
     pcNew->mDataLength = pSizeInBytes;
-    pcNew->mData = new char[pSizeInBytes];
+    pcNew->mData = AllocateSceneArray<char>(pSizeInBytes);
     memcpy(pcNew->mData, pInput, pSizeInBytes);
 
     pcNew->mKey.length = static_cast<ai_uint32>(::strlen(pKey));
@@ -500,7 +500,7 @@ aiReturn aiMaterial::AddBinaryProperty(const void *pInput,
 
         aiMaterialProperty **ppTemp;
         try {
-            ppTemp = new aiMaterialProperty *[mNumAllocated];
+            ppTemp = AllocateSceneArray<aiMaterialProperty *>(mNumAllocated);
         } catch (std::bad_alloc &) {
             delete pcNew;
             return AI_OUTOFMEMORY;
@@ -509,7 +509,7 @@ aiReturn aiMaterial::AddBinaryProperty(const void *pInput,
         // just copy all items over; then replace the old array
         memcpy(ppTemp, mProperties, iOld * sizeof(void *));
 
-        delete[] mProperties;
+        FreeSceneArray(mProperties);
         mProperties = ppTemp;
     }
     // push back ...
@@ -565,7 +565,7 @@ void aiMaterial::CopyPropertyList(aiMaterial *pcDest,
     pcDest->mNumProperties += pcSrc->mNumProperties;
 
     aiMaterialProperty **pcOld = pcDest->mProperties;
-    pcDest->mProperties = new aiMaterialProperty *[pcDest->mNumAllocated];
+    pcDest->mProperties = AllocateSceneArray<aiMaterialProperty *>(pcDest->mNumAllocated);
 
     if (iOldNum && pcOld) {
         for (unsigned int i = 0; i < iOldNum; ++i) {
@@ -574,7 +574,7 @@ void aiMaterial::CopyPropertyList(aiMaterial *pcDest,
     }
 
     if (pcOld) {
-        delete[] pcOld;
+        FreeSceneArray(pcOld);
     }
 
     for (unsigned int i = iOldNum; i < pcDest->mNumProperties; ++i) {
@@ -602,7 +602,7 @@ void aiMaterial::CopyPropertyList(aiMaterial *pcDest,
         prop->mSemantic = propSrc->mSemantic;
         prop->mIndex = propSrc->mIndex;
 
-        prop->mData = new char[propSrc->mDataLength];
+        prop->mData = AllocateSceneArray<char>(propSrc->mDataLength);
         memcpy(prop->mData, propSrc->mData, prop->mDataLength);
     }
 }
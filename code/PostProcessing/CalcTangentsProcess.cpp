@@ -51,6 +51,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/TinyFormatter.h>
 #include <assimp/qnan.h>
 
+#include <algorithm>
+#include <vector>
+
 using namespace Assimp;
 
 // ------------------------------------------------------------------------------------------------
@@ -90,12 +93,30 @@ void CalcTangentsProcess::SetupProperties(const Importer *pImp) {
 void CalcTangentsProcess::Execute(aiScene *pScene) {
     ai_assert(nullptr != pScene);
 
+    ExecuteMeshPasses(pScene);
+}
+
+// ------------------------------------------------------------------------------------------------
+bool CalcTangentsProcess::SupportsMeshPass() const {
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+void CalcTangentsProcess::BeginMeshPass(aiScene *pScene) {
     ASSIMP_LOG_DEBUG("CalcTangentsProcess begin");
 
-    bool bHas = false;
-    for (unsigned int a = 0; a < pScene->mNumMeshes; a++) {
-        if (ProcessMesh(pScene->mMeshes[a], a)) bHas = true;
-    }
+    mProcessed.assign(pScene->mNumMeshes, 0);
+}
+
+// ------------------------------------------------------------------------------------------------
+void CalcTangentsProcess::ExecuteMeshPass(aiScene *pScene, unsigned int meshIndex) {
+    mProcessed[meshIndex] = ProcessMesh(pScene->mMeshes[meshIndex], meshIndex);
+}
+
+// ------------------------------------------------------------------------------------------------
+void CalcTangentsProcess::EndMeshPass(aiScene * /*pScene*/) {
+    const bool bHas = std::find(mProcessed.begin(), mProcessed.end(), 1) != mProcessed.end();
+    mProcessed.clear();
 
     if (bHas) {
         ASSIMP_LOG_INFO("CalcTangentsProcess finished. Tangents have been calculated");
@@ -48,6 +48,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "Common/BaseProcess.h"
 
+#include <vector>
+
 struct aiMesh;
 
 namespace Assimp
@@ -105,11 +107,22 @@ protected:
     */
     void Execute( aiScene* pScene);
 
+    // -------------------------------------------------------------------
+    /** Mesh pass interface, see BaseProcess::SupportsMeshPass().
+    */
+    bool SupportsMeshPass() const;
+    void BeginMeshPass( aiScene* pScene);
+    void ExecuteMeshPass( aiScene* pScene, unsigned int meshIndex);
+    void EndMeshPass( aiScene* pScene);
+
 private:
 
     /** Configuration option: maximum smoothing angle, in radians*/
     float configMaxAngle;
     unsigned int configSourceUV;
+
+    //! Per mesh: whether tangents were calculated
+    std::vector<unsigned char> mProcessed;
 };
 
 } // end of namespace Assimp
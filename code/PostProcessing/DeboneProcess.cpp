@@ -163,8 +163,8 @@ void DeboneProcess::Execute( aiScene* pScene)
 
         // rebuild the scene's mesh array
         pScene->mNumMeshes = static_cast<unsigned int>(meshes.size());
-        delete [] pScene->mMeshes;
-        pScene->mMeshes = new aiMesh*[pScene->mNumMeshes];
+        FreeSceneArray(pScene->mMeshes);
+        pScene->mMeshes = AllocateSceneArray<aiMesh *>(pScene->mNumMeshes);
         std::copy( meshes.begin(), meshes.end(), pScene->mMeshes);
 
         // recurse through all nodes and translate the node's mesh indices to fit the new mesh array
@@ -414,14 +414,14 @@ void DeboneProcess::UpdateNode(aiNode* pNode) const
     }
 
     if( pNode->mNumMeshes > 0 ) {
-        delete[] pNode->mMeshes;
+        FreeSceneArray(pNode->mMeshes);
         pNode->mMeshes = nullptr;
     }
 
     pNode->mNumMeshes = static_cast<unsigned int>(newMeshList.size());
 
     if(pNode->mNumMeshes)   {
-        pNode->mMeshes = new unsigned int[pNode->mNumMeshes];
+        pNode->mMeshes = AllocateSceneArray<unsigned int>(pNode->mNumMeshes);
         std::copy( newMeshList.begin(), newMeshList.end(), pNode->mMeshes);
     }
 
@@ -126,7 +126,7 @@ bool EmbedTexturesProcess::addTexture(aiScene *pScene, const std::string &path)
     }
     imageSize = pFile->FileSize();
 
-    aiTexel* imageContent = new aiTexel[ 1ul + static_cast<unsigned long>( imageSize ) / sizeof(aiTexel)];
+    aiTexel* imageContent = AllocateSceneArray<aiTexel>(1ul + static_cast<unsigned long>( imageSize ) / sizeof(aiTexel));
     pFile->Seek(0, aiOrigin_SET);
     pFile->Read(reinterpret_cast<char*>(imageContent), imageSize, 1);
     mIOHandler->Close(pFile);
@@ -134,9 +134,9 @@ bool EmbedTexturesProcess::addTexture(aiScene *pScene, const std::string &path)
     // Enlarging the textures table
     unsigned int textureId = pScene->mNumTextures++;
     auto oldTextures = pScene->mTextures;
-    pScene->mTextures = new aiTexture*[pScene->mNumTextures];
+    pScene->mTextures = AllocateSceneArray<aiTexture *>(pScene->mNumTextures);
     ::memmove(pScene->mTextures, oldTextures, sizeof(aiTexture*) * (pScene->mNumTextures - 1u));
-    delete [] oldTextures;
+    FreeSceneArray(oldTextures);
     
     // Add the new texture
     auto pTexture = new aiTexture;
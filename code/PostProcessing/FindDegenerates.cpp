@@ -49,6 +49,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/Exceptional.h>
 
 #include <unordered_map>
+#include <vector>
 
 using namespace Assimp;
 
@@ -83,6 +84,30 @@ void FindDegeneratesProcess::SetupProperties(const Importer* pImp) {
     mConfigCheckAreaOfTriangle = ( 0 != pImp->GetPropertyInteger(AI_CONFIG_PP_FD_CHECKAREA) );
 }
 
+// ------------------------------------------------------------------------------------------------
+bool FindDegeneratesProcess::SupportsMeshPass() const {
+    return !mConfigRemoveDegenerates;
+}
+
+// ------------------------------------------------------------------------------------------------
+void FindDegeneratesProcess::BeginMeshPass( aiScene* /*pScene*/) {
+    ASSIMP_LOG_DEBUG("FindDegeneratesProcess begin");
+}
+
+// ------------------------------------------------------------------------------------------------
+void FindDegeneratesProcess::ExecuteMeshPass( aiScene* pScene, unsigned int meshIndex) {
+    // Do not process point cloud, ExecuteOnMesh works only with faces data
+    aiMesh* mesh = pScene->mMeshes[meshIndex];
+    if (mesh->mPrimitiveTypes != aiPrimitiveType::aiPrimitiveType_POINT) {
+        ExecuteOnMesh(mesh);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void FindDegeneratesProcess::EndMeshPass( aiScene* /*pScene*/) {
+    ASSIMP_LOG_DEBUG("FindDegeneratesProcess finished");
+}
+
 // ------------------------------------------------------------------------------------------------
 // Executes the post processing step on the given imported data.
 void FindDegeneratesProcess::Execute( aiScene* pScene) {
@@ -94,11 +119,18 @@ void FindDegeneratesProcess::Execute( aiScene* pScene) {
     std::unordered_map<unsigned int, unsigned int> meshMap;
     meshMap.reserve(pScene->mNumMeshes);
 
+    // Do not process point cloud, ExecuteOnMesh works only with faces data
+    std::vector<unsigned char> removeMesh(pScene->mNumMeshes, 0);
+    ParallelFor(pScene->mNumMeshes, [&](unsigned int i) {
+        if (pScene->mMeshes[i]->mPrimitiveTypes != aiPrimitiveType::aiPrimitiveType_POINT) {
+            removeMesh[i] = ExecuteOnMesh(pScene->mMeshes[i]);
+        }
+    });
+
     const unsigned int originalNumMeshes = pScene->mNumMeshes;
     unsigned int targetIndex = 0;
     for (unsigned int i = 0; i < pScene->mNumMeshes; ++i) {
-        // Do not process point cloud, ExecuteOnMesh works only with faces data
-        if ((pScene->mMeshes[i]->mPrimitiveTypes != aiPrimitiveType::aiPrimitiveType_POINT) && ExecuteOnMesh(pScene->mMeshes[i])) {
+        if (removeMesh[i]) {
             delete pScene->mMeshes[i];
             // Not strictly required, but clean:
             pScene->mMeshes[i] = nullptr;
@@ -275,9 +307,7 @@ evil_jump_outside:
             }
             else {
                 // Otherwise delete it if we don't need this face
-                delete[] face_src.mIndices;
-                face_src.mIndices = nullptr;
-                face_src.mNumIndices = 0;
+                mesh->FreeFaceIndices(face_src);
             }
         }
         // Just leave the rest of the array unreferenced, we don't care for now
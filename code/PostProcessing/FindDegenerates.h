@@ -73,6 +73,14 @@ public:
     // Setup import settings
     void SetupProperties(const Importer* pImp);
 
+    // -------------------------------------------------------------------
+    // Mesh pass interface, only supported if degenerates are not removed
+    // as whole meshes may vanish then.
+    bool SupportsMeshPass() const;
+    void BeginMeshPass( aiScene* pScene);
+    void ExecuteMeshPass( aiScene* pScene, unsigned int meshIndex);
+    void EndMeshPass( aiScene* pScene);
+
     // -------------------------------------------------------------------
     // Execute step on a given mesh
     ///@returns true if the current mesh should be deleted, false otherwise
@@ -96,7 +96,7 @@ void UpdateMeshReferences(aiNode *node, const std::vector<unsigned int> &meshMap
         // than a full array realloc'n'copy party ...
         node->mNumMeshes = out;
         if (0 == out) {
-            delete[] node->mMeshes;
+            FreeSceneArray(node->mMeshes);
             node->mMeshes = nullptr;
         }
     }
@@ -53,6 +53,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/scene.h>
 #include <stdio.h>
 
+#include <algorithm>
+#include <vector>
+
 
 using namespace Assimp;
 
@@ -81,15 +84,35 @@ bool FixInfacingNormalsProcess::IsActive( unsigned int pFlags) const
 // ------------------------------------------------------------------------------------------------
 // Executes the post processing step on the given imported data.
 void FixInfacingNormalsProcess::Execute( aiScene* pScene)
+{
+    ExecuteMeshPasses(pScene);
+}
+
+// ------------------------------------------------------------------------------------------------
+bool FixInfacingNormalsProcess::SupportsMeshPass() const
+{
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+void FixInfacingNormalsProcess::BeginMeshPass( aiScene* pScene)
 {
     ASSIMP_LOG_DEBUG("FixInfacingNormalsProcess begin");
 
-    bool bHas( false );
-    for (unsigned int a = 0; a < pScene->mNumMeshes; ++a) {
-        if (ProcessMesh(pScene->mMeshes[a], a)) {
-            bHas = true;
-        }
-    }
+    mFixed.assign(pScene->mNumMeshes, 0);
+}
+
+// ------------------------------------------------------------------------------------------------
+void FixInfacingNormalsProcess::ExecuteMeshPass( aiScene* pScene, unsigned int meshIndex)
+{
+    mFixed[meshIndex] = ProcessMesh(pScene->mMeshes[meshIndex], meshIndex);
+}
+
+// ------------------------------------------------------------------------------------------------
+void FixInfacingNormalsProcess::EndMeshPass( aiScene* /*pScene*/)
+{
+    const bool bHas = std::find(mFixed.begin(), mFixed.end(), 1) != mFixed.end();
+    mFixed.clear();
 
     if (bHas) {
         ASSIMP_LOG_DEBUG("FixInfacingNormalsProcess finished. Found issues.");
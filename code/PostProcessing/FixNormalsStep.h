@@ -47,6 +47,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "Common/BaseProcess.h"
 
+#include <vector>
+
 struct aiMesh;
 
 namespace Assimp
@@ -77,6 +79,14 @@ public:
     */
     void Execute( aiScene* pScene);
 
+    // -------------------------------------------------------------------
+    /** Mesh pass interface, see BaseProcess::SupportsMeshPass().
+    */
+    bool SupportsMeshPass() const;
+    void BeginMeshPass( aiScene* pScene);
+    void ExecuteMeshPass( aiScene* pScene, unsigned int meshIndex);
+    void EndMeshPass( aiScene* pScene);
+
 protected:
 
     // -------------------------------------------------------------------
@@ -84,6 +94,10 @@ protected:
      * @param pMesh The mesh to process.
      */
     bool ProcessMesh( aiMesh* pMesh, unsigned int index);
+
+private:
+    //! Per mesh: whether normals were flipped
+    std::vector<unsigned char> mFixed;
 };
 
 } // end of namespace Assimp
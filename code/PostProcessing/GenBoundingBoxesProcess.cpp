@@ -97,17 +97,23 @@ void GenBoundingBoxesProcess::Execute(aiScene* pScene) {
         return;
     }
 
-    for (unsigned int i = 0; i < pScene->mNumMeshes; ++i) {
-        aiMesh* mesh = pScene->mMeshes[i];
-        if (nullptr == mesh) {
-            continue;
-        }
+    ExecuteMeshPasses(pScene);
+}
+
+bool GenBoundingBoxesProcess::SupportsMeshPass() const {
+    return true;
+}
 
-        aiVector3D min(999999, 999999, 999999), max(-999999, -999999, -999999);
-        checkMesh(mesh, min, max);
-        mesh->mAABB.mMin = min;
-        mesh->mAABB.mMax = max;
+void GenBoundingBoxesProcess::ExecuteMeshPass(aiScene* pScene, unsigned int meshIndex) {
+    aiMesh* mesh = pScene->mMeshes[meshIndex];
+    if (nullptr == mesh) {
+        return;
     }
+
+    aiVector3D min(999999, 999999, 999999), max(-999999, -999999, -999999);
+    checkMesh(mesh, min, max);
+    mesh->mAABB.mMin = min;
+    mesh->mAABB.mMax = max;
 }
 
 } // Namespace Assimp
@@ -67,6 +67,10 @@ public:
     bool IsActive(unsigned int pFlags) const override;
     /// The execution callback.
     void Execute(aiScene* pScene) override;
+    /// Mesh pass interface, see BaseProcess::SupportsMeshPass().
+    bool SupportsMeshPass() const override;
+    /// Computes the bounding box of a single mesh.
+    void ExecuteMeshPass(aiScene* pScene, unsigned int meshIndex) override;
 };
 
 } // Namespace Assimp
@@ -51,6 +51,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/Exceptional.h>
 #include <assimp/qnan.h>
 
+#include <algorithm>
+#include <vector>
+
 using namespace Assimp;
 
 // ------------------------------------------------------------------------------------------------
@@ -85,17 +88,34 @@ void GenVertexNormalsProcess::SetupProperties(const Importer *pImp) {
 // ------------------------------------------------------------------------------------------------
 // Executes the post processing step on the given imported data.
 void GenVertexNormalsProcess::Execute(aiScene *pScene) {
+    ExecuteMeshPasses(pScene);
+}
+
+// ------------------------------------------------------------------------------------------------
+bool GenVertexNormalsProcess::SupportsMeshPass() const {
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+void GenVertexNormalsProcess::BeginMeshPass(aiScene *pScene) {
     ASSIMP_LOG_DEBUG("GenVertexNormalsProcess begin");
 
     if (pScene->mFlags & AI_SCENE_FLAGS_NON_VERBOSE_FORMAT) {
         throw DeadlyImportError("Post-processing order mismatch: expecting pseudo-indexed (\"verbose\") vertices here");
     }
 
-    bool bHas = false;
-    for (unsigned int a = 0; a < pScene->mNumMeshes; ++a) {
-        if (GenMeshVertexNormals(pScene->mMeshes[a], a))
-            bHas = true;
-    }
+    mGenerated.assign(pScene->mNumMeshes, 0);
+}
+
+// ------------------------------------------------------------------------------------------------
+void GenVertexNormalsProcess::ExecuteMeshPass(aiScene *pScene, unsigned int meshIndex) {
+    mGenerated[meshIndex] = GenMeshVertexNormals(pScene->mMeshes[meshIndex], meshIndex);
+}
+
+// ------------------------------------------------------------------------------------------------
+void GenVertexNormalsProcess::EndMeshPass(aiScene * /*pScene*/) {
+    const bool bHas = std::find(mGenerated.begin(), mGenerated.end(), 1) != mGenerated.end();
+    mGenerated.clear();
 
     if (bHas) {
         ASSIMP_LOG_INFO("GenVertexNormalsProcess finished. "
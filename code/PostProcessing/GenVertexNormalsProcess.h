@@ -50,6 +50,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <assimp/mesh.h>
 
+#include <vector>
+
 // Forward declarations
 class GenNormalsTest;
 
@@ -86,6 +88,14 @@ public:
     */
     void Execute( aiScene* pScene);
 
+    // -------------------------------------------------------------------
+    /** Mesh pass interface, see BaseProcess::SupportsMeshPass().
+    */
+    bool SupportsMeshPass() const;
+    void BeginMeshPass( aiScene* pScene);
+    void ExecuteMeshPass( aiScene* pScene, unsigned int meshIndex);
+    void EndMeshPass( aiScene* pScene);
+
 
     // setter for configMaxAngle
     inline void SetMaxSmoothAngle(ai_real f) {
@@ -105,6 +115,9 @@ private:
     ai_real configMaxAngle;
     mutable bool force_ = false;
     mutable bool flippedWindingOrder_ = false;
+
+    //! Per mesh: whether normals were generated
+    std::vector<unsigned char> mGenerated;
 };
 
 } // end of namespace Assimp
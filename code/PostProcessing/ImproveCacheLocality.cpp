@@ -90,17 +90,39 @@ void ImproveCacheLocalityProcess::SetupProperties(const Importer* pImp) {
 // ------------------------------------------------------------------------------------------------
 // Executes the post processing step on the given imported data.
 void ImproveCacheLocalityProcess::Execute( aiScene* pScene) {
+    ExecuteMeshPasses(pScene);
+}
+
+// ------------------------------------------------------------------------------------------------
+bool ImproveCacheLocalityProcess::SupportsMeshPass() const {
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+void ImproveCacheLocalityProcess::BeginMeshPass( aiScene* pScene) {
+    if (pScene->mNumMeshes) {
+        ASSIMP_LOG_DEBUG("ImproveCacheLocalityProcess begin");
+    }
+
+    mACMR.assign(pScene->mNumMeshes, static_cast<ai_real>(0.f));
+}
+
+// ------------------------------------------------------------------------------------------------
+void ImproveCacheLocalityProcess::ExecuteMeshPass( aiScene* pScene, unsigned int meshIndex) {
+    mACMR[meshIndex] = ProcessMesh( pScene->mMeshes[meshIndex],meshIndex);
+}
+
+// ------------------------------------------------------------------------------------------------
+void ImproveCacheLocalityProcess::EndMeshPass( aiScene* pScene) {
     if (!pScene->mNumMeshes) {
         ASSIMP_LOG_DEBUG("ImproveCacheLocalityProcess skipped; there are no meshes");
         return;
     }
 
-    ASSIMP_LOG_DEBUG("ImproveCacheLocalityProcess begin");
-
     float out = 0.f;
     unsigned int numf = 0, numm = 0;
     for( unsigned int a = 0; a < pScene->mNumMeshes; ++a ){
-        const float res = ProcessMesh( pScene->mMeshes[a],a);
+        const float res = mACMR[a];
         if (res) {
             numf += pScene->mMeshes[a]->mNumFaces;
             out  += res;
@@ -113,6 +135,7 @@ void ImproveCacheLocalityProcess::Execute( aiScene* pScene) {
         }
         ASSIMP_LOG_DEBUG("ImproveCacheLocalityProcess finished. ");
     }
+    mACMR.clear();
 }
 
 // ------------------------------------------------------------------------------------------------
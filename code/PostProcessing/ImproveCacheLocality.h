@@ -49,6 +49,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <assimp/types.h>
 
+#include <vector>
+
 struct aiMesh;
 
 namespace Assimp
@@ -78,6 +80,13 @@ public:
     // Executes the pp step on a given scene
     void Execute( aiScene* pScene);
 
+    // -------------------------------------------------------------------
+    // Mesh pass interface, see BaseProcess::SupportsMeshPass()
+    bool SupportsMeshPass() const;
+    void BeginMeshPass( aiScene* pScene);
+    void ExecuteMeshPass( aiScene* pScene, unsigned int meshIndex);
+    void EndMeshPass( aiScene* pScene);
+
     // -------------------------------------------------------------------
     // Configures the pp step
     void SetupProperties(const Importer* pImp);
@@ -94,6 +103,9 @@ private:
     //! Configuration parameter: specifies the size of the cache to
     //! optimize the vertex data for.
     unsigned int mConfigCacheDepth;
+
+    //! Per mesh: output ACMR, 0 if the mesh was not processed
+    std::vector<ai_real> mACMR;
 };
 
 } // end of namespace Assimp
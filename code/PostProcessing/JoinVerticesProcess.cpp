@@ -51,6 +51,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "JoinVerticesProcess.h"
 #include "ProcessHelper.h"
 #include <assimp/Vertex.h>
+#include <assimp/ImportLimits.h>
 #include <assimp/TinyFormatter.h>
 #include <stdio.h>
 #include <unordered_set>
@@ -79,21 +80,42 @@ bool JoinVerticesProcess::IsActive( unsigned int pFlags) const
 // ------------------------------------------------------------------------------------------------
 // Executes the post processing step on the given imported data.
 void JoinVerticesProcess::Execute( aiScene* pScene)
+{
+    ExecuteMeshPasses(pScene);
+}
+
+// ------------------------------------------------------------------------------------------------
+bool JoinVerticesProcess::SupportsMeshPass() const
+{
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+void JoinVerticesProcess::BeginMeshPass( aiScene* pScene)
 {
     ASSIMP_LOG_DEBUG("JoinVerticesProcess begin");
 
-    // get the total number of vertices BEFORE the step is executed
-    int iNumOldVertices = 0;
-    if (!DefaultLogger::isNullLogger()) {
-        for( unsigned int a = 0; a < pScene->mNumMeshes; a++)   {
-            iNumOldVertices +=  pScene->mMeshes[a]->mNumVertices;
-        }
-    }
+    mNumVertices.assign(pScene->mNumMeshes, std::make_pair(0, 0));
+}
+
+// ------------------------------------------------------------------------------------------------
+void JoinVerticesProcess::ExecuteMeshPass( aiScene* pScene, unsigned int meshIndex)
+{
+    // get the number of vertices BEFORE the step is executed
+    aiMesh* pMesh = pScene->mMeshes[meshIndex];
+    mNumVertices[meshIndex].first = pMesh->mNumVertices;
+    mNumVertices[meshIndex].second = ProcessMesh( pMesh, meshIndex);
+}
 
-    // execute the step
-    int iNumVertices = 0;
-    for( unsigned int a = 0; a < pScene->mNumMeshes; a++)
-        iNumVertices += ProcessMesh( pScene->mMeshes[a],a);
+// ------------------------------------------------------------------------------------------------
+void JoinVerticesProcess::EndMeshPass( aiScene* pScene)
+{
+    int iNumOldVertices = 0, iNumVertices = 0;
+    for (const std::pair<int, int>& numVertices : mNumVertices) {
+        iNumOldVertices += numVertices.first;
+        iNumVertices += numVertices.second;
+    }
+    mNumVertices.clear();
 
     // if logging is active, print detailed statistics
     if (!DefaultLogger::isNullLogger()) {
@@ -306,6 +328,7 @@ int JoinVerticesProcess::ProcessMesh( aiMesh* pMesh, unsigned int meshIndex)
 
     // Now check each vertex if it brings something new to the table
     for( unsigned int a = 0; a < pMesh->mNumVertices; a++)  {
+        ImportLimits::Poll();
         if (usedVertexIndices.find(a) == usedVertexIndices.end()) {
             continue;
         }
@@ -77,13 +77,31 @@ bool LimitBoneWeightsProcess::IsActive( unsigned int pFlags) const
 // ------------------------------------------------------------------------------------------------
 // Executes the post processing step on the given imported data.
 void LimitBoneWeightsProcess::Execute( aiScene* pScene)
+{
+    ExecuteMeshPasses(pScene);
+}
+
+// ------------------------------------------------------------------------------------------------
+bool LimitBoneWeightsProcess::SupportsMeshPass() const
+{
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+void LimitBoneWeightsProcess::BeginMeshPass( aiScene* /*pScene*/)
 {
     ASSIMP_LOG_DEBUG("LimitBoneWeightsProcess begin");
+}
 
-    for (unsigned int m = 0; m < pScene->mNumMeshes; ++m) {
-        ProcessMesh(pScene->mMeshes[m]);
-    }
+// ------------------------------------------------------------------------------------------------
+void LimitBoneWeightsProcess::ExecuteMeshPass( aiScene* pScene, unsigned int meshIndex)
+{
+    ProcessMesh(pScene->mMeshes[meshIndex]);
+}
 
+// ------------------------------------------------------------------------------------------------
+void LimitBoneWeightsProcess::EndMeshPass( aiScene* /*pScene*/)
+{
     ASSIMP_LOG_DEBUG("LimitBoneWeightsProcess end");
 }
 
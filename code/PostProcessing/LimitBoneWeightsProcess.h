@@ -106,6 +106,14 @@ public:
     */
     void Execute( aiScene* pScene);
 
+    // -------------------------------------------------------------------
+    /** Mesh pass interface, see BaseProcess::SupportsMeshPass().
+    */
+    bool SupportsMeshPass() const;
+    void BeginMeshPass( aiScene* pScene);
+    void ExecuteMeshPass( aiScene* pScene, unsigned int meshIndex);
+    void EndMeshPass( aiScene* pScene);
+
     // -------------------------------------------------------------------
     /** Describes a bone weight on a vertex */
     struct Weight {
@@ -179,7 +179,7 @@ void OptimizeGraphProcess::CollectNewChildren(aiNode *nd, std::list<aiNode *> &n
 
 			// copy all mesh references in one array
 			if (out_meshes) {
-				unsigned int *meshIdxs = new unsigned int[out_meshes + join_master->mNumMeshes], *tmp = meshIdxs;
+				unsigned int *meshIdxs = AllocateSceneArray<unsigned int>(out_meshes + join_master->mNumMeshes), *tmp = meshIdxs;
 				for (unsigned int n = 0; n < join_master->mNumMeshes; ++n) {
 					*tmp++ = join_master->mMeshes[n];
 				}
@@ -216,7 +216,7 @@ void OptimizeGraphProcess::CollectNewChildren(aiNode *nd, std::list<aiNode *> &n
 					}
 					delete join_node; // bye, node
 				}
-				delete[] join_master->mMeshes;
+				FreeSceneArray(join_master->mMeshes);
 				join_master->mMeshes = meshIdxs;
 				join_master->mNumMeshes += out_meshes;
 			}
@@ -225,10 +225,10 @@ void OptimizeGraphProcess::CollectNewChildren(aiNode *nd, std::list<aiNode *> &n
 	// reassign children if something changed
 	if (child_nodes.empty() || child_nodes.size() > nd->mNumChildren) {
 
-		delete[] nd->mChildren;
+		FreeSceneArray(nd->mChildren);
 
 		if (!child_nodes.empty()) {
-			nd->mChildren = new aiNode *[child_nodes.size()];
+			nd->mChildren = AllocateSceneArray<aiNode *>(child_nodes.size());
 		} else
 			nd->mChildren = nullptr;
 	}
@@ -302,7 +302,7 @@ void OptimizeGraphProcess::Execute(aiScene *pScene) {
 	const aiString prev = pScene->mRootNode->mName;
 	pScene->mRootNode->mParent = dummy_root;
 
-	dummy_root->mChildren = new aiNode *[dummy_root->mNumChildren = 1];
+	dummy_root->mChildren = AllocateSceneArray<aiNode *>(dummy_root->mNumChildren = 1);
 	dummy_root->mChildren[0] = pScene->mRootNode;
 
 	// Do our recursive processing of scenegraph nodes. For each node collect
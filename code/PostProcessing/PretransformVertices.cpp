@@ -56,6 +56,7 @@ using namespace Assimp;
 // some array offsets
 #define AI_PTVS_VERTEX 0x0
 #define AI_PTVS_FACE 0x1
+#define AI_PTVS_INDEX 0x2
 
 // ------------------------------------------------------------------------------------------------
 // Constructor to be privately used by Importer
@@ -125,17 +126,20 @@ unsigned int PretransformVertices::GetMeshVFormat(aiMesh *pcMesh) const {
 // Count the number of vertices in the whole scene and a given
 // material index
 void PretransformVertices::CountVerticesAndFaces(const aiScene *pcScene, const aiNode *pcNode, unsigned int iMat,
-		unsigned int iVFormat, unsigned int *piFaces, unsigned int *piVertices) const {
+		unsigned int iVFormat, unsigned int *piFaces, unsigned int *piVertices, unsigned int *piIndices) const {
 	for (unsigned int i = 0; i < pcNode->mNumMeshes; ++i) {
 		aiMesh *pcMesh = pcScene->mMeshes[pcNode->mMeshes[i]];
 		if (iMat == pcMesh->mMaterialIndex && iVFormat == GetMeshVFormat(pcMesh)) {
 			*piVertices += pcMesh->mNumVertices;
 			*piFaces += pcMesh->mNumFaces;
+			for (unsigned int a = 0; a < pcMesh->mNumFaces; ++a) {
+				*piIndices += pcMesh->mFaces[a].mNumIndices;
+			}
 		}
 	}
 	for (unsigned int i = 0; i < pcNode->mNumChildren; ++i) {
 		CountVerticesAndFaces(pcScene, pcNode->mChildren[i], iMat,
-				iVFormat, piFaces, piVertices);
+				iVFormat, piFaces, piVertices, piIndices);
 	}
 }
 
@@ -143,7 +147,7 @@ void PretransformVertices::CountVerticesAndFaces(const aiScene *pcScene, const a
 // Collect vertex/face data
 void PretransformVertices::CollectData(const aiScene *pcScene, const aiNode *pcNode, unsigned int iMat,
 		unsigned int iVFormat, aiMesh *pcMeshOut,
-		unsigned int aiCurrent[2], unsigned int *num_refs) const {
+		unsigned int aiCurrent[3], unsigned int *num_refs) const {
 	// No need to multiply if there's no transformation
 	const bool identity = pcNode->mTransformation.IsIdentity();
 	for (unsigned int i = 0; i < pcNode->mNumMeshes; ++i) {
@@ -222,9 +226,7 @@ void PretransformVertices::CollectData(const aiScene *pcScene, const aiNode *pcN
 						pcMesh->mNumVertices * sizeof(aiColor4D));
 				++p;
 			}
-			// now we need to copy all faces. since we will delete the source mesh afterwards,
-			// we don't need to reallocate the array of indices except if this mesh is
-			// referenced multiple times.
+			// now we need to copy all faces, the indices go to the index block of the output mesh
 			for (unsigned int planck = 0; planck < pcMesh->mNumFaces; ++planck) {
 				aiFace &f_src = pcMesh->mFaces[planck];
 				aiFace &f_dst = pcMeshOut->mFaces[aiCurrent[AI_PTVS_FACE] + planck];
@@ -232,22 +234,12 @@ void PretransformVertices::CollectData(const aiScene *pcScene, const aiNode *pcN
 				const unsigned int num_idx = f_src.mNumIndices;
 
 				f_dst.mNumIndices = num_idx;
+				unsigned int *pi = f_dst.mIndices = pcMeshOut->mFaceIndices + aiCurrent[AI_PTVS_INDEX];
+				aiCurrent[AI_PTVS_INDEX] += num_idx;
 
-				unsigned int *pi;
-				if (!num_ref) { /* if last time the mesh is referenced -> no reallocation */
-					pi = f_dst.mIndices = f_src.mIndices;
-
-					// offset all vertex indices
-					for (unsigned int hahn = 0; hahn < num_idx; ++hahn) {
-						pi[hahn] += aiCurrent[AI_PTVS_VERTEX];
-					}
-				} else {
-					pi = f_dst.mIndices = new unsigned int[num_idx];
-
-					// copy and offset all vertex indices
-					for (unsigned int hahn = 0; hahn < num_idx; ++hahn) {
-						pi[hahn] = f_src.mIndices[hahn] + aiCurrent[AI_PTVS_VERTEX];
-					}
+				// copy and offset all vertex indices
+				for (unsigned int hahn = 0; hahn < num_idx; ++hahn) {
+					pi[hahn] = f_src.mIndices[hahn] + aiCurrent[AI_PTVS_VERTEX];
 				}
 
 				// Update the mPrimitiveTypes member of the mesh
@@ -444,7 +436,7 @@ void PretransformVertices::Execute(aiScene *pScene) {
 		for (unsigned int a = 0; a < mesh->mNumBones; ++a)
 			delete mesh->mBones[a];
 
-		delete[] mesh->mBones;
+		FreeSceneArray(mesh->mBones);
         mesh->mBones = nullptr;
 	}
 
@@ -462,13 +454,13 @@ void PretransformVertices::Execute(aiScene *pScene) {
 
 		// ... if new meshes have been generated, append them to the end of the scene
 		if (apcOutMeshes.size() > 0) {
-			aiMesh **npp = new aiMesh *[pScene->mNumMeshes + apcOutMeshes.size()];
+			aiMesh **npp = AllocateSceneArray<aiMesh *>(pScene->mNumMeshes + apcOutMeshes.size());
 
 			memcpy(npp, pScene->mMeshes, sizeof(aiMesh *) * pScene->mNumMeshes);
 			memcpy(npp + pScene->mNumMeshes, &apcOutMeshes[0], sizeof(aiMesh *) * apcOutMeshes.size());
 
 			pScene->mNumMeshes += static_cast<unsigned int>(apcOutMeshes.size());
-			delete[] pScene->mMeshes;
+			FreeSceneArray(pScene->mMeshes);
 			pScene->mMeshes = npp;
 		}
 
@@ -496,13 +488,13 @@ void PretransformVertices::Execute(aiScene *pScene) {
 			for (std::list<unsigned int>::const_iterator j = aiVFormats.begin(); j != aiVFormats.end(); ++j) {
 				unsigned int iVertices = 0;
 				unsigned int iFaces = 0;
-				CountVerticesAndFaces(pScene, pScene->mRootNode, i, *j, &iFaces, &iVertices);
+				unsigned int iIndices = 0;
+				CountVerticesAndFaces(pScene, pScene->mRootNode, i, *j, &iFaces, &iVertices, &iIndices);
 				if (0 != iFaces && 0 != iVertices) {
 					apcOutMeshes.push_back(new aiMesh());
 					aiMesh *pcMesh = apcOutMeshes.back();
-					pcMesh->mNumFaces = iFaces;
+					pcMesh->AllocateFaces(iFaces, iIndices);
 					pcMesh->mNumVertices = iVertices;
-					pcMesh->mFaces = new aiFace[iFaces];
 					pcMesh->mVertices = new aiVector3D[iVertices];
 					pcMesh->mMaterialIndex = i;
 					if ((*j) & 0x2) pcMesh->mNormals = new aiVector3D[iVertices];
@@ -524,7 +516,7 @@ void PretransformVertices::Execute(aiScene *pScene) {
 						pcMesh->mColors[iFaces++] = new aiColor4D[iVertices];
 
 					// fill the mesh ...
-					unsigned int aiTemp[2] = { 0, 0 };
+					unsigned int aiTemp[3] = { 0, 0, 0 };
 					CollectData(pScene, pScene->mRootNode, i, *j, pcMesh, aiTemp, &s[0]);
 				}
 			}
@@ -541,12 +533,6 @@ void PretransformVertices::Execute(aiScene *pScene) {
 				mesh->mNumBones = 0;
                 mesh->mBones = nullptr;
 
-				// we're reusing the face index arrays. avoid destruction
-				for (unsigned int a = 0; a < mesh->mNumFaces; ++a) {
-					mesh->mFaces[a].mNumIndices = 0;
-                    mesh->mFaces[a].mIndices = nullptr;
-				}
-
 				delete mesh;
 
 				// Invalidate the contents of the old mesh array. We will most
@@ -569,7 +555,7 @@ void PretransformVertices::Execute(aiScene *pScene) {
 	// remove all animations from the scene
 	for (unsigned int i = 0; i < pScene->mNumAnimations; ++i)
 		delete pScene->mAnimations[i];
-	delete[] pScene->mAnimations;
+	FreeSceneArray(pScene->mAnimations);
 
 	pScene->mAnimations = nullptr;
 	pScene->mNumAnimations = 0;
@@ -610,11 +596,11 @@ void PretransformVertices::Execute(aiScene *pScene) {
 
 		if (1 == pScene->mNumMeshes && !pScene->mNumLights && !pScene->mNumCameras) {
 			pScene->mRootNode->mNumMeshes = 1;
-			pScene->mRootNode->mMeshes = new unsigned int[1];
+			pScene->mRootNode->mMeshes = AllocateSceneArray<unsigned int>(1);
 			pScene->mRootNode->mMeshes[0] = 0;
 		} else {
 			pScene->mRootNode->mNumChildren = pScene->mNumMeshes + pScene->mNumLights + pScene->mNumCameras;
-			aiNode **nodes = pScene->mRootNode->mChildren = new aiNode *[pScene->mRootNode->mNumChildren];
+			aiNode **nodes = pScene->mRootNode->mChildren = AllocateSceneArray<aiNode *>(pScene->mRootNode->mNumChildren);
 
 			// generate mesh nodes
 			for (unsigned int i = 0; i < pScene->mNumMeshes; ++i, ++nodes) {
@@ -625,7 +611,7 @@ void PretransformVertices::Execute(aiScene *pScene) {
 
 				// setup mesh indices
 				pcNode->mNumMeshes = 1;
-				pcNode->mMeshes = new unsigned int[1];
+				pcNode->mMeshes = AllocateSceneArray<unsigned int>(1);
 				pcNode->mMeshes[0] = i;
 			}
 			// generate light nodes
@@ -109,13 +109,14 @@ private:
 	unsigned int GetMeshVFormat(aiMesh *pcMesh) const;
 
 	// -------------------------------------------------------------------
-	// Count the number of vertices in the whole scene and a given
-	// material index
+	// Count the number of vertices, faces and face indices in the whole
+	// scene and a given material index
 	void CountVerticesAndFaces(const aiScene *pcScene, const aiNode *pcNode,
 			unsigned int iMat,
 			unsigned int iVFormat,
 			unsigned int *piFaces,
-			unsigned int *piVertices) const;
+			unsigned int *piVertices,
+			unsigned int *piIndices) const;
 
 	// -------------------------------------------------------------------
 	// Collect vertex/face data
@@ -123,7 +124,7 @@ private:
 			unsigned int iMat,
 			unsigned int iVFormat,
 			aiMesh *pcMeshOut,
-			unsigned int aiCurrent[2],
+			unsigned int aiCurrent[3],
 			unsigned int *num_refs) const;
 
 	// -------------------------------------------------------------------
@@ -291,7 +291,7 @@ aiMesh *MakeSubmesh(const aiMesh *pMesh, const std::vector<unsigned int> &subMes
         const aiFace &srcFace = pMesh->mFaces[subMeshFaces[a]];
         aiFace &dstFace = oMesh->mFaces[a];
         dstFace.mNumIndices = srcFace.mNumIndices;
-        dstFace.mIndices = new unsigned int[dstFace.mNumIndices];
+        dstFace.mIndices = AllocateSceneArray<unsigned int>(dstFace.mNumIndices);
 
         // accumulate linearly all the vertices of the source face
         for (size_t b = 0; b < dstFace.mNumIndices; ++b) {
@@ -344,7 +344,7 @@ aiMesh *MakeSubmesh(const aiMesh *pMesh, const std::vector<unsigned int> &subMes
         }
 
         if (oMesh->mNumBones) {
-            oMesh->mBones = new aiBone *[oMesh->mNumBones]();
+            oMesh->mBones = AllocateSceneArray<aiBone *>(oMesh->mNumBones, nullptr);
             unsigned int nbParanoia = oMesh->mNumBones;
 
             oMesh->mNumBones = 0; //rewind
@@ -340,22 +340,39 @@ class ComputeSpatialSortProcess : public BaseProcess {
                                                            aiProcess_GenNormals | aiProcess_JoinIdenticalVertices));
     }
 
+    typedef std::pair<SpatialSort, ai_real> _Type;
+
     void Execute(aiScene *pScene) {
-        typedef std::pair<SpatialSort, ai_real> _Type;
+        ExecuteMeshPasses(pScene);
+    }
+
+    bool SupportsMeshPass() const {
+        return true;
+    }
+
+    void BeginMeshPass(aiScene *pScene) {
         ASSIMP_LOG_DEBUG("Generate spatially-sorted vertex cache");
 
-        std::vector<_Type> *p = new std::vector<_Type>(pScene->mNumMeshes);
-        std::vector<_Type>::iterator it = p->begin();
+        // the vector is filled mesh by mesh, the steps fused with this one
+        // only access their own mesh's entry
+        mSorts = new std::vector<_Type>(pScene->mNumMeshes);
+        shared->AddProperty(AI_SPP_SPATIAL_SORT, mSorts);
+    }
 
-        for (unsigned int i = 0; i < pScene->mNumMeshes; ++i, ++it) {
-            aiMesh *mesh = pScene->mMeshes[i];
-            _Type &blubb = *it;
-            blubb.first.Fill(mesh->mVertices, mesh->mNumVertices, sizeof(aiVector3D));
-            blubb.second = ComputePositionEpsilon(mesh);
-        }
+    void ExecuteMeshPass(aiScene *pScene, unsigned int meshIndex) {
+        aiMesh *mesh = pScene->mMeshes[meshIndex];
+        _Type &blubb = (*mSorts)[meshIndex];
+        blubb.first.Fill(mesh->mVertices, mesh->mNumVertices, sizeof(aiVector3D));
+        blubb.second = ComputePositionEpsilon(mesh);
+    }
 
-        shared->AddProperty(AI_SPP_SPATIAL_SORT, p);
+    void EndMeshPass(aiScene * /*pScene*/) {
+        mSorts = nullptr;
     }
+
+private:
+    //! Owned by the shared data
+    std::vector<_Type> *mSorts = nullptr;
 };
 
 // -------------------------------------------------------------------------------
@@ -369,6 +386,14 @@ class DestroySpatialSortProcess : public BaseProcess {
     void Execute(aiScene * /*pScene*/) {
         shared->RemoveProperty(AI_SPP_SPATIAL_SORT);
     }
+
+    bool SupportsMeshPass() const {
+        return true;
+    }
+
+    void EndMeshPass(aiScene *pScene) {
+        Execute(pScene);
+    }
 };
 
 } // namespace Assimp
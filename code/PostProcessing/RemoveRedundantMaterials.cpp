@@ -173,7 +173,7 @@ void RemoveRedundantMatsProcess::Execute( aiScene* pScene)
         // we need to rebuild the material list and remap mesh material indexes.
         if (iNewNum != pScene->mNumMaterials) {
             ai_assert(iNewNum > 0);
-            aiMaterial** ppcMaterials = new aiMaterial*[iNewNum];
+            aiMaterial** ppcMaterials = AllocateSceneArray<aiMaterial *>(iNewNum);
             ::memset(ppcMaterials,0,sizeof(void*)*iNewNum);
             for (unsigned int p = 0; p < pScene->mNumMaterials;++p)
             {
@@ -201,7 +201,7 @@ void RemoveRedundantMatsProcess::Execute( aiScene* pScene)
                 mesh->mMaterialIndex = aiMappingTable[mesh->mMaterialIndex];
             }
             // delete the old material list
-            delete[] pScene->mMaterials;
+            FreeSceneArray(pScene->mMaterials);
             pScene->mMaterials = ppcMaterials;
             pScene->mNumMaterials = iNewNum;
         }
@@ -118,7 +118,7 @@ bool UpdateNodeGraph(aiNode* node,std::list<aiNode*>& childsOfParent,bool root)
         {
             // reallocate the array of our children here
             node->mNumChildren = (unsigned int)mine.size();
-            aiNode** const children = new aiNode*[mine.size()];
+            aiNode** const children = AllocateSceneArray<aiNode *>(mine.size());
             aiNode** ptr = children;
 
             for (std::list<aiNode*>::iterator it = mine.begin(), end = mine.end();
@@ -126,7 +126,7 @@ bool UpdateNodeGraph(aiNode* node,std::list<aiNode*>& childsOfParent,bool root)
             {
                 *ptr++ = *it;
             }
-            delete[] node->mChildren;
+            FreeSceneArray(node->mChildren);
             node->mChildren = children;
             return false;
         }
@@ -88,12 +88,12 @@ void UpdateNodes(const std::vector<unsigned int> &replaceMeshIndex, aiNode *node
             }
         }
         if (!newSize) {
-            delete[] node->mMeshes;
+            FreeSceneArray(node->mMeshes);
             node->mNumMeshes = 0;
             node->mMeshes = nullptr;
         } else {
             // Try to reuse the old array if possible
-            unsigned int *newMeshes = (newSize > node->mNumMeshes ? new unsigned int[newSize] : node->mMeshes);
+            unsigned int *newMeshes = (newSize > node->mNumMeshes ? AllocateSceneArray<unsigned int>(newSize) : node->mMeshes);
 
             for (unsigned int m = 0; m < node->mNumMeshes; ++m) {
                 unsigned int add = node->mMeshes[m] << 2;
@@ -103,7 +103,7 @@ void UpdateNodes(const std::vector<unsigned int> &replaceMeshIndex, aiNode *node
                 }
             }
             if (newSize > node->mNumMeshes)
-                delete[] node->mMeshes;
+                FreeSceneArray(node->mMeshes);
 
             node->mMeshes = newMeshes - (node->mNumMeshes = newSize);
         }
@@ -206,11 +206,10 @@ void SortByPTypeProcess::Execute(aiScene *pScene) {
             out->mPrimitiveTypes = 1u << real;
             out->mMaterialIndex = mesh->mMaterialIndex;
 
-            // allocate output storage
-            out->mNumFaces = aiNumPerPType[real];
-            aiFace *outFaces = out->mFaces = new aiFace[out->mNumFaces];
-
-            out->mNumVertices = (3 == real ? numPolyVerts : out->mNumFaces * (real + 1));
+            // allocate output storage, the output faces are unindexed
+            out->mNumVertices = (3 == real ? numPolyVerts : aiNumPerPType[real] * (real + 1));
+            unsigned int *outIndices = out->AllocateFaces(aiNumPerPType[real], out->mNumVertices);
+            aiFace *outFaces = out->mFaces;
 
             aiVector3D *vert(nullptr), *nor(nullptr), *tan(nullptr), *bit(nullptr);
             aiVector3D *uv[AI_MAX_NUMBER_OF_TEXTURECOORDS];
@@ -247,7 +246,7 @@ void SortByPTypeProcess::Execute(aiScene *pScene) {
 
             if (mesh->mNumAnimMeshes > 0 && mesh->mAnimMeshes) {
                 out->mNumAnimMeshes = mesh->mNumAnimMeshes;
-                out->mAnimMeshes = new aiAnimMesh *[out->mNumAnimMeshes];
+                out->mAnimMeshes = AllocateSceneArray<aiAnimMesh *>(out->mNumAnimMeshes);
             }
 
             for (unsigned int j = 0; j < mesh->mNumAnimMeshes; ++j) {
@@ -301,7 +300,8 @@ void SortByPTypeProcess::Execute(aiScene *pScene) {
                 }
 
                 outFaces->mNumIndices = in.mNumIndices;
-                outFaces->mIndices = in.mIndices;
+                outFaces->mIndices = outIndices;
+                outIndices += in.mNumIndices;
 
                 for (unsigned int q = 0; q < in.mNumIndices; ++q) {
                     unsigned int idx = in.mIndices[q];
@@ -359,10 +359,9 @@ void SortByPTypeProcess::Execute(aiScene *pScene) {
                     if (pp == mesh->mNumAnimMeshes)
                         amIdx++;
 
-                    in.mIndices[q] = outIdx++;
+                    outFaces->mIndices[q] = outIdx++;
                 }
 
-                in.mIndices = nullptr;
                 ++outFaces;
             }
             ai_assert(outFaces == out->mFaces + out->mNumFaces);
@@ -375,7 +374,7 @@ void SortByPTypeProcess::Execute(aiScene *pScene) {
             }
 
             if (out->mNumBones) {
-                out->mBones = new aiBone *[out->mNumBones];
+                out->mBones = AllocateSceneArray<aiBone *>(out->mNumBones);
                 for (unsigned int q = 0, boneIdx = 0; q < mesh->mNumBones; ++q) {
                     TempBoneInfo &in = tempBones[q];
                     if (in.empty()) {
@@ -420,9 +419,9 @@ void SortByPTypeProcess::Execute(aiScene *pScene) {
     }
 
     if (outMeshes.size() != pScene->mNumMeshes) {
-        delete[] pScene->mMeshes;
+        FreeSceneArray(pScene->mMeshes);
         pScene->mNumMeshes = (unsigned int)outMeshes.size();
-        pScene->mMeshes = new aiMesh *[pScene->mNumMeshes];
+        pScene->mMeshes = AllocateSceneArray<aiMesh *>(pScene->mNumMeshes);
     }
     ::memcpy(pScene->mMeshes, &outMeshes[0], pScene->mNumMeshes * sizeof(void *));
 
@@ -144,8 +144,8 @@ void SplitByBoneCountProcess::Execute( aiScene* pScene)
 
     // rebuild the scene's mesh array
     pScene->mNumMeshes = static_cast<unsigned int>(meshes.size());
-    delete [] pScene->mMeshes;
-    pScene->mMeshes = new aiMesh*[pScene->mNumMeshes];
+    FreeSceneArray(pScene->mMeshes);
+    pScene->mMeshes = AllocateSceneArray<aiMesh *>(pScene->mNumMeshes);
     std::copy( meshes.begin(), meshes.end(), pScene->mMeshes);
 
     // recurse through all nodes and translate the node's mesh indices to fit the new mesh array
@@ -298,7 +298,7 @@ void SplitByBoneCountProcess::SplitMesh( const aiMesh* pMesh, std::vector<aiMesh
             const aiFace& srcFace = pMesh->mFaces[subMeshFaces[a]];
             aiFace& dstFace = newMesh->mFaces[a];
             dstFace.mNumIndices = srcFace.mNumIndices;
-            dstFace.mIndices = new unsigned int[dstFace.mNumIndices];
+            dstFace.mIndices = AllocateSceneArray<unsigned int>(dstFace.mNumIndices);
 
             // accumulate linearly all the vertices of the source face
             for( unsigned int b = 0; b < dstFace.mNumIndices; ++b )
@@ -340,7 +340,7 @@ void SplitByBoneCountProcess::SplitMesh( const aiMesh* pMesh, std::vector<aiMesh
 
         // Create the bones for the new submesh: first create the bone array
         newMesh->mNumBones = 0;
-        newMesh->mBones = new aiBone*[numBones];
+        newMesh->mBones = AllocateSceneArray<aiBone *>(numBones);
 
         std::vector<unsigned int> mappedBoneIndex( pMesh->mNumBones, std::numeric_limits<unsigned int>::max());
         for( unsigned int a = 0; a < pMesh->mNumBones; ++a )
@@ -411,7 +411,7 @@ void SplitByBoneCountProcess::SplitMesh( const aiMesh* pMesh, std::vector<aiMesh
         // ... and copy all the morph targets for all the vertices which made it into the new submesh
         if (pMesh->mNumAnimMeshes > 0) {
             newMesh->mNumAnimMeshes = pMesh->mNumAnimMeshes;
-            newMesh->mAnimMeshes = new aiAnimMesh*[newMesh->mNumAnimMeshes];
+            newMesh->mAnimMeshes = AllocateSceneArray<aiAnimMesh *>(newMesh->mNumAnimMeshes);
             
             for (unsigned int morphIdx = 0; morphIdx < newMesh->mNumAnimMeshes; ++morphIdx) {
                 aiAnimMesh* origTarget = pMesh->mAnimMeshes[morphIdx];
@@ -466,9 +466,9 @@ void SplitByBoneCountProcess::UpdateNode( aiNode* pNode) const
             newMeshList.insert( newMeshList.end(), replaceMeshes.begin(), replaceMeshes.end());
         }
 
-        delete [] pNode->mMeshes;
+        FreeSceneArray(pNode->mMeshes);
         pNode->mNumMeshes = static_cast<unsigned int>(newMeshList.size());
-        pNode->mMeshes = new unsigned int[pNode->mNumMeshes];
+        pNode->mMeshes = AllocateSceneArray<unsigned int>(pNode->mNumMeshes);
         std::copy( newMeshList.begin(), newMeshList.end(), pNode->mMeshes);
     }
 
@@ -82,9 +82,9 @@ void SplitLargeMeshesProcess_Triangle::Execute( aiScene* pScene) {
 
     if (avList.size() != pScene->mNumMeshes) {
         // it seems something has been split. rebuild the mesh list
-        delete[] pScene->mMeshes;
+        FreeSceneArray(pScene->mMeshes);
         pScene->mNumMeshes = (unsigned int)avList.size();
-        pScene->mMeshes = new aiMesh*[avList.size()];
+        pScene->mMeshes = AllocateSceneArray<aiMesh *>(avList.size());
 
         for (unsigned int i = 0; i < avList.size();++i) {
             pScene->mMeshes[i] = avList[i].first;
@@ -121,9 +121,9 @@ void SplitLargeMeshesProcess_Triangle::UpdateNode(aiNode* pcNode,
     }
 
     // now build the new list
-    delete[] pcNode->mMeshes;
+    FreeSceneArray(pcNode->mMeshes);
     pcNode->mNumMeshes = (unsigned int)aiEntries.size();
-    pcNode->mMeshes = new unsigned int[pcNode->mNumMeshes];
+    pcNode->mMeshes = AllocateSceneArray<unsigned int>(pcNode->mNumMeshes);
 
     for (unsigned int b = 0; b < pcNode->mNumMeshes;++b) {
         pcNode->mMeshes[b] = aiEntries[b];
@@ -207,7 +207,7 @@ void SplitLargeMeshesProcess_Triangle::SplitMesh(
 
             if (pMesh->HasBones()) {
                 // assume the number of bones won't change in most cases
-                pcMesh->mBones = new aiBone*[pMesh->mNumBones];
+                pcMesh->mBones = AllocateSceneArray<aiBone *>(pMesh->mNumBones);
 
                 // iterate through all bones of the mesh and find those which
                 // need to be copied to the split mesh
@@ -261,7 +261,7 @@ void SplitLargeMeshesProcess_Triangle::SplitMesh(
                 // setup face type and number of indices
                 pcMesh->mFaces[p].mNumIndices = iNumIndices;
                 unsigned int* pi = pMesh->mFaces[iTemp].mIndices;
-                unsigned int* piOut = pcMesh->mFaces[p].mIndices = new unsigned int[iNumIndices];
+                unsigned int* piOut = pcMesh->mFaces[p].mIndices = AllocateSceneArray<unsigned int>(iNumIndices);
 
                 // need to update the output primitive types
                 switch (iNumIndices) {
@@ -367,9 +367,9 @@ void SplitLargeMeshesProcess_Vertex::Execute( aiScene* pScene) {
 
     if (avList.size() != pScene->mNumMeshes) {
         // it seems something has been split. rebuild the mesh list
-        delete[] pScene->mMeshes;
+        FreeSceneArray(pScene->mMeshes);
         pScene->mNumMeshes = (unsigned int)avList.size();
-        pScene->mMeshes = new aiMesh*[avList.size()];
+        pScene->mMeshes = AllocateSceneArray<aiMesh *>(avList.size());
 
         for (unsigned int i = 0; i < avList.size();++i) {
             pScene->mMeshes[i] = avList[i].first;
@@ -429,7 +429,7 @@ void SplitLargeMeshesProcess_Vertex::SplitMesh(
 
             typedef std::vector<aiVertexWeight> BoneWeightList;
             if (pMesh->HasBones()) {
-                pcMesh->mBones = new aiBone*[pMesh->mNumBones];
+                pcMesh->mBones = AllocateSceneArray<aiBone *>(pMesh->mNumBones);
                 ::memset(pcMesh->mBones,0,sizeof(void*)*pMesh->mNumBones);
             }
 
@@ -489,7 +489,7 @@ void SplitLargeMeshesProcess_Vertex::SplitMesh(
 
                 // setup face type and number of indices
                 rFace.mNumIndices = iNumIndices;
-                rFace.mIndices = new unsigned int[iNumIndices];
+                rFace.mIndices = AllocateSceneArray<unsigned int>(iNumIndices);
 
                 // need to update the output primitive types
                 switch (rFace.mNumIndices) {
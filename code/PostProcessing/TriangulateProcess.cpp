@@ -65,6 +65,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <memory>
 #include <cstdint>
+#include <algorithm>
+#include <vector>
 
 //#define AI_BUILD_TRIANGULATE_COLOR_FACE_WINDING
 //#define AI_BUILD_TRIANGULATE_DEBUG_POLYS
@@ -181,18 +183,37 @@ bool TriangulateProcess::IsActive( unsigned int pFlags) const
 // ------------------------------------------------------------------------------------------------
 // Executes the post processing step on the given imported data.
 void TriangulateProcess::Execute( aiScene* pScene)
+{
+    ExecuteMeshPasses(pScene);
+}
+
+// ------------------------------------------------------------------------------------------------
+bool TriangulateProcess::SupportsMeshPass() const
+{
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+void TriangulateProcess::BeginMeshPass( aiScene* pScene)
 {
     ASSIMP_LOG_DEBUG("TriangulateProcess begin");
 
-    bool bHas = false;
-    for( unsigned int a = 0; a < pScene->mNumMeshes; a++)
-    {
-        if (pScene->mMeshes[ a ]) {
-            if ( TriangulateMesh( pScene->mMeshes[ a ] ) ) {
-                bHas = true;
-            }
-        }
+    mTriangulated.assign(pScene->mNumMeshes, 0);
+}
+
+// ------------------------------------------------------------------------------------------------
+void TriangulateProcess::ExecuteMeshPass( aiScene* pScene, unsigned int meshIndex)
+{
+    if (pScene->mMeshes[ meshIndex ]) {
+        mTriangulated[meshIndex] = TriangulateMesh( pScene->mMeshes[ meshIndex ] );
     }
+}
+
+// ------------------------------------------------------------------------------------------------
+void TriangulateProcess::EndMeshPass( aiScene* /*pScene*/)
+{
+    const bool bHas = std::find(mTriangulated.begin(), mTriangulated.end(), 1) != mTriangulated.end();
+    mTriangulated.clear();
     if ( bHas ) {
         ASSIMP_LOG_INFO( "TriangulateProcess finished. All polygons have been triangulated." );
     } else {
@@ -222,8 +243,8 @@ bool TriangulateProcess::TriangulateMesh( aiMesh* pMesh)
         return false;
     }
 
-    // Find out how many output faces we'll get
-    uint32_t numOut = 0, max_out = 0;
+    // Find out how many output faces and indices we'll get
+    uint32_t numOut = 0, numOutIndices = 0, max_out = 0;
     bool get_normals = true;
     for( unsigned int a = 0; a < pMesh->mNumFaces; a++) {
         aiFace& face = pMesh->mFaces[a];
@@ -232,10 +253,11 @@ bool TriangulateProcess::TriangulateMesh( aiMesh* pMesh)
         }
         if( face.mNumIndices <= 3) {
             numOut++;
-
+            numOutIndices += face.mNumIndices;
         }
         else {
             numOut += face.mNumIndices-2;
+            numOutIndices += (face.mNumIndices-2) * 3;
             max_out = std::max(max_out,face.mNumIndices);
         }
     }
@@ -259,7 +281,9 @@ bool TriangulateProcess::TriangulateMesh( aiMesh* pMesh)
     // The mesh becomes NGON encoded now, during the triangulation process.
     pMesh->mPrimitiveTypes |= aiPrimitiveType_NGONEncodingFlag;
 
+    // all output faces point into one index block
     aiFace* out = new aiFace[numOut](), *curOut = out;
+    unsigned int* outIndices = AllocateSceneArray<unsigned int>(numOutIndices), *curIndex = outIndices;
     std::vector<aiVector3D> temp_verts3d(max_out+2); /* temporary storage for vertices */
     std::vector<aiVector2D> temp_verts(max_out+2);
 
@@ -305,8 +329,9 @@ bool TriangulateProcess::TriangulateMesh( aiMesh* pMesh)
         {
             aiFace& nface = *curOut++;
             nface.mNumIndices = face.mNumIndices;
-            nface.mIndices    = face.mIndices;
-            face.mIndices = nullptr;
+            nface.mIndices    = curIndex;
+            ::memcpy(curIndex, face.mIndices, face.mNumIndices * sizeof(unsigned int));
+            curIndex += face.mNumIndices;
 
             // points and lines don't require ngon encoding (and are not supported either!)
             if (nface.mNumIndices == 3) ngonEncoder.ngonEncodeTriangle(&nface);
@@ -347,7 +372,8 @@ bool TriangulateProcess::TriangulateMesh( aiMesh* pMesh)
 
             aiFace& nface = *curOut++;
             nface.mNumIndices = 3;
-            nface.mIndices = face.mIndices;
+            nface.mIndices = curIndex;
+            curIndex += 3;
 
             nface.mIndices[0] = temp[start_vertex];
             nface.mIndices[1] = temp[(start_vertex + 1) % 4];
@@ -355,15 +381,13 @@ bool TriangulateProcess::TriangulateMesh( aiMesh* pMesh)
 
             aiFace& sface = *curOut++;
             sface.mNumIndices = 3;
-            sface.mIndices = new unsigned int[3];
+            sface.mIndices = curIndex;
+            curIndex += 3;
 
             sface.mIndices[0] = temp[start_vertex];
             sface.mIndices[1] = temp[(start_vertex + 2) % 4];
             sface.mIndices[2] = temp[(start_vertex + 3) % 4];
 
-            // prevent double deletion of the indices field
-            face.mIndices = nullptr;
-
             ngonEncoder.ngonEncodeQuad(&nface, &sface);
 
             continue;
@@ -518,7 +542,7 @@ bool TriangulateProcess::TriangulateMesh( aiMesh* pMesh)
 
                         nface.mNumIndices = 3;
                         if (!nface.mIndices)
-                            nface.mIndices = new unsigned int[3];
+                            nface.mIndices = AllocateSceneArray<unsigned int>(3);
 
                         nface.mIndices[0] = 0;
                         nface.mIndices[1] = tmp+1;
@@ -531,10 +555,8 @@ bool TriangulateProcess::TriangulateMesh( aiMesh* pMesh)
 
                 aiFace& nface = *curOut++;
                 nface.mNumIndices = 3;
-
-                if (!nface.mIndices) {
-                    nface.mIndices = new unsigned int[3];
-                }
+                nface.mIndices = curIndex;
+                curIndex += 3;
 
                 // setup indices for the new triangle ...
                 nface.mIndices[0] = prev;
@@ -549,9 +571,8 @@ bool TriangulateProcess::TriangulateMesh( aiMesh* pMesh)
                 // We have three indices forming the last 'ear' remaining. Collect them.
                 aiFace& nface = *curOut++;
                 nface.mNumIndices = 3;
-                if (!nface.mIndices) {
-                    nface.mIndices = new unsigned int[3];
-                }
+                nface.mIndices = curIndex;
+                curIndex += 3;
 
                 for (tmp = 0; done[tmp]; ++tmp);
                 nface.mIndices[0] = tmp;
@@ -586,7 +607,7 @@ bool TriangulateProcess::TriangulateMesh( aiMesh* pMesh)
             //    ASSIMP_LOG_VERBOSE_DEBUG("Dropping triangle with area 0");
             //    --curOut;
 
-            //    delete[] f->mIndices;
+            //    FreeSceneArray(f->mIndices);
             //    f->mIndices = nullptr;
 
             //    for(aiFace* ff = f; ff != curOut; ++ff) {
@@ -607,9 +628,6 @@ bool TriangulateProcess::TriangulateMesh( aiMesh* pMesh)
             ngonEncoder.ngonEncodeTriangle(f);
             ++f;
         }
-
-        delete[] face.mIndices;
-        face.mIndices = nullptr;
     }
 
 #ifdef AI_BUILD_TRIANGULATE_DEBUG_POLYS
@@ -617,11 +635,13 @@ bool TriangulateProcess::TriangulateMesh( aiMesh* pMesh)
 #endif
 
     // kill the old faces
-    delete [] pMesh->mFaces;
+    pMesh->FreeFaces();
 
     // ... and store the new ones
     pMesh->mFaces    = out;
     pMesh->mNumFaces = (unsigned int)(curOut-out); /* not necessarily equal to numOut */
+    pMesh->mFaceIndices    = outIndices;
+    pMesh->mNumFaceIndices = numOutIndices;
     return true;
 }
 
@@ -1204,6 +1204,12 @@ configuration switch to <tt>true</tt> (nonzero). Results are dumped to the log f
 an appropriate logger implementation with at least one output stream first (see the @link logging Logging Page @endlink
 for the details.).
 
+The same timings are kept as a tree of regions (<tt>total</tt>, <tt>import</tt> with the phases of the importer,
+e.g. <tt>tokenize</tt>, <tt>parse</tt> and <tt>convert</tt>, <tt>preprocess</tt> and <tt>postprocess</tt> with one
+region per step) together with the number of bytes read and the vertex and face counts of the result. Query them
+with Assimp::Importer::GetImportStatistics() or aiGetImportStatistics(), or set <tt>GLOB_MEASURE_TIME_FILE</tt> to
+have them written to a JSON file after each import.
+
 Note that these measurements are based on a single run of the importer and each of the post processing steps, so
 a single result set is far away from being significant in a statistic sense. While precision can be improved
 by running the test multiple times, the low accuracy of the timings may render the results useless
@@ -0,0 +1,398 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2021, assimp team
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file Allocator.h
+ *  @brief Hook for the allocations of scene data and a counting allocator
+ *    to measure the memory used by imports.
+ */
+#pragma once
+#ifndef AI_ALLOCATOR_H_INC
+#define AI_ALLOCATOR_H_INC
+
+#ifdef __GNUC__
+#   pragma GCC system_header
+#endif
+
+#include <assimp/defs.h>
+
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+struct aiScene;
+
+namespace Assimp {
+
+// ----------------------------------------------------------------------------------
+/** @brief Interface for the allocator used for scene objects.
+ *
+ *  The scene objects (nodes, meshes, bones, anim meshes, animations and their
+ *  channels) are allocated through the allocator bound to the calling thread,
+ *  regardless of whether they are created by an importer, a post-processing
+ *  step, the SceneCombiner or the application itself. The Importer binds the
+ *  allocator set with Importer::SetAllocator() while it works on a scene, on
+ *  the calling thread and on its worker threads. Other code may bind one with
+ *  an #Allocator::Scope.
+ *
+ *  The arrays of the element types (vertices, colors, faces, weights, keys)
+ *  are allocated through it as well. Index, pointer and byte arrays of the
+ *  scene are allocated with #AllocateSceneArray() and released with
+ *  #FreeSceneArray(), see #SceneArrayScope for their layout.
+ *
+ *  Every object and array remembers the allocator it came from in a header
+ *  and is released through it, on any thread and no matter which allocator
+ *  is bound then. */
+class ASSIMP_API Allocator {
+public:
+    /** @brief Virtual destructor */
+    virtual ~Allocator();
+
+    // -------------------------------------------------------------------
+    /** @brief Allocates a block of memory.
+     *  @param size Number of bytes, may be 0.
+     *  @return The block, suitably aligned for any scene type. Must not
+     *    be nullptr, throw std::bad_alloc instead. */
+    virtual void *Allocate(size_t size) = 0;
+
+    // -------------------------------------------------------------------
+    /** @brief Releases a block returned by #Allocate().
+     *  @param data The block, never nullptr.
+     *  @param size The size which was passed to #Allocate(). */
+    virtual void Deallocate(void *data, size_t size) AI_NO_EXCEPT = 0;
+
+    // -------------------------------------------------------------------
+    /** @brief Binds an allocator to the calling thread for its lifetime.
+     *
+     *  Scopes may be nested, the previous allocator is bound again on
+     *  destruction. A scope for nullptr keeps the current allocator. The
+     *  allocator must outlive all objects allocated through it. */
+    class ASSIMP_API Scope {
+    public:
+        explicit Scope(Allocator *allocator);
+        ~Scope();
+
+    private:
+        Scope(const Scope &) = delete;
+        Scope &operator=(const Scope &) = delete;
+
+        Allocator *mPrevious;
+        bool mActive;
+    };
+
+    // -------------------------------------------------------------------
+    /** @brief Returns the allocator bound to the calling thread.
+     *  @return nullptr if the global operator new is used. */
+    static Allocator *GetActive();
+};
+
+// ----------------------------------------------------------------------------------
+/** @brief Allocator which keeps track of the memory it hands out.
+ *
+ *  Forwards all calls to another allocator and counts the bytes currently
+ *  allocated, their peak and the total number of bytes allocated. If it is
+ *  set with Importer::SetAllocator() and #AI_CONFIG_GLOB_MEASURE_TIME is
+ *  enabled, the Importer records the peak and total bytes of each phase of
+ *  an import in its statistics, see Importer::GetImportStatistics(). Imports
+ *  sharing the allocator are counted together. */
+class ASSIMP_API CountingAllocator : public Allocator {
+public:
+    // -------------------------------------------------------------------
+    /** @brief Construction
+     *  @param parent Allocator doing the actual work, nullptr for the
+     *    global operator new. */
+    explicit CountingAllocator(Allocator *parent = nullptr);
+
+    void *Allocate(size_t size) override;
+    void Deallocate(void *data, size_t size) AI_NO_EXCEPT override;
+
+    /** @brief Returns the number of bytes currently allocated */
+    size_t GetCurrentBytes() const {
+        return mCurrent;
+    }
+
+    /** @brief Returns the peak of #GetCurrentBytes() since construction or
+     *  the last call to #ResetPeak() */
+    size_t GetPeakBytes() const {
+        return mPeak;
+    }
+
+    /** @brief Returns the number of bytes allocated since construction,
+     *  releasing memory does not decrease it */
+    size_t GetTotalBytes() const {
+        return mTotal;
+    }
+
+    /** @brief Returns the number of allocations since construction */
+    size_t GetNumAllocations() const {
+        return mNumAllocations;
+    }
+
+    // -------------------------------------------------------------------
+    /** @brief Restarts peak tracking at the current number of bytes.
+     *  @return The peak before the reset. */
+    size_t ResetPeak();
+
+    // -------------------------------------------------------------------
+    /** @brief Raises the peak to at least the given number of bytes, e.g.
+     *  to restore an outer peak after measuring a nested one.
+     *  @param bytes Lower bound for the peak. */
+    void RaisePeak(size_t bytes);
+
+private:
+    Allocator *mParent;
+    std::atomic<size_t> mCurrent;
+    std::atomic<size_t> mPeak;
+    std::atomic<size_t> mTotal;
+    std::atomic<size_t> mNumAllocations;
+};
+
+// ----------------------------------------------------------------------------------
+/** @brief Binds the layout of the index, pointer and byte arrays of a scene to
+ *    the calling thread for its lifetime.
+ *
+ *  While an allocator or the limits of an import are bound,
+ *  #AllocateSceneArray() puts the allocator and the size of an array in a
+ *  header in front of it and #FreeSceneArray() expects this header, otherwise
+ *  both use new[] and delete[]. A scene keeps the layout bound on its
+ *  construction, its destructor and the Importer working on it bind it again.
+ *  Code changing the arrays of a scene which was imported with an allocator
+ *  or limits outside of the Importer binds a scope for the scene. Scopes may be nested, the previous layout is bound again on
+ *  destruction. */
+class ASSIMP_API SceneArrayScope {
+public:
+    /** @brief Binds the layout of a scene
+     *  @param scene The scene, nullptr keeps the current layout. */
+    explicit SceneArrayScope(const aiScene *scene);
+
+    /** @brief Binds a layout, e.g. the one of another thread
+     *  @param tracked true for arrays with a header. */
+    explicit SceneArrayScope(bool tracked);
+
+    ~SceneArrayScope();
+
+    /** @brief Returns whether arrays have a header on the calling thread */
+    static bool IsTracked();
+
+private:
+    SceneArrayScope(const SceneArrayScope &) = delete;
+    SceneArrayScope &operator=(const SceneArrayScope &) = delete;
+
+    int mPrevious;
+    bool mActive;
+};
+
+//! @cond never
+namespace Intern {
+
+/** Allocation functions used by the operators of the scene objects */
+ASSIMP_API void *AllocateSceneMemory(size_t size);
+ASSIMP_API void FreeSceneMemory(void *data, size_t size) AI_NO_EXCEPT;
+
+/** Allocation functions used by the array operators of the scene types */
+ASSIMP_API void *AllocateSceneArrayMemory(size_t size);
+ASSIMP_API void FreeSceneArrayMemory(void *data) AI_NO_EXCEPT;
+
+/** Allocation functions used by AllocateSceneArray() and FreeSceneArray().
+ *  AllocateTrackedMemory() returns nullptr if the global operator new[] is
+ *  to be used, ReleaseTrackedMemory() returns false for memory which is to
+ *  be released with delete[]. */
+ASSIMP_API void *AllocateTrackedMemory(size_t size, size_t alignment);
+ASSIMP_API bool IsTrackedMemory(const void *data) AI_NO_EXCEPT;
+ASSIMP_API bool ReleaseTrackedMemory(const void *data) AI_NO_EXCEPT;
+
+} // namespace Intern
+//! @endcond
+
+// ----------------------------------------------------------------------------------
+/** @brief Allocates an index, pointer or byte array of the scene through the
+ *    allocator bound to the calling thread.
+ *
+ *  Without a header, see #SceneArrayScope, this is new T[count].
+ *  Release the array with #FreeSceneArray().
+ *  @param count Number of elements, may be 0.
+ *  @return The array, its elements are default-initialized. */
+template <typename T>
+inline T *AllocateSceneArray(size_t count) {
+    static_assert(std::is_trivially_destructible<T>::value, "scene arrays are released without destructor calls");
+    if (count > std::numeric_limits<size_t>::max() / sizeof(T)) {
+        throw std::bad_array_new_length();
+    }
+
+    T *data = static_cast<T *>(Intern::AllocateTrackedMemory(count * sizeof(T), alignof(T)));
+    if (nullptr == data) {
+        return new T[count];
+    }
+    for (size_t i = 0; i < count; ++i) {
+        new (data + i) T;
+    }
+    return data;
+}
+
+// ----------------------------------------------------------------------------------
+/** @brief Allocates an array like #AllocateSceneArray(size_t) and sets each
+ *    element to a value.
+ *  @param count Number of elements, may be 0.
+ *  @param value Value of all elements, e.g. nullptr for a pointer array. */
+template <typename T>
+inline T *AllocateSceneArray(size_t count, const T &value) {
+    T *data = AllocateSceneArray<T>(count);
+    for (size_t i = 0; i < count; ++i) {
+        data[i] = value;
+    }
+    return data;
+}
+
+// ----------------------------------------------------------------------------------
+/** @brief Releases an array allocated with #AllocateSceneArray(), or with
+ *    new[] if arrays have no header on the calling thread.
+ *  @param data The array, may be nullptr. */
+template <typename T>
+inline void FreeSceneArray(T *data) AI_NO_EXCEPT {
+    if (nullptr != data && !Intern::ReleaseTrackedMemory(data)) {
+        delete[] data;
+    }
+}
+
+// ----------------------------------------------------------------------------------
+/** @brief Hands an array allocated with new[], e.g. a buffer taken over from a
+ *    parser, to the scene.
+ *
+ *  If #AllocateSceneArray() would use new[] the array is returned as it
+ *  is. Otherwise it is copied into an array from there and released.
+ *  @param data The array, may be nullptr.
+ *  @param count Number of elements.
+ *  @return The array to store in the scene. */
+template <typename T>
+inline T *AdoptSceneArray(T *data, size_t count) {
+    static_assert(std::is_trivially_destructible<T>::value, "scene arrays are released without destructor calls");
+    if (nullptr == data) {
+        return data;
+    }
+    std::unique_ptr<T[]> owned(data);
+    T *copy = static_cast<T *>(Intern::AllocateTrackedMemory(count * sizeof(T), alignof(T)));
+    if (nullptr == copy) {
+        return owned.release();
+    }
+    for (size_t i = 0; i < count; ++i) {
+        new (copy + i) T(data[i]);
+    }
+    return copy;
+}
+
+// ----------------------------------------------------------------------------------
+/** @brief Allocates a single value of the scene, e.g. the value of a metadata
+ *    entry, through the allocator bound to the calling thread.
+ *
+ *  Without a header, see #SceneArrayScope, this is new T(value). Release
+ *  the value with #FreeSceneObject().
+ *  @param value Value to copy. */
+template <typename T>
+inline T *AllocateSceneObject(const T &value) {
+    void *data = Intern::AllocateTrackedMemory(sizeof(T), alignof(T));
+    if (nullptr == data) {
+        return new T(value);
+    }
+    try {
+        return new (data) T(value);
+    } catch (...) {
+        Intern::ReleaseTrackedMemory(data);
+        throw;
+    }
+}
+
+// ----------------------------------------------------------------------------------
+/** @brief Releases a value allocated with #AllocateSceneObject() or new.
+ *  @param data The value, may be nullptr. */
+template <typename T>
+inline void FreeSceneObject(T *data) AI_NO_EXCEPT {
+    if (nullptr == data) {
+        return;
+    }
+    if (!Intern::IsTrackedMemory(data)) {
+        delete data;
+        return;
+    }
+    data->~T();
+    Intern::ReleaseTrackedMemory(data);
+}
+
+} // namespace Assimp
+
+// ----------------------------------------------------------------------------------
+/** Declares the class-specific allocation functions of a scene object, which
+ *  route its allocations through the bound allocator. There are deliberately
+ *  no array forms, see #AI_SCENE_ARRAY_ALLOCATION_OPERATORS. */
+#define AI_SCENE_ALLOCATION_OPERATORS                                                        \
+    static void *operator new(size_t size) {                                                 \
+        return ::Assimp::Intern::AllocateSceneMemory(size);                                  \
+    }                                                                                        \
+    static void *operator new(size_t, void *place) AI_NO_EXCEPT {                           \
+        return place;                                                                        \
+    }                                                                                        \
+    static void operator delete(void *data, size_t size) AI_NO_EXCEPT {                      \
+        ::Assimp::Intern::FreeSceneMemory(data, size);                                       \
+    }                                                                                        \
+    static void operator delete(void *, void *) AI_NO_EXCEPT {                               \
+    }
+
+// ----------------------------------------------------------------------------------
+/** Declares the class-specific array allocation functions of an element type
+ *  of the scene, which route the arrays through the bound allocator. The
+ *  array delete takes no size, so arrays of trivially destructible types get
+ *  no cookie and keep the layout of a plain array. */
+#define AI_SCENE_ARRAY_ALLOCATION_OPERATORS                                                  \
+    static void *operator new[](size_t size) {                                               \
+        return ::Assimp::Intern::AllocateSceneArrayMemory(size);                             \
+    }                                                                                        \
+    static void *operator new[](size_t, void *place) AI_NO_EXCEPT {                         \
+        return place;                                                                        \
+    }                                                                                        \
+    static void operator delete[](void *data) AI_NO_EXCEPT {                                 \
+        ::Assimp::Intern::FreeSceneArrayMemory(data);                                        \
+    }                                                                                        \
+    static void operator delete[](void *, void *) AI_NO_EXCEPT {                             \
+    }
+
+#endif // AI_ALLOCATOR_H_INC
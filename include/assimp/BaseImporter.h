@@ -58,6 +58,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <memory>
 
 struct aiScene;
+struct aiMesh;
 struct aiImporterDesc;
 
 namespace Assimp {
@@ -67,6 +68,11 @@ class IOSystem;
 class BaseProcess;
 class SharedPostProcessInfo;
 class IOStream;
+class MeshSink;
+
+namespace Profiling {
+class Profiler;
+}
 
 // utility to do char4 to uint32 in a portable manner
 #define AI_MAKE_MAGIC(string) ((uint32_t)((string[0] << 24) + \
@@ -139,6 +145,31 @@ public:
             const std::string &pFile,
             IOSystem *pIOHandler);
 
+    // -------------------------------------------------------------------
+    /** Loads the payload of a mesh which the last call to ReadFile()
+     * deferred, see #AI_CONFIG_IMPORT_DEFER_MESH_DATA.
+     *
+     * @param pFile Path of the file which was imported.
+     * @param pScene The scene returned by ReadFile().
+     * @param pMeshIndex Index of the deferred mesh.
+     * @param pIOHandler IO-Handler used to open the file.
+     * @return false if loading failed, GetErrorText() returns the reason.
+     *
+     * @note This function is not intended to be overridden. Implement
+     * InternReadMeshData() instead.
+     */
+    bool ReadMeshData(
+            const std::string &pFile,
+            aiScene *pScene,
+            unsigned int pMeshIndex,
+            IOSystem *pIOHandler);
+
+    // -------------------------------------------------------------------
+    /** Releases everything kept to load deferred meshes. Called by the
+     * #Importer once the scene is gone. Importers which keep state for
+     * InternReadMeshData() override it, the default does nothing. */
+    virtual void ReleaseDeferredData();
+
     // -------------------------------------------------------------------
     /** Returns the error description of the last error that occurred.
      * If the error is due to a std::exception, this will return the message.
@@ -241,6 +272,25 @@ protected:
             aiScene *pScene,
             IOSystem *pIOHandler) = 0;
 
+    // -------------------------------------------------------------------
+    /** Loads the payload of a deferred mesh. Only called for scenes which
+     * InternReadFile() returned with AI_SCENE_FLAGS_DEFERRED_MESH_DATA,
+     * which importers may only do if #m_deferMeshData is set.
+     *
+     * Importers which defer meshes must override it and load the data of
+     * the requested mesh only, MoveMeshData() hands it to the scene. The
+     * default implementation throws, no mesh is deferred without it.
+     *
+     * @param pFile Path of the file which was imported.
+     * @param pScene The scene holding the deferred mesh.
+     * @param pMeshIndex Index of the deferred mesh.
+     * @param pIOHandler The IO handler to use for any file access. */
+    virtual void InternReadMeshData(
+            const std::string &pFile,
+            aiScene *pScene,
+            unsigned int pMeshIndex,
+            IOSystem *pIOHandler);
+
 public: // static utilities
     // -------------------------------------------------------------------
     /** A utility for CanRead().
@@ -348,6 +398,21 @@ public: // static utilities
             std::vector<char> &data,
             TextFileMode mode = FORBID_EMPTY);
 
+    // -------------------------------------------------------------------
+    /** Moves the vertex data, faces, bones and anim meshes of a mesh into
+     *  a deferred mesh, see InternReadMeshData().
+     *  @param dest The deferred mesh.
+     *  @param src The loaded mesh, receives the empty arrays of dest. */
+    static void MoveMeshData(aiMesh *dest, aiMesh *src);
+
+    // -------------------------------------------------------------------
+    /** Hands a mesh or a chunk of a mesh to the #MeshSink of the import.
+     *  Must only be called if m_meshSink is set.
+     *  @param mesh The mesh, ownership passes to the sink.
+     *  @param meshIndex Index of the mesh of the file the data belongs to.
+     *  @throw DeadlyImportError if the sink aborts the import. */
+    void SinkMesh(aiMesh *mesh, unsigned int meshIndex);
+
     // -------------------------------------------------------------------
     /** Utility function to move a std::vector into a aiScene array
     *  @param vec The vector to be moved
@@ -360,7 +425,7 @@ public: // static utilities
             unsigned int &outLength) {
         outLength = unsigned(vec.size());
         if (outLength) {
-            out = new T[outLength];
+            out = AllocateSceneArray<T>(outLength);
             std::swap_ranges(vec.begin(), vec.end(), out);
         }
     }
@@ -377,7 +442,7 @@ public: // static utilities
             unsigned int &outLength) {
         outLength = unsigned(vec.size());
         if (outLength) {
-            out = new T*[outLength];
+            out = AllocateSceneArray<T *>(outLength);
             T** outPtr = out;
             std::for_each(vec.begin(), vec.end(), [&outPtr](std::unique_ptr<T>& uPtr){*outPtr = uPtr.release(); ++outPtr; });
         }
@@ -387,6 +452,9 @@ private:
     /* Pushes state into importer for the importer scale */
     void UpdateImporterScale(Importer *pImp);
 
+    /* Hands the meshes left in the scene to the mesh sink */
+    void SinkSceneMeshes(aiScene *pScene);
+
 protected:
     /// Error description in case there was one.
     std::string m_ErrorText;
@@ -394,6 +462,24 @@ protected:
     std::exception_ptr m_Exception;
     /// Currently set progress handler.
     ProgressHandler *m_progress;
+    /// Profiler of the running import, nullptr unless time measurement is
+    /// enabled. Use Profiling::ScopedRegion to record the phases of an import.
+    Profiling::Profiler *m_profiler;
+    /// Set during ReadFile() if #AI_CONFIG_IMPORT_DEFER_MESH_DATA is enabled.
+    /// Importers which support it may leave the payload of meshes out then.
+    bool m_deferMeshData;
+    /// Receiver of the meshes of the running import, nullptr if they are
+    /// stored in the scene. Importers which support it call SinkMesh() as
+    /// soon as a mesh is complete, the others leave them in the scene.
+    MeshSink *m_meshSink;
+    /// Maximum number of vertices of the chunks of meshes without
+    /// connectivity, see #AI_CONFIG_IMPORT_MESH_SINK_CHUNK_SIZE.
+    unsigned int m_meshSinkChunkSize;
+    /// Number of meshes handed to the sink so far, i.e. the next free index.
+    unsigned int m_numSunkMeshes;
+    /// Number of threads of the running import, see
+    /// #AI_CONFIG_GLOB_MULTITHREADING. 1 unless multithreading is enabled.
+    unsigned int m_numThreads;
 };
 
 } // end of namespace Assimp
@@ -304,7 +304,7 @@ private:
 };
 
 // --------------------------------------------------------------------------------------------
-BlobIOStream ::~BlobIOStream() {
+inline BlobIOStream::~BlobIOStream() {
     creator->OnDestruct(file, this);
     delete[] buffer;
 }
@@ -0,0 +1,364 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2021, assimp team
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file CompactScene.h
+ *  @brief Memory-saving representation of a scene which keeps all names in
+ *    one interned string table.
+ */
+#pragma once
+#ifndef AI_COMPACTSCENE_H_INC
+#define AI_COMPACTSCENE_H_INC
+
+#ifdef __GNUC__
+#   pragma GCC system_header
+#endif
+
+#include <assimp/anim.h>
+#include <assimp/material.h>
+#include <assimp/matrix4x4.h>
+#include <assimp/mesh.h>
+#include <assimp/metadata.h>
+#include <assimp/types.h>
+
+#include <cstdint>
+#include <vector>
+
+struct aiScene;
+
+namespace Assimp {
+
+// ----------------------------------------------------------------------------------
+/** @brief Set of unique strings addressed by small integer ids.
+ *
+ *  All strings are stored back to back in one character buffer, each of them
+ *  only once. Interning a string which is already part of the table returns
+ *  the id it got the first time. Id 0 always refers to the empty string. */
+class ASSIMP_API StringTable {
+public:
+    /** Index of a string in the table */
+    typedef unsigned int Id;
+
+    /** Id of the empty string */
+    static const Id EmptyId = 0;
+
+    /** Returned by #Find() for strings which are not in the table */
+    static const Id InvalidId = ~0u;
+
+    StringTable();
+
+    // -------------------------------------------------------------------
+    /** @brief Adds a string unless it is already part of the table.
+     *  @param str The characters, need not be zero-terminated.
+     *  @param length Number of characters.
+     *  @return Id of the string. */
+    Id Intern(const char *str, size_t length);
+
+    Id Intern(const aiString &str) {
+        return Intern(str.data, str.length);
+    }
+
+    // -------------------------------------------------------------------
+    /** @brief Looks up a string without adding it.
+     *  @return Id of the string or #InvalidId. */
+    Id Find(const char *str, size_t length) const;
+
+    /** @brief Returns the zero-terminated characters of a string */
+    const char *GetString(Id id) const {
+        return &mChars[mOffsets[id]];
+    }
+
+    /** @brief Returns the number of characters of a string */
+    unsigned int GetLength(Id id) const {
+        return mOffsets[id + 1] - mOffsets[id] - 1;
+    }
+
+    /** @brief Converts a string to an aiString, truncated to MAXLEN - 1 */
+    aiString ToString(Id id) const;
+
+    /** @brief Returns the number of strings including the empty one */
+    unsigned int GetNumStrings() const {
+        return static_cast<unsigned int>(mOffsets.size() - 1);
+    }
+
+    /** @brief Returns the number of bytes used by the table */
+    size_t GetMemoryFootprint() const;
+
+private:
+    void Grow();
+
+    //! Zero-terminated strings back to back
+    std::vector<char> mChars;
+    //! Start of each string in mChars followed by the end of the last one
+    std::vector<unsigned int> mOffsets;
+    //! Open addressing hash table of ids, InvalidId marks free buckets
+    std::vector<Id> mBuckets;
+};
+
+// ----------------------------------------------------------------------------------
+/** @brief Opt-in representation of a scene for keeping many named objects in
+ *    memory.
+ *
+ *  Every aiString embedded in the scene data structures takes MAXLEN bytes,
+ *  no matter how long the name actually is. For scenes with many nodes,
+ *  bones, animation channels or metadata entries these names make up most
+ *  of the memory. A CompactScene takes over an imported scene and replaces
+ *  nodes, bones, node animation channels, material properties and metadata
+ *  by small records which refer to their names by an id into a shared
+ *  #StringTable. Vertex data, weights and keys are moved over as they are.
+ *
+ *  The records can be inspected through the accessors below, #ToScene()
+ *  converts everything back into a regular aiScene for code which needs the
+ *  usual data structures:
+ *
+ *  @code
+ *  Assimp::CompactScene compact(importer.GetOrphanedScene());
+ *  unsigned int hand = compact.FindNode("hand_l");
+ *  ...
+ *  aiScene *scene = compact.ToScene();
+ *  @endcode
+ *
+ *  Nodes are stored in breadth-first order, so the children of a node are
+ *  consecutive and node 0 is the root. */
+class ASSIMP_API CompactScene {
+public:
+    typedef StringTable::Id Id;
+
+    /** Marks a missing node or metadata reference */
+    static const unsigned int None = ~0u;
+
+    /** A node of the hierarchy */
+    struct Node {
+        Id mName;
+        unsigned int mParent;
+        unsigned int mFirstChild;
+        unsigned int mNumChildren;
+        unsigned int mFirstMesh; ///< Index into #GetNodeMeshes()
+        unsigned int mNumMeshes;
+        unsigned int mMetadata;
+        aiMatrix4x4 mTransformation;
+    };
+
+    /** A bone, mNode and mArmature are node indices */
+    struct Bone {
+        Id mName;
+        unsigned int mNode;
+        unsigned int mArmature;
+        unsigned int mNumWeights;
+        aiVertexWeight *mWeights;
+        aiMatrix4x4 mOffsetMatrix;
+    };
+
+    /** Animation channel of a node */
+    struct NodeAnim {
+        Id mNodeName;
+        aiAnimBehaviour mPreState;
+        aiAnimBehaviour mPostState;
+        unsigned int mNumPositionKeys;
+        unsigned int mNumRotationKeys;
+        unsigned int mNumScalingKeys;
+        aiVectorKey *mPositionKeys;
+        aiQuatKey *mRotationKeys;
+        aiVectorKey *mScalingKeys;
+    };
+
+    /** A property of a material */
+    struct MaterialProperty {
+        Id mKey;
+        unsigned int mSemantic;
+        unsigned int mIndex;
+        unsigned int mDataLength;
+        aiPropertyTypeInfo mType;
+        char *mData;
+    };
+
+    /** A metadata entry. mValue holds the bits of bool, integer and floating
+     *  point values, the id of AI_AISTRING values, an index into the vector
+     *  pool for AI_AIVECTOR3D and the metadata block of AI_AIMETADATA. */
+    struct MetadataEntry {
+        Id mKey;
+        aiMetadataType mType;
+        uint64_t mValue;
+    };
+
+    // -------------------------------------------------------------------
+    /** @brief Converts a scene.
+     *  @param scene The scene, the CompactScene takes ownership and deletes
+     *    it once all data has been moved out. */
+    explicit CompactScene(aiScene *scene);
+
+    ~CompactScene();
+
+    // -------------------------------------------------------------------
+    /** @brief Builds a regular aiScene from the compact data.
+     *  @return A new scene owned by the caller, the CompactScene stays
+     *    untouched. */
+    aiScene *ToScene() const;
+
+    // -------------------------------------------------------------------
+    /** @brief Returns the table holding all names */
+    const StringTable &GetStrings() const {
+        return mStrings;
+    }
+
+    /** @brief Converts an id into an aiString */
+    aiString GetString(Id id) const {
+        return mStrings.ToString(id);
+    }
+
+    // -------------------------------------------------------------------
+    unsigned int GetNumNodes() const {
+        return static_cast<unsigned int>(mNodes.size());
+    }
+
+    const Node &GetNode(unsigned int node) const {
+        return mNodes[node];
+    }
+
+    aiString GetNodeName(unsigned int node) const {
+        return mStrings.ToString(mNodes[node].mName);
+    }
+
+    /** @brief Returns the mesh indices of all nodes */
+    const unsigned int *GetNodeMeshes() const {
+        return mNodeMeshes.data();
+    }
+
+    /** @brief Finds the first node with the given name in breadth-first
+     *  order, see aiNode::FindNode().
+     *  @return The node index or #None. */
+    unsigned int FindNode(const char *name) const;
+
+    /** @brief Builds the metadata of a node.
+     *  @return A new object owned by the caller or nullptr if the node has
+     *    no metadata. */
+    aiMetadata *CreateNodeMetadata(unsigned int node) const;
+
+    // -------------------------------------------------------------------
+    /** @brief Returns the meshes, they don't hold their bones anymore */
+    unsigned int GetNumMeshes() const;
+    const aiMesh *GetMesh(unsigned int mesh) const;
+
+    unsigned int GetNumBones(unsigned int mesh) const {
+        return mMeshBones[mesh + 1] - mMeshBones[mesh];
+    }
+
+    const Bone &GetBone(unsigned int mesh, unsigned int bone) const {
+        return mBones[mMeshBones[mesh] + bone];
+    }
+
+    aiString GetBoneName(unsigned int mesh, unsigned int bone) const {
+        return mStrings.ToString(GetBone(mesh, bone).mName);
+    }
+
+    // -------------------------------------------------------------------
+    /** @brief Returns the animations, they don't hold their node channels
+     *  anymore */
+    unsigned int GetNumAnimations() const;
+    const aiAnimation *GetAnimation(unsigned int animation) const;
+
+    unsigned int GetNumChannels(unsigned int animation) const {
+        return mAnimationChannels[animation + 1] - mAnimationChannels[animation];
+    }
+
+    const NodeAnim &GetChannel(unsigned int animation, unsigned int channel) const {
+        return mChannels[mAnimationChannels[animation] + channel];
+    }
+
+    // -------------------------------------------------------------------
+    unsigned int GetNumMaterials() const {
+        return static_cast<unsigned int>(mMaterialProperties.size() - 1);
+    }
+
+    unsigned int GetNumProperties(unsigned int material) const {
+        return mMaterialProperties[material + 1] - mMaterialProperties[material];
+    }
+
+    const MaterialProperty &GetProperty(unsigned int material, unsigned int property) const {
+        return mProperties[mMaterialProperties[material] + property];
+    }
+
+    /** @brief Builds a material.
+     *  @return A new object owned by the caller. */
+    aiMaterial *CreateMaterial(unsigned int material) const;
+
+    // -------------------------------------------------------------------
+    /** @brief Returns the number of bytes used by the string table and the
+     *  compact records. Data which was moved over as it is, like vertices,
+     *  weights and keys, is not included. */
+    size_t GetMemoryFootprint() const;
+
+private:
+    CompactScene(const CompactScene &) = delete;
+    CompactScene &operator=(const CompactScene &) = delete;
+
+    unsigned int AddMetadata(const aiMetadata *metadata);
+    aiMetadata *CreateMetadata(unsigned int block) const;
+
+    StringTable mStrings;
+
+    std::vector<Node> mNodes;
+    std::vector<unsigned int> mNodeMeshes;
+
+    //! Bones of mesh i are [mMeshBones[i], mMeshBones[i + 1])
+    std::vector<Bone> mBones;
+    std::vector<unsigned int> mMeshBones;
+
+    //! Channels of animation i are [mAnimationChannels[i], mAnimationChannels[i + 1])
+    std::vector<NodeAnim> mChannels;
+    std::vector<unsigned int> mAnimationChannels;
+
+    //! Properties of material i are [mMaterialProperties[i], mMaterialProperties[i + 1])
+    std::vector<MaterialProperty> mProperties;
+    std::vector<unsigned int> mMaterialProperties;
+
+    //! Entries of metadata block i are [mMetadata[i], mMetadata[i + 1])
+    std::vector<MetadataEntry> mMetadataEntries;
+    std::vector<unsigned int> mMetadata;
+    std::vector<aiVector3D> mMetadataVectors;
+
+    //! Holds everything that is kept in its original form: the meshes
+    //! without bones, the animations without node channels, textures,
+    //! lights, cameras and the metadata of the scene
+    aiScene *mScene;
+};
+
+} // namespace Assimp
+
+#endif // AI_COMPACTSCENE_H_INC
@@ -77,6 +77,10 @@ public:
     /** Compare two paths */
     bool ComparePaths (const char* one, const char* second) const;
 
+    // -------------------------------------------------------------------
+    /** Rename a file, atomically replacing an existing target. */
+    bool RenameFile( const std::string &from, const std::string &to );
+
     /** @brief get the file name of a full filepath
      * example: /tmp/archive.tar.gz -> archive.tar.gz
      */
@@ -126,6 +126,18 @@ public:
      *  See fflush() for more details.
      */
     virtual void Flush() = 0;
+
+    // -------------------------------------------------------------------
+    /** @brief Returns a pointer to the complete file contents, if available.
+     *
+     *  Streams which are backed by one contiguous block of memory (e.g. a
+     *  memory mapping or a memory buffer) return a pointer to its first byte
+     *  here. The block is FileSize() bytes long and stays valid as long as
+     *  the stream is alive, it is not affected by Seek() or Read().
+     *  Importers may use it to access the file data without copying it.
+     *  @return The view, or nullptr if the stream can only be accessed
+     *   by Read(), which is the default. */
+    virtual const uint8_t *GetContiguousView() const;
 }; //! class IOStream
 
 // ----------------------------------------------------------------------------------
@@ -139,6 +151,12 @@ AI_FORCE_INLINE
 IOStream::~IOStream() {
     // empty
 }
+
+// ----------------------------------------------------------------------------------
+AI_FORCE_INLINE
+const uint8_t *IOStream::GetContiguousView() const {
+    return nullptr;
+}
 // ----------------------------------------------------------------------------------
 
 } //!namespace Assimp
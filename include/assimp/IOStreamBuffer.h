@@ -52,6 +52,12 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/IOStream.hpp>
 #include <assimp/ParsingUtils.h>
 
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 namespace Assimp {
@@ -59,6 +65,10 @@ namespace Assimp {
 // ---------------------------------------------------------------------------
 /**
  *  Implementation of a cached stream buffer.
+ *
+ *  The stream is read block-wise. With read-ahead enabled a background
+ *  thread reads the following blocks while the current one is parsed,
+ *  the stream must not be accessed by others until the buffer is closed.
  */
 template<class T>
 class IOStreamBuffer {
@@ -86,6 +96,17 @@ public:
     /// @return The cache size.
     size_t cacheSize() const;
 
+    /// @brief  Sets the number of blocks which are read ahead on a background thread,
+    ///         1 means double buffering. Takes effect with the next open().
+    ///         The stream is then read on that thread while its IOSystem may be
+    ///         used on the calling one, both must tolerate this.
+    /// @param  depth       The number of blocks, 0 disables read-ahead.
+    void setReadAhead( size_t depth );
+
+    /// @brief  Returns the number of blocks which are read ahead.
+    /// @return The number of blocks.
+    size_t getReadAhead() const;
+
     /// @brief  Will read the next block.
     /// @return true if successful.
     bool readNextBlock();
@@ -112,12 +133,69 @@ public:
     /// @return true if successful.
     bool getNextLine(std::vector<T> &buffer);
 
+    /// @brief  Will return the next line without copying it, lines ending with
+    ///         the continuation token are joined with the following line.
+    ///         The line is followed by a line end, the view stays valid until
+    ///         the next read.
+    /// @param  line        Will point to the first element of the line.
+    /// @param  length      Will contain the length of the line without its line end.
+    /// @param  continuationToken   The token to continue a line with.
+    /// @return true if successful.
+    bool getNextDataLineView( const T *&line, size_t &length, T continuationToken );
+
+    /// @brief  Will return the next non-empty line without copying it. The line
+    ///         is followed by a line end, the view stays valid until the next read.
+    /// @param  line        Will point to the first element of the line.
+    /// @param  length      Will contain the length of the line without its line end.
+    /// @return true if successful.
+    bool getNextLineView( const T *&line, size_t &length );
+
     /// @brief  Will read the next block.
     /// @param  buffer      The buffer for the next block.
     /// @return true if successful.
     bool getNextBlock( std::vector<T> &buffer );
 
+    /// @brief  Will return the not yet consumed rest of the current block, or the
+    ///         next block, without copying it. The view stays valid until the next read.
+    /// @param  data        Will point to the first element.
+    /// @param  length      Will contain the number of elements.
+    /// @return true if successful.
+    bool getNextBlockView( const T *&data, size_t &length );
+
+    /// @brief  Will return the not yet consumed rest of the file without copying it,
+    ///         if the stream offers a contiguous view of its contents.
+    ///         The buffer is at its end afterwards.
+    /// @param  data        Will point to the first remaining element.
+    /// @param  length      Will contain the number of remaining elements.
+    /// @return true if successful, false if the stream has no contiguous view.
+    bool getRemainingView( const T *&data, size_t &length );
+
 private:
+    IOStreamBuffer( const IOStreamBuffer & ) = delete;
+    IOStreamBuffer &operator = ( const IOStreamBuffer & ) = delete;
+
+    /// Blocks read by the background thread, a ring of filled and free slots.
+    struct ReadAhead {
+        std::vector<std::vector<T>> mBlocks;
+        std::vector<size_t> mLengths;
+        size_t mBlockSize = 0;
+        size_t mFirst = 0;
+        size_t mFilled = 0;
+        size_t mFilePos = 0;
+        bool mEnd = false;
+        bool mStop = false;
+        std::exception_ptr mError;
+        std::mutex mMutex;
+        std::condition_variable mCondition;
+        std::thread mThread;
+    };
+
+    bool nextLineView( const T *&line, size_t &length, const T *continuationToken );
+    void skipLineEnd();
+    void startReadAhead();
+    void stopReadAhead();
+    void readAheadMain();
+
     IOStream *m_stream;
     size_t m_filesize;
     size_t m_cacheSize;
@@ -126,6 +204,9 @@ private:
     std::vector<T> m_cache;
     size_t m_cachePos;
     size_t m_filePos;
+    std::vector<T> m_line;
+    size_t m_readAheadDepth;
+    std::unique_ptr<ReadAhead> m_readAhead;
 };
 
 template<class T>
@@ -137,15 +218,19 @@ IOStreamBuffer<T>::IOStreamBuffer( size_t cache )
 , m_numBlocks( 0 )
 , m_blockIdx( 0 )
 , m_cachePos( 0 )
-, m_filePos( 0 ) {
-    m_cache.resize( cache );
+, m_filePos( 0 )
+, m_line()
+, m_readAheadDepth( 0 )
+, m_readAhead() {
+    // one more element for the terminator behind the block
+    m_cache.resize( cache + 1 );
     std::fill( m_cache.begin(), m_cache.end(), '\n' );
 }
 
 template<class T>
 AI_FORCE_INLINE
 IOStreamBuffer<T>::~IOStreamBuffer() {
-    // empty
+    stopReadAhead();
 }
 
 template<class T>
@@ -184,6 +269,7 @@ bool IOStreamBuffer<T>::close() {
     if ( nullptr == m_stream ) {
         return false;
     }
+    stopReadAhead();
 
     // init counters and state vars
     m_stream    = nullptr;
@@ -208,11 +294,48 @@ size_t IOStreamBuffer<T>::cacheSize() const {
     return m_cacheSize;
 }
 
+template<class T>
+AI_FORCE_INLINE
+void IOStreamBuffer<T>::setReadAhead( size_t depth ) {
+    m_readAheadDepth = depth;
+}
+
+template<class T>
+AI_FORCE_INLINE
+size_t IOStreamBuffer<T>::getReadAhead() const {
+    return m_readAheadDepth;
+}
+
 template<class T>
 AI_FORCE_INLINE
 bool IOStreamBuffer<T>::readNextBlock() {
-    m_stream->Seek( m_filePos, aiOrigin_SET );
-    size_t readLen = m_stream->Read( &m_cache[ 0 ], sizeof( T ), m_cacheSize );
+    size_t readLen = 0;
+    if ( 0 != m_readAheadDepth && m_filePos < m_filesize ) {
+        if ( !m_readAhead ) {
+            startReadAhead();
+        }
+
+        // take over the oldest block read in the background, the cache goes into its slot
+        ReadAhead &ahead = *m_readAhead;
+        std::unique_lock<std::mutex> lock( ahead.mMutex );
+        ahead.mCondition.wait( lock, [&ahead] { return 0 != ahead.mFilled || ahead.mEnd; } );
+        if ( 0 == ahead.mFilled ) {
+            if ( ahead.mError ) {
+                std::rethrow_exception( ahead.mError );
+            }
+            return false;
+        }
+        m_cache.swap( ahead.mBlocks[ ahead.mFirst ] );
+        readLen = ahead.mLengths[ ahead.mFirst ];
+        m_cacheSize = readLen;
+        ahead.mFirst = ( ahead.mFirst + 1 ) % ahead.mBlocks.size();
+        --ahead.mFilled;
+        lock.unlock();
+        ahead.mCondition.notify_all();
+    } else if ( 0 == m_readAheadDepth ) {
+        m_stream->Seek( m_filePos, aiOrigin_SET );
+        readLen = m_stream->Read( &m_cache[ 0 ], sizeof( T ), m_cacheSize );
+    }
     if ( readLen == 0 ) {
         return false;
     }
@@ -223,6 +346,9 @@ bool IOStreamBuffer<T>::readNextBlock() {
     m_cachePos = 0;
     m_blockIdx++;
 
+    // scanners running past the last line end stop here
+    m_cache[ m_cacheSize ] = '\0';
+
     return true;
 }
 
@@ -247,107 +373,246 @@ size_t IOStreamBuffer<T>::getFilePos() const {
 template<class T>
 AI_FORCE_INLINE
 bool IOStreamBuffer<T>::getNextDataLine( std::vector<T> &buffer, T continuationToken ) {
-    buffer.resize( m_cacheSize );
-    if ( m_cachePos >= m_cacheSize || 0 == m_filePos ) {
-        if ( !readNextBlock() ) {
-            return false;
-        }
+    const T *line = nullptr;
+    size_t length = 0;
+    if ( !getNextDataLineView( line, length, continuationToken ) ) {
+        return false;
     }
 
-    size_t i = 0;
-    for( ;; ) {
-        if ( continuationToken == m_cache[ m_cachePos ] && IsLineEnd( m_cache[ m_cachePos + 1 ] ) ) {
-            ++m_cachePos;
-            while ( m_cache[ m_cachePos ] != '\n' ) {
-                ++m_cachePos;
-            }
-            ++m_cachePos;
-        } else if ( IsLineEnd ( m_cache[ m_cachePos ] ) ) {
-            break;
-        }
+    buffer.assign( line, line + length );
+    buffer.push_back( '\n' );
 
-        buffer[ i ] = m_cache[ m_cachePos ];
-        ++m_cachePos;
-        ++i;
-        if (m_cachePos >= size()) {
-            break;
-        }
-        if ( m_cachePos >= m_cacheSize ) {
-            if ( !readNextBlock() ) {
-                return false;
-            }
-        }
+    return true;
+}
+
+template<class T>
+AI_FORCE_INLINE
+bool IOStreamBuffer<T>::getNextLine(std::vector<T> &buffer) {
+    const T *line = nullptr;
+    size_t length = 0;
+    if ( !getNextLineView( line, length ) ) {
+        return false;
     }
-    
-    buffer[ i ] = '\n';
-    ++m_cachePos;
+
+    buffer.assign( line, line + length );
+    buffer.push_back( '\n' );
+    buffer.push_back( '\0' );
 
     return true;
 }
 
-static AI_FORCE_INLINE
-bool isEndOfCache( size_t pos, size_t cacheSize ) {
-    return ( pos == cacheSize );
+template<class T>
+AI_FORCE_INLINE
+bool IOStreamBuffer<T>::getNextDataLineView( const T *&line, size_t &length, T continuationToken ) {
+    return nextLineView( line, length, &continuationToken );
 }
 
 template<class T>
 AI_FORCE_INLINE
-bool IOStreamBuffer<T>::getNextLine(std::vector<T> &buffer) {
-    buffer.resize(m_cacheSize);
-    if ( isEndOfCache( m_cachePos, m_cacheSize ) || 0 == m_filePos) {
-       if (!readNextBlock()) {
-          return false;
-       }
-      }
-
-    if (IsLineEnd(m_cache[m_cachePos])) {
-        // skip line end
-        while (m_cache[m_cachePos] != '\n') {
-            ++m_cachePos;
-        }
-        ++m_cachePos;
-        if ( isEndOfCache( m_cachePos, m_cacheSize ) ) {
+bool IOStreamBuffer<T>::getNextLineView( const T *&line, size_t &length ) {
+    // skip empty lines
+    for ( ;; ) {
+        if ( m_cachePos >= m_cacheSize || 0 == m_filePos ) {
             if ( !readNextBlock() ) {
                 return false;
             }
         }
+        while ( m_cachePos < m_cacheSize && IsLineEnd( m_cache[ m_cachePos ] ) ) {
+            ++m_cachePos;
+        }
+        if ( m_cachePos < m_cacheSize ) {
+            break;
+        }
     }
 
-    size_t i( 0 );
-    while (!IsLineEnd(m_cache[ m_cachePos ])) {
-        buffer[i] = m_cache[ m_cachePos ];
-        ++m_cachePos;
-        ++i;
-        if (m_cachePos >= m_cacheSize) {
-            if (!readNextBlock()) {
-                return false;
+    return nextLineView( line, length, nullptr );
+}
+
+template<class T>
+AI_FORCE_INLINE
+bool IOStreamBuffer<T>::nextLineView( const T *&line, size_t &length, const T *continuationToken ) {
+    if ( m_cachePos >= m_cacheSize || 0 == m_filePos ) {
+        if ( !readNextBlock() ) {
+            return false;
+        }
+    }
+
+    // usually the line ends within the current block and can be handed out in place
+    const T *begin = &m_cache[ m_cachePos ];
+    const T *blockEnd = &m_cache[ 0 ] + m_cacheSize;
+    const T *end = FindLineEnd( begin, blockEnd );
+    if ( end != blockEnd && ( nullptr == continuationToken || end == begin || end[ -1 ] != *continuationToken ) ) {
+        line = begin;
+        length = end - begin;
+        m_cachePos += length;
+        skipLineEnd();
+        return true;
+    }
+
+    // otherwise join the parts of the line which span blocks or continued lines
+    m_line.clear();
+    for ( ;; ) {
+        m_line.insert( m_line.end(), begin, end );
+        m_cachePos = end - &m_cache[ 0 ];
+        if ( end != blockEnd ) {
+            skipLineEnd();
+            if ( nullptr == continuationToken || m_line.empty() || m_line.back() != *continuationToken ) {
+                break;
             }
+            m_line.pop_back();
+        }
+        if ( m_cachePos >= m_cacheSize && !readNextBlock() ) {
+            // the last line of the file has no line end
+            break;
         }
+        begin = &m_cache[ m_cachePos ];
+        blockEnd = &m_cache[ 0 ] + m_cacheSize;
+        end = FindLineEnd( begin, blockEnd );
     }
-    buffer[i] = '\n';
-    ++m_cachePos;
+
+    length = m_line.size();
+    m_line.push_back( '\n' );
+    m_line.push_back( '\0' );
+    line = &m_line[ 0 ];
 
     return true;
 }
 
+template<class T>
+AI_FORCE_INLINE
+void IOStreamBuffer<T>::skipLineEnd() {
+    if ( m_cache[ m_cachePos ] == '\r' && m_cachePos + 1 < m_cacheSize && m_cache[ m_cachePos + 1 ] == '\n' ) {
+        ++m_cachePos;
+    }
+    ++m_cachePos;
+}
+
 template<class T>
 AI_FORCE_INLINE
 bool IOStreamBuffer<T>::getNextBlock( std::vector<T> &buffer) {
     // Return the last block-value if getNextLine was used before
-    if ( 0 != m_cachePos ) {      
-        buffer = std::vector<T>( m_cache.begin() + m_cachePos, m_cache.end() );
+    // the terminator behind the cache is left out
+    if ( 0 != m_cachePos && m_cachePos < m_cacheSize ) {
+        buffer = std::vector<T>( m_cache.begin() + m_cachePos, m_cache.end() - 1 );
         m_cachePos = 0;
     } else {
         if ( !readNextBlock() ) {
             return false;
         }
 
-        buffer = std::vector<T>(m_cache.begin(), m_cache.end());
+        buffer = std::vector<T>(m_cache.begin(), m_cache.end() - 1);
+    }
+
+    return true;
+}
+
+template<class T>
+AI_FORCE_INLINE
+bool IOStreamBuffer<T>::getNextBlockView( const T *&data, size_t &length ) {
+    if ( m_cachePos >= m_cacheSize || 0 == m_filePos ) {
+        if ( !readNextBlock() ) {
+            return false;
+        }
+    }
+
+    data = &m_cache[ m_cachePos ];
+    length = m_cacheSize - m_cachePos;
+    m_cachePos = m_cacheSize;
+
+    return true;
+}
+
+template<class T>
+AI_FORCE_INLINE
+bool IOStreamBuffer<T>::getRemainingView( const T *&data, size_t &length ) {
+    if ( nullptr == m_stream ) {
+        return false;
     }
+    stopReadAhead();
+    const uint8_t *view = m_stream->GetContiguousView();
+    if ( nullptr == view ) {
+        return false;
+    }
+
+    // file position of the cache cursor, a line read may have stepped past the block end
+    size_t pos = 0;
+    if ( 0 != m_filePos ) {
+        pos = std::min( m_filePos - m_cacheSize + m_cachePos, m_filesize );
+    }
+    data = reinterpret_cast<const T*>( view ) + pos;
+    length = m_filesize - pos;
+
+    // everything has been handed out, following reads will fail
+    m_filePos = m_filesize;
+    m_cachePos = 0;
 
     return true;
 }
 
+template<class T>
+AI_FORCE_INLINE
+void IOStreamBuffer<T>::startReadAhead() {
+    m_readAhead.reset( new ReadAhead );
+    m_readAhead->mBlocks.resize( m_readAheadDepth, std::vector<T>( m_cache.size(), '\n' ) );
+    m_readAhead->mLengths.resize( m_readAheadDepth, 0 );
+    m_readAhead->mBlockSize = m_cacheSize;
+    m_readAhead->mFilePos = m_filePos;
+    m_readAhead->mThread = std::thread( &IOStreamBuffer<T>::readAheadMain, this );
+}
+
+template<class T>
+AI_FORCE_INLINE
+void IOStreamBuffer<T>::stopReadAhead() {
+    if ( !m_readAhead ) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock( m_readAhead->mMutex );
+        m_readAhead->mStop = true;
+    }
+    m_readAhead->mCondition.notify_all();
+    m_readAhead->mThread.join();
+    m_readAhead.reset();
+}
+
+template<class T>
+AI_FORCE_INLINE
+void IOStreamBuffer<T>::readAheadMain() {
+    ReadAhead &ahead = *m_readAhead;
+    std::unique_lock<std::mutex> lock( ahead.mMutex );
+    while ( !ahead.mEnd ) {
+        ahead.mCondition.wait( lock, [&ahead] { return ahead.mStop || ahead.mFilled < ahead.mBlocks.size(); } );
+        if ( ahead.mStop ) {
+            break;
+        }
+
+        // the free slot belongs to this thread until it is marked as filled
+        const size_t slot = ( ahead.mFirst + ahead.mFilled ) % ahead.mBlocks.size();
+        const size_t filePos = ahead.mFilePos;
+        lock.unlock();
+        size_t readLen = 0;
+        std::exception_ptr error;
+        try {
+            m_stream->Seek( filePos, aiOrigin_SET );
+            readLen = m_stream->Read( &ahead.mBlocks[ slot ][ 0 ], sizeof( T ), ahead.mBlockSize );
+        } catch ( ... ) {
+            error = std::current_exception();
+        }
+        lock.lock();
+
+        if ( 0 == readLen ) {
+            ahead.mError = error;
+            ahead.mEnd = true;
+        } else {
+            ahead.mLengths[ slot ] = readLen;
+            ahead.mFilePos += readLen;
+            ++ahead.mFilled;
+            ahead.mEnd = ahead.mFilePos >= m_filesize;
+        }
+        ahead.mCondition.notify_all();
+    }
+}
+
 } // !ns Assimp
 
 #endif // AI_IOSTREAMBUFFER_H_INC
@@ -228,6 +228,16 @@ public:
 
     virtual bool DeleteFile( const std::string &file );
 
+    // -------------------------------------------------------------------
+    /** @brief Renames a file, replacing the target if it exists.
+     *  Implementations should replace the target atomically, so readers
+     *  see either the old or the new file.
+     *  @param from     [in] The file to rename.
+     *  @param to       [in] The new name of the file.
+     *  @return True, when the file was renamed successfully.
+     */
+    virtual bool RenameFile( const std::string &from, const std::string &to );
+
 private:
     std::vector<std::string> m_pathStack;
 };
@@ -356,6 +366,20 @@ bool IOSystem::DeleteFile( const std::string &file ) {
     const int retCode( ::remove( file.c_str() ) );
     return ( 0 == retCode );
 }
+
+// ----------------------------------------------------------------------------
+AI_FORCE_INLINE
+bool IOSystem::RenameFile( const std::string &from, const std::string &to ) {
+    if ( from.empty() || to.empty() ) {
+        return false;
+    }
+
+#ifdef _WIN32
+    // rename() refuses to replace an existing file here
+    ::remove( to.c_str() );
+#endif // _WIN32
+    return 0 == ::rename( from.c_str(), to.c_str() );
+}
 } //!ns Assimp
 
 #endif //AI_IOSYSTEM_H_INC
@@ -0,0 +1,243 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2021, assimp team
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+/** @file ImportLimits.h
+ *  @brief Memory budget and deadline of a running import.
+ */
+#pragma once
+#ifndef AI_IMPORTLIMITS_H_INC
+#define AI_IMPORTLIMITS_H_INC
+
+#ifdef __GNUC__
+#   pragma GCC system_header
+#endif
+
+#include <assimp/Exceptional.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace Assimp {
+
+// ----------------------------------------------------------------------------------
+/** @brief Exception thrown if an import exceeds its memory budget or deadline.
+ *
+ *  Loading APIs return nullptr then, like for any other DeadlyImportError.
+ *  Importer::GetException() carries the exception to tell both cases apart
+ *  from a malformed file. */
+class ASSIMP_API ImportLimitError : public DeadlyImportError {
+public:
+    /** The limit which was exceeded */
+    enum Kind {
+        Memory,
+        Deadline
+    };
+
+    /** Constructor with arguments */
+    template <typename... T>
+    explicit ImportLimitError(Kind kind, T &&...args) :
+            DeadlyImportError(std::forward<T>(args)...), mKind(kind) {}
+
+    /** @brief Returns the limit which was exceeded */
+    Kind GetKind() const {
+        return mKind;
+    }
+
+private:
+    Kind mKind;
+};
+
+// ----------------------------------------------------------------------------------
+/** @brief Memory budget and wall-clock deadline of an import.
+ *
+ *  The Importer activates limits on the importing thread, and on the worker
+ *  threads of post processing, while ReadFile(), ApplyPostProcessing() or
+ *  LoadMeshData() run with #AI_CONFIG_IMPORT_MAX_MEMORY or
+ *  #AI_CONFIG_IMPORT_TIMEOUT set. All scene objects and arrays count against
+ *  the budget while they are alive. Importers charge their own buffers with
+ *  a #Reservation before allocating them, so element counts read from a
+ *  file are validated, and poll the deadline in their parsing loops. The
+ *  functions do nothing if no limits are active.
+ *
+ *  Once a limit was exceeded, all further checks of the import fail as well,
+ *  so the import aborts even if a loader swallows the first exception. */
+class ASSIMP_API ImportLimits {
+public:
+    // -------------------------------------------------------------------
+    /** @brief Construction, the deadline starts running immediately.
+     *  @param maxBytes Memory budget in bytes, 0 for no limit.
+     *  @param timeoutMs Time until the deadline in milliseconds, 0 for
+     *    no deadline. */
+    ImportLimits(size_t maxBytes, unsigned int timeoutMs);
+
+    /** @brief Returns the number of bytes currently charged to the budget */
+    size_t GetUsedBytes() const;
+
+    // -------------------------------------------------------------------
+    /** @brief Activates limits on the calling thread for its lifetime.
+     *
+     *  Scopes may be nested, the previous limits are restored on
+     *  destruction. A scope for nullptr keeps the current limits. */
+    class ASSIMP_API Scope {
+    public:
+        explicit Scope(ImportLimits *limits);
+        ~Scope();
+
+    private:
+        Scope(const Scope &) = delete;
+        Scope &operator=(const Scope &) = delete;
+
+        ImportLimits *mPrevious;
+        bool mActive;
+    };
+
+    // -------------------------------------------------------------------
+    /** @brief Returns the limits active on the calling thread.
+     *  @return nullptr if the thread isn't importing or no limits are set. */
+    static ImportLimits *GetActive();
+
+    // -------------------------------------------------------------------
+    /** @brief Charges an allocation to the active budget.
+     *  @param bytes Size of the allocation.
+     *  @throw ImportLimitError if the budget is exhausted, nothing is
+     *    charged then. */
+    static void Allocate(size_t bytes);
+
+    // -------------------------------------------------------------------
+    /** @brief Returns a charged allocation to the active budget.
+     *  @param bytes Size which was passed to #Allocate(). */
+    static void Free(size_t bytes) AI_NO_EXCEPT;
+
+    // -------------------------------------------------------------------
+    /** @brief Charge of a buffer of an importer, e.g. a vector of parsed
+     *  values, for the lifetime of the reservation.
+     *
+     *  The bytes go to the limits which were active when they were charged,
+     *  and are returned only while these are still active on the releasing
+     *  thread. A reservation is used by one thread at a time. */
+    class ASSIMP_API Reservation {
+    public:
+        /** Construction, nothing is charged */
+        Reservation() AI_NO_EXCEPT;
+
+        /** Construction, charges count elements of elementSize bytes */
+        Reservation(uint64_t count, size_t elementSize);
+
+        Reservation(Reservation &&other) AI_NO_EXCEPT;
+        Reservation &operator=(Reservation &&other) AI_NO_EXCEPT;
+
+        /** Destruction, returns the charged bytes */
+        ~Reservation();
+
+        // ---------------------------------------------------------------
+        /** @brief Charges storage for more elements before it is allocated.
+         *  @param count Number of elements, e.g. read from a file.
+         *  @param elementSize Size of one element in bytes.
+         *  @throw ImportLimitError if the budget is exhausted, nothing is
+         *    charged then. DeadlyImportError if the size overflows, even
+         *    without active limits. */
+        void Add(uint64_t count, size_t elementSize);
+
+        // ---------------------------------------------------------------
+        /** @brief Adjusts the charge to the size of a buffer which grows
+         *  in small steps. The charge is rounded up to #BlockSize, so the
+         *  budget is only updated once per block.
+         *  @param bytes Current size of the buffer.
+         *  @throw ImportLimitError if the budget is exhausted. */
+        void Resize(uint64_t bytes);
+
+        // ---------------------------------------------------------------
+        /** @brief Returns all charged bytes, e.g. once the buffer was
+         *  released or handed to the scene. */
+        void Release() AI_NO_EXCEPT;
+
+        /** @brief Returns the number of charged bytes */
+        size_t GetBytes() const {
+            return mBytes;
+        }
+
+        //! Granularity of #Resize()
+        static const size_t BlockSize = 64 * 1024;
+
+    private:
+        Reservation(const Reservation &) = delete;
+        Reservation &operator=(const Reservation &) = delete;
+
+        ImportLimits *mLimits;
+        size_t mBytes;
+    };
+
+    // -------------------------------------------------------------------
+    /** @brief Checks the deadline of the active limits.
+     *  @throw ImportLimitError if it has passed. */
+    static void CheckDeadline();
+
+    // -------------------------------------------------------------------
+    /** @brief Cheap variant of #CheckDeadline() for hot loops, which only
+     *  reads the clock every few hundred calls. */
+    static void Poll();
+
+private:
+    ImportLimits(const ImportLimits &) = delete;
+    ImportLimits &operator=(const ImportLimits &) = delete;
+
+    // Charges bytes to this budget, throws if it is exhausted
+    void Charge(size_t bytes);
+
+    [[noreturn]] void Fail(ImportLimitError::Kind kind);
+
+    typedef std::chrono::steady_clock Clock;
+
+    size_t mMaxBytes;
+    unsigned int mTimeoutMs;
+    Clock::time_point mDeadline;
+
+    //! Signed since scene data allocated before the import may be freed during it
+    std::atomic<int64_t> mUsedBytes;
+    std::atomic<int> mExceeded;
+};
+
+} // namespace Assimp
+
+#endif // AI_IMPORTLIMITS_H_INC
@@ -68,6 +68,8 @@ class Importer;
 class IOStream;
 class IOSystem;
 class ProgressHandler;
+class MeshSink;
+class Allocator;
 
 // =======================================================================
 // Plugin development
@@ -363,6 +365,35 @@ public:
      */
     bool IsDefaultProgressHandler() const;
 
+    // -------------------------------------------------------------------
+    /** Supplies a sink which receives the meshes of the following
+     *  imports instead of the scene. See #MeshSink for details.
+     *  @param pSink The sink, pass nullptr to store the meshes in the
+     *    scene again. The importer does not take ownership, the sink
+     *    must stay alive as long as it is set. */
+    void SetMeshSink(MeshSink *pSink);
+
+    // -------------------------------------------------------------------
+    /** Retrieves the mesh sink that is currently set.
+     * @return The sink or nullptr if meshes are stored in the scene.
+     */
+    MeshSink *GetMeshSink() const;
+
+    // -------------------------------------------------------------------
+    /** Supplies the allocator for the scene objects created by the
+     *  following imports and post processing calls, see #Allocator.
+     *  @param pAllocator The allocator, pass nullptr to use the one bound
+     *    to the calling thread, by default the global operator new. The
+     *    importer does not take ownership, the allocator must outlive all
+     *    scenes imported with it. */
+    void SetAllocator(Allocator *pAllocator);
+
+    // -------------------------------------------------------------------
+    /** Retrieves the allocator that is currently set.
+     * @return The allocator or nullptr if none is set.
+     */
+    Allocator *GetAllocator() const;
+
     // -------------------------------------------------------------------
     /** @brief Check whether a given set of post-processing flags
      *  is supported.
@@ -468,6 +499,23 @@ public:
 
     const aiScene *ApplyCustomizedPostProcessing(BaseProcess *rootProcess, bool requestValidation);
 
+    // -------------------------------------------------------------------
+    /** @brief Loads the payload of a mesh of the current scene.
+     *
+     *  Scenes imported with #AI_CONFIG_IMPORT_DEFER_MESH_DATA may contain
+     *  meshes whose vertex and face data has not been loaded yet, see
+     *  aiMesh::HasDeferredData(). This function loads the data of one of
+     *  them from the file again. Once all meshes are loaded,
+     *  AI_SCENE_FLAGS_DEFERRED_MESH_DATA is removed from the scene.
+     *
+     *  @param meshIndex Index of the mesh in aiScene::mMeshes.
+     *  @return true if the mesh is loaded now or has been loaded before,
+     *   false if there is no such mesh or loading failed. Use
+     *   #GetErrorString() to get the reason then.
+     *  @note Deferred meshes can't be loaded anymore once the scene has
+     *   been released through #GetOrphanedScene() or #FreeScene(). */
+    bool LoadMeshData(unsigned int meshIndex);
+
     // -------------------------------------------------------------------
     /** @brief Reads the given file and returns its contents if successful.
      *
@@ -622,9 +670,21 @@ public:
      * @param in Data structure to be filled.
      * @note The returned memory statistics refer to the actual
      *   size of the use data of the aiScene. Heap-related overhead
-     *   is (naturally) not included.*/
+     *   is (naturally) not included. To measure the peak memory
+     *   used during the import, set a CountingAllocator with
+     *   #SetAllocator(), see #GetImportStatistics().*/
     void GetMemoryRequirements(aiMemoryInfo &in) const;
 
+    // -------------------------------------------------------------------
+    /** Returns the timings and counters collected during the last import.
+     *
+     * Statistics are only collected if #AI_CONFIG_GLOB_MEASURE_TIME is
+     * enabled. They cover the last call to #ReadFile() including its post
+     * processing, or the last separate call to #ApplyPostProcessing().
+     * @return nullptr if no statistics are available. The pointer stays
+     *   valid until the next import or post processing call. */
+    const aiImportStatistics *GetImportStatistics() const;
+
     // -------------------------------------------------------------------
     /** Enables "extra verbose" mode.
      *
@@ -173,8 +173,17 @@ LineSplitter& LineSplitter::operator++() {
         throw std::logic_error("End of file, no more lines to be retrieved.");
     }
 
+    // take the line up to its end in one go, only '\n' and '\r' end lines here
+    const char *begin = reinterpret_cast<const char *>(mStream.GetPtr());
+    const char *limit = begin + mStream.GetRemainingSizeToLimit();
+    const char *end = FindLineEnd(begin, limit);
+    while (end != limit && *end != '\n' && *end != '\r') {
+        end = FindLineEnd(end + 1, limit);
+    }
+    mCur.assign(begin, end);
+    mStream.IncPtr(end - begin);
+
     char s;
-    mCur.clear();
     while (mStream.GetRemainingSize() && (s = mStream.GetI1(), 1)) {
         if (s == '\n' || s == '\r') {
             if (mSkip_empty_lines) {
@@ -142,6 +142,12 @@ public:
         ai_assert(false); // won't be needed
     }
 
+    // -------------------------------------------------------------------
+    // The whole buffer is accessible without copying
+    const uint8_t *GetContiguousView() const override {
+        return buffer;
+    }
+
 private:
     const uint8_t* buffer;
     size_t length,pos;
@@ -238,6 +244,10 @@ public:
         return existing_io ? existing_io->DeleteFile(file) : false;
     }
 
+    bool RenameFile( const std::string &from, const std::string &to ) override {
+        return existing_io ? existing_io->RenameFile(from, to) : false;
+    }
+
 private:
     const uint8_t* buffer;
     size_t length;
@@ -0,0 +1,140 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2021, assimp team
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file MemoryMappedIOSystem.h
+ *  @brief IOSystem implementation which maps files into memory instead of reading them.
+ */
+#pragma once
+#ifndef AI_MEMORYMAPPEDIOSYSTEM_H_INC
+#define AI_MEMORYMAPPEDIOSYSTEM_H_INC
+
+#ifdef __GNUC__
+#   pragma GCC system_header
+#endif
+
+#include <assimp/DefaultIOSystem.h>
+#include <assimp/IOStream.hpp>
+
+#include <string>
+
+namespace Assimp {
+
+// ----------------------------------------------------------------------------------
+//! @class  MemoryMappedIOStream
+//! @brief  Read-only stream on top of a memory mapped file.
+//!
+//! The whole file is accessible through GetContiguousView(), Read() is a plain
+//! memcpy out of the mapping. Instances are created by MemoryMappedIOSystem.
+class ASSIMP_API MemoryMappedIOStream : public IOStream {
+    friend class MemoryMappedIOSystem;
+
+protected:
+    MemoryMappedIOStream(const uint8_t *data, size_t length, const std::string &filename);
+
+public:
+    /** Destructor public to allow simple deletion to unmap the file. */
+    ~MemoryMappedIOStream();
+
+    // -------------------------------------------------------------------
+    /// Read from stream
+    size_t Read(void *pvBuffer, size_t pSize, size_t pCount) override;
+
+    // -------------------------------------------------------------------
+    /// Write to stream, always fails since the mapping is read-only
+    size_t Write(const void *pvBuffer, size_t pSize, size_t pCount) override;
+
+    // -------------------------------------------------------------------
+    /// Seek specific position
+    aiReturn Seek(size_t pOffset, aiOrigin pOrigin) override;
+
+    // -------------------------------------------------------------------
+    /// Get current seek position
+    size_t Tell() const override;
+
+    // -------------------------------------------------------------------
+    /// Get size of file
+    size_t FileSize() const override;
+
+    // -------------------------------------------------------------------
+    /// Flush file contents, nothing to do for read-only mappings
+    void Flush() override;
+
+    // -------------------------------------------------------------------
+    /// Returns the start of the mapping
+    const uint8_t *GetContiguousView() const override;
+
+private:
+    const uint8_t *mData;
+    size_t mLength;
+    size_t mPos;
+    std::string mFilename;
+};
+
+// ---------------------------------------------------------------------------
+/** @brief IOSystem which memory maps files opened for reading.
+ *
+ *  Files opened in a read mode are mapped into the address space, so importers
+ *  supporting IOStream::GetContiguousView() can work on the file contents
+ *  without copying them into a heap buffer first. Files opened for writing,
+ *  empty files and files which cannot be mapped are handled by the
+ *  DefaultIOSystem.
+ *
+ *  Usage:
+ *  @code
+ *  Assimp::Importer importer;
+ *  importer.SetIOHandler(new Assimp::MemoryMappedIOSystem);
+ *  @endcode
+ */
+class ASSIMP_API MemoryMappedIOSystem : public DefaultIOSystem {
+public:
+    // -------------------------------------------------------------------
+    /** Open a new file with a given path. */
+    IOStream *Open(const char *pFile, const char *pMode = "rb") override;
+
+    // -------------------------------------------------------------------
+    /** Closes the given file and releases all resources associated with it. */
+    void Close(IOStream *pFile) override;
+};
+
+} // namespace Assimp
+
+#endif // AI_MEMORYMAPPEDIOSYSTEM_H_INC
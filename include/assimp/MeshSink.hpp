@@ -0,0 +1,119 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2021, assimp team
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file MeshSink.hpp
+ *  @brief Abstract base class 'MeshSink'.
+ */
+#pragma once
+#ifndef AI_MESHSINK_H_INC
+#define AI_MESHSINK_H_INC
+
+#ifdef __GNUC__
+#   pragma GCC system_header
+#endif
+
+#include <assimp/types.h>
+
+struct aiMesh;
+
+namespace Assimp {
+
+// ------------------------------------------------------------------------------------
+/** @brief CPP-API: Abstract interface for receivers of streamed meshes.
+ *
+ *  If an #Importer has a #MeshSink, the meshes of the imported file are
+ *  handed to the sink instead of being stored in the scene. How much of the
+ *  file is held in memory at once depends on the importer:
+ *
+ *  - Binary STL and PLY point clouds (vertices without faces) are handed
+ *    over in chunks of at most #AI_CONFIG_IMPORT_MESH_SINK_CHUNK_SIZE
+ *    vertices while the file is read, each chunk as soon as it is complete.
+ *    Only these imports run in bounded memory.
+ *  - ASCII STL keeps the text of the file and hands over each solid once it
+ *    is parsed.
+ *  - PLY meshes with faces are handed over as a whole once the file is read.
+ *  - All other importers, OBJ among them, hand over their meshes once the
+ *    file is read. OBJ faces may refer to any vertex read before them, so
+ *    nothing of an OBJ file can be handed over earlier.
+ *
+ *  The scene returned by #Importer::ReadFile() then contains no meshes, the
+ *  nodes don't refer to any and #AI_SCENE_FLAGS_INCOMPLETE is set. Streamed
+ *  meshes don't pass through the post processing steps. */
+class ASSIMP_API MeshSink
+#ifndef SWIG
+    : public Intern::AllocateFromAssimpHeap
+#endif
+{
+protected:
+    /// @brief  Default constructor
+    MeshSink() AI_NO_EXCEPT {
+        // empty
+    }
+
+public:
+    /// @brief  Virtual destructor.
+    virtual ~MeshSink() {
+    }
+
+    // -------------------------------------------------------------------
+    /** @brief Receives a mesh or a chunk of a mesh.
+     *  @param mesh A self-contained mesh, its faces refer to its own
+     *    vertices. The sink takes ownership and releases it with delete
+     *    once it is done with the data.
+     *  @param meshIndex Index of the mesh of the file the data belongs
+     *    to. All chunks of a mesh share the same index, the indices of
+     *    a file count up from zero.
+     *
+     *  The callback runs on the importing thread. No non-const
+     *  #Importer methods may be called from it.
+     *
+     *  @return Return false to abort loading, #Importer::ReadFile()
+     *    returns nullptr then.
+     */
+    virtual bool Consume(aiMesh *mesh, unsigned int meshIndex) = 0;
+}; // !class MeshSink
+
+// ------------------------------------------------------------------------------------
+
+} // Namespace Assimp
+
+#endif // AI_MESHSINK_H_INC
@@ -57,6 +57,20 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <vector>
 #include <algorithm>
 
+#ifdef _MSC_VER
+#   include <intrin.h>
+#endif
+
+// SSE2 is part of every x86-64 CPU, AVX2 is used if the build targets it
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#   define AI_PARSING_UTILS_SSE2
+#   include <emmintrin.h>
+#endif
+#ifdef __AVX2__
+#   define AI_PARSING_UTILS_AVX2
+#   include <immintrin.h>
+#endif
+
 namespace Assimp {
 
 // NOTE: the functions below are mostly intended as replacement for
@@ -101,6 +115,76 @@ AI_FORCE_INLINE bool IsSpaceOrNewLine(char_t in) {
     return IsSpace<char_t>(in) || IsLineEnd<char_t>(in);
 }
 
+// ---------------------------------------------------------------------------------
+/** Returns the first line end character of [in, end), or end if there is none. */
+template <class char_t>
+AI_FORCE_INLINE const char_t *FindLineEnd(const char_t *in, const char_t *end) {
+    while (in != end && !IsLineEnd<char_t>(*in)) {
+        ++in;
+    }
+    return in;
+}
+
+//! @cond never
+namespace Intern {
+
+// ---------------------------------------------------------------------------------
+// Returns the index of the lowest set bit, mask must not be zero.
+AI_FORCE_INLINE unsigned int LowestSetBit(unsigned int mask) {
+#if defined(__GNUC__)
+    return static_cast<unsigned int>(__builtin_ctz(mask));
+#elif defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return static_cast<unsigned int>(index);
+#else
+    unsigned int n = 0;
+    while (!(mask & (1u << n))) {
+        ++n;
+    }
+    return n;
+#endif
+}
+
+} // namespace Intern
+//! @endcond
+
+// ---------------------------------------------------------------------------------
+/** Character version of FindLineEnd(), which looks at 32 (AVX2) or 16 (SSE2)
+ *  characters at once. */
+inline const char *FindLineEnd(const char *in, const char *end) {
+#ifdef AI_PARSING_UTILS_AVX2
+    while (end - in >= 32) {
+        const __m256i chars = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(in));
+        const __m256i lineEnds = _mm256_or_si256(
+                _mm256_or_si256(_mm256_cmpeq_epi8(chars, _mm256_set1_epi8('\n')), _mm256_cmpeq_epi8(chars, _mm256_set1_epi8('\r'))),
+                _mm256_or_si256(_mm256_cmpeq_epi8(chars, _mm256_setzero_si256()), _mm256_cmpeq_epi8(chars, _mm256_set1_epi8('\f'))));
+        const unsigned int mask = static_cast<unsigned int>(_mm256_movemask_epi8(lineEnds));
+        if (0 != mask) {
+            return in + Intern::LowestSetBit(mask);
+        }
+        in += 32;
+    }
+#endif
+#ifdef AI_PARSING_UTILS_SSE2
+    while (end - in >= 16) {
+        const __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in));
+        const __m128i lineEnds = _mm_or_si128(
+                _mm_or_si128(_mm_cmpeq_epi8(chars, _mm_set1_epi8('\n')), _mm_cmpeq_epi8(chars, _mm_set1_epi8('\r'))),
+                _mm_or_si128(_mm_cmpeq_epi8(chars, _mm_setzero_si128()), _mm_cmpeq_epi8(chars, _mm_set1_epi8('\f'))));
+        const unsigned int mask = static_cast<unsigned int>(_mm_movemask_epi8(lineEnds));
+        if (0 != mask) {
+            return in + Intern::LowestSetBit(mask);
+        }
+        in += 16;
+    }
+#endif
+    while (in != end && !IsLineEnd(*in)) {
+        ++in;
+    }
+    return in;
+}
+
 // ---------------------------------------------------------------------------------
 template <class char_t>
 AI_FORCE_INLINE bool SkipSpaces(const char_t *in, const char_t **out) {
@@ -52,10 +52,12 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #endif
 
 #include <chrono>
+#include <assimp/Allocator.h>
 #include <assimp/DefaultLogger.hpp>
 #include <assimp/TinyFormatter.h>
 
-#include <map>
+#include <string>
+#include <vector>
 
 namespace Assimp {
 namespace Profiling {
@@ -63,41 +65,161 @@ namespace Profiling {
 using namespace Formatter;
 
 // ------------------------------------------------------------------------------------------------
-/** Simple wrapper around boost::timer to simplify reporting. Timings are automatically
- *  dumped to the log file.
+/** Hierarchical profiler based on a monotonic clock. Regions may be nested, every region
+ *  begun while another one is open becomes its child. All timings are kept for later
+ *  queries and are also dumped to the log file. If a CountingAllocator is given, the
+ *  memory allocated in each region is recorded, too.
  */
 class Profiler {
 public:
-    Profiler() {
+    /** A finished or still open region */
+    struct Region {
+        /** Name passed to BeginRegion() */
+        std::string mName;
+        /** Elapsed time in seconds, 0 while the region is open */
+        double mSeconds;
+        /** Index of the enclosing region, -1 for top-level regions */
+        int mParent;
+        /** Nesting depth, 0 for top-level regions */
+        unsigned int mDepth;
+        /** Bytes allocated while the region was open */
+        size_t mAllocatedBytes;
+        /** Peak of the bytes in use while the region was open */
+        size_t mPeakBytes;
+        /** True for regions of post processing steps which ran fused with
+         *  others, see AddRegion(). mSeconds is summed over all threads. */
+        bool mFused;
+    };
+
+    Profiler() :
+            mAllocator(nullptr) {
         // empty
     }
 
+    /** Set the allocator to read the memory counters from, nullptr to not record them.
+     *  Must not be changed while regions are open. */
+    void SetAllocator(CountingAllocator* allocator) {
+        mAllocator = allocator;
+    }
 
-    /** Start a named timer */
+    /** Start a named timer, nested into the innermost open one */
     void BeginRegion(const std::string& region) {
-        regions[region] = std::chrono::system_clock::now();
+        mRegions.push_back(MakeRegion(region));
+
+        OpenRegion open;
+        open.mIndex = mRegions.size() - 1;
+        open.mTotalBytes = mAllocator ? mAllocator->GetTotalBytes() : 0;
+        open.mOuterPeak = mAllocator ? mAllocator->ResetPeak() : 0;
+        open.mStart = Clock::now();
+        mOpen.push_back(open);
         ASSIMP_LOG_DEBUG("START `",region,"`");
     }
 
-
-    /** End a specific named timer and write its end time to the log */
+    /** End a specific named timer and write its end time to the log. Regions nested into
+     *  it which are still open, e.g. because an exception skipped their end, are ended, too. */
     void EndRegion(const std::string& region) {
-        RegionMap::const_iterator it = regions.find(region);
-        if (it == regions.end()) {
+        size_t open = mOpen.size();
+        while (open > 0 && mRegions[mOpen[open - 1].mIndex].mName != region) {
+            --open;
+        }
+        if (0 == open) {
             return;
         }
 
-        std::chrono::duration<double> elapsedSeconds = std::chrono::system_clock::now() - regions[region];
-        ASSIMP_LOG_DEBUG("END   `",region,"`, dt= ", elapsedSeconds.count()," s");
+        const Clock::time_point now = Clock::now();
+        while (mOpen.size() >= open) {
+            const OpenRegion &o = mOpen.back();
+            Region &r = mRegions[o.mIndex];
+            r.mSeconds = std::chrono::duration<double>(now - o.mStart).count();
+            if (mAllocator) {
+                // the peak of the enclosing region includes this one
+                r.mAllocatedBytes = mAllocator->GetTotalBytes() - o.mTotalBytes;
+                r.mPeakBytes = mAllocator->GetPeakBytes();
+                mAllocator->RaisePeak(o.mOuterPeak);
+            }
+            mOpen.pop_back();
+            ASSIMP_LOG_DEBUG("END   `",r.mName,"`, dt= ", r.mSeconds," s");
+        }
+    }
+
+    /** Add a region measured elsewhere as child of the innermost open region and write
+     *  its time to the log, e.g. of post processing steps which ran fused with others */
+    void AddRegion(const std::string& region, double seconds) {
+        mRegions.push_back(MakeRegion(region));
+        mRegions.back().mSeconds = seconds;
+        mRegions.back().mFused = true;
+        ASSIMP_LOG_DEBUG("END   `",region,"`, dt= ", seconds," s");
+    }
+
+    /** Get all regions in the order they were begun, parents precede their children */
+    const std::vector<Region>& GetRegions() const {
+        return mRegions;
+    }
+
+private:
+    typedef std::chrono::steady_clock Clock;
+
+    struct OpenRegion {
+        size_t mIndex;
+        Clock::time_point mStart;
+        size_t mTotalBytes;
+        size_t mOuterPeak;
+    };
+
+    Region MakeRegion(const std::string& region) const {
+        Region r;
+        r.mName = region;
+        r.mSeconds = 0.0;
+        r.mParent = mOpen.empty() ? -1 : static_cast<int>(mOpen.back().mIndex);
+        r.mDepth = static_cast<unsigned int>(mOpen.size());
+        r.mAllocatedBytes = 0;
+        r.mPeakBytes = 0;
+        r.mFused = false;
+        return r;
+    }
+
+    std::vector<Region> mRegions;
+    std::vector<OpenRegion> mOpen;
+    CountingAllocator* mAllocator;
+};
+
+// ------------------------------------------------------------------------------------------------
+/** Begins a region on construction and ends it on destruction. Consecutive phases can
+ *  share one instance, see Next(). Does nothing if no profiler is given, so it can be
+ *  used unconditionally. */
+class ScopedRegion {
+public:
+    ScopedRegion(Profiler* profiler, const char* region) :
+            mProfiler(profiler), mRegion(region) {
+        if (mProfiler) {
+            mProfiler->BeginRegion(mRegion);
+        }
+    }
+
+    ~ScopedRegion() {
+        if (mProfiler) {
+            mProfiler->EndRegion(mRegion);
+        }
+    }
+
+    /** End the current region and begin the next one */
+    void Next(const char* region) {
+        if (mProfiler) {
+            mProfiler->EndRegion(mRegion);
+            mProfiler->BeginRegion(region);
+        }
+        mRegion = region;
     }
 
 private:
-    typedef std::map<std::string,std::chrono::time_point<std::chrono::system_clock>> RegionMap;
-    RegionMap regions;
+    ScopedRegion(const ScopedRegion&) = delete;
+    ScopedRegion& operator=(const ScopedRegion&) = delete;
+
+    Profiler* mProfiler;
+    const char* mRegion;
 };
 
 }
 }
 
 #endif // AI_INCLUDED_PROFILER_H
-
@@ -77,6 +77,8 @@ struct aiMeshMorphAnim;
 
 namespace Assimp {
 
+class TaskScheduler;
+
 // ---------------------------------------------------------------------------
 /** \brief Helper data structure for SceneCombiner.
  *
@@ -141,6 +143,15 @@ struct NodeAttachmentInfo {
  */
 #define AI_INT_MERGE_SCENE_GEN_UNIQUE_NAMES_IF_NECESSARY 0x10
 
+// ---------------------------------------------------------------------------
+/** @def AI_INT_COPY_SCENE_SHARE_MESH_DATA
+ *  Let the meshes of the copy borrow the vertex and face arrays of the
+ *  source scene instead of copying them. The source must outlive the copy
+ *  and its arrays must not change meanwhile. Code that modifies the
+ *  meshes of the copy calls SceneCombiner::MakeMeshDataUnique() first.
+ */
+#define AI_INT_COPY_SCENE_SHARE_MESH_DATA 0x2
+
 typedef std::pair<aiBone *, unsigned int> BoneSrcIndex;
 
 // ---------------------------------------------------------------------------
@@ -328,8 +339,13 @@ public:
      *
      *  @param dest Receives a pointer to the destination scene
      *  @param src Source scene - remains unmodified.
+     *  @param allocate Allocate a new scene or fill the one *dest points to
+     *  @param flags Combination of the AI_INT_COPY_SCENE_XXX flags
+     *  @param scheduler If not nullptr, meshes, materials, animations and
+     *    textures are copied on its threads
      */
-    static void CopyScene(aiScene **dest, const aiScene *source, bool allocate = true);
+    static void CopyScene(aiScene **dest, const aiScene *source, bool allocate = true,
+            unsigned int flags = 0, TaskScheduler *scheduler = nullptr);
 
     // -------------------------------------------------------------------
     /** Get a flat copy of a scene
@@ -351,6 +367,34 @@ public:
      */
     static void Copy(aiMesh **dest, const aiMesh *src);
 
+    // -------------------------------------------------------------------
+    /** Get a copy of a mesh which shares the vertex and face arrays of
+     *  the source. Bones and blend shapes are copied.
+     *
+     *  The copy must be registered with the private data of its scene,
+     *  see #AI_INT_COPY_SCENE_SHARE_MESH_DATA.
+     *  @param dest Receives a pointer to the destination mesh
+     *  @param src Source mesh - remains unmodified.
+     */
+    static void CopyShared(aiMesh **dest, const aiMesh *src);
+
+    // -------------------------------------------------------------------
+    /** Give all meshes of a scene made with
+     *  #AI_INT_COPY_SCENE_SHARE_MESH_DATA their own copies of the
+     *  vertex and face arrays. Does nothing for other scenes.
+     *
+     *  @param scene Scene to be modified
+     *  @param scheduler If not nullptr, the meshes are copied on its threads
+     */
+    static void MakeMeshDataUnique(aiScene *scene, TaskScheduler *scheduler = nullptr);
+
+    // -------------------------------------------------------------------
+    /** Reset the borrowed arrays of all meshes of a shared copy, so
+     *  deleting them doesn't free the data of the source scene.
+     *  Called by the destructor of aiScene.
+     */
+    static void DetachSharedMeshData(aiScene *scene);
+
     // similar to Copy():
     static void Copy(aiAnimMesh **dest, const aiAnimMesh *src);
     static void Copy(aiMaterial **dest, const aiMaterial *src);
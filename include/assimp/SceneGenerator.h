@@ -0,0 +1,131 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2021, assimp team
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+/** @file SceneGenerator.h
+ *  @brief Declares a helper class which builds large synthetic scenes
+ *  for benchmarks and stress tests.
+ */
+#pragma once
+#ifndef AI_SCENE_GENERATOR_H_INC
+#define AI_SCENE_GENERATOR_H_INC
+
+#ifdef __GNUC__
+#   pragma GCC system_header
+#endif
+
+#include <assimp/defs.h>
+
+#include <stdint.h>
+
+struct aiScene;
+
+namespace Assimp {
+
+// ---------------------------------------------------------------------------
+/** @brief Builds parameterized synthetic scenes of arbitrary size.
+ *
+ *  Every mesh is a unit sphere from StandardShapes, cut to the requested
+ *  number of triangles and displaced by a few waves, with normals and
+ *  texture coordinates. The meshes hang off a chain of nested nodes, each
+ *  one may carry a skeleton, and an animation can move the bones (or the
+ *  mesh nodes if there are no bones). Pass the result to the Exporter to
+ *  get OBJ, PLY, STL, glTF2, FBX or Collada files of any size.
+ *
+ *  The same parameters always give the same scene on the same build, all
+ *  random numbers come from the seed. The scene is built in memory, so it
+ *  needs roughly as much memory as the exported file.
+ */
+class ASSIMP_API SceneGenerator {
+public:
+    // -------------------------------------------------------------------
+    /** @brief Parameters of a generated scene */
+    struct Params {
+        /** Number of meshes, each one has its own node */
+        unsigned int mNumMeshes;
+
+        /** Number of triangles per mesh, at most MaxTrianglesPerMesh */
+        unsigned int mNumTriangles;
+
+        /** Number of nested nodes below the root the meshes are spread over */
+        unsigned int mNodeDepth;
+
+        /** Number of bones per mesh, 0 for no skeletons */
+        unsigned int mNumBones;
+
+        /** Number of keys per animation channel, 0 for no animation */
+        unsigned int mNumKeys;
+
+        /** Number of materials, used round-robin by the meshes */
+        unsigned int mNumMaterials;
+
+        /** Seed of all random numbers */
+        uint32_t mSeed;
+
+        Params() :
+                mNumMeshes(1),
+                mNumTriangles(1024),
+                mNodeDepth(1),
+                mNumBones(0),
+                mNumKeys(0),
+                mNumMaterials(1),
+                mSeed(1) {
+            // empty
+        }
+    };
+
+    /** Largest number of triangles a single mesh can have */
+    static const unsigned int MaxTrianglesPerMesh = 8u << 22;
+
+    // -------------------------------------------------------------------
+    /** @brief Build a scene.
+     *
+     *  @param params Size and content of the scene
+     *  @return A new scene, delete it when done. */
+    static aiScene *Generate(const Params &params);
+
+private:
+    SceneGenerator() = delete;
+};
+
+} // namespace Assimp
+
+#endif // AI_SCENE_GENERATOR_H_INC
@@ -56,6 +56,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/types.h>
 
 #ifdef __cplusplus
+#   include <assimp/Allocator.h>
 extern "C" {
 #endif
 
@@ -69,6 +70,7 @@ struct aiVectorKey {
     C_STRUCT aiVector3D mValue;
 
 #ifdef __cplusplus
+    AI_SCENE_ARRAY_ALLOCATION_OPERATORS
 
     /// @brief  The default constructor.
     aiVectorKey() AI_NO_EXCEPT
@@ -115,6 +117,8 @@ struct aiQuatKey {
     C_STRUCT aiQuaternion mValue;
 
 #ifdef __cplusplus
+    AI_SCENE_ARRAY_ALLOCATION_OPERATORS
+
     aiQuatKey() AI_NO_EXCEPT
             : mTime(0.0),
               mValue() {
@@ -158,6 +162,7 @@ struct aiMeshKey {
     unsigned int mValue;
 
 #ifdef __cplusplus
+    AI_SCENE_ARRAY_ALLOCATION_OPERATORS
 
     aiMeshKey() AI_NO_EXCEPT
             : mTime(0.0),
@@ -202,6 +207,8 @@ struct aiMeshMorphKey {
     /** The number of values and weights */
     unsigned int mNumValuesAndWeights;
 #ifdef __cplusplus
+    AI_SCENE_ARRAY_ALLOCATION_OPERATORS
+
     aiMeshMorphKey() AI_NO_EXCEPT
             : mTime(0.0),
               mValues(nullptr),
@@ -211,8 +218,8 @@ struct aiMeshMorphKey {
 
     ~aiMeshMorphKey() {
         if (mNumValuesAndWeights && mValues && mWeights) {
-            delete[] mValues;
-            delete[] mWeights;
+            Assimp::FreeSceneArray(mValues);
+            Assimp::FreeSceneArray(mWeights);
         }
     }
 #endif
@@ -312,6 +319,8 @@ struct aiNodeAnim {
     C_ENUM aiAnimBehaviour mPostState;
 
 #ifdef __cplusplus
+    AI_SCENE_ALLOCATION_OPERATORS
+
     aiNodeAnim() AI_NO_EXCEPT
             : mNumPositionKeys(0),
               mPositionKeys(nullptr),
@@ -353,6 +362,8 @@ struct aiMeshAnim {
 
 #ifdef __cplusplus
 
+    AI_SCENE_ALLOCATION_OPERATORS
+
     aiMeshAnim() AI_NO_EXCEPT
             : mNumKeys(),
               mKeys() {}
@@ -381,6 +392,8 @@ struct aiMeshMorphAnim {
 
 #ifdef __cplusplus
 
+    AI_SCENE_ALLOCATION_OPERATORS
+
     aiMeshMorphAnim() AI_NO_EXCEPT
             : mNumKeys(),
               mKeys() {}
@@ -432,6 +445,8 @@ struct aiAnimation {
     C_STRUCT aiMeshMorphAnim **mMorphMeshChannels;
 
 #ifdef __cplusplus
+    AI_SCENE_ALLOCATION_OPERATORS
+
     aiAnimation() AI_NO_EXCEPT
             : mDuration(-1.),
               mTicksPerSecond(0.),
@@ -451,21 +466,21 @@ struct aiAnimation {
                 delete mChannels[a];
             }
 
-            delete[] mChannels;
+            Assimp::FreeSceneArray(mChannels);
         }
         if (mNumMeshChannels && mMeshChannels) {
             for (unsigned int a = 0; a < mNumMeshChannels; a++) {
                 delete mMeshChannels[a];
             }
 
-            delete[] mMeshChannels;
+            Assimp::FreeSceneArray(mMeshChannels);
         }
         if (mNumMorphMeshChannels && mMorphMeshChannels) {
             for (unsigned int a = 0; a < mNumMorphMeshChannels; a++) {
                 delete mMorphMeshChannels[a];
             }
 
-            delete[] mMorphMeshChannels;
+            Assimp::FreeSceneArray(mMorphMeshChannels);
         }
     }
 #endif // __cplusplus
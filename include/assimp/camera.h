@@ -183,6 +183,8 @@ struct aiCamera
     float mOrthographicWidth;
 #ifdef __cplusplus
 
+    AI_SCENE_ALLOCATION_OPERATORS
+
     aiCamera() AI_NO_EXCEPT
         : mUp                (0.f,1.f,0.f)
         , mLookAt            (0.f,0.f,1.f)
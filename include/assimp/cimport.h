@@ -373,6 +373,17 @@ ASSIMP_API void aiGetMemoryRequirements(
         const C_STRUCT aiScene *pIn,
         C_STRUCT aiMemoryInfo *in);
 
+// --------------------------------------------------------------------------------
+/** Get the timings and counters collected while importing an asset.
+ *
+ * Statistics are only collected if #AI_CONFIG_GLOB_MEASURE_TIME is enabled.
+ * @param pIn Input asset.
+ * @return The statistics, NULL if none are available. The data is owned by
+ *   the asset and released by aiReleaseImport().
+ */
+ASSIMP_API const C_STRUCT aiImportStatistics *aiGetImportStatistics(
+        const C_STRUCT aiScene *pIn);
+
 // --------------------------------------------------------------------------------
 /** Create an empty property store. Property stores are used to collect import
  *  settings.
@@ -55,6 +55,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #ifdef __cplusplus
 
+#include <assimp/Allocator.h>
+
 // ----------------------------------------------------------------------------------
 /** Represents a color in Red-Green-Blue space including an
 *   alpha component. Color values range from 0 to 1. */
@@ -62,6 +64,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 template <typename TReal>
 class aiColor4t {
 public:
+    AI_SCENE_ARRAY_ALLOCATION_OPERATORS
+
     aiColor4t() AI_NO_EXCEPT : r(), g(), b(), a() {}
     aiColor4t (TReal _r, TReal _g, TReal _b, TReal _a)
         : r(_r), g(_g), b(_b), a(_a) {}
@@ -33,10 +33,17 @@
 
 #ifdef _MSC_VER
 #  include <stdint.h>
+#  include <intrin.h>
 #else
 #  include <assimp/Compiler/pstdint.h>
 #endif
 
+// SSE2 is part of every x86-64 CPU, 32 bit builds need to enable it explicitly
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#  define AI_FAST_ATOF_SSE2
+#  include <emmintrin.h>
+#endif
+
 namespace Assimp {
 
 const double fast_atof_table[16] =  {  // we write [16] here instead of [] to work around a swig bug
@@ -380,6 +387,183 @@ ai_real fast_atof( const char** inout) {
     return ret;
 }
 
+//! @cond never
+namespace Intern {
+
+// ------------------------------------------------------------------------------------
+// Bit masks of the character classes in a block of 16 characters, bit i
+// corresponds to the i-th character.
+struct RealCharClasses {
+    unsigned int digits;
+    unsigned int spaces;
+    unsigned int lineEnds;
+};
+
+// ------------------------------------------------------------------------------------
+// Classifies 16 characters at once, c[0..15] must be readable.
+inline
+void ClassifyRealChars(const char* c, RealCharClasses& out) {
+#ifdef AI_FAST_ATOF_SSE2
+    const __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(c));
+
+    // c - '0' wraps around for all characters below '0', so an unsigned
+    // comparison with 9 finds the digits
+    const __m128i offset = _mm_sub_epi8(chars, _mm_set1_epi8('0'));
+    out.digits = static_cast<unsigned int>(_mm_movemask_epi8(
+            _mm_cmpeq_epi8(_mm_min_epu8(offset, _mm_set1_epi8(9)), offset)));
+    out.spaces = static_cast<unsigned int>(_mm_movemask_epi8(_mm_or_si128(
+            _mm_cmpeq_epi8(chars, _mm_set1_epi8(' ')),
+            _mm_cmpeq_epi8(chars, _mm_set1_epi8('\t')))));
+    out.lineEnds = static_cast<unsigned int>(_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(
+            _mm_cmpeq_epi8(chars, _mm_set1_epi8('\n')),
+            _mm_cmpeq_epi8(chars, _mm_set1_epi8('\r'))),
+            _mm_cmpeq_epi8(chars, _mm_set1_epi8('\f')))));
+#else
+    out.digits = out.spaces = out.lineEnds = 0;
+    for (unsigned int i = 0; i < 16; ++i) {
+        out.digits |= static_cast<unsigned int>(c[i] >= '0' && c[i] <= '9') << i;
+        out.spaces |= static_cast<unsigned int>(c[i] == ' ' || c[i] == '\t') << i;
+        out.lineEnds |= static_cast<unsigned int>(c[i] == '\n' || c[i] == '\r' || c[i] == '\f') << i;
+    }
+#endif
+}
+
+// ------------------------------------------------------------------------------------
+// Returns the number of consecutive set bits of a 16 bit mask, starting at bit 0.
+inline
+unsigned int CountLeadingMatches(unsigned int mask) {
+    const unsigned int rest = ~mask | 0x10000u;
+#if defined(__GNUC__)
+    return static_cast<unsigned int>(__builtin_ctz(rest));
+#elif defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, rest);
+    return static_cast<unsigned int>(index);
+#else
+    unsigned int n = 0;
+    while (!(rest & (1u << n))) {
+        ++n;
+    }
+    return n;
+#endif
+}
+
+// ------------------------------------------------------------------------------------
+// Parses a plain decimal number without exponent which is followed by whitespace,
+// the layout of the number is found by classifying 16 characters at once. The
+// arithmetic is the same as in fast_atoreal_move(), so are the results.
+// Returns false if the number needs the generic parser.
+template<typename Real>
+inline
+bool fast_atoreal_simple(const char*& c, const char* end, Real& out) {
+    const char* p = c;
+    const bool inv = (*p == '-');
+    if (inv || *p == '+') {
+        ++p;
+    }
+    if (end - p < 16) {
+        return false;
+    }
+
+    RealCharClasses classes;
+    ClassifyRealChars(p, classes);
+
+    const unsigned int intLength = CountLeadingMatches(classes.digits);
+    unsigned int fracLength = 0, length = intLength;
+    if (intLength < 16 && p[intLength] == '.') {
+        fracLength = CountLeadingMatches(classes.digits >> (intLength + 1));
+        length = intLength + 1 + fracLength;
+    }
+    if (0 == intLength + fracLength || length >= 16 ||
+            !(((classes.spaces | classes.lineEnds) >> length) & 1u)) {
+        return false;
+    }
+
+    uint64_t intValue = 0;
+    for (unsigned int i = 0; i < intLength; ++i) {
+        intValue = intValue * 10 + static_cast<unsigned int>(p[i] - '0');
+    }
+    Real f = static_cast<Real>(intValue);
+
+    if (fracLength) {
+        uint64_t fracValue = 0;
+        for (const char* d = p + intLength + 1; d != p + length; ++d) {
+            fracValue = fracValue * 10 + static_cast<unsigned int>(*d - '0');
+        }
+        f += static_cast<Real>(static_cast<double>(fracValue) * fast_atof_table[fracLength]);
+    }
+
+    out = inv ? -f : f;
+    c = p + length;
+    return true;
+}
+
+// ------------------------------------------------------------------------------------
+// Checks whether a token can be parsed by fast_atoreal_move()
+inline
+bool IsRealStart(const char* c, const char* end) {
+    if ((*c >= '0' && *c <= '9') || *c == '-' || *c == '+' || *c == '.') {
+        return true;
+    }
+    return end - c >= 3 && (ASSIMP_strincmp(c, "nan", 3) == 0 || ASSIMP_strincmp(c, "inf", 3) == 0);
+}
+
+} // namespace Intern
+//! @endcond
+
+// ------------------------------------------------------------------------------------
+/** Parses a whitespace-separated run of real numbers into an array.
+ *
+ *  Plain decimal numbers are located 16 characters at a time, numbers with
+ *  exponents, decimal commas or many digits as well as the last few numbers
+ *  of the range go through fast_atoreal_move(). The results are identical.
+ *  Parsing stops at the first token which doesn't start like a number.
+ *  @param c          Start of the range, behind the last parsed number on return.
+ *  @param end        End of the range. The character at end must not continue a
+ *                    number, e.g. the terminating zero or a line end.
+ *  @param out        Receives the numbers.
+ *  @param maxCount   Capacity of out.
+ *  @param multiLine  Whether line ends separate numbers as well. Otherwise
+ *                    parsing stops at the end of the line.
+ *  @return Number of numbers written to out. */
+// ------------------------------------------------------------------------------------
+template<typename Real, typename ExceptionType = DeadlyImportError>
+inline
+size_t fast_atoreal_array(const char*& c, const char* end, Real* out, size_t maxCount, bool multiLine = true) {
+    size_t count = 0;
+    const char* cur = c;
+    while (count < maxCount) {
+        // skip the separators, 16 characters at a time while possible
+        while (cur != end) {
+            if (end - cur >= 16) {
+                Intern::RealCharClasses classes;
+                Intern::ClassifyRealChars(cur, classes);
+                const unsigned int skip = Intern::CountLeadingMatches(
+                        classes.spaces | (multiLine ? classes.lineEnds : 0u));
+                cur += skip;
+                if (skip < 16) {
+                    break;
+                }
+            } else if (*cur == ' ' || *cur == '\t' ||
+                    (multiLine && (*cur == '\n' || *cur == '\r' || *cur == '\f'))) {
+                ++cur;
+            } else {
+                break;
+            }
+        }
+        if (cur == end || !Intern::IsRealStart(cur, end)) {
+            break;
+        }
+
+        if (!Intern::fast_atoreal_simple<Real>(cur, end, out[count])) {
+            cur = fast_atoreal_move<Real, ExceptionType>(cur, out[count]);
+        }
+        c = cur;
+        ++count;
+    }
+    return count;
+}
+
 } //! namespace Assimp
 
 #endif // FAST_A_TO_F_H_INCLUDED
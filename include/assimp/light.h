@@ -241,6 +241,8 @@ struct aiLight
 
 #ifdef __cplusplus
 
+    AI_SCENE_ALLOCATION_OPERATORS
+
     aiLight() AI_NO_EXCEPT
         :   mType                 (aiLightSource_UNDEFINED)
         ,   mAttenuationConstant  (0.f)
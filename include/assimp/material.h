@@ -53,6 +53,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/types.h>
 
 #ifdef __cplusplus
+#   include <assimp/Allocator.h>
 extern "C" {
 #endif
 
@@ -657,6 +658,8 @@ struct aiMaterialProperty {
 
 #ifdef __cplusplus
 
+    AI_SCENE_ALLOCATION_OPERATORS
+
     aiMaterialProperty() AI_NO_EXCEPT
             : mSemantic(0),
               mIndex(0),
@@ -667,7 +670,7 @@ struct aiMaterialProperty {
     }
 
     ~aiMaterialProperty() {
-        delete[] mData;
+        Assimp::FreeSceneArray(mData);
         mData = nullptr;
     }
 
@@ -698,6 +701,8 @@ struct aiMaterial
 #ifdef __cplusplus
 
 public:
+    AI_SCENE_ALLOCATION_OPERATORS
+
     aiMaterial();
     ~aiMaterial();
 
@@ -60,6 +60,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/types.h>
 
 #ifdef __cplusplus
+#   include <assimp/Allocator.h>
 extern "C" {
 #endif
 
@@ -142,6 +143,7 @@ struct aiFace {
     unsigned int *mIndices;
 
 #ifdef __cplusplus
+    AI_SCENE_ARRAY_ALLOCATION_OPERATORS
 
     //! Default constructor
     aiFace() AI_NO_EXCEPT
@@ -150,27 +152,33 @@ struct aiFace {
         // empty
     }
 
-    //! Default destructor. Delete the index array
+    //! Default destructor. Delete the index array.
+    //! A face whose indices live in the index block of a mesh (see
+    //! aiMesh::mFaceIndices) doesn't own them, such faces are released
+    //! by aiMesh::FreeFaces() and aiMesh::FreeFaceIndices().
     ~aiFace() {
-        delete[] mIndices;
+        Assimp::FreeSceneArray(mIndices);
     }
 
-    //! Copy constructor. Copy the index array
+    //! Copy constructor. Copy the index array. The copy owns its
+    //! array, also if the indices of o live in the index block of a mesh.
     aiFace(const aiFace &o) :
             mNumIndices(0), mIndices(nullptr) {
         *this = o;
     }
 
-    //! Assignment operator. Copy the index array
+    //! Assignment operator. Copy the index array into an array owned
+    //! by this face. Release a face in the index block of a mesh with
+    //! aiMesh::FreeFaceIndices() before assigning to it.
     aiFace &operator=(const aiFace &o) {
         if (&o == this) {
             return *this;
         }
 
-        delete[] mIndices;
+        Assimp::FreeSceneArray(mIndices);
         mNumIndices = o.mNumIndices;
         if (mNumIndices) {
-            mIndices = new unsigned int[mNumIndices];
+            mIndices = Assimp::AllocateSceneArray<unsigned int>(mNumIndices);
             ::memcpy(mIndices, o.mIndices, mNumIndices * sizeof(unsigned int));
         } else {
             mIndices = nullptr;
@@ -223,6 +231,7 @@ struct aiVertexWeight {
     ai_real mWeight;
 
 #ifdef __cplusplus
+    AI_SCENE_ARRAY_ALLOCATION_OPERATORS
 
     //! Default constructor
     aiVertexWeight() AI_NO_EXCEPT
@@ -297,10 +306,16 @@ struct aiBone {
 
 #ifdef __cplusplus
 
+    AI_SCENE_ALLOCATION_OPERATORS
+
     //! Default constructor
     aiBone() AI_NO_EXCEPT
             : mName(),
               mNumWeights(0),
+#ifndef ASSIMP_BUILD_NO_ARMATUREPOPULATE_PROCESS
+              mArmature(nullptr),
+              mNode(nullptr),
+#endif
               mWeights(nullptr),
               mOffsetMatrix() {
         // empty
@@ -310,6 +325,10 @@ struct aiBone {
     aiBone(const aiBone &other) :
             mName(other.mName),
             mNumWeights(other.mNumWeights),
+#ifndef ASSIMP_BUILD_NO_ARMATUREPOPULATE_PROCESS
+            mArmature(nullptr),
+            mNode(nullptr),
+#endif
             mWeights(nullptr),
             mOffsetMatrix(other.mOffsetMatrix) {
         if (other.mWeights && other.mNumWeights) {
@@ -483,6 +502,8 @@ struct aiAnimMesh {
 
 #ifdef __cplusplus
 
+    AI_SCENE_ALLOCATION_OPERATORS
+
     aiAnimMesh() AI_NO_EXCEPT
             : mVertices(nullptr),
               mNormals(nullptr),
@@ -745,8 +766,28 @@ struct aiMesh {
      */
     C_STRUCT aiAABB mAABB;
 
+    /** Shared storage for the indices of the faces, or nullptr.
+     *
+     * Importers may allocate the indices of all faces in one block, see
+     * aiMesh::AllocateFaces(). Faces whose index array points into this
+     * block don't own it, the block is freed together with the mesh.
+     * Faces may still own separately allocated index arrays. Release the
+     * faces of such a mesh with aiMesh::FreeFaces(), never delete[]
+     * #mFaces directly.
+     *
+     * This member and #mNumFaceIndices were appended in ABI version 6 of
+     * the library, binaries built against older headers must be rebuilt.
+     * See the CHANGES file for the migration notes.
+     */
+    unsigned int *mFaceIndices;
+
+    /** The number of indices in #mFaceIndices. */
+    unsigned int mNumFaceIndices;
+
 #ifdef __cplusplus
 
+    AI_SCENE_ALLOCATION_OPERATORS
+
     //! Default constructor. Initializes all members to 0
     aiMesh() AI_NO_EXCEPT
             : mPrimitiveTypes(0),
@@ -766,7 +807,9 @@ struct aiMesh {
               mNumAnimMeshes(0),
               mAnimMeshes(nullptr),
               mMethod(0),
-              mAABB() {
+              mAABB(),
+              mFaceIndices(nullptr),
+              mNumFaceIndices(0) {
         for (unsigned int a = 0; a < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++a) {
             mNumUVComponents[a] = 0;
             mTextureCoords[a] = nullptr;
@@ -797,17 +840,17 @@ struct aiMesh {
                     delete mBones[a];
                 }
             }
-            delete[] mBones;
+            Assimp::FreeSceneArray(mBones);
         }
 
         if (mNumAnimMeshes && mAnimMeshes) {
             for (unsigned int a = 0; a < mNumAnimMeshes; a++) {
                 delete mAnimMeshes[a];
             }
-            delete[] mAnimMeshes;
+            Assimp::FreeSceneArray(mAnimMeshes);
         }
 
-        delete[] mFaces;
+        FreeFaces();
     }
 
     //! Check whether the mesh contains positions. Provided no special
@@ -871,6 +914,72 @@ struct aiMesh {
         return mBones != nullptr && mNumBones > 0;
     }
 
+    //! Check whether the payload of the mesh was deferred by the importer,
+    //! see #AI_CONFIG_IMPORT_DEFER_MESH_DATA
+    bool HasDeferredData() const {
+        return (mNumVertices > 0 && mVertices == nullptr) || (mNumFaces > 0 && mFaces == nullptr);
+    }
+
+    //! Check whether an index array lives in the shared index block
+    //! of the mesh and is therefore not owned by its face
+    bool IsInFaceIndexBlock(const unsigned int *pIndices) const {
+        return mFaceIndices != nullptr && pIndices >= mFaceIndices && pIndices < mFaceIndices + mNumFaceIndices;
+    }
+
+    //! Replace the faces of the mesh by pNumFaces empty faces and a
+    //! shared block of pNumIndices indices. The caller sets up each face
+    //! to point into the block.
+    //! \param pNumFaces Number of faces
+    //! \param pNumIndices Total number of indices of all faces
+    //! \return The index block
+    unsigned int *AllocateFaces(unsigned int pNumFaces, unsigned int pNumIndices) {
+        FreeFaces();
+        mNumFaces = pNumFaces;
+        mFaces = pNumFaces ? new aiFace[pNumFaces] : nullptr;
+        mNumFaceIndices = pNumIndices;
+        mFaceIndices = pNumIndices ? Assimp::AllocateSceneArray<unsigned int>(pNumIndices) : nullptr;
+        return mFaceIndices;
+    }
+
+    //! Replace the faces of the mesh by faces with pIndicesPerFace
+    //! indices each, stored in a shared block.
+    //! \return The index block
+    unsigned int *AllocateUniformFaces(unsigned int pNumFaces, unsigned int pIndicesPerFace) {
+        unsigned int *indices = AllocateFaces(pNumFaces, pNumFaces * pIndicesPerFace);
+        for (unsigned int a = 0; a < pNumFaces; ++a) {
+            mFaces[a].mNumIndices = pIndicesPerFace;
+            mFaces[a].mIndices = indices + a * pIndicesPerFace;
+        }
+        return indices;
+    }
+
+    //! Delete the index array of a face unless it lives in the shared
+    //! index block of the mesh
+    void FreeFaceIndices(C_STRUCT aiFace &pFace) const {
+        if (!IsInFaceIndexBlock(pFace.mIndices)) {
+            Assimp::FreeSceneArray(pFace.mIndices);
+        }
+        pFace.mIndices = nullptr;
+        pFace.mNumIndices = 0;
+    }
+
+    //! Delete all faces and the shared index block
+    void FreeFaces() {
+        if (mFaceIndices && mFaces) {
+            for (unsigned int a = 0; a < mNumFaces; ++a) {
+                if (IsInFaceIndexBlock(mFaces[a].mIndices)) {
+                    mFaces[a].mIndices = nullptr;
+                }
+            }
+        }
+        delete[] mFaces;
+        mFaces = nullptr;
+        mNumFaces = 0;
+        Assimp::FreeSceneArray(mFaceIndices);
+        mFaceIndices = nullptr;
+        mNumFaceIndices = 0;
+    }
+
 #endif // __cplusplus
 };
 
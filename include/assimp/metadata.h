@@ -99,6 +99,7 @@ struct aiMetadataEntry {
 
 #ifdef __cplusplus
 
+#include <assimp/Allocator.h>
 #include <string>
 
 struct aiMetadata;
@@ -155,6 +156,7 @@ struct aiMetadata {
     C_STRUCT aiMetadataEntry *mValues;
 
 #ifdef __cplusplus
+    AI_SCENE_ALLOCATION_OPERATORS
 
     /**
      *  @brief  The default constructor, set all members to zero by default.
@@ -168,52 +170,51 @@ struct aiMetadata {
 
     aiMetadata(const aiMetadata &rhs) :
             mNumProperties(rhs.mNumProperties), mKeys(nullptr), mValues(nullptr) {
-        mKeys = new aiString[mNumProperties];
+        mKeys = Assimp::AllocateSceneArray<aiString>(mNumProperties);
         for (size_t i = 0; i < static_cast<size_t>(mNumProperties); ++i) {
             mKeys[i] = rhs.mKeys[i];
         }
-        mValues = new aiMetadataEntry[mNumProperties];
+        mValues = Assimp::AllocateSceneArray<aiMetadataEntry>(mNumProperties);
         for (size_t i = 0; i < static_cast<size_t>(mNumProperties); ++i) {
             mValues[i].mType = rhs.mValues[i].mType;
             switch (rhs.mValues[i].mType) {
             case AI_BOOL:
-                mValues[i].mData = new bool;
-                ::memcpy(mValues[i].mData, rhs.mValues[i].mData, sizeof(bool));
+                mValues[i].mData = Assimp::AllocateSceneObject(*static_cast<const bool *>(rhs.mValues[i].mData));
                 break;
             case AI_INT32: {
                 int32_t v;
                 ::memcpy(&v, rhs.mValues[i].mData, sizeof(int32_t));
-                mValues[i].mData = new int32_t(v);
+                mValues[i].mData = Assimp::AllocateSceneObject(v);
             } break;
             case AI_UINT64: {
                 uint64_t v;
                 ::memcpy(&v, rhs.mValues[i].mData, sizeof(uint64_t));
-                mValues[i].mData = new uint64_t(v);
+                mValues[i].mData = Assimp::AllocateSceneObject(v);
             } break;
             case AI_FLOAT: {
                 float v;
                 ::memcpy(&v, rhs.mValues[i].mData, sizeof(float));
-                mValues[i].mData = new float(v);
+                mValues[i].mData = Assimp::AllocateSceneObject(v);
             } break;
             case AI_DOUBLE: {
                 double v;
                 ::memcpy(&v, rhs.mValues[i].mData, sizeof(double));
-                mValues[i].mData = new double(v);
+                mValues[i].mData = Assimp::AllocateSceneObject(v);
             } break;
             case AI_AISTRING: {
                 aiString v;
                 rhs.Get<aiString>(static_cast<unsigned int>(i), v);
-                mValues[i].mData = new aiString(v);
+                mValues[i].mData = Assimp::AllocateSceneObject(v);
             } break;
             case AI_AIVECTOR3D: {
                 aiVector3D v;
                 rhs.Get<aiVector3D>(static_cast<unsigned int>(i), v);
-                mValues[i].mData = new aiVector3D(v);
+                mValues[i].mData = Assimp::AllocateSceneObject(v);
             } break;
             case AI_AIMETADATA: {
                 aiMetadata v;
                 rhs.Get<aiMetadata>(static_cast<unsigned int>(i), v);
-                mValues[i].mData = new aiMetadata(v);
+                mValues[i].mData = Assimp::AllocateSceneObject(v);
             } break;
 #ifndef SWIG
             case FORCE_32BIT:
@@ -236,7 +237,7 @@ struct aiMetadata {
      *  @brief The destructor.
      */
     ~aiMetadata() {
-        delete[] mKeys;
+        Assimp::FreeSceneArray(mKeys);
         mKeys = nullptr;
         if (mValues) {
             // Delete each metadata entry
@@ -244,28 +245,28 @@ struct aiMetadata {
                 void *data = mValues[i].mData;
                 switch (mValues[i].mType) {
                 case AI_BOOL:
-                    delete static_cast<bool *>(data);
+                    Assimp::FreeSceneObject(static_cast<bool *>(data));
                     break;
                 case AI_INT32:
-                    delete static_cast<int32_t *>(data);
+                    Assimp::FreeSceneObject(static_cast<int32_t *>(data));
                     break;
                 case AI_UINT64:
-                    delete static_cast<uint64_t *>(data);
+                    Assimp::FreeSceneObject(static_cast<uint64_t *>(data));
                     break;
                 case AI_FLOAT:
-                    delete static_cast<float *>(data);
+                    Assimp::FreeSceneObject(static_cast<float *>(data));
                     break;
                 case AI_DOUBLE:
-                    delete static_cast<double *>(data);
+                    Assimp::FreeSceneObject(static_cast<double *>(data));
                     break;
                 case AI_AISTRING:
-                    delete static_cast<aiString *>(data);
+                    Assimp::FreeSceneObject(static_cast<aiString *>(data));
                     break;
                 case AI_AIVECTOR3D:
-                    delete static_cast<aiVector3D *>(data);
+                    Assimp::FreeSceneObject(static_cast<aiVector3D *>(data));
                     break;
                 case AI_AIMETADATA:
-                    delete static_cast<aiMetadata *>(data);
+                    Assimp::FreeSceneObject(static_cast<aiMetadata *>(data));
                     break;
 #ifndef SWIG
                 case FORCE_32BIT:
@@ -276,7 +277,7 @@ struct aiMetadata {
             }
 
             // Delete the metadata array
-            delete[] mValues;
+            Assimp::FreeSceneArray(mValues);
             mValues = nullptr;
         }
     }
@@ -292,8 +293,8 @@ struct aiMetadata {
 
         aiMetadata *data = new aiMetadata;
         data->mNumProperties = numProperties;
-        data->mKeys = new aiString[data->mNumProperties]();
-        data->mValues = new aiMetadataEntry[data->mNumProperties]();
+        data->mKeys = Assimp::AllocateSceneArray<aiString>(data->mNumProperties);
+        data->mValues = Assimp::AllocateSceneArray<aiMetadataEntry>(data->mNumProperties);
 
         return data;
     }
@@ -307,16 +308,16 @@ struct aiMetadata {
 
     template <typename T>
     inline void Add(const std::string &key, const T &value) {
-        aiString *new_keys = new aiString[mNumProperties + 1];
-        aiMetadataEntry *new_values = new aiMetadataEntry[mNumProperties + 1];
+        aiString *new_keys = Assimp::AllocateSceneArray<aiString>(mNumProperties + 1);
+        aiMetadataEntry *new_values = Assimp::AllocateSceneArray<aiMetadataEntry>(mNumProperties + 1);
 
         for (unsigned int i = 0; i < mNumProperties; ++i) {
             new_keys[i] = mKeys[i];
             new_values[i] = mValues[i];
         }
 
-        delete[] mKeys;
-        delete[] mValues;
+        Assimp::FreeSceneArray(mKeys);
+        Assimp::FreeSceneArray(mValues);
 
         mKeys = new_keys;
         mValues = new_values;
@@ -351,10 +352,10 @@ struct aiMetadata {
             *static_cast<T *>(mValues[index].mData) = value;
         } else {
             if (nullptr != mValues[index].mData) {
-                delete static_cast<T *>(mValues[index].mData);
+                Assimp::FreeSceneObject(static_cast<T *>(mValues[index].mData));
                 mValues[index].mData = nullptr;
             }
-            mValues[index].mData = new T(value);
+            mValues[index].mData = Assimp::AllocateSceneObject(value);
         }
 
         return true;
@@ -133,6 +133,8 @@ struct ASSIMP_API aiNode
     C_STRUCT aiMetadata* mMetaData;
 
 #ifdef __cplusplus
+    AI_SCENE_ALLOCATION_OPERATORS
+
     /** Constructor */
     aiNode();
 
@@ -232,6 +234,14 @@ struct ASSIMP_API aiNode
  */
 #define AI_SCENE_FLAGS_ALLOW_SHARED			0x20
 
+ /**
+ * Specifies that the payload of one or more meshes has not been loaded yet,
+ * see #AI_CONFIG_IMPORT_DEFER_MESH_DATA. The vertex and face arrays of these
+ * meshes are nullptr although their counts are set, use
+ * Assimp::Importer::LoadMeshData() to load them.
+ */
+#define AI_SCENE_FLAGS_DEFERRED_MESH_DATA   0x40
+
 // -------------------------------------------------------------------------------
 /** The root structure of the imported data.
  *
@@ -58,6 +58,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/types.h>
 
 #ifdef __cplusplus
+#   include <assimp/Allocator.h>
 extern "C" {
 #endif
 
@@ -187,6 +188,7 @@ struct aiTexture {
     C_STRUCT aiString mFilename;
 
 #ifdef __cplusplus
+    AI_SCENE_ALLOCATION_OPERATORS
 
     //! For compressed textures (mHeight == 0): compare the
     //! format hint against a given string.
@@ -212,7 +214,7 @@ struct aiTexture {
 
     // Destruction
     ~aiTexture () {
-        delete[] pcData;
+        Assimp::FreeSceneArray(pcData);
     }
 #endif
 };
@@ -523,6 +523,103 @@ struct aiMemoryInfo {
     unsigned int total;
 }; // !struct aiMemoryInfo
 
+// ----------------------------------------------------------------------------------
+/** A timed region of an import, e.g. the import itself, one of its phases or a
+ *  post-processing step.
+ *  @see aiImportStatistics
+*/
+struct aiProfileRegion {
+#ifdef __cplusplus
+
+    /** Default constructor */
+    aiProfileRegion() AI_NO_EXCEPT
+            : mName(),
+              mSeconds(0.0),
+              mParent(-1),
+              mDepth(0),
+              mAllocatedBytes(0),
+              mPeakBytes(0),
+              mFused(0) {}
+
+#endif
+
+    /** Name of the region, e.g. "import", "parse" or the name of a
+     *  post-processing step */
+    C_STRUCT aiString mName;
+
+    /** Time spent in the region in seconds, including all nested regions */
+    double mSeconds;
+
+    /** Index of the enclosing region in aiImportStatistics::mRegions,
+     *  -1 for top-level regions */
+    int mParent;
+
+    /** Nesting depth, 0 for top-level regions */
+    unsigned int mDepth;
+
+    /** Bytes of scene objects allocated in the region, 0 unless a
+     *  CountingAllocator is set with Importer::SetAllocator() */
+    size_t mAllocatedBytes;
+
+    /** Peak of the scene objects in use during the region in bytes, 0
+     *  unless a CountingAllocator is set with Importer::SetAllocator() */
+    size_t mPeakBytes;
+
+    /** Nonzero for a post-processing step which ran fused with others in
+     *  a single pass over the meshes (see #AI_CONFIG_PP_FUSE_STEPS). Its
+     *  mSeconds is the time spent in this step summed over all threads,
+     *  no memory counters are recorded for it. */
+    unsigned int mFused;
+}; // !struct aiProfileRegion
+
+// ----------------------------------------------------------------------------------
+/** Timings and counters of the last import, collected if
+ *  #AI_CONFIG_GLOB_MEASURE_TIME is enabled.
+ *  @see Importer::GetImportStatistics()
+*/
+struct aiImportStatistics {
+#ifdef __cplusplus
+
+    /** Default constructor */
+    aiImportStatistics() AI_NO_EXCEPT
+            : mNumRegions(0),
+              mRegions(nullptr),
+              mBytesRead(0),
+              mNumMeshes(0),
+              mNumVertices(0),
+              mNumFaces(0) {}
+
+    /** Destructor */
+    ~aiImportStatistics() {
+        delete[] mRegions;
+    }
+
+    aiImportStatistics(const aiImportStatistics &) = delete;
+    aiImportStatistics &operator=(const aiImportStatistics &) = delete;
+
+#endif
+
+    /** Number of entries in mRegions */
+    unsigned int mNumRegions;
+
+    /** All regions in the order they were entered, every region is
+     *  preceded by its parent */
+    C_STRUCT aiProfileRegion *mRegions;
+
+    /** Number of bytes read from all files opened during the import.
+     *  Memory mapped files count with their full size. */
+    size_t mBytesRead;
+
+    /** Number of meshes in the resulting scene */
+    unsigned int mNumMeshes;
+
+    /** Total number of vertices in the resulting scene */
+    unsigned int mNumVertices;
+
+    /** Total number of faces in the resulting scene */
+    unsigned int mNumFaces;
+}; // !struct aiImportStatistics
+
 #ifdef __cplusplus
 }
 #endif //!  __cplusplus
@@ -61,6 +61,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #ifdef __cplusplus
 
+#include <assimp/Allocator.h>
+
 template<typename TReal> class aiMatrix3x3t;
 template<typename TReal> class aiMatrix4x4t;
 
@@ -69,6 +71,8 @@ template<typename TReal> class aiMatrix4x4t;
 template <typename TReal>
 class aiVector3t {
 public:
+    AI_SCENE_ARRAY_ALLOCATION_OPERATORS
+
     aiVector3t() AI_NO_EXCEPT : x(), y(), z() {}
     aiVector3t(TReal _x, TReal _y, TReal _z) : x(_x), y(_y), z(_z) {}
     explicit aiVector3t (TReal _xyz ) : x(_xyz), y(_xyz), z(_xyz) {}
@@ -0,0 +1,264 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2021, assimp team
+
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+#include "UnitTestPCH.h"
+
+#include <assimp/Allocator.h>
+#include <assimp/config.h>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+#include <assimp/Importer.hpp>
+
+#include <cstring>
+#include <map>
+#include <mutex>
+
+using namespace Assimp;
+
+namespace {
+
+// Checks that every block is released with the size it was allocated with
+class MatchingAllocator : public Allocator {
+public:
+    MatchingAllocator() :
+            mMismatches(0) {
+        // empty
+    }
+
+    void *Allocate(size_t size) override {
+        void *data = ::operator new(size);
+        std::lock_guard<std::mutex> lock(mMutex);
+        mBlocks[data] = size;
+        return data;
+    }
+
+    void Deallocate(void *data, size_t size) AI_NO_EXCEPT override {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            std::map<void *, size_t>::iterator it = mBlocks.find(data);
+            if (it == mBlocks.end() || it->second != size) {
+                ++mMismatches;
+            } else {
+                mBlocks.erase(it);
+            }
+        }
+        ::operator delete(data);
+    }
+
+    std::mutex mMutex;
+    std::map<void *, size_t> mBlocks;
+    unsigned int mMismatches;
+};
+
+} // namespace
+
+class utAllocator : public ::testing::Test {
+protected:
+    static const aiProfileRegion *findRegion(const aiImportStatistics *stats, const char *name) {
+        for (unsigned int i = 0; i < stats->mNumRegions; ++i) {
+            if (0 == strcmp(name, stats->mRegions[i].mName.C_Str())) {
+                return &stats->mRegions[i];
+            }
+        }
+        return nullptr;
+    }
+};
+
+TEST_F(utAllocator, countingAllocatorTest) {
+    CountingAllocator counter;
+    void *a = counter.Allocate(100);
+    void *b = counter.Allocate(50);
+    EXPECT_EQ(150u, counter.GetCurrentBytes());
+    EXPECT_EQ(150u, counter.GetPeakBytes());
+
+    counter.Deallocate(a, 100);
+    EXPECT_EQ(50u, counter.GetCurrentBytes());
+    EXPECT_EQ(150u, counter.GetPeakBytes());
+    EXPECT_EQ(150u, counter.ResetPeak());
+    EXPECT_EQ(50u, counter.GetPeakBytes());
+    counter.RaisePeak(70);
+    EXPECT_EQ(70u, counter.GetPeakBytes());
+    counter.RaisePeak(10);
+    EXPECT_EQ(70u, counter.GetPeakBytes());
+
+    counter.Deallocate(b, 50);
+    EXPECT_EQ(0u, counter.GetCurrentBytes());
+    EXPECT_EQ(150u, counter.GetTotalBytes());
+    EXPECT_EQ(2u, counter.GetNumAllocations());
+}
+
+TEST_F(utAllocator, sceneObjectsUseBoundAllocatorTest) {
+    CountingAllocator counter;
+    aiMesh *mesh = nullptr;
+    {
+        Allocator::Scope scope(&counter);
+        EXPECT_EQ(&counter, Allocator::GetActive());
+
+        mesh = new aiMesh();
+        mesh->mVertices = new aiVector3D[10];
+        mesh->mNumVertices = 10;
+        EXPECT_LE(sizeof(aiMesh) + 10 * sizeof(aiVector3D), counter.GetCurrentBytes());
+        EXPECT_EQ(2u, counter.GetNumAllocations());
+    }
+    EXPECT_EQ(nullptr, Allocator::GetActive());
+
+    // the mesh goes back to the allocator it came from
+    delete mesh;
+    EXPECT_EQ(0u, counter.GetCurrentBytes());
+}
+
+TEST_F(utAllocator, sceneArraysUseBoundAllocatorTest) {
+    CountingAllocator counter;
+    aiNode *node = nullptr;
+    aiMaterial *mat = nullptr;
+    {
+        Allocator::Scope scope(&counter);
+        EXPECT_TRUE(SceneArrayScope::IsTracked());
+        node = new aiNode();
+        node->mNumMeshes = 4;
+        node->mMeshes = AllocateSceneArray<unsigned int>(node->mNumMeshes, 0u);
+        aiNode *child = new aiNode();
+        node->addChildren(1, &child);
+
+        mat = new aiMaterial();
+        const float value = 1.f;
+        mat->AddProperty(&value, 1, "test");
+        EXPECT_LE(4 * sizeof(unsigned int) + sizeof(aiNode *) + sizeof(float), counter.GetCurrentBytes());
+        EXPECT_LT(4u, counter.GetNumAllocations());
+    }
+    EXPECT_FALSE(SceneArrayScope::IsTracked());
+
+    // the arrays have a header, they are released with this layout bound
+    {
+        SceneArrayScope arrays(true);
+        delete node;
+        delete mat;
+    }
+    EXPECT_EQ(0u, counter.GetCurrentBytes());
+
+    // arrays from new[] are released without it
+    FreeSceneArray(new unsigned int[4]);
+}
+
+TEST_F(utAllocator, arraysHaveNoCookieTest) {
+    aiColor4D buffer[4];
+    aiColor4D *colors = new (buffer) aiColor4D[4];
+    EXPECT_EQ(buffer, colors);
+
+    aiFace *faces = new aiFace[2];
+    faces[0].mNumIndices = 1;
+    faces[0].mIndices = new unsigned int[1];
+    delete[] faces;
+}
+
+TEST_F(utAllocator, importReleasesAllBlocksTest) {
+    MatchingAllocator matching;
+    {
+        Importer importer;
+        importer.SetAllocator(&matching);
+        importer.SetPropertyInteger(AI_CONFIG_GLOB_MULTITHREADING, 4);
+        const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj",
+                aiProcessPreset_TargetRealtime_MaxQuality | aiProcess_ValidateDataStructure);
+        ASSERT_NE(nullptr, scene);
+        EXPECT_FALSE(matching.mBlocks.empty());
+    }
+    EXPECT_TRUE(matching.mBlocks.empty());
+    EXPECT_EQ(0u, matching.mMismatches);
+}
+
+TEST_F(utAllocator, orphanedSceneReleasesAllBlocksTest) {
+    MatchingAllocator matching;
+    aiScene *scene = nullptr;
+    {
+        Importer importer;
+        importer.SetAllocator(&matching);
+        ASSERT_NE(nullptr, importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", aiProcess_Triangulate));
+        scene = importer.GetOrphanedScene();
+    }
+    ASSERT_NE(nullptr, scene);
+    EXPECT_FALSE(matching.mBlocks.empty());
+
+    // the scene releases its arrays the way they were allocated
+    delete scene;
+    EXPECT_TRUE(matching.mBlocks.empty());
+    EXPECT_EQ(0u, matching.mMismatches);
+}
+
+TEST_F(utAllocator, sceneKeepsArrayLayoutTest) {
+    CountingAllocator counter;
+    Importer importer;
+    ASSERT_NE(nullptr, importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", 0));
+
+    // arrays replaced by the steps have no header, like the ones of the import
+    importer.SetAllocator(&counter);
+    ASSERT_NE(nullptr, importer.ApplyPostProcessing(aiProcess_Triangulate | aiProcess_JoinIdenticalVertices));
+    importer.FreeScene();
+    EXPECT_EQ(0u, counter.GetCurrentBytes());
+}
+
+TEST_F(utAllocator, importStatisticsReportMemoryTest) {
+    CountingAllocator counter;
+
+    Importer importer;
+    importer.SetAllocator(&counter);
+    importer.SetPropertyBool(AI_CONFIG_GLOB_MEASURE_TIME, true);
+    ASSERT_NE(nullptr, importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj",
+            aiProcess_Triangulate | aiProcess_GenNormals | aiProcess_JoinIdenticalVertices));
+    const aiImportStatistics *stats = importer.GetImportStatistics();
+    ASSERT_NE(nullptr, stats);
+
+    const aiProfileRegion *total = findRegion(stats, "total");
+    const aiProfileRegion *import = findRegion(stats, "import");
+    const aiProfileRegion *postprocess = findRegion(stats, "postprocess");
+    ASSERT_NE(nullptr, total);
+    ASSERT_NE(nullptr, import);
+    ASSERT_NE(nullptr, postprocess);
+    EXPECT_LT(0u, import->mAllocatedBytes);
+    EXPECT_LT(0u, import->mPeakBytes);
+    EXPECT_LE(import->mAllocatedBytes, total->mAllocatedBytes);
+    EXPECT_LE(import->mPeakBytes, total->mPeakBytes);
+    EXPECT_LE(postprocess->mPeakBytes, total->mPeakBytes);
+    EXPECT_LE(counter.GetCurrentBytes(), total->mPeakBytes);
+
+    importer.FreeScene();
+    EXPECT_EQ(0u, counter.GetCurrentBytes());
+}
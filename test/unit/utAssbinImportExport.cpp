@@ -40,16 +40,54 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 #include "AbstractImportExportBase.h"
 #include "UnitTestPCH.h"
+#include "AssetLib/Assbin/AssbinFileWriter.h"
+#include "Common/assbin_chunks.h"
 #include <assimp/postprocess.h>
+#include <assimp/DefaultIOSystem.h>
+#include <assimp/MemoryMappedIOSystem.h>
 #include <assimp/Exporter.hpp>
 #include <assimp/Importer.hpp>
 
+#include <sstream>
+
 using namespace Assimp;
 
 #ifndef ASSIMP_BUILD_NO_EXPORT
 
 class utAssbinImportExport : public AbstractImportExportBase {
 public:
+    static void compareMeshes(const aiScene *expected, const aiScene *scene) {
+        ASSERT_NE(nullptr, expected);
+        ASSERT_NE(nullptr, scene);
+        ASSERT_EQ(expected->mNumMeshes, scene->mNumMeshes);
+        for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+            const aiMesh *a = expected->mMeshes[i];
+            const aiMesh *b = scene->mMeshes[i];
+            ASSERT_EQ(a->mNumVertices, b->mNumVertices);
+            ASSERT_EQ(a->mNumFaces, b->mNumFaces);
+            EXPECT_EQ(0, memcmp(a->mVertices, b->mVertices, sizeof(aiVector3D) * a->mNumVertices));
+            ASSERT_EQ(a->HasNormals(), b->HasNormals());
+            if (a->HasNormals()) {
+                EXPECT_EQ(0, memcmp(a->mNormals, b->mNormals, sizeof(aiVector3D) * a->mNumVertices));
+            }
+            ASSERT_EQ(a->HasTangentsAndBitangents(), b->HasTangentsAndBitangents());
+            if (a->HasTangentsAndBitangents()) {
+                EXPECT_EQ(0, memcmp(a->mTangents, b->mTangents, sizeof(aiVector3D) * a->mNumVertices));
+                EXPECT_EQ(0, memcmp(a->mBitangents, b->mBitangents, sizeof(aiVector3D) * a->mNumVertices));
+            }
+            ASSERT_EQ(a->HasTextureCoords(0), b->HasTextureCoords(0));
+            if (a->HasTextureCoords(0)) {
+                EXPECT_EQ(0, memcmp(a->mTextureCoords[0], b->mTextureCoords[0], sizeof(aiVector3D) * a->mNumVertices));
+            }
+            for (unsigned int f = 0; f < a->mNumFaces; ++f) {
+                ASSERT_EQ(a->mFaces[f].mNumIndices, b->mFaces[f].mNumIndices);
+                EXPECT_EQ(0, memcmp(a->mFaces[f].mIndices, b->mFaces[f].mIndices, sizeof(unsigned int) * a->mFaces[f].mNumIndices));
+            }
+            // the indices of all faces are read into one block
+            EXPECT_NE(nullptr, b->mFaceIndices);
+        }
+    }
+
     bool importerTest() override {
         Importer importer;
         const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", aiProcess_ValidateDataStructure);
@@ -66,4 +104,165 @@ TEST_F(utAssbinImportExport, import3ExportAssbinDFromFileTest) {
     EXPECT_TRUE(importerTest());
 }
 
+TEST_F(utAssbinImportExport, roundTripKeepsMeshDataTest) {
+    Importer importer;
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj",
+            aiProcess_Triangulate | aiProcess_GenSmoothNormals | aiProcess_CalcTangentSpace);
+    ASSERT_NE(nullptr, scene);
+
+    // from a file stream, the body is read at once
+    Exporter exporter;
+    ASSERT_EQ(aiReturn_SUCCESS, exporter.Export(scene, "assbin", ASSIMP_TEST_MODELS_DIR "/OBJ/spider_out.assbin"));
+    Importer fileImporter;
+    compareMeshes(scene, fileImporter.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider_out.assbin", aiProcess_ValidateDataStructure));
+
+    // from memory, the data is parsed in place
+    const aiExportDataBlob *blob = exporter.ExportToBlob(scene, "assbin");
+    ASSERT_NE(nullptr, blob);
+    Importer memoryImporter;
+    compareMeshes(scene, memoryImporter.ReadFileFromMemory(blob->data, blob->size, aiProcess_ValidateDataStructure, "assbin"));
+}
+
+TEST_F(utAssbinImportExport, compressedTest) {
+    Importer importer;
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", aiProcess_GenNormals);
+    ASSERT_NE(nullptr, scene);
+
+    DefaultIOSystem io;
+    DumpSceneToAssbin(ASSIMP_TEST_MODELS_DIR "/OBJ/spider_compressed_out.assbin", "", &io, scene, false, true);
+    Importer compressedImporter;
+    compareMeshes(scene, compressedImporter.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider_compressed_out.assbin", aiProcess_ValidateDataStructure));
+}
+
+TEST_F(utAssbinImportExport, wideIndicesTest) {
+    // more than 2^16 vertices, the indices are stored with 32 bits
+    const unsigned int size = 300;
+    std::ostringstream obj;
+    for (unsigned int y = 0; y < size; ++y) {
+        for (unsigned int x = 0; x < size; ++x) {
+            obj << "v " << x << " " << y << " 0\n";
+        }
+    }
+    for (unsigned int y = 0; y + 1 < size; ++y) {
+        for (unsigned int x = 0; x + 1 < size; ++x) {
+            const unsigned int i = y * size + x + 1;
+            obj << "f " << i << " " << i + 1 << " " << i + size + 1 << "\n";
+        }
+    }
+    const std::string data = obj.str();
+
+    Importer importer;
+    const aiScene *scene = importer.ReadFileFromMemory(data.c_str(), data.size(), 0, "obj");
+    ASSERT_NE(nullptr, scene);
+    ASSERT_LT(1u << 16, scene->mMeshes[0]->mNumVertices);
+
+    Exporter exporter;
+    const aiExportDataBlob *blob = exporter.ExportToBlob(scene, "assbin");
+    ASSERT_NE(nullptr, blob);
+    Importer memoryImporter;
+    compareMeshes(scene, memoryImporter.ReadFileFromMemory(blob->data, blob->size, aiProcess_ValidateDataStructure, "assbin"));
+}
+
+TEST_F(utAssbinImportExport, alignedLayoutTest) {
+    Importer importer;
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj",
+            aiProcess_GenSmoothNormals | aiProcess_CalcTangentSpace);
+    ASSERT_NE(nullptr, scene);
+
+    ExportProperties properties;
+    properties.SetPropertyInteger(AI_CONFIG_EXPORT_ASSBIN_VERSION, ASSBIN_VERSION_MAJOR_ALIGNED);
+    Exporter exporter;
+    const aiExportDataBlob *blob = exporter.ExportToBlob(scene, "assbin", 0, &properties);
+    ASSERT_NE(nullptr, blob);
+
+    // all streams listed in the table of contents start at aligned offsets
+    const uint8_t *data = static_cast<const uint8_t *>(blob->data);
+    uint32_t versionMajor, magic, numMeshes;
+    memcpy(&versionMajor, data + 44, 4);
+    EXPECT_EQ(static_cast<uint32_t>(ASSBIN_VERSION_MAJOR_ALIGNED), versionMajor);
+    memcpy(&magic, data + ASSBIN_HEADER_LENGTH, 4);
+    EXPECT_EQ(static_cast<uint32_t>(ASSBIN_CHUNK_AITOC), magic);
+    memcpy(&numMeshes, data + ASSBIN_HEADER_LENGTH + 4, 4);
+    ASSERT_EQ(scene->mNumMeshes, numMeshes);
+    const uint8_t *entry = data + ASSBIN_HEADER_LENGTH + 16;
+    for (unsigned int i = 0; i < numMeshes; ++i, entry += 16 + 8 * ASSBIN_STREAM_COUNT) {
+        uint64_t offsets[ASSBIN_STREAM_COUNT];
+        memcpy(offsets, entry + 16, sizeof(offsets));
+        EXPECT_NE(0u, offsets[ASSBIN_STREAM_POSITIONS]);
+        EXPECT_NE(0u, offsets[ASSBIN_STREAM_TANGENTS]);
+        for (uint64_t offset : offsets) {
+            EXPECT_EQ(0u, offset % ASSBIN_STREAM_ALIGNMENT);
+            EXPECT_LT(offset, blob->size);
+        }
+    }
+
+    // from memory
+    Importer memoryImporter;
+    compareMeshes(scene, memoryImporter.ReadFileFromMemory(blob->data, blob->size, aiProcess_ValidateDataStructure, "assbin"));
+
+    // from a file stream, the streams are read one by one
+    const char *file = ASSIMP_TEST_MODELS_DIR "/OBJ/spider_aligned_out.assbin";
+    ASSERT_EQ(aiReturn_SUCCESS, exporter.Export(scene, "assbin", file, 0, &properties));
+    Importer fileImporter;
+    compareMeshes(scene, fileImporter.ReadFile(file, aiProcess_ValidateDataStructure));
+
+    // from a mapping of the file
+    Importer mappedImporter;
+    mappedImporter.SetIOHandler(new MemoryMappedIOSystem);
+    compareMeshes(scene, mappedImporter.ReadFile(file, aiProcess_ValidateDataStructure));
+}
+
+TEST_F(utAssbinImportExport, alignedDeferredTest) {
+    Importer importer;
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", aiProcess_GenNormals);
+    ASSERT_NE(nullptr, scene);
+
+    const char *file = ASSIMP_TEST_MODELS_DIR "/OBJ/spider_aligned_deferred_out.assbin";
+    DefaultIOSystem io;
+    DumpSceneToAssbin(file, "", &io, scene, false, false, ASSBIN_VERSION_MAJOR_ALIGNED);
+
+    Importer deferredImporter;
+    deferredImporter.SetPropertyBool(AI_CONFIG_IMPORT_DEFER_MESH_DATA, true);
+    const aiScene *deferred = deferredImporter.ReadFile(file, 0);
+    ASSERT_NE(nullptr, deferred);
+    ASSERT_NE(0u, deferred->mFlags & AI_SCENE_FLAGS_DEFERRED_MESH_DATA);
+    for (unsigned int i = deferred->mNumMeshes; i-- > 0;) {
+        EXPECT_EQ(nullptr, deferred->mMeshes[i]->mVertices);
+        ASSERT_TRUE(deferredImporter.LoadMeshData(i)) << deferredImporter.GetErrorString();
+    }
+    compareMeshes(scene, deferred);
+}
+
+TEST_F(utAssbinImportExport, alignedStreamsCheckedBeforeAllocationTest) {
+    Importer importer;
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", aiProcess_GenNormals);
+    ASSERT_NE(nullptr, scene);
+
+    ExportProperties properties;
+    properties.SetPropertyInteger(AI_CONFIG_EXPORT_ASSBIN_VERSION, ASSBIN_VERSION_MAJOR_ALIGNED);
+    Exporter exporter;
+    const aiExportDataBlob *blob = exporter.ExportToBlob(scene, "assbin", 0, &properties);
+    ASSERT_NE(nullptr, blob);
+    std::vector<uint8_t> data(static_cast<const uint8_t *>(blob->data), static_cast<const uint8_t *>(blob->data) + blob->size);
+
+    // claim 2^32-1 vertices for the first mesh in the table of contents and in its chunk
+    const uint32_t numVertices = 0xffffffff;
+    memcpy(&data[ASSBIN_HEADER_LENGTH + 16], &numVertices, 4);
+    uint64_t sceneOffset;
+    memcpy(&sceneOffset, &data[ASSBIN_HEADER_LENGTH + 8], 8);
+    const uint32_t magic = ASSBIN_CHUNK_AIMESH;
+    size_t mesh = static_cast<size_t>(sceneOffset);
+    while (mesh + 16 <= data.size() && memcmp(&data[mesh], &magic, 4) != 0) {
+        ++mesh;
+    }
+    ASSERT_LE(mesh + 16, data.size());
+    memcpy(&data[mesh + 12], &numVertices, 4);
+
+    // the streams are rejected before the arrays for them are requested
+    Importer crafted;
+    crafted.SetPropertyInteger(AI_CONFIG_IMPORT_MAX_MEMORY, 64);
+    EXPECT_EQ(nullptr, crafted.ReadFileFromMemory(data.data(), data.size(), 0, "assbin"));
+    EXPECT_NE(std::string::npos, std::string(crafted.GetErrorString()).find("Invalid offset of a mesh stream"));
+}
+
 #endif // #ifndef ASSIMP_BUILD_NO_EXPORT
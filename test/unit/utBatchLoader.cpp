@@ -43,6 +43,11 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "UnitTestPCH.h"
 #include "Common/Importer.h"
 #include "TestIOSystem.h"
+#include <assimp/Allocator.h>
+#include <assimp/DefaultIOSystem.h>
+#include <assimp/ImportLimits.h>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
 
 using namespace ::Assimp;
 
@@ -79,3 +84,141 @@ TEST_F( BatchLoaderTest, validateAccessTest ) {
     BatchLoader loader2( m_io, true );
     EXPECT_TRUE( loader2.getValidation() );
 }
+
+TEST_F( BatchLoaderTest, numThreadsAccessTest ) {
+    BatchLoader loader( m_io );
+    EXPECT_EQ( 1u, loader.getNumThreads() );
+    loader.setNumThreads( 4 );
+    EXPECT_EQ( 4u, loader.getNumThreads() );
+    loader.setNumThreads( 0 );
+    EXPECT_LE( 1u, loader.getNumThreads() );
+}
+
+TEST_F( BatchLoaderTest, numThreadsConstructorTest ) {
+    BatchLoader loader( m_io, false, 3 );
+    EXPECT_EQ( 3u, loader.getNumThreads() );
+}
+
+TEST_F( BatchLoaderTest, deduplicateRequestsTest ) {
+    BatchLoader loader( m_io );
+    const unsigned int id1 = loader.AddLoadRequest( "a.obj", aiProcess_Triangulate );
+    const unsigned int id2 = loader.AddLoadRequest( "a.obj", aiProcess_Triangulate );
+    const unsigned int id3 = loader.AddLoadRequest( "a.obj", 0 );
+    const unsigned int id4 = loader.AddLoadRequest( "b.obj", aiProcess_Triangulate );
+    EXPECT_EQ( id1, id2 );
+    EXPECT_NE( id1, id3 );
+    EXPECT_NE( id1, id4 );
+
+    BatchLoader::PropertyMap map;
+    map.ints[ 1 ] = 1;
+    EXPECT_NE( id1, loader.AddLoadRequest( "a.obj", aiProcess_Triangulate, &map ) );
+}
+
+static const char *BatchFiles[] = {
+    ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj",
+    ASSIMP_TEST_MODELS_DIR "/OBJ/box.obj",
+    ASSIMP_TEST_MODELS_DIR "/PLY/cube.ply",
+    ASSIMP_TEST_MODELS_DIR "/PLY/cube_binary.ply",
+    ASSIMP_TEST_MODELS_DIR "/OBJ/WusonOBJ.obj"
+};
+static const size_t NumBatchFiles = sizeof( BatchFiles ) / sizeof( BatchFiles[ 0 ] );
+
+TEST( BatchLoaderThreadTest, loadAllMatchesSerialTest ) {
+    DefaultIOSystem io;
+    BatchLoader serial( &io, true );
+    BatchLoader pooled( &io, true );
+    pooled.setNumThreads( 4 );
+
+    std::vector<unsigned int> serialIds, pooledIds;
+    for ( size_t i = 0; i < NumBatchFiles; ++i ) {
+        serialIds.push_back( serial.AddLoadRequest( BatchFiles[ i ], aiProcess_Triangulate ) );
+        pooledIds.push_back( pooled.AddLoadRequest( BatchFiles[ i ], aiProcess_Triangulate ) );
+    }
+
+    // requested twice, loaded once
+    EXPECT_EQ( pooledIds[ 0 ], pooled.AddLoadRequest( BatchFiles[ 0 ], aiProcess_Triangulate ) );
+
+    serial.LoadAll();
+    pooled.LoadAll();
+
+    for ( size_t i = 0; i < NumBatchFiles; ++i ) {
+        aiScene *expected = serial.GetImport( serialIds[ i ] );
+        aiScene *scene = pooled.GetImport( pooledIds[ i ] );
+        ASSERT_NE( nullptr, expected );
+        ASSERT_NE( nullptr, scene );
+        ASSERT_EQ( expected->mNumMeshes, scene->mNumMeshes );
+        for ( unsigned int m = 0; m < scene->mNumMeshes; ++m ) {
+            EXPECT_EQ( expected->mMeshes[ m ]->mNumVertices, scene->mMeshes[ m ]->mNumVertices );
+            EXPECT_EQ( expected->mMeshes[ m ]->mNumFaces, scene->mMeshes[ m ]->mNumFaces );
+        }
+
+        if ( 0 == i ) {
+            EXPECT_EQ( scene, pooled.GetImport( pooledIds[ i ] ) );
+        }
+        EXPECT_EQ( nullptr, pooled.GetImport( pooledIds[ i ] ) );
+
+        delete expected;
+        delete scene;
+    }
+}
+
+TEST( BatchLoaderThreadTest, waitForSingleImportTest ) {
+    DefaultIOSystem io;
+    for ( unsigned int numThreads = 1; numThreads <= 3; numThreads += 2 ) {
+        BatchLoader loader( &io );
+        loader.setNumThreads( numThreads );
+
+        std::vector<unsigned int> ids;
+        for ( size_t i = 0; i < NumBatchFiles; ++i ) {
+            ids.push_back( loader.AddLoadRequest( BatchFiles[ i ] ) );
+        }
+
+        loader.StartLoading();
+        aiScene *scene = loader.GetImport( ids[ 2 ], true );
+        ASSERT_NE( nullptr, scene );
+        EXPECT_EQ( 1u, scene->mNumMeshes );
+        delete scene;
+
+        if ( 1 == numThreads ) {
+            // only the requested file has been loaded so far
+            EXPECT_EQ( nullptr, loader.GetImport( ids[ 0 ] ) );
+        }
+
+        // the remaining scenes are released by the loader
+        loader.LoadAll();
+    }
+}
+
+TEST( BatchLoaderThreadTest, workersUseTheLimitsAndAllocatorOfTheCallerTest ) {
+    DefaultIOSystem io;
+    CountingAllocator allocator;
+    {
+        Allocator::Scope allocatorScope( &allocator );
+        BatchLoader loader( &io );
+        loader.setNumThreads( 4 );
+        std::vector<unsigned int> ids;
+        for ( size_t i = 0; i < NumBatchFiles; ++i ) {
+            ids.push_back( loader.AddLoadRequest( BatchFiles[ i ] ) );
+        }
+        loader.LoadAll();
+        for ( size_t i = 0; i < NumBatchFiles; ++i ) {
+            delete loader.GetImport( ids[ i ] );
+        }
+    }
+    EXPECT_LT( 0u, allocator.GetTotalBytes() );
+    EXPECT_EQ( 0u, allocator.GetCurrentBytes() );
+
+    // a budget too small for any of the files fails all nested imports
+    ImportLimits limits( 16, 0 );
+    ImportLimits::Scope limitsScope( &limits );
+    BatchLoader loader( &io );
+    loader.setNumThreads( 4 );
+    std::vector<unsigned int> ids;
+    for ( size_t i = 0; i < NumBatchFiles; ++i ) {
+        ids.push_back( loader.AddLoadRequest( BatchFiles[ i ] ) );
+    }
+    loader.LoadAll();
+    for ( size_t i = 0; i < NumBatchFiles; ++i ) {
+        EXPECT_EQ( nullptr, loader.GetImport( ids[ i ] ) );
+    }
+}
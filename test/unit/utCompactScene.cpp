@@ -0,0 +1,236 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2021, assimp team
+
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+#include "UnitTestPCH.h"
+#include "SceneDiffer.h"
+
+#include <assimp/CompactScene.h>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+#include <assimp/Importer.hpp>
+
+#include <memory>
+
+using namespace Assimp;
+
+class utCompactScene : public ::testing::Test {
+protected:
+    static void compareNodes(const aiNode *expected, const aiNode *node) {
+        ASSERT_NE(nullptr, node);
+        EXPECT_STREQ(expected->mName.C_Str(), node->mName.C_Str());
+        EXPECT_EQ(expected->mTransformation, node->mTransformation);
+        ASSERT_EQ(expected->mNumMeshes, node->mNumMeshes);
+        for (unsigned int i = 0; i < node->mNumMeshes; ++i) {
+            EXPECT_EQ(expected->mMeshes[i], node->mMeshes[i]);
+        }
+
+        ASSERT_EQ(nullptr == expected->mMetaData, nullptr == node->mMetaData);
+        if (node->mMetaData) {
+            ASSERT_EQ(expected->mMetaData->mNumProperties, node->mMetaData->mNumProperties);
+            for (unsigned int i = 0; i < node->mMetaData->mNumProperties; ++i) {
+                EXPECT_STREQ(expected->mMetaData->mKeys[i].C_Str(), node->mMetaData->mKeys[i].C_Str());
+                EXPECT_EQ(expected->mMetaData->mValues[i].mType, node->mMetaData->mValues[i].mType);
+                if (AI_AISTRING == node->mMetaData->mValues[i].mType) {
+                    aiString a, b;
+                    expected->mMetaData->Get(i, a);
+                    node->mMetaData->Get(i, b);
+                    EXPECT_STREQ(a.C_Str(), b.C_Str());
+                }
+            }
+        }
+
+        ASSERT_EQ(expected->mNumChildren, node->mNumChildren);
+        for (unsigned int i = 0; i < node->mNumChildren; ++i) {
+            EXPECT_EQ(node, node->mChildren[i]->mParent);
+            compareNodes(expected->mChildren[i], node->mChildren[i]);
+        }
+    }
+
+    static void compareScenes(const aiScene *expected, const aiScene *scene) {
+        SceneDiffer differ;
+        EXPECT_TRUE(differ.isEqual(expected, scene));
+
+        compareNodes(expected->mRootNode, scene->mRootNode);
+        for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+            const aiMesh *a = expected->mMeshes[i];
+            const aiMesh *b = scene->mMeshes[i];
+            ASSERT_EQ(a->mNumBones, b->mNumBones);
+            for (unsigned int j = 0; j < b->mNumBones; ++j) {
+                EXPECT_STREQ(a->mBones[j]->mName.C_Str(), b->mBones[j]->mName.C_Str());
+                EXPECT_EQ(a->mBones[j]->mOffsetMatrix, b->mBones[j]->mOffsetMatrix);
+                ASSERT_EQ(a->mBones[j]->mNumWeights, b->mBones[j]->mNumWeights);
+                EXPECT_EQ(0, memcmp(a->mBones[j]->mWeights, b->mBones[j]->mWeights, sizeof(aiVertexWeight) * a->mBones[j]->mNumWeights));
+                if (a->mBones[j]->mNode) {
+                    ASSERT_NE(nullptr, b->mBones[j]->mNode);
+                    EXPECT_EQ(b->mBones[j]->mNode, scene->mRootNode->FindNode(b->mBones[j]->mNode->mName));
+                }
+            }
+        }
+
+        ASSERT_EQ(expected->mNumAnimations, scene->mNumAnimations);
+        for (unsigned int i = 0; i < scene->mNumAnimations; ++i) {
+            const aiAnimation *a = expected->mAnimations[i];
+            const aiAnimation *b = scene->mAnimations[i];
+            EXPECT_EQ(a->mDuration, b->mDuration);
+            ASSERT_EQ(a->mNumChannels, b->mNumChannels);
+            for (unsigned int c = 0; c < b->mNumChannels; ++c) {
+                EXPECT_STREQ(a->mChannels[c]->mNodeName.C_Str(), b->mChannels[c]->mNodeName.C_Str());
+                ASSERT_EQ(a->mChannels[c]->mNumRotationKeys, b->mChannels[c]->mNumRotationKeys);
+                EXPECT_EQ(0, memcmp(a->mChannels[c]->mRotationKeys, b->mChannels[c]->mRotationKeys, sizeof(aiQuatKey) * a->mChannels[c]->mNumRotationKeys));
+            }
+        }
+    }
+};
+
+TEST_F(utCompactScene, stringTableInternsOnceTest) {
+    StringTable strings;
+    EXPECT_EQ(1u, strings.GetNumStrings());
+    EXPECT_EQ(StringTable::EmptyId, strings.Intern("", 0));
+    EXPECT_STREQ("", strings.GetString(StringTable::EmptyId));
+
+    const StringTable::Id hip = strings.Intern("hip", 3);
+    const StringTable::Id knee = strings.Intern("knee_l", 4);
+    EXPECT_NE(hip, knee);
+    EXPECT_EQ(hip, strings.Intern(aiString("hip")));
+    EXPECT_EQ(knee, strings.Find("knee", 4));
+    EXPECT_EQ(StringTable::InvalidId, strings.Find("knee_l", 6));
+    EXPECT_STREQ("knee", strings.GetString(knee));
+    EXPECT_EQ(4u, strings.GetLength(knee));
+    EXPECT_STREQ("hip", strings.ToString(hip).C_Str());
+    EXPECT_EQ(3u, strings.GetNumStrings());
+}
+
+TEST_F(utCompactScene, stringTableGrowsTest) {
+    StringTable strings;
+    for (unsigned int i = 0; i < 10000; ++i) {
+        const std::string name = "bone_" + std::to_string(i);
+        EXPECT_EQ(i + 1, strings.Intern(name.c_str(), name.length()));
+    }
+    for (unsigned int i = 0; i < 10000; ++i) {
+        const std::string name = "bone_" + std::to_string(i);
+        EXPECT_EQ(i + 1, strings.Find(name.c_str(), name.length()));
+        EXPECT_EQ(name, strings.GetString(i + 1));
+    }
+}
+
+TEST_F(utCompactScene, skinnedRoundTripTest) {
+    const char *file = ASSIMP_TEST_MODELS_DIR "/FBX/huesitos.fbx";
+    Importer expectedImporter;
+    const aiScene *expected = expectedImporter.ReadFile(file, aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, expected);
+
+    Importer importer;
+    ASSERT_NE(nullptr, importer.ReadFile(file, aiProcess_ValidateDataStructure));
+    CompactScene compact(importer.GetOrphanedScene());
+
+    const unsigned int root = compact.FindNode(expected->mRootNode->mName.C_Str());
+    EXPECT_EQ(0u, root);
+    EXPECT_EQ(CompactScene::None, compact.GetNode(root).mParent);
+    EXPECT_EQ(CompactScene::None, compact.FindNode("no such node"));
+    ASSERT_LT(0u, compact.GetNumMeshes());
+    EXPECT_EQ(0u, compact.GetMesh(0)->mNumBones);
+    ASSERT_EQ(expected->mMeshes[0]->mNumBones, compact.GetNumBones(0));
+    EXPECT_STREQ(expected->mMeshes[0]->mBones[0]->mName.C_Str(), compact.GetBoneName(0, 0).C_Str());
+
+    std::unique_ptr<aiScene> scene(compact.ToScene());
+    ASSERT_NE(nullptr, scene);
+    compareScenes(expected, scene.get());
+
+    // conversion does not consume the compact data
+    std::unique_ptr<aiScene> again(compact.ToScene());
+    compareScenes(expected, again.get());
+}
+
+TEST_F(utCompactScene, animatedRoundTripTest) {
+    const char *file = ASSIMP_TEST_MODELS_DIR "/BVH/01_01.bvh";
+    Importer expectedImporter;
+    const aiScene *expected = expectedImporter.ReadFile(file, aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, expected);
+    ASSERT_LT(0u, expected->mNumAnimations);
+
+    Importer importer;
+    ASSERT_NE(nullptr, importer.ReadFile(file, aiProcess_ValidateDataStructure));
+    CompactScene compact(importer.GetOrphanedScene());
+    ASSERT_EQ(expected->mAnimations[0]->mNumChannels, compact.GetNumChannels(0));
+    EXPECT_STREQ(expected->mAnimations[0]->mChannels[0]->mNodeName.C_Str(),
+            compact.GetStrings().GetString(compact.GetChannel(0, 0).mNodeName));
+
+    std::unique_ptr<aiScene> scene(compact.ToScene());
+    compareScenes(expected, scene.get());
+}
+
+TEST_F(utCompactScene, namesShrinkTest) {
+    // a flat rig with one bone per joint
+    static const unsigned int NumJoints = 10000;
+    aiScene *scene = new aiScene();
+    scene->mRootNode = new aiNode("rig");
+    scene->mRootNode->mNumChildren = NumJoints;
+    scene->mRootNode->mChildren = new aiNode *[NumJoints];
+    scene->mNumMeshes = 1;
+    scene->mMeshes = new aiMesh *[1];
+    aiMesh *mesh = scene->mMeshes[0] = new aiMesh();
+    mesh->mNumBones = NumJoints;
+    mesh->mBones = new aiBone *[NumJoints];
+    for (unsigned int i = 0; i < NumJoints; ++i) {
+        const std::string name = "joint_" + std::to_string(i);
+        aiNode *node = scene->mRootNode->mChildren[i] = new aiNode(name);
+        node->mParent = scene->mRootNode;
+
+        aiBone *bone = mesh->mBones[i] = new aiBone();
+        bone->mName.Set(name);
+        bone->mNode = node;
+        bone->mNumWeights = 1;
+        bone->mWeights = new aiVertexWeight[1];
+        bone->mWeights[0] = aiVertexWeight(i, 1.0f);
+    }
+
+    CompactScene compact(scene);
+    ASSERT_EQ(NumJoints + 1, compact.GetNumNodes());
+    ASSERT_EQ(NumJoints, compact.GetNumBones(0));
+    EXPECT_EQ(compact.GetBone(0, 42).mNode, compact.FindNode("joint_42"));
+
+    // bones share the names of their nodes
+    EXPECT_EQ(NumJoints + 2, compact.GetStrings().GetNumStrings());
+
+    const size_t named = (NumJoints + 1) * sizeof(aiNode) + NumJoints * sizeof(aiBone);
+    EXPECT_LT(compact.GetMemoryFootprint() * 10, named);
+}
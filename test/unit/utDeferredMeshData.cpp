@@ -0,0 +1,203 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2021, assimp team
+
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+#include "UnitTestPCH.h"
+
+#include <assimp/config.h>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+#include <assimp/Exporter.hpp>
+#include <assimp/Importer.hpp>
+
+using namespace Assimp;
+
+class utDeferredMeshData : public ::testing::Test {
+protected:
+    static void compareMeshes(const aiMesh *expected, const aiMesh *mesh) {
+        EXPECT_STREQ(expected->mName.C_Str(), mesh->mName.C_Str());
+        EXPECT_EQ(expected->mPrimitiveTypes, mesh->mPrimitiveTypes);
+        EXPECT_EQ(expected->mMaterialIndex, mesh->mMaterialIndex);
+        ASSERT_EQ(expected->mNumVertices, mesh->mNumVertices);
+        ASSERT_EQ(expected->mNumFaces, mesh->mNumFaces);
+        ASSERT_NE(nullptr, mesh->mVertices);
+        EXPECT_EQ(0, memcmp(expected->mVertices, mesh->mVertices, sizeof(aiVector3D) * mesh->mNumVertices));
+        ASSERT_EQ(expected->HasNormals(), mesh->HasNormals());
+        if (mesh->HasNormals()) {
+            EXPECT_EQ(0, memcmp(expected->mNormals, mesh->mNormals, sizeof(aiVector3D) * mesh->mNumVertices));
+        }
+        for (unsigned int c = 0; c < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++c) {
+            ASSERT_EQ(expected->HasTextureCoords(c), mesh->HasTextureCoords(c));
+            if (mesh->HasTextureCoords(c)) {
+                EXPECT_EQ(expected->mNumUVComponents[c], mesh->mNumUVComponents[c]);
+                EXPECT_EQ(0, memcmp(expected->mTextureCoords[c], mesh->mTextureCoords[c], sizeof(aiVector3D) * mesh->mNumVertices));
+            }
+        }
+        ASSERT_NE(nullptr, mesh->mFaces);
+        for (unsigned int f = 0; f < mesh->mNumFaces; ++f) {
+            ASSERT_EQ(expected->mFaces[f].mNumIndices, mesh->mFaces[f].mNumIndices);
+            EXPECT_EQ(0, memcmp(expected->mFaces[f].mIndices, mesh->mFaces[f].mIndices, sizeof(unsigned int) * mesh->mFaces[f].mNumIndices));
+        }
+    }
+
+    // Imports the file with and without deferred mesh data and loads all meshes on demand
+    static void checkDeferredFile(const char *file) {
+        Importer expectedImporter;
+        const aiScene *expected = expectedImporter.ReadFile(file, 0);
+        ASSERT_NE(nullptr, expected);
+
+        Importer importer;
+        importer.SetPropertyBool(AI_CONFIG_IMPORT_DEFER_MESH_DATA, true);
+        const aiScene *scene = importer.ReadFile(file, 0);
+        ASSERT_NE(nullptr, scene);
+        ASSERT_NE(0u, scene->mFlags & AI_SCENE_FLAGS_DEFERRED_MESH_DATA);
+
+        // the headers are there, the payload isn't
+        ASSERT_EQ(expected->mNumMeshes, scene->mNumMeshes);
+        for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+            const aiMesh *mesh = scene->mMeshes[i];
+            EXPECT_STREQ(expected->mMeshes[i]->mName.C_Str(), mesh->mName.C_Str());
+            EXPECT_EQ(expected->mMeshes[i]->mNumVertices, mesh->mNumVertices);
+            EXPECT_EQ(expected->mMeshes[i]->mNumFaces, mesh->mNumFaces);
+            EXPECT_EQ(expected->mMeshes[i]->mMaterialIndex, mesh->mMaterialIndex);
+            EXPECT_TRUE(mesh->HasDeferredData());
+            EXPECT_EQ(nullptr, mesh->mVertices);
+        }
+
+        // no post processing before the data is there
+        EXPECT_EQ(nullptr, importer.ApplyPostProcessing(aiProcess_Triangulate));
+        scene = importer.GetScene();
+        ASSERT_NE(nullptr, scene);
+
+        // load them back to front, the order must not matter
+        for (unsigned int i = scene->mNumMeshes; i-- > 0;) {
+            ASSERT_TRUE(importer.LoadMeshData(i)) << importer.GetErrorString();
+            EXPECT_FALSE(scene->mMeshes[i]->HasDeferredData());
+            compareMeshes(expected->mMeshes[i], scene->mMeshes[i]);
+
+            // loading again is a no-op
+            EXPECT_TRUE(importer.LoadMeshData(i));
+        }
+        EXPECT_EQ(0u, scene->mFlags & AI_SCENE_FLAGS_DEFERRED_MESH_DATA);
+        EXPECT_FALSE(importer.LoadMeshData(scene->mNumMeshes));
+
+        // now the scene is complete
+        ASSERT_NE(nullptr, importer.ApplyPostProcessing(aiProcess_ValidateDataStructure));
+    }
+};
+
+TEST_F(utDeferredMeshData, binaryStlTest) {
+    checkDeferredFile(ASSIMP_TEST_MODELS_DIR "/STL/Spider_binary.stl");
+}
+
+TEST_F(utDeferredMeshData, gltf2Test) {
+    checkDeferredFile(ASSIMP_TEST_MODELS_DIR "/glTF2/BoxTextured-glTF/BoxTextured.gltf");
+}
+
+TEST_F(utDeferredMeshData, glbTest) {
+    checkDeferredFile(ASSIMP_TEST_MODELS_DIR "/glTF2/2CylinderEngine-glTF-Binary/2CylinderEngine.glb");
+}
+
+TEST_F(utDeferredMeshData, glbWithEmbeddedImageTest) {
+    // the image is part of the binary body, so the body is read completely
+    Importer importer;
+    importer.SetPropertyBool(AI_CONFIG_IMPORT_DEFER_MESH_DATA, true);
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/glTF2/BoxTextured-glTF-Binary/BoxTextured.glb", aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, scene);
+    EXPECT_EQ(0u, scene->mFlags & AI_SCENE_FLAGS_DEFERRED_MESH_DATA);
+    ASSERT_EQ(1u, scene->mNumTextures);
+    EXPECT_FALSE(scene->mMeshes[0]->HasDeferredData());
+}
+
+TEST_F(utDeferredMeshData, fbxTest) {
+    checkDeferredFile(ASSIMP_TEST_MODELS_DIR "/FBX/spider.fbx");
+}
+
+TEST_F(utDeferredMeshData, fbxMultiMaterialTest) {
+    // the box is split into one mesh per material
+    checkDeferredFile(ASSIMP_TEST_MODELS_NONBSD_DIR "/FBX/2013_ASCII/kwxport_test_vcolors.fbx");
+}
+
+TEST_F(utDeferredMeshData, fbxWithDeformersImportsEverythingTest) {
+    // the converter needs the vertices of skinned geometry
+    Importer importer;
+    importer.SetPropertyBool(AI_CONFIG_IMPORT_DEFER_MESH_DATA, true);
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/FBX/huesitos.fbx", aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, scene);
+    EXPECT_EQ(0u, scene->mFlags & AI_SCENE_FLAGS_DEFERRED_MESH_DATA);
+}
+
+#ifndef ASSIMP_BUILD_NO_EXPORT
+TEST_F(utDeferredMeshData, assbinTest) {
+    Importer importer;
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, scene);
+
+    Exporter exporter;
+    ASSERT_EQ(aiReturn_SUCCESS, exporter.Export(scene, "assbin", ASSIMP_TEST_MODELS_DIR "/OBJ/spider_deferred_out.assbin"));
+    checkDeferredFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider_deferred_out.assbin");
+}
+#endif // ASSIMP_BUILD_NO_EXPORT
+
+TEST_F(utDeferredMeshData, unsupportedFormatImportsEverythingTest) {
+    Importer importer;
+    importer.SetPropertyBool(AI_CONFIG_IMPORT_DEFER_MESH_DATA, true);
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", aiProcess_Triangulate);
+    ASSERT_NE(nullptr, scene);
+    EXPECT_EQ(0u, scene->mFlags & AI_SCENE_FLAGS_DEFERRED_MESH_DATA);
+    for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+        EXPECT_FALSE(scene->mMeshes[i]->HasDeferredData());
+        EXPECT_TRUE(importer.LoadMeshData(i));
+    }
+}
+
+TEST_F(utDeferredMeshData, freeSceneReleasesDeferredDataTest) {
+    Importer importer;
+    importer.SetPropertyBool(AI_CONFIG_IMPORT_DEFER_MESH_DATA, true);
+    ASSERT_NE(nullptr, importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/STL/Spider_binary.stl", 0));
+    importer.FreeScene();
+    EXPECT_FALSE(importer.LoadMeshData(0));
+
+    // ascii files are read completely
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/STL/Spider_ascii.stl", 0);
+    ASSERT_NE(nullptr, scene);
+    EXPECT_EQ(0u, scene->mFlags & AI_SCENE_FLAGS_DEFERRED_MESH_DATA);
+}
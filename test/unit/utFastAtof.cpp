@@ -44,6 +44,11 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <assimp/fast_atof.h>
 
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
 namespace {
 
 template <typename Real>
@@ -188,3 +193,77 @@ TEST_F(FastAtofTest, FastAtof)
 {
     RunTest<ai_real>(FastAtofWrapper());
 }
+
+template <typename Real>
+static void TestArrayMatchesScalar() {
+    std::mt19937 rng(4711);
+    std::uniform_int_distribution<int> digits(0, 9);
+    std::uniform_int_distribution<int> kind(0, 9);
+    std::string text;
+    for (int i = 0; i < 2000; ++i) {
+        const int k = kind(rng);
+        if (k == 0) {
+            text += "1.5e-3";
+        } else if (k == 1) {
+            text += "-2,25";
+        } else if (k == 2) {
+            text += "123456789012345678901.5";
+        } else if (k == 3) {
+            text += (i & 1) ? "nan" : "-inf";
+        } else {
+            if (k & 1) text += '-';
+            for (int d = 0; d < 1 + k; ++d) text += char('0' + digits(rng));
+            text += '.';
+            for (int d = 0; d < k; ++d) text += char('0' + digits(rng));
+        }
+        text += (i % 7 == 0) ? "\n" : (i % 3 == 0 ? "\t " : " ");
+    }
+
+    std::vector<Real> expected;
+    for (const char *c = text.c_str(); *c;) {
+        Real value;
+        c = Assimp::fast_atoreal_move<Real>(c, value);
+        expected.push_back(value);
+        while (*c == ' ' || *c == '\t' || *c == '\n') ++c;
+    }
+
+    std::vector<Real> actual(expected.size() + 1);
+    const char *c = text.c_str();
+    const size_t count = Assimp::fast_atoreal_array<Real>(c, text.c_str() + text.size(), actual.data(), actual.size());
+    ASSERT_EQ(expected.size(), count);
+    for (size_t i = 0; i < count; ++i) {
+        if (IsNan(expected[i])) {
+            EXPECT_TRUE(IsNan(actual[i]));
+        } else {
+            EXPECT_EQ(0, memcmp(&expected[i], &actual[i], sizeof(Real))) << i;
+        }
+    }
+}
+
+TEST_F(FastAtofTest, FastAtorealArrayFloat)
+{
+    TestArrayMatchesScalar<float>();
+}
+
+TEST_F(FastAtofTest, FastAtorealArrayDouble)
+{
+    TestArrayMatchesScalar<double>();
+}
+
+TEST_F(FastAtofTest, FastAtorealArrayStops)
+{
+    const std::string text = "  1.0 2.5\t-3 \n4 5";
+    const char *c = text.c_str();
+    float values[8];
+    EXPECT_EQ(3u, Assimp::fast_atoreal_array<float>(c, text.c_str() + text.size(), values, 8, false));
+    EXPECT_EQ(-3.0f, values[2]);
+    EXPECT_EQ(' ', *c);
+
+    c = text.c_str();
+    EXPECT_EQ(2u, Assimp::fast_atoreal_array<float>(c, text.c_str() + text.size(), values, 2));
+    EXPECT_EQ(2.5f, values[1]);
+
+    const std::string words = "1 2 f 3";
+    c = words.c_str();
+    EXPECT_EQ(2u, Assimp::fast_atoreal_array<float>(c, words.c_str() + words.size(), values, 8));
+}
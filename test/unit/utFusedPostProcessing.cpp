@@ -0,0 +1,136 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2021, assimp team
+
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+#include "UnitTestPCH.h"
+#include "UTLogStream.h"
+
+#include <assimp/config.h>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+#include <assimp/DefaultLogger.hpp>
+#include <assimp/Importer.hpp>
+
+#include <algorithm>
+
+using namespace Assimp;
+
+class utFusedPostProcessing : public ::testing::Test {
+protected:
+    static const aiScene *import(Importer &importer, bool fuse, int numThreads) {
+        importer.SetPropertyBool(AI_CONFIG_PP_FUSE_STEPS, fuse);
+        importer.SetPropertyInteger(AI_CONFIG_GLOB_MULTITHREADING, numThreads);
+        return importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj",
+                aiProcessPreset_TargetRealtime_MaxQuality | aiProcess_FixInfacingNormals |
+                aiProcess_GenBoundingBoxes | aiProcess_ValidateDataStructure);
+    }
+
+    static void compareMeshes(const aiScene *expected, const aiScene *scene) {
+        ASSERT_EQ(expected->mNumMeshes, scene->mNumMeshes);
+        for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+            const aiMesh *a = expected->mMeshes[i];
+            const aiMesh *b = scene->mMeshes[i];
+            ASSERT_EQ(a->mNumVertices, b->mNumVertices);
+            ASSERT_EQ(a->mNumFaces, b->mNumFaces);
+            EXPECT_EQ(0, memcmp(a->mVertices, b->mVertices, sizeof(aiVector3D) * a->mNumVertices));
+            ASSERT_TRUE(a->HasNormals() && b->HasNormals());
+            EXPECT_EQ(0, memcmp(a->mNormals, b->mNormals, sizeof(aiVector3D) * a->mNumVertices));
+            ASSERT_EQ(a->HasTangentsAndBitangents(), b->HasTangentsAndBitangents());
+            if (a->HasTangentsAndBitangents()) {
+                EXPECT_EQ(0, memcmp(a->mTangents, b->mTangents, sizeof(aiVector3D) * a->mNumVertices));
+                EXPECT_EQ(0, memcmp(a->mBitangents, b->mBitangents, sizeof(aiVector3D) * a->mNumVertices));
+            }
+            for (unsigned int f = 0; f < a->mNumFaces; ++f) {
+                ASSERT_EQ(a->mFaces[f].mNumIndices, b->mFaces[f].mNumIndices);
+                EXPECT_EQ(0, memcmp(a->mFaces[f].mIndices, b->mFaces[f].mIndices, sizeof(unsigned int) * a->mFaces[f].mNumIndices));
+            }
+            EXPECT_EQ(a->mAABB.mMin, b->mAABB.mMin);
+            EXPECT_EQ(a->mAABB.mMax, b->mAABB.mMax);
+        }
+    }
+};
+
+TEST_F(utFusedPostProcessing, sameOutputAsSeparateStepsTest) {
+    Importer separateImporter;
+    const aiScene *expected = import(separateImporter, false, 0);
+    ASSERT_NE(nullptr, expected);
+
+    Importer fusedImporter;
+    const aiScene *scene = import(fusedImporter, true, 0);
+    ASSERT_NE(nullptr, scene);
+    compareMeshes(expected, scene);
+
+    Importer parallelImporter;
+    scene = import(parallelImporter, true, 4);
+    ASSERT_NE(nullptr, scene);
+    compareMeshes(expected, scene);
+}
+
+TEST_F(utFusedPostProcessing, reportsStepTimingsTest) {
+    UTLogStream *stream = new UTLogStream;
+    DefaultLogger::get()->attachStream(stream, Logger::Debugging);
+
+    Importer importer;
+    importer.SetPropertyBool(AI_CONFIG_GLOB_MEASURE_TIME, true);
+    const aiScene *scene = import(importer, true, 0);
+
+    DefaultLogger::get()->detachStream(stream, Logger::Debugging);
+    ASSERT_NE(nullptr, scene);
+
+    // steps which ran fused report their timings in the statistics as well
+    const aiImportStatistics *stats = importer.GetImportStatistics();
+    ASSERT_NE(nullptr, stats);
+    const char *steps[] = { "GenVertexNormalsProcess", "CalcTangentsProcess", "JoinVerticesProcess", "ImproveCacheLocalityProcess" };
+    for (const char *step : steps) {
+        const std::string region = std::string("END   `") + step + "`";
+        EXPECT_TRUE(std::any_of(stream->m_messages.begin(), stream->m_messages.end(), [&](const std::string &msg) {
+            return msg.find(region) != std::string::npos;
+        })) << step;
+        const aiProfileRegion *end = stats->mRegions + stats->mNumRegions;
+        const aiProfileRegion *found = std::find_if(static_cast<const aiProfileRegion *>(stats->mRegions), end, [&](const aiProfileRegion &r) {
+            return 0 == strcmp(step, r.mName.C_Str());
+        });
+        ASSERT_NE(end, found) << step;
+        EXPECT_NE(0u, found->mFused) << step;
+        EXPECT_LE(0.0, found->mSeconds) << step;
+    }
+    delete stream;
+}
@@ -42,7 +42,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
 #include "UnitTestPCH.h"
+#include "Common/CountingIOSystem.h"
 #include <assimp/IOStreamBuffer.h>
+#include <assimp/MemoryIOWrapper.h>
 #include "TestIOStream.h"
 #include "UnitTestFileGenerator.h"
 
@@ -144,3 +146,111 @@ TEST_F( IOStreamBufferTest, accessBlockIndexTest ) {
 
 }
 
+
+TEST_F( IOStreamBufferTest, dataLineViewTest ) {
+    // lines span the 8 byte blocks, are continued, end with CR LF or are empty
+    static const char text[] = "v 1 2 3\nf 1 2 \\\n3\r\n\nvn 0.25 0.5 0.75\nlast";
+    MemoryIOStream stream( reinterpret_cast<const uint8_t*>( text ), sizeof( text ) - 1 );
+    IOStreamBuffer<char> myBuffer( 8 );
+    EXPECT_TRUE( myBuffer.open( &stream ) );
+
+    const char *expected[] = { "v 1 2 3", "f 1 2 3", "", "vn 0.25 0.5 0.75", "last" };
+    const char *line = nullptr;
+    size_t length = 0;
+    for ( const char *exp : expected ) {
+        ASSERT_TRUE( myBuffer.getNextDataLineView( line, length, '\\' ) );
+        EXPECT_EQ( std::string( exp ), std::string( line, length ) );
+        EXPECT_TRUE( IsLineEnd( line[ length ] ) );
+    }
+    EXPECT_FALSE( myBuffer.getNextDataLineView( line, length, '\\' ) );
+}
+
+TEST_F( IOStreamBufferTest, lineViewSkipsEmptyLinesTest ) {
+    static const char text[] = "ply\r\n\r\nformat ascii 1.0\n\n\nend_header\n";
+    MemoryIOStream stream( reinterpret_cast<const uint8_t*>( text ), sizeof( text ) - 1 );
+    IOStreamBuffer<char> myBuffer( 16 );
+    EXPECT_TRUE( myBuffer.open( &stream ) );
+
+    const char *expected[] = { "ply", "format ascii 1.0", "end_header" };
+    const char *line = nullptr;
+    size_t length = 0;
+    for ( const char *exp : expected ) {
+        ASSERT_TRUE( myBuffer.getNextLineView( line, length ) );
+        EXPECT_EQ( std::string( exp ), std::string( line, length ) );
+    }
+    EXPECT_FALSE( myBuffer.getNextLineView( line, length ) );
+}
+
+TEST_F( IOStreamBufferTest, findLineEndTest ) {
+    std::string text( 100, 'x' );
+    for ( size_t i = 0; i < text.size(); ++i ) {
+        for ( char lineEnd : { '\n', '\r', '\0', '\f' } ) {
+            std::string probe = text;
+            probe[ i ] = lineEnd;
+            EXPECT_EQ( probe.data() + i, FindLineEnd( probe.data(), probe.data() + probe.size() ) );
+        }
+    }
+    EXPECT_EQ( text.data() + text.size(), FindLineEnd( text.data(), text.data() + text.size() ) );
+}
+
+TEST_F( IOStreamBufferTest, readAheadTest ) {
+    std::string text;
+    for ( int i = 0; i < 2000; ++i ) {
+        text += "v " + std::to_string( i ) + " " + std::to_string( i * 7 ) + "\n";
+    }
+
+    for ( size_t depth : { 0, 1, 3 } ) {
+        MemoryIOStream stream( reinterpret_cast<const uint8_t*>( text.data() ), text.size() );
+        IOStreamBuffer<char> myBuffer( 100 );
+        myBuffer.setReadAhead( depth );
+        EXPECT_EQ( depth, myBuffer.getReadAhead() );
+        EXPECT_TRUE( myBuffer.open( &stream ) );
+
+        std::string joined;
+        const char *line = nullptr;
+        size_t length = 0;
+        while ( myBuffer.getNextDataLineView( line, length, '\\' ) ) {
+            joined.append( line, length );
+            joined += '\n';
+        }
+        EXPECT_EQ( text, joined );
+        EXPECT_TRUE( myBuffer.close() );
+    }
+}
+
+TEST_F( IOStreamBufferTest, readAheadCloseEarlyTest ) {
+    const std::string text( 10000, 'x' );
+    MemoryIOStream stream( reinterpret_cast<const uint8_t*>( text.data() ), text.size() );
+    IOStreamBuffer<char> myBuffer( 64 );
+    myBuffer.setReadAhead( 2 );
+    EXPECT_TRUE( myBuffer.open( &stream ) );
+
+    std::vector<char> block;
+    EXPECT_TRUE( myBuffer.getNextBlock( block ) );
+    EXPECT_EQ( std::string( 64, 'x' ), std::string( block.begin(), block.begin() + 64 ) );
+    EXPECT_TRUE( myBuffer.close() );
+}
+
+TEST_F( IOStreamBufferTest, readAheadSharesCounterTest ) {
+    const std::string text( 100000, 'x' );
+    std::atomic<size_t> bytesRead( 0 );
+    MemoryIOStream aheadFile( reinterpret_cast<const uint8_t*>( text.data() ), text.size() );
+    MemoryIOStream mainFile( reinterpret_cast<const uint8_t*>( text.data() ), text.size() );
+    CountingIOStream aheadStream( &aheadFile, bytesRead );
+    CountingIOStream mainStream( &mainFile, bytesRead );
+
+    // the background thread and this one add to the same counter
+    IOStreamBuffer<char> myBuffer( 64 );
+    myBuffer.setReadAhead( 4 );
+    EXPECT_TRUE( myBuffer.open( &aheadStream ) );
+    std::vector<char> block;
+    size_t mainBytes = 0;
+    char byte = 0;
+    while ( myBuffer.getNextBlock( block ) ) {
+        mainBytes += mainStream.Read( &byte, 1, 1 );
+    }
+    EXPECT_TRUE( myBuffer.close() );
+
+    EXPECT_LT( 0u, mainBytes );
+    EXPECT_EQ( text.size() + mainBytes, bytesRead.load() );
+}
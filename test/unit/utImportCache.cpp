@@ -0,0 +1,506 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2021, assimp team
+
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+#include "UnitTestPCH.h"
+#include "Common/ScenePrivate.h"
+
+#include <assimp/DefaultIOSystem.h>
+#include <assimp/config.h>
+#include <assimp/material.h>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+#include <assimp/Importer.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <sstream>
+#include <string>
+
+using namespace Assimp;
+
+namespace {
+
+// The cache entries of earlier runs must not be hit, so each test imports
+// files with a unique comment.
+std::string UniqueToken() {
+    static unsigned int counter = 0;
+    std::ostringstream out;
+    out << std::chrono::high_resolution_clock::now().time_since_epoch().count() << "-" << counter++;
+    return out.str();
+}
+
+std::string MakeGrid(unsigned int size, const std::string &token, const char *mtl = nullptr) {
+    std::ostringstream out;
+    out << "# " << token << "\n";
+    if (mtl) {
+        out << "mtllib " << mtl << "\nusemtl surface\n";
+    }
+    for (unsigned int y = 0; y < size; ++y) {
+        for (unsigned int x = 0; x < size; ++x) {
+            out << "v " << x << " " << y << " " << (x * y) % 7 << "\n";
+        }
+    }
+    for (unsigned int y = 0; y + 1 < size; ++y) {
+        for (unsigned int x = 0; x + 1 < size; ++x) {
+            const unsigned int i = y * size + x + 1;
+            out << "f " << i << " " << i + 1 << " " << i + size + 1 << " " << i + size << "\n";
+        }
+    }
+    return out.str();
+}
+
+void WriteFile(const char *path, const std::string &content) {
+    FILE *file = fopen(path, "wb");
+    ASSERT_NE(nullptr, file);
+    EXPECT_EQ(content.size(), fwrite(content.c_str(), 1, content.size(), file));
+    fclose(file);
+}
+
+// Records the entries the cache renames into place
+class RecordingIOSystem : public DefaultIOSystem {
+public:
+    bool RenameFile(const std::string &from, const std::string &to) override {
+        mRenamed.push_back(to);
+        return DefaultIOSystem::RenameFile(from, to);
+    }
+
+    std::vector<std::string> mRenamed;
+};
+
+} // namespace
+
+class utImportCache : public ::testing::Test {
+protected:
+    static const char *CacheDirectory() {
+        return "importCacheTest_cache";
+    }
+
+    static void setupCache(Importer &importer, int maxSize = AI_IMPORT_CACHE_DEFAULT_MAX_SIZE) {
+        importer.SetPropertyString(AI_CONFIG_IMPORT_CACHE_DIRECTORY, CacheDirectory());
+        importer.SetPropertyInteger(AI_CONFIG_IMPORT_CACHE_MAX_SIZE, maxSize);
+        importer.SetPropertyInteger(AI_CONFIG_GLOB_MEASURE_TIME, 1);
+    }
+
+    static const aiProfileRegion *findRegion(const Importer &importer, const char *name) {
+        const aiImportStatistics *stats = importer.GetImportStatistics();
+        if (nullptr == stats) {
+            return nullptr;
+        }
+        for (unsigned int i = 0; i < stats->mNumRegions; ++i) {
+            if (0 == strcmp(name, stats->mRegions[i].mName.C_Str())) {
+                return &stats->mRegions[i];
+            }
+        }
+        return nullptr;
+    }
+
+    // the file was parsed instead of being loaded from the cache
+    static bool wasImported(const Importer &importer) {
+        return nullptr != findRegion(importer, "import");
+    }
+
+    static void compareScenes(const aiScene *expected, const aiScene *scene) {
+        ASSERT_NE(nullptr, expected);
+        ASSERT_NE(nullptr, scene);
+        ASSERT_EQ(expected->mNumMeshes, scene->mNumMeshes);
+        ASSERT_EQ(expected->mNumMaterials, scene->mNumMaterials);
+        for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+            const aiMesh *a = expected->mMeshes[i];
+            const aiMesh *b = scene->mMeshes[i];
+            ASSERT_EQ(a->mNumVertices, b->mNumVertices);
+            ASSERT_EQ(a->mNumFaces, b->mNumFaces);
+            EXPECT_EQ(0, memcmp(a->mVertices, b->mVertices, sizeof(aiVector3D) * a->mNumVertices));
+            ASSERT_EQ(a->HasNormals(), b->HasNormals());
+            if (a->HasNormals()) {
+                EXPECT_EQ(0, memcmp(a->mNormals, b->mNormals, sizeof(aiVector3D) * a->mNumVertices));
+            }
+            for (unsigned int f = 0; f < a->mNumFaces; ++f) {
+                ASSERT_EQ(a->mFaces[f].mNumIndices, b->mFaces[f].mNumIndices);
+                EXPECT_EQ(0, memcmp(a->mFaces[f].mIndices, b->mFaces[f].mIndices, sizeof(unsigned int) * a->mFaces[f].mNumIndices));
+            }
+        }
+    }
+
+    // compares every field a cached scene must reproduce
+    static void compareMetadata(const aiMetadata *a, const aiMetadata *b, const std::string &where) {
+        ASSERT_EQ(nullptr == a || 0 == a->mNumProperties, nullptr == b || 0 == b->mNumProperties) << where;
+        if (nullptr == a || nullptr == b) {
+            return;
+        }
+        ASSERT_EQ(a->mNumProperties, b->mNumProperties) << where;
+        for (unsigned int i = 0; i < a->mNumProperties; ++i) {
+            const std::string key = where + "/" + a->mKeys[i].C_Str();
+            EXPECT_EQ(std::string(a->mKeys[i].C_Str()), b->mKeys[i].C_Str()) << key;
+            ASSERT_EQ(a->mValues[i].mType, b->mValues[i].mType) << key;
+            const void *va = a->mValues[i].mData;
+            const void *vb = b->mValues[i].mData;
+            ASSERT_NE(nullptr, va) << key;
+            ASSERT_NE(nullptr, vb) << key;
+            switch (a->mValues[i].mType) {
+            case AI_BOOL:
+                EXPECT_EQ(*static_cast<const bool *>(va), *static_cast<const bool *>(vb)) << key;
+                break;
+            case AI_INT32:
+                EXPECT_EQ(*static_cast<const int32_t *>(va), *static_cast<const int32_t *>(vb)) << key;
+                break;
+            case AI_UINT64:
+                EXPECT_EQ(*static_cast<const uint64_t *>(va), *static_cast<const uint64_t *>(vb)) << key;
+                break;
+            case AI_FLOAT:
+                EXPECT_EQ(*static_cast<const float *>(va), *static_cast<const float *>(vb)) << key;
+                break;
+            case AI_DOUBLE:
+                EXPECT_EQ(*static_cast<const double *>(va), *static_cast<const double *>(vb)) << key;
+                break;
+            case AI_AISTRING:
+                EXPECT_EQ(*static_cast<const aiString *>(va), *static_cast<const aiString *>(vb)) << key;
+                break;
+            case AI_AIVECTOR3D:
+                EXPECT_EQ(*static_cast<const aiVector3D *>(va), *static_cast<const aiVector3D *>(vb)) << key;
+                break;
+            case AI_AIMETADATA:
+                compareMetadata(static_cast<const aiMetadata *>(va), static_cast<const aiMetadata *>(vb), key);
+                break;
+            default:
+                break;
+            }
+        }
+    }
+
+    static void compareNodes(const aiNode *a, const aiNode *b) {
+        ASSERT_NE(nullptr, a);
+        ASSERT_NE(nullptr, b);
+        const std::string where = a->mName.C_Str();
+        EXPECT_EQ(a->mName, b->mName);
+        EXPECT_EQ(a->mTransformation, b->mTransformation) << where;
+        ASSERT_EQ(a->mNumMeshes, b->mNumMeshes) << where;
+        for (unsigned int i = 0; i < a->mNumMeshes; ++i) {
+            EXPECT_EQ(a->mMeshes[i], b->mMeshes[i]) << where;
+        }
+        compareMetadata(a->mMetaData, b->mMetaData, where);
+        ASSERT_EQ(a->mNumChildren, b->mNumChildren) << where;
+        for (unsigned int i = 0; i < a->mNumChildren; ++i) {
+            EXPECT_EQ(b, b->mChildren[i]->mParent) << where;
+            compareNodes(a->mChildren[i], b->mChildren[i]);
+        }
+    }
+
+    static void compareArrays(const void *a, const void *b, size_t size, const std::string &where) {
+        ASSERT_EQ(nullptr == a, nullptr == b) << where;
+        if (nullptr != a && size) {
+            EXPECT_EQ(0, memcmp(a, b, size)) << where;
+        }
+    }
+
+    static void compareMeshFields(const aiMesh *a, const aiMesh *b) {
+        const std::string where = a->mName.C_Str();
+        EXPECT_EQ(a->mName, b->mName);
+        EXPECT_EQ(a->mPrimitiveTypes, b->mPrimitiveTypes) << where;
+        EXPECT_EQ(a->mMaterialIndex, b->mMaterialIndex) << where;
+        EXPECT_EQ(a->mMethod, b->mMethod) << where;
+        EXPECT_EQ(a->mNumAnimMeshes, b->mNumAnimMeshes) << where;
+        EXPECT_EQ(a->mAABB.mMin, b->mAABB.mMin) << where;
+        EXPECT_EQ(a->mAABB.mMax, b->mAABB.mMax) << where;
+        const size_t size = sizeof(aiVector3D) * a->mNumVertices;
+        compareArrays(a->mTangents, b->mTangents, size, where + " tangents");
+        compareArrays(a->mBitangents, b->mBitangents, size, where + " bitangents");
+        for (unsigned int c = 0; c < AI_MAX_NUMBER_OF_COLOR_SETS; ++c) {
+            compareArrays(a->mColors[c], b->mColors[c], sizeof(aiColor4D) * a->mNumVertices, where + " colors");
+        }
+        for (unsigned int t = 0; t < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++t) {
+            compareArrays(a->mTextureCoords[t], b->mTextureCoords[t], size, where + " uvs");
+            EXPECT_EQ(a->mNumUVComponents[t], b->mNumUVComponents[t]) << where;
+            EXPECT_EQ(a->mTextureCoordsNames[t], b->mTextureCoordsNames[t]) << where;
+        }
+
+        ASSERT_EQ(a->mNumBones, b->mNumBones) << where;
+        for (unsigned int i = 0; i < a->mNumBones; ++i) {
+            const aiBone *ba = a->mBones[i];
+            const aiBone *bb = b->mBones[i];
+            const std::string bone = where + "/" + ba->mName.C_Str();
+            EXPECT_EQ(ba->mName, bb->mName) << bone;
+            EXPECT_EQ(ba->mOffsetMatrix, bb->mOffsetMatrix) << bone;
+            ASSERT_EQ(ba->mNumWeights, bb->mNumWeights) << bone;
+            compareArrays(ba->mWeights, bb->mWeights, sizeof(aiVertexWeight) * ba->mNumWeights, bone);
+#ifndef ASSIMP_BUILD_NO_ARMATUREPOPULATE_PROCESS
+            ASSERT_EQ(nullptr == ba->mArmature, nullptr == bb->mArmature) << bone;
+            ASSERT_EQ(nullptr == ba->mNode, nullptr == bb->mNode) << bone;
+            if (ba->mArmature) {
+                EXPECT_EQ(ba->mArmature->mName, bb->mArmature->mName) << bone;
+            }
+            if (ba->mNode) {
+                EXPECT_EQ(ba->mNode->mName, bb->mNode->mName) << bone;
+            }
+#endif
+        }
+    }
+
+    static void compareMaterials(const aiMaterial *a, const aiMaterial *b) {
+        ASSERT_EQ(a->mNumProperties, b->mNumProperties);
+        for (unsigned int i = 0; i < a->mNumProperties; ++i) {
+            const aiMaterialProperty *pa = a->mProperties[i];
+            const aiMaterialProperty *pb = b->mProperties[i];
+            const std::string where = pa->mKey.C_Str();
+            EXPECT_EQ(pa->mKey, pb->mKey);
+            EXPECT_EQ(pa->mSemantic, pb->mSemantic) << where;
+            EXPECT_EQ(pa->mIndex, pb->mIndex) << where;
+            EXPECT_EQ(pa->mType, pb->mType) << where;
+            ASSERT_EQ(pa->mDataLength, pb->mDataLength) << where;
+            EXPECT_EQ(0, memcmp(pa->mData, pb->mData, pa->mDataLength)) << where;
+        }
+    }
+
+    static void compareAnimations(const aiAnimation *a, const aiAnimation *b) {
+        const std::string where = a->mName.C_Str();
+        EXPECT_EQ(a->mName, b->mName);
+        EXPECT_EQ(a->mDuration, b->mDuration) << where;
+        EXPECT_EQ(a->mTicksPerSecond, b->mTicksPerSecond) << where;
+        ASSERT_EQ(a->mNumChannels, b->mNumChannels) << where;
+        for (unsigned int i = 0; i < a->mNumChannels; ++i) {
+            const aiNodeAnim *ca = a->mChannels[i];
+            const aiNodeAnim *cb = b->mChannels[i];
+            const std::string channel = where + "/" + ca->mNodeName.C_Str();
+            EXPECT_EQ(ca->mNodeName, cb->mNodeName) << channel;
+            ASSERT_EQ(ca->mNumPositionKeys, cb->mNumPositionKeys) << channel;
+            ASSERT_EQ(ca->mNumRotationKeys, cb->mNumRotationKeys) << channel;
+            ASSERT_EQ(ca->mNumScalingKeys, cb->mNumScalingKeys) << channel;
+            // the keys have padding, compare them member by member
+            for (unsigned int k = 0; k < ca->mNumPositionKeys; ++k) {
+                EXPECT_EQ(ca->mPositionKeys[k].mTime, cb->mPositionKeys[k].mTime) << channel;
+                EXPECT_EQ(ca->mPositionKeys[k].mValue, cb->mPositionKeys[k].mValue) << channel;
+            }
+            for (unsigned int k = 0; k < ca->mNumRotationKeys; ++k) {
+                EXPECT_EQ(ca->mRotationKeys[k].mTime, cb->mRotationKeys[k].mTime) << channel;
+                EXPECT_EQ(ca->mRotationKeys[k].mValue, cb->mRotationKeys[k].mValue) << channel;
+            }
+            for (unsigned int k = 0; k < ca->mNumScalingKeys; ++k) {
+                EXPECT_EQ(ca->mScalingKeys[k].mTime, cb->mScalingKeys[k].mTime) << channel;
+                EXPECT_EQ(ca->mScalingKeys[k].mValue, cb->mScalingKeys[k].mValue) << channel;
+            }
+            EXPECT_EQ(ca->mPreState, cb->mPreState) << channel;
+            EXPECT_EQ(ca->mPostState, cb->mPostState) << channel;
+        }
+        EXPECT_EQ(a->mNumMeshChannels, b->mNumMeshChannels) << where;
+        EXPECT_EQ(a->mNumMorphMeshChannels, b->mNumMorphMeshChannels) << where;
+    }
+
+    static void compareAllFields(const aiScene *expected, const aiScene *scene) {
+        compareScenes(expected, scene);
+        EXPECT_EQ(expected->mFlags, scene->mFlags);
+        EXPECT_EQ(expected->mName, scene->mName);
+        compareMetadata(expected->mMetaData, scene->mMetaData, "scene");
+        compareNodes(expected->mRootNode, scene->mRootNode);
+        for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+            compareMeshFields(expected->mMeshes[i], scene->mMeshes[i]);
+        }
+        for (unsigned int i = 0; i < scene->mNumMaterials; ++i) {
+            compareMaterials(expected->mMaterials[i], scene->mMaterials[i]);
+        }
+        ASSERT_EQ(expected->mNumAnimations, scene->mNumAnimations);
+        for (unsigned int i = 0; i < scene->mNumAnimations; ++i) {
+            compareAnimations(expected->mAnimations[i], scene->mAnimations[i]);
+        }
+        ASSERT_EQ(expected->mNumTextures, scene->mNumTextures);
+        ASSERT_EQ(expected->mNumLights, scene->mNumLights);
+        ASSERT_EQ(expected->mNumCameras, scene->mNumCameras);
+    }
+};
+
+TEST_F(utImportCache, disabledByDefaultTest) {
+    const std::string obj = MakeGrid(4, UniqueToken());
+
+    Importer importer;
+    importer.SetPropertyInteger(AI_CONFIG_GLOB_MEASURE_TIME, 1);
+    ASSERT_NE(nullptr, importer.ReadFileFromMemory(obj.c_str(), obj.size(), 0, "obj"));
+    EXPECT_TRUE(wasImported(importer));
+    EXPECT_EQ(nullptr, findRegion(importer, "cache"));
+}
+
+TEST_F(utImportCache, missThenHitTest) {
+    const std::string obj = MakeGrid(8, UniqueToken());
+    const unsigned int flags = aiProcess_Triangulate | aiProcess_GenSmoothNormals | aiProcess_JoinIdenticalVertices;
+
+    Importer first;
+    setupCache(first);
+    const aiScene *expected = first.ReadFileFromMemory(obj.c_str(), obj.size(), flags, "obj");
+    ASSERT_NE(nullptr, expected);
+    EXPECT_TRUE(wasImported(first));
+    EXPECT_NE(nullptr, findRegion(first, "cache"));
+
+    Importer second;
+    setupCache(second);
+    const aiScene *scene = second.ReadFileFromMemory(obj.c_str(), obj.size(), flags, "obj");
+    EXPECT_FALSE(wasImported(second));
+    compareScenes(expected, scene);
+    ASSERT_NE(nullptr, second.GetImportStatistics());
+    EXPECT_EQ(scene->mMeshes[0]->mNumFaces, second.GetImportStatistics()->mNumFaces);
+
+    // the exporter must not apply the steps of the import again
+    EXPECT_EQ(ScenePriv(expected)->mPPStepsApplied, ScenePriv(scene)->mPPStepsApplied);
+}
+
+TEST_F(utImportCache, flagsAndPropertiesArePartOfTheKeyTest) {
+    const std::string obj = MakeGrid(8, UniqueToken());
+
+    Importer importer;
+    setupCache(importer);
+    ASSERT_NE(nullptr, importer.ReadFileFromMemory(obj.c_str(), obj.size(), 0, "obj"));
+    EXPECT_TRUE(wasImported(importer));
+
+    // other post processing steps
+    ASSERT_NE(nullptr, importer.ReadFileFromMemory(obj.c_str(), obj.size(), aiProcess_Triangulate, "obj"));
+    EXPECT_TRUE(wasImported(importer));
+    EXPECT_EQ(3u, importer.GetScene()->mMeshes[0]->mFaces[0].mNumIndices);
+
+    // other import properties
+    importer.SetPropertyBool(AI_CONFIG_IMPORT_NO_SKELETON_MESHES, true);
+    ASSERT_NE(nullptr, importer.ReadFileFromMemory(obj.c_str(), obj.size(), aiProcess_Triangulate, "obj"));
+    EXPECT_TRUE(wasImported(importer));
+
+    // settings which don't change the scene share the entry
+    importer.SetPropertyBool(AI_CONFIG_GLOB_SCENE_ARENA, true);
+    importer.SetPropertyInteger(AI_CONFIG_GLOB_MULTITHREADING, 2);
+    ASSERT_NE(nullptr, importer.ReadFileFromMemory(obj.c_str(), obj.size(), aiProcess_Triangulate, "obj"));
+    EXPECT_FALSE(wasImported(importer));
+}
+
+TEST_F(utImportCache, changedDependencyInvalidatesEntryTest) {
+    const char *objFile = "importCacheTest.obj";
+    const char *mtlFile = "importCacheTest.mtl";
+    WriteFile(objFile, MakeGrid(4, UniqueToken(), mtlFile));
+    WriteFile(mtlFile, "newmtl surface\nKd 1 0 0\n");
+
+    Importer importer;
+    setupCache(importer);
+    ASSERT_NE(nullptr, importer.ReadFile(objFile, 0));
+    EXPECT_TRUE(wasImported(importer));
+    ASSERT_NE(nullptr, importer.ReadFile(objFile, 0));
+    EXPECT_FALSE(wasImported(importer));
+
+    WriteFile(mtlFile, "newmtl surface\nKd 0 1 0\n");
+    const aiScene *scene = importer.ReadFile(objFile, 0);
+    ASSERT_NE(nullptr, scene);
+    EXPECT_TRUE(wasImported(importer));
+
+    const aiMaterial *material = scene->mMaterials[scene->mMeshes[0]->mMaterialIndex];
+    aiColor3D diffuse;
+    ASSERT_EQ(aiReturn_SUCCESS, material->Get(AI_MATKEY_COLOR_DIFFUSE, diffuse));
+    EXPECT_EQ(aiColor3D(0, 1, 0), diffuse);
+
+    remove(objFile);
+    remove(mtlFile);
+}
+
+TEST_F(utImportCache, sizeLimitEvictsOldEntriesTest) {
+    // each entry takes about 570 kB, the limit leaves room for one
+    const std::string a = MakeGrid(100, UniqueToken());
+    const std::string b = MakeGrid(100, UniqueToken());
+    const int maxSize = 1024;
+
+    Importer importer;
+    setupCache(importer, maxSize);
+    ASSERT_NE(nullptr, importer.ReadFileFromMemory(a.c_str(), a.size(), 0, "obj"));
+    EXPECT_TRUE(wasImported(importer));
+    ASSERT_NE(nullptr, importer.ReadFileFromMemory(a.c_str(), a.size(), 0, "obj"));
+    EXPECT_FALSE(wasImported(importer));
+
+    ASSERT_NE(nullptr, importer.ReadFileFromMemory(b.c_str(), b.size(), 0, "obj"));
+    EXPECT_TRUE(wasImported(importer));
+    ASSERT_NE(nullptr, importer.ReadFileFromMemory(a.c_str(), a.size(), 0, "obj"));
+    EXPECT_TRUE(wasImported(importer));
+}
+
+TEST_F(utImportCache, damagedEntryIsReplacedTest) {
+    const char *objFile = "importCacheTest_damaged.obj";
+    WriteFile(objFile, MakeGrid(8, UniqueToken()));
+
+    Importer importer;
+    setupCache(importer);
+    RecordingIOSystem *io = new RecordingIOSystem;
+    importer.SetIOHandler(io);
+    ASSERT_NE(nullptr, importer.ReadFile(objFile, 0));
+    EXPECT_TRUE(wasImported(importer));
+    ASSERT_EQ(1u, io->mRenamed.size());
+    const std::string entry = io->mRenamed.back();
+
+    // cut the entry short, its stored size does not match anymore
+    FILE *file = fopen(entry.c_str(), "rb");
+    ASSERT_NE(nullptr, file);
+    std::string content(1024, '\0');
+    content.resize(fread(&content[0], 1, content.size(), file));
+    fclose(file);
+    WriteFile(entry.c_str(), content);
+
+    ASSERT_NE(nullptr, importer.ReadFile(objFile, 0));
+    EXPECT_TRUE(wasImported(importer));
+    ASSERT_EQ(2u, io->mRenamed.size());
+    EXPECT_EQ(entry, io->mRenamed.back());
+
+    ASSERT_NE(nullptr, importer.ReadFile(objFile, 0));
+    EXPECT_FALSE(wasImported(importer));
+
+    remove(objFile);
+}
+
+TEST_F(utImportCache, hitEqualsFreshImportTest) {
+    const char *file = ASSIMP_TEST_MODELS_DIR "/FBX/huesitos.fbx";
+    const unsigned int flags = aiProcess_Triangulate | aiProcess_PopulateArmatureData | aiProcess_GenBoundingBoxes;
+    const std::string token = UniqueToken();
+
+    // any property not known to the cache makes the key unique
+    Importer first;
+    setupCache(first);
+    first.SetPropertyString("utImportCache.token", token);
+    const aiScene *expected = first.ReadFile(file, flags);
+    ASSERT_NE(nullptr, expected);
+    EXPECT_TRUE(wasImported(first));
+    ASSERT_NE(nullptr, expected->mMetaData);
+    EXPECT_LT(1u, expected->mMetaData->mNumProperties);
+
+    Importer second;
+    setupCache(second);
+    second.SetPropertyString("utImportCache.token", token);
+    const aiScene *scene = second.ReadFile(file, flags);
+    ASSERT_NE(nullptr, scene);
+    EXPECT_FALSE(wasImported(second));
+    compareAllFields(expected, scene);
+}
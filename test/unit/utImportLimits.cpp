@@ -0,0 +1,313 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2021, assimp team
+
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+#include "UnitTestPCH.h"
+
+#include "Common/TaskScheduler.h"
+#include <assimp/Allocator.h>
+#include <assimp/ImportLimits.h>
+#include <assimp/SceneGenerator.h>
+#include <assimp/config.h>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+#include <assimp/Exporter.hpp>
+#include <assimp/Importer.hpp>
+
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <string>
+
+using namespace Assimp;
+
+class utImportLimits : public ::testing::Test {
+protected:
+    // An OBJ file with one mesh of the given number of triangles
+    static std::string generateObj(unsigned int numTriangles) {
+        SceneGenerator::Params params;
+        params.mNumTriangles = numTriangles;
+        std::unique_ptr<aiScene> scene(SceneGenerator::Generate(params));
+
+        Exporter exporter;
+        const aiExportDataBlob *blob = exporter.ExportToBlob(scene.get(), "obj");
+        EXPECT_NE(nullptr, blob);
+        return blob ? std::string(static_cast<const char *>(blob->data), blob->size) : std::string();
+    }
+
+    // Returns the kind of the limit which made the last import fail
+    static int failedLimit(const Importer &importer) {
+        try {
+            std::rethrow_exception(importer.GetException());
+        } catch (const ImportLimitError &e) {
+            return e.GetKind();
+        } catch (...) {
+        }
+        return -1;
+    }
+};
+
+TEST_F(utImportLimits, budgetTest) {
+    ImportLimits limits(1000, 0);
+    ImportLimits::Scope scope(&limits);
+    ASSERT_EQ(&limits, ImportLimits::GetActive());
+
+    ImportLimits::Allocate(600);
+    EXPECT_EQ(600u, limits.GetUsedBytes());
+    {
+        // reservations stay charged until they are released
+        ImportLimits::Reservation reserved(50, 4);
+        reserved.Add(25, 4);
+        EXPECT_EQ(300u, reserved.GetBytes());
+        EXPECT_EQ(900u, limits.GetUsedBytes());
+        reserved.Release();
+        EXPECT_EQ(600u, limits.GetUsedBytes());
+
+        ImportLimits::Reservation other(100, 4);
+        EXPECT_EQ(1000u, limits.GetUsedBytes());
+    }
+    EXPECT_EQ(600u, limits.GetUsedBytes());
+    EXPECT_THROW(ImportLimits::Reservation(101, 4), ImportLimitError);
+    EXPECT_EQ(600u, limits.GetUsedBytes());
+    ImportLimits::Free(600);
+
+    // the failure sticks
+    EXPECT_EQ(0u, limits.GetUsedBytes());
+    EXPECT_THROW(ImportLimits::Allocate(1), ImportLimitError);
+    EXPECT_THROW(ImportLimits::CheckDeadline(), ImportLimitError);
+}
+
+TEST_F(utImportLimits, scopeTest) {
+    EXPECT_EQ(nullptr, ImportLimits::GetActive());
+
+    // nothing is enforced without limits, except for overflows
+    EXPECT_NO_THROW(ImportLimits::Allocate(~size_t(0)));
+    EXPECT_THROW(ImportLimits::Reservation(~uint64_t(0), 16), DeadlyImportError);
+
+    ImportLimits outer(0, 0), inner(0, 0);
+    {
+        ImportLimits::Scope outerScope(&outer);
+        {
+            ImportLimits::Scope innerScope(&inner);
+            EXPECT_EQ(&inner, ImportLimits::GetActive());
+            ImportLimits::Scope keepScope(nullptr);
+            EXPECT_EQ(&inner, ImportLimits::GetActive());
+        }
+        EXPECT_EQ(&outer, ImportLimits::GetActive());
+
+        // worker threads inherit the limits of the caller
+        TaskScheduler scheduler(4);
+        std::atomic<int> matches(0);
+        scheduler.ParallelFor(64, [&](size_t) {
+            matches += ImportLimits::GetActive() == &outer;
+        });
+        EXPECT_EQ(64, matches);
+    }
+    EXPECT_EQ(nullptr, ImportLimits::GetActive());
+}
+
+TEST_F(utImportLimits, reservationResizeTest) {
+    const size_t block = ImportLimits::Reservation::BlockSize;
+    ImportLimits limits(10 * block, 0);
+    ImportLimits::Reservation outlived;
+    {
+        ImportLimits::Scope scope(&limits);
+
+        // growing buffers are charged in blocks
+        ImportLimits::Reservation reserved;
+        reserved.Resize(1);
+        EXPECT_EQ(block, limits.GetUsedBytes());
+        reserved.Resize(block);
+        EXPECT_EQ(block, limits.GetUsedBytes());
+        reserved.Resize(3 * block + 1);
+        EXPECT_EQ(4 * block, reserved.GetBytes());
+        EXPECT_EQ(4 * block, limits.GetUsedBytes());
+        reserved.Resize(block / 2);
+        EXPECT_EQ(block, limits.GetUsedBytes());
+
+        ImportLimits::Reservation moved(std::move(reserved));
+        EXPECT_EQ(0u, reserved.GetBytes());
+        EXPECT_EQ(block, moved.GetBytes());
+        EXPECT_THROW(moved.Resize(11 * block), ImportLimitError);
+
+        outlived = std::move(moved);
+    }
+
+    // the charge of an import isn't returned once its limits are gone
+    ImportLimits other(10 * block, 0);
+    ImportLimits::Scope scope(&other);
+    outlived.Release();
+    EXPECT_EQ(0u, other.GetUsedBytes());
+    EXPECT_EQ(block, limits.GetUsedBytes());
+}
+
+TEST_F(utImportLimits, sceneArraysTest) {
+    ImportLimits limits(1000, 0);
+    ImportLimits::Scope scope(&limits);
+
+    // the arrays of the scene count against the budget while they are alive
+    unsigned int *indices = AllocateSceneArray<unsigned int>(100);
+    EXPECT_EQ(400u, limits.GetUsedBytes());
+    aiVector3D *vertices = new aiVector3D[10];
+    EXPECT_EQ(400u + 10 * sizeof(aiVector3D), limits.GetUsedBytes());
+    delete[] vertices;
+    FreeSceneArray(indices);
+    EXPECT_EQ(0u, limits.GetUsedBytes());
+
+    EXPECT_THROW(AllocateSceneArray<unsigned int>(251), ImportLimitError);
+}
+
+TEST_F(utImportLimits, parserBuffersTest) {
+    // each element fits into the budget, both together don't
+    std::string ply =
+            "ply\n"
+            "format ascii 1.0\n"
+            "element vertex 3\n"
+            "property float x\n"
+            "property float y\n"
+            "property float z\n"
+            "element edge 150000\n"
+            "property int vertex1\n"
+            "element edge 150000\n"
+            "property int vertex2\n"
+            "end_header\n"
+            "0 0 0\n"
+            "1 0 0\n"
+            "0 1 0\n";
+    for (unsigned int i = 0; i < 300000; ++i) {
+        ply += "1\n";
+    }
+
+    Importer importer;
+    importer.SetPropertyInteger(AI_CONFIG_IMPORT_MAX_MEMORY, 1);
+    EXPECT_EQ(nullptr, importer.ReadFileFromMemory(ply.data(), ply.size(), 0, "ply"));
+    EXPECT_EQ(ImportLimitError::Memory, failedLimit(importer));
+
+    importer.SetPropertyInteger(AI_CONFIG_IMPORT_MAX_MEMORY, 2);
+    EXPECT_NE(nullptr, importer.ReadFileFromMemory(ply.data(), ply.size(), 0, "ply"));
+}
+
+TEST_F(utImportLimits, elementCountTest) {
+    // a header announcing billions of elements must not be trusted
+    static const char ply[] =
+            "ply\n"
+            "format ascii 1.0\n"
+            "element vertex 3\n"
+            "property float x\n"
+            "property float y\n"
+            "property float z\n"
+            "element edge 4000000000\n"
+            "property int vertex1\n"
+            "end_header\n"
+            "0 0 0\n"
+            "1 0 0\n"
+            "0 1 0\n"
+            "1\n";
+
+    Importer importer;
+    importer.SetPropertyInteger(AI_CONFIG_IMPORT_MAX_MEMORY, 64);
+    EXPECT_EQ(nullptr, importer.ReadFileFromMemory(ply, sizeof(ply) - 1, 0, "ply"));
+    EXPECT_EQ(ImportLimitError::Memory, failedLimit(importer));
+}
+
+TEST_F(utImportLimits, memoryBudgetTest) {
+    const std::string obj = generateObj(20000);
+    ASSERT_FALSE(obj.empty());
+
+    CountingAllocator counter;
+    {
+        Importer importer;
+        importer.SetAllocator(&counter);
+        importer.SetPropertyInteger(AI_CONFIG_IMPORT_MAX_MEMORY, 1);
+        EXPECT_EQ(nullptr, importer.ReadFileFromMemory(obj.data(), obj.size(), aiProcess_JoinIdenticalVertices, "obj"));
+        EXPECT_EQ(ImportLimitError::Memory, failedLimit(importer));
+        EXPECT_NE(nullptr, strstr(importer.GetErrorString(), "memory budget"));
+
+        // the partial scene is gone
+        EXPECT_EQ(0u, counter.GetCurrentBytes());
+
+        importer.SetPropertyInteger(AI_CONFIG_IMPORT_MAX_MEMORY, 256);
+        const aiScene *scene = importer.ReadFileFromMemory(obj.data(), obj.size(), aiProcess_JoinIdenticalVertices, "obj");
+        ASSERT_NE(nullptr, scene);
+        EXPECT_EQ(20000u, scene->mMeshes[0]->mNumFaces);
+    }
+    EXPECT_EQ(0u, counter.GetCurrentBytes());
+}
+
+TEST_F(utImportLimits, previousSceneDoesNotCountTest) {
+    const std::string large = generateObj(100000);
+    const std::string small = generateObj(10000);
+    ASSERT_FALSE(large.empty());
+    ASSERT_FALSE(small.empty());
+
+    // the smallest budget the small file fits in
+    int budget = 1;
+    for (; budget < 64; ++budget) {
+        Importer fresh;
+        fresh.SetPropertyInteger(AI_CONFIG_IMPORT_MAX_MEMORY, budget);
+        if (nullptr != fresh.ReadFileFromMemory(small.data(), small.size(), 0, "obj")) {
+            break;
+        }
+    }
+    ASSERT_LT(1, budget);
+    ASSERT_GT(64, budget);
+
+    // releasing the scene of the first import must not make room in the budget of the second
+    Importer importer;
+    ASSERT_NE(nullptr, importer.ReadFileFromMemory(large.data(), large.size(), 0, "obj"));
+    importer.SetPropertyInteger(AI_CONFIG_IMPORT_MAX_MEMORY, budget - 1);
+    EXPECT_EQ(nullptr, importer.ReadFileFromMemory(small.data(), small.size(), 0, "obj"));
+    EXPECT_EQ(ImportLimitError::Memory, failedLimit(importer));
+}
+
+TEST_F(utImportLimits, deadlineTest) {
+    const std::string obj = generateObj(20000);
+    ASSERT_FALSE(obj.empty());
+
+    Importer importer;
+    importer.SetPropertyInteger(AI_CONFIG_IMPORT_TIMEOUT, 1);
+    EXPECT_EQ(nullptr, importer.ReadFileFromMemory(obj.data(), obj.size(), aiProcessPreset_TargetRealtime_MaxQuality, "obj"));
+    EXPECT_EQ(ImportLimitError::Deadline, failedLimit(importer));
+
+    // limits apply per import
+    importer.SetPropertyInteger(AI_CONFIG_IMPORT_TIMEOUT, 0);
+    EXPECT_NE(nullptr, importer.ReadFileFromMemory(obj.data(), obj.size(), 0, "obj"));
+}
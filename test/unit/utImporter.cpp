@@ -47,6 +47,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/DefaultIOSystem.h>
 #include <assimp/Importer.hpp>
 
+#include <fstream>
+#include <iterator>
+
 using namespace ::std;
 using namespace ::Assimp;
 
@@ -361,3 +364,56 @@ TEST_F(ImporterTest, unexpectedException) {
         EXPECT_TRUE(false);
     }
 }
+
+namespace {
+// Counts how often each file is opened.
+class OpenCountingIOSystem : public DefaultIOSystem {
+public:
+    IOStream *Open(const char *pFile, const char *pMode = "rb") override {
+        ++mOpenCount[pFile];
+        return DefaultIOSystem::Open(pFile, pMode);
+    }
+
+    std::map<std::string, unsigned int> mOpenCount;
+};
+} // namespace
+
+TEST_F(ImporterTest, fileIsOpenedOnce) {
+    static const char *files[] = {
+        ASSIMP_TEST_MODELS_DIR "/PLY/cube_binary.ply",
+        ASSIMP_TEST_MODELS_DIR "/STL/Spider_ascii.stl",
+        ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj",
+        ASSIMP_TEST_MODELS_DIR "/FBX/spider.fbx"
+    };
+    for (const char *file : files) {
+        OpenCountingIOSystem *io = new OpenCountingIOSystem;
+        pImp->SetIOHandler(io);
+        EXPECT_NE(nullptr, pImp->ReadFile(file, aiProcess_ValidateDataStructure)) << file;
+        EXPECT_EQ(1u, io->mOpenCount[file]) << file;
+    }
+}
+
+TEST_F(ImporterTest, signatureDetectionWithUnknownExtension) {
+    std::ifstream in(ASSIMP_TEST_MODELS_DIR "/PLY/cube_binary.ply", std::ios::binary);
+    ASSERT_TRUE(in.good());
+    const std::vector<char> data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+    const aiScene *scene = pImp->ReadFileFromMemory(&data[0], data.size(), aiProcess_ValidateDataStructure, "bin");
+    ASSERT_NE(nullptr, scene);
+    EXPECT_EQ(pImp->GetImporterIndex("ply"), static_cast<size_t>(pImp->GetPropertyInteger("importerIndex", -1)));
+}
+
+TEST_F(ImporterTest, importerIndexByExtension) {
+    const size_t index = pImp->GetImporterIndex("*.OBJ");
+    ASSERT_NE(static_cast<size_t>(-1), index);
+    EXPECT_EQ(index, pImp->GetImporterIndex(".obj"));
+    EXPECT_EQ(static_cast<size_t>(-1), pImp->GetImporterIndex("no_such_extension"));
+
+    pImp->RegisterLoader(new TestPlugin());
+    EXPECT_NE(static_cast<size_t>(-1), pImp->GetImporterIndex("apple"));
+    BaseImporter *plugin = pImp->GetImporter("apple");
+    pImp->UnregisterLoader(plugin);
+    delete plugin;
+    EXPECT_EQ(static_cast<size_t>(-1), pImp->GetImporterIndex("apple"));
+    EXPECT_EQ(index, pImp->GetImporterIndex("obj"));
+}
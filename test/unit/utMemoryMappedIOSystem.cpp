@@ -0,0 +1,136 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2021, assimp team
+
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+#include "UnitTestPCH.h"
+
+#include <assimp/MemoryMappedIOSystem.h>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+#include <assimp/Importer.hpp>
+
+#include <memory>
+
+using namespace Assimp;
+
+class utMemoryMappedIOSystem : public ::testing::Test {
+protected:
+    // Imports a file once through the default and once through the mapped io system
+    // and compares the resulting vertex data.
+    void compareWithDefaultIO(const char *file) {
+        Importer defaultImporter;
+        const aiScene *expected = defaultImporter.ReadFile(file, aiProcess_ValidateDataStructure);
+        ASSERT_NE(nullptr, expected);
+
+        Importer mappedImporter;
+        mappedImporter.SetIOHandler(new MemoryMappedIOSystem);
+        const aiScene *scene = mappedImporter.ReadFile(file, aiProcess_ValidateDataStructure);
+        ASSERT_NE(nullptr, scene);
+
+        ASSERT_EQ(expected->mNumMeshes, scene->mNumMeshes);
+        for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+            const aiMesh *a = expected->mMeshes[i];
+            const aiMesh *b = scene->mMeshes[i];
+            ASSERT_EQ(a->mNumVertices, b->mNumVertices);
+            ASSERT_EQ(a->mNumFaces, b->mNumFaces);
+            EXPECT_EQ(0, memcmp(a->mVertices, b->mVertices, sizeof(aiVector3D) * a->mNumVertices));
+        }
+    }
+};
+
+TEST_F(utMemoryMappedIOSystem, ReadTest) {
+    MemoryMappedIOSystem io;
+    std::unique_ptr<IOStream> stream(io.Open(ASSIMP_TEST_MODELS_DIR "/STL/triangle.stl", "rb"));
+    ASSERT_NE(nullptr, stream);
+
+    const size_t size = stream->FileSize();
+    ASSERT_NE(0u, size);
+    const uint8_t *view = stream->GetContiguousView();
+    ASSERT_NE(nullptr, view);
+
+    std::vector<uint8_t> data(size);
+    EXPECT_EQ(1u, stream->Read(&data[0], size, 1));
+    EXPECT_EQ(size, stream->Tell());
+    EXPECT_EQ(0, memcmp(&data[0], view, size));
+    EXPECT_EQ(0u, stream->Read(&data[0], 1, 1));
+
+    EXPECT_EQ(aiReturn_SUCCESS, stream->Seek(1, aiOrigin_END));
+    EXPECT_EQ(size - 1, stream->Tell());
+    EXPECT_EQ(aiReturn_FAILURE, stream->Seek(2, aiOrigin_CUR));
+    EXPECT_EQ(aiReturn_SUCCESS, stream->Seek(0, aiOrigin_SET));
+    EXPECT_EQ(0u, stream->Tell());
+}
+
+TEST_F(utMemoryMappedIOSystem, WriteModeFallsBackToDefaultIO) {
+    MemoryMappedIOSystem io;
+    std::unique_ptr<IOStream> stream(io.Open(ASSIMP_TEST_MODELS_DIR "/STL/triangle.stl", "rb+"));
+    ASSERT_NE(nullptr, stream);
+    EXPECT_EQ(nullptr, stream->GetContiguousView());
+}
+
+TEST_F(utMemoryMappedIOSystem, MissingFileTest) {
+    MemoryMappedIOSystem io;
+    EXPECT_EQ(nullptr, io.Open(ASSIMP_TEST_MODELS_DIR "/STL/does_not_exist.stl", "rb"));
+}
+
+TEST_F(utMemoryMappedIOSystem, importBinarySTLTest) {
+    compareWithDefaultIO(ASSIMP_TEST_MODELS_DIR "/STL/Spider_binary.stl");
+}
+
+TEST_F(utMemoryMappedIOSystem, importAsciiSTLTest) {
+    compareWithDefaultIO(ASSIMP_TEST_MODELS_DIR "/STL/Spider_ascii.stl");
+}
+
+TEST_F(utMemoryMappedIOSystem, importBinaryPLYTest) {
+    compareWithDefaultIO(ASSIMP_TEST_MODELS_DIR "/PLY/cube_binary.ply");
+}
+
+TEST_F(utMemoryMappedIOSystem, importBinaryFBXTest) {
+    compareWithDefaultIO(ASSIMP_TEST_MODELS_DIR "/FBX/spider.fbx");
+}
+
+TEST_F(utMemoryMappedIOSystem, importGLBTest) {
+    compareWithDefaultIO(ASSIMP_TEST_MODELS_DIR "/glTF2/BoxTextured-glTF-Binary/BoxTextured.glb");
+}
+
+TEST_F(utMemoryMappedIOSystem, importGLTFWithExternalBufferTest) {
+    compareWithDefaultIO(ASSIMP_TEST_MODELS_DIR "/glTF2/BoxTextured-glTF/BoxTextured.gltf");
+}
@@ -0,0 +1,233 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2021, assimp team
+
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+#include "UnitTestPCH.h"
+
+#include <assimp/SceneCombiner.h>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+#include <assimp/Importer.hpp>
+
+using namespace Assimp;
+
+class utMeshFaces : public ::testing::Test {
+protected:
+    // every face of every mesh must live in the index block of its mesh
+    static void checkFacesInBlock(const aiScene *scene) {
+        ASSERT_NE(nullptr, scene);
+        ASSERT_LT(0u, scene->mNumMeshes);
+        for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+            const aiMesh *mesh = scene->mMeshes[i];
+            ASSERT_NE(nullptr, mesh->mFaceIndices);
+            unsigned int numIndices = 0;
+            for (unsigned int f = 0; f < mesh->mNumFaces; ++f) {
+                const aiFace &face = mesh->mFaces[f];
+                EXPECT_TRUE(mesh->IsInFaceIndexBlock(face.mIndices));
+                EXPECT_TRUE(mesh->IsInFaceIndexBlock(face.mIndices + face.mNumIndices - 1));
+                numIndices += face.mNumIndices;
+            }
+            EXPECT_LE(numIndices, mesh->mNumFaceIndices);
+        }
+    }
+
+    static void checkImport(const char *file, unsigned int flags) {
+        Importer importer;
+        const aiScene *scene = importer.ReadFile(file, flags | aiProcess_ValidateDataStructure);
+        checkFacesInBlock(scene);
+    }
+};
+
+TEST_F(utMeshFaces, allocateUniformFacesTest) {
+    aiMesh mesh;
+    unsigned int *indices = mesh.AllocateUniformFaces(4, 3);
+    ASSERT_NE(nullptr, indices);
+    EXPECT_EQ(indices, mesh.mFaceIndices);
+    EXPECT_EQ(4u, mesh.mNumFaces);
+    EXPECT_EQ(12u, mesh.mNumFaceIndices);
+    for (unsigned int f = 0; f < mesh.mNumFaces; ++f) {
+        EXPECT_EQ(3u, mesh.mFaces[f].mNumIndices);
+        EXPECT_EQ(indices + f * 3, mesh.mFaces[f].mIndices);
+    }
+
+    mesh.FreeFaces();
+    EXPECT_EQ(nullptr, mesh.mFaces);
+    EXPECT_EQ(nullptr, mesh.mFaceIndices);
+    EXPECT_EQ(0u, mesh.mNumFaces);
+    EXPECT_EQ(0u, mesh.mNumFaceIndices);
+}
+
+TEST_F(utMeshFaces, mixedFaceStorageTest) {
+    aiMesh *mesh = new aiMesh();
+    mesh->AllocateUniformFaces(3, 3);
+
+    // a face may still get an index array of its own
+    unsigned int *own = new unsigned int[4]{ 0, 1, 2, 3 };
+    mesh->FreeFaceIndices(mesh->mFaces[1]);
+    EXPECT_EQ(nullptr, mesh->mFaces[1].mIndices);
+    mesh->mFaces[1].mIndices = own;
+    mesh->mFaces[1].mNumIndices = 4;
+    EXPECT_FALSE(mesh->IsInFaceIndexBlock(own));
+    EXPECT_TRUE(mesh->IsInFaceIndexBlock(mesh->mFaces[2].mIndices));
+
+    // deleting the mesh frees both the block and the face's own array
+    delete mesh;
+}
+
+TEST_F(utMeshFaces, assignFaceInBlockTest) {
+    aiMesh *mesh = new aiMesh();
+    unsigned int *indices = mesh->AllocateUniformFaces(2, 3);
+    for (unsigned int i = 0; i < 6; ++i) {
+        indices[i] = i;
+    }
+
+    // the assigned face gets an array of its own, the block is untouched
+    aiFace line;
+    line.mNumIndices = 2;
+    line.mIndices = new unsigned int[2]{ 7, 8 };
+    mesh->FreeFaceIndices(mesh->mFaces[0]);
+    mesh->mFaces[0] = line;
+    EXPECT_FALSE(mesh->IsInFaceIndexBlock(mesh->mFaces[0].mIndices));
+    EXPECT_EQ(2u, mesh->mFaces[0].mNumIndices);
+    EXPECT_EQ(8u, mesh->mFaces[0].mIndices[1]);
+    EXPECT_EQ(0u, indices[0]);
+    EXPECT_EQ(1u, indices[1]);
+
+    // a copy of a face in the block owns its indices
+    aiFace copy(mesh->mFaces[1]);
+    EXPECT_FALSE(mesh->IsInFaceIndexBlock(copy.mIndices));
+    EXPECT_EQ(copy, mesh->mFaces[1]);
+
+    // assigning a face in the block copies it as well
+    aiFace other;
+    other = mesh->mFaces[1];
+    EXPECT_FALSE(mesh->IsInFaceIndexBlock(other.mIndices));
+    EXPECT_EQ(indices + 3, mesh->mFaces[1].mIndices);
+
+    delete mesh;
+}
+
+TEST_F(utMeshFaces, joinMeshesTest) {
+    std::vector<aiMesh *> meshes;
+    for (unsigned int m = 0; m < 2; ++m) {
+        aiMesh *mesh = new aiMesh();
+        mesh->mPrimitiveTypes = aiPrimitiveType_TRIANGLE;
+        mesh->mNumVertices = 3;
+        mesh->mVertices = new aiVector3D[3];
+        unsigned int *indices = mesh->AllocateUniformFaces(2, 3);
+        for (unsigned int i = 0; i < 6; ++i) {
+            indices[i] = i % 3;
+        }
+        meshes.push_back(mesh);
+    }
+
+    // one face of the second mesh owns its indices, it keeps them
+    unsigned int *own = new unsigned int[3]{ 2, 1, 0 };
+    meshes[1]->FreeFaceIndices(meshes[1]->mFaces[0]);
+    meshes[1]->mFaces[0].mNumIndices = 3;
+    meshes[1]->mFaces[0].mIndices = own;
+
+    aiMesh *out = nullptr;
+    SceneCombiner::MergeMeshes(&out, 0, meshes.begin(), meshes.end());
+    ASSERT_NE(nullptr, out);
+    ASSERT_EQ(4u, out->mNumFaces);
+    EXPECT_EQ(9u, out->mNumFaceIndices);
+    EXPECT_EQ(own, out->mFaces[2].mIndices);
+    EXPECT_FALSE(out->IsInFaceIndexBlock(out->mFaces[2].mIndices));
+    EXPECT_EQ(5u, out->mFaces[2].mIndices[0]);
+    for (unsigned int f = 0; f < out->mNumFaces; ++f) {
+        if (f != 2) {
+            EXPECT_TRUE(out->IsInFaceIndexBlock(out->mFaces[f].mIndices));
+        }
+        for (unsigned int i = 0; i < 3; ++i) {
+            EXPECT_EQ(f < 2 ? 0u : 1u, out->mFaces[f].mIndices[i] / 3);
+        }
+    }
+    delete out;
+}
+
+TEST_F(utMeshFaces, copyMeshTest) {
+    aiMesh *src = new aiMesh();
+    src->mNumVertices = 3;
+    src->mVertices = new aiVector3D[3];
+    unsigned int *indices = src->AllocateUniformFaces(2, 3);
+    for (unsigned int i = 0; i < 6; ++i) {
+        indices[i] = i % 3;
+    }
+
+    aiMesh *dest = nullptr;
+    SceneCombiner::Copy(&dest, src);
+    ASSERT_NE(nullptr, dest);
+    ASSERT_NE(nullptr, dest->mFaceIndices);
+    EXPECT_NE(src->mFaceIndices, dest->mFaceIndices);
+    ASSERT_EQ(2u, dest->mNumFaces);
+    for (unsigned int f = 0; f < dest->mNumFaces; ++f) {
+        EXPECT_TRUE(dest->IsInFaceIndexBlock(dest->mFaces[f].mIndices));
+        EXPECT_EQ(0, memcmp(src->mFaces[f].mIndices, dest->mFaces[f].mIndices, sizeof(unsigned int) * 3));
+    }
+    delete src;
+    delete dest;
+}
+
+TEST_F(utMeshFaces, objUsesIndexBlockTest) {
+    checkImport(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", aiProcess_Triangulate | aiProcess_SortByPType);
+}
+
+TEST_F(utMeshFaces, stlUsesIndexBlockTest) {
+    checkImport(ASSIMP_TEST_MODELS_DIR "/STL/Spider_binary.stl", 0);
+}
+
+TEST_F(utMeshFaces, plyUsesIndexBlockTest) {
+    checkImport(ASSIMP_TEST_MODELS_DIR "/PLY/cube.ply", 0);
+}
+
+TEST_F(utMeshFaces, gltf2UsesIndexBlockTest) {
+    checkImport(ASSIMP_TEST_MODELS_DIR "/glTF2/BoxTextured-glTF/BoxTextured.gltf", 0);
+}
+
+TEST_F(utMeshFaces, fbxUsesIndexBlockTest) {
+    checkImport(ASSIMP_TEST_MODELS_DIR "/FBX/spider.fbx", 0);
+}
+
+TEST_F(utMeshFaces, postProcessingKeepsIndexBlockTest) {
+    checkImport(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj",
+            aiProcessPreset_TargetRealtime_MaxQuality | aiProcess_PreTransformVertices | aiProcess_FindDegenerates);
+}
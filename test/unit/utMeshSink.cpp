@@ -0,0 +1,228 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2021, assimp team
+
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+#include "UnitTestPCH.h"
+
+#include <assimp/config.h>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+#include <assimp/Importer.hpp>
+#include <assimp/MeshSink.hpp>
+
+#include <memory>
+#include <vector>
+
+using namespace Assimp;
+
+namespace {
+
+class CollectingSink : public MeshSink {
+public:
+    CollectingSink() :
+            mMaxMeshes(~0u) {}
+
+    bool Consume(aiMesh *mesh, unsigned int meshIndex) override {
+        mMeshes.emplace_back(mesh);
+        mIndices.push_back(meshIndex);
+        return mMeshes.size() < mMaxMeshes;
+    }
+
+    unsigned int GetNumVertices() const {
+        unsigned int n = 0;
+        for (const auto &mesh : mMeshes) {
+            n += mesh->mNumVertices;
+        }
+        return n;
+    }
+
+    unsigned int GetNumFaces() const {
+        unsigned int n = 0;
+        for (const auto &mesh : mMeshes) {
+            n += mesh->mNumFaces;
+        }
+        return n;
+    }
+
+    size_t mMaxMeshes;
+    std::vector<std::unique_ptr<aiMesh>> mMeshes;
+    std::vector<unsigned int> mIndices;
+};
+
+} // namespace
+
+class utMeshSink : public ::testing::Test {
+protected:
+    // Checks that the streamed chunks hold exactly the vertices of the single mesh of a regular import
+    static void checkChunks(const char *file, const CollectingSink &sink) {
+        Importer importer;
+        const aiScene *expected = importer.ReadFile(file, 0);
+        ASSERT_NE(nullptr, expected);
+        ASSERT_EQ(1u, expected->mNumMeshes);
+        const aiMesh *mesh = expected->mMeshes[0];
+
+        EXPECT_EQ(mesh->mNumVertices, sink.GetNumVertices());
+        EXPECT_EQ(mesh->mNumFaces, sink.GetNumFaces());
+
+        unsigned int offset = 0;
+        for (size_t i = 0; i < sink.mMeshes.size(); ++i) {
+            const aiMesh *chunk = sink.mMeshes[i].get();
+            EXPECT_EQ(0u, sink.mIndices[i]);
+            EXPECT_EQ(mesh->mPrimitiveTypes, chunk->mPrimitiveTypes);
+            ASSERT_LE(offset + chunk->mNumVertices, mesh->mNumVertices);
+            EXPECT_EQ(0, memcmp(mesh->mVertices + offset, chunk->mVertices, chunk->mNumVertices * sizeof(aiVector3D)));
+            ASSERT_EQ(mesh->HasNormals(), chunk->HasNormals());
+            if (chunk->HasNormals()) {
+                EXPECT_EQ(0, memcmp(mesh->mNormals + offset, chunk->mNormals, chunk->mNumVertices * sizeof(aiVector3D)));
+            }
+            offset += chunk->mNumVertices;
+        }
+    }
+
+    static void checkSceneWithoutMeshes(const aiScene *scene) {
+        ASSERT_NE(nullptr, scene);
+        EXPECT_EQ(0u, scene->mNumMeshes);
+        EXPECT_EQ(nullptr, scene->mMeshes);
+        EXPECT_NE(0u, scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE);
+        ASSERT_NE(nullptr, scene->mRootNode);
+        EXPECT_EQ(0u, scene->mRootNode->mNumMeshes);
+        for (unsigned int i = 0; i < scene->mRootNode->mNumChildren; ++i) {
+            EXPECT_EQ(0u, scene->mRootNode->mChildren[i]->mNumMeshes);
+        }
+    }
+};
+
+TEST_F(utMeshSink, binaryStlChunksTest) {
+    CollectingSink sink;
+    Importer importer;
+    importer.SetMeshSink(&sink);
+    EXPECT_EQ(&sink, importer.GetMeshSink());
+    importer.SetPropertyInteger(AI_CONFIG_IMPORT_MESH_SINK_CHUNK_SIZE, 300);
+    checkSceneWithoutMeshes(importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/STL/Spider_binary.stl", aiProcess_ValidateDataStructure));
+    ASSERT_LT(1u, sink.mMeshes.size());
+    for (const auto &chunk : sink.mMeshes) {
+        EXPECT_GE(300u, chunk->mNumVertices);
+        EXPECT_EQ(chunk->mNumVertices, chunk->mNumFaces * 3);
+        EXPECT_GT(chunk->mNumVertices, chunk->mFaces[chunk->mNumFaces - 1].mIndices[2]);
+    }
+    checkChunks(ASSIMP_TEST_MODELS_DIR "/STL/Spider_binary.stl", sink);
+}
+
+TEST_F(utMeshSink, asciiStlSolidsTest) {
+    CollectingSink sink;
+    Importer importer;
+    importer.SetMeshSink(&sink);
+    checkSceneWithoutMeshes(importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/STL/triangle_with_two_solids.stl", 0));
+    ASSERT_EQ(2u, sink.mMeshes.size());
+    EXPECT_EQ(0u, sink.mIndices[0]);
+    EXPECT_EQ(1u, sink.mIndices[1]);
+
+    // the nodes of the solids are kept
+    const aiScene *scene = importer.GetScene();
+    EXPECT_EQ(2u, scene->mRootNode->mNumChildren);
+}
+
+TEST_F(utMeshSink, plyPointCloudChunksTest) {
+    CollectingSink sink;
+    Importer importer;
+    importer.SetMeshSink(&sink);
+    importer.SetPropertyInteger(AI_CONFIG_IMPORT_MESH_SINK_CHUNK_SIZE, 10000);
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/PLY/pond.0.ply", 0);
+    checkSceneWithoutMeshes(scene);
+    EXPECT_EQ(1u, scene->mNumMaterials);
+    EXPECT_EQ(8u, sink.mMeshes.size());
+    checkChunks(ASSIMP_TEST_MODELS_DIR "/PLY/pond.0.ply", sink);
+}
+
+TEST_F(utMeshSink, objMeshesTest) {
+    Importer expectedImporter;
+    const aiScene *expected = expectedImporter.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", 0);
+    ASSERT_NE(nullptr, expected);
+
+    CollectingSink sink;
+    Importer importer;
+    importer.SetMeshSink(&sink);
+    checkSceneWithoutMeshes(importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", aiProcess_ValidateDataStructure));
+    ASSERT_EQ(expected->mNumMeshes, sink.mMeshes.size());
+    for (unsigned int i = 0; i < expected->mNumMeshes; ++i) {
+        EXPECT_EQ(i, sink.mIndices[i]);
+        EXPECT_STREQ(expected->mMeshes[i]->mName.C_Str(), sink.mMeshes[i]->mName.C_Str());
+        EXPECT_EQ(expected->mMeshes[i]->mNumVertices, sink.mMeshes[i]->mNumVertices);
+        EXPECT_EQ(expected->mMeshes[i]->mNumFaces, sink.mMeshes[i]->mNumFaces);
+        EXPECT_EQ(expected->mMeshes[i]->mPrimitiveTypes, sink.mMeshes[i]->mPrimitiveTypes);
+    }
+}
+
+TEST_F(utMeshSink, objPointCloudIsNotChunkedTest) {
+    CollectingSink sink;
+    Importer importer;
+    importer.SetMeshSink(&sink);
+    importer.SetPropertyInteger(AI_CONFIG_IMPORT_MESH_SINK_CHUNK_SIZE, 2);
+    checkSceneWithoutMeshes(importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/point_cloud.obj", 0));
+    EXPECT_EQ(1u, sink.mMeshes.size());
+    checkChunks(ASSIMP_TEST_MODELS_DIR "/OBJ/point_cloud.obj", sink);
+}
+
+TEST_F(utMeshSink, otherFormatsHandOverTheirMeshesTest) {
+    CollectingSink sink;
+    Importer importer;
+    importer.SetMeshSink(&sink);
+    checkSceneWithoutMeshes(importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/glTF2/BoxTextured-glTF/BoxTextured.gltf", aiProcess_ValidateDataStructure));
+    ASSERT_EQ(1u, sink.mMeshes.size());
+    EXPECT_EQ(24u, sink.mMeshes[0]->mNumVertices);
+
+    // without the sink the meshes end up in the scene again
+    importer.SetMeshSink(nullptr);
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/glTF2/BoxTextured-glTF/BoxTextured.gltf", 0);
+    ASSERT_NE(nullptr, scene);
+    EXPECT_EQ(1u, scene->mNumMeshes);
+    EXPECT_EQ(1u, sink.mMeshes.size());
+}
+
+TEST_F(utMeshSink, abortTest) {
+    CollectingSink sink;
+    sink.mMaxMeshes = 2;
+    Importer importer;
+    importer.SetMeshSink(&sink);
+    importer.SetPropertyInteger(AI_CONFIG_IMPORT_MESH_SINK_CHUNK_SIZE, 300);
+    EXPECT_EQ(nullptr, importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/STL/Spider_binary.stl", 0));
+    EXPECT_EQ(2u, sink.mMeshes.size());
+}
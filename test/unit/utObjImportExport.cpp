@@ -42,10 +42,12 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "AbstractImportExportBase.h"
 #include "SceneDiffer.h"
 #include "UnitTestPCH.h"
+#include <assimp/config.h>
 #include <assimp/postprocess.h>
 #include <assimp/scene.h>
 #include <assimp/Exporter.hpp>
 #include <assimp/Importer.hpp>
+#include <sstream>
 
 using namespace Assimp;
 
@@ -477,3 +479,139 @@ TEST_F(utObjImportExport, import_with_line_continuations) {
     EXPECT_NEAR(vertices[2].y, 0.5f, threshold);
     EXPECT_NEAR(vertices[2].z, -0.5f, threshold);
 }
+
+static void expectEqualObjScenes(const aiScene *expected, const aiScene *toCompare) {
+    ASSERT_NE(nullptr, expected);
+    ASSERT_NE(nullptr, toCompare);
+
+    SceneDiffer differ;
+    EXPECT_TRUE(differ.isEqual(expected, toCompare));
+    differ.showReport();
+
+    ASSERT_EQ(expected->mNumMeshes, toCompare->mNumMeshes);
+    for (unsigned int i = 0; i < expected->mNumMeshes; ++i) {
+        const aiMesh *expMesh = expected->mMeshes[i];
+        const aiMesh *toCompMesh = toCompare->mMeshes[i];
+        EXPECT_EQ(expMesh->mMaterialIndex, toCompMesh->mMaterialIndex);
+        ASSERT_EQ(expMesh->HasTextureCoords(0), toCompMesh->HasTextureCoords(0));
+        for (unsigned int j = 0; expMesh->HasTextureCoords(0) && j < expMesh->mNumVertices; ++j) {
+            EXPECT_EQ(expMesh->mTextureCoords[0][j], toCompMesh->mTextureCoords[0][j]);
+        }
+    }
+    ASSERT_EQ(expected->mRootNode->mNumChildren, toCompare->mRootNode->mNumChildren);
+    for (unsigned int i = 0; i < expected->mRootNode->mNumChildren; ++i) {
+        EXPECT_EQ(expected->mRootNode->mChildren[i]->mName, toCompare->mRootNode->mChildren[i]->mName);
+        EXPECT_EQ(expected->mRootNode->mChildren[i]->mNumMeshes, toCompare->mRootNode->mChildren[i]->mNumMeshes);
+    }
+}
+
+TEST_F(utObjImportExport, parallel_parser_Test) {
+    // normals without texture coordinates first, the 'a/b' faces use them as normals
+    std::stringstream obj;
+    for (int i = 0; i < 40; ++i) {
+        obj << "v " << i << " " << i * 0.5 << " " << -i << "\n";
+        obj << "vn 0 " << (i % 2) << " 1\n";
+    }
+    for (int i = 0; i < 20; ++i) {
+        obj << "f " << i + 1 << "/" << i + 1 << " " << i + 2 << "/" << i + 2 << " " << i + 3 << "/" << i + 3 << "\n";
+        obj << "f " << i + 1 << "//" << i + 1 << " " << i + 2 << "//" << i + 2 << " " << i + 3 << "//" << i + 3 << "\r\n";
+    }
+
+    // groups, objects and materials spread over many chunks
+    for (int block = 0; block < 60; ++block) {
+        if (block % 7 == 0) {
+            obj << "o object" << block / 7 << "\n";
+        }
+        obj << "g group" << block % 5 << "\n";
+        obj << "usemtl material" << block % 3 << "\n";
+        for (int i = 0; i < 8; ++i) {
+            obj << "v " << block << " " << i << " " << block * i << " 0.25 0.5 0.75\n";
+            obj << "vt " << i * 0.125 << " " << block * 0.01 << "\n";
+            obj << "vn 1 0 " << i << "\n";
+        }
+        obj << "# faces of block " << block << "\n";
+        obj << "f -8/-8/-8 -7/-7/-7 -6/-6/-6 -5/-5/-5\n";
+        obj << "f " << 41 + block * 8 << "/" << 1 + block * 8 << "/" << 41 + block * 8 << " \\\n"
+            << "  " << 42 + block * 8 << "/" << 2 + block * 8 << "/" << 42 + block * 8 << " "
+            << 43 + block * 8 << "/" << 3 + block * 8 << "/" << 43 + block * 8 << "\n";
+        obj << "f 1/1/1 -1/-1/-1 2/2/2\n";
+        obj << "l " << 44 + block * 8 << " " << 45 + block * 8 << "\n";
+        obj << "p -1\n";
+    }
+    const std::string data = obj.str();
+
+    Assimp::Importer serialImporter;
+    const aiScene *expected = serialImporter.ReadFileFromMemory(data.c_str(), data.size(), 0, "obj");
+    ASSERT_NE(nullptr, expected);
+    EXPECT_GT(expected->mNumMeshes, 10u);
+
+    Assimp::Importer parallelImporter;
+    parallelImporter.SetPropertyInteger(AI_CONFIG_GLOB_MULTITHREADING, 4);
+    parallelImporter.SetPropertyInteger(AI_CONFIG_IMPORT_OBJ_PARALLEL_CHUNK_SIZE, 256);
+    const aiScene *scene = parallelImporter.ReadFileFromMemory(data.c_str(), data.size(), 0, "obj");
+    expectEqualObjScenes(expected, scene);
+}
+
+TEST_F(utObjImportExport, parallel_parser_read_blocks_Test) {
+    Assimp::Importer serialImporter;
+    const aiScene *expected = serialImporter.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", 0);
+    ASSERT_NE(nullptr, expected);
+
+    // the file is read block by block, lines cross the block boundaries
+    Assimp::Importer parallelImporter;
+    parallelImporter.SetPropertyInteger(AI_CONFIG_GLOB_MULTITHREADING, 3);
+    parallelImporter.SetPropertyInteger(AI_CONFIG_IMPORT_OBJ_PARALLEL_CHUNK_SIZE, 1000);
+    parallelImporter.SetPropertyInteger(AI_CONFIG_IMPORT_READ_BLOCK_SIZE, 4093);
+    const aiScene *scene = parallelImporter.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", 0);
+    expectEqualObjScenes(expected, scene);
+}
+
+TEST_F(utObjImportExport, mixed_face_indices_Test) {
+    // the first face has neither normals nor texture coordinates, lines and points share the mesh
+    static const char *curObjModel =
+            "v 0 0 0\n"
+            "v 1 0 0\n"
+            "v 0 1 0\n"
+            "v 1 1 0\n"
+            "vt 0 0\n"
+            "vt 1 0\n"
+            "vt 0 1\n"
+            "vn 0 0 1\n"
+            "vn 1 0 0\n"
+            "f 1 2 3\n"
+            "f 2/1/1 4/2/2 3/3/1\n"
+            "l 1 2 4\n"
+            "p 3\n";
+
+    Assimp::Importer myImporter;
+    const aiScene *scene = myImporter.ReadFileFromMemory(curObjModel, strlen(curObjModel), 0);
+    ASSERT_NE(nullptr, scene);
+    ASSERT_EQ(1u, scene->mNumMeshes);
+
+    const aiMesh *mesh = scene->mMeshes[0];
+    EXPECT_EQ(unsigned(aiPrimitiveType_TRIANGLE | aiPrimitiveType_LINE | aiPrimitiveType_POINT), mesh->mPrimitiveTypes);
+    ASSERT_EQ(5u, mesh->mNumFaces);
+    ASSERT_EQ(11u, mesh->mNumVertices);
+    ASSERT_TRUE(mesh->HasNormals());
+    ASSERT_TRUE(mesh->HasTextureCoords(0));
+
+    EXPECT_EQ(aiVector3D(1, 0, 0), mesh->mVertices[3]);
+    EXPECT_EQ(aiVector3D(0, 0, 1), mesh->mNormals[3]);
+    EXPECT_EQ(aiVector3D(1, 0, 0), mesh->mNormals[4]);
+    EXPECT_EQ(aiVector3D(0, 0, 1), mesh->mNormals[5]);
+    EXPECT_EQ(aiVector3D(1, 0, 0), mesh->mTextureCoords[0][4]);
+    EXPECT_EQ(aiVector3D(0, 1, 0), mesh->mTextureCoords[0][5]);
+
+    // the inner vertex of the line is duplicated
+    ASSERT_EQ(2u, mesh->mFaces[2].mNumIndices);
+    EXPECT_EQ(6u, mesh->mFaces[2].mIndices[0]);
+    EXPECT_EQ(8u, mesh->mFaces[2].mIndices[1]);
+    ASSERT_EQ(2u, mesh->mFaces[3].mNumIndices);
+    EXPECT_EQ(7u, mesh->mFaces[3].mIndices[0]);
+    EXPECT_EQ(9u, mesh->mFaces[3].mIndices[1]);
+    EXPECT_EQ(mesh->mVertices[7], mesh->mVertices[8]);
+    EXPECT_EQ(aiVector3D(1, 1, 0), mesh->mVertices[9]);
+    ASSERT_EQ(1u, mesh->mFaces[4].mNumIndices);
+    EXPECT_EQ(10u, mesh->mFaces[4].mIndices[0]);
+    EXPECT_EQ(aiVector3D(0, 1, 0), mesh->mVertices[10]);
+}
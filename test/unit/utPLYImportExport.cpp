@@ -180,3 +180,113 @@ TEST_F(utPLYImportExport, parseErrorTest) {
     const aiScene *scene = importer.ReadFileFromMemory(test_file, strlen(test_file), 0);
     EXPECT_NE(nullptr, scene);
 }
+
+TEST_F(utPLYImportExport, readAheadTest) {
+    Assimp::Importer expectedImporter;
+    const aiScene *expected = expectedImporter.ReadFile(ASSIMP_TEST_MODELS_DIR "/PLY/Wuson.ply", 0);
+    ASSERT_NE(nullptr, expected);
+
+    // small blocks, so the file is read in many steps by the background thread
+    Assimp::Importer importer;
+    importer.SetPropertyInteger(AI_CONFIG_IMPORT_READ_BLOCK_SIZE, 4096);
+    importer.SetPropertyInteger(AI_CONFIG_IMPORT_READ_AHEAD_DEPTH, 2);
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/PLY/Wuson.ply", 0);
+    ASSERT_NE(nullptr, scene);
+    ASSERT_EQ(expected->mNumMeshes, scene->mNumMeshes);
+    const aiMesh *expectedMesh = expected->mMeshes[0];
+    const aiMesh *mesh = scene->mMeshes[0];
+    ASSERT_EQ(expectedMesh->mNumVertices, mesh->mNumVertices);
+    ASSERT_EQ(expectedMesh->mNumFaces, mesh->mNumFaces);
+    EXPECT_EQ(0, memcmp(expectedMesh->mVertices, mesh->mVertices, mesh->mNumVertices * sizeof(aiVector3D)));
+}
+
+// Writes a binary point cloud with more vertices than the loader takes in one run,
+// followed by a face list
+static std::string createBinaryPLY(bool bigEndian, unsigned int numVertices) {
+    std::string file = std::string("ply\nformat binary_") + (bigEndian ? "big" : "little") + "_endian 1.0\n"
+        "element vertex " + std::to_string(numVertices) + "\n"
+        "property float x\nproperty double y\nproperty short z\n"
+        "property uchar red\nproperty uchar green\nproperty uchar blue\n"
+        "element face 2\nproperty list uchar uint vertex_indices\n"
+        "end_header\n";
+    auto append = [&file, bigEndian](const void *value, size_t size) {
+        const char *bytes = static_cast<const char *>(value);
+        for (size_t i = 0; i < size; ++i) {
+            file.push_back(bytes[bigEndian ? size - 1 - i : i]);
+        }
+    };
+    for (unsigned int i = 0; i < numVertices; ++i) {
+        const float x = static_cast<float>(i);
+        const double y = -0.5 * i;
+        const int16_t z = static_cast<int16_t>(i % 7 - 3);
+        const uint8_t color[3] = { static_cast<uint8_t>(i), static_cast<uint8_t>(255 - i % 256), 51 };
+        append(&x, sizeof(x));
+        append(&y, sizeof(y));
+        append(&z, sizeof(z));
+        file.append(reinterpret_cast<const char *>(color), 3);
+    }
+    const uint32_t faces[2][4] = { { 0, 1, 2, 3 }, { numVertices - 1, numVertices - 2, numVertices - 3, 0 } };
+    for (const uint32_t *face : faces) {
+        file.push_back(3);
+        for (unsigned int i = 0; i < 3; ++i) {
+            append(&face[i], sizeof(uint32_t));
+        }
+    }
+    return file;
+}
+
+TEST_F(utPLYImportExport, binaryByteOrderTest) {
+    const unsigned int numVertices = 40000;
+    for (bool bigEndian : { false, true }) {
+        const std::string file = createBinaryPLY(bigEndian, numVertices);
+        Assimp::Importer importer;
+        const aiScene *scene = importer.ReadFileFromMemory(file.data(), file.size(), aiProcess_ValidateDataStructure);
+        ASSERT_NE(nullptr, scene);
+        ASSERT_EQ(1u, scene->mNumMeshes);
+        const aiMesh *mesh = scene->mMeshes[0];
+        ASSERT_EQ(numVertices, mesh->mNumVertices);
+        ASSERT_TRUE(mesh->HasVertexColors(0));
+        for (unsigned int i = 0; i < numVertices; ++i) {
+            ASSERT_EQ(aiVector3D((ai_real)i, (ai_real)(-0.5 * i), (ai_real)(int)(i % 7 - 3)), mesh->mVertices[i]);
+            const aiColor4D &color = mesh->mColors[0][i];
+            ASSERT_FLOAT_EQ((i % 256) / 255.0f, color.r);
+            ASSERT_FLOAT_EQ((255 - i % 256) / 255.0f, color.g);
+            ASSERT_FLOAT_EQ(0.2f, color.b);
+            ASSERT_FLOAT_EQ(1.0f, color.a);
+        }
+        ASSERT_EQ(2u, mesh->mNumFaces);
+        ASSERT_EQ(3u, mesh->mFaces[1].mNumIndices);
+        EXPECT_EQ(numVertices - 1, mesh->mFaces[1].mIndices[0]);
+        EXPECT_EQ(numVertices - 3, mesh->mFaces[1].mIndices[2]);
+    }
+}
+
+TEST_F(utPLYImportExport, oversizedListTest) {
+    // the list sizes overflow 32 bit once multiplied with the value size
+    static const char *ascii =
+            "ply\n"
+            "format ascii 1.0\n"
+            "element vertex 3\n"
+            "property float x\nproperty float y\nproperty float z\n"
+            "element face 1\n"
+            "property list uint int vertex_indices\n"
+            "end_header\n"
+            "0 0 0\n1 0 0\n0 1 0\n"
+            "1073741825 1 1 1 1 1 1 1 1\n";
+    Assimp::Importer importer;
+    EXPECT_EQ(nullptr, importer.ReadFileFromMemory(ascii, strlen(ascii), 0));
+
+    std::string binary =
+            "ply\n"
+            "format binary_little_endian 1.0\n"
+            "element vertex 1\n"
+            "property float x\nproperty float y\nproperty float z\n"
+            "element face 1\n"
+            "property list uint int vertex_indices\n"
+            "end_header\n";
+    binary.append(12, '\0');
+    const uint32_t count = 0x40000001;
+    binary.append(reinterpret_cast<const char *>(&count), sizeof(count));
+    binary.append(64, '\1');
+    EXPECT_EQ(nullptr, importer.ReadFileFromMemory(binary.data(), binary.size(), 0));
+}
@@ -0,0 +1,120 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2021, assimp team
+
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+#include "UnitTestPCH.h"
+#include "Common/ProbeIOSystem.h"
+
+#include <assimp/DefaultIOSystem.h>
+
+#include <memory>
+#include <vector>
+
+using namespace Assimp;
+
+class utProbeIOSystem : public ::testing::Test {
+protected:
+    static std::vector<uint8_t> readFile(const char *file) {
+        DefaultIOSystem io;
+        std::unique_ptr<IOStream> stream(io.Open(file, "rb"));
+        std::vector<uint8_t> data;
+        if (stream) {
+            data.resize(stream->FileSize());
+            data.resize(stream->Read(data.data(), 1, data.size()));
+        }
+        return data;
+    }
+};
+
+TEST_F(utProbeIOSystem, streamsKeepTheirPositionTest) {
+    const char *file = ASSIMP_TEST_MODELS_DIR "/STL/Spider_binary.stl";
+    const std::vector<uint8_t> expected = readFile(file);
+    ASSERT_LT(3 * ProbeIOSystem::HeaderSize, expected.size());
+
+    DefaultIOSystem wrapped;
+    ProbeIOSystem io(file, &wrapped);
+    ASSERT_TRUE(io.OpenFile());
+
+    IOStream *a = io.Open(file, "rb");
+    IOStream *b = io.Open(file, "rb");
+    ASSERT_NE(nullptr, a);
+    ASSERT_NE(nullptr, b);
+
+    // interleaved reads behind the header block must not move the other stream
+    const size_t chunk = 1000;
+    std::vector<uint8_t> bufA(chunk), bufB(chunk);
+    ASSERT_EQ(aiReturn_SUCCESS, b->Seek(2 * ProbeIOSystem::HeaderSize, aiOrigin_SET));
+    for (size_t pos = 0; pos < ProbeIOSystem::HeaderSize + 3 * chunk; pos += chunk) {
+        ASSERT_EQ(chunk, a->Read(bufA.data(), 1, chunk));
+        EXPECT_EQ(0, memcmp(&expected[pos], bufA.data(), chunk));
+        EXPECT_EQ(pos + chunk, a->Tell());
+
+        const size_t posB = 2 * ProbeIOSystem::HeaderSize + pos;
+        ASSERT_EQ(chunk, b->Read(bufB.data(), 1, chunk));
+        EXPECT_EQ(0, memcmp(&expected[posB], bufB.data(), chunk));
+        EXPECT_EQ(posB + chunk, b->Tell());
+    }
+
+    io.Close(a);
+    io.Close(b);
+}
+
+TEST_F(utProbeIOSystem, onlyBinaryReadsAreServedTest) {
+    const char *file = ASSIMP_TEST_MODELS_DIR "/STL/Spider_binary.stl";
+    DefaultIOSystem wrapped;
+    ProbeIOSystem io(file, &wrapped);
+    ASSERT_TRUE(io.OpenFile());
+
+    IOStream *stream = io.Open(file, "rb");
+    EXPECT_NE(nullptr, dynamic_cast<ProbeIOStream *>(stream));
+    io.Close(stream);
+
+    // text mode and write accesses go to the wrapped system
+    const char *modes[] = { "rt", "r", "r+b" };
+    for (const char *mode : modes) {
+        stream = io.Open(file, mode);
+        EXPECT_EQ(nullptr, dynamic_cast<ProbeIOStream *>(stream)) << mode;
+        if (nullptr != stream) {
+            io.Close(stream);
+        }
+    }
+}
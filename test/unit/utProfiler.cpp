@@ -44,6 +44,15 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "UTLogStream.h"
 #include <assimp/Profiler.h>
 #include <assimp/DefaultLogger.hpp>
+#include <assimp/Importer.hpp>
+#include <assimp/cimport.h>
+#include <assimp/config.h>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
 
 using namespace ::Assimp;
 using namespace ::Assimp::Profiling;
@@ -75,3 +84,144 @@ TEST_F( utProfiler, addRegion_success ) {
     //UTLogStream *stream( (UTLogStream*) m_stream );
     //EXPECT_FALSE( stream->m_messages.empty() );
 }
+
+TEST_F( utProfiler, nestedRegionsTest ) {
+    Profiler myProfiler;
+    myProfiler.BeginRegion( "outer" );
+    myProfiler.BeginRegion( "inner" );
+    myProfiler.EndRegion( "inner" );
+    myProfiler.AddRegion( "added", 0.5 );
+    myProfiler.EndRegion( "outer" );
+    myProfiler.EndRegion( "unknown" );
+
+    const std::vector<Profiler::Region> &regions = myProfiler.GetRegions();
+    ASSERT_EQ( 3u, regions.size() );
+    EXPECT_EQ( "outer", regions[ 0 ].mName );
+    EXPECT_EQ( -1, regions[ 0 ].mParent );
+    EXPECT_EQ( 0u, regions[ 0 ].mDepth );
+    EXPECT_EQ( "inner", regions[ 1 ].mName );
+    EXPECT_EQ( 0, regions[ 1 ].mParent );
+    EXPECT_EQ( 1u, regions[ 1 ].mDepth );
+    EXPECT_EQ( "added", regions[ 2 ].mName );
+    EXPECT_EQ( 0, regions[ 2 ].mParent );
+    EXPECT_DOUBLE_EQ( 0.5, regions[ 2 ].mSeconds );
+    EXPECT_LE( regions[ 1 ].mSeconds, regions[ 0 ].mSeconds );
+}
+
+TEST_F( utProfiler, endRegionClosesNestedRegionsTest ) {
+    Profiler myProfiler;
+    {
+        ScopedRegion phase( &myProfiler, "first" );
+        myProfiler.BeginRegion( "left open" );
+        phase.Next( "second" );
+    }
+    myProfiler.BeginRegion( "top" );
+
+    const std::vector<Profiler::Region> &regions = myProfiler.GetRegions();
+    ASSERT_EQ( 4u, regions.size() );
+    EXPECT_EQ( 0, regions[ 1 ].mParent );
+    EXPECT_EQ( "second", regions[ 2 ].mName );
+    EXPECT_EQ( -1, regions[ 2 ].mParent );
+    EXPECT_EQ( -1, regions[ 3 ].mParent );
+}
+
+static int findRegion( const aiImportStatistics *stats, const char *name ) {
+    for ( unsigned int i = 0; i < stats->mNumRegions; ++i ) {
+        if ( 0 == strcmp( name, stats->mRegions[ i ].mName.C_Str() ) ) {
+            return static_cast<int>( i );
+        }
+    }
+    return -1;
+}
+
+TEST_F( utProfiler, importStatisticsTest ) {
+    const char *file = ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj";
+
+    Importer importer;
+    ASSERT_NE( nullptr, importer.ReadFile( file, aiProcess_Triangulate ) );
+    EXPECT_EQ( nullptr, importer.GetImportStatistics() );
+
+    importer.SetPropertyBool( AI_CONFIG_GLOB_MEASURE_TIME, true );
+    const aiScene *scene = importer.ReadFile( file, aiProcess_Triangulate | aiProcess_GenNormals | aiProcess_JoinIdenticalVertices );
+    ASSERT_NE( nullptr, scene );
+    const aiImportStatistics *stats = importer.GetImportStatistics();
+    ASSERT_NE( nullptr, stats );
+
+    const int total = findRegion( stats, "total" );
+    const int import = findRegion( stats, "import" );
+    const int parse = findRegion( stats, "parse" );
+    const int convert = findRegion( stats, "convert" );
+    const int postprocess = findRegion( stats, "postprocess" );
+    const int triangulate = findRegion( stats, "TriangulateProcess" );
+    ASSERT_EQ( 0, total );
+    ASSERT_LT( 0, import );
+    ASSERT_LT( 0, parse );
+    ASSERT_LT( 0, convert );
+    ASSERT_LT( 0, postprocess );
+    ASSERT_LT( 0, triangulate );
+    EXPECT_EQ( total, stats->mRegions[ import ].mParent );
+    EXPECT_EQ( import, stats->mRegions[ parse ].mParent );
+    EXPECT_EQ( import, stats->mRegions[ convert ].mParent );
+    EXPECT_EQ( 2u, stats->mRegions[ parse ].mDepth );
+    EXPECT_EQ( total, stats->mRegions[ postprocess ].mParent );
+    EXPECT_EQ( postprocess, stats->mRegions[ triangulate ].mParent );
+    EXPECT_LE( stats->mRegions[ parse ].mSeconds, stats->mRegions[ import ].mSeconds );
+    EXPECT_LE( stats->mRegions[ import ].mSeconds, stats->mRegions[ total ].mSeconds );
+
+    // the .obj and its .mtl file
+    std::ifstream in( file, std::ios::binary | std::ios::ate );
+    EXPECT_LT( static_cast<size_t>( in.tellg() ), stats->mBytesRead );
+
+    unsigned int numVertices = 0, numFaces = 0;
+    for ( unsigned int i = 0; i < scene->mNumMeshes; ++i ) {
+        numVertices += scene->mMeshes[ i ]->mNumVertices;
+        numFaces += scene->mMeshes[ i ]->mNumFaces;
+    }
+    EXPECT_EQ( scene->mNumMeshes, stats->mNumMeshes );
+    EXPECT_EQ( numVertices, stats->mNumVertices );
+    EXPECT_EQ( numFaces, stats->mNumFaces );
+
+    // separate post processing replaces the statistics
+    importer.ApplyPostProcessing( aiProcess_GenBoundingBoxes );
+    stats = importer.GetImportStatistics();
+    ASSERT_NE( nullptr, stats );
+    EXPECT_EQ( 0, findRegion( stats, "postprocess" ) );
+    EXPECT_EQ( -1, findRegion( stats, "import" ) );
+    EXPECT_EQ( 0u, stats->mBytesRead );
+}
+
+TEST_F( utProfiler, importStatisticsCApiTest ) {
+    aiPropertyStore *props = aiCreatePropertyStore();
+    aiSetImportPropertyInteger( props, AI_CONFIG_GLOB_MEASURE_TIME, 1 );
+    const aiScene *scene = aiImportFileExWithProperties( ASSIMP_TEST_MODELS_DIR "/PLY/cube.ply", 0, nullptr, props );
+    aiReleasePropertyStore( props );
+    ASSERT_NE( nullptr, scene );
+
+    const aiImportStatistics *stats = aiGetImportStatistics( scene );
+    ASSERT_NE( nullptr, stats );
+    EXPECT_LT( 0, findRegion( stats, "parse" ) );
+    EXPECT_EQ( 8u, stats->mNumVertices );
+    aiReleaseImport( scene );
+}
+
+TEST_F( utProfiler, importStatisticsJsonTest ) {
+    const char *jsonFile = "utProfiler_stats.json";
+
+    Importer importer;
+    importer.SetPropertyBool( AI_CONFIG_GLOB_MEASURE_TIME, true );
+    importer.SetPropertyString( AI_CONFIG_GLOB_MEASURE_TIME_FILE, jsonFile );
+    ASSERT_NE( nullptr, importer.ReadFile( ASSIMP_TEST_MODELS_DIR "/OBJ/box.obj", aiProcess_Triangulate ) );
+
+    std::ifstream in( jsonFile );
+    ASSERT_TRUE( in.good() );
+    std::stringstream json;
+    json << in.rdbuf();
+    in.close();
+    std::remove( jsonFile );
+
+    const std::string text = json.str();
+    EXPECT_NE( std::string::npos, text.find( "\"bytesRead\": " ) );
+    EXPECT_NE( std::string::npos, text.find( "\"name\": \"parse\", \"seconds\": " ) );
+    EXPECT_NE( std::string::npos, text.find( "\"name\": \"TriangulateProcess\"" ) );
+    EXPECT_EQ( '}', text[ text.find_last_not_of( "\n" ) ] );
+}
@@ -0,0 +1,413 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2021, assimp team
+
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+#include "UnitTestPCH.h"
+
+#include "Common/SceneArena.h"
+#include <assimp/Allocator.h>
+#include <assimp/SceneCombiner.h>
+#include <assimp/cimport.h>
+#include <assimp/config.h>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+#include <assimp/Importer.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace Assimp;
+
+class utSceneArena : public ::testing::Test {
+protected:
+    static void compareNodes(const aiNode *expected, const aiNode *node, const aiNode *parent) {
+        ASSERT_NE(nullptr, node);
+        EXPECT_EQ(parent, node->mParent);
+        EXPECT_STREQ(expected->mName.C_Str(), node->mName.C_Str());
+        ASSERT_EQ(expected->mNumMeshes, node->mNumMeshes);
+        for (unsigned int i = 0; i < node->mNumMeshes; ++i) {
+            EXPECT_EQ(expected->mMeshes[i], node->mMeshes[i]);
+        }
+        ASSERT_EQ(expected->mNumChildren, node->mNumChildren);
+        for (unsigned int i = 0; i < node->mNumChildren; ++i) {
+            compareNodes(expected->mChildren[i], node->mChildren[i], node);
+        }
+    }
+
+    static void compareScenes(const aiScene *expected, const aiScene *scene) {
+        ASSERT_EQ(expected->mNumMeshes, scene->mNumMeshes);
+        for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+            const aiMesh *a = expected->mMeshes[i];
+            const aiMesh *b = scene->mMeshes[i];
+            ASSERT_EQ(a->mNumVertices, b->mNumVertices);
+            EXPECT_EQ(0, memcmp(a->mVertices, b->mVertices, sizeof(aiVector3D) * a->mNumVertices));
+            ASSERT_EQ(a->HasNormals(), b->HasNormals());
+            if (a->HasNormals()) {
+                EXPECT_EQ(0, memcmp(a->mNormals, b->mNormals, sizeof(aiVector3D) * a->mNumVertices));
+            }
+            ASSERT_EQ(a->mNumFaces, b->mNumFaces);
+            for (unsigned int f = 0; f < a->mNumFaces; ++f) {
+                ASSERT_EQ(a->mFaces[f].mNumIndices, b->mFaces[f].mNumIndices);
+                EXPECT_EQ(0, memcmp(a->mFaces[f].mIndices, b->mFaces[f].mIndices, sizeof(unsigned int) * a->mFaces[f].mNumIndices));
+            }
+            ASSERT_EQ(a->mNumBones, b->mNumBones);
+            for (unsigned int n = 0; n < a->mNumBones; ++n) {
+                ASSERT_EQ(a->mBones[n]->mNumWeights, b->mBones[n]->mNumWeights);
+                EXPECT_EQ(0, memcmp(a->mBones[n]->mWeights, b->mBones[n]->mWeights, sizeof(aiVertexWeight) * a->mBones[n]->mNumWeights));
+            }
+        }
+
+        ASSERT_EQ(expected->mNumMaterials, scene->mNumMaterials);
+        for (unsigned int i = 0; i < scene->mNumMaterials; ++i) {
+            const aiMaterial *a = expected->mMaterials[i];
+            const aiMaterial *b = scene->mMaterials[i];
+            ASSERT_EQ(a->mNumProperties, b->mNumProperties);
+            for (unsigned int p = 0; p < a->mNumProperties; ++p) {
+                EXPECT_STREQ(a->mProperties[p]->mKey.C_Str(), b->mProperties[p]->mKey.C_Str());
+                ASSERT_EQ(a->mProperties[p]->mDataLength, b->mProperties[p]->mDataLength);
+                EXPECT_EQ(0, memcmp(a->mProperties[p]->mData, b->mProperties[p]->mData, a->mProperties[p]->mDataLength));
+            }
+        }
+
+        ASSERT_NE(nullptr, scene->mMetaData);
+        EXPECT_EQ(expected->mMetaData->mNumProperties, scene->mMetaData->mNumProperties);
+
+        compareNodes(expected->mRootNode, scene->mRootNode, nullptr);
+    }
+
+    // collects every object and array of a scene together with a description
+    typedef std::vector<std::pair<const void *, std::string>> Blocks;
+
+    static void add(Blocks &blocks, const void *data, const std::string &what) {
+        if (nullptr != data) {
+            blocks.push_back(std::make_pair(data, what));
+        }
+    }
+
+    static void collectMetadata(Blocks &blocks, const aiMetadata *meta, const std::string &owner) {
+        if (nullptr == meta) {
+            return;
+        }
+        add(blocks, meta, owner + " metadata");
+        add(blocks, meta->mKeys, owner + " metadata keys");
+        add(blocks, meta->mValues, owner + " metadata values");
+        for (unsigned int i = 0; i < meta->mNumProperties; ++i) {
+            add(blocks, meta->mValues[i].mData, owner + " metadata value");
+        }
+    }
+
+    static void collectNode(Blocks &blocks, const aiNode *node) {
+        const std::string name = std::string("node ") + node->mName.C_Str();
+        add(blocks, node, name);
+        add(blocks, node->mChildren, name + " children");
+        add(blocks, node->mMeshes, name + " meshes");
+        collectMetadata(blocks, node->mMetaData, name);
+        for (unsigned int i = 0; i < node->mNumChildren; ++i) {
+            collectNode(blocks, node->mChildren[i]);
+        }
+    }
+
+    static void collectMesh(Blocks &blocks, const aiMesh *mesh) {
+        add(blocks, mesh, "mesh");
+        add(blocks, mesh->mVertices, "vertices");
+        add(blocks, mesh->mNormals, "normals");
+        add(blocks, mesh->mTangents, "tangents");
+        add(blocks, mesh->mBitangents, "bitangents");
+        for (unsigned int c = 0; c < AI_MAX_NUMBER_OF_COLOR_SETS; ++c) {
+            add(blocks, mesh->mColors[c], "colors");
+        }
+        for (unsigned int c = 0; c < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++c) {
+            add(blocks, mesh->mTextureCoords[c], "texture coordinates");
+        }
+        add(blocks, mesh->mFaces, "faces");
+        add(blocks, mesh->mFaceIndices, "face indices");
+        for (unsigned int f = 0; f < mesh->mNumFaces; ++f) {
+            add(blocks, mesh->mFaces[f].mIndices, "indices of a face");
+        }
+        add(blocks, mesh->mBones, "bone array");
+        for (unsigned int b = 0; b < mesh->mNumBones; ++b) {
+            add(blocks, mesh->mBones[b], "bone");
+            add(blocks, mesh->mBones[b]->mWeights, "weights");
+        }
+        add(blocks, mesh->mAnimMeshes, "anim mesh array");
+        for (unsigned int a = 0; a < mesh->mNumAnimMeshes; ++a) {
+            add(blocks, mesh->mAnimMeshes[a], "anim mesh");
+            add(blocks, mesh->mAnimMeshes[a]->mVertices, "anim mesh vertices");
+            add(blocks, mesh->mAnimMeshes[a]->mNormals, "anim mesh normals");
+        }
+    }
+
+    static Blocks collectScene(const aiScene *scene) {
+        Blocks blocks;
+        collectNode(blocks, scene->mRootNode);
+        collectMetadata(blocks, scene->mMetaData, "scene");
+        add(blocks, scene->mMeshes, "mesh array");
+        for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+            collectMesh(blocks, scene->mMeshes[i]);
+        }
+        add(blocks, scene->mMaterials, "material array");
+        for (unsigned int i = 0; i < scene->mNumMaterials; ++i) {
+            const aiMaterial *mat = scene->mMaterials[i];
+            add(blocks, mat, "material");
+            add(blocks, mat->mProperties, "property array");
+            for (unsigned int p = 0; p < mat->mNumProperties; ++p) {
+                add(blocks, mat->mProperties[p], "property");
+                add(blocks, mat->mProperties[p]->mData, "property data");
+            }
+        }
+        add(blocks, scene->mTextures, "texture array");
+        for (unsigned int i = 0; i < scene->mNumTextures; ++i) {
+            add(blocks, scene->mTextures[i], "texture");
+            add(blocks, scene->mTextures[i]->pcData, "texture data");
+        }
+        add(blocks, scene->mAnimations, "animation array");
+        for (unsigned int i = 0; i < scene->mNumAnimations; ++i) {
+            const aiAnimation *anim = scene->mAnimations[i];
+            add(blocks, anim, "animation");
+            add(blocks, anim->mChannels, "channel array");
+            for (unsigned int c = 0; c < anim->mNumChannels; ++c) {
+                add(blocks, anim->mChannels[c], "channel");
+                add(blocks, anim->mChannels[c]->mPositionKeys, "position keys");
+                add(blocks, anim->mChannels[c]->mRotationKeys, "rotation keys");
+                add(blocks, anim->mChannels[c]->mScalingKeys, "scaling keys");
+            }
+        }
+        add(blocks, scene->mLights, "light array");
+        for (unsigned int i = 0; i < scene->mNumLights; ++i) {
+            add(blocks, scene->mLights[i], "light");
+        }
+        add(blocks, scene->mCameras, "camera array");
+        for (unsigned int i = 0; i < scene->mNumCameras; ++i) {
+            add(blocks, scene->mCameras[i], "camera");
+        }
+        return blocks;
+    }
+
+    static void checkAllInArena(const char *file, unsigned int flags) {
+        Importer importer;
+        importer.SetPropertyBool(AI_CONFIG_GLOB_SCENE_ARENA, true);
+        const aiScene *scene = importer.ReadFile(file, flags);
+        ASSERT_NE(nullptr, scene) << file;
+        const SceneArena *arena = SceneArena::Get(scene);
+        ASSERT_NE(nullptr, arena);
+
+        for (const std::pair<const void *, std::string> &block : collectScene(scene)) {
+            EXPECT_TRUE(arena->Contains(block.first)) << file << ": " << block.second;
+        }
+    }
+
+    static bool isInTree(const aiNode *root, const aiNode *node) {
+        if (root == node) {
+            return true;
+        }
+        for (unsigned int i = 0; i < root->mNumChildren; ++i) {
+            if (isInTree(root->mChildren[i], node)) {
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+TEST_F(utSceneArena, allocateAlignsTest) {
+    SceneArena arena;
+    EXPECT_EQ(0u, arena.GetNumChunks());
+
+    arena.Allocate(1, 1);
+    void *p = arena.Allocate(sizeof(double), alignof(double));
+    EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(p) % alignof(double));
+    EXPECT_EQ(1u, arena.GetNumChunks());
+    EXPECT_EQ(1u + sizeof(double), arena.GetUsedBytes());
+
+    // larger blocks than the chunk size get a chunk of their own
+    arena.Allocate(1024 * 1024, 16);
+    EXPECT_EQ(2u, arena.GetNumChunks());
+}
+
+TEST_F(utSceneArena, arenaSceneMatchesHeapSceneTest) {
+    const char *file = ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj";
+    const unsigned int flags = aiProcessPreset_TargetRealtime_MaxQuality | aiProcess_ValidateDataStructure;
+
+    Importer heapImporter;
+    const aiScene *expected = heapImporter.ReadFile(file, flags);
+    ASSERT_NE(nullptr, expected);
+    EXPECT_EQ(nullptr, SceneArena::Get(expected));
+
+    Importer arenaImporter;
+    arenaImporter.SetPropertyBool(AI_CONFIG_GLOB_SCENE_ARENA, true);
+    const aiScene *scene = arenaImporter.ReadFile(file, flags);
+    ASSERT_NE(nullptr, scene);
+    ASSERT_NE(nullptr, SceneArena::Get(scene));
+    EXPECT_LT(0u, SceneArena::Get(scene)->GetUsedBytes());
+
+    compareScenes(expected, scene);
+
+    arenaImporter.FreeScene();
+    EXPECT_EQ(nullptr, arenaImporter.GetScene());
+}
+
+TEST_F(utSceneArena, bonesReferToArenaNodesTest) {
+    Importer importer;
+    importer.SetPropertyBool(AI_CONFIG_GLOB_SCENE_ARENA, true);
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/FBX/huesitos.fbx",
+            aiProcess_PopulateArmatureData | aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, scene);
+    ASSERT_NE(nullptr, SceneArena::Get(scene));
+    ASSERT_EQ(1u, scene->mNumMeshes);
+    ASSERT_LT(0u, scene->mMeshes[0]->mNumBones);
+
+    const aiBone *bone = scene->mMeshes[0]->mBones[0];
+    ASSERT_NE(nullptr, bone->mNode);
+    ASSERT_NE(nullptr, bone->mArmature);
+    EXPECT_TRUE(isInTree(scene->mRootNode, bone->mNode));
+    EXPECT_TRUE(isInTree(scene->mRootNode, bone->mArmature));
+
+    // and after post processing in the arena as well
+    scene = importer.ApplyPostProcessing(aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, scene);
+    bone = scene->mMeshes[0]->mBones[0];
+    EXPECT_TRUE(isInTree(scene->mRootNode, bone->mNode));
+    EXPECT_TRUE(isInTree(scene->mRootNode, bone->mArmature));
+}
+
+TEST_F(utSceneArena, postProcessingKeepsArenaTest) {
+    const char *file = ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj";
+
+    Importer heapImporter;
+    ASSERT_NE(nullptr, heapImporter.ReadFile(file, 0));
+    const aiScene *expected = heapImporter.ApplyPostProcessing(aiProcess_Triangulate | aiProcess_JoinIdenticalVertices);
+    ASSERT_NE(nullptr, expected);
+
+    Importer arenaImporter;
+    arenaImporter.SetPropertyBool(AI_CONFIG_GLOB_SCENE_ARENA, true);
+    ASSERT_NE(nullptr, arenaImporter.ReadFile(file, 0));
+    const aiScene *scene = arenaImporter.ApplyPostProcessing(aiProcess_Triangulate | aiProcess_JoinIdenticalVertices);
+    ASSERT_NE(nullptr, scene);
+    EXPECT_NE(nullptr, SceneArena::Get(scene));
+
+    compareScenes(expected, scene);
+}
+
+TEST_F(utSceneArena, arenaAllocatesObjectsDuringImportTest) {
+    CountingAllocator counter;
+    {
+        Importer importer;
+        importer.SetAllocator(&counter);
+        importer.SetPropertyBool(AI_CONFIG_GLOB_SCENE_ARENA, true);
+        const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", aiProcess_Triangulate);
+        ASSERT_NE(nullptr, scene);
+        const SceneArena *arena = SceneArena::Get(scene);
+        ASSERT_NE(nullptr, arena);
+
+        // the chunks of the arena are the only blocks the import got
+        EXPECT_EQ(arena->GetNumChunks(), counter.GetNumAllocations());
+        EXPECT_LE(scene->mNumMeshes * sizeof(aiMesh), arena->GetUsedBytes());
+
+        // new objects go to the arena as well
+        const size_t used = arena->GetUsedBytes();
+        ASSERT_NE(nullptr, importer.ApplyPostProcessing(aiProcess_SplitLargeMeshes));
+        EXPECT_EQ(arena, SceneArena::Get(importer.GetScene()));
+        EXPECT_LE(used, arena->GetUsedBytes());
+    }
+    EXPECT_EQ(0u, counter.GetCurrentBytes());
+}
+
+TEST_F(utSceneArena, arenaHoldsAllArraysTest) {
+    checkAllInArena(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", aiProcessPreset_TargetRealtime_MaxQuality);
+    checkAllInArena(ASSIMP_TEST_MODELS_DIR "/FBX/huesitos.fbx", aiProcess_PopulateArmatureData);
+    checkAllInArena(ASSIMP_TEST_MODELS_DIR "/glTF2/BoxTextured-glTF-Binary/BoxTextured.glb", aiProcess_EmbedTextures);
+    checkAllInArena(ASSIMP_TEST_MODELS_DIR "/BVH/01_01.bvh", aiProcess_ValidateDataStructure);
+}
+
+TEST_F(utSceneArena, mergeScenesCopiesArenaScenesTest) {
+    const char *file = ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj";
+    Importer heapImporter;
+    const aiScene *expected = heapImporter.ReadFile(file, aiProcess_Triangulate);
+    ASSERT_NE(nullptr, expected);
+
+    Importer importer;
+    importer.SetPropertyBool(AI_CONFIG_GLOB_SCENE_ARENA, true);
+    ASSERT_NE(nullptr, importer.ReadFile(file, aiProcess_Triangulate));
+    aiScene *source = importer.GetOrphanedScene();
+    ASSERT_NE(nullptr, SceneArena::Get(source));
+
+    // the merged scene outlives the arena of the source
+    std::vector<aiScene *> sources(1, source);
+    sources.push_back(new aiScene());
+    sources[1]->mRootNode = new aiNode("other");
+    aiScene *merged = nullptr;
+    SceneCombiner::MergeScenes(&merged, sources, 0);
+    ASSERT_NE(nullptr, merged);
+    EXPECT_EQ(nullptr, SceneArena::Get(merged));
+    ASSERT_EQ(expected->mNumMeshes, merged->mNumMeshes);
+    for (unsigned int i = 0; i < merged->mNumMeshes; ++i) {
+        const aiMesh *a = expected->mMeshes[i];
+        const aiMesh *b = merged->mMeshes[i];
+        ASSERT_EQ(a->mNumVertices, b->mNumVertices);
+        EXPECT_EQ(0, memcmp(a->mVertices, b->mVertices, sizeof(aiVector3D) * a->mNumVertices));
+    }
+    delete merged;
+}
+
+TEST_F(utSceneArena, orphanedSceneCanBeDeletedTest) {
+    Importer importer;
+    importer.SetPropertyBool(AI_CONFIG_GLOB_SCENE_ARENA, true);
+    ASSERT_NE(nullptr, importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", aiProcess_ValidateDataStructure));
+
+    std::unique_ptr<aiScene> scene(importer.GetOrphanedScene());
+    ASSERT_NE(nullptr, scene);
+    EXPECT_NE(nullptr, SceneArena::Get(scene.get()));
+    EXPECT_EQ(nullptr, importer.GetScene());
+}
+
+TEST_F(utSceneArena, releaseImportTest) {
+    aiPropertyStore *props = aiCreatePropertyStore();
+    aiSetImportPropertyInteger(props, AI_CONFIG_GLOB_SCENE_ARENA, 1);
+    const aiScene *scene = aiImportFileExWithProperties(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj",
+            aiProcess_Triangulate, nullptr, props);
+    aiReleasePropertyStore(props);
+    ASSERT_NE(nullptr, scene);
+    EXPECT_NE(nullptr, SceneArena::Get(scene));
+    aiReleaseImport(scene);
+}
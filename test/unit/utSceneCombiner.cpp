@@ -39,14 +39,38 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 ---------------------------------------------------------------------------
 */
 #include "UnitTestPCH.h"
+#include "Common/TaskScheduler.h"
 #include <assimp/SceneCombiner.h>
 #include <assimp/mesh.h>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+#include <assimp/Exporter.hpp>
+#include <assimp/Importer.hpp>
 #include <memory>
+#include <vector>
 
 using namespace ::Assimp;
 
 class utSceneCombiner : public ::testing::Test {
-    // empty
+protected:
+    static void compareMeshes(const aiScene *expected, const aiScene *scene) {
+        ASSERT_EQ(expected->mNumMeshes, scene->mNumMeshes);
+        for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+            const aiMesh *a = expected->mMeshes[i];
+            const aiMesh *b = scene->mMeshes[i];
+            ASSERT_EQ(a->mNumVertices, b->mNumVertices);
+            ASSERT_EQ(a->mNumFaces, b->mNumFaces);
+            EXPECT_EQ(0, memcmp(a->mVertices, b->mVertices, sizeof(aiVector3D) * a->mNumVertices));
+            ASSERT_EQ(a->HasNormals(), b->HasNormals());
+            if (a->HasNormals()) {
+                EXPECT_EQ(0, memcmp(a->mNormals, b->mNormals, sizeof(aiVector3D) * a->mNumVertices));
+            }
+            for (unsigned int f = 0; f < a->mNumFaces; ++f) {
+                ASSERT_EQ(a->mFaces[f].mNumIndices, b->mFaces[f].mNumIndices);
+                EXPECT_EQ(0, memcmp(a->mFaces[f].mIndices, b->mFaces[f].mIndices, sizeof(unsigned int) * a->mFaces[f].mNumIndices));
+            }
+        }
+    }
 };
 
 TEST_F(utSceneCombiner, MergeMeshes_ValidNames_Test) {
@@ -75,3 +99,72 @@ TEST_F(utSceneCombiner, CopySceneWithNullptr_AI_NO_EXCEPTion) {
     EXPECT_NO_THROW(SceneCombiner::CopyScene(nullptr, nullptr));
     EXPECT_NO_THROW(SceneCombiner::CopySceneFlat(nullptr, nullptr));
 }
+
+TEST_F(utSceneCombiner, CopyScene_Parallel_Test) {
+    Importer importer;
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", aiProcess_GenNormals);
+    ASSERT_NE(nullptr, scene);
+    ASSERT_LT(1u, scene->mNumMeshes);
+
+    TaskScheduler scheduler(4);
+    aiScene *copy = nullptr;
+    SceneCombiner::CopyScene(&copy, scene, true, 0, &scheduler);
+    std::unique_ptr<aiScene> holder(copy);
+    ASSERT_NE(nullptr, copy);
+
+    compareMeshes(scene, copy);
+    for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+        EXPECT_NE(scene->mMeshes[i]->mVertices, copy->mMeshes[i]->mVertices);
+    }
+    ASSERT_EQ(scene->mNumMaterials, copy->mNumMaterials);
+    for (unsigned int i = 0; i < scene->mNumMaterials; ++i) {
+        EXPECT_NE(scene->mMaterials[i], copy->mMaterials[i]);
+        EXPECT_STREQ(scene->mMaterials[i]->GetName().C_Str(), copy->mMaterials[i]->GetName().C_Str());
+    }
+}
+
+TEST_F(utSceneCombiner, CopyScene_ShareMeshData_Test) {
+    Importer importer;
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", aiProcess_GenNormals);
+    ASSERT_NE(nullptr, scene);
+
+    // the copy borrows the arrays and leaves them alone when it dies
+    TaskScheduler scheduler(4);
+    aiScene *copy = nullptr;
+    SceneCombiner::CopyScene(&copy, scene, true, AI_INT_COPY_SCENE_SHARE_MESH_DATA, &scheduler);
+    ASSERT_NE(nullptr, copy);
+    for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+        EXPECT_EQ(scene->mMeshes[i]->mVertices, copy->mMeshes[i]->mVertices);
+        EXPECT_EQ(scene->mMeshes[i]->mFaces, copy->mMeshes[i]->mFaces);
+    }
+    delete copy;
+
+    // once unique, the copy owns its data
+    copy = nullptr;
+    SceneCombiner::CopyScene(&copy, scene, true, AI_INT_COPY_SCENE_SHARE_MESH_DATA);
+    std::unique_ptr<aiScene> holder(copy);
+    SceneCombiner::MakeMeshDataUnique(copy, &scheduler);
+    for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+        EXPECT_NE(scene->mMeshes[i]->mVertices, copy->mMeshes[i]->mVertices);
+        EXPECT_NE(scene->mMeshes[i]->mFaces, copy->mMeshes[i]->mFaces);
+    }
+    compareMeshes(scene, copy);
+}
+
+#ifndef ASSIMP_BUILD_NO_EXPORT
+TEST_F(utSceneCombiner, ExportLeavesSharedSourceUnchanged_Test) {
+    Importer importer;
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", 0);
+    ASSERT_NE(nullptr, scene);
+
+    Importer expectedImporter;
+    const aiScene *expected = expectedImporter.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", 0);
+    ASSERT_NE(nullptr, expected);
+
+    // the steps run on the export copy only
+    Exporter exporter;
+    ASSERT_NE(nullptr, exporter.ExportToBlob(scene, "obj", aiProcess_FlipWindingOrder | aiProcess_MakeLeftHanded));
+    ASSERT_NE(nullptr, exporter.ExportToBlob(scene, "obj", 0));
+    compareMeshes(expected, scene);
+}
+#endif // ASSIMP_BUILD_NO_EXPORT
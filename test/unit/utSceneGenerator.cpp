@@ -0,0 +1,137 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2021, assimp team
+
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+#include "UnitTestPCH.h"
+
+#include <assimp/SceneGenerator.h>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+#include <assimp/Exporter.hpp>
+#include <assimp/Importer.hpp>
+
+#include <memory>
+
+using namespace Assimp;
+
+class utSceneGenerator : public ::testing::Test {
+protected:
+    static SceneGenerator::Params smallParams() {
+        SceneGenerator::Params params;
+        params.mNumMeshes = 5;
+        params.mNumTriangles = 100;
+        params.mNodeDepth = 3;
+        params.mNumBones = 4;
+        params.mNumKeys = 10;
+        params.mNumMaterials = 3;
+        params.mSeed = 42;
+        return params;
+    }
+};
+
+TEST_F(utSceneGenerator, requestedSizeTest) {
+    std::unique_ptr<aiScene> scene(SceneGenerator::Generate(smallParams()));
+    ASSERT_NE(nullptr, scene);
+
+    ASSERT_EQ(5u, scene->mNumMeshes);
+    EXPECT_EQ(3u, scene->mNumMaterials);
+    for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+        const aiMesh *mesh = scene->mMeshes[i];
+        EXPECT_EQ(100u, mesh->mNumFaces);
+        EXPECT_EQ(300u, mesh->mNumVertices);
+        EXPECT_TRUE(mesh->HasNormals());
+        EXPECT_TRUE(mesh->HasTextureCoords(0));
+        EXPECT_EQ(4u, mesh->mNumBones);
+        EXPECT_EQ(i % 3, mesh->mMaterialIndex);
+        EXPECT_NE(nullptr, scene->mRootNode->FindNode(mesh->mName));
+        EXPECT_NE(nullptr, scene->mRootNode->FindNode(mesh->mBones[3]->mName));
+    }
+
+    // the level nodes are nested
+    const aiNode *deepest = scene->mRootNode->FindNode("level_2");
+    ASSERT_NE(nullptr, deepest);
+    EXPECT_EQ(scene->mRootNode->FindNode("level_1"), deepest->mParent);
+
+    // one channel per bone
+    ASSERT_EQ(1u, scene->mNumAnimations);
+    ASSERT_EQ(20u, scene->mAnimations[0]->mNumChannels);
+    EXPECT_EQ(10u, scene->mAnimations[0]->mChannels[0]->mNumPositionKeys);
+}
+
+TEST_F(utSceneGenerator, seedTest) {
+    SceneGenerator::Params params = smallParams();
+    std::unique_ptr<aiScene> a(SceneGenerator::Generate(params));
+    std::unique_ptr<aiScene> b(SceneGenerator::Generate(params));
+    params.mSeed = 43;
+    std::unique_ptr<aiScene> c(SceneGenerator::Generate(params));
+
+    const size_t size = sizeof(aiVector3D) * a->mMeshes[0]->mNumVertices;
+    EXPECT_EQ(0, memcmp(a->mMeshes[0]->mVertices, b->mMeshes[0]->mVertices, size));
+    EXPECT_NE(0, memcmp(a->mMeshes[0]->mVertices, c->mMeshes[0]->mVertices, size));
+}
+
+#ifndef ASSIMP_BUILD_NO_EXPORT
+TEST_F(utSceneGenerator, exportAndReimportTest) {
+    SceneGenerator::Params params = smallParams();
+    params.mNumBones = 0;
+    params.mNumKeys = 0;
+    std::unique_ptr<aiScene> scene(SceneGenerator::Generate(params));
+
+    static const char *const Formats[][2] = {
+        { "obj", "obj" }, { "plyb", "ply" }, { "stlb", "stl" }, { "glb2", "glb" }, { "fbx", "fbx" }, { "collada", "dae" }
+    };
+    for (const auto &format : Formats) {
+        Exporter exporter;
+        const aiExportDataBlob *blob = exporter.ExportToBlob(scene.get(), format[0]);
+        ASSERT_NE(nullptr, blob) << format[0];
+
+        Importer importer;
+        const aiScene *imported = importer.ReadFileFromMemory(blob->data, blob->size, aiProcess_ValidateDataStructure, format[1]);
+        ASSERT_NE(nullptr, imported) << format[0] << ": " << importer.GetErrorString();
+
+        unsigned int numFaces = 0;
+        for (unsigned int i = 0; i < imported->mNumMeshes; ++i) {
+            numFaces += imported->mMeshes[i]->mNumFaces;
+        }
+        EXPECT_EQ(500u, numFaces) << format[0];
+    }
+}
+#endif // ASSIMP_BUILD_NO_EXPORT
@@ -0,0 +1,170 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2021, assimp team
+
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+#include "UnitTestPCH.h"
+
+#include "Common/TaskScheduler.h"
+#include <assimp/Allocator.h>
+#include <assimp/ImportLimits.h>
+#include <assimp/config.h>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+#include <assimp/Importer.hpp>
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+using namespace Assimp;
+
+class utTaskScheduler : public ::testing::Test {
+protected:
+    static void compareMeshes(const aiScene *expected, const aiScene *scene) {
+        ASSERT_EQ(expected->mNumMeshes, scene->mNumMeshes);
+        for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+            const aiMesh *a = expected->mMeshes[i];
+            const aiMesh *b = scene->mMeshes[i];
+            ASSERT_EQ(a->mNumVertices, b->mNumVertices);
+            ASSERT_EQ(a->mNumFaces, b->mNumFaces);
+            EXPECT_EQ(0, memcmp(a->mVertices, b->mVertices, sizeof(aiVector3D) * a->mNumVertices));
+            ASSERT_EQ(a->HasNormals(), b->HasNormals());
+            if (a->HasNormals()) {
+                EXPECT_EQ(0, memcmp(a->mNormals, b->mNormals, sizeof(aiVector3D) * a->mNumVertices));
+            }
+            ASSERT_EQ(a->HasTangentsAndBitangents(), b->HasTangentsAndBitangents());
+            if (a->HasTangentsAndBitangents()) {
+                EXPECT_EQ(0, memcmp(a->mTangents, b->mTangents, sizeof(aiVector3D) * a->mNumVertices));
+            }
+            for (unsigned int f = 0; f < a->mNumFaces; ++f) {
+                ASSERT_EQ(a->mFaces[f].mNumIndices, b->mFaces[f].mNumIndices);
+                EXPECT_EQ(0, memcmp(a->mFaces[f].mIndices, b->mFaces[f].mIndices, sizeof(unsigned int) * a->mFaces[f].mNumIndices));
+            }
+        }
+    }
+};
+
+TEST_F(utTaskScheduler, visitsEachIndexOnceTest) {
+    TaskScheduler scheduler(4);
+    EXPECT_EQ(4u, scheduler.GetNumThreads());
+
+    std::vector<std::atomic<int>> visits(1000);
+    for (auto &v : visits) {
+        v = 0;
+    }
+    scheduler.ParallelFor(visits.size(), [&](size_t i) {
+        ++visits[i];
+    });
+    for (auto &v : visits) {
+        EXPECT_EQ(1, v);
+    }
+
+    // the scheduler can be reused
+    scheduler.ParallelFor(visits.size(), [&](size_t i) {
+        ++visits[i];
+    });
+    for (auto &v : visits) {
+        EXPECT_EQ(2, v);
+    }
+}
+
+TEST_F(utTaskScheduler, nestedCallsRunSeriallyTest) {
+    TaskScheduler scheduler(3);
+    std::atomic<int> sum(0);
+    scheduler.ParallelFor(10, [&](size_t) {
+        scheduler.ParallelFor(10, [&](size_t j) {
+            sum += static_cast<int>(j);
+        });
+    });
+    EXPECT_EQ(450, sum);
+}
+
+TEST_F(utTaskScheduler, rethrowsLowestIndexTest) {
+    TaskScheduler scheduler(4);
+    try {
+        scheduler.ParallelFor(100, [](size_t i) {
+            if (i == 17 || i == 63 || i == 98) {
+                throw std::runtime_error(std::to_string(i));
+            }
+        });
+        FAIL() << "exception expected";
+    } catch (const std::runtime_error &e) {
+        EXPECT_STREQ("17", e.what());
+    }
+}
+
+TEST_F(utTaskScheduler, tasksRunWithTheContextOfTheirBatchTest) {
+    TaskScheduler scheduler(4);
+    ImportLimits first(0, 0), second(0, 0);
+    CountingAllocator firstAllocator, secondAllocator;
+
+    // short batches back to back, so late workers meet the next batch
+    std::atomic<int> mismatches(0);
+    for (int batch = 0; batch < 2000; ++batch) {
+        ImportLimits *limits = (batch & 1) ? &second : &first;
+        Allocator *allocator = (batch & 1) ? static_cast<Allocator *>(&secondAllocator) : &firstAllocator;
+        ImportLimits::Scope limitsScope(limits);
+        Allocator::Scope allocatorScope(allocator);
+        scheduler.ParallelFor(8, [&](size_t) {
+            if (ImportLimits::GetActive() != limits || Allocator::GetActive() != allocator) {
+                ++mismatches;
+            }
+        });
+    }
+    EXPECT_EQ(0, mismatches);
+}
+
+TEST_F(utTaskScheduler, outputDoesNotDependOnThreadCountTest) {
+    const char *file = ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj";
+    const unsigned int flags = aiProcessPreset_TargetRealtime_MaxQuality | aiProcess_ValidateDataStructure;
+
+    Importer serialImporter;
+    const aiScene *expected = serialImporter.ReadFile(file, flags);
+    ASSERT_NE(nullptr, expected);
+    ASSERT_LT(1u, expected->mNumMeshes);
+
+    Importer parallelImporter;
+    parallelImporter.SetPropertyInteger(AI_CONFIG_GLOB_MULTITHREADING, 4);
+    const aiScene *scene = parallelImporter.ReadFile(file, flags);
+    ASSERT_NE(nullptr, scene);
+
+    compareMeshes(expected, scene);
+}
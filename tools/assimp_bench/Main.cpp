@@ -0,0 +1,633 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2021, assimp team
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+/** @file  Main.cpp
+ *  @brief main() function of assimp_bench
+ *
+ *  Measures the import throughput of all importers and the run time of
+ *  all post processing steps over a directory of models plus a large
+ *  scene from the SceneGenerator, written in several formats. Results are printed as a table and can be
+ *  written as JSON to compare them between builds.
+ */
+
+#include <assimp/SceneGenerator.h>
+#include <assimp/importerdesc.h>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+#include <assimp/version.h>
+#include <assimp/Exporter.hpp>
+#include <assimp/Importer.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#   include <windows.h>
+#else
+#   include <dirent.h>
+#   include <fcntl.h>
+#   include <sys/stat.h>
+#   include <unistd.h>
+#endif
+
+using namespace Assimp;
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+
+// ------------------------------------------------------------------------------------------------
+// Command line options
+struct Options {
+    std::string mModelsDir = ASSIMP_BENCH_MODELS_DIR;
+    std::string mWorkDir;
+    std::string mJsonFile;
+    std::string mFilter;
+    unsigned int mRuns = 3;
+    unsigned int mNumTriangles = 131072;
+    bool mCold = false;
+    bool mImports = true;
+    bool mSteps = true;
+    bool mGenerated = true;
+};
+
+// ------------------------------------------------------------------------------------------------
+// Run times of one benchmark along with the amount of data it processed
+struct Sample {
+    std::string mFile;
+    std::string mName;
+    size_t mBytes = 0;
+    size_t mVertices = 0;
+    size_t mFaces = 0;
+    std::vector<double> mSeconds;
+    std::string mError;
+
+    double Percentile(double p) const {
+        std::vector<double> sorted(mSeconds);
+        std::sort(sorted.begin(), sorted.end());
+        const size_t rank = static_cast<size_t>(p / 100.0 * sorted.size() + 0.999999);
+        return sorted[std::min(sorted.size(), std::max<size_t>(rank, 1)) - 1];
+    }
+
+    double Mean() const {
+        double sum = 0.0;
+        for (double s : mSeconds) {
+            sum += s;
+        }
+        return sum / mSeconds.size();
+    }
+};
+
+// ------------------------------------------------------------------------------------------------
+// Totals of several samples, per importer or per post processing step
+struct Summary {
+    size_t mFiles = 0;
+    size_t mBytes = 0;
+    size_t mVertices = 0;
+    double mSeconds = 0.0;
+};
+
+// ------------------------------------------------------------------------------------------------
+struct Step {
+    unsigned int mFlag;
+    const char *mName;
+};
+
+// all steps which work on an imported scene without further configuration
+const Step Steps[] = {
+    { aiProcess_CalcTangentSpace, "CalcTangentSpace" },
+    { aiProcess_JoinIdenticalVertices, "JoinIdenticalVertices" },
+    { aiProcess_MakeLeftHanded, "MakeLeftHanded" },
+    { aiProcess_Triangulate, "Triangulate" },
+    { aiProcess_GenNormals, "GenNormals" },
+    { aiProcess_GenSmoothNormals, "GenSmoothNormals" },
+    { aiProcess_SplitLargeMeshes, "SplitLargeMeshes" },
+    { aiProcess_PreTransformVertices, "PreTransformVertices" },
+    { aiProcess_LimitBoneWeights, "LimitBoneWeights" },
+    { aiProcess_ValidateDataStructure, "ValidateDataStructure" },
+    { aiProcess_ImproveCacheLocality, "ImproveCacheLocality" },
+    { aiProcess_RemoveRedundantMaterials, "RemoveRedundantMaterials" },
+    { aiProcess_FixInfacingNormals, "FixInfacingNormals" },
+    { aiProcess_SortByPType, "SortByPType" },
+    { aiProcess_FindDegenerates, "FindDegenerates" },
+    { aiProcess_FindInvalidData, "FindInvalidData" },
+    { aiProcess_GenUVCoords, "GenUVCoords" },
+    { aiProcess_TransformUVCoords, "TransformUVCoords" },
+    { aiProcess_FindInstances, "FindInstances" },
+    { aiProcess_OptimizeMeshes, "OptimizeMeshes" },
+    { aiProcess_OptimizeGraph, "OptimizeGraph" },
+    { aiProcess_FlipUVs, "FlipUVs" },
+    { aiProcess_FlipWindingOrder, "FlipWindingOrder" },
+    { aiProcess_SplitByBoneCount, "SplitByBoneCount" },
+    { aiProcess_Debone, "Debone" },
+    { aiProcess_GenBoundingBoxes, "GenBoundingBoxes" },
+};
+
+// ------------------------------------------------------------------------------------------------
+void PrintUsage() {
+    std::cout <<
+            "Usage: assimp_bench [options]\n"
+            "  --models <dir>    Directory searched recursively for models (default: test/models)\n"
+            "  --filter <text>   Only use files whose path contains <text>\n"
+            "  --runs <n>        Measured runs per benchmark, after one warm-up run (default: 3)\n"
+            "  --cold            Drop the files from the page cache before each run\n"
+            "  --triangles <n>   Triangles of each of the 4 meshes of the generated scene,\n"
+            "                    0 to skip it (default: 131072)\n"
+            "  --work-dir <dir>  Directory for the generated inputs (default: temp directory)\n"
+            "  --no-imports      Skip the importer benchmarks\n"
+            "  --no-steps        Skip the post processing benchmarks\n"
+            "  --json <file>     Write the results as JSON, - for stdout\n";
+}
+
+// ------------------------------------------------------------------------------------------------
+bool ParseOptions(int argc, char *argv[], Options &options) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if (arg == "--models" && hasValue) {
+            options.mModelsDir = argv[++i];
+        } else if (arg == "--filter" && hasValue) {
+            options.mFilter = argv[++i];
+        } else if (arg == "--runs" && hasValue) {
+            options.mRuns = std::max(1, atoi(argv[++i]));
+        } else if (arg == "--cold") {
+            options.mCold = true;
+        } else if (arg == "--triangles" && hasValue) {
+            options.mNumTriangles = static_cast<unsigned int>(std::max(0, atoi(argv[++i])));
+            options.mGenerated = options.mNumTriangles > 0;
+        } else if (arg == "--work-dir" && hasValue) {
+            options.mWorkDir = argv[++i];
+        } else if (arg == "--no-imports") {
+            options.mImports = false;
+        } else if (arg == "--no-steps") {
+            options.mSteps = false;
+        } else if (arg == "--json" && hasValue) {
+            options.mJsonFile = argv[++i];
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+std::string GetTempDirectory() {
+#ifdef _WIN32
+    char buffer[MAX_PATH + 1];
+    const DWORD len = ::GetTempPathA(MAX_PATH, buffer);
+    return len ? std::string(buffer, len) : std::string(".");
+#else
+    const char *tmp = ::getenv("TMPDIR");
+    return tmp && *tmp ? tmp : "/tmp";
+#endif
+}
+
+// ------------------------------------------------------------------------------------------------
+// Collect all files below a directory, sorted for stable output
+void ListFiles(const std::string &dir, std::vector<std::string> &files) {
+#ifdef _WIN32
+    WIN32_FIND_DATAA data;
+    HANDLE find = ::FindFirstFileA((dir + "\\*").c_str(), &data);
+    if (INVALID_HANDLE_VALUE == find) {
+        return;
+    }
+    do {
+        const std::string name = data.cFileName;
+        if (name == "." || name == "..") {
+            continue;
+        }
+        const std::string path = dir + "/" + name;
+        if (data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) {
+            ListFiles(path, files);
+        } else {
+            files.push_back(path);
+        }
+    } while (::FindNextFileA(find, &data));
+    ::FindClose(find);
+#else
+    DIR *d = ::opendir(dir.c_str());
+    if (nullptr == d) {
+        return;
+    }
+    while (struct dirent *entry = ::readdir(d)) {
+        const std::string name = entry->d_name;
+        if (name == "." || name == "..") {
+            continue;
+        }
+        const std::string path = dir + "/" + name;
+        struct stat st;
+        if (0 != ::stat(path.c_str(), &st)) {
+            continue;
+        }
+        if (S_ISDIR(st.st_mode)) {
+            ListFiles(path, files);
+        } else if (S_ISREG(st.st_mode)) {
+            files.push_back(path);
+        }
+    }
+    ::closedir(d);
+#endif
+    std::sort(files.begin(), files.end());
+}
+
+// ------------------------------------------------------------------------------------------------
+size_t GetFileSize(const std::string &file) {
+    std::ifstream in(file.c_str(), std::ios::binary | std::ios::ate);
+    return in ? static_cast<size_t>(in.tellg()) : 0;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Ask the OS to forget the cached pages of a file, so the next read hits the disk
+void DropFromCache(const std::string &file) {
+#if defined(POSIX_FADV_DONTNEED)
+    const int fd = ::open(file.c_str(), O_RDONLY);
+    if (fd >= 0) {
+        ::fdatasync(fd);
+        ::posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+        ::close(fd);
+    }
+#else
+    (void)file;
+#endif
+}
+
+// ------------------------------------------------------------------------------------------------
+std::string GetExtension(const std::string &file) {
+    const std::string::size_type slash = file.find_last_of("/\\");
+    const std::string::size_type dot = file.find_last_of('.');
+    if (std::string::npos == dot || (std::string::npos != slash && dot < slash)) {
+        return std::string();
+    }
+    std::string ext = file.substr(dot + 1);
+    std::transform(ext.begin(), ext.end(), ext.begin(), [](char c) { return static_cast<char>(::tolower(c)); });
+    return ext;
+}
+
+// ------------------------------------------------------------------------------------------------
+void CountGeometry(const aiScene *scene, Sample &sample) {
+    sample.mVertices = 0;
+    sample.mFaces = 0;
+    for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+        sample.mVertices += scene->mMeshes[i]->mNumVertices;
+        sample.mFaces += scene->mMeshes[i]->mNumFaces;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+// Write a synthetic scene in several formats, large enough to show throughput
+void GenerateInputs(const Options &options, std::vector<std::string> &files) {
+#ifndef ASSIMP_BUILD_NO_EXPORT
+    const std::string dir = options.mWorkDir.empty() ? GetTempDirectory() : options.mWorkDir;
+
+    SceneGenerator::Params params;
+    params.mNumMeshes = 4;
+    params.mNumTriangles = options.mNumTriangles;
+    params.mNodeDepth = 4;
+    params.mNumMaterials = 4;
+    std::unique_ptr<aiScene> scene(SceneGenerator::Generate(params));
+
+    static const char *const Formats[][2] = {
+        { "obj", "obj" }, { "stlb", "stl" }, { "plyb", "ply" }, { "glb2", "glb" }, { "fbx", "fbx" }, { "collada", "dae" }
+    };
+    Exporter exporter;
+    for (const auto &format : Formats) {
+        const std::string file = dir + "/assimp_bench_generated_" + format[0] + "." + format[1];
+        if (AI_SUCCESS == exporter.Export(scene.get(), format[0], file)) {
+            files.push_back(file);
+        } else {
+            fprintf(stderr, "assimp_bench: can't write %s: %s\n", file.c_str(), exporter.GetErrorString());
+        }
+    }
+#else
+    (void)options;
+    (void)files;
+#endif
+}
+
+// ------------------------------------------------------------------------------------------------
+// Import a file once untimed to warm up the caches, then measure options.mRuns imports
+bool BenchImport(const Options &options, const std::string &file, Sample &sample) {
+    sample.mFile = file;
+    sample.mBytes = GetFileSize(file);
+    for (unsigned int run = 0; run <= options.mRuns; ++run) {
+        if (options.mCold) {
+            DropFromCache(file);
+        }
+
+        Importer importer;
+        const Clock::time_point start = Clock::now();
+        const aiScene *scene = importer.ReadFile(file, 0);
+        const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+        if (nullptr == scene) {
+            sample.mError = importer.GetErrorString();
+            return false;
+        }
+        if (0 == run) {
+            CountGeometry(scene, sample);
+        } else {
+            sample.mSeconds.push_back(seconds);
+        }
+    }
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Measure a single post processing step on freshly imported copies of a file
+void BenchStep(const Options &options, const std::string &file, const Step &step, Sample &sample) {
+    sample.mFile = file;
+    sample.mName = step.mName;
+    sample.mBytes = GetFileSize(file);
+    for (unsigned int run = 0; run <= options.mRuns; ++run) {
+        Importer importer;
+        const aiScene *scene = importer.ReadFile(file, 0);
+        if (nullptr == scene) {
+            sample.mError = importer.GetErrorString();
+            return;
+        }
+        if (0 == run) {
+            CountGeometry(scene, sample);
+        }
+
+        const Clock::time_point start = Clock::now();
+        scene = importer.ApplyPostProcessing(step.mFlag);
+        const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+        if (nullptr == scene) {
+            sample.mError = importer.GetErrorString();
+            return;
+        }
+        if (run > 0) {
+            sample.mSeconds.push_back(seconds);
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+std::string JsonString(const std::string &in) {
+    std::string out = "\"";
+    for (char c : in) {
+        switch (c) {
+        case '"':
+            out += "\\\"";
+            break;
+        case '\\':
+            out += "\\\\";
+            break;
+        case '\n':
+            out += "\\n";
+            break;
+        case '\t':
+            out += "\\t";
+            break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                char buffer[8];
+                ::snprintf(buffer, sizeof(buffer), "\\u%04x", c);
+                out += buffer;
+            } else {
+                out += c;
+            }
+        }
+    }
+    return out + "\"";
+}
+
+// ------------------------------------------------------------------------------------------------
+double PerSecond(double amount, double seconds) {
+    return seconds > 0.0 ? amount / seconds : 0.0;
+}
+
+// ------------------------------------------------------------------------------------------------
+void WriteSampleJson(std::ostream &out, const Sample &sample, const char *nameKey) {
+    out << "    {\"file\": " << JsonString(sample.mFile)
+        << ", " << JsonString(nameKey) << ": " << JsonString(sample.mName)
+        << ", \"bytes\": " << sample.mBytes
+        << ", \"vertices\": " << sample.mVertices
+        << ", \"faces\": " << sample.mFaces;
+    if (!sample.mError.empty()) {
+        out << ", \"error\": " << JsonString(sample.mError) << "}";
+        return;
+    }
+    const double median = sample.Percentile(50);
+    out << ", \"seconds\": [";
+    for (size_t i = 0; i < sample.mSeconds.size(); ++i) {
+        out << (i ? ", " : "") << sample.mSeconds[i];
+    }
+    out << "], \"min\": " << sample.Percentile(0)
+        << ", \"mean\": " << sample.Mean()
+        << ", \"p50\": " << median
+        << ", \"p90\": " << sample.Percentile(90)
+        << ", \"p99\": " << sample.Percentile(99)
+        << ", \"max\": " << sample.Percentile(100)
+        << ", \"mb_per_s\": " << PerSecond(sample.mBytes / 1e6, median)
+        << ", \"vertices_per_s\": " << PerSecond(static_cast<double>(sample.mVertices), median) << "}";
+}
+
+// ------------------------------------------------------------------------------------------------
+void WriteSummaryJson(std::ostream &out, const std::map<std::string, Summary> &summaries, const char *nameKey) {
+    bool first = true;
+    for (const auto &entry : summaries) {
+        const Summary &s = entry.second;
+        out << (first ? "" : ",\n") << "    {" << JsonString(nameKey) << ": " << JsonString(entry.first)
+            << ", \"files\": " << s.mFiles
+            << ", \"bytes\": " << s.mBytes
+            << ", \"vertices\": " << s.mVertices
+            << ", \"seconds\": " << s.mSeconds
+            << ", \"mb_per_s\": " << PerSecond(s.mBytes / 1e6, s.mSeconds)
+            << ", \"vertices_per_s\": " << PerSecond(static_cast<double>(s.mVertices), s.mSeconds) << "}";
+        first = false;
+    }
+    out << "\n";
+}
+
+// ------------------------------------------------------------------------------------------------
+void WriteJson(std::ostream &out, const Options &options,
+        const std::vector<Sample> &imports, const std::map<std::string, Summary> &importers,
+        const std::vector<Sample> &steps, const std::map<std::string, Summary> &stepSummaries) {
+    out.precision(9);
+
+    char date[32] = {};
+    const time_t now = ::time(nullptr);
+    ::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%SZ", ::gmtime(&now));
+
+    out << "{\n  \"assimp\": {\"version\": \"" << aiGetVersionMajor() << "." << aiGetVersionMinor() << "." << aiGetVersionPatch()
+        << "\", \"revision\": \"" << std::hex << aiGetVersionRevision() << std::dec
+        << "\", \"branch\": " << JsonString(aiGetBranchName() ? aiGetBranchName() : "")
+        << ", \"compile_flags\": " << aiGetCompileFlags() << "},\n";
+    out << "  \"date\": \"" << date << "\",\n";
+    out << "  \"runs\": " << options.mRuns << ",\n";
+    out << "  \"cold\": " << (options.mCold ? "true" : "false") << ",\n";
+
+    out << "  \"imports\": [\n";
+    for (size_t i = 0; i < imports.size(); ++i) {
+        WriteSampleJson(out, imports[i], "importer");
+        out << (i + 1 < imports.size() ? ",\n" : "\n");
+    }
+    out << "  ],\n  \"importers\": [\n";
+    WriteSummaryJson(out, importers, "importer");
+    out << "  ],\n  \"steps\": [\n";
+    for (size_t i = 0; i < steps.size(); ++i) {
+        WriteSampleJson(out, steps[i], "step");
+        out << (i + 1 < steps.size() ? ",\n" : "\n");
+    }
+    out << "  ],\n  \"step_totals\": [\n";
+    WriteSummaryJson(out, stepSummaries, "step");
+    out << "  ]\n}\n";
+}
+
+// ------------------------------------------------------------------------------------------------
+void PrintSummaries(FILE *out, const char *title, const std::map<std::string, Summary> &summaries) {
+    fprintf(out, "\n%-28s %6s %12s %12s %10s %14s\n", title, "files", "MB", "seconds", "MB/s", "vertices/s");
+    for (const auto &entry : summaries) {
+        const Summary &s = entry.second;
+        fprintf(out, "%-28s %6u %12.3f %12.6f %10.2f %14.0f\n", entry.first.c_str(), static_cast<unsigned int>(s.mFiles),
+                s.mBytes / 1e6, s.mSeconds, PerSecond(s.mBytes / 1e6, s.mSeconds),
+                PerSecond(static_cast<double>(s.mVertices), s.mSeconds));
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void AddToSummary(std::map<std::string, Summary> &summaries, const Sample &sample) {
+    Summary &s = summaries[sample.mName];
+    ++s.mFiles;
+    s.mBytes += sample.mBytes;
+    s.mVertices += sample.mVertices;
+    s.mSeconds += sample.Percentile(50);
+}
+
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+int main(int argc, char *argv[]) {
+    Options options;
+    if (!ParseOptions(argc, argv, options)) {
+        PrintUsage();
+        return 1;
+    }
+
+    std::vector<std::string> files;
+    ListFiles(options.mModelsDir, files);
+    if (options.mGenerated) {
+        GenerateInputs(options, files);
+    }
+
+    // keep the files assimp claims by their extension
+    Importer probe;
+    std::vector<std::pair<std::string, std::string>> inputs;
+    for (const std::string &file : files) {
+        if (!options.mFilter.empty() && std::string::npos == file.find(options.mFilter)) {
+            continue;
+        }
+        const std::string ext = GetExtension(file);
+        const size_t index = ext.empty() ? static_cast<size_t>(-1) : probe.GetImporterIndex(ext.c_str());
+        if (static_cast<size_t>(-1) == index) {
+            continue;
+        }
+        const aiImporterDesc *desc = probe.GetImporterInfo(index);
+        inputs.emplace_back(file, desc && desc->mName ? desc->mName : ext);
+    }
+    fprintf(stderr, "assimp_bench: %u input files, %u runs each\n", static_cast<unsigned int>(inputs.size()), options.mRuns);
+
+    std::vector<Sample> imports;
+    std::map<std::string, Summary> importers;
+    std::vector<std::string> importable;
+    for (const auto &input : inputs) {
+        Sample sample;
+        sample.mName = input.second;
+        if (BenchImport(options, input.first, sample)) {
+            importable.push_back(input.first);
+            if (options.mImports) {
+                AddToSummary(importers, sample);
+            }
+        }
+        if (options.mImports) {
+            imports.push_back(sample);
+        }
+    }
+
+    std::vector<Sample> steps;
+    std::map<std::string, Summary> stepSummaries;
+    if (options.mSteps) {
+        for (const Step &step : Steps) {
+            fprintf(stderr, "assimp_bench: %s\n", step.mName);
+            for (const std::string &file : importable) {
+                Sample sample;
+                BenchStep(options, file, step, sample);
+                if (sample.mError.empty()) {
+                    AddToSummary(stepSummaries, sample);
+                }
+                steps.push_back(sample);
+            }
+        }
+    }
+
+    // the tables go to stderr if stdout receives the JSON
+    FILE *table = options.mJsonFile == "-" ? stderr : stdout;
+    if (options.mImports) {
+        PrintSummaries(table, "importer", importers);
+    }
+    if (options.mSteps) {
+        PrintSummaries(table, "step", stepSummaries);
+    }
+
+    if (options.mJsonFile == "-") {
+        WriteJson(std::cout, options, imports, importers, steps, stepSummaries);
+    } else if (!options.mJsonFile.empty()) {
+        std::ofstream out(options.mJsonFile.c_str());
+        if (!out) {
+            fprintf(stderr, "assimp_bench: can't write %s\n", options.mJsonFile.c_str());
+            return 1;
+        }
+        WriteJson(out, options, imports, importers, steps, stepSummaries);
+    }
+    return 0;
+}
@@ -0,0 +1,140 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2021, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms, 
+with or without modification, are permitted provided that the following 
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT 
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT 
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT 
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY 
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+
+/** @file  Generate.cpp
+ *  @brief Implementation of the 'assimp generate' utility
+ */
+
+#include "Main.h"
+#include <assimp/SceneGenerator.h>
+#include <assimp/StringUtils.h>
+
+#include <memory>
+
+#ifndef ASSIMP_BUILD_NO_EXPORT
+
+const char *AICMD_MSG_GENERATE_HELP_E =
+        "assimp generate <out> [-f<h>] [options]\n"
+        "\t Write a synthetic scene, the same options always give the same file.\n"
+        "\t -f<h> Specify the file format. If omitted, the output format is \n"
+        "\t\tderived from the file extension of the given output file  \n"
+        "\t --meshes=<n>     Number of meshes (default: 1)\n"
+        "\t --triangles=<n>  Triangles per mesh (default: 1024)\n"
+        "\t --depth=<n>      Depth of the node hierarchy (default: 1)\n"
+        "\t --bones=<n>      Bones per mesh (default: 0)\n"
+        "\t --keys=<n>       Keys per animation channel, 0 for none (default: 0)\n"
+        "\t --materials=<n>  Number of materials (default: 1)\n"
+        "\t --seed=<n>       Seed of the random numbers (default: 1)\n";
+
+size_t GetMatchingFormat(const std::string &outf, bool byext);
+
+// -----------------------------------------------------------------------------------
+static bool ParseCount(const char *param, const char *name, unsigned int &out) {
+    const size_t len = strlen(name);
+    if (strncmp(param, name, len)) {
+        return false;
+    }
+    out = static_cast<unsigned int>(strtoul(param + len, nullptr, 10));
+    return true;
+}
+
+// -----------------------------------------------------------------------------------
+int Assimp_Generate(const char *const *params, unsigned int num) {
+    if (num < 1) {
+        printf("assimp generate: Invalid number of arguments. See \'assimp generate --help\'\n");
+        return AssimpCmdError::InvalidNumberOfArguments;
+    }
+
+    // --help
+    if (!strcmp(params[0], "-h") || !strcmp(params[0], "--help") || !strcmp(params[0], "-?")) {
+        printf("%s", AICMD_MSG_GENERATE_HELP_E);
+        return AssimpCmdError::Success;
+    }
+
+    const std::string out = params[0];
+    std::string outf;
+    Assimp::SceneGenerator::Params gen;
+    for (unsigned int i = 1; i < num; ++i) {
+        unsigned int seed = 0;
+        if (!strncmp(params[i], "-f", 2)) {
+            outf = std::string(params[i] + 2);
+        } else if (!strncmp(params[i], "--format=", 9)) {
+            outf = std::string(params[i] + 9);
+        } else if (ParseCount(params[i], "--seed=", seed)) {
+            gen.mSeed = seed;
+        } else if (!ParseCount(params[i], "--meshes=", gen.mNumMeshes) &&
+                   !ParseCount(params[i], "--triangles=", gen.mNumTriangles) &&
+                   !ParseCount(params[i], "--depth=", gen.mNodeDepth) &&
+                   !ParseCount(params[i], "--bones=", gen.mNumBones) &&
+                   !ParseCount(params[i], "--keys=", gen.mNumKeys) &&
+                   !ParseCount(params[i], "--materials=", gen.mNumMaterials)) {
+            printf("assimp generate: unknown option \'%s\'\n", params[i]);
+            return AssimpCmdError::InvalidNumberOfArguments;
+        }
+    }
+
+    std::transform(outf.begin(), outf.end(), outf.begin(), ai_tolower<char>);
+
+    // convert the output format to a format id, or guess it from the file name
+    size_t outfi = GetMatchingFormat(outf, false);
+    if (outfi == SIZE_MAX) {
+        const std::string::size_type s = out.find_last_of('.');
+        outfi = GetMatchingFormat(s == std::string::npos ? outf : out.substr(s + 1), true);
+        if (outfi == SIZE_MAX) {
+            printf("assimp generate: no output format specified and I failed to guess it\n");
+            return -23;
+        }
+    }
+
+    const aiExportFormatDesc *const e = globalExporter->GetExportFormatDescription(outfi);
+    printf("assimp generate: %u meshes with %u triangles each, file format \'%s\'\n",
+            gen.mNumMeshes, gen.mNumTriangles, e->id);
+
+    std::unique_ptr<aiScene> scene(Assimp::SceneGenerator::Generate(gen));
+    if (!ExportModel(scene.get(), ImportData(), out, e->id)) {
+        return AssimpCmdExportError::FailedToExportModel;
+    }
+    printf("assimp generate: wrote output file: %s\n", out.c_str());
+    return AssimpCmdError::Success;
+}
+
+#endif // no export
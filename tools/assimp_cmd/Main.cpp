@@ -65,6 +65,7 @@ const char* AICMD_MSG_HELP =
 " \texport     - Export a file to one of the supported output formats\n"
 " \tlistexport - List all supported export formats\n"
 " \texportinfo - Show basic information on a specific export format\n"
+" \tgenerate   - Write a synthetic scene of a given size\n"
 #endif
 " \textract    - Extract embedded texture images\n"
 " \tdump       - Convert models to a binary or textual dump (ASSBIN/ASSXML)\n"
@@ -187,6 +188,12 @@ int main (int argc, char* argv[])
 		return Assimp_Export (&argv[2],argc-2);
 	}
 
+	// assimp generate
+	// Write a synthetic scene
+	if (! strcmp(argv[1], "generate")) {
+		return Assimp_Generate (&argv[2],argc-2);
+	}
+
 #endif
 
 	// assimp knowext
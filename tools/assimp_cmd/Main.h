@@ -199,6 +199,15 @@ int Assimp_Export (
 	const char* const* params, 
 	unsigned int num);
 
+// ------------------------------------------------------------------------------
+/** assimp_generate utility
+ *  @param params Command line parameters to 'assimp generate'
+ *  @param Number of params
+ *  @return Either an #AssimpCmdError or #AssimpCmdExportError value. */
+int Assimp_Generate (
+	const char* const* params, 
+	unsigned int num);
+
 /// \enum AssimpCmdExtractError
 /// \brief Error codes used by the 'Image Extractor' utility.
 enum AssimpCmdExtractError {